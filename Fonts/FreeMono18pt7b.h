@@ -1,363 +1,333 @@
 const uint8_t FreeMono18pt7bBitmaps[] PROGMEM = {
-  0x27, 0x77, 0x77, 0x77, 0x77, 0x22, 0x22, 0x20, 0x00, 0x6F, 0xF6, 0xF1,
-  0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1E, 0xC3, 0x98, 0x33, 0x06, 0x60, 0xCC,
-  0x18, 0x04, 0x20, 0x10, 0x80, 0x42, 0x01, 0x08, 0x04, 0x20, 0x10, 0x80,
-  0x42, 0x01, 0x10, 0x04, 0x41, 0xFF, 0xF0, 0x44, 0x02, 0x10, 0x08, 0x40,
-  0x21, 0x0F, 0xFF, 0xC2, 0x10, 0x08, 0x40, 0x21, 0x00, 0x84, 0x02, 0x10,
-  0x08, 0x40, 0x23, 0x00, 0x88, 0x02, 0x20, 0x02, 0x00, 0x10, 0x00, 0x80,
-  0x1F, 0xA3, 0x07, 0x10, 0x09, 0x00, 0x48, 0x00, 0x40, 0x03, 0x00, 0x0C,
-  0x00, 0x3C, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x20, 0x01, 0x80, 0x0C, 0x00,
-  0x70, 0x05, 0xE0, 0xC9, 0xF8, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00,
-  0x10, 0x00, 0x1E, 0x00, 0x42, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08,
-  0x10, 0x08, 0x40, 0x0F, 0x00, 0x00, 0x1E, 0x01, 0xF0, 0x1F, 0x01, 0xE0,
-  0x0E, 0x00, 0x00, 0x3C, 0x00, 0x86, 0x02, 0x06, 0x04, 0x04, 0x08, 0x08,
-  0x10, 0x30, 0x10, 0xC0, 0x1E, 0x00, 0x0F, 0xC1, 0x00, 0x20, 0x02, 0x00,
-  0x20, 0x02, 0x00, 0x10, 0x01, 0x00, 0x08, 0x03, 0xC0, 0x6C, 0x3C, 0x62,
-  0x82, 0x68, 0x34, 0x81, 0xCC, 0x08, 0x61, 0xC3, 0xE7, 0xFF, 0xFF, 0xF6,
-  0x66, 0x66, 0x08, 0xC4, 0x62, 0x31, 0x8C, 0xC6, 0x31, 0x8C, 0x63, 0x18,
-  0xC3, 0x18, 0xC2, 0x18, 0xC3, 0x18, 0x86, 0x10, 0xC2, 0x18, 0xC6, 0x10,
-  0xC6, 0x31, 0x8C, 0x63, 0x18, 0x8C, 0x62, 0x31, 0x98, 0x80, 0x02, 0x00,
-  0x10, 0x00, 0x80, 0x04, 0x0C, 0x21, 0x9D, 0x70, 0x1C, 0x00, 0xA0, 0x0D,
-  0x80, 0xC6, 0x04, 0x10, 0x40, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00,
-  0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0xFF, 0xFE, 0x02,
-  0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80,
-  0x01, 0x00, 0x3E, 0x78, 0xF3, 0xC7, 0x8E, 0x18, 0x70, 0xC1, 0x80, 0xFF,
-  0xFE, 0x77, 0xFF, 0xF7, 0x00, 0x00, 0x08, 0x00, 0xC0, 0x04, 0x00, 0x60,
-  0x02, 0x00, 0x30, 0x01, 0x00, 0x18, 0x00, 0x80, 0x0C, 0x00, 0x40, 0x02,
-  0x00, 0x20, 0x01, 0x00, 0x10, 0x00, 0x80, 0x08, 0x00, 0x40, 0x04, 0x00,
-  0x20, 0x02, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x0F, 0x81, 0x82, 0x08, 0x08, 0x80, 0x24, 0x01, 0x60, 0x0E, 0x00, 0x30,
-  0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00,
-  0x30, 0x03, 0x40, 0x12, 0x00, 0x88, 0x08, 0x60, 0xC0, 0xF8, 0x00, 0x06,
-  0x00, 0x70, 0x06, 0x80, 0x64, 0x06, 0x20, 0x31, 0x00, 0x08, 0x00, 0x40,
-  0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00,
-  0x40, 0x02, 0x00, 0x10, 0x00, 0x80, 0x04, 0x0F, 0xFF, 0x80, 0x0F, 0x80,
-  0xC3, 0x08, 0x04, 0x80, 0x24, 0x00, 0x80, 0x04, 0x00, 0x20, 0x02, 0x00,
-  0x10, 0x01, 0x00, 0x10, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-  0x18, 0x01, 0x80, 0x58, 0x03, 0x80, 0x1F, 0xFF, 0x80, 0x0F, 0xC0, 0xC0,
-  0x86, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00,
-  0x20, 0x0F, 0x00, 0x06, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x40,
-  0x01, 0x00, 0x04, 0x00, 0x2C, 0x01, 0x9C, 0x0C, 0x0F, 0xC0, 0x01, 0xC0,
-  0x14, 0x02, 0x40, 0x64, 0x04, 0x40, 0xC4, 0x08, 0x41, 0x84, 0x10, 0x42,
-  0x04, 0x20, 0x44, 0x04, 0x40, 0x48, 0x04, 0xFF, 0xF0, 0x04, 0x00, 0x40,
-  0x04, 0x00, 0x40, 0x04, 0x07, 0xF0, 0x3F, 0xF0, 0x80, 0x02, 0x00, 0x08,
-  0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x0B, 0xF0, 0x30, 0x30, 0x00, 0x60,
-  0x00, 0x80, 0x01, 0x00, 0x04, 0x00, 0x10, 0x00, 0x40, 0x01, 0x00, 0x0E,
-  0x00, 0x2C, 0x01, 0x0C, 0x18, 0x0F, 0xC0, 0x01, 0xF0, 0x60, 0x18, 0x03,
-  0x00, 0x20, 0x04, 0x00, 0x40, 0x0C, 0x00, 0x80, 0x08, 0xF8, 0x98, 0x4A,
-  0x02, 0xE0, 0x3C, 0x01, 0x80, 0x14, 0x01, 0x40, 0x14, 0x03, 0x20, 0x21,
-  0x0C, 0x0F, 0x80, 0xFF, 0xF8, 0x01, 0x80, 0x18, 0x03, 0x00, 0x20, 0x02,
-  0x00, 0x20, 0x04, 0x00, 0x40, 0x04, 0x00, 0xC0, 0x08, 0x00, 0x80, 0x18,
-  0x01, 0x00, 0x10, 0x01, 0x00, 0x30, 0x02, 0x00, 0x20, 0x02, 0x00, 0x0F,
-  0x81, 0x83, 0x10, 0x05, 0x80, 0x38, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x03,
-  0x40, 0x11, 0x83, 0x07, 0xF0, 0x60, 0xC4, 0x01, 0x60, 0x0E, 0x00, 0x30,
-  0x01, 0x80, 0x0E, 0x00, 0xD0, 0x04, 0x60, 0xC1, 0xFC, 0x00, 0x1F, 0x03,
-  0x08, 0x40, 0x4C, 0x02, 0x80, 0x28, 0x02, 0x80, 0x18, 0x03, 0xC0, 0x74,
-  0x05, 0x21, 0x91, 0xF1, 0x00, 0x10, 0x03, 0x00, 0x20, 0x02, 0x00, 0x40,
-  0x0C, 0x01, 0x80, 0x60, 0xF8, 0x00, 0x77, 0xFF, 0xF7, 0x00, 0x00, 0x00,
-  0x1D, 0xFF, 0xFD, 0xC0, 0x1C, 0x7C, 0xF9, 0xF1, 0xC0, 0x00, 0x00, 0x00,
-  0x00, 0xF1, 0xE3, 0x8F, 0x1C, 0x38, 0xE1, 0xC3, 0x06, 0x00, 0x00, 0x06,
-  0x00, 0x18, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x06, 0x00, 0x38,
-  0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0E,
-  0x00, 0x07, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xFF, 0xFC, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x70,
-  0x00, 0x38, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x70,
-  0x03, 0x80, 0x0C, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0x60, 0x00, 0x3F,
-  0x8E, 0x0C, 0x80, 0x28, 0x01, 0x80, 0x10, 0x01, 0x00, 0x10, 0x02, 0x00,
-  0xC0, 0x38, 0x06, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
-  0x01, 0xF0, 0x1F, 0x00, 0xE0, 0x0F, 0x01, 0x86, 0x08, 0x08, 0x80, 0x24,
-  0x01, 0x40, 0x0A, 0x00, 0x50, 0x1E, 0x83, 0x14, 0x20, 0xA2, 0x05, 0x10,
-  0x28, 0x81, 0x46, 0x0A, 0x18, 0x50, 0x3F, 0x80, 0x04, 0x00, 0x10, 0x00,
-  0x80, 0x02, 0x00, 0x18, 0x18, 0x3F, 0x00, 0x1F, 0xF0, 0x00, 0x06, 0x80,
-  0x00, 0x34, 0x00, 0x01, 0x30, 0x00, 0x18, 0x80, 0x00, 0x86, 0x00, 0x04,
-  0x30, 0x00, 0x60, 0x80, 0x02, 0x06, 0x00, 0x10, 0x10, 0x01, 0x80, 0x80,
-  0x08, 0x06, 0x00, 0x7F, 0xF0, 0x06, 0x00, 0x80, 0x20, 0x06, 0x01, 0x00,
-  0x10, 0x18, 0x00, 0xC0, 0x80, 0x06, 0x04, 0x00, 0x11, 0xFC, 0x0F, 0xF0,
-  0xFF, 0xF8, 0x04, 0x01, 0x01, 0x00, 0x20, 0x40, 0x04, 0x10, 0x01, 0x04,
-  0x00, 0x41, 0x00, 0x10, 0x40, 0x08, 0x10, 0x0C, 0x07, 0xFF, 0x01, 0x00,
-  0x70, 0x40, 0x06, 0x10, 0x00, 0x84, 0x00, 0x11, 0x00, 0x04, 0x40, 0x01,
-  0x10, 0x00, 0x44, 0x00, 0x21, 0x00, 0x33, 0xFF, 0xF8, 0x03, 0xF1, 0x06,
-  0x0E, 0x8C, 0x01, 0xC4, 0x00, 0x64, 0x00, 0x12, 0x00, 0x0A, 0x00, 0x01,
-  0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00,
-  0x04, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x20, 0x01, 0x88, 0x01, 0x83,
-  0x03, 0x80, 0x7E, 0x00, 0xFF, 0xE0, 0x20, 0x18, 0x20, 0x0C, 0x20, 0x04,
-  0x20, 0x02, 0x20, 0x02, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01,
-  0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x02, 0x20, 0x02,
-  0x20, 0x04, 0x20, 0x0C, 0x20, 0x18, 0xFF, 0xE0, 0xFF, 0xFF, 0x08, 0x00,
-  0x84, 0x00, 0x42, 0x00, 0x21, 0x00, 0x10, 0x80, 0x00, 0x40, 0x00, 0x20,
-  0x40, 0x10, 0x20, 0x0F, 0xF0, 0x04, 0x08, 0x02, 0x04, 0x01, 0x00, 0x00,
-  0x80, 0x00, 0x40, 0x02, 0x20, 0x01, 0x10, 0x00, 0x88, 0x00, 0x44, 0x00,
-  0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0x88, 0x00, 0x44, 0x00, 0x22, 0x00, 0x11,
-  0x00, 0x08, 0x80, 0x00, 0x40, 0x00, 0x20, 0x40, 0x10, 0x20, 0x0F, 0xF0,
-  0x04, 0x08, 0x02, 0x04, 0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20,
-  0x00, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xF9,
-  0x06, 0x07, 0x84, 0x00, 0xC4, 0x00, 0x24, 0x00, 0x12, 0x00, 0x02, 0x00,
-  0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x0F, 0xF8,
-  0x00, 0x14, 0x00, 0x09, 0x00, 0x04, 0x80, 0x02, 0x20, 0x01, 0x18, 0x00,
-  0x83, 0x01, 0xC0, 0x7F, 0x00, 0xFC, 0x3F, 0x20, 0x04, 0x20, 0x04, 0x20,
-  0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x3F,
-  0xFC, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20,
-  0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0xFC, 0x3F, 0xFF, 0xF8, 0x10,
-  0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00,
-  0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x02,
-  0x00, 0x10, 0x00, 0x81, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x04, 0x00, 0x02,
-  0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x02, 0x10, 0x01, 0x08, 0x00, 0x84, 0x00, 0x42,
-  0x00, 0x21, 0x00, 0x10, 0x80, 0x10, 0x20, 0x18, 0x0C, 0x18, 0x01, 0xF0,
-  0x00, 0xFF, 0x1F, 0x84, 0x01, 0x81, 0x00, 0xC0, 0x40, 0x60, 0x10, 0x30,
-  0x04, 0x18, 0x01, 0x0C, 0x00, 0x46, 0x00, 0x13, 0x00, 0x05, 0xF0, 0x01,
-  0xC6, 0x00, 0x60, 0xC0, 0x10, 0x18, 0x04, 0x06, 0x01, 0x00, 0xC0, 0x40,
-  0x30, 0x10, 0x04, 0x04, 0x01, 0x81, 0x00, 0x23, 0xFC, 0x0F, 0xFF, 0x80,
-  0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04,
-  0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x01, 0x00,
-  0x42, 0x00, 0x84, 0x01, 0x08, 0x02, 0x10, 0x04, 0x20, 0x0F, 0xFF, 0xF0,
-  0xF0, 0x01, 0xE7, 0x00, 0x70, 0xA0, 0x0A, 0x16, 0x03, 0x42, 0x40, 0x48,
-  0x4C, 0x19, 0x08, 0x82, 0x21, 0x10, 0x44, 0x23, 0x18, 0x84, 0x22, 0x10,
-  0x86, 0xC2, 0x10, 0x50, 0x42, 0x0E, 0x08, 0x41, 0xC1, 0x08, 0x00, 0x21,
-  0x00, 0x04, 0x20, 0x00, 0x84, 0x00, 0x10, 0x80, 0x02, 0x7F, 0x03, 0xF0,
-  0xF8, 0x1F, 0xC6, 0x00, 0x41, 0xC0, 0x10, 0x50, 0x04, 0x12, 0x01, 0x04,
-  0xC0, 0x41, 0x10, 0x10, 0x46, 0x04, 0x10, 0x81, 0x04, 0x10, 0x41, 0x04,
-  0x10, 0x40, 0x84, 0x10, 0x31, 0x04, 0x04, 0x41, 0x01, 0x90, 0x40, 0x24,
-  0x10, 0x05, 0x04, 0x01, 0xC1, 0x00, 0x31, 0xFC, 0x0C, 0x03, 0xE0, 0x06,
-  0x0C, 0x04, 0x01, 0x04, 0x00, 0x46, 0x00, 0x32, 0x00, 0x0B, 0x00, 0x05,
-  0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
-  0x0E, 0x00, 0x0D, 0x00, 0x04, 0xC0, 0x06, 0x20, 0x02, 0x08, 0x02, 0x03,
-  0x06, 0x00, 0x7C, 0x00, 0xFF, 0xF0, 0x10, 0x0C, 0x10, 0x02, 0x10, 0x03,
-  0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x03, 0x10, 0x06, 0x10, 0x0C,
-  0x1F, 0xF0, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00,
-  0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0xFF, 0xC0, 0x03, 0xE0, 0x06, 0x0C,
-  0x04, 0x01, 0x04, 0x00, 0x46, 0x00, 0x32, 0x00, 0x0B, 0x00, 0x07, 0x00,
-  0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0E,
-  0x00, 0x0D, 0x00, 0x04, 0xC0, 0x06, 0x20, 0x02, 0x08, 0x02, 0x03, 0x06,
-  0x00, 0xFC, 0x00, 0x30, 0x00, 0x30, 0x00, 0x7F, 0xC6, 0x38, 0x1E, 0xFF,
-  0xF0, 0x02, 0x01, 0x80, 0x40, 0x08, 0x08, 0x01, 0x81, 0x00, 0x10, 0x20,
-  0x02, 0x04, 0x00, 0x40, 0x80, 0x18, 0x10, 0x06, 0x02, 0x03, 0x80, 0x7F,
-  0xC0, 0x08, 0x18, 0x01, 0x01, 0x80, 0x20, 0x18, 0x04, 0x01, 0x80, 0x80,
-  0x10, 0x10, 0x03, 0x02, 0x00, 0x20, 0x40, 0x06, 0x7F, 0x80, 0x70, 0x0F,
-  0xC8, 0x61, 0xE2, 0x01, 0x90, 0x02, 0x40, 0x09, 0x00, 0x04, 0x00, 0x08,
-  0x00, 0x38, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18,
-  0x00, 0x60, 0x01, 0x80, 0x0F, 0x00, 0x2B, 0x03, 0x23, 0xF0, 0xFF, 0xFF,
-  0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x10, 0x20, 0x20, 0x00, 0x40, 0x00,
-  0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20,
-  0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x01, 0xFF, 0xC0,
-  0xFC, 0x1F, 0x90, 0x01, 0x08, 0x00, 0x84, 0x00, 0x42, 0x00, 0x21, 0x00,
-  0x10, 0x80, 0x08, 0x40, 0x04, 0x20, 0x02, 0x10, 0x01, 0x08, 0x00, 0x84,
-  0x00, 0x42, 0x00, 0x21, 0x00, 0x10, 0x80, 0x08, 0x40, 0x04, 0x10, 0x04,
-  0x0C, 0x06, 0x03, 0x06, 0x00, 0x7C, 0x00, 0xFE, 0x03, 0xF8, 0x80, 0x02,
-  0x04, 0x00, 0x10, 0x30, 0x01, 0x80, 0x80, 0x08, 0x06, 0x00, 0xC0, 0x30,
-  0x06, 0x00, 0x80, 0x20, 0x06, 0x03, 0x00, 0x30, 0x10, 0x00, 0x80, 0x80,
-  0x06, 0x0C, 0x00, 0x10, 0x40, 0x00, 0x86, 0x00, 0x06, 0x20, 0x00, 0x11,
-  0x00, 0x00, 0xD8, 0x00, 0x06, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00,
-  0xFC, 0x0F, 0xE8, 0x00, 0x19, 0x00, 0x03, 0x10, 0x00, 0x62, 0x00, 0x08,
-  0x41, 0x81, 0x08, 0x28, 0x21, 0x05, 0x04, 0x21, 0xA0, 0x84, 0x36, 0x30,
-  0x84, 0x46, 0x08, 0x88, 0xC1, 0x31, 0x18, 0x24, 0x12, 0x04, 0x82, 0x40,
-  0xB0, 0x48, 0x14, 0x09, 0x02, 0x80, 0xA0, 0x30, 0x1C, 0x06, 0x03, 0x80,
-  0x7E, 0x0F, 0xC2, 0x00, 0x60, 0x60, 0x0C, 0x06, 0x03, 0x00, 0x60, 0xC0,
-  0x0C, 0x10, 0x00, 0xC6, 0x00, 0x0D, 0x80, 0x00, 0xA0, 0x00, 0x1C, 0x00,
-  0x03, 0x80, 0x00, 0xD8, 0x00, 0x11, 0x00, 0x06, 0x30, 0x01, 0x83, 0x00,
-  0x60, 0x30, 0x08, 0x06, 0x03, 0x00, 0x60, 0xC0, 0x06, 0x7F, 0x07, 0xF0,
-  0xFC, 0x1F, 0x98, 0x03, 0x04, 0x01, 0x03, 0x01, 0x80, 0xC1, 0x80, 0x20,
-  0x80, 0x18, 0xC0, 0x04, 0x40, 0x03, 0x60, 0x00, 0xE0, 0x00, 0x20, 0x00,
-  0x10, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80,
-  0x00, 0x40, 0x00, 0x20, 0x03, 0xFF, 0x80, 0xFF, 0xF4, 0x00, 0xA0, 0x09,
-  0x00, 0x48, 0x04, 0x40, 0x40, 0x02, 0x00, 0x20, 0x02, 0x00, 0x10, 0x01,
-  0x00, 0x10, 0x00, 0x80, 0x08, 0x04, 0x80, 0x24, 0x01, 0x40, 0x0C, 0x00,
-  0x60, 0x03, 0xFF, 0xF0, 0xFC, 0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08,
-  0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0xF8, 0x80, 0x02, 0x00, 0x10,
-  0x00, 0xC0, 0x02, 0x00, 0x18, 0x00, 0x40, 0x03, 0x00, 0x08, 0x00, 0x40,
-  0x01, 0x00, 0x08, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x20, 0x00, 0x80,
-  0x04, 0x00, 0x10, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x40, 0x02, 0x00,
-  0x08, 0x00, 0x40, 0xF8, 0x42, 0x10, 0x84, 0x21, 0x08, 0x42, 0x10, 0x84,
-  0x21, 0x08, 0x42, 0x10, 0x84, 0x21, 0xF8, 0x02, 0x00, 0x38, 0x03, 0x60,
-  0x11, 0x01, 0x8C, 0x18, 0x31, 0x80, 0xD8, 0x03, 0x80, 0x08, 0xFF, 0xFF,
-  0xF8, 0xC1, 0x83, 0x06, 0x0C, 0x0F, 0xC0, 0x70, 0x30, 0x00, 0x10, 0x00,
-  0x08, 0x00, 0x08, 0x00, 0x08, 0x0F, 0xF8, 0x30, 0x08, 0x40, 0x08, 0x80,
-  0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x38, 0x60, 0xE8, 0x3F, 0x8F, 0xF0,
-  0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00,
-  0x01, 0x0F, 0x80, 0x4C, 0x18, 0x14, 0x01, 0x06, 0x00, 0x21, 0x80, 0x08,
-  0x40, 0x01, 0x10, 0x00, 0x44, 0x00, 0x11, 0x00, 0x04, 0x40, 0x01, 0x18,
-  0x00, 0x86, 0x00, 0x21, 0xC0, 0x10, 0x5C, 0x18, 0xF1, 0xF8, 0x00, 0x07,
-  0xE4, 0x30, 0x78, 0x80, 0x32, 0x00, 0x24, 0x00, 0x50, 0x00, 0x20, 0x00,
-  0x40, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x12, 0x00, 0xC3,
-  0x07, 0x01, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x80, 0x00, 0x20, 0x00,
-  0x08, 0x00, 0x02, 0x00, 0x00, 0x80, 0x7C, 0x20, 0x60, 0xC8, 0x20, 0x0A,
-  0x10, 0x01, 0x84, 0x00, 0x62, 0x00, 0x08, 0x80, 0x02, 0x20, 0x00, 0x88,
-  0x00, 0x22, 0x00, 0x08, 0xC0, 0x06, 0x10, 0x01, 0x82, 0x00, 0xE0, 0x60,
-  0xE8, 0x0F, 0xE3, 0xC0, 0x07, 0xE0, 0x1C, 0x18, 0x30, 0x0C, 0x60, 0x06,
-  0x40, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0xC0, 0x00,
-  0x40, 0x00, 0x60, 0x00, 0x30, 0x03, 0x0C, 0x0E, 0x03, 0xF0, 0x03, 0xFC,
-  0x18, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x0F, 0xFF, 0x82, 0x00,
-  0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80,
-  0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0xFF, 0xF0, 0x0F,
-  0xC7, 0x9C, 0x3A, 0x18, 0x07, 0x08, 0x01, 0x8C, 0x00, 0xC4, 0x00, 0x22,
-  0x00, 0x11, 0x00, 0x08, 0x80, 0x04, 0x40, 0x02, 0x10, 0x03, 0x08, 0x01,
-  0x82, 0x01, 0x40, 0xC3, 0x20, 0x3F, 0x10, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x7F, 0x00, 0xF0, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x47,
-  0xC0, 0x2C, 0x18, 0x1C, 0x04, 0x0C, 0x01, 0x04, 0x00, 0x82, 0x00, 0x41,
-  0x00, 0x20, 0x80, 0x10, 0x40, 0x08, 0x20, 0x04, 0x10, 0x02, 0x08, 0x01,
-  0x04, 0x00, 0x82, 0x00, 0x47, 0xC0, 0xF8, 0x06, 0x00, 0x18, 0x00, 0x60,
-  0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x02, 0x00, 0x08,
-  0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02,
-  0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x03, 0xFF, 0xF0, 0x03, 0x00,
-  0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x40, 0x10, 0x04,
-  0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00,
-  0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x08, 0x06, 0xFE, 0x00, 0xF0,
-  0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
-  0xFE, 0x10, 0x30, 0x10, 0xE0, 0x11, 0xC0, 0x13, 0x00, 0x16, 0x00, 0x1E,
-  0x00, 0x1B, 0x00, 0x11, 0x80, 0x10, 0xC0, 0x10, 0x60, 0x10, 0x30, 0x10,
-  0x18, 0x10, 0x1C, 0xF0, 0x3F, 0x7E, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80,
-  0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20,
-  0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08,
-  0x00, 0x20, 0x00, 0x80, 0xFF, 0xFC, 0xEF, 0x9E, 0x07, 0x1E, 0x20, 0xC1,
-  0x82, 0x10, 0x20, 0x42, 0x04, 0x08, 0x40, 0x81, 0x08, 0x10, 0x21, 0x02,
-  0x04, 0x20, 0x40, 0x84, 0x08, 0x10, 0x81, 0x02, 0x10, 0x20, 0x42, 0x04,
-  0x08, 0x40, 0x81, 0x3E, 0x1C, 0x38, 0x71, 0xF0, 0x0B, 0x06, 0x07, 0x01,
-  0x03, 0x00, 0x41, 0x00, 0x20, 0x80, 0x10, 0x40, 0x08, 0x20, 0x04, 0x10,
-  0x02, 0x08, 0x01, 0x04, 0x00, 0x82, 0x00, 0x41, 0x00, 0x20, 0x80, 0x13,
-  0xF0, 0x3E, 0x07, 0xC0, 0x30, 0x60, 0x80, 0x22, 0x00, 0x24, 0x00, 0x50,
-  0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x05, 0x00, 0x12, 0x00,
-  0x22, 0x00, 0x83, 0x06, 0x01, 0xF0, 0x00, 0xF1, 0xFC, 0x05, 0xC1, 0x81,
-  0xC0, 0x10, 0x60, 0x02, 0x18, 0x00, 0xC4, 0x00, 0x11, 0x00, 0x04, 0x40,
-  0x01, 0x10, 0x00, 0x44, 0x00, 0x11, 0x80, 0x08, 0x60, 0x02, 0x14, 0x01,
-  0x04, 0xC1, 0x81, 0x0F, 0x80, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00, 0x01,
-  0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xE3, 0xC6,
-  0x0E, 0x86, 0x00, 0xE1, 0x00, 0x18, 0xC0, 0x06, 0x20, 0x00, 0x88, 0x00,
-  0x22, 0x00, 0x08, 0x80, 0x02, 0x20, 0x00, 0x84, 0x00, 0x61, 0x00, 0x18,
-  0x20, 0x0A, 0x06, 0x0C, 0x80, 0x7C, 0x20, 0x00, 0x08, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x00, 0x20, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0F, 0xF0, 0xF8,
-  0x7C, 0x11, 0x8C, 0x2C, 0x00, 0x70, 0x00, 0xC0, 0x01, 0x00, 0x02, 0x00,
-  0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x01,
-  0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xD1, 0x83, 0x98, 0x04, 0x80, 0x24, 0x00,
-  0x30, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x30, 0x00, 0xE0, 0x03, 0x00, 0x1C,
-  0x01, 0xF0, 0x1A, 0x7F, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
-  0x00, 0x08, 0x00, 0xFF, 0xFC, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
-  0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
-  0x00, 0x08, 0x00, 0x08, 0x01, 0x06, 0x0F, 0x03, 0xF8, 0xF0, 0x3E, 0x08,
-  0x01, 0x04, 0x00, 0x82, 0x00, 0x41, 0x00, 0x20, 0x80, 0x10, 0x40, 0x08,
-  0x20, 0x04, 0x10, 0x02, 0x08, 0x01, 0x04, 0x00, 0x82, 0x00, 0x41, 0x00,
-  0xE0, 0x41, 0xD0, 0x1F, 0x8E, 0xFE, 0x0F, 0xE2, 0x00, 0x20, 0x60, 0x0C,
-  0x0C, 0x01, 0x80, 0x80, 0x20, 0x18, 0x0C, 0x01, 0x01, 0x00, 0x30, 0x60,
-  0x02, 0x08, 0x00, 0x41, 0x00, 0x0C, 0x60, 0x00, 0x88, 0x00, 0x19, 0x00,
-  0x01, 0x40, 0x00, 0x38, 0x00, 0xFC, 0x07, 0xE4, 0x00, 0x10, 0x80, 0x02,
-  0x18, 0x20, 0xC3, 0x0E, 0x18, 0x21, 0x42, 0x04, 0x28, 0x40, 0x8D, 0x88,
-  0x19, 0x93, 0x03, 0x22, 0x60, 0x2C, 0x68, 0x05, 0x85, 0x00, 0xA0, 0xA0,
-  0x1C, 0x1C, 0x01, 0x81, 0x80, 0x7C, 0x1F, 0x18, 0x03, 0x06, 0x03, 0x01,
-  0x83, 0x00, 0x63, 0x00, 0x1B, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x60,
-  0x03, 0x18, 0x03, 0x06, 0x03, 0x01, 0x83, 0x00, 0x61, 0x00, 0x33, 0xF0,
-  0x7E, 0xFC, 0x1F, 0x90, 0x01, 0x8C, 0x00, 0x86, 0x00, 0xC1, 0x80, 0x40,
-  0xC0, 0x60, 0x20, 0x20, 0x18, 0x30, 0x04, 0x10, 0x03, 0x08, 0x00, 0x8C,
-  0x00, 0x64, 0x00, 0x16, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x01, 0x00, 0x01,
-  0x80, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x20, 0x07, 0xFE, 0x00,
-  0xFF, 0xF4, 0x01, 0x20, 0x09, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00,
-  0xC0, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40, 0x14, 0x00, 0xA0, 0x07, 0xFF,
-  0xE0, 0x07, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x30, 0xC0, 0x30, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
-  0x0C, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x30, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x07, 0x0C, 0x10, 0x10, 0x10, 0x10,
-  0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0xE0, 0x1C, 0x00, 0x44, 0x0D, 0x84,
-  0x36, 0x04, 0x40, 0x07, 0x00 };
+  0x21, 0x23, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x21, 0x31,
+  0x31, 0x31, 0x31, 0xE2, 0x18, 0x12, 0x10, 0x04, 0x38, 0x38, 0x38, 0x38,
+  0x34, 0x12, 0x43, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x10,
+  0x51, 0x41, 0x81, 0x41, 0x81, 0x41, 0x81, 0x41, 0x81, 0x41, 0x81, 0x41,
+  0x81, 0x41, 0x81, 0x31, 0x91, 0x31, 0x5D, 0x51, 0x31, 0x81, 0x41, 0x81,
+  0x41, 0x81, 0x41, 0x4E, 0x41, 0x41, 0x81, 0x41, 0x81, 0x41, 0x81, 0x41,
+  0x81, 0x41, 0x81, 0x41, 0x81, 0x32, 0x81, 0x31, 0x91, 0x31, 0x50, 0x61,
+  0xC1, 0xC1, 0xA6, 0x11, 0x32, 0x53, 0x31, 0x81, 0x21, 0x91, 0x21, 0xC1,
+  0xC2, 0xC2, 0xC4, 0xD4, 0xC2, 0xD1, 0xC2, 0xB2, 0xB3, 0x91, 0x14, 0x52,
+  0x21, 0x26, 0xA1, 0xC1, 0xC1, 0xC1, 0xC1, 0x60, 0x34, 0xA1, 0x41, 0x81,
+  0x61, 0x71, 0x61, 0x71, 0x61, 0x71, 0x61, 0x81, 0x41, 0xA4, 0xF4, 0x48,
+  0x57, 0x57, 0x49, 0x3F, 0x44, 0xA1, 0x42, 0x71, 0x62, 0x61, 0x71, 0x61,
+  0x71, 0x61, 0x62, 0x71, 0x42, 0x94, 0x40, 0x46, 0x51, 0xA1, 0xB1, 0xB1,
+  0xB1, 0xC1, 0xB1, 0xC1, 0x94, 0x72, 0x12, 0x44, 0x32, 0x31, 0x11, 0x51,
+  0x22, 0x11, 0x52, 0x11, 0x21, 0x63, 0x22, 0x61, 0x42, 0x43, 0x45, 0x23,
+  0x0F, 0x51, 0x22, 0x22, 0x22, 0x22, 0x21, 0x41, 0x32, 0x31, 0x32, 0x31,
+  0x32, 0x32, 0x32, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x42, 0x32, 0x32, 0x41, 0x42, 0x32, 0x42, 0x32, 0x01, 0x42, 0x41, 0x42,
+  0x41, 0x42, 0x32, 0x32, 0x41, 0x42, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x31, 0x32, 0x32, 0x31, 0x32, 0x32, 0x22, 0x31, 0x40, 0x61, 0xC1,
+  0xC1, 0xC1, 0x62, 0x41, 0x42, 0x23, 0x11, 0x13, 0x73, 0xA1, 0x11, 0x92,
+  0x12, 0x72, 0x32, 0x61, 0x51, 0x51, 0x61, 0x30, 0x71, 0xE1, 0xE1, 0xE1,
+  0xE1, 0xE1, 0xE1, 0xE1, 0x7F, 0x07, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x17, 0x25, 0x24, 0x34, 0x24, 0x34, 0x33, 0x42, 0x43, 0x42, 0x52,
+  0x50, 0x0F, 0x00, 0x13, 0x1F, 0x01, 0x31, 0xC1, 0xB2, 0xB1, 0xB2, 0xB1,
+  0xB2, 0xB1, 0xB2, 0xB1, 0xB2, 0xB1, 0xC1, 0xB1, 0xC1, 0xB1, 0xC1, 0xB1,
+  0xC1, 0xB1, 0xC1, 0xB1, 0xC1, 0xB1, 0xC1, 0xB1, 0xC1, 0xC0, 0x45, 0x62,
+  0x51, 0x51, 0x71, 0x31, 0x91, 0x21, 0x91, 0x12, 0x93, 0xB2, 0xB2, 0xB2,
+  0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xA2, 0x11, 0x91, 0x21, 0x91, 0x31,
+  0x71, 0x42, 0x52, 0x65, 0x40, 0x52, 0xA3, 0x92, 0x11, 0x82, 0x21, 0x72,
+  0x31, 0x72, 0x31, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x6D, 0x45, 0x72, 0x42, 0x41, 0x81, 0x21,
+  0x91, 0x21, 0xA1, 0xC1, 0xC1, 0xB1, 0xC1, 0xB1, 0xB1, 0xB2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0xA2, 0x81, 0x12, 0x93, 0xAE, 0x46, 0x62, 0x61, 0x42,
+  0x81, 0xE1, 0xD1, 0xD1, 0xD1, 0xC1, 0xC1, 0x94, 0xD2, 0xE1, 0xE1, 0xE1,
+  0xD1, 0xD1, 0xD1, 0xC1, 0x12, 0x92, 0x23, 0x62, 0x66, 0x40, 0x73, 0x91,
+  0x11, 0x81, 0x21, 0x72, 0x21, 0x71, 0x31, 0x62, 0x31, 0x61, 0x41, 0x52,
+  0x41, 0x51, 0x51, 0x41, 0x61, 0x41, 0x61, 0x31, 0x71, 0x31, 0x71, 0x21,
+  0x81, 0x2C, 0x91, 0xB1, 0xB1, 0xB1, 0xB1, 0x77, 0x2A, 0x41, 0xD1, 0xD1,
+  0xD1, 0xD1, 0xD1, 0xD1, 0x16, 0x62, 0x62, 0xD2, 0xD1, 0xE1, 0xD1, 0xD1,
+  0xD1, 0xD1, 0xC3, 0xB1, 0x12, 0x91, 0x42, 0x52, 0x76, 0x40, 0x75, 0x52,
+  0x82, 0x92, 0xA1, 0xA1, 0xB1, 0xA2, 0xA1, 0xB1, 0x35, 0x31, 0x22, 0x41,
+  0x21, 0x11, 0x71, 0x13, 0x74, 0x92, 0xA1, 0x11, 0x91, 0x11, 0x91, 0x11,
+  0x82, 0x21, 0x71, 0x41, 0x42, 0x65, 0x30, 0x0D, 0xA2, 0xA2, 0x92, 0xA1,
+  0xB1, 0xB1, 0xA1, 0xB1, 0xB1, 0xA2, 0xA1, 0xB1, 0xA2, 0xA1, 0xB1, 0xB1,
+  0xA2, 0xA1, 0xB1, 0xB1, 0x50, 0x45, 0x62, 0x52, 0x31, 0x91, 0x12, 0x93,
+  0xB2, 0xB2, 0xB2, 0xA2, 0x11, 0x91, 0x32, 0x52, 0x57, 0x52, 0x52, 0x31,
+  0x91, 0x12, 0x93, 0xB2, 0xB2, 0xB3, 0x92, 0x11, 0x91, 0x32, 0x52, 0x57,
+  0x30, 0x35, 0x62, 0x41, 0x41, 0x71, 0x22, 0x81, 0x11, 0x91, 0x11, 0x91,
+  0x11, 0xA2, 0x94, 0x73, 0x11, 0x71, 0x11, 0x21, 0x42, 0x21, 0x35, 0x31,
+  0xB1, 0xA2, 0xA1, 0xB1, 0xA1, 0xA2, 0x92, 0x82, 0x55, 0x70, 0x13, 0x1F,
+  0x01, 0x3F, 0xC3, 0x1F, 0x01, 0x31, 0x33, 0x35, 0x25, 0x25, 0x33, 0xFF,
+  0x84, 0x34, 0x33, 0x34, 0x33, 0x43, 0x33, 0x43, 0x42, 0x52, 0x50, 0xD2,
+  0xC2, 0xB3, 0xA3, 0xA3, 0xA3, 0xB2, 0xB3, 0xB3, 0xE3, 0xE3, 0xE2, 0xE3,
+  0xE3, 0xE3, 0xE2, 0x0F, 0x2F, 0xFF, 0xF8, 0xF2, 0x02, 0xE2, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE2, 0xE3, 0xD3, 0xA3, 0xA3, 0xB2, 0xB3, 0xA3, 0xA3, 0xB2,
+  0xD0, 0x27, 0x33, 0x52, 0x21, 0x91, 0x11, 0xA2, 0xA1, 0xB1, 0xB1, 0xA1,
+  0x92, 0x83, 0x82, 0xA1, 0xB1, 0xFF, 0xF1, 0x38, 0x57, 0x58, 0x35, 0x44,
+  0x72, 0x42, 0x51, 0x71, 0x31, 0x91, 0x21, 0x91, 0x11, 0xA1, 0x11, 0xA1,
+  0x11, 0x74, 0x11, 0x52, 0x31, 0x11, 0x41, 0x51, 0x11, 0x31, 0x61, 0x11,
+  0x31, 0x61, 0x11, 0x31, 0x61, 0x11, 0x32, 0x51, 0x11, 0x42, 0x41, 0x11,
+  0x67, 0xC1, 0xD1, 0xC1, 0xD1, 0xC2, 0x62, 0x56, 0x30, 0x39, 0xF2, 0x21,
+  0x1F, 0x22, 0x11, 0xF2, 0x12, 0x2F, 0x02, 0x31, 0xF0, 0x14, 0x2E, 0x14,
+  0x2D, 0x25, 0x1D, 0x16, 0x2C, 0x17, 0x1B, 0x27, 0x1B, 0x18, 0x2A, 0xB9,
+  0x29, 0x19, 0x1A, 0x28, 0x1B, 0x17, 0x2B, 0x26, 0x1C, 0x26, 0x1D, 0x13,
+  0x76, 0x80, 0x0D, 0x81, 0x91, 0x71, 0xA1, 0x61, 0xB1, 0x51, 0xB1, 0x51,
+  0xB1, 0x51, 0xB1, 0x51, 0xA1, 0x61, 0x82, 0x7B, 0x71, 0x93, 0x51, 0xB2,
+  0x41, 0xC1, 0x41, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xC1,
+  0x41, 0xA2, 0x2F, 0x03, 0x66, 0x31, 0x52, 0x53, 0x11, 0x32, 0x93, 0x31,
+  0xB2, 0x21, 0xD1, 0x21, 0xD1, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11,
+  0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x21, 0xF1, 0x1F, 0x21, 0xC2, 0x31, 0xA2,
+  0x52, 0x63, 0x86, 0x50, 0x0B, 0x71, 0x82, 0x51, 0x92, 0x41, 0xA1, 0x41,
+  0xB1, 0x31, 0xB1, 0x31, 0xC1, 0x21, 0xC1, 0x21, 0xC1, 0x21, 0xC1, 0x21,
+  0xC1, 0x21, 0xC1, 0x21, 0xC1, 0x21, 0xC1, 0x21, 0xB1, 0x31, 0xB1, 0x31,
+  0xA1, 0x41, 0x92, 0x41, 0x82, 0x3B, 0x50, 0x0F, 0x14, 0x1B, 0x14, 0x1B,
+  0x14, 0x1B, 0x14, 0x1B, 0x14, 0x1F, 0x11, 0xF1, 0x16, 0x19, 0x16, 0x19,
+  0x89, 0x16, 0x19, 0x16, 0x19, 0x1F, 0x11, 0xF1, 0x1C, 0x13, 0x1C, 0x13,
+  0x1C, 0x13, 0x1C, 0x13, 0x1C, 0xF3, 0x0F, 0x23, 0x1C, 0x13, 0x1C, 0x13,
+  0x1C, 0x13, 0x1C, 0x13, 0x1F, 0x11, 0xF1, 0x16, 0x19, 0x16, 0x19, 0x89,
+  0x16, 0x19, 0x16, 0x19, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11,
+  0xF1, 0x1D, 0xA7, 0x67, 0x21, 0x52, 0x64, 0x41, 0xA2, 0x31, 0xC1, 0x21,
+  0xD1, 0x21, 0xF0, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0x89,
+  0xE1, 0x11, 0xE1, 0x21, 0xD1, 0x21, 0xD1, 0x31, 0xC1, 0x32, 0xB1, 0x52,
+  0x73, 0x77, 0x40, 0x06, 0x46, 0x21, 0xA1, 0x41, 0xA1, 0x41, 0xA1, 0x41,
+  0xA1, 0x41, 0xA1, 0x41, 0xA1, 0x41, 0xA1, 0x41, 0xA1, 0x4C, 0x41, 0xA1,
+  0x41, 0xA1, 0x41, 0xA1, 0x41, 0xA1, 0x41, 0xA1, 0x41, 0xA1, 0x41, 0xA1,
+  0x41, 0xA1, 0x41, 0xA1, 0x26, 0x46, 0x0D, 0x61, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0x6D, 0x6B, 0xC1, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F,
+  0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x14, 0x1B, 0x14, 0x1B, 0x14, 0x1B, 0x14,
+  0x1B, 0x14, 0x1B, 0x14, 0x1A, 0x16, 0x18, 0x27, 0x25, 0x2A, 0x58, 0x08,
+  0x36, 0x41, 0x92, 0x61, 0x82, 0x71, 0x72, 0x81, 0x62, 0x91, 0x52, 0xA1,
+  0x42, 0xB1, 0x32, 0xC1, 0x22, 0xD1, 0x15, 0xB3, 0x32, 0xA2, 0x52, 0x91,
+  0x72, 0x81, 0x72, 0x81, 0x82, 0x71, 0x82, 0x71, 0x91, 0x71, 0x92, 0x61,
+  0xA1, 0x38, 0x64, 0x09, 0xA1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1,
+  0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0x91, 0x41, 0x91, 0x41, 0x91, 0x41, 0x91,
+  0x41, 0x91, 0x41, 0x9F, 0x10, 0x04, 0xB4, 0x23, 0x93, 0x41, 0x11, 0x91,
+  0x11, 0x41, 0x12, 0x72, 0x11, 0x41, 0x21, 0x71, 0x21, 0x41, 0x22, 0x52,
+  0x21, 0x41, 0x31, 0x51, 0x31, 0x41, 0x31, 0x51, 0x31, 0x41, 0x32, 0x32,
+  0x31, 0x41, 0x41, 0x31, 0x41, 0x41, 0x42, 0x12, 0x41, 0x41, 0x51, 0x11,
+  0x51, 0x41, 0x53, 0x51, 0x41, 0x53, 0x51, 0x41, 0xD1, 0x41, 0xD1, 0x41,
+  0xD1, 0x41, 0xD1, 0x41, 0xD1, 0x27, 0x66, 0x05, 0x67, 0x32, 0xA1, 0x53,
+  0x91, 0x51, 0x11, 0x91, 0x51, 0x21, 0x81, 0x51, 0x22, 0x71, 0x51, 0x31,
+  0x71, 0x51, 0x32, 0x61, 0x51, 0x41, 0x61, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x51, 0x51, 0x61, 0x41, 0x51, 0x62, 0x31, 0x51, 0x71, 0x31, 0x51, 0x72,
+  0x21, 0x51, 0x81, 0x21, 0x51, 0x91, 0x11, 0x51, 0x93, 0x51, 0xA2, 0x37,
+  0x62, 0x20, 0x65, 0xA2, 0x52, 0x71, 0x91, 0x51, 0xB1, 0x32, 0xB2, 0x21,
+  0xD1, 0x12, 0xD1, 0x11, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+  0x03, 0xD2, 0x11, 0xD1, 0x22, 0xB2, 0x31, 0xB1, 0x51, 0x91, 0x72, 0x52,
+  0xA5, 0x60, 0x0C, 0x71, 0x82, 0x51, 0xA1, 0x41, 0xA2, 0x31, 0xB1, 0x31,
+  0xB1, 0x31, 0xB1, 0x31, 0xA2, 0x31, 0x92, 0x41, 0x82, 0x59, 0x71, 0xF0,
+  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1C, 0xA6, 0x65,
+  0xA2, 0x52, 0x71, 0x91, 0x51, 0xB1, 0x32, 0xB2, 0x21, 0xD1, 0x12, 0xD3,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x03, 0xD2, 0x11, 0xD1,
+  0x22, 0xB2, 0x31, 0xB1, 0x51, 0x91, 0x72, 0x52, 0x96, 0xC2, 0xE2, 0xD9,
+  0x32, 0x33, 0x64, 0x10, 0x0C, 0xA1, 0x82, 0x81, 0xA1, 0x71, 0xA2, 0x61,
+  0xB1, 0x61, 0xB1, 0x61, 0xB1, 0x61, 0xA2, 0x61, 0x92, 0x71, 0x73, 0x89,
+  0xA1, 0x62, 0xA1, 0x72, 0x91, 0x82, 0x81, 0x92, 0x71, 0xA1, 0x71, 0xA2,
+  0x61, 0xB1, 0x61, 0xB2, 0x28, 0x83, 0x46, 0x21, 0x42, 0x44, 0x31, 0x82,
+  0x21, 0xA1, 0x21, 0xA1, 0x21, 0xD1, 0xE1, 0xD3, 0xD5, 0xD4, 0xD2, 0xD2,
+  0xD2, 0xC2, 0xC2, 0xB4, 0xA1, 0x11, 0x12, 0x62, 0x21, 0x36, 0x40, 0x0F,
+  0x16, 0x16, 0x26, 0x16, 0x26, 0x16, 0x26, 0x16, 0x17, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x19, 0xB2,
+  0x06, 0x56, 0x21, 0xB1, 0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1,
+  0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1,
+  0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1, 0x41, 0xB1, 0x51, 0x91, 0x62, 0x72,
+  0x72, 0x52, 0xA5, 0x60, 0x07, 0x77, 0x31, 0xD1, 0x61, 0xD1, 0x62, 0xB2,
+  0x71, 0xB1, 0x82, 0x92, 0x82, 0x92, 0x91, 0x91, 0xA2, 0x72, 0xA2, 0x71,
+  0xC1, 0x71, 0xC2, 0x52, 0xD1, 0x51, 0xE1, 0x42, 0xE2, 0x31, 0xF1, 0x13,
+  0x1F, 0x12, 0x12, 0xF1, 0x21, 0x1F, 0x33, 0xF3, 0x39, 0x06, 0x67, 0x11,
+  0xE2, 0x21, 0xE2, 0x31, 0xD2, 0x31, 0xD1, 0x41, 0x52, 0x61, 0x41, 0x51,
+  0x11, 0x51, 0x41, 0x51, 0x11, 0x51, 0x41, 0x42, 0x11, 0x51, 0x41, 0x42,
+  0x12, 0x32, 0x41, 0x41, 0x31, 0x32, 0x51, 0x31, 0x31, 0x32, 0x51, 0x22,
+  0x31, 0x32, 0x51, 0x21, 0x51, 0x21, 0x61, 0x21, 0x51, 0x21, 0x61, 0x12,
+  0x51, 0x21, 0x61, 0x11, 0x61, 0x21, 0x61, 0x11, 0x71, 0x11, 0x72, 0x73,
+  0x72, 0x73, 0x30, 0x16, 0x56, 0x41, 0xA2, 0x62, 0x92, 0x72, 0x72, 0x92,
+  0x52, 0xA2, 0x51, 0xC2, 0x32, 0xD2, 0x12, 0xF0, 0x11, 0x1F, 0x13, 0xF1,
+  0x3F, 0x02, 0x12, 0xE1, 0x31, 0xD2, 0x32, 0xB2, 0x52, 0x92, 0x72, 0x81,
+  0x82, 0x72, 0x92, 0x52, 0xB2, 0x27, 0x57, 0x06, 0x56, 0x22, 0x92, 0x51,
+  0x91, 0x62, 0x72, 0x72, 0x52, 0x91, 0x51, 0xA2, 0x32, 0xB1, 0x31, 0xC2,
+  0x12, 0xD3, 0xF0, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1,
+  0x1F, 0x11, 0xF1, 0x1B, 0xB3, 0x0C, 0x11, 0xA1, 0x11, 0x91, 0x21, 0x91,
+  0x21, 0x81, 0x31, 0x71, 0xC1, 0xB1, 0xB1, 0xC1, 0xB1, 0xB1, 0xC1, 0xB1,
+  0x81, 0x21, 0x91, 0x21, 0x91, 0x11, 0xA2, 0xB2, 0xBE, 0x06, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x45, 0x01, 0xD1, 0xC1,
+  0xC2, 0xC1, 0xC2, 0xC1, 0xC2, 0xC1, 0xC1, 0xD1, 0xC1, 0xD1, 0xC1, 0xD1,
+  0xC1, 0xD1, 0xC1, 0xD1, 0xC1, 0xD1, 0xC1, 0xD1, 0xC1, 0xD1, 0xC1, 0x05,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x61,
+  0xB3, 0x92, 0x12, 0x81, 0x31, 0x72, 0x32, 0x52, 0x52, 0x32, 0x72, 0x12,
+  0x93, 0xB1, 0x0F, 0x60, 0x02, 0x52, 0x52, 0x52, 0x52, 0x46, 0x73, 0x62,
+  0xF0, 0x1F, 0x11, 0xF0, 0x1F, 0x01, 0x79, 0x52, 0x81, 0x41, 0xA1, 0x31,
+  0xB1, 0x31, 0xB1, 0x31, 0xB1, 0x31, 0x93, 0x42, 0x53, 0x11, 0x57, 0x34,
+  0x04, 0xF2, 0x1F, 0x21, 0xF2, 0x1F, 0x21, 0xF2, 0x1F, 0x21, 0x45, 0x81,
+  0x22, 0x52, 0x61, 0x11, 0x91, 0x52, 0xB1, 0x42, 0xB1, 0x41, 0xD1, 0x31,
+  0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x32, 0xB1, 0x42, 0xB1, 0x43,
+  0x91, 0x51, 0x13, 0x52, 0x34, 0x36, 0x50, 0x56, 0x21, 0x42, 0x54, 0x31,
+  0x92, 0x21, 0xB1, 0x21, 0xB1, 0x11, 0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE1,
+  0xC1, 0x21, 0x92, 0x42, 0x53, 0x76, 0x40, 0xB4, 0xF2, 0x1F, 0x21, 0xF2,
+  0x1F, 0x21, 0xF2, 0x18, 0x54, 0x16, 0x25, 0x22, 0x15, 0x19, 0x11, 0x14,
+  0x1B, 0x24, 0x1B, 0x23, 0x1D, 0x13, 0x1D, 0x13, 0x1D, 0x13, 0x1D, 0x13,
+  0x1D, 0x13, 0x2B, 0x24, 0x1B, 0x25, 0x19, 0x36, 0x25, 0x31, 0x17, 0x73,
+  0x40, 0x56, 0x83, 0x52, 0x52, 0x82, 0x32, 0xA2, 0x21, 0xC4, 0xC4, 0xDF,
+  0x4E, 0x2F, 0x01, 0xF0, 0x2F, 0x02, 0xA2, 0x42, 0x63, 0x76, 0x40, 0x68,
+  0x52, 0xB1, 0xD1, 0xD1, 0xD1, 0x9D, 0x51, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+  0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x9C, 0x20, 0x46, 0x34, 0x23,
+  0x43, 0x11, 0x42, 0x83, 0x41, 0xA2, 0x32, 0xA2, 0x31, 0xC1, 0x31, 0xC1,
+  0x31, 0xC1, 0x31, 0xC1, 0x31, 0xC1, 0x41, 0xA2, 0x41, 0xA2, 0x51, 0x81,
+  0x11, 0x62, 0x42, 0x21, 0x76, 0x31, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11,
+  0xF0, 0x1F, 0x01, 0x97, 0x60, 0x04, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11,
+  0xF1, 0x1F, 0x11, 0x35, 0x81, 0x12, 0x52, 0x63, 0x71, 0x62, 0x91, 0x51,
+  0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51,
+  0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x35, 0x65, 0x52, 0xC2, 0xC2,
+  0xC2, 0xFF, 0xF5, 0x6D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+  0x1D, 0x1D, 0x1D, 0x1D, 0x17, 0xE0, 0x62, 0x82, 0x82, 0x82, 0xFF, 0x2A,
+  0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+  0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x81, 0x82, 0x17, 0x30, 0x04, 0xF0,
+  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0x47, 0x41, 0x62, 0x71,
+  0x43, 0x81, 0x33, 0x91, 0x22, 0xB1, 0x12, 0xC4, 0xC2, 0x12, 0xB1, 0x32,
+  0xA1, 0x42, 0x91, 0x52, 0x81, 0x62, 0x71, 0x72, 0x61, 0x73, 0x24, 0x66,
+  0x16, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1,
+  0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0x7E, 0x03, 0x15, 0x24,
+  0x63, 0x34, 0x31, 0x52, 0x52, 0x51, 0x41, 0x61, 0x61, 0x41, 0x61, 0x61,
+  0x41, 0x61, 0x61, 0x41, 0x61, 0x61, 0x41, 0x61, 0x61, 0x41, 0x61, 0x61,
+  0x41, 0x61, 0x61, 0x41, 0x61, 0x61, 0x41, 0x61, 0x61, 0x41, 0x61, 0x61,
+  0x41, 0x61, 0x61, 0x25, 0x43, 0x43, 0x13, 0x35, 0x81, 0x12, 0x52, 0x63,
+  0x71, 0x62, 0x91, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51,
+  0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x26,
+  0x65, 0x55, 0x82, 0x52, 0x51, 0x91, 0x31, 0xB1, 0x21, 0xB1, 0x11, 0xD2,
+  0xD2, 0xD2, 0xD2, 0xD1, 0x11, 0xB1, 0x21, 0xB1, 0x31, 0x91, 0x52, 0x52,
+  0x85, 0x50, 0x04, 0x37, 0x71, 0x13, 0x52, 0x63, 0x91, 0x52, 0xB1, 0x42,
+  0xB2, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x32,
+  0xB1, 0x42, 0xB1, 0x41, 0x11, 0x91, 0x51, 0x22, 0x52, 0x61, 0x45, 0x81,
+  0xF2, 0x1F, 0x21, 0xF2, 0x1F, 0x21, 0xF2, 0x1E, 0x8A, 0x47, 0x34, 0x32,
+  0x53, 0x11, 0x42, 0x93, 0x41, 0xB2, 0x32, 0xB2, 0x31, 0xD1, 0x31, 0xD1,
+  0x31, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x41, 0xB2, 0x41, 0xB2, 0x51, 0x91,
+  0x11, 0x62, 0x52, 0x21, 0x85, 0x41, 0xF2, 0x1F, 0x21, 0xF2, 0x1F, 0x21,
+  0xF2, 0x1F, 0x21, 0xD8, 0x05, 0x45, 0x51, 0x32, 0x32, 0x41, 0x12, 0xB3,
+  0xC2, 0xD1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xAC, 0x30,
+  0x46, 0x11, 0x32, 0x53, 0x22, 0x81, 0x21, 0x91, 0x21, 0xC2, 0xC4, 0xC6,
+  0xC2, 0xC3, 0xB2, 0xB3, 0x95, 0x72, 0x11, 0x27, 0x30, 0x41, 0xF0, 0x1F,
+  0x01, 0xF0, 0x1F, 0x01, 0xBE, 0x61, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
+  0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1A, 0x15,
+  0x25, 0x46, 0x73, 0x04, 0x65, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51,
+  0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51, 0xA1, 0x51,
+  0xA1, 0x51, 0xA1, 0x51, 0x83, 0x61, 0x53, 0x11, 0x76, 0x33, 0x07, 0x57,
+  0x31, 0xB1, 0x62, 0x92, 0x62, 0x92, 0x71, 0x91, 0x82, 0x72, 0x91, 0x71,
+  0xA2, 0x52, 0xB1, 0x51, 0xC1, 0x51, 0xC2, 0x32, 0xD1, 0x31, 0xE2, 0x21,
+  0xF0, 0x11, 0x1F, 0x13, 0x80, 0x06, 0x76, 0x21, 0xD1, 0x41, 0xD1, 0x42,
+  0x51, 0x52, 0x42, 0x43, 0x42, 0x51, 0x41, 0x11, 0x41, 0x61, 0x41, 0x11,
+  0x41, 0x61, 0x32, 0x12, 0x31, 0x62, 0x22, 0x21, 0x22, 0x62, 0x21, 0x31,
+  0x22, 0x71, 0x12, 0x32, 0x11, 0x81, 0x12, 0x41, 0x11, 0x81, 0x11, 0x51,
+  0x11, 0x83, 0x53, 0x92, 0x62, 0x40, 0x15, 0x55, 0x32, 0x92, 0x52, 0x72,
+  0x72, 0x52, 0x92, 0x32, 0xB2, 0x12, 0xD3, 0xE3, 0xD2, 0x12, 0xB2, 0x32,
+  0x92, 0x52, 0x72, 0x72, 0x52, 0x92, 0x41, 0xA2, 0x26, 0x56, 0x06, 0x56,
+  0x21, 0xB2, 0x32, 0xA1, 0x42, 0x92, 0x52, 0x81, 0x62, 0x72, 0x71, 0x71,
+  0x82, 0x52, 0x91, 0x51, 0xA2, 0x41, 0xB1, 0x32, 0xB2, 0x21, 0xD1, 0x12,
+  0xD3, 0xE3, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x02, 0xF0, 0x2F, 0x01, 0xAA,
+  0x70, 0x0C, 0x11, 0x91, 0x21, 0x91, 0x21, 0x81, 0xB1, 0xB1, 0xB1, 0xB2,
+  0xB1, 0xB1, 0xB1, 0xB1, 0x91, 0x11, 0xA1, 0x11, 0xAE, 0x53, 0x42, 0x61,
+  0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x52, 0x42, 0x82, 0x81,
+  0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x72, 0x73, 0x0F, 0xA0,
+  0x03, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x81,
+  0x83, 0x42, 0x51, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x62,
+  0x43, 0x50, 0x33, 0xB1, 0x31, 0x62, 0x12, 0x41, 0x42, 0x12, 0x61, 0x31,
+  0xB3, 0x30 };
 
 const GFXglyph FreeMono18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
   {     0,   4,  22,  21,    8,  -21 },   // 0x21 '!'
-  {    11,  11,  10,  21,    5,  -20 },   // 0x22 '"'
-  {    25,  14,  24,  21,    3,  -21 },   // 0x23 '#'
-  {    67,  13,  26,  21,    4,  -22 },   // 0x24 '$'
-  {   110,  15,  21,  21,    3,  -20 },   // 0x25 '%'
-  {   150,  12,  18,  21,    4,  -17 },   // 0x26 '&'
-  {   177,   4,  10,  21,    8,  -20 },   // 0x27 '''
-  {   182,   5,  25,  21,   10,  -20 },   // 0x28 '('
-  {   198,   5,  25,  21,    6,  -20 },   // 0x29 ')'
-  {   214,  13,  12,  21,    4,  -20 },   // 0x2A '*'
-  {   234,  15,  17,  21,    3,  -17 },   // 0x2B '+'
-  {   266,   7,  10,  21,    5,   -4 },   // 0x2C ','
-  {   275,  15,   1,  21,    3,   -9 },   // 0x2D '-'
-  {   277,   5,   5,  21,    8,   -4 },   // 0x2E '.'
-  {   281,  13,  26,  21,    4,  -22 },   // 0x2F '/'
-  {   324,  13,  21,  21,    4,  -20 },   // 0x30 '0'
-  {   359,  13,  21,  21,    4,  -20 },   // 0x31 '1'
-  {   394,  13,  21,  21,    3,  -20 },   // 0x32 '2'
-  {   429,  14,  21,  21,    3,  -20 },   // 0x33 '3'
-  {   466,  12,  21,  21,    4,  -20 },   // 0x34 '4'
-  {   498,  14,  21,  21,    3,  -20 },   // 0x35 '5'
-  {   535,  12,  21,  21,    5,  -20 },   // 0x36 '6'
-  {   567,  12,  21,  21,    4,  -20 },   // 0x37 '7'
-  {   599,  13,  21,  21,    4,  -20 },   // 0x38 '8'
-  {   634,  12,  21,  21,    5,  -20 },   // 0x39 '9'
-  {   666,   5,  15,  21,    8,  -14 },   // 0x3A ':'
-  {   676,   7,  20,  21,    5,  -14 },   // 0x3B ';'
-  {   694,  15,  16,  21,    3,  -17 },   // 0x3C '<'
-  {   724,  17,   6,  21,    2,  -12 },   // 0x3D '='
-  {   737,  15,  16,  21,    3,  -17 },   // 0x3E '>'
-  {   767,  12,  20,  21,    5,  -19 },   // 0x3F '?'
-  {   797,  13,  23,  21,    4,  -20 },   // 0x40 '@'
-  {   835,  21,  20,  21,    0,  -19 },   // 0x41 'A'
-  {   888,  18,  20,  21,    1,  -19 },   // 0x42 'B'
-  {   933,  17,  20,  21,    2,  -19 },   // 0x43 'C'
-  {   976,  16,  20,  21,    2,  -19 },   // 0x44 'D'
-  {  1016,  17,  20,  21,    1,  -19 },   // 0x45 'E'
-  {  1059,  17,  20,  21,    1,  -19 },   // 0x46 'F'
-  {  1102,  17,  20,  21,    2,  -19 },   // 0x47 'G'
-  {  1145,  16,  20,  21,    2,  -19 },   // 0x48 'H'
-  {  1185,  13,  20,  21,    4,  -19 },   // 0x49 'I'
-  {  1218,  17,  20,  21,    3,  -19 },   // 0x4A 'J'
-  {  1261,  18,  20,  21,    1,  -19 },   // 0x4B 'K'
-  {  1306,  15,  20,  21,    3,  -19 },   // 0x4C 'L'
-  {  1344,  19,  20,  21,    1,  -19 },   // 0x4D 'M'
-  {  1392,  18,  20,  21,    1,  -19 },   // 0x4E 'N'
-  {  1437,  17,  20,  21,    2,  -19 },   // 0x4F 'O'
-  {  1480,  16,  20,  21,    1,  -19 },   // 0x50 'P'
-  {  1520,  17,  24,  21,    2,  -19 },   // 0x51 'Q'
-  {  1571,  19,  20,  21,    1,  -19 },   // 0x52 'R'
-  {  1619,  14,  20,  21,    3,  -19 },   // 0x53 'S'
-  {  1654,  15,  20,  21,    3,  -19 },   // 0x54 'T'
-  {  1692,  17,  20,  21,    2,  -19 },   // 0x55 'U'
-  {  1735,  21,  20,  21,    0,  -19 },   // 0x56 'V'
-  {  1788,  19,  20,  21,    1,  -19 },   // 0x57 'W'
-  {  1836,  19,  20,  21,    1,  -19 },   // 0x58 'X'
-  {  1884,  17,  20,  21,    2,  -19 },   // 0x59 'Y'
-  {  1927,  13,  20,  21,    4,  -19 },   // 0x5A 'Z'
-  {  1960,   5,  25,  21,   10,  -20 },   // 0x5B '['
-  {  1976,  13,  26,  21,    4,  -22 },   // 0x5C '\'
-  {  2019,   5,  25,  21,    6,  -20 },   // 0x5D ']'
-  {  2035,  13,   9,  21,    4,  -20 },   // 0x5E '^'
-  {  2050,  21,   1,  21,    0,    4 },   // 0x5F '_'
-  {  2053,   6,   5,  21,    5,  -21 },   // 0x60 '`'
-  {  2057,  16,  15,  21,    3,  -14 },   // 0x61 'a'
-  {  2087,  18,  21,  21,    1,  -20 },   // 0x62 'b'
-  {  2135,  15,  15,  21,    3,  -14 },   // 0x63 'c'
-  {  2164,  18,  21,  21,    2,  -20 },   // 0x64 'd'
-  {  2212,  16,  15,  21,    2,  -14 },   // 0x65 'e'
-  {  2242,  14,  21,  21,    4,  -20 },   // 0x66 'f'
-  {  2279,  17,  22,  21,    2,  -14 },   // 0x67 'g'
-  {  2326,  17,  21,  21,    1,  -20 },   // 0x68 'h'
-  {  2371,  14,  22,  21,    4,  -21 },   // 0x69 'i'
-  {  2410,  10,  29,  21,    5,  -21 },   // 0x6A 'j'
-  {  2447,  16,  21,  21,    2,  -20 },   // 0x6B 'k'
-  {  2489,  14,  21,  21,    4,  -20 },   // 0x6C 'l'
-  {  2526,  19,  15,  21,    1,  -14 },   // 0x6D 'm'
-  {  2562,  17,  15,  21,    1,  -14 },   // 0x6E 'n'
-  {  2594,  15,  15,  21,    3,  -14 },   // 0x6F 'o'
-  {  2623,  18,  22,  21,    1,  -14 },   // 0x70 'p'
-  {  2673,  18,  22,  21,    2,  -14 },   // 0x71 'q'
-  {  2723,  15,  15,  21,    3,  -14 },   // 0x72 'r'
-  {  2752,  13,  15,  21,    4,  -14 },   // 0x73 's'
-  {  2777,  16,  20,  21,    1,  -19 },   // 0x74 't'
-  {  2817,  17,  15,  21,    1,  -14 },   // 0x75 'u'
-  {  2849,  19,  15,  21,    1,  -14 },   // 0x76 'v'
-  {  2885,  19,  15,  21,    1,  -14 },   // 0x77 'w'
-  {  2921,  17,  15,  21,    2,  -14 },   // 0x78 'x'
-  {  2953,  17,  22,  21,    2,  -14 },   // 0x79 'y'
-  {  3000,  13,  15,  21,    4,  -14 },   // 0x7A 'z'
-  {  3025,   8,  25,  21,    6,  -20 },   // 0x7B '{'
-  {  3050,   1,  25,  21,   10,  -20 },   // 0x7C '|'
-  {  3054,   8,  25,  21,    7,  -20 },   // 0x7D '}'
-  {  3079,  15,   5,  21,    3,  -11 } }; // 0x7E '~'
+  {    19,  11,  10,  21,    5,  -20 },   // 0x22 '"'
+  {    36,  14,  24,  21,    3,  -21 },   // 0x23 '#'
+  {    83,  13,  26,  21,    4,  -22 },   // 0x24 '$'
+  {   116,  15,  21,  21,    3,  -20 },   // 0x25 '%'
+  {   151,  12,  18,  21,    4,  -17 },   // 0x26 '&'
+  {   180,   4,  10,  21,    8,  -20 },   // 0x27 '''
+  {   187,   5,  25,  21,   10,  -20 },   // 0x28 '('
+  {   212,   5,  25,  21,    6,  -20 },   // 0x29 ')'
+  {   238,  13,  12,  21,    4,  -20 },   // 0x2A '*'
+  {   260,  15,  17,  21,    3,  -17 },   // 0x2B '+'
+  {   278,   7,  10,  21,    5,   -4 },   // 0x2C ','
+  {   289,  15,   1,  21,    3,   -9 },   // 0x2D '-'
+  {   291,   5,   5,  21,    8,   -4 },   // 0x2E '.'
+  {   295,  13,  26,  21,    4,  -22 },   // 0x2F '/'
+  {   322,  13,  21,  21,    4,  -20 },   // 0x30 '0'
+  {   353,  13,  21,  21,    4,  -20 },   // 0x31 '1'
+  {   378,  13,  21,  21,    3,  -20 },   // 0x32 '2'
+  {   404,  14,  21,  21,    3,  -20 },   // 0x33 '3'
+  {   430,  12,  21,  21,    4,  -20 },   // 0x34 '4'
+  {   464,  14,  21,  21,    3,  -20 },   // 0x35 '5'
+  {   490,  12,  21,  21,    5,  -20 },   // 0x36 '6'
+  {   523,  12,  21,  21,    4,  -20 },   // 0x37 '7'
+  {   545,  13,  21,  21,    4,  -20 },   // 0x38 '8'
+  {   577,  12,  21,  21,    5,  -20 },   // 0x39 '9'
+  {   610,   5,  15,  21,    8,  -14 },   // 0x3A ':'
+  {   618,   7,  20,  21,    5,  -14 },   // 0x3B ';'
+  {   635,  15,  16,  21,    3,  -17 },   // 0x3C '<'
+  {   651,  17,   6,  21,    2,  -12 },   // 0x3D '='
+  {   656,  15,  16,  21,    3,  -17 },   // 0x3E '>'
+  {   673,  12,  20,  21,    5,  -19 },   // 0x3F '?'
+  {   695,  13,  23,  21,    4,  -20 },   // 0x40 '@'
+  {   741,  21,  20,  21,    0,  -19 },   // 0x41 'A'
+  {   782,  18,  20,  21,    1,  -19 },   // 0x42 'B'
+  {   820,  17,  20,  21,    2,  -19 },   // 0x43 'C'
+  {   856,  16,  20,  21,    2,  -19 },   // 0x44 'D'
+  {   895,  17,  20,  21,    1,  -19 },   // 0x45 'E'
+  {   930,  17,  20,  21,    1,  -19 },   // 0x46 'F'
+  {   963,  17,  20,  21,    2,  -19 },   // 0x47 'G'
+  {   999,  16,  20,  21,    2,  -19 },   // 0x48 'H'
+  {  1038,  13,  20,  21,    4,  -19 },   // 0x49 'I'
+  {  1058,  17,  20,  21,    3,  -19 },   // 0x4A 'J'
+  {  1091,  18,  20,  21,    1,  -19 },   // 0x4B 'K'
+  {  1131,  15,  20,  21,    3,  -19 },   // 0x4C 'L'
+  {  1157,  19,  20,  21,    1,  -19 },   // 0x4D 'M'
+  {  1219,  18,  20,  21,    1,  -19 },   // 0x4E 'N'
+  {  1274,  17,  20,  21,    2,  -19 },   // 0x4F 'O'
+  {  1310,  16,  20,  21,    1,  -19 },   // 0x50 'P'
+  {  1343,  17,  24,  21,    2,  -19 },   // 0x51 'Q'
+  {  1384,  19,  20,  21,    1,  -19 },   // 0x52 'R'
+  {  1422,  14,  20,  21,    3,  -19 },   // 0x53 'S'
+  {  1451,  15,  20,  21,    3,  -19 },   // 0x54 'T'
+  {  1476,  17,  20,  21,    2,  -19 },   // 0x55 'U'
+  {  1516,  21,  20,  21,    0,  -19 },   // 0x56 'V'
+  {  1557,  19,  20,  21,    1,  -19 },   // 0x57 'W'
+  {  1623,  19,  20,  21,    1,  -19 },   // 0x58 'X'
+  {  1663,  17,  20,  21,    2,  -19 },   // 0x59 'Y'
+  {  1697,  13,  20,  21,    4,  -19 },   // 0x5A 'Z'
+  {  1725,   5,  25,  21,   10,  -20 },   // 0x5B '['
+  {  1749,  13,  26,  21,    4,  -22 },   // 0x5C '\'
+  {  1775,   5,  25,  21,    6,  -20 },   // 0x5D ']'
+  {  1799,  13,   9,  21,    4,  -20 },   // 0x5E '^'
+  {  1814,  21,   1,  21,    0,    4 },   // 0x5F '_'
+  {  1816,   6,   5,  21,    5,  -21 },   // 0x60 '`'
+  {  1821,  16,  15,  21,    3,  -14 },   // 0x61 'a'
+  {  1848,  18,  21,  21,    1,  -20 },   // 0x62 'b'
+  {  1891,  15,  15,  21,    3,  -14 },   // 0x63 'c'
+  {  1915,  18,  21,  21,    2,  -20 },   // 0x64 'd'
+  {  1957,  16,  15,  21,    2,  -14 },   // 0x65 'e'
+  {  1979,  14,  21,  21,    4,  -20 },   // 0x66 'f'
+  {  2001,  17,  22,  21,    2,  -14 },   // 0x67 'g'
+  {  2045,  17,  21,  21,    1,  -20 },   // 0x68 'h'
+  {  2085,  14,  22,  21,    4,  -21 },   // 0x69 'i'
+  {  2106,  10,  29,  21,    5,  -21 },   // 0x6A 'j'
+  {  2134,  16,  21,  21,    2,  -20 },   // 0x6B 'k'
+  {  2172,  14,  21,  21,    4,  -20 },   // 0x6C 'l'
+  {  2193,  19,  15,  21,    1,  -14 },   // 0x6D 'm'
+  {  2238,  17,  15,  21,    1,  -14 },   // 0x6E 'n'
+  {  2269,  15,  15,  21,    3,  -14 },   // 0x6F 'o'
+  {  2294,  18,  22,  21,    1,  -14 },   // 0x70 'p'
+  {  2337,  18,  22,  21,    2,  -14 },   // 0x71 'q'
+  {  2380,  15,  15,  21,    3,  -14 },   // 0x72 'r'
+  {  2400,  13,  15,  21,    4,  -14 },   // 0x73 's'
+  {  2421,  16,  20,  21,    1,  -19 },   // 0x74 't'
+  {  2451,  17,  15,  21,    1,  -14 },   // 0x75 'u'
+  {  2482,  19,  15,  21,    1,  -14 },   // 0x76 'v'
+  {  2513,  19,  15,  21,    1,  -14 },   // 0x77 'w'
+  {  2562,  17,  15,  21,    2,  -14 },   // 0x78 'x'
+  {  2590,  17,  22,  21,    2,  -14 },   // 0x79 'y'
+  {  2629,  13,  15,  21,    4,  -14 },   // 0x7A 'z'
+  {  2649,   8,  25,  21,    6,  -20 },   // 0x7B '{'
+  {  2674,   1,  25,  21,   10,  -20 },   // 0x7C '|'
+  {  2676,   8,  25,  21,    7,  -20 },   // 0x7D '}'
+  {  2702,  15,   5,  21,    3,  -11 } }; // 0x7E '~'
 
 const GFXfont FreeMono18pt7b PROGMEM = {
   (uint8_t  *)FreeMono18pt7bBitmaps,
   (GFXglyph *)FreeMono18pt7bGlyphs,
-  0x20, 0x7E, 35 };
+  0x20, 0x7E, 35, 1,
+  NULL, 0, 1 };
 
-// Approx. 3761 bytes
+// Approx. 3386 bytes
@@ -1,672 +1,423 @@
 const uint8_t FreeMonoBold24pt7bBitmaps[] PROGMEM = {
-  0x38, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF3, 0xE7, 0xCF,
-  0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE3, 0x82, 0x00, 0x00, 0x00, 0x71, 0xF7,
-  0xFF, 0xEF, 0x9E, 0x00, 0xFC, 0x7E, 0xF8, 0x7D, 0xF0, 0xFB, 0xE1, 0xF7,
-  0xC3, 0xEF, 0x87, 0xDF, 0x0F, 0xBE, 0x1F, 0x38, 0x1C, 0x70, 0x38, 0xE0,
-  0x71, 0xC0, 0xE3, 0x81, 0xC7, 0x03, 0x80, 0x01, 0xC1, 0xC0, 0x0F, 0x8F,
-  0x80, 0x3E, 0x3E, 0x00, 0xF8, 0xF8, 0x03, 0xE3, 0xE0, 0x0F, 0x8F, 0x80,
-  0x7E, 0x3E, 0x01, 0xF0, 0xF8, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x03, 0xFF,
-  0xFF, 0x9F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-  0x81, 0xF1, 0xF0, 0x07, 0xC7, 0xC0, 0x1F, 0x1F, 0x00, 0x7C, 0x7C, 0x1F,
-  0xFF, 0xFC, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x9F, 0xFF,
-  0xFC, 0x0F, 0x8F, 0x80, 0x3E, 0x3E, 0x00, 0xF8, 0xF8, 0x03, 0xE3, 0xE0,
-  0x0F, 0x8F, 0x80, 0x3E, 0x3E, 0x00, 0xF8, 0xF8, 0x03, 0xE3, 0xE0, 0x0F,
-  0x8F, 0x80, 0x3C, 0x3C, 0x00, 0x00, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
-  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x1F, 0xFF, 0x07, 0xFF, 0xF1, 0xFF, 0xFE,
-  0x7F, 0xFF, 0xDF, 0xC1, 0xFB, 0xF0, 0x1F, 0x7C, 0x01, 0xEF, 0x80, 0x39,
-  0xF8, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x03, 0xFF, 0xF0,
-  0x0F, 0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x07, 0xF8, 0x00, 0xFF,
-  0x80, 0x1F, 0xF8, 0x07, 0xFF, 0x81, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xCF,
-  0xFF, 0xF1, 0xDF, 0xFC, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00,
-  0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xC0, 0x00,
-  0x0F, 0x80, 0x00, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0xF0, 0xE0, 0x0F, 0x07,
-  0x80, 0x70, 0x1C, 0x03, 0x80, 0xE0, 0x1C, 0x07, 0x00, 0xF0, 0x78, 0x03,
-  0xC3, 0x80, 0x1F, 0xFC, 0x00, 0x7F, 0xC1, 0xF0, 0xF8, 0x7F, 0x00, 0x3F,
-  0xF0, 0x0F, 0xFC, 0x03, 0xFF, 0x00, 0xFF, 0xC0, 0x07, 0xE0, 0xF8, 0x38,
-  0x1F, 0xE0, 0x01, 0xFF, 0x80, 0x0F, 0x1E, 0x00, 0xF0, 0x78, 0x07, 0x01,
-  0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x70, 0x0F, 0x07, 0x80, 0x38, 0x78, 0x01,
-  0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0xFC,
-  0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x00, 0xFF, 0xF8, 0x0F, 0xC7, 0x00, 0x7C,
-  0x10, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-  0x1F, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC7, 0xCF, 0xFF,
-  0x3F, 0x7E, 0xFF, 0xFF, 0xE7, 0xFF, 0xBE, 0x1F, 0xF9, 0xF0, 0x7F, 0x8F,
-  0x83, 0xFC, 0x7C, 0x0F, 0xE3, 0xF0, 0x7F, 0xCF, 0xFF, 0xFF, 0x7F, 0xFF,
-  0xF9, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x0F, 0xE0, 0x00, 0xFD, 0xF7, 0xDF,
-  0x7D, 0xF7, 0xDF, 0x38, 0xE3, 0x8E, 0x38, 0xE0, 0x01, 0x80, 0xF0, 0x7C,
-  0x3F, 0x0F, 0xC7, 0xE1, 0xF8, 0xFC, 0x3E, 0x0F, 0x87, 0xC1, 0xF0, 0x7C,
-  0x1F, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F,
-  0x81, 0xF0, 0x7C, 0x1F, 0x07, 0xC0, 0xF8, 0x3E, 0x0F, 0xC1, 0xF0, 0x7E,
-  0x0F, 0x83, 0xF0, 0x7C, 0x1F, 0x03, 0xC0, 0x60, 0x3C, 0x0F, 0x83, 0xF0,
-  0xFC, 0x1F, 0x83, 0xE0, 0xFC, 0x1F, 0x07, 0xC1, 0xF8, 0x3E, 0x0F, 0x83,
-  0xE0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C,
-  0x1E, 0x0F, 0x83, 0xE0, 0xF8, 0x7C, 0x1F, 0x0F, 0xC3, 0xE1, 0xF8, 0x7C,
-  0x3F, 0x0F, 0x83, 0xE0, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x07, 0xC0, 0x00,
-  0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x10, 0x7C, 0x11, 0xF3, 0xE7,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x87, 0xFF, 0xF0, 0x07,
-  0xFC, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0x80, 0x3F, 0x7E, 0x01, 0xFB, 0xF0,
-  0x1F, 0x8F, 0xC0, 0xF8, 0x3E, 0x03, 0x80, 0xE0, 0x00, 0x38, 0x00, 0x00,
-  0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
-  0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-  0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00,
-  0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x70, 0x00, 0x1F,
-  0x8F, 0x87, 0xC7, 0xC3, 0xE1, 0xE1, 0xF0, 0xF0, 0x78, 0x38, 0x3C, 0x1C,
-  0x0E, 0x06, 0x00, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x7D, 0xFF, 0xFF, 0xFF, 0xEF, 0x80,
-  0x00, 0x00, 0x60, 0x00, 0x0F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01,
-  0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00,
-  0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
-  0x3E, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0xF8, 0x00,
-  0x1F, 0x80, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00,
-  0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x1F, 0x00,
-  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xC0,
-  0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x01,
-  0xFC, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x83, 0xFF, 0xFE,
-  0x1F, 0x83, 0xF1, 0xF8, 0x0F, 0xCF, 0x80, 0x3E, 0x7C, 0x01, 0xF7, 0xC0,
-  0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F,
-  0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
-  0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7D, 0xF0, 0x07, 0xCF,
-  0x80, 0x3E, 0x7E, 0x03, 0xF1, 0xF8, 0x3F, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF,
-  0x80, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-  0x3F, 0x80, 0x0F, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xF8, 0x0F, 0xEF, 0x80,
-  0xFC, 0xF8, 0x07, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8,
-  0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F,
-  0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00,
-  0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3F, 0xFF, 0xE7,
-  0xFF, 0xFF, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x01, 0xFC,
-  0x00, 0x3F, 0xF8, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC7, 0xFF, 0xFF, 0x3F,
-  0x03, 0xFB, 0xF0, 0x07, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFB, 0x80, 0x07,
-  0xC0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xF8, 0x00,
-  0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x00,
-  0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xE0,
-  0x0E, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xF8, 0x00, 0xFF, 0xF8, 0x0F, 0xFF,
-  0xE0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x7E, 0x03, 0xF1, 0xC0, 0x0F, 0xC0,
-  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x0F,
-  0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x00,
-  0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-  0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0xC0,
-  0x3F, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0,
-  0x1F, 0xF0, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x07,
-  0xF8, 0x00, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xEF, 0x80, 0x3E, 0xF8, 0x03,
-  0xCF, 0x80, 0x7C, 0xF8, 0x0F, 0x8F, 0x80, 0xF0, 0xF8, 0x1F, 0x0F, 0x81,
-  0xE0, 0xF8, 0x3E, 0x0F, 0x87, 0xC0, 0xF8, 0x78, 0x0F, 0x8F, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
-  0x80, 0x07, 0xFE, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x07,
-  0xFE, 0x3F, 0xFF, 0xC1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xC3,
-  0xFF, 0xFC, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00,
-  0x01, 0xF0, 0x00, 0x0F, 0xBF, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFC, 0x1F,
-  0xFF, 0xF0, 0xFF, 0xFF, 0x83, 0xC0, 0xFE, 0x00, 0x01, 0xF0, 0x00, 0x0F,
-  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-  0x03, 0xE0, 0x00, 0x3F, 0xF0, 0x03, 0xF7, 0xE0, 0x3F, 0xBF, 0xFF, 0xF9,
-  0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x00,
-  0x1F, 0xC0, 0x0F, 0xFF, 0x01, 0xFF, 0xF0, 0x7F, 0xFF, 0x0F, 0xFF, 0xE1,
-  0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00,
-  0x7C, 0x00, 0x0F, 0x8F, 0xC0, 0xF9, 0xFF, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF,
-  0xCF, 0xFF, 0xFC, 0xFF, 0x0F, 0xEF, 0xE0, 0x3E, 0xFC, 0x03, 0xFF, 0x80,
-  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xF7, 0xC0, 0x3F, 0x7E,
-  0x03, 0xF3, 0xF0, 0x7E, 0x3F, 0xFF, 0xE1, 0xFF, 0xFC, 0x0F, 0xFF, 0x80,
-  0x7F, 0xF0, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xE0, 0x00,
-  0x3E, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00,
-  0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x1F, 0x00,
-  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
-  0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8,
-  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x06, 0x00, 0x01, 0xF8, 0x00, 0xFF,
-  0xF0, 0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x7F, 0xFF, 0xE7, 0xE0, 0x7E, 0xFC,
-  0x03, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xF7,
-  0xC0, 0x3E, 0x7E, 0x07, 0xE3, 0xFF, 0xFC, 0x0F, 0xFF, 0x00, 0xFF, 0xF0,
-  0x1F, 0xFF, 0x83, 0xFF, 0xFC, 0x7F, 0x0F, 0xE7, 0xC0, 0x3E, 0xF8, 0x01,
-  0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x03, 0xF7, 0xE0,
-  0x7E, 0x7F, 0xFF, 0xE3, 0xFF, 0xFC, 0x1F, 0xFF, 0x80, 0xFF, 0xF0, 0x03,
-  0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xE0, 0x1F, 0xFF, 0x83, 0xFF, 0xF8,
-  0x7F, 0xFF, 0xC7, 0xE0, 0xFE, 0xFC, 0x03, 0xEF, 0x80, 0x3E, 0xF8, 0x01,
-  0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x07, 0xF7, 0xE0,
-  0xFF, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0x1F, 0xFF, 0xF0, 0xFF, 0x9F, 0x03,
-  0xF1, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
-  0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x7F, 0xFE, 0x0F, 0xFF, 0xC0,
-  0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x7D, 0xFF, 0xFF, 0xFF,
-  0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF,
-  0xFF, 0xFF, 0xEF, 0x80, 0x0F, 0x87, 0xF1, 0xFC, 0x7F, 0x1F, 0xC3, 0xE0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0x1F, 0x87, 0xE1, 0xF0, 0xFC, 0x3E, 0x0F, 0x03, 0xC1, 0xE0, 0x78, 0x1C,
-  0x07, 0x01, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x7F,
-  0x00, 0x01, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0,
-  0x01, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x00,
-  0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x7F, 0x00, 0x00, 0x1E, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE,
-  0x00, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07,
-  0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x01,
-  0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF0,
-  0x00, 0xFF, 0x80, 0x03, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F,
-  0xFF, 0xFC, 0xFF, 0xFF, 0xEF, 0xC0, 0x7E, 0xF8, 0x03, 0xFF, 0x80, 0x1F,
-  0x70, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x3F,
-  0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x0F,
-  0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-  0x3F, 0x80, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0xFF, 0x80, 0x3F, 0xF8,
-  0x0F, 0xFF, 0x83, 0xE0, 0xF8, 0x78, 0x07, 0x1E, 0x00, 0xF3, 0x80, 0x0E,
-  0x70, 0x01, 0xDE, 0x00, 0x3B, 0x80, 0x3F, 0x70, 0x1F, 0xEE, 0x07, 0xFD,
-  0xC1, 0xFF, 0xB8, 0x7E, 0x77, 0x0F, 0x0E, 0xE3, 0xC1, 0xDC, 0x70, 0x3B,
-  0x8E, 0x07, 0x71, 0xC0, 0xEE, 0x3C, 0x1D, 0xC3, 0xC3, 0xB8, 0x7F, 0xF7,
-  0x07, 0xFF, 0xE0, 0x7F, 0xFC, 0x03, 0xFB, 0xC0, 0x00, 0x38, 0x00, 0x07,
-  0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x61, 0xF0, 0x3E, 0x1F, 0xFF, 0xC3,
-  0xFF, 0xF0, 0x1F, 0xFC, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F,
-  0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFE,
-  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xF7, 0xC0, 0x00, 0x0F, 0xBE, 0x00,
-  0x00, 0x7D, 0xF8, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x3E, 0x3E, 0x00, 0x03,
-  0xE0, 0xF8, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xF0, 0x3F, 0x00, 0x0F, 0x80,
-  0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xF8,
-  0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x00, 0xF8, 0x00, 0xF8, 0x0F,
-  0x80, 0x03, 0xE1, 0xFF, 0x80, 0xFF, 0xDF, 0xFE, 0x0F, 0xFF, 0xFF, 0xF0,
-  0x7F, 0xFF, 0xFF, 0x83, 0xFF, 0xDF, 0xF8, 0x0F, 0xFC, 0x7F, 0xFF, 0xC0,
-  0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-  0xFE, 0x07, 0xC0, 0x1F, 0xC1, 0xF0, 0x01, 0xF0, 0x7C, 0x00, 0x7C, 0x1F,
-  0x00, 0x1F, 0x07, 0xC0, 0x0F, 0xC1, 0xF0, 0x07, 0xE0, 0x7F, 0xFF, 0xF0,
-  0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-  0xFC, 0x1F, 0x00, 0x3F, 0x87, 0xC0, 0x03, 0xF1, 0xF0, 0x00, 0x7C, 0x7C,
-  0x00, 0x1F, 0x1F, 0x00, 0x07, 0xC7, 0xC0, 0x03, 0xF7, 0xFF, 0xFF, 0xFB,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-  0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE7, 0x01, 0xFF, 0xFF, 0xC1, 0xFF,
-  0xFF, 0xE1, 0xFF, 0xFF, 0xF1, 0xFE, 0x07, 0xF8, 0xFC, 0x01, 0xFC, 0xFC,
-  0x00, 0x7E, 0x7C, 0x00, 0x1F, 0x7E, 0x00, 0x0F, 0xBE, 0x00, 0x03, 0x9F,
-  0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-  0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00,
-  0x1F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x39, 0xFC, 0x00,
-  0x7C, 0x7F, 0x80, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x81, 0xFF,
-  0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x7F,
-  0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC1,
-  0xF0, 0x0F, 0xF0, 0xF8, 0x01, 0xF8, 0x7C, 0x00, 0x7E, 0x3E, 0x00, 0x1F,
-  0x1F, 0x00, 0x0F, 0xCF, 0x80, 0x03, 0xE7, 0xC0, 0x01, 0xF3, 0xE0, 0x00,
-  0xF9, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0x3E, 0x00,
-  0x0F, 0x9F, 0x00, 0x07, 0xCF, 0x80, 0x07, 0xE7, 0xC0, 0x03, 0xE3, 0xE0,
-  0x03, 0xF1, 0xF0, 0x07, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF8, 0xFF,
-  0xFF, 0xF8, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF,
-  0x7F, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-  0xF0, 0xF8, 0x00, 0xF8, 0x7C, 0x00, 0x7C, 0x3E, 0x0E, 0x3E, 0x1F, 0x0F,
-  0x9F, 0x0F, 0x87, 0xC7, 0x07, 0xC3, 0xE0, 0x03, 0xFF, 0xF0, 0x01, 0xFF,
-  0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
-  0x0F, 0x80, 0x0F, 0x87, 0xC3, 0x87, 0xC1, 0xC3, 0xE3, 0xE0, 0x01, 0xF1,
-  0xF0, 0x00, 0xF8, 0xF8, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xF8, 0xF8, 0x00, 0x7C, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x1F, 0x1F,
-  0x07, 0x0F, 0x8F, 0x87, 0xC3, 0x87, 0xC3, 0xE0, 0x03, 0xFF, 0xF0, 0x01,
-  0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x00,
-  0x1F, 0x0F, 0x80, 0x0F, 0x87, 0xC0, 0x07, 0xC3, 0xE0, 0x03, 0xE0, 0xE0,
-  0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xFC,
-  0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-  0x7F, 0x8E, 0x00, 0xFF, 0xF7, 0x81, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE1,
-  0xFF, 0xFF, 0xF1, 0xFE, 0x03, 0xF8, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0x3E,
-  0x7C, 0x00, 0x1F, 0x7E, 0x00, 0x07, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x0F,
-  0xFE, 0xF8, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x00,
-  0xFF, 0xFF, 0xC0, 0x01, 0xF3, 0xF0, 0x00, 0xF9, 0xFC, 0x00, 0x7C, 0x7F,
-  0x80, 0xFE, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x80,
-  0x7F, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xE1, 0xFF, 0x1F, 0xFC, 0xFF,
-  0xE7, 0xFF, 0x3F, 0xF9, 0xFF, 0xCF, 0xFE, 0x3F, 0xE1, 0xFF, 0x07, 0xC0,
-  0x0F, 0x81, 0xF0, 0x03, 0xE0, 0x7C, 0x00, 0xF8, 0x1F, 0x00, 0x3E, 0x07,
-  0xC0, 0x0F, 0x81, 0xF0, 0x03, 0xE0, 0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE,
-  0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x1F, 0x00,
-  0x3E, 0x07, 0xC0, 0x0F, 0x81, 0xF0, 0x03, 0xE0, 0x7C, 0x00, 0xF8, 0x1F,
-  0x00, 0x3E, 0x07, 0xC0, 0x0F, 0x87, 0xFE, 0x1F, 0xFB, 0xFF, 0xCF, 0xFF,
-  0xFF, 0xF3, 0xFF, 0xFF, 0xFC, 0xFF, 0xF7, 0xFE, 0x1F, 0xF8, 0x7F, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFC, 0x03, 0xE0,
-  0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
-  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
-  0x03, 0xE0, 0x1F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-  0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF,
-  0xE0, 0x3F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x07,
-  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-  0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x07, 0xC0, 0xE0, 0x03, 0xE0, 0xF8, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x3E,
-  0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x1F, 0x07, 0xC0, 0x1F, 0x83,
-  0xF8, 0x3F, 0x81, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0,
-  0x07, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0x9F, 0xFE,
-  0x3F, 0xFB, 0xFF, 0xC7, 0xFF, 0x7F, 0xF8, 0xFF, 0xE7, 0xFE, 0x0F, 0xF8,
-  0x3E, 0x01, 0xF8, 0x07, 0xC0, 0xFE, 0x00, 0xF8, 0x3F, 0x80, 0x1F, 0x0F,
-  0xE0, 0x03, 0xE3, 0xF8, 0x00, 0x7D, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x01,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0xFE, 0x7F,
-  0x00, 0x1F, 0x87, 0xF0, 0x03, 0xE0, 0x7E, 0x00, 0x7C, 0x07, 0xE0, 0x0F,
-  0x80, 0x7E, 0x01, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x1F, 0xF8, 0x1F,
-  0xF7, 0xFF, 0x81, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x07, 0xFD, 0xFF,
-  0x80, 0x7F, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x80,
-  0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x0F, 0x80, 0x0E, 0x07, 0xC0, 0x0F, 0x83, 0xE0, 0x07, 0xC1,
-  0xF0, 0x03, 0xE0, 0xF8, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x3E, 0x00, 0x7D,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xDF, 0xFF, 0xFF, 0xE0, 0x3F, 0x80, 0x03, 0xF8, 0xFF, 0x80, 0x0F, 0xF9,
-  0xFF, 0x00, 0x1F, 0xF3, 0xFF, 0x00, 0x7F, 0xE3, 0xFE, 0x00, 0xFF, 0x83,
-  0xFE, 0x03, 0xFE, 0x07, 0xFC, 0x07, 0xFC, 0x0F, 0xFC, 0x1F, 0xF8, 0x1F,
-  0xF8, 0x3F, 0xF0, 0x3F, 0xF0, 0x7F, 0xE0, 0x7D, 0xF1, 0xF7, 0xC0, 0xFB,
-  0xE3, 0xEF, 0x81, 0xF7, 0xEF, 0xDF, 0x03, 0xE7, 0xDF, 0x3E, 0x07, 0xCF,
-  0xFE, 0x7C, 0x0F, 0x8F, 0xF8, 0xF8, 0x1F, 0x1F, 0xF1, 0xF0, 0x3E, 0x1F,
-  0xE3, 0xE0, 0x7C, 0x3F, 0x87, 0xC0, 0xF8, 0x3F, 0x0F, 0x81, 0xF0, 0x00,
-  0x1F, 0x03, 0xE0, 0x00, 0x3E, 0x1F, 0xF8, 0x03, 0xFF, 0x7F, 0xF8, 0x0F,
-  0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFD, 0xFF, 0x80, 0x3F,
-  0xF0, 0x7F, 0x00, 0x7F, 0xEF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-  0xFC, 0x0F, 0xFF, 0x7F, 0xE0, 0x7F, 0xE1, 0xFF, 0x00, 0xF8, 0x1F, 0xF0,
-  0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xFC, 0x0F, 0x81, 0xFF, 0xC0, 0xF8,
-  0x1F, 0x7E, 0x0F, 0x81, 0xF3, 0xF0, 0xF8, 0x1F, 0x3F, 0x0F, 0x81, 0xF1,
-  0xF8, 0xF8, 0x1F, 0x0F, 0xCF, 0x81, 0xF0, 0xFC, 0xF8, 0x1F, 0x07, 0xEF,
-  0x81, 0xF0, 0x3F, 0xF8, 0x1F, 0x03, 0xFF, 0x81, 0xF0, 0x1F, 0xF8, 0x1F,
-  0x00, 0xFF, 0x81, 0xF0, 0x0F, 0xF8, 0x7F, 0xE0, 0x7F, 0x8F, 0xFF, 0x03,
-  0xF8, 0xFF, 0xF0, 0x3F, 0x8F, 0xFF, 0x01, 0xF8, 0x7F, 0xE0, 0x0F, 0x80,
-  0x00, 0x3F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x03, 0xFF,
-  0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xC1, 0xFE, 0x0F, 0xE0, 0x0F, 0xE1,
-  0xF8, 0x00, 0xFC, 0x7E, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0xFB, 0xF0, 0x00,
-  0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x7F, 0xF0, 0x00, 0x1F, 0xBE, 0x00, 0x03, 0xE7, 0xE0, 0x00, 0xFC, 0x7E,
-  0x00, 0x3F, 0x0F, 0xE0, 0x0F, 0xE0, 0xFF, 0x07, 0xF8, 0x0F, 0xFF, 0xFE,
-  0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x03,
-  0xF8, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xFF,
-  0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x1F, 0x00, 0xFE, 0x1F, 0x00, 0x3F, 0x1F,
-  0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x1F,
-  0x00, 0x3F, 0x1F, 0x00, 0x7E, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x1F,
-  0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x1F, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xFF,
-  0xFE, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-  0x3F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xFE,
-  0x00, 0xFF, 0xFF, 0xE0, 0x3F, 0xC1, 0xFE, 0x0F, 0xE0, 0x0F, 0xE1, 0xF8,
-  0x00, 0xFC, 0x7E, 0x00, 0x0F, 0xCF, 0x80, 0x00, 0xFB, 0xF0, 0x00, 0x1F,
-  0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFD,
-  0xF0, 0x00, 0x1F, 0x3F, 0x00, 0x07, 0xE7, 0xF0, 0x01, 0xF8, 0x7F, 0x00,
-  0x7F, 0x07, 0xF8, 0x3F, 0xC0, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x00,
-  0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0x00,
-  0x00, 0x03, 0xFF, 0x87, 0x80, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x07,
-  0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x0F, 0x01, 0xF8, 0x00, 0x7F, 0xFF,
-  0x80, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0,
-  0x7F, 0xFF, 0xFE, 0x00, 0xF8, 0x07, 0xE0, 0x0F, 0x80, 0x3F, 0x00, 0xF8,
-  0x01, 0xF0, 0x0F, 0x80, 0x1F, 0x00, 0xF8, 0x01, 0xF0, 0x0F, 0x80, 0x3F,
-  0x00, 0xF8, 0x0F, 0xE0, 0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x0F,
-  0xFF, 0xF0, 0x00, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xF8, 0x3F,
-  0x80, 0x0F, 0x81, 0xFC, 0x00, 0xF8, 0x0F, 0xE0, 0x0F, 0x80, 0x7E, 0x00,
-  0xF8, 0x03, 0xF0, 0x7F, 0xF0, 0x1F, 0xEF, 0xFF, 0x81, 0xFF, 0xFF, 0xF8,
-  0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0x7F, 0xF0, 0x07, 0xE0, 0x01, 0xFC, 0x70,
-  0x1F, 0xFD, 0xE0, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0xFC,
-  0x0F, 0xE7, 0xE0, 0x1F, 0x9F, 0x00, 0x3E, 0x7C, 0x00, 0xF9, 0xF0, 0x01,
-  0xC7, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xE0, 0x00,
-  0x0F, 0xDC, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xC0, 0x0F,
-  0xFF, 0xC0, 0xFE, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x1C,
-  0xFF, 0xF0, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xF0, 0x7F,
-  0xE0, 0xF8, 0x3F, 0xF0, 0x7C, 0x1F, 0xF8, 0x3E, 0x0F, 0xFC, 0x1F, 0x07,
-  0xFE, 0x0F, 0x83, 0xEE, 0x07, 0xC0, 0xE0, 0x03, 0xE0, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01,
-  0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03,
-  0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x7F, 0xEF, 0xFF, 0x0F,
-  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x7F, 0xE0, 0x7F, 0xE1,
-  0xF0, 0x00, 0xF8, 0x1F, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0xF8, 0x1F, 0x00,
-  0x0F, 0x81, 0xF0, 0x00, 0xF8, 0x1F, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0xF8,
-  0x1F, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0xF8, 0x1F, 0x00, 0x0F, 0x81, 0xF0,
-  0x00, 0xF8, 0x1F, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0xF8, 0x1F, 0x00, 0x0F,
-  0x81, 0xF0, 0x00, 0xF8, 0x1F, 0x80, 0x1F, 0x80, 0xF8, 0x01, 0xF0, 0x0F,
-  0xE0, 0x7F, 0x00, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF,
-  0x80, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xE0, 0x1F, 0xFB,
-  0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0x7F,
-  0xE0, 0x1F, 0xF8, 0x7C, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x7C, 0x03, 0xE0,
-  0x01, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7E, 0x00,
-  0xF8, 0x00, 0xF8, 0x07, 0xC0, 0x03, 0xF0, 0x1F, 0x00, 0x07, 0xC0, 0xF8,
-  0x00, 0x1F, 0x03, 0xE0, 0x00, 0x7E, 0x1F, 0x00, 0x00, 0xF8, 0x7C, 0x00,
-  0x03, 0xF3, 0xF0, 0x00, 0x07, 0xCF, 0x80, 0x00, 0x1F, 0xBE, 0x00, 0x00,
-  0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07,
-  0xF8, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC,
-  0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF,
-  0xFF, 0xFF, 0x0F, 0xFF, 0x7F, 0xE0, 0x7F, 0xE3, 0xE0, 0x00, 0x3C, 0x3E,
-  0x0F, 0x83, 0xC3, 0xE1, 0xF8, 0x3C, 0x3E, 0x1F, 0x87, 0xC3, 0xE1, 0xFC,
-  0x7C, 0x3E, 0x3F, 0xC7, 0xC1, 0xE3, 0xFC, 0x7C, 0x1F, 0x3F, 0xE7, 0xC1,
-  0xF7, 0xFE, 0x78, 0x1F, 0x7F, 0xE7, 0x81, 0xF7, 0x9F, 0xF8, 0x1F, 0xF9,
-  0xFF, 0x81, 0xFF, 0x9F, 0xF8, 0x0F, 0xF9, 0xFF, 0x80, 0xFF, 0x0F, 0xF8,
-  0x0F, 0xF0, 0xFF, 0x80, 0xFF, 0x0F, 0xF0, 0x0F, 0xE0, 0x7F, 0x00, 0xFE,
-  0x07, 0xF0, 0x0F, 0xE0, 0x7F, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xC0, 0x3F,
-  0x00, 0x7F, 0x80, 0xFF, 0x3F, 0xF0, 0x7F, 0xEF, 0xFC, 0x1F, 0xFB, 0xFF,
-  0x07, 0xFE, 0x7F, 0x80, 0xFF, 0x07, 0xE0, 0x3F, 0x00, 0xFC, 0x0F, 0x80,
-  0x1F, 0x87, 0xC0, 0x03, 0xF3, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFC,
-  0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07,
-  0xF0, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFC, 0xF8, 0x00,
-  0x7E, 0x3F, 0x00, 0x3F, 0x07, 0xE0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x1F,
-  0x07, 0xFC, 0x0F, 0xFB, 0xFF, 0x87, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF8,
-  0x7F, 0xF7, 0xFC, 0x0F, 0xF8, 0x7F, 0x80, 0x7F, 0xBF, 0xF0, 0x3F, 0xFF,
-  0xFC, 0x0F, 0xFF, 0xFF, 0x03, 0xFF, 0x7F, 0x80, 0x7F, 0x87, 0xE0, 0x1F,
-  0x80, 0xFC, 0x07, 0xC0, 0x1F, 0x03, 0xE0, 0x03, 0xE1, 0xF8, 0x00, 0xFC,
-  0x7C, 0x00, 0x1F, 0xBE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00,
-  0x1F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x03,
-  0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0xF3,
-  0xFF, 0xFF, 0x9F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x3E, 0x03,
-  0xF1, 0xF0, 0x1F, 0x8F, 0x81, 0xF8, 0x7C, 0x1F, 0x83, 0xE1, 0xF8, 0x0E,
-  0x1F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0,
-  0x00, 0xFC, 0x00, 0x0F, 0xE0, 0x70, 0x7E, 0x07, 0xC7, 0xE0, 0x3E, 0x7E,
-  0x01, 0xF7, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xBE, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8,
-  0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F,
-  0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0,
-  0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x60, 0x00, 0x0F, 0x00, 0x00,
-  0xF8, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7E, 0x00,
-  0x03, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xF8,
-  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x03,
-  0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00,
-  0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xF0,
-  0x00, 0x1F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x07,
-  0xC0, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00,
-  0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
-  0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0,
-  0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F,
-  0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x7F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x7F, 0xC0, 0x00, 0x40, 0x00, 0x06, 0x00, 0x00, 0xF0,
-  0x00, 0x1F, 0x80, 0x03, 0xFC, 0x00, 0x7F, 0xE0, 0x0F, 0xFF, 0x00, 0xFF,
-  0xF8, 0x1F, 0x9F, 0x83, 0xF0, 0xFC, 0x7E, 0x07, 0xEF, 0xC0, 0x3F, 0xF8,
-  0x01, 0xFF, 0x80, 0x0F, 0x70, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0xE0, 0x78, 0x3E, 0x0F, 0xC3, 0xF0, 0x7C, 0x1E, 0x06, 0x01, 0xFF,
-  0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF,
-  0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x01, 0xFF,
-  0xF8, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF,
-  0xF8, 0x7F, 0x00, 0xF8, 0xFC, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x03,
-  0xF8, 0xFC, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF,
-  0xFF, 0x1F, 0xFE, 0xFE, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00,
-  0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x0F,
-  0xE0, 0x03, 0xEF, 0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x81,
-  0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x7F, 0x07, 0xF0, 0x03, 0xF0, 0xFC, 0x00,
-  0x3E, 0x1F, 0x80, 0x07, 0xE3, 0xE0, 0x00, 0x7C, 0x7C, 0x00, 0x0F, 0x8F,
-  0x80, 0x01, 0xF1, 0xF0, 0x00, 0x3E, 0x3E, 0x00, 0x07, 0xC7, 0xE0, 0x01,
-  0xF8, 0xFC, 0x00, 0x3E, 0x1F, 0xC0, 0x0F, 0xCF, 0xFE, 0x07, 0xF3, 0xFF,
-  0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xE0, 0xFE, 0x7F, 0xF0,
-  0x00, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0x18, 0x03, 0xFF, 0xFC, 0x0F, 0xFF,
-  0xFC, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0x81, 0xFC, 0x7E, 0x00,
-  0x7C, 0x7C, 0x00, 0x7C, 0xFC, 0x00, 0x3C, 0xF8, 0x00, 0x38, 0xF8, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0x7C, 0x00, 0x06, 0x7E, 0x00, 0x1F, 0x7F, 0x80, 0x7F, 0x3F, 0xFF,
-  0xFF, 0x1F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0xFF,
-  0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xE0, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0,
-  0x00, 0x00, 0xF8, 0x00, 0xFE, 0x3E, 0x00, 0xFF, 0xEF, 0x80, 0xFF, 0xFF,
-  0xE0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x1F, 0xE0, 0xFF, 0x87, 0xE0,
-  0x0F, 0xE1, 0xF0, 0x01, 0xF8, 0xFC, 0x00, 0x7E, 0x3E, 0x00, 0x0F, 0x8F,
-  0x80, 0x03, 0xE3, 0xE0, 0x00, 0xF8, 0xF8, 0x00, 0x3E, 0x3E, 0x00, 0x0F,
-  0x8F, 0xC0, 0x07, 0xE1, 0xF0, 0x01, 0xF8, 0x7E, 0x00, 0xFE, 0x0F, 0xE0,
-  0x7F, 0xE3, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0,
-  0xFF, 0xEF, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0xC0,
-  0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x7F, 0x81, 0xFC,
-  0x7E, 0x00, 0x7E, 0xFC, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x80, 0x7E,
-  0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x07, 0xFF, 0xF8,
-  0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0,
-  0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF0,
-  0x00, 0x07, 0xC0, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8,
-  0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07,
-  0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0,
-  0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x01,
-  0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF,
-  0xFF, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0x83, 0xFF, 0xFF, 0xE3,
-  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFC, 0x3F, 0xF9, 0xF8, 0x07, 0xF0,
-  0xF8, 0x01, 0xF8, 0xFC, 0x00, 0xFC, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x1F,
-  0x1F, 0x00, 0x0F, 0x8F, 0x80, 0x07, 0xC7, 0xC0, 0x03, 0xE3, 0xF0, 0x03,
-  0xF0, 0xF8, 0x01, 0xF8, 0x7E, 0x01, 0xFC, 0x3F, 0xC3, 0xFE, 0x0F, 0xFF,
-  0xFF, 0x03, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x3F, 0xFB, 0xE0, 0x07,
-  0xF1, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFE, 0x00,
-  0x0F, 0xFC, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x0F, 0xC0, 0x07, 0xCF, 0xFC, 0x01,
-  0xF7, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x07, 0xFC, 0x1F,
-  0x81, 0xFC, 0x03, 0xE0, 0x7E, 0x00, 0xF8, 0x1F, 0x00, 0x3E, 0x07, 0xC0,
-  0x0F, 0x81, 0xF0, 0x03, 0xE0, 0x7C, 0x00, 0xF8, 0x1F, 0x00, 0x3E, 0x07,
-  0xC0, 0x0F, 0x81, 0xF0, 0x03, 0xE0, 0x7C, 0x00, 0xF8, 0x1F, 0x00, 0x3E,
-  0x1F, 0xF0, 0x3F, 0xEF, 0xFE, 0x1F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xE1,
-  0xFF, 0xDF, 0xF0, 0x3F, 0xE0, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C,
-  0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x7F, 0xF0,
-  0x01, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00,
-  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
-  0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x7F, 0xFF, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x7C,
-  0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
-  0xFF, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07,
-  0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00,
-  0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8,
-  0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0xBF, 0xFF, 0xBF, 0xFF,
-  0x9F, 0xFF, 0xCF, 0xFF, 0x83, 0xFF, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F,
-  0x87, 0xFC, 0x07, 0xC7, 0xFF, 0x03, 0xE3, 0xFF, 0x81, 0xF1, 0xFF, 0xC0,
-  0xF8, 0x7F, 0xC0, 0x7C, 0xFE, 0x00, 0x3E, 0xFE, 0x00, 0x1F, 0xFE, 0x00,
-  0x0F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xE0,
-  0x00, 0xFF, 0xF8, 0x00, 0x7C, 0xFE, 0x00, 0x3E, 0x3F, 0x80, 0x1F, 0x0F,
-  0xE0, 0x3F, 0x81, 0xFF, 0xBF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0,
-  0x7F, 0xFB, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x0F, 0xFE,
-  0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
-  0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
-  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00,
-  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
-  0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x03, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF8,
-  0x00, 0x3C, 0x1F, 0x00, 0xFD, 0xFC, 0xFF, 0x07, 0xFF, 0xFF, 0xFE, 0x1F,
-  0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0xFF, 0x1F, 0x87, 0xC1, 0xF8,
-  0x7E, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F,
-  0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1,
-  0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C,
-  0x1F, 0x07, 0xC1, 0xF1, 0xFE, 0x1F, 0x87, 0xEF, 0xFC, 0x7F, 0x1F, 0xFF,
-  0xF1, 0xFC, 0x7F, 0xFF, 0xC7, 0xF1, 0xFD, 0xFE, 0x1F, 0x87, 0xE0, 0x00,
-  0x1F, 0x80, 0x1F, 0x9F, 0xF8, 0x1F, 0xDF, 0xFE, 0x0F, 0xFF, 0xFF, 0x87,
-  0xFF, 0xFF, 0xC1, 0xFF, 0x07, 0xF0, 0x7F, 0x01, 0xF8, 0x3F, 0x00, 0x7C,
-  0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x1F, 0x07, 0xC0, 0x0F, 0x83, 0xE0, 0x07,
-  0xC1, 0xF0, 0x03, 0xE0, 0xF8, 0x01, 0xF0, 0x7C, 0x00, 0xF8, 0x3E, 0x00,
-  0x7C, 0x1F, 0x00, 0x3E, 0x3F, 0xE0, 0x7F, 0xBF, 0xF8, 0x7F, 0xFF, 0xFC,
-  0x3F, 0xFF, 0xFE, 0x1F, 0xFB, 0xFE, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x01,
-  0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC1,
-  0xFE, 0x0F, 0xF1, 0xFC, 0x01, 0xFC, 0xFC, 0x00, 0x7E, 0xFC, 0x00, 0x1F,
-  0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0xFF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x7E, 0xF8, 0x00, 0x7E, 0x7F, 0x00,
-  0x7F, 0x1F, 0xC0, 0xFF, 0x07, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x80, 0x7F,
-  0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x03,
-  0xF9, 0xFF, 0xC0, 0x7F, 0xBF, 0xFE, 0x07, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF,
-  0xFF, 0xC3, 0xFF, 0x83, 0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0xFC, 0x00, 0x7E,
-  0x0F, 0xC0, 0x03, 0xF0, 0xF8, 0x00, 0x1F, 0x0F, 0x80, 0x01, 0xF0, 0xF8,
-  0x00, 0x1F, 0x0F, 0x80, 0x01, 0xF0, 0xF8, 0x00, 0x3F, 0x0F, 0xC0, 0x03,
-  0xF0, 0xFE, 0x00, 0x7E, 0x0F, 0xF8, 0x1F, 0xE0, 0xFF, 0xFF, 0xFC, 0x0F,
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0, 0x0F, 0x9F, 0xFC, 0x00, 0xF8, 0x7F,
-  0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0xFF, 0xFC,
-  0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x7E, 0x00,
-  0x00, 0x3F, 0xF9, 0xFC, 0x0F, 0xFF, 0xDF, 0xE1, 0xFF, 0xFF, 0xFE, 0x3F,
-  0xFF, 0xFF, 0xE3, 0xF8, 0x1F, 0xFC, 0x7F, 0x00, 0x7F, 0x07, 0xC0, 0x03,
-  0xF0, 0xFC, 0x00, 0x3F, 0x0F, 0x80, 0x01, 0xF0, 0xF8, 0x00, 0x1F, 0x0F,
-  0x80, 0x01, 0xF0, 0xF8, 0x00, 0x1F, 0x0F, 0xC0, 0x01, 0xF0, 0xFC, 0x00,
-  0x3F, 0x07, 0xE0, 0x07, 0xF0, 0x7F, 0x81, 0xFF, 0x03, 0xFF, 0xFF, 0xF0,
-  0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x9F, 0x00, 0x0F,
-  0xE1, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x00,
-  0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01,
-  0xF0, 0x3F, 0xC7, 0xFC, 0x7F, 0xCF, 0xFE, 0x7F, 0xDF, 0xFF, 0x7F, 0xFF,
-  0xFF, 0x3F, 0xFF, 0x0E, 0x07, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xF0,
-  0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0,
-  0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0,
-  0x00, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xE0, 0x7F, 0xFF, 0xC0, 0x03, 0xFC, 0x60, 0x7F, 0xFF, 0x87, 0xFF, 0xFC,
-  0x7F, 0xFF, 0xE7, 0xFF, 0xFF, 0x3F, 0x01, 0xF9, 0xF0, 0x07, 0xCF, 0xC0,
-  0x1C, 0x7F, 0xF0, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0,
-  0x3F, 0xFF, 0x00, 0x0F, 0xFD, 0xC0, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
-  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0x3F,
-  0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x07, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xFF,
-  0xF8, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF,
-  0x80, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-  0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-  0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x03, 0x83, 0xF0, 0x1F, 0x87,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x03,
-  0xFC, 0x00, 0x7F, 0x01, 0xFE, 0x7F, 0x81, 0xFF, 0x3F, 0xC0, 0xFF, 0x9F,
-  0xE0, 0x7F, 0xC7, 0xF0, 0x1F, 0xE0, 0xF8, 0x01, 0xF0, 0x7C, 0x00, 0xF8,
-  0x3E, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x1F, 0x07, 0xC0, 0x0F,
-  0x83, 0xE0, 0x07, 0xC1, 0xF0, 0x03, 0xE0, 0xF8, 0x01, 0xF0, 0x7C, 0x01,
-  0xF8, 0x3F, 0x01, 0xFC, 0x1F, 0xC1, 0xFF, 0x07, 0xFF, 0xFF, 0xC3, 0xFF,
-  0xFF, 0xE0, 0xFF, 0xF7, 0xF0, 0x3F, 0xF3, 0xF0, 0x03, 0xF0, 0x00, 0x7F,
-  0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F,
-  0xFF, 0x7F, 0xE0, 0x7F, 0xE0, 0xF8, 0x01, 0xF0, 0x0F, 0xC0, 0x1F, 0x00,
-  0x7C, 0x03, 0xE0, 0x07, 0xE0, 0x3E, 0x00, 0x3E, 0x07, 0xC0, 0x03, 0xF0,
-  0x7C, 0x00, 0x1F, 0x0F, 0x80, 0x01, 0xF8, 0xF8, 0x00, 0x0F, 0x9F, 0x00,
-  0x00, 0xFD, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03,
-  0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0x80,
-  0x00, 0x7F, 0x80, 0x1F, 0xEF, 0xFC, 0x03, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-  0xFC, 0x03, 0xFF, 0x7F, 0x80, 0x1F, 0xE1, 0xF0, 0xF8, 0x7C, 0x1F, 0x1F,
-  0x87, 0xC1, 0xF1, 0xF8, 0xFC, 0x1F, 0x1F, 0xCF, 0x80, 0xFB, 0xFC, 0xF8,
-  0x0F, 0xBF, 0xDF, 0x80, 0xFB, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F,
-  0xDF, 0xF0, 0x07, 0xF9, 0xFF, 0x00, 0x7F, 0x9F, 0xE0, 0x07, 0xF0, 0xFE,
-  0x00, 0x3F, 0x0F, 0xE0, 0x03, 0xF0, 0x7E, 0x00, 0x3E, 0x07, 0xC0, 0x03,
-  0xE0, 0x3C, 0x00, 0x3F, 0xC0, 0xFF, 0x1F, 0xF8, 0x7F, 0xE7, 0xFE, 0x1F,
-  0xF9, 0xFF, 0x87, 0xFE, 0x3F, 0xC0, 0xFF, 0x03, 0xF8, 0x7F, 0x00, 0x7F,
-  0x3F, 0x80, 0x0F, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xE0, 0x00,
-  0x07, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xFE,
-  0x00, 0xFE, 0x1F, 0xC0, 0x7F, 0x03, 0xF8, 0x7F, 0xC0, 0xFF, 0xBF, 0xF8,
-  0x7F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x87, 0xFF, 0x7F, 0xC0, 0xFF, 0x80,
-  0x7F, 0x80, 0x7F, 0xBF, 0xF0, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x03,
-  0xFF, 0x7F, 0x80, 0x7F, 0x8F, 0xC0, 0x07, 0x81, 0xF0, 0x03, 0xE0, 0x7E,
-  0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xF0, 0x3E, 0x00, 0x7C, 0x0F, 0x80,
-  0x0F, 0x87, 0xC0, 0x03, 0xE1, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x1F, 0xFE,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07,
-  0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00,
-  0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xFF, 0x80,
-  0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
-  0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x3F, 0xBE, 0x0F, 0xC3, 0x83, 0xF0, 0x00, 0xFC, 0x00,
-  0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F,
-  0xC0, 0x3B, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x78, 0x03, 0xF0, 0x1F, 0xC0, 0xFF, 0x07,
-  0xF8, 0x1F, 0x80, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01,
-  0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x0F, 0x81, 0xFE, 0x0F,
-  0xF0, 0x3F, 0x80, 0xFF, 0x01, 0xFE, 0x00, 0xFC, 0x01, 0xF0, 0x07, 0xC0,
-  0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF8,
-  0x07, 0xF8, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x00, 0x78, 0x77, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xE0, 0x78, 0x03, 0xF0, 0x0F,
-  0xE0, 0x3F, 0xC0, 0x7F, 0x00, 0x7E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80,
-  0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0,
-  0x07, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0x03, 0xFC, 0x1F, 0xE0, 0xFC,
-  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E,
-  0x00, 0xF8, 0x07, 0xE0, 0x7F, 0x83, 0xFC, 0x0F, 0xF0, 0x3F, 0x80, 0x78,
-  0x00, 0x07, 0x80, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x03, 0x9F, 0xFE, 0x1F,
-  0xFF, 0xFC, 0xFF, 0xF3, 0xFF, 0xFF, 0x87, 0xFF, 0x9C, 0x0F, 0xFC, 0x00,
-  0x0F, 0xE0, 0x00, 0x1F, 0x00 };
+  0x23, 0x35, 0x1F, 0xFF, 0xB1, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x53, 0x35, 0x1F, 0xB3, 0x35, 0x1E, 0x15, 0x24, 0x20, 0x06,
+  0x36, 0x15, 0x45, 0x15, 0x45, 0x15, 0x45, 0x15, 0x45, 0x15, 0x45, 0x15,
+  0x45, 0x15, 0x45, 0x23, 0x63, 0x33, 0x63, 0x33, 0x63, 0x33, 0x63, 0x33,
+  0x63, 0x33, 0x63, 0x10, 0x73, 0x53, 0xA5, 0x35, 0x95, 0x35, 0x95, 0x35,
+  0x95, 0x35, 0x95, 0x35, 0x86, 0x35, 0x85, 0x45, 0x85, 0x35, 0x95, 0x35,
+  0x6F, 0x42, 0xF6, 0x1F, 0x61, 0xF6, 0x2F, 0x46, 0x53, 0x59, 0x53, 0x59,
+  0x53, 0x59, 0x53, 0x55, 0xF4, 0x2F, 0x61, 0xF6, 0x1F, 0x62, 0xF4, 0x65,
+  0x35, 0x95, 0x35, 0x95, 0x35, 0x95, 0x35, 0x95, 0x35, 0x95, 0x35, 0x95,
+  0x35, 0x95, 0x35, 0x95, 0x35, 0x94, 0x44, 0x60, 0x83, 0xF0, 0x5E, 0x5E,
+  0x5E, 0x5B, 0xD5, 0xF0, 0x3F, 0x12, 0xF2, 0x17, 0x56, 0x16, 0x75, 0x15,
+  0x94, 0x15, 0x93, 0x26, 0xDB, 0x9D, 0x7E, 0x6E, 0x8C, 0xB8, 0xE9, 0xB8,
+  0xB9, 0xAA, 0x8C, 0x66, 0x1F, 0x31, 0xF2, 0x2F, 0x13, 0x31, 0xBB, 0x5E,
+  0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x03, 0x80, 0x45, 0xF0, 0x8B, 0xBA,
+  0x44, 0x39, 0x45, 0x48, 0x37, 0x38, 0x37, 0x38, 0x37, 0x38, 0x45, 0x49,
+  0x44, 0x3A, 0xBB, 0x95, 0x54, 0x54, 0x7A, 0xA8, 0xA8, 0xA8, 0xAB, 0x65,
+  0x55, 0x36, 0x8C, 0xAB, 0x43, 0x49, 0x45, 0x48, 0x37, 0x38, 0x37, 0x38,
+  0x37, 0x38, 0x45, 0x49, 0x34, 0x4A, 0xBB, 0x8F, 0x05, 0x50, 0x85, 0xEB,
+  0x9C, 0x8D, 0x8D, 0x76, 0x33, 0x95, 0x51, 0xA5, 0xF1, 0x5F, 0x16, 0xF1,
+  0x6F, 0x06, 0xF0, 0x7D, 0x9B, 0xA3, 0x52, 0xC2, 0x61, 0x61, 0xF4, 0x2C,
+  0x15, 0x4A, 0x25, 0x58, 0x35, 0x58, 0x35, 0x67, 0x36, 0x59, 0x2F, 0x51,
+  0xF5, 0x2F, 0x43, 0xF2, 0x67, 0x90, 0x06, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x10, 0x72, 0x74, 0x55,
+  0x46, 0x46, 0x36, 0x46, 0x36, 0x45, 0x55, 0x45, 0x55, 0x55, 0x55, 0x45,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55,
+  0x65, 0x55, 0x56, 0x55, 0x56, 0x55, 0x56, 0x55, 0x55, 0x64, 0x12, 0x74,
+  0x65, 0x56, 0x46, 0x56, 0x55, 0x56, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55,
+  0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55,
+  0x55, 0x45, 0x55, 0x46, 0x45, 0x46, 0x45, 0x46, 0x45, 0x55, 0x54, 0x60,
+  0x93, 0xF2, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xA1, 0x55, 0x51, 0x35, 0x25,
+  0x25, 0x1F, 0xFC, 0x1F, 0x44, 0xF0, 0x99, 0xC9, 0xBB, 0x96, 0x16, 0x86,
+  0x16, 0x76, 0x36, 0x65, 0x55, 0x73, 0x73, 0x40, 0xA3, 0xF4, 0x5F, 0x35,
+  0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5A, 0xF6,
+  0x1F, 0xFF, 0xF9, 0x1F, 0x6A, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F,
+  0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF4, 0x3A, 0x36, 0x35, 0x45,
+  0x35, 0x45, 0x44, 0x45, 0x44, 0x54, 0x53, 0x54, 0x53, 0x63, 0x62, 0x70,
+  0x1F, 0x71, 0xFF, 0xFF, 0xC1, 0xF7, 0x10, 0x15, 0x1F, 0xD1, 0x51, 0xF2,
+  0x2F, 0x24, 0xF0, 0x5F, 0x05, 0xF0, 0x5E, 0x5F, 0x05, 0xE5, 0xF0, 0x5E,
+  0x5F, 0x05, 0xE5, 0xF0, 0x5E, 0x5F, 0x05, 0xE5, 0xF0, 0x5E, 0x6E, 0x5E,
+  0x6E, 0x5E, 0x6E, 0x5F, 0x05, 0xE5, 0xF0, 0x5E, 0x5F, 0x05, 0xE5, 0xF0,
+  0x5E, 0x5F, 0x05, 0xE5, 0xF0, 0x5E, 0x6E, 0x5F, 0x05, 0xF0, 0x4F, 0x10,
+  0x77, 0xCB, 0x9D, 0x7F, 0x05, 0xF2, 0x46, 0x56, 0x36, 0x76, 0x25, 0x95,
+  0x25, 0x95, 0x15, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+  0xBA, 0xBA, 0xBA, 0xB5, 0x15, 0x95, 0x25, 0x95, 0x26, 0x76, 0x36, 0x56,
+  0x4F, 0x25, 0xF0, 0x7D, 0x9B, 0xC7, 0x70, 0x76, 0xD7, 0xB9, 0xAA, 0x8C,
+  0x77, 0x15, 0x76, 0x25, 0x83, 0x45, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05,
+  0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05,
+  0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0x9F, 0x22, 0xF4, 0x1F, 0x41, 0xF4,
+  0x2F, 0x21, 0x77, 0xCB, 0x8F, 0x05, 0xF2, 0x3F, 0x42, 0x66, 0x71, 0x69,
+  0xBB, 0xAB, 0x51, 0x3C, 0x5F, 0x15, 0xF0, 0x6E, 0x6E, 0x7D, 0x7D, 0x7D,
+  0x7D, 0x7D, 0x6D, 0x7D, 0x7D, 0x7D, 0x7D, 0x69, 0x31, 0x79, 0xFF, 0xFF,
+  0xFF, 0xF5, 0x67, 0xBD, 0x7F, 0x05, 0xF2, 0x3F, 0x42, 0x67, 0x63, 0x3A,
+  0x6F, 0x15, 0xF1, 0x5F, 0x15, 0xF0, 0x6E, 0x6A, 0xAA, 0xAB, 0x9C, 0xAC,
+  0xAF, 0x07, 0xF1, 0x6F, 0x16, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF0,
+  0xB8, 0x71, 0xF5, 0x1F, 0x43, 0xF2, 0x5F, 0x09, 0x97, 0xA7, 0xD7, 0xC8,
+  0xC8, 0xB9, 0xAA, 0xA4, 0x15, 0x95, 0x15, 0x94, 0x25, 0x85, 0x25, 0x75,
+  0x35, 0x74, 0x45, 0x65, 0x45, 0x64, 0x55, 0x55, 0x55, 0x45, 0x65, 0x44,
+  0x75, 0x3F, 0x41, 0xFF, 0xFF, 0xF4, 0xD5, 0xCA, 0x9C, 0x8C, 0x8C, 0x9A,
+  0x10, 0x2F, 0x15, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x15, 0x5F, 0x15, 0xF1,
+  0x5F, 0x15, 0xF1, 0x5F, 0x15, 0x16, 0x9F, 0x06, 0xF1, 0x5F, 0x24, 0xF2,
+  0x54, 0x67, 0xF1, 0x5F, 0x16, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1,
+  0x5F, 0x0A, 0xA6, 0x16, 0x77, 0x1F, 0x42, 0xF4, 0x3F, 0x25, 0xEA, 0x97,
+  0xB7, 0xAC, 0x7D, 0x5F, 0x04, 0xF0, 0x49, 0xB7, 0xC6, 0xD6, 0xE6, 0xE5,
+  0xE5, 0x36, 0x65, 0x29, 0x4F, 0x23, 0xF3, 0x2F, 0x32, 0x84, 0x71, 0x77,
+  0x51, 0x68, 0xBA, 0xAA, 0xAA, 0xAA, 0x51, 0x58, 0x61, 0x67, 0x62, 0x65,
+  0x63, 0xF2, 0x4F, 0x06, 0xD8, 0xBB, 0x76, 0x0F, 0xFF, 0xFF, 0xFE, 0xB9,
+  0xA5, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05,
+  0xE5, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05,
+  0xE5, 0xF0, 0x5F, 0x05, 0xF0, 0x4F, 0x14, 0xF2, 0x29, 0x76, 0xBC, 0x7E,
+  0x5F, 0x13, 0xF3, 0x26, 0x66, 0x16, 0x8B, 0xAA, 0xAA, 0xAA, 0xA5, 0x15,
+  0x85, 0x26, 0x66, 0x3F, 0x16, 0xC8, 0xC7, 0xE5, 0xF1, 0x37, 0x47, 0x25,
+  0x85, 0x15, 0xAA, 0xAA, 0xAA, 0xAB, 0x86, 0x16, 0x66, 0x2F, 0x33, 0xF1,
+  0x5E, 0x7C, 0xA8, 0x60, 0x67, 0xBB, 0x8E, 0x5F, 0x04, 0xF2, 0x36, 0x57,
+  0x16, 0x85, 0x15, 0x95, 0x15, 0xAA, 0xAA, 0xAA, 0x9C, 0x77, 0x16, 0x58,
+  0x1F, 0x42, 0xF3, 0x3F, 0x24, 0x92, 0x56, 0x63, 0x5E, 0x6E, 0x5E, 0x6D,
+  0x6D, 0x7C, 0x7B, 0x85, 0xE5, 0xE6, 0xD7, 0xCA, 0x7B, 0x15, 0x1F, 0xD1,
+  0x5F, 0xFF, 0xFC, 0x51, 0xFD, 0x15, 0x10, 0x45, 0x47, 0x37, 0x37, 0x37,
+  0x45, 0xFF, 0xFF, 0xFF, 0x56, 0x36, 0x46, 0x45, 0x46, 0x45, 0x54, 0x64,
+  0x54, 0x64, 0x63, 0x73, 0x72, 0x70, 0xF6, 0x1F, 0x64, 0xF3, 0x7F, 0x08,
+  0xE9, 0xD9, 0xD9, 0xD9, 0xDA, 0xCA, 0xCA, 0xDB, 0xF1, 0xAF, 0x1A, 0xF1,
+  0xAF, 0x1A, 0xF1, 0xAF, 0x19, 0xF2, 0x8F, 0x37, 0xF4, 0x41, 0x1F, 0x71,
+  0xFF, 0xFF, 0xC1, 0xF7, 0xFF, 0xFF, 0xFF, 0x8F, 0x71, 0xFF, 0xFF, 0xC1,
+  0xF7, 0x10, 0xF8, 0x4F, 0x46, 0xF2, 0x8F, 0x19, 0xF1, 0x9F, 0x19, 0xF1,
+  0x9F, 0x19, 0xF0, 0xAF, 0x0A, 0xEA, 0xB9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9,
+  0xD8, 0xF0, 0x6F, 0x24, 0xFF, 0xC0, 0x67, 0xAD, 0x4F, 0x23, 0xF3, 0x2F,
+  0x41, 0x67, 0x61, 0x59, 0xBA, 0x51, 0x3B, 0x5F, 0x05, 0xE6, 0xD6, 0xB9,
+  0x9A, 0x99, 0xC6, 0xE4, 0xF1, 0x4F, 0x22, 0xFF, 0xFF, 0xFF, 0x65, 0xE7,
+  0xD7, 0xD7, 0xD7, 0xE5, 0x80, 0x75, 0xC9, 0x9B, 0x7D, 0x55, 0x55, 0x44,
+  0x83, 0x34, 0x94, 0x23, 0xB3, 0x23, 0xB3, 0x14, 0xB3, 0x13, 0x96, 0x13,
+  0x78, 0x13, 0x69, 0x13, 0x5A, 0x13, 0x46, 0x23, 0x13, 0x44, 0x43, 0x13,
+  0x34, 0x53, 0x13, 0x33, 0x63, 0x13, 0x33, 0x63, 0x13, 0x33, 0x63, 0x13,
+  0x34, 0x53, 0x13, 0x44, 0x43, 0x13, 0x4B, 0x13, 0x5E, 0x6D, 0x87, 0x14,
+  0xF1, 0x3F, 0x13, 0xF1, 0x4F, 0x14, 0x92, 0x45, 0x65, 0x4F, 0x04, 0xE7,
+  0xB9, 0x76, 0x5C, 0xF1, 0xEF, 0x0E, 0xF0, 0xF0, 0xF0, 0xEF, 0x59, 0xF4,
+  0x51, 0x5F, 0x35, 0x15, 0xF3, 0x51, 0x6F, 0x15, 0x35, 0xF1, 0x53, 0x5F,
+  0x05, 0x55, 0xE5, 0x55, 0xE4, 0x66, 0xC5, 0x75, 0xCF, 0x2B, 0xF4, 0xAF,
+  0x49, 0xF6, 0x8F, 0x68, 0x5B, 0x57, 0x5D, 0x54, 0xA7, 0xA1, 0xC5, 0xF9,
+  0x5F, 0x95, 0xC1, 0xA7, 0xA1, 0x1F, 0x28, 0xF5, 0x6F, 0x74, 0xF8, 0x4F,
+  0x76, 0x59, 0x75, 0x5B, 0x55, 0x5B, 0x55, 0x5B, 0x55, 0x5A, 0x65, 0x59,
+  0x66, 0xF4, 0x7F, 0x38, 0xF4, 0x7F, 0x56, 0xF6, 0x55, 0xA7, 0x45, 0xC6,
+  0x35, 0xD5, 0x35, 0xD5, 0x35, 0xD5, 0x35, 0xC6, 0x1F, 0x91, 0xFA, 0x1F,
+  0x92, 0xF8, 0x4F, 0x46, 0x97, 0xF1, 0xB2, 0x37, 0xF4, 0x5F, 0x54, 0xF6,
+  0x38, 0x68, 0x36, 0x97, 0x26, 0xB6, 0x25, 0xD5, 0x16, 0xD5, 0x15, 0xF0,
+  0x32, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55,
+  0xF5, 0x6F, 0x55, 0xF5, 0x6E, 0x32, 0x7B, 0x53, 0x87, 0x83, 0xF6, 0x5F,
+  0x56, 0xF2, 0xAE, 0xD9, 0x70, 0x1F, 0x09, 0xF4, 0x6F, 0x55, 0xF6, 0x5F,
+  0x65, 0x58, 0x84, 0x5A, 0x64, 0x5B, 0x63, 0x5C, 0x53, 0x5C, 0x62, 0x5D,
+  0x52, 0x5D, 0x52, 0x5D, 0x52, 0x5D, 0x52, 0x5D, 0x52, 0x5D, 0x52, 0x5D,
+  0x52, 0x5D, 0x52, 0x5C, 0x62, 0x5C, 0x53, 0x5B, 0x63, 0x59, 0x73, 0xF7,
+  0x2F, 0x73, 0xF6, 0x4F, 0x47, 0xF1, 0x80, 0x1F, 0x81, 0xF9, 0x1F, 0x91,
+  0xF9, 0x2F, 0x84, 0x5B, 0x54, 0x5B, 0x54, 0x55, 0x33, 0x54, 0x54, 0x52,
+  0x54, 0x54, 0x53, 0x35, 0x54, 0x5B, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0x54,
+  0x5B, 0x54, 0x54, 0x34, 0x55, 0x34, 0x53, 0x5C, 0x53, 0x5C, 0x53, 0x5C,
+  0x51, 0xFF, 0xFF, 0xFF, 0x91, 0xF9, 0x1F, 0xFF, 0xFF, 0xF9, 0x1F, 0x93,
+  0x5C, 0x53, 0x5C, 0x53, 0x5C, 0x53, 0x55, 0x34, 0x53, 0x54, 0x54, 0x34,
+  0x54, 0x5B, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0x54, 0x5B, 0x54, 0x5B, 0x54,
+  0x5B, 0x55, 0x3C, 0x5F, 0x55, 0xF3, 0xDB, 0xF0, 0xAF, 0x0A, 0xF0, 0xBD,
+  0xB0, 0x98, 0x33, 0x9C, 0x14, 0x6F, 0x45, 0xF5, 0x4F, 0x63, 0x87, 0x73,
+  0x6A, 0x62, 0x6C, 0x52, 0x5D, 0x51, 0x6E, 0x32, 0x5F, 0x55, 0xF5, 0x5F,
+  0x55, 0xF5, 0x5F, 0x55, 0x8B, 0x15, 0x7F, 0x37, 0xF3, 0x7F, 0x38, 0xF3,
+  0xD5, 0x26, 0xC5, 0x27, 0xB5, 0x38, 0x77, 0x3F, 0x74, 0xF6, 0x5F, 0x48,
+  0xF0, 0xD9, 0x70, 0x29, 0x49, 0x3B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x39,
+  0x49, 0x55, 0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65,
+  0xA5, 0x6F, 0x56, 0xF5, 0x6F, 0x56, 0xF5, 0x6F, 0x56, 0x5A, 0x56, 0x5A,
+  0x56, 0x5A, 0x56, 0x5A, 0x56, 0x5A, 0x56, 0x5A, 0x54, 0xA4, 0xA1, 0xC2,
+  0xF9, 0x2F, 0x92, 0xC1, 0xA4, 0xA1, 0x1F, 0x21, 0xFF, 0xFC, 0x1F, 0x28,
+  0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+  0x5E, 0x5E, 0x5E, 0x5E, 0x58, 0xF2, 0x1F, 0xFF, 0xC1, 0xF2, 0x10, 0x8F,
+  0x18, 0xF3, 0x7F, 0x37, 0xF3, 0x8F, 0x1F, 0x15, 0xF5, 0x5F, 0x55, 0xF5,
+  0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x56, 0x3B, 0x55,
+  0x5A, 0x55, 0x5A, 0x55, 0x5A, 0x55, 0x5A, 0x55, 0x5A, 0x55, 0x59, 0x65,
+  0x75, 0x76, 0xF4, 0x6F, 0x38, 0xF1, 0xBD, 0xF0, 0x7C, 0x1A, 0x59, 0x2C,
+  0x3B, 0x1C, 0x3B, 0x1C, 0x3B, 0x2A, 0x59, 0x55, 0x86, 0x85, 0x67, 0x95,
+  0x57, 0xA5, 0x47, 0xB5, 0x37, 0xC5, 0x17, 0xEC, 0xF0, 0xDE, 0xED, 0xF0,
+  0xC7, 0x27, 0xB6, 0x47, 0xA5, 0x66, 0xA5, 0x76, 0x95, 0x86, 0x85, 0x86,
+  0x85, 0x95, 0x6A, 0x69, 0x1C, 0x6F, 0x66, 0xF6, 0x69, 0x1A, 0x87, 0x10,
+  0x1D, 0xBF, 0x0A, 0xF0, 0xAF, 0x0B, 0xDF, 0x15, 0xF5, 0x5F, 0x55, 0xF5,
+  0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xB3,
+  0x65, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5,
+  0x1F, 0xFF, 0xFF, 0xF9, 0x1F, 0x90, 0x27, 0xD7, 0x39, 0xB9, 0x29, 0xB9,
+  0x2A, 0x9A, 0x39, 0x99, 0x59, 0x79, 0x69, 0x79, 0x6A, 0x5A, 0x6A, 0x5A,
+  0x6A, 0x5A, 0x65, 0x15, 0x35, 0x15, 0x65, 0x15, 0x35, 0x15, 0x65, 0x16,
+  0x16, 0x15, 0x65, 0x25, 0x15, 0x25, 0x65, 0x2B, 0x25, 0x65, 0x39, 0x35,
+  0x65, 0x39, 0x35, 0x65, 0x48, 0x35, 0x65, 0x47, 0x45, 0x65, 0x56, 0x45,
+  0x65, 0xF0, 0x56, 0x5F, 0x05, 0x4A, 0x9A, 0x1C, 0x7F, 0x97, 0xF9, 0x7C,
+  0x1A, 0x9A, 0x10, 0x17, 0x9A, 0x19, 0x7F, 0x76, 0xF7, 0x6C, 0x1A, 0x6A,
+  0x49, 0x85, 0x69, 0x85, 0x6A, 0x75, 0x6B, 0x65, 0x6B, 0x65, 0x65, 0x16,
+  0x55, 0x65, 0x26, 0x45, 0x65, 0x26, 0x45, 0x65, 0x36, 0x35, 0x65, 0x46,
+  0x25, 0x65, 0x46, 0x25, 0x65, 0x56, 0x15, 0x65, 0x6B, 0x65, 0x6B, 0x65,
+  0x7A, 0x65, 0x89, 0x65, 0x89, 0x4A, 0x68, 0x3C, 0x67, 0x3C, 0x67, 0x3C,
+  0x76, 0x4A, 0x95, 0x30, 0xA7, 0xF2, 0xCE, 0xF0, 0xBF, 0x29, 0xF4, 0x78,
+  0x58, 0x57, 0x97, 0x46, 0xB6, 0x36, 0xD6, 0x25, 0xF0, 0x51, 0x6F, 0x0B,
+  0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xBF, 0x06,
+  0x15, 0xF0, 0x52, 0x6D, 0x63, 0x6B, 0x64, 0x79, 0x75, 0x85, 0x87, 0xF4,
+  0x9F, 0x2B, 0xF0, 0xDD, 0xF2, 0x7A, 0x1F, 0x17, 0xF5, 0x4F, 0x63, 0xF7,
+  0x3F, 0x74, 0x58, 0x74, 0x5A, 0x63, 0x5B, 0x53, 0x5B, 0x53, 0x5B, 0x53,
+  0x5B, 0x53, 0x5A, 0x63, 0x59, 0x64, 0xF5, 0x4F, 0x45, 0xF3, 0x6F, 0x27,
+  0xEA, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF2, 0xDA, 0xF0, 0x9F, 0x09, 0xF0,
+  0xAD, 0xA0, 0xA7, 0xF2, 0xCE, 0xF0, 0xBF, 0x29, 0xF4, 0x78, 0x58, 0x57,
+  0x97, 0x46, 0xB6, 0x36, 0xD6, 0x25, 0xF0, 0x51, 0x6F, 0x0B, 0xF2, 0xAF,
+  0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2B, 0xF0, 0x61, 0x5F, 0x05, 0x26,
+  0xD6, 0x27, 0xB6, 0x47, 0x97, 0x58, 0x58, 0x6F, 0x59, 0xF2, 0xBF, 0x0D,
+  0xDF, 0x09, 0xF3, 0x4F, 0x7B, 0x44, 0x7F, 0x65, 0xF7, 0x5F, 0x66, 0xF5,
+  0x84, 0x76, 0x40, 0x1F, 0x1B, 0xF5, 0x8F, 0x67, 0xF7, 0x7F, 0x79, 0x58,
+  0x69, 0x59, 0x68, 0x5A, 0x58, 0x5A, 0x58, 0x5A, 0x58, 0x59, 0x68, 0x57,
+  0x79, 0xF4, 0x9F, 0x3A, 0xF1, 0xCF, 0x0D, 0xF1, 0xC5, 0x57, 0xB5, 0x67,
+  0xA5, 0x77, 0x95, 0x86, 0x95, 0x96, 0x5B, 0x78, 0x1D, 0x6F, 0x77, 0xF6,
+  0x87, 0x1B, 0x96, 0x10, 0x77, 0x33, 0x7B, 0x14, 0x5F, 0x24, 0xF3, 0x3F,
+  0x43, 0x66, 0x72, 0x68, 0x62, 0x5A, 0x52, 0x5A, 0x52, 0x5B, 0x33, 0x7F,
+  0x19, 0xDE, 0x9F, 0x08, 0xF1, 0x8E, 0xDA, 0xF1, 0x6F, 0x26, 0x13, 0xDA,
+  0xCA, 0xCB, 0xAE, 0x67, 0x1F, 0x61, 0xF5, 0x2F, 0x44, 0x32, 0xCC, 0x77,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFA, 0x55, 0x5A, 0x55, 0x5A, 0x55, 0x5A, 0x55,
+  0x5A, 0x55, 0x5A, 0x55, 0x55, 0x13, 0x65, 0x63, 0xB5, 0xF5, 0x5F, 0x55,
+  0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x1D,
+  0xBF, 0x0A, 0xF0, 0xAF, 0x0B, 0xD6, 0x1A, 0x6A, 0x1C, 0x4F, 0x94, 0xF9,
+  0x4C, 0x1A, 0x6A, 0x45, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65,
+  0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65,
+  0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x65, 0xC5, 0x66, 0xA6, 0x75,
+  0xA5, 0x87, 0x67, 0x9F, 0x3B, 0xF2, 0xCE, 0xF0, 0xCF, 0x38, 0xA0, 0x1A,
+  0x8A, 0x1C, 0x6F, 0x96, 0xF9, 0x6C, 0x1A, 0x8A, 0x45, 0xE5, 0x75, 0xC5,
+  0x85, 0xC5, 0x95, 0xA5, 0xA5, 0xA5, 0xA6, 0x95, 0xB5, 0x85, 0xC6, 0x75,
+  0xD5, 0x65, 0xE5, 0x65, 0xE6, 0x45, 0xF1, 0x54, 0x5F, 0x16, 0x26, 0xF2,
+  0x52, 0x5F, 0x36, 0x15, 0xF4, 0xAF, 0x5A, 0xF5, 0x9F, 0x78, 0xF7, 0x8F,
+  0x86, 0xF9, 0x6C, 0x1A, 0x6A, 0x1C, 0x4F, 0x94, 0xF9, 0x4C, 0x1A, 0x6A,
+  0x35, 0xF0, 0x44, 0x55, 0x55, 0x44, 0x54, 0x65, 0x44, 0x54, 0x64, 0x54,
+  0x54, 0x73, 0x54, 0x53, 0x83, 0x55, 0x43, 0x83, 0x55, 0x52, 0x92, 0x55,
+  0x51, 0xA2, 0x46, 0x51, 0xA2, 0x46, 0x51, 0x42, 0xA6, 0xA2, 0xA6, 0xA2,
+  0xA7, 0x92, 0xA7, 0x84, 0x97, 0x84, 0x97, 0x84, 0x88, 0x76, 0x78, 0x76,
+  0x78, 0x76, 0x78, 0x68, 0x69, 0x58, 0x64, 0x18, 0x78, 0x2A, 0x5A, 0x1A,
+  0x5A, 0x1A, 0x5A, 0x28, 0x78, 0x56, 0x76, 0x86, 0x65, 0xA6, 0x45, 0xC6,
+  0x25, 0xDD, 0xEB, 0xF1, 0x9F, 0x37, 0xF4, 0x7F, 0x47, 0xF3, 0x9F, 0x1B,
+  0xE6, 0x25, 0xC6, 0x36, 0xA6, 0x56, 0x86, 0x76, 0x76, 0x85, 0x59, 0x69,
+  0x1B, 0x4F, 0x74, 0xF7, 0x4B, 0x19, 0x69, 0x10, 0x18, 0x88, 0x1A, 0x6F,
+  0x56, 0xF5, 0x6A, 0x18, 0x88, 0x46, 0x86, 0x76, 0x75, 0x95, 0x65, 0xB5,
+  0x46, 0xB6, 0x35, 0xD6, 0x15, 0xF0, 0xBF, 0x19, 0xF2, 0x8F, 0x47, 0xF5,
+  0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x2D, 0xCF,
+  0x0B, 0xF0, 0xBF, 0x0C, 0xD6, 0x1F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F,
+  0x42, 0x57, 0x63, 0x57, 0x63, 0x56, 0x64, 0x55, 0x65, 0x54, 0x67, 0x34,
+  0x6E, 0x7E, 0x6E, 0x6E, 0x6E, 0x6E, 0x76, 0x35, 0x66, 0x53, 0x67, 0x52,
+  0x68, 0x51, 0x69, 0xC9, 0xFF, 0xFF, 0xFF, 0xF5, 0x09, 0x1F, 0xF9, 0x15,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x59, 0x1F, 0xF9, 0x10, 0x12, 0xF2, 0x4F, 0x15, 0xF0, 0x5F,
+  0x15, 0xF0, 0x5F, 0x06, 0xF0, 0x5F, 0x06, 0xF0, 0x5F, 0x05, 0xF1, 0x5F,
+  0x05, 0xF1, 0x5F, 0x05, 0xF1, 0x5F, 0x05, 0xF1, 0x5F, 0x05, 0xF1, 0x5F,
+  0x05, 0xF1, 0x5F, 0x05, 0xF0, 0x6F, 0x05, 0xF0, 0x6F, 0x05, 0xF0, 0x6F,
+  0x05, 0xF0, 0x5F, 0x15, 0xF0, 0x5F, 0x15, 0xF0, 0x5F, 0x15, 0xF0, 0x5F,
+  0x14, 0xF1, 0x40, 0x1F, 0xF9, 0x19, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x1F, 0xF9, 0x19,
+  0x91, 0xF4, 0x2F, 0x24, 0xF0, 0x6D, 0x8B, 0xA9, 0xC8, 0xD6, 0x62, 0x65,
+  0x64, 0x63, 0x66, 0x61, 0x68, 0xBA, 0xAB, 0x41, 0x3D, 0x21, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x50, 0x03, 0x64, 0x55, 0x56, 0x46, 0x55, 0x54, 0x62,
+  0x10, 0x79, 0xCE, 0x9F, 0x18, 0xF2, 0x8F, 0x2F, 0x36, 0xF4, 0x5F, 0x45,
+  0xAE, 0x8F, 0x16, 0xF3, 0x5F, 0x44, 0xF5, 0x47, 0x85, 0x36, 0xA5, 0x35,
+  0xB5, 0x35, 0x97, 0x36, 0x6B, 0x1F, 0x91, 0xF8, 0x2F, 0x73, 0xC1, 0x76,
+  0x7C, 0x17, 0xF4, 0x8F, 0x48, 0xF4, 0x8F, 0x57, 0xF7, 0x5F, 0x75, 0xF7,
+  0x5F, 0x75, 0x47, 0xB5, 0x1C, 0x9F, 0x57, 0xF6, 0x6F, 0x75, 0x96, 0x75,
+  0x7A, 0x64, 0x6C, 0x54, 0x6C, 0x63, 0x5E, 0x53, 0x5E, 0x53, 0x5E, 0x53,
+  0x5E, 0x53, 0x5E, 0x53, 0x6C, 0x63, 0x6C, 0x54, 0x7A, 0x62, 0xB6, 0x72,
+  0xFA, 0x2F, 0x93, 0xF8, 0x57, 0x2B, 0xF3, 0x78, 0x88, 0x32, 0x9F, 0x16,
+  0xF3, 0x5F, 0x44, 0xF5, 0x47, 0x67, 0x36, 0xA5, 0x35, 0xB5, 0x26, 0xC4,
+  0x25, 0xD3, 0x35, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x46, 0xF4, 0x5F, 0x02,
+  0x26, 0xC5, 0x18, 0x87, 0x2F, 0x73, 0xF5, 0x5F, 0x37, 0xF1, 0xBA, 0x60,
+  0xF1, 0x7F, 0x38, 0xF3, 0x8F, 0x38, 0xF4, 0x7F, 0x65, 0xF6, 0x5F, 0x65,
+  0xB7, 0x35, 0x9B, 0x15, 0x7F, 0x46, 0xF5, 0x5F, 0x64, 0x85, 0x94, 0x69,
+  0x74, 0x5B, 0x63, 0x6B, 0x63, 0x5D, 0x53, 0x5D, 0x53, 0x5D, 0x53, 0x5D,
+  0x53, 0x5D, 0x53, 0x6B, 0x64, 0x5B, 0x64, 0x69, 0x75, 0x76, 0xA3, 0xF9,
+  0x3F, 0x84, 0xF7, 0x6B, 0x17, 0x96, 0xC0, 0x87, 0xF0, 0xCA, 0xF0, 0x8F,
+  0x26, 0xF4, 0x48, 0x67, 0x36, 0xA6, 0x16, 0xC5, 0x15, 0xD5, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xF5, 0xF4, 0x6F, 0x46, 0xF3, 0x88, 0x63, 0xF7, 0x3F, 0x64,
+  0xF4, 0x6F, 0x1B, 0x97, 0xA9, 0xBD, 0x8F, 0x06, 0xF1, 0x5F, 0x16, 0x6F,
+  0x15, 0xF2, 0x5F, 0x25, 0xDF, 0x24, 0xF4, 0x3F, 0x43, 0xF4, 0x4F, 0x29,
+  0x5F, 0x25, 0xF2, 0x5F, 0x25, 0xF2, 0x5F, 0x25, 0xF2, 0x5F, 0x25, 0xF2,
+  0x5F, 0x25, 0xF2, 0x5D, 0xF2, 0x4F, 0x43, 0xF4, 0x3F, 0x44, 0xF2, 0x40,
+  0x86, 0xF1, 0xB1, 0x75, 0xF6, 0x3F, 0x72, 0xF8, 0x18, 0x4B, 0x26, 0x87,
+  0x45, 0xA6, 0x36, 0xA6, 0x35, 0xC5, 0x35, 0xC5, 0x35, 0xC5, 0x35, 0xC5,
+  0x35, 0xC5, 0x36, 0xA6, 0x45, 0xA6, 0x46, 0x87, 0x48, 0x49, 0x5F, 0x56,
+  0xF4, 0x7F, 0x38, 0xB1, 0x5A, 0x73, 0x5F, 0x55, 0xF4, 0x6F, 0x37, 0x9F,
+  0x09, 0xF1, 0x9F, 0x0A, 0xDD, 0xA9, 0x17, 0xF3, 0x8F, 0x38, 0xF3, 0x8F,
+  0x47, 0xF6, 0x5F, 0x65, 0xF6, 0x5F, 0x65, 0x46, 0xB5, 0x2A, 0x95, 0x1C,
+  0x8F, 0x47, 0xF4, 0x79, 0x56, 0x67, 0x85, 0x66, 0x95, 0x65, 0xA5, 0x65,
+  0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65, 0xA5, 0x65,
+  0xA5, 0x65, 0xA5, 0x49, 0x69, 0x1B, 0x4F, 0x74, 0xF7, 0x4B, 0x19, 0x69,
+  0x10, 0x75, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xFF, 0xFF, 0xF0, 0xAA,
+  0xBA, 0xBA, 0xBB, 0xAF, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1,
+  0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0x9F, 0x41, 0xFF, 0xFF,
+  0x31, 0xF4, 0x10, 0x95, 0xC5, 0xC5, 0xC5, 0xC5, 0xFF, 0xFA, 0xFF, 0xFF,
+  0x71, 0xF1, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xB6, 0xA7, 0x1F, 0x01,
+  0xF0, 0x2F, 0x02, 0xD5, 0xA6, 0x17, 0xF2, 0x8F, 0x28, 0xF2, 0x8F, 0x37,
+  0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0x54, 0x97, 0x53, 0xB6, 0x53,
+  0xB6, 0x53, 0xB6, 0x54, 0x97, 0x52, 0x7B, 0x51, 0x7C, 0xCD, 0xBE, 0xAF,
+  0x0B, 0xEC, 0xDD, 0xC5, 0x27, 0xB5, 0x37, 0xA5, 0x47, 0x77, 0x6A, 0x18,
+  0x5F, 0x55, 0xF5, 0x5C, 0x17, 0x6A, 0x10, 0x3A, 0xAB, 0xAB, 0xAB, 0xBA,
+  0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15,
+  0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15,
+  0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0x9F, 0x41, 0xFF, 0xFF, 0x31, 0xF4,
+  0x10, 0xA4, 0x55, 0x86, 0x17, 0x28, 0x5F, 0xB4, 0xFB, 0x4F, 0xC4, 0x83,
+  0x64, 0x55, 0x64, 0x64, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x53, 0x84,
+  0x64, 0x61, 0xA3, 0x73, 0xF2, 0x37, 0x3F, 0x23, 0x73, 0x71, 0x84, 0x64,
+  0x61, 0xB6, 0xA6, 0x2A, 0x67, 0x1C, 0x5F, 0x64, 0xF6, 0x59, 0x57, 0x57,
+  0x76, 0x56, 0x95, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55,
+  0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x39, 0x68, 0x1B,
+  0x4F, 0x64, 0xF6, 0x4A, 0x19, 0x68, 0x10, 0x97, 0xF0, 0xDB, 0xF0, 0x8F,
+  0x45, 0xF5, 0x58, 0x58, 0x37, 0x97, 0x26, 0xB6, 0x16, 0xDB, 0xF0, 0xAF,
+  0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xBD, 0x61, 0x5C, 0x62, 0x79, 0x73, 0x76,
+  0x85, 0xF4, 0x6F, 0x48, 0xF0, 0xBD, 0xF0, 0x79, 0xD6, 0xB7, 0x2B, 0x78,
+  0x1D, 0x6F, 0x94, 0xFA, 0x4B, 0x58, 0x67, 0x97, 0x56, 0xB6, 0x56, 0xC6,
+  0x45, 0xE5, 0x45, 0xE5, 0x45, 0xE5, 0x45, 0xE5, 0x45, 0xD6, 0x46, 0xC6,
+  0x47, 0xA6, 0x59, 0x68, 0x5F, 0x76, 0xF6, 0x7F, 0x58, 0x52, 0xBA, 0x54,
+  0x7C, 0x5F, 0x85, 0xF8, 0x5F, 0x85, 0xF5, 0xCF, 0x0E, 0xEE, 0xEE, 0xF0,
+  0xCF, 0x00, 0x96, 0xF4, 0xB2, 0x76, 0xE1, 0x84, 0xF9, 0x3F, 0xA3, 0x76,
+  0xB3, 0x79, 0x75, 0x5C, 0x64, 0x6C, 0x64, 0x5E, 0x54, 0x5E, 0x54, 0x5E,
+  0x54, 0x5E, 0x54, 0x6D, 0x54, 0x6C, 0x65, 0x6A, 0x75, 0x86, 0x96, 0xF7,
+  0x7F, 0x68, 0xF5, 0xAB, 0x25, 0xC7, 0x45, 0xF8, 0x5F, 0x85, 0xF8, 0x5F,
+  0x85, 0xF4, 0xCF, 0x0E, 0xEE, 0xEE, 0xF0, 0xC1, 0xF0, 0x56, 0x83, 0x93,
+  0x92, 0xB2, 0x91, 0xD1, 0xF8, 0x2E, 0x43, 0x69, 0xF0, 0x8F, 0x17, 0xF2,
+  0x6F, 0x35, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF0,
+  0xF2, 0x6F, 0x45, 0xF4, 0x5F, 0x46, 0xF2, 0x60, 0x68, 0x32, 0x6F, 0x14,
+  0xF2, 0x3F, 0x32, 0xF4, 0x26, 0x76, 0x25, 0x95, 0x26, 0x93, 0x3B, 0xAF,
+  0x07, 0xF1, 0x6F, 0x18, 0xEC, 0xA1, 0x3B, 0xAC, 0xAB, 0xC7, 0xFC, 0x1F,
+  0x51, 0xF4, 0x3F, 0x1B, 0x86, 0x53, 0xF4, 0x5F, 0x35, 0xF3, 0x5F, 0x35,
+  0xF3, 0x5F, 0x0F, 0x34, 0xF5, 0x3F, 0x53, 0xF5, 0x4F, 0x38, 0x5F, 0x35,
+  0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35,
+  0xF3, 0x5A, 0x35, 0x67, 0x64, 0xF4, 0x5F, 0x35, 0xF2, 0x8D, 0xC8, 0x60,
+  0x17, 0x78, 0x28, 0x69, 0x28, 0x69, 0x28, 0x69, 0x37, 0x78, 0x55, 0xA5,
+  0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xA5,
+  0x55, 0xA5, 0x55, 0xA5, 0x55, 0x96, 0x56, 0x77, 0x57, 0x59, 0x5F, 0x64,
+  0xF6, 0x5C, 0x17, 0x6A, 0x26, 0xA6, 0xA0, 0x1A, 0x6A, 0x1C, 0x4F, 0x94,
+  0xF9, 0x4C, 0x1A, 0x6A, 0x55, 0xA5, 0x86, 0x95, 0x95, 0x85, 0xA6, 0x75,
+  0xB5, 0x65, 0xC6, 0x55, 0xD5, 0x45, 0xE6, 0x35, 0xF0, 0x52, 0x5F, 0x16,
+  0x15, 0xF2, 0xAF, 0x3A, 0xF4, 0x8F, 0x58, 0xF6, 0x7F, 0x66, 0xB0, 0x18,
+  0xA8, 0x1A, 0x8F, 0x58, 0xF5, 0x8A, 0x18, 0xA8, 0x45, 0x45, 0x45, 0x55,
+  0x36, 0x45, 0x55, 0x36, 0x36, 0x55, 0x37, 0x25, 0x75, 0x18, 0x25, 0x75,
+  0x18, 0x16, 0x75, 0x1E, 0x8F, 0x59, 0x91, 0x99, 0x82, 0x99, 0x82, 0x8A,
+  0x74, 0x7B, 0x64, 0x7B, 0x65, 0x6B, 0x56, 0x5C, 0x57, 0x46, 0x28, 0x68,
+  0x3A, 0x4A, 0x2A, 0x4A, 0x2A, 0x4A, 0x38, 0x68, 0x67, 0x47, 0x97, 0x27,
+  0xBE, 0xDC, 0xF0, 0x9F, 0x38, 0xF1, 0xBE, 0xDC, 0xF1, 0x97, 0x47, 0x77,
+  0x67, 0x49, 0x69, 0x1B, 0x4F, 0x74, 0xF7, 0x4B, 0x19, 0x69, 0x10, 0x18,
+  0x88, 0x1A, 0x6F, 0x56, 0xF5, 0x6A, 0x18, 0x88, 0x36, 0xB4, 0x65, 0xA5,
+  0x66, 0x85, 0x85, 0x85, 0x86, 0x65, 0xA5, 0x65, 0xB5, 0x45, 0xC5, 0x45,
+  0xD5, 0x25, 0xEC, 0xF0, 0xAF, 0x1A, 0xF2, 0x8F, 0x37, 0xF5, 0x6F, 0x55,
+  0xF5, 0x6F, 0x55, 0xF5, 0x6F, 0x55, 0xEE, 0xBF, 0x1A, 0xF1, 0xAF, 0x1B,
+  0xEB, 0x0F, 0xFF, 0xFF, 0xFA, 0x67, 0x15, 0x56, 0x43, 0x56, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x83, 0x16, 0x8F, 0xFF, 0xFF, 0xF9, 0x94,
+  0x96, 0x77, 0x68, 0x58, 0x66, 0x85, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x85, 0x68, 0x58, 0x67, 0x78, 0x78, 0x96, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x96, 0x88, 0x78, 0x68, 0x77, 0x94,
+  0x10, 0x13, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0x31, 0x14, 0x96,
+  0x87, 0x78, 0x77, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0xA5, 0x98, 0x78, 0x77, 0x68, 0x58, 0x56, 0x85, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x86, 0x68, 0x58, 0x68, 0x67, 0x84, 0x90,
+  0x54, 0xF1, 0x8D, 0xA6, 0x32, 0xC4, 0xF4, 0x2C, 0x2F, 0x44, 0xC2, 0x36,
+  0xAE, 0x7F, 0x15, 0x40 };
 
 const GFXglyph FreeMonoBold24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  28,    0,    1 },   // 0x20 ' '
   {     0,   7,  31,  28,   10,  -29 },   // 0x21 '!'
-  {    28,  15,  14,  28,    6,  -28 },   // 0x22 '"'
-  {    55,  22,  34,  28,    3,  -30 },   // 0x23 '#'
-  {   149,  19,  38,  28,    5,  -31 },   // 0x24 '$'
-  {   240,  21,  30,  28,    4,  -28 },   // 0x25 '%'
-  {   319,  21,  28,  28,    4,  -26 },   // 0x26 '&'
-  {   393,   6,  14,  28,   11,  -28 },   // 0x27 '''
-  {   404,  10,  37,  28,   12,  -29 },   // 0x28 '('
-  {   451,  10,  37,  28,    6,  -29 },   // 0x29 ')'
-  {   498,  21,  19,  28,    4,  -28 },   // 0x2A '*'
-  {   548,  23,  26,  28,    3,  -25 },   // 0x2B '+'
-  {   623,   9,  14,  28,    7,   -6 },   // 0x2C ','
-  {   639,  24,   5,  28,    2,  -15 },   // 0x2D '-'
-  {   654,   7,   6,  28,   11,   -4 },   // 0x2E '.'
-  {   660,  20,  38,  28,    4,  -32 },   // 0x2F '/'
-  {   755,  21,  31,  28,    4,  -29 },   // 0x30 '0'
-  {   837,  20,  29,  28,    4,  -28 },   // 0x31 '1'
-  {   910,  21,  30,  28,    3,  -29 },   // 0x32 '2'
-  {   989,  21,  31,  28,    4,  -29 },   // 0x33 '3'
-  {  1071,  20,  28,  28,    4,  -27 },   // 0x34 '4'
-  {  1141,  21,  31,  28,    4,  -29 },   // 0x35 '5'
-  {  1223,  20,  31,  28,    5,  -29 },   // 0x36 '6'
-  {  1301,  20,  30,  28,    4,  -29 },   // 0x37 '7'
-  {  1376,  20,  31,  28,    4,  -29 },   // 0x38 '8'
-  {  1454,  20,  31,  28,    5,  -29 },   // 0x39 '9'
-  {  1532,   7,  22,  28,   11,  -20 },   // 0x3A ':'
-  {  1552,  10,  28,  28,    6,  -20 },   // 0x3B ';'
-  {  1587,  24,  21,  28,    2,  -23 },   // 0x3C '<'
-  {  1650,  24,  14,  28,    2,  -19 },   // 0x3D '='
-  {  1692,  23,  22,  28,    3,  -23 },   // 0x3E '>'
-  {  1756,  20,  29,  28,    5,  -27 },   // 0x3F '?'
-  {  1829,  19,  36,  28,    4,  -28 },   // 0x40 '@'
-  {  1915,  29,  27,  28,   -1,  -26 },   // 0x41 'A'
-  {  2013,  26,  27,  28,    1,  -26 },   // 0x42 'B'
-  {  2101,  25,  29,  28,    2,  -27 },   // 0x43 'C'
-  {  2192,  25,  27,  28,    1,  -26 },   // 0x44 'D'
-  {  2277,  25,  27,  28,    1,  -26 },   // 0x45 'E'
-  {  2362,  25,  27,  28,    1,  -26 },   // 0x46 'F'
-  {  2447,  25,  29,  28,    2,  -27 },   // 0x47 'G'
-  {  2538,  26,  27,  28,    1,  -26 },   // 0x48 'H'
-  {  2626,  19,  27,  28,    5,  -26 },   // 0x49 'I'
-  {  2691,  25,  28,  28,    3,  -26 },   // 0x4A 'J'
-  {  2779,  27,  27,  28,    1,  -26 },   // 0x4B 'K'
-  {  2871,  25,  27,  28,    2,  -26 },   // 0x4C 'L'
-  {  2956,  31,  27,  28,   -1,  -26 },   // 0x4D 'M'
-  {  3061,  28,  27,  28,    0,  -26 },   // 0x4E 'N'
-  {  3156,  27,  29,  28,    1,  -27 },   // 0x4F 'O'
-  {  3254,  24,  27,  28,    1,  -26 },   // 0x50 'P'
-  {  3335,  27,  35,  28,    1,  -27 },   // 0x51 'Q'
-  {  3454,  28,  27,  28,    0,  -26 },   // 0x52 'R'
-  {  3549,  22,  29,  28,    3,  -27 },   // 0x53 'S'
-  {  3629,  25,  27,  28,    2,  -26 },   // 0x54 'T'
-  {  3714,  28,  28,  28,    0,  -26 },   // 0x55 'U'
-  {  3812,  30,  27,  28,   -1,  -26 },   // 0x56 'V'
-  {  3914,  28,  27,  28,    0,  -26 },   // 0x57 'W'
-  {  4009,  26,  27,  28,    1,  -26 },   // 0x58 'X'
-  {  4097,  26,  27,  28,    1,  -26 },   // 0x59 'Y'
-  {  4185,  21,  27,  28,    4,  -26 },   // 0x5A 'Z'
-  {  4256,  10,  37,  28,   12,  -29 },   // 0x5B '['
-  {  4303,  20,  38,  28,    4,  -32 },   // 0x5C '\'
-  {  4398,  10,  37,  28,    6,  -29 },   // 0x5D ']'
-  {  4445,  20,  15,  28,    4,  -29 },   // 0x5E '^'
-  {  4483,  28,   5,  28,    0,    5 },   // 0x5F '_'
-  {  4501,   9,   8,  28,    8,  -30 },   // 0x60 '`'
-  {  4510,  24,  23,  28,    2,  -21 },   // 0x61 'a'
-  {  4579,  27,  31,  28,    0,  -29 },   // 0x62 'b'
-  {  4684,  24,  23,  28,    3,  -21 },   // 0x63 'c'
-  {  4753,  26,  31,  28,    2,  -29 },   // 0x64 'd'
-  {  4854,  24,  23,  28,    2,  -21 },   // 0x65 'e'
-  {  4923,  22,  30,  28,    4,  -29 },   // 0x66 'f'
-  {  5006,  25,  31,  28,    2,  -21 },   // 0x67 'g'
-  {  5103,  26,  30,  28,    1,  -29 },   // 0x68 'h'
-  {  5201,  21,  29,  28,    4,  -28 },   // 0x69 'i'
-  {  5278,  17,  38,  28,    5,  -28 },   // 0x6A 'j'
-  {  5359,  25,  30,  28,    2,  -29 },   // 0x6B 'k'
-  {  5453,  21,  30,  28,    4,  -29 },   // 0x6C 'l'
-  {  5532,  30,  22,  28,   -1,  -21 },   // 0x6D 'm'
-  {  5615,  25,  22,  28,    1,  -21 },   // 0x6E 'n'
-  {  5684,  25,  23,  28,    2,  -21 },   // 0x6F 'o'
-  {  5756,  28,  31,  28,    0,  -21 },   // 0x70 'p'
-  {  5865,  28,  31,  28,    1,  -21 },   // 0x71 'q'
-  {  5974,  24,  22,  28,    3,  -21 },   // 0x72 'r'
-  {  6040,  21,  23,  28,    4,  -21 },   // 0x73 's'
-  {  6101,  23,  28,  28,    1,  -26 },   // 0x74 't'
-  {  6182,  25,  22,  28,    1,  -20 },   // 0x75 'u'
-  {  6251,  28,  21,  28,    0,  -20 },   // 0x76 'v'
-  {  6325,  28,  21,  28,    0,  -20 },   // 0x77 'w'
-  {  6399,  26,  21,  28,    1,  -20 },   // 0x78 'x'
-  {  6468,  26,  30,  28,    1,  -20 },   // 0x79 'y'
-  {  6566,  19,  21,  28,    5,  -20 },   // 0x7A 'z'
-  {  6616,  14,  37,  28,    7,  -29 },   // 0x7B '{'
-  {  6681,   5,  36,  28,   12,  -28 },   // 0x7C '|'
-  {  6704,  14,  37,  28,    8,  -29 },   // 0x7D '}'
-  {  6769,  22,  10,  28,    3,  -17 } }; // 0x7E '~'
+  {    23,  15,  14,  28,    6,  -28 },   // 0x22 '"'
+  {    52,  22,  34,  28,    3,  -30 },   // 0x23 '#'
+  {   116,  19,  38,  28,    5,  -31 },   // 0x24 '$'
+  {   164,  21,  30,  28,    4,  -28 },   // 0x25 '%'
+  {   214,  21,  28,  28,    4,  -26 },   // 0x26 '&'
+  {   258,   6,  14,  28,   11,  -28 },   // 0x27 '''
+  {   273,  10,  37,  28,   12,  -29 },   // 0x28 '('
+  {   310,  10,  37,  28,    6,  -29 },   // 0x29 ')'
+  {   348,  21,  19,  28,    4,  -28 },   // 0x2A '*'
+  {   380,  23,  26,  28,    3,  -25 },   // 0x2B '+'
+  {   417,   9,  14,  28,    7,   -6 },   // 0x2C ','
+  {   432,  24,   5,  28,    2,  -15 },   // 0x2D '-'
+  {   439,   7,   6,  28,   11,   -4 },   // 0x2E '.'
+  {   443,  20,  38,  28,    4,  -32 },   // 0x2F '/'
+  {   492,  21,  31,  28,    4,  -29 },   // 0x30 '0'
+  {   535,  20,  29,  28,    4,  -28 },   // 0x31 '1'
+  {   578,  21,  30,  28,    3,  -29 },   // 0x32 '2'
+  {   614,  21,  31,  28,    4,  -29 },   // 0x33 '3'
+  {   657,  20,  28,  28,    4,  -27 },   // 0x34 '4'
+  {   697,  21,  31,  28,    4,  -29 },   // 0x35 '5'
+  {   744,  20,  31,  28,    5,  -29 },   // 0x36 '6'
+  {   787,  20,  30,  28,    4,  -29 },   // 0x37 '7'
+  {   825,  20,  31,  28,    4,  -29 },   // 0x38 '8'
+  {   868,  20,  31,  28,    5,  -29 },   // 0x39 '9'
+  {   909,   7,  22,  28,   11,  -20 },   // 0x3A ':'
+  {   919,  10,  28,  28,    6,  -20 },   // 0x3B ';'
+  {   942,  24,  21,  28,    2,  -23 },   // 0x3C '<'
+  {   970,  24,  14,  28,    2,  -19 },   // 0x3D '='
+  {   986,  23,  22,  28,    3,  -23 },   // 0x3E '>'
+  {  1014,  20,  29,  28,    5,  -27 },   // 0x3F '?'
+  {  1049,  19,  36,  28,    4,  -28 },   // 0x40 '@'
+  {  1118,  29,  27,  28,   -1,  -26 },   // 0x41 'A'
+  {  1169,  26,  27,  28,    1,  -26 },   // 0x42 'B'
+  {  1216,  25,  29,  28,    2,  -27 },   // 0x43 'C'
+  {  1265,  25,  27,  28,    1,  -26 },   // 0x44 'D'
+  {  1315,  25,  27,  28,    1,  -26 },   // 0x45 'E'
+  {  1362,  25,  27,  28,    1,  -26 },   // 0x46 'F'
+  {  1405,  25,  29,  28,    2,  -27 },   // 0x47 'G'
+  {  1455,  26,  27,  28,    1,  -26 },   // 0x48 'H'
+  {  1506,  19,  27,  28,    5,  -26 },   // 0x49 'I'
+  {  1535,  25,  28,  28,    3,  -26 },   // 0x4A 'J'
+  {  1581,  27,  27,  28,    1,  -26 },   // 0x4B 'K'
+  {  1632,  25,  27,  28,    2,  -26 },   // 0x4C 'L'
+  {  1674,  31,  27,  28,   -1,  -26 },   // 0x4D 'M'
+  {  1743,  28,  27,  28,    0,  -26 },   // 0x4E 'N'
+  {  1804,  27,  29,  28,    1,  -27 },   // 0x4F 'O'
+  {  1854,  24,  27,  28,    1,  -26 },   // 0x50 'P'
+  {  1898,  27,  35,  28,    1,  -27 },   // 0x51 'Q'
+  {  1959,  28,  27,  28,    0,  -26 },   // 0x52 'R'
+  {  2008,  22,  29,  28,    3,  -27 },   // 0x53 'S'
+  {  2052,  25,  27,  28,    2,  -26 },   // 0x54 'T'
+  {  2094,  28,  28,  28,    0,  -26 },   // 0x55 'U'
+  {  2147,  30,  27,  28,   -1,  -26 },   // 0x56 'V'
+  {  2199,  28,  27,  28,    0,  -26 },   // 0x57 'W'
+  {  2263,  26,  27,  28,    1,  -26 },   // 0x58 'X'
+  {  2312,  26,  27,  28,    1,  -26 },   // 0x59 'Y'
+  {  2357,  21,  27,  28,    4,  -26 },   // 0x5A 'Z'
+  {  2396,  10,  37,  28,   12,  -29 },   // 0x5B '['
+  {  2430,  20,  38,  28,    4,  -32 },   // 0x5C '\'
+  {  2487,  10,  37,  28,    6,  -29 },   // 0x5D ']'
+  {  2520,  20,  15,  28,    4,  -29 },   // 0x5E '^'
+  {  2542,  28,   5,  28,    0,    5 },   // 0x5F '_'
+  {  2548,   9,   8,  28,    8,  -30 },   // 0x60 '`'
+  {  2557,  24,  23,  28,    2,  -21 },   // 0x61 'a'
+  {  2593,  27,  31,  28,    0,  -29 },   // 0x62 'b'
+  {  2648,  24,  23,  28,    3,  -21 },   // 0x63 'c'
+  {  2688,  26,  31,  28,    2,  -29 },   // 0x64 'd'
+  {  2743,  24,  23,  28,    2,  -21 },   // 0x65 'e'
+  {  2776,  22,  30,  28,    4,  -29 },   // 0x66 'f'
+  {  2820,  25,  31,  28,    2,  -21 },   // 0x67 'g'
+  {  2874,  26,  30,  28,    1,  -29 },   // 0x68 'h'
+  {  2929,  21,  29,  28,    4,  -28 },   // 0x69 'i'
+  {  2967,  17,  38,  28,    5,  -28 },   // 0x6A 'j'
+  {  3005,  25,  30,  28,    2,  -29 },   // 0x6B 'k'
+  {  3055,  21,  30,  28,    4,  -29 },   // 0x6C 'l'
+  {  3097,  30,  22,  28,   -1,  -21 },   // 0x6D 'm'
+  {  3157,  25,  22,  28,    1,  -21 },   // 0x6E 'n'
+  {  3199,  25,  23,  28,    2,  -21 },   // 0x6F 'o'
+  {  3236,  28,  31,  28,    0,  -21 },   // 0x70 'p'
+  {  3290,  28,  31,  28,    1,  -21 },   // 0x71 'q'
+  {  3344,  24,  22,  28,    3,  -21 },   // 0x72 'r'
+  {  3380,  21,  23,  28,    4,  -21 },   // 0x73 's'
+  {  3413,  23,  28,  28,    1,  -26 },   // 0x74 't'
+  {  3456,  25,  22,  28,    1,  -20 },   // 0x75 'u'
+  {  3499,  28,  21,  28,    0,  -20 },   // 0x76 'v'
+  {  3539,  28,  21,  28,    0,  -20 },   // 0x77 'w'
+  {  3586,  26,  21,  28,    1,  -20 },   // 0x78 'x'
+  {  3623,  26,  30,  28,    1,  -20 },   // 0x79 'y'
+  {  3673,  19,  21,  28,    5,  -20 },   // 0x7A 'z'
+  {  3695,  14,  37,  28,    7,  -29 },   // 0x7B '{'
+  {  3733,   5,  36,  28,   12,  -28 },   // 0x7C '|'
+  {  3742,  14,  37,  28,    8,  -29 },   // 0x7D '}'
+  {  3780,  22,  10,  28,    3,  -17 } }; // 0x7E '~'
 
 const GFXfont FreeMonoBold24pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold24pt7bBitmaps,
   (GFXglyph *)FreeMonoBold24pt7bGlyphs,
-  0x20, 0x7E, 47 };
+  0x20, 0x7E, 47, 1,
+  NULL, 0, 1 };
 
-// Approx. 7469 bytes
+// Approx. 4468 bytes
@@ -1,398 +1,348 @@
 const uint8_t FreeMonoOblique18pt7bBitmaps[] PROGMEM = {
-  0x00, 0x1C, 0x38, 0x70, 0xC1, 0x83, 0x06, 0x18, 0x30, 0x60, 0xC1, 0x02,
-  0x04, 0x00, 0x00, 0x01, 0xC7, 0x8F, 0x1C, 0x00, 0x78, 0x7B, 0xC3, 0xFC,
-  0x3D, 0xE1, 0xEF, 0x0F, 0x70, 0x73, 0x83, 0x98, 0x18, 0xC0, 0xC6, 0x06,
-  0x00, 0x00, 0x8C, 0x01, 0x18, 0x06, 0x20, 0x08, 0x40, 0x11, 0x80, 0x62,
-  0x00, 0xC4, 0x01, 0x18, 0x02, 0x30, 0x7F, 0xFC, 0x10, 0x80, 0x23, 0x00,
-  0xC4, 0x01, 0x88, 0x3F, 0xFF, 0x04, 0x60, 0x18, 0x80, 0x21, 0x00, 0x46,
-  0x01, 0x88, 0x03, 0x10, 0x04, 0x60, 0x08, 0xC0, 0x31, 0x00, 0x00, 0x30,
-  0x00, 0x20, 0x00, 0x20, 0x00, 0xF9, 0x03, 0x0F, 0x06, 0x03, 0x04, 0x03,
-  0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x03, 0xC0, 0x00, 0x78,
-  0x00, 0x0C, 0x00, 0x04, 0x00, 0x04, 0x40, 0x04, 0x40, 0x08, 0x40, 0x18,
-  0xF0, 0x60, 0x9F, 0x80, 0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x04, 0x00,
-  0x04, 0x00, 0x03, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x10, 0x20, 0x10, 0x20,
-  0x10, 0x40, 0x18, 0x80, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x78, 0x07, 0xC0,
-  0x3C, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x02, 0x18, 0x04, 0x08, 0x08, 0x08,
-  0x08, 0x08, 0x08, 0x10, 0x0C, 0x20, 0x07, 0xC0, 0x01, 0xF0, 0x11, 0x81,
-  0x00, 0x10, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x80, 0x04, 0x00, 0xF0,
-  0x09, 0x86, 0x84, 0x48, 0x32, 0x40, 0xA2, 0x07, 0x10, 0x30, 0x43, 0x81,
-  0xE7, 0x80, 0x7B, 0xFD, 0xEF, 0x73, 0x98, 0xC6, 0x00, 0x01, 0x02, 0x06,
-  0x0C, 0x0C, 0x18, 0x10, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0xC0,
-  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x60, 0x60, 0x20, 0x04, 0x06,
-  0x06, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06,
-  0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x18, 0x10, 0x30, 0x60, 0x40, 0xC0, 0x01,
-  0x00, 0x04, 0x00, 0x10, 0x00, 0xC6, 0xE3, 0xF8, 0x7E, 0x00, 0x70, 0x03,
-  0x40, 0x19, 0x80, 0xC2, 0x06, 0x0C, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x02,
-  0x00, 0x04, 0x00, 0x08, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0xFF, 0xFE,
-  0x02, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x02,
-  0x00, 0x04, 0x00, 0x0F, 0x87, 0x87, 0x83, 0x83, 0xC1, 0xC1, 0xC0, 0xC0,
-  0xE0, 0x60, 0x00, 0xFF, 0xFF, 0x77, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x60,
-  0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x04, 0x00,
-  0x01, 0x80, 0x00, 0x60, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00,
-  0x10, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x20, 0x00, 0x0C, 0x00, 0x03,
-  0x00, 0x00, 0x40, 0x00, 0x18, 0x00, 0x06, 0x00, 0x00, 0x80, 0x00, 0x20,
-  0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x08, 0x00, 0x00, 0x01,
-  0xF0, 0x18, 0x60, 0x80, 0x86, 0x01, 0x10, 0x04, 0x80, 0x12, 0x00, 0x50,
-  0x01, 0x40, 0x0D, 0x00, 0x24, 0x00, 0xA0, 0x02, 0x80, 0x1A, 0x00, 0x48,
-  0x01, 0x20, 0x0C, 0x80, 0x22, 0x01, 0x84, 0x0C, 0x18, 0x60, 0x3E, 0x00,
-  0x00, 0x60, 0x07, 0x00, 0x68, 0x06, 0x40, 0xE4, 0x04, 0x20, 0x01, 0x00,
-  0x08, 0x00, 0x40, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04,
-  0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x0F, 0xFF, 0x80, 0x00,
-  0x3C, 0x00, 0x61, 0x80, 0x40, 0x40, 0x40, 0x10, 0x60, 0x08, 0x00, 0x04,
-  0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x07,
-  0x00, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00, 0x0C,
-  0x00, 0x1C, 0x01, 0x1C, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0xFC, 0x03, 0x06,
-  0x06, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02,
-  0x00, 0x0C, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02,
-  0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x40, 0x18, 0x70, 0x30,
-  0x0F, 0xC0, 0x00, 0x1C, 0x00, 0xD0, 0x06, 0x80, 0x32, 0x00, 0x88, 0x04,
-  0x20, 0x30, 0x81, 0x84, 0x04, 0x10, 0x20, 0x41, 0x81, 0x0C, 0x08, 0x60,
-  0x21, 0x00, 0x8F, 0xFF, 0x80, 0x18, 0x00, 0x40, 0x01, 0x00, 0x04, 0x00,
-  0x10, 0x07, 0xE0, 0x03, 0xFF, 0x03, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00,
-  0x40, 0x00, 0x20, 0x00, 0x30, 0x00, 0x1B, 0xE0, 0x0E, 0x0C, 0x00, 0x02,
-  0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00,
-  0x08, 0x00, 0x04, 0x60, 0x04, 0x18, 0x04, 0x06, 0x0C, 0x00, 0xF8, 0x00,
-  0x00, 0x3F, 0x00, 0xC0, 0x03, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00,
-  0x30, 0x00, 0x20, 0x00, 0x40, 0x00, 0x43, 0xE0, 0x4C, 0x30, 0xB0, 0x18,
-  0xE0, 0x08, 0xC0, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x10, 0xC0, 0x10,
-  0x40, 0x20, 0x20, 0xC0, 0x1F, 0x00, 0xFF, 0xFC, 0x00, 0xE0, 0x04, 0x00,
-  0x60, 0x02, 0x00, 0x30, 0x01, 0x00, 0x18, 0x00, 0x80, 0x0C, 0x00, 0x40,
-  0x06, 0x00, 0x20, 0x03, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0xC0, 0x04,
-  0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0xF0, 0x06, 0x18, 0x10, 0x18, 0x40,
-  0x11, 0x00, 0x22, 0x00, 0x44, 0x00, 0x88, 0x02, 0x18, 0x08, 0x18, 0x60,
-  0x1F, 0x80, 0xC1, 0x82, 0x01, 0x88, 0x01, 0x20, 0x02, 0x40, 0x04, 0x80,
-  0x09, 0x00, 0x23, 0x00, 0x83, 0x06, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x06,
-  0x18, 0x10, 0x10, 0x40, 0x30, 0x80, 0x22, 0x00, 0x44, 0x00, 0x88, 0x03,
-  0x10, 0x0E, 0x30, 0x34, 0x30, 0xD0, 0x3E, 0x20, 0x00, 0x40, 0x01, 0x00,
-  0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0xC0, 0x02, 0x00, 0x18, 0x0F, 0xC0,
-  0x00, 0x1C, 0x7C, 0xF9, 0xF1, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xC7, 0xCF,
-  0x9F, 0x1C, 0x00, 0x01, 0xC0, 0x7C, 0x0F, 0x81, 0xF0, 0x1C, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0x81, 0xE0, 0x3C, 0x0F, 0x01,
-  0xC0, 0x70, 0x0E, 0x03, 0x80, 0x60, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80,
-  0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00,
-  0xE0, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x07,
-  0x00, 0x00, 0xE0, 0x00, 0x38, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x18, 0x00, 0x03, 0x80,
-  0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x00, 0xE0,
-  0x00, 0x0E, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
-  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x1F, 0xCE, 0x06, 0x80,
-  0x38, 0x01, 0x80, 0x10, 0x01, 0x00, 0x20, 0x04, 0x01, 0x80, 0xF0, 0x18,
-  0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0F, 0x80, 0xF8,
-  0x07, 0x00, 0x01, 0xF0, 0x0C, 0x30, 0x30, 0x30, 0x40, 0x21, 0x00, 0x44,
-  0x00, 0x88, 0x01, 0x10, 0x1E, 0x40, 0xC4, 0x86, 0x11, 0x08, 0x22, 0x20,
-  0x48, 0x40, 0x90, 0x82, 0x21, 0x84, 0x40, 0xFC, 0x80, 0x01, 0x00, 0x02,
-  0x00, 0x04, 0x00, 0x04, 0x00, 0x0C, 0x18, 0x07, 0xC0, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x68, 0x00, 0x06, 0x40, 0x00, 0x32, 0x00, 0x03, 0x10, 0x00,
-  0x10, 0x80, 0x01, 0x84, 0x00, 0x18, 0x10, 0x00, 0xC0, 0x80, 0x0C, 0x04,
-  0x00, 0x60, 0x20, 0x06, 0x01, 0x00, 0x3F, 0xFC, 0x02, 0x00, 0x20, 0x10,
-  0x01, 0x01, 0x00, 0x08, 0x08, 0x00, 0x40, 0x80, 0x02, 0x0C, 0x00, 0x09,
-  0xFC, 0x07, 0xF0, 0x0F, 0xFF, 0x00, 0x40, 0x60, 0x20, 0x0C, 0x08, 0x01,
-  0x02, 0x00, 0x40, 0x80, 0x10, 0x40, 0x08, 0x10, 0x06, 0x04, 0x03, 0x01,
-  0xFF, 0x80, 0x40, 0x38, 0x20, 0x02, 0x08, 0x00, 0x42, 0x00, 0x10, 0x80,
-  0x04, 0x40, 0x01, 0x10, 0x00, 0x84, 0x00, 0x41, 0x00, 0x23, 0xFF, 0xF0,
-  0x00, 0xFC, 0x40, 0xC1, 0xF0, 0xC0, 0x1C, 0x60, 0x06, 0x10, 0x00, 0x88,
-  0x00, 0x24, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x30, 0x00, 0x08, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x00, 0x20, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00,
-  0x40, 0x06, 0x08, 0x03, 0x01, 0x83, 0x80, 0x3F, 0x00, 0x0F, 0xFE, 0x00,
-  0x80, 0xC0, 0x20, 0x18, 0x10, 0x02, 0x04, 0x00, 0x41, 0x00, 0x10, 0x40,
-  0x04, 0x20, 0x01, 0x08, 0x00, 0x42, 0x00, 0x10, 0x80, 0x08, 0x20, 0x02,
-  0x10, 0x00, 0x84, 0x00, 0x21, 0x00, 0x10, 0x40, 0x08, 0x20, 0x06, 0x08,
-  0x03, 0x02, 0x01, 0x83, 0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x10, 0x02, 0x02,
-  0x00, 0x60, 0x20, 0x06, 0x02, 0x00, 0x60, 0x20, 0x00, 0x04, 0x00, 0x00,
-  0x40, 0x80, 0x04, 0x10, 0x00, 0x7F, 0x00, 0x04, 0x10, 0x00, 0x81, 0x00,
-  0x08, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x81, 0x00, 0x08, 0x10, 0x00,
-  0x81, 0x00, 0x18, 0x10, 0x01, 0x8F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x10,
-  0x03, 0x02, 0x00, 0x30, 0x20, 0x03, 0x02, 0x00, 0x20, 0x20, 0x00, 0x04,
-  0x00, 0x00, 0x40, 0x80, 0x04, 0x10, 0x00, 0x7F, 0x00, 0x04, 0x10, 0x00,
-  0x81, 0x00, 0x08, 0x00, 0x00, 0x80, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00,
-  0x10, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFE,
-  0x40, 0xC0, 0xF0, 0x40, 0x1C, 0x20, 0x03, 0x10, 0x00, 0x88, 0x00, 0x02,
-  0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x08, 0x00, 0x02, 0x01,
-  0xFE, 0x80, 0x02, 0x20, 0x00, 0x88, 0x00, 0x22, 0x00, 0x08, 0x40, 0x04,
-  0x18, 0x01, 0x03, 0x81, 0xC0, 0x3F, 0x80, 0x07, 0xE1, 0xF8, 0x08, 0x02,
-  0x00, 0x80, 0x10, 0x04, 0x00, 0x80, 0x20, 0x04, 0x01, 0x00, 0x20, 0x18,
-  0x02, 0x00, 0x80, 0x10, 0x04, 0x00, 0x80, 0x3F, 0xFC, 0x01, 0x00, 0x60,
-  0x10, 0x02, 0x00, 0x80, 0x10, 0x04, 0x00, 0x80, 0x20, 0x04, 0x02, 0x00,
-  0x40, 0x10, 0x02, 0x00, 0x80, 0x10, 0x04, 0x00, 0x81, 0xF8, 0x3F, 0x00,
-  0x0F, 0xFF, 0x80, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02,
-  0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00,
-  0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00,
-  0x01, 0x00, 0x00, 0x80, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x20,
-  0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x20, 0x00, 0x04,
-  0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x0C, 0x04, 0x00,
-  0x80, 0x40, 0x08, 0x08, 0x00, 0x80, 0x80, 0x08, 0x08, 0x01, 0x00, 0x80,
-  0x10, 0x0C, 0x02, 0x00, 0x60, 0xC0, 0x01, 0xF0, 0x00, 0x0F, 0xE1, 0xF8,
-  0x08, 0x03, 0x00, 0x80, 0x60, 0x04, 0x06, 0x00, 0x20, 0x60, 0x01, 0x06,
-  0x00, 0x10, 0xC0, 0x00, 0x8C, 0x00, 0x04, 0xC0, 0x00, 0x2F, 0x80, 0x01,
-  0x8E, 0x00, 0x18, 0x30, 0x00, 0x80, 0xC0, 0x04, 0x06, 0x00, 0x20, 0x10,
-  0x02, 0x00, 0xC0, 0x10, 0x06, 0x00, 0x80, 0x30, 0x04, 0x00, 0x81, 0xFC,
-  0x07, 0x80, 0x07, 0xFC, 0x00, 0x10, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00,
-  0x80, 0x00, 0x20, 0x00, 0x08, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x40,
-  0x00, 0x10, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x80, 0x10, 0x20, 0x04,
-  0x08, 0x01, 0x04, 0x00, 0x81, 0x00, 0x20, 0x40, 0x0B, 0xFF, 0xFE, 0x0F,
-  0x00, 0x1E, 0x03, 0x00, 0x38, 0x05, 0x00, 0x68, 0x04, 0x80, 0x68, 0x04,
-  0x80, 0xC8, 0x04, 0x80, 0x90, 0x04, 0x81, 0x90, 0x08, 0x43, 0x10, 0x08,
-  0x42, 0x10, 0x08, 0x46, 0x10, 0x08, 0x4C, 0x20, 0x10, 0x2C, 0x20, 0x10,
-  0x38, 0x20, 0x10, 0x30, 0x20, 0x10, 0x00, 0x40, 0x10, 0x00, 0x40, 0x20,
-  0x00, 0x40, 0x20, 0x00, 0x40, 0x20, 0x00, 0x40, 0xFC, 0x07, 0xE0, 0x1F,
-  0x01, 0xFC, 0x0C, 0x00, 0x80, 0x78, 0x02, 0x01, 0xE0, 0x18, 0x04, 0x80,
-  0x60, 0x13, 0x01, 0x00, 0x4C, 0x04, 0x03, 0x18, 0x10, 0x0C, 0x60, 0xC0,
-  0x20, 0x83, 0x00, 0x83, 0x08, 0x06, 0x0C, 0x20, 0x18, 0x18, 0x80, 0x40,
-  0x66, 0x01, 0x00, 0x98, 0x04, 0x03, 0x40, 0x30, 0x0D, 0x00, 0xC0, 0x14,
-  0x02, 0x00, 0x70, 0x3F, 0x80, 0xC0, 0x00, 0xF8, 0x01, 0x83, 0x01, 0x00,
-  0xC1, 0x00, 0x21, 0x00, 0x19, 0x00, 0x04, 0x80, 0x02, 0x80, 0x01, 0x40,
-  0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x28, 0x00, 0x14, 0x00, 0x12,
-  0x00, 0x09, 0x80, 0x08, 0x40, 0x08, 0x30, 0x08, 0x0C, 0x18, 0x01, 0xF0,
-  0x00, 0x0F, 0xFE, 0x00, 0x40, 0x60, 0x20, 0x0C, 0x08, 0x01, 0x02, 0x00,
-  0x40, 0x80, 0x10, 0x40, 0x04, 0x10, 0x02, 0x04, 0x01, 0x01, 0x01, 0x80,
-  0x7F, 0x80, 0x20, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x40,
-  0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xF8,
-  0x01, 0x83, 0x01, 0x00, 0xC1, 0x00, 0x21, 0x00, 0x19, 0x00, 0x05, 0x00,
-  0x02, 0x80, 0x01, 0x40, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x28,
-  0x00, 0x14, 0x00, 0x12, 0x00, 0x09, 0x80, 0x08, 0x40, 0x08, 0x30, 0x08,
-  0x0C, 0x18, 0x03, 0xF0, 0x00, 0xC0, 0x01, 0xC0, 0x01, 0xFE, 0x18, 0xC0,
-  0xF0, 0x0F, 0xFE, 0x00, 0x40, 0x60, 0x20, 0x0C, 0x08, 0x01, 0x02, 0x00,
-  0x40, 0x80, 0x10, 0x40, 0x04, 0x10, 0x02, 0x04, 0x01, 0x01, 0x01, 0x80,
-  0x7F, 0x80, 0x20, 0x60, 0x08, 0x0C, 0x02, 0x03, 0x80, 0x80, 0x60, 0x40,
-  0x18, 0x10, 0x03, 0x04, 0x00, 0xC1, 0x00, 0x1B, 0xF8, 0x07, 0x00, 0x7E,
-  0x40, 0x60, 0xF0, 0x20, 0x1C, 0x10, 0x02, 0x08, 0x00, 0x82, 0x00, 0x00,
-  0x80, 0x00, 0x30, 0x00, 0x06, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00,
-  0x18, 0x00, 0x01, 0x00, 0x00, 0x44, 0x00, 0x11, 0x00, 0x04, 0x40, 0x02,
-  0x38, 0x01, 0x0B, 0x81, 0x82, 0x3F, 0x80, 0x3F, 0xFF, 0xA0, 0x20, 0x50,
-  0x10, 0x28, 0x08, 0x24, 0x08, 0x10, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00,
-  0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x10, 0x00, 0x10,
-  0x00, 0x08, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x1F,
-  0xFC, 0x00, 0x7E, 0x0F, 0xC4, 0x00, 0x42, 0x00, 0x10, 0x80, 0x08, 0x20,
-  0x02, 0x08, 0x00, 0x82, 0x00, 0x21, 0x00, 0x08, 0x40, 0x04, 0x10, 0x01,
-  0x04, 0x00, 0x41, 0x00, 0x10, 0x80, 0x0C, 0x20, 0x02, 0x08, 0x00, 0x82,
-  0x00, 0x60, 0x80, 0x10, 0x10, 0x08, 0x06, 0x0C, 0x00, 0x7C, 0x00, 0xFE,
-  0x03, 0xF9, 0x80, 0x02, 0x0C, 0x00, 0x30, 0x20, 0x01, 0x01, 0x00, 0x10,
-  0x08, 0x01, 0x80, 0x60, 0x08, 0x03, 0x00, 0xC0, 0x18, 0x04, 0x00, 0x40,
-  0x60, 0x02, 0x06, 0x00, 0x10, 0x20, 0x00, 0xC3, 0x00, 0x06, 0x10, 0x00,
-  0x31, 0x80, 0x00, 0x88, 0x00, 0x04, 0x80, 0x00, 0x2C, 0x00, 0x01, 0xC0,
-  0x00, 0x0E, 0x00, 0x00, 0x7F, 0x07, 0xF2, 0x00, 0x04, 0x20, 0x00, 0xC2,
-  0x00, 0x08, 0x20, 0xC0, 0x82, 0x0C, 0x18, 0x21, 0xA1, 0x02, 0x1A, 0x10,
-  0x23, 0x23, 0x04, 0x32, 0x30, 0x46, 0x22, 0x04, 0x62, 0x60, 0x4C, 0x26,
-  0x04, 0xC2, 0x40, 0x58, 0x24, 0x05, 0x82, 0xC0, 0x70, 0x28, 0x07, 0x02,
-  0x80, 0xE0, 0x38, 0x0E, 0x03, 0x00, 0x0F, 0xC1, 0xF8, 0x30, 0x03, 0x00,
-  0xC0, 0x30, 0x06, 0x03, 0x00, 0x18, 0x10, 0x00, 0xC1, 0x00, 0x03, 0x18,
-  0x00, 0x09, 0x80, 0x00, 0x78, 0x00, 0x01, 0x80, 0x00, 0x1C, 0x00, 0x01,
-  0xA0, 0x00, 0x19, 0x80, 0x01, 0x84, 0x00, 0x18, 0x30, 0x01, 0x80, 0xC0,
-  0x08, 0x06, 0x00, 0x80, 0x18, 0x08, 0x00, 0xC1, 0xF8, 0x3F, 0x80, 0x7E,
-  0x0F, 0xC4, 0x00, 0xC1, 0x80, 0x60, 0x20, 0x30, 0x0C, 0x08, 0x03, 0x04,
-  0x00, 0x43, 0x00, 0x19, 0x80, 0x02, 0xC0, 0x00, 0xE0, 0x00, 0x10, 0x00,
-  0x04, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x20, 0x00, 0x08, 0x00, 0x02,
-  0x00, 0x01, 0x00, 0x00, 0x40, 0x03, 0xFF, 0x80, 0x0F, 0xFF, 0x86, 0x00,
-  0x82, 0x00, 0x81, 0x00, 0xC1, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0x00,
-  0xC0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-  0x60, 0x10, 0x60, 0x18, 0x20, 0x08, 0x20, 0x04, 0x20, 0x02, 0x30, 0x03,
-  0x1F, 0xFF, 0x80, 0x07, 0xE0, 0x80, 0x10, 0x02, 0x00, 0xC0, 0x18, 0x02,
-  0x00, 0x40, 0x18, 0x03, 0x00, 0x40, 0x08, 0x01, 0x00, 0x60, 0x0C, 0x01,
-  0x00, 0x20, 0x04, 0x01, 0x80, 0x30, 0x04, 0x00, 0x80, 0x10, 0x06, 0x00,
-  0xFC, 0x00, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20,
-  0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04,
-  0x02, 0x02, 0x02, 0x02, 0x00, 0x07, 0xE0, 0x0C, 0x01, 0x00, 0x20, 0x04,
-  0x01, 0x80, 0x30, 0x04, 0x00, 0x80, 0x30, 0x06, 0x00, 0x80, 0x10, 0x02,
-  0x00, 0xC0, 0x18, 0x02, 0x00, 0x40, 0x18, 0x03, 0x00, 0x40, 0x08, 0x03,
-  0x00, 0x60, 0xF8, 0x00, 0x01, 0x00, 0x1C, 0x01, 0xB0, 0x19, 0x81, 0x86,
-  0x18, 0x11, 0x80, 0xD8, 0x03, 0x80, 0x18, 0xFF, 0xFF, 0xF8, 0xC7, 0x1C,
-  0x71, 0x80, 0x03, 0xF8, 0x0C, 0x0C, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
-  0x00, 0x02, 0x07, 0xFC, 0x18, 0x0C, 0x20, 0x04, 0x40, 0x04, 0x80, 0x04,
-  0x80, 0x08, 0x80, 0x38, 0xC0, 0xE8, 0x3F, 0x0F, 0x0F, 0x00, 0x00, 0x20,
-  0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x30, 0x00, 0x04, 0x00, 0x00, 0x87,
-  0xC0, 0x13, 0x0C, 0x06, 0x80, 0x40, 0xE0, 0x0C, 0x18, 0x00, 0x82, 0x00,
-  0x10, 0xC0, 0x02, 0x10, 0x00, 0x42, 0x00, 0x08, 0x40, 0x02, 0x08, 0x00,
-  0x43, 0x80, 0x10, 0x70, 0x04, 0x09, 0x83, 0x0F, 0x1F, 0x80, 0x01, 0xFC,
-  0x83, 0x03, 0xC6, 0x00, 0xE4, 0x00, 0x22, 0x00, 0x12, 0x00, 0x01, 0x00,
-  0x01, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x18, 0x00, 0x64,
-  0x00, 0x61, 0x81, 0xC0, 0x7F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x30, 0x00,
-  0x0C, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x60, 0x3F, 0x18, 0x10, 0x64,
-  0x18, 0x0D, 0x08, 0x01, 0xC2, 0x00, 0x71, 0x00, 0x0C, 0x80, 0x02, 0x20,
-  0x00, 0x88, 0x00, 0x62, 0x00, 0x18, 0x80, 0x0E, 0x20, 0x03, 0x04, 0x03,
-  0x40, 0xC1, 0xB0, 0x1F, 0x8F, 0x00, 0x01, 0xF0, 0x0E, 0x0C, 0x18, 0x06,
-  0x30, 0x02, 0x60, 0x01, 0x40, 0x01, 0xC0, 0x01, 0xFF, 0xFF, 0x80, 0x00,
-  0x80, 0x00, 0x80, 0x00, 0x40, 0x00, 0x60, 0x06, 0x30, 0x1C, 0x0F, 0xE0,
-  0x00, 0x1F, 0xE0, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x40, 0x00, 0x08, 0x00,
-  0x02, 0x00, 0x07, 0xFF, 0xC0, 0x08, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00,
-  0x08, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x00, 0x80, 0x00,
-  0x20, 0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x04, 0x00, 0x0F,
-  0xFF, 0x00, 0x03, 0xE3, 0xE1, 0x83, 0x60, 0x40, 0x38, 0x10, 0x03, 0x04,
-  0x00, 0x60, 0x80, 0x0C, 0x20, 0x01, 0x84, 0x00, 0x20, 0x80, 0x04, 0x10,
-  0x01, 0x82, 0x00, 0x30, 0x60, 0x0C, 0x04, 0x02, 0x80, 0x61, 0x90, 0x07,
-  0xC6, 0x00, 0x00, 0xC0, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00,
-  0x30, 0x00, 0x0C, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x40, 0x00,
-  0x10, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x23, 0xE0, 0x0B,
-  0x0C, 0x05, 0x00, 0x81, 0x80, 0x20, 0x40, 0x08, 0x10, 0x02, 0x08, 0x00,
-  0x82, 0x00, 0x60, 0x80, 0x18, 0x20, 0x06, 0x10, 0x01, 0x84, 0x00, 0x61,
-  0x00, 0x30, 0x40, 0x0C, 0xFC, 0x1F, 0xC0, 0x00, 0x30, 0x00, 0x60, 0x00,
-  0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x20,
-  0x00, 0x40, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00,
-  0x40, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x10, 0x1F, 0xFF,
-  0x80, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xFE, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20,
-  0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x20, 0x00,
-  0x40, 0x00, 0x80, 0x01, 0x00, 0x06, 0x00, 0x08, 0x00, 0x10, 0x00, 0x20,
-  0x00, 0x80, 0x03, 0x00, 0x0C, 0x0F, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x60,
-  0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x30, 0xFC,
-  0x08, 0x18, 0x02, 0x0C, 0x00, 0x8C, 0x00, 0x66, 0x00, 0x1B, 0x00, 0x05,
-  0x80, 0x01, 0xB0, 0x00, 0x46, 0x00, 0x31, 0xC0, 0x0C, 0x30, 0x02, 0x06,
-  0x00, 0x80, 0xC0, 0x60, 0x30, 0xF8, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x20,
-  0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x10, 0x00,
-  0x20, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x20,
-  0x00, 0x40, 0x00, 0x80, 0x01, 0x00, 0x04, 0x00, 0x08, 0x0F, 0xFF, 0xC0,
-  0x1C, 0xF1, 0xE0, 0xF1, 0xE3, 0x0E, 0x1C, 0x10, 0xC1, 0x81, 0x08, 0x10,
-  0x30, 0x81, 0x03, 0x18, 0x10, 0x21, 0x83, 0x02, 0x10, 0x30, 0x21, 0x02,
-  0x06, 0x10, 0x20, 0x63, 0x02, 0x04, 0x30, 0x60, 0x42, 0x06, 0x04, 0xF8,
-  0x70, 0xF0, 0x0E, 0x3E, 0x01, 0x60, 0x81, 0xC0, 0x20, 0xC0, 0x10, 0x40,
-  0x08, 0x20, 0x04, 0x30, 0x02, 0x10, 0x02, 0x08, 0x01, 0x04, 0x00, 0x82,
-  0x00, 0x42, 0x00, 0x21, 0x00, 0x20, 0x80, 0x13, 0xF0, 0x3E, 0x01, 0xF0,
-  0x06, 0x0C, 0x18, 0x06, 0x20, 0x03, 0x60, 0x01, 0x40, 0x01, 0x80, 0x01,
-  0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x06, 0xC0, 0x04, 0x40, 0x18,
-  0x30, 0x60, 0x1F, 0x80, 0x0F, 0x1F, 0x80, 0x16, 0x0C, 0x01, 0xC0, 0x20,
-  0x30, 0x03, 0x03, 0x00, 0x10, 0x20, 0x01, 0x02, 0x00, 0x10, 0x40, 0x01,
-  0x04, 0x00, 0x10, 0x40, 0x02, 0x06, 0x00, 0x60, 0x60, 0x04, 0x0B, 0x00,
-  0x80, 0x98, 0x30, 0x08, 0xFC, 0x00, 0x80, 0x00, 0x08, 0x00, 0x01, 0x00,
-  0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-  0xF1, 0xE1, 0x83, 0x20, 0x40, 0x34, 0x10, 0x03, 0x84, 0x00, 0x30, 0x80,
-  0x04, 0x20, 0x00, 0x84, 0x00, 0x10, 0x80, 0x06, 0x10, 0x00, 0xC2, 0x00,
-  0x30, 0x60, 0x0E, 0x04, 0x03, 0x40, 0x60, 0xC8, 0x07, 0xE2, 0x00, 0x00,
-  0x40, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x01,
-  0x00, 0x03, 0xFC, 0x00, 0x0F, 0x87, 0xC0, 0x23, 0x08, 0x04, 0xC0, 0x00,
-  0xE0, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x02,
-  0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x40, 0x00, 0x08,
-  0x00, 0x3F, 0xFE, 0x00, 0x01, 0xFA, 0x0C, 0x1C, 0x20, 0x08, 0x80, 0x11,
-  0x00, 0x03, 0x00, 0x03, 0xF8, 0x00, 0x7C, 0x00, 0x0C, 0x00, 0x09, 0x00,
-  0x16, 0x00, 0x2C, 0x00, 0x9E, 0x06, 0x27, 0xF0, 0x00, 0x08, 0x00, 0x40,
-  0x02, 0x00, 0x10, 0x00, 0x80, 0x7F, 0xFC, 0x40, 0x02, 0x00, 0x10, 0x00,
-  0x80, 0x08, 0x00, 0x40, 0x02, 0x00, 0x10, 0x01, 0x00, 0x08, 0x00, 0x40,
-  0x02, 0x00, 0xD8, 0x1C, 0x3F, 0x00, 0xF0, 0x1E, 0x20, 0x04, 0x80, 0x09,
-  0x00, 0x12, 0x00, 0x24, 0x00, 0xC8, 0x01, 0x20, 0x02, 0x40, 0x04, 0x80,
-  0x09, 0x00, 0x12, 0x00, 0x64, 0x03, 0x8C, 0x1D, 0x0F, 0xC3, 0x80, 0xFE,
-  0x0F, 0xE6, 0x00, 0x20, 0x40, 0x08, 0x08, 0x03, 0x01, 0x80, 0x40, 0x30,
-  0x18, 0x06, 0x02, 0x00, 0x40, 0x80, 0x08, 0x30, 0x01, 0x84, 0x00, 0x31,
-  0x80, 0x02, 0x20, 0x00, 0x48, 0x00, 0x09, 0x00, 0x01, 0xC0, 0x00, 0xF8,
-  0x0F, 0xA0, 0x01, 0x90, 0x00, 0x88, 0x40, 0xC4, 0x30, 0x42, 0x18, 0x61,
-  0x1A, 0x20, 0x8D, 0x10, 0x4C, 0x98, 0x26, 0x48, 0x16, 0x2C, 0x0B, 0x14,
-  0x07, 0x0A, 0x03, 0x07, 0x01, 0x81, 0x00, 0x0F, 0x83, 0xE0, 0xC0, 0x18,
-  0x0C, 0x0C, 0x01, 0x83, 0x00, 0x18, 0xC0, 0x01, 0xB0, 0x00, 0x1C, 0x00,
-  0x03, 0x00, 0x00, 0xF0, 0x00, 0x63, 0x00, 0x18, 0x30, 0x06, 0x06, 0x01,
-  0x80, 0x60, 0x60, 0x06, 0x3F, 0x07, 0xE0, 0x0F, 0xC0, 0xF8, 0x30, 0x01,
-  0x00, 0x80, 0x18, 0x04, 0x00, 0x80, 0x30, 0x0C, 0x01, 0x80, 0xC0, 0x04,
-  0x04, 0x00, 0x30, 0x60, 0x01, 0x86, 0x00, 0x04, 0x20, 0x00, 0x23, 0x00,
-  0x01, 0xB0, 0x00, 0x0D, 0x00, 0x00, 0x38, 0x00, 0x01, 0x80, 0x00, 0x08,
-  0x00, 0x00, 0xC0, 0x00, 0x04, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00,
-  0x20, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x10, 0x06, 0x10, 0x0C, 0x10,
-  0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06,
-  0x00, 0x0C, 0x00, 0x18, 0x04, 0x30, 0x0C, 0x60, 0x0C, 0xFF, 0xF8, 0x00,
-  0xE0, 0x20, 0x08, 0x01, 0x00, 0x20, 0x04, 0x01, 0x00, 0x20, 0x04, 0x00,
-  0x80, 0x20, 0x08, 0x0E, 0x00, 0x60, 0x04, 0x00, 0x80, 0x10, 0x02, 0x00,
-  0x40, 0x08, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x18, 0x00, 0x00, 0x10,
-  0xC3, 0x08, 0x20, 0x86, 0x18, 0x41, 0x04, 0x30, 0xC2, 0x08, 0x21, 0x86,
-  0x10, 0x43, 0x0C, 0x20, 0x06, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40,
-  0x10, 0x04, 0x02, 0x00, 0x80, 0x20, 0x0C, 0x01, 0xC0, 0xC0, 0x40, 0x10,
-  0x04, 0x03, 0x00, 0x80, 0x20, 0x08, 0x02, 0x01, 0x00, 0xC0, 0xE0, 0x00,
-  0x1E, 0x02, 0x66, 0x0D, 0x86, 0x16, 0x06, 0x48, 0x07, 0x00 };
+  0xB3, 0x43, 0x43, 0x42, 0x52, 0x52, 0x52, 0x42, 0x52, 0x52, 0x52, 0x51,
+  0x61, 0x61, 0xFA, 0x33, 0x43, 0x43, 0x34, 0x14, 0x44, 0x14, 0x48, 0x44,
+  0x14, 0x44, 0x14, 0x44, 0x13, 0x53, 0x23, 0x53, 0x22, 0x62, 0x32, 0x62,
+  0x32, 0x62, 0x30, 0x81, 0x32, 0x91, 0x32, 0x82, 0x31, 0x91, 0x41, 0x91,
+  0x32, 0x82, 0x31, 0x92, 0x31, 0x91, 0x32, 0x91, 0x32, 0x5D, 0x51, 0x41,
+  0x91, 0x32, 0x82, 0x31, 0x92, 0x31, 0x5E, 0x51, 0x32, 0x82, 0x31, 0x91,
+  0x41, 0x91, 0x32, 0x82, 0x31, 0x92, 0x31, 0x91, 0x32, 0x91, 0x32, 0x82,
+  0x31, 0x80, 0xA2, 0xE1, 0xF0, 0x1D, 0x52, 0x16, 0x24, 0x45, 0x27, 0x25,
+  0x18, 0x24, 0x1F, 0x01, 0xF0, 0x1F, 0x11, 0xF1, 0x4F, 0x04, 0xF0, 0x2F,
+  0x01, 0xF0, 0x13, 0x1B, 0x13, 0x1A, 0x14, 0x19, 0x23, 0x45, 0x25, 0x12,
+  0x6D, 0x1E, 0x2E, 0x1F, 0x01, 0xF0, 0x1A, 0x64, 0xA2, 0x32, 0x91, 0x51,
+  0x81, 0x61, 0x81, 0x61, 0x81, 0x51, 0x92, 0x31, 0xB4, 0xF5, 0x49, 0x48,
+  0x58, 0x4A, 0x3F, 0x54, 0xB1, 0x42, 0x81, 0x61, 0x71, 0x71, 0x71, 0x71,
+  0x71, 0x61, 0x82, 0x41, 0xA5, 0x60, 0x75, 0x71, 0x32, 0x61, 0xB1, 0xC1,
+  0xC1, 0xC1, 0xC2, 0xC1, 0xA4, 0x81, 0x22, 0x42, 0x11, 0x41, 0x31, 0x21,
+  0x52, 0x21, 0x21, 0x61, 0x11, 0x31, 0x63, 0x31, 0x62, 0x51, 0x43, 0x64,
+  0x24, 0x10, 0x14, 0x18, 0x14, 0x14, 0x13, 0x23, 0x22, 0x32, 0x32, 0x30,
+  0x71, 0x61, 0x62, 0x52, 0x62, 0x52, 0x61, 0x62, 0x62, 0x52, 0x62, 0x62,
+  0x52, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x71, 0x72, 0x62,
+  0x71, 0x50, 0x51, 0x72, 0x62, 0x71, 0x71, 0x72, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x52, 0x62, 0x62, 0x52, 0x62, 0x62, 0x52, 0x61, 0x62,
+  0x52, 0x61, 0x62, 0x60, 0x71, 0xD1, 0xD1, 0xC2, 0x32, 0x13, 0x37, 0x46,
+  0xA3, 0xA2, 0x11, 0x92, 0x22, 0x72, 0x41, 0x62, 0x52, 0x40, 0x82, 0xD1,
+  0xE1, 0xE1, 0xE1, 0xD1, 0xE1, 0xE1, 0x7F, 0x07, 0x1D, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1D, 0x1E, 0x19, 0x45, 0x44, 0x44, 0x53, 0x54, 0x53, 0x53, 0x62,
+  0x63, 0x62, 0x70, 0x0F, 0x10, 0x13, 0x1F, 0x01, 0x31, 0xF2, 0x2F, 0x21,
+  0xF2, 0x1F, 0x22, 0xF1, 0x2F, 0x21, 0xF2, 0x2F, 0x12, 0xF2, 0x1F, 0x22,
+  0xF1, 0x2F, 0x21, 0xF2, 0x2F, 0x12, 0xF2, 0x1F, 0x22, 0xF1, 0x2F, 0x21,
+  0xF2, 0x2F, 0x12, 0xF2, 0x1F, 0x21, 0xF2, 0x2F, 0x12, 0xF2, 0x1F, 0x31,
+  0xF2, 0x75, 0x72, 0x42, 0x51, 0x71, 0x42, 0x81, 0x31, 0x91, 0x21, 0xA1,
+  0x21, 0xA1, 0x11, 0xB1, 0x11, 0xA2, 0x11, 0xA1, 0x21, 0xA1, 0x11, 0xB1,
+  0x11, 0xA2, 0x11, 0xA1, 0x21, 0xA1, 0x21, 0x92, 0x21, 0x91, 0x31, 0x82,
+  0x41, 0x62, 0x52, 0x42, 0x75, 0x70, 0x92, 0xA3, 0x92, 0x11, 0x82, 0x21,
+  0x63, 0x21, 0x71, 0x41, 0xC1, 0xC1, 0xC1, 0xB1, 0xC1, 0xC1, 0xC1, 0xB1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xB1, 0xC1, 0x6D, 0xA4, 0xB2, 0x42, 0x81, 0x71,
+  0x71, 0x91, 0x52, 0x91, 0xF1, 0x1F, 0x11, 0xF0, 0x1F, 0x02, 0xE2, 0xD3,
+  0xD3, 0xD2, 0xE2, 0xD3, 0xD3, 0xD2, 0xE2, 0xD3, 0x91, 0x33, 0xA1, 0x3E,
+  0x30, 0x86, 0x82, 0x52, 0x62, 0x72, 0xF0, 0x1F, 0x01, 0xF0, 0x1E, 0x1F,
+  0x01, 0xD2, 0xA4, 0xF0, 0x2F, 0x11, 0xF1, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
+  0xE1, 0xF0, 0x13, 0x19, 0x24, 0x36, 0x28, 0x66, 0xB3, 0xA2, 0x11, 0x92,
+  0x11, 0x92, 0x21, 0x91, 0x31, 0x81, 0x41, 0x72, 0x41, 0x62, 0x41, 0x71,
+  0x51, 0x61, 0x61, 0x52, 0x61, 0x42, 0x61, 0x42, 0x71, 0x41, 0x81, 0x3D,
+  0xA2, 0xC1, 0xD1, 0xD1, 0xD1, 0x96, 0x30, 0x6A, 0x62, 0xF0, 0x2F, 0x01,
+  0xF1, 0x1F, 0x11, 0xF0, 0x2F, 0x02, 0x15, 0x93, 0x52, 0xF1, 0x1F, 0x21,
+  0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF0, 0x1F, 0x11, 0x32, 0xA1, 0x52,
+  0x81, 0x72, 0x52, 0xA5, 0x80, 0xA6, 0x82, 0xC2, 0xD1, 0xE1, 0xE1, 0xE2,
+  0xE1, 0xE1, 0xF0, 0x14, 0x56, 0x12, 0x24, 0x24, 0x11, 0x27, 0x23, 0x39,
+  0x13, 0x2A, 0x13, 0x1B, 0x13, 0x1B, 0x13, 0x1A, 0x14, 0x29, 0x15, 0x18,
+  0x17, 0x15, 0x29, 0x58, 0x0E, 0xA3, 0xA1, 0xB2, 0xB1, 0xB2, 0xB1, 0xB2,
+  0xB1, 0xB2, 0xB1, 0xB2, 0xB1, 0xB2, 0xB1, 0xB2, 0xB1, 0xB2, 0xB1, 0xB2,
+  0xB1, 0xA0, 0x84, 0x92, 0x42, 0x61, 0x72, 0x41, 0x91, 0x31, 0xA1, 0x31,
+  0xA1, 0x31, 0xA1, 0x31, 0x91, 0x42, 0x71, 0x62, 0x42, 0x86, 0x72, 0x52,
+  0x51, 0x82, 0x31, 0xA1, 0x21, 0xB1, 0x21, 0xB1, 0x21, 0xB1, 0x21, 0xA1,
+  0x32, 0x81, 0x52, 0x52, 0x85, 0x70, 0x84, 0x92, 0x42, 0x61, 0x71, 0x51,
+  0x82, 0x41, 0x91, 0x31, 0xA1, 0x31, 0xA1, 0x31, 0x92, 0x31, 0x83, 0x32,
+  0x62, 0x11, 0x42, 0x42, 0x11, 0x65, 0x31, 0xE1, 0xD1, 0xE1, 0xD1, 0xD1,
+  0xD2, 0xC1, 0xC2, 0x76, 0x90, 0x33, 0x35, 0x25, 0x25, 0x33, 0xFF, 0x73,
+  0x35, 0x25, 0x25, 0x33, 0x30, 0x73, 0x75, 0x65, 0x65, 0x73, 0xFF, 0xFF,
+  0x05, 0x64, 0x64, 0x74, 0x64, 0x73, 0x73, 0x83, 0x73, 0x82, 0x90, 0xF0,
+  0x2D, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3D, 0x3F, 0x13, 0xF0, 0x3F,
+  0x13, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x03, 0x30, 0x1F, 0x3F, 0xFF, 0xFF,
+  0x1F, 0x31, 0x32, 0xF2, 0x3F, 0x23, 0xF1, 0x3F, 0x23, 0xF1, 0x3F, 0x23,
+  0xF2, 0x3F, 0x03, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xF0, 0x37,
+  0x23, 0x62, 0x11, 0x93, 0xA2, 0xA1, 0xB1, 0xA1, 0xA1, 0x92, 0x74, 0x72,
+  0xA1, 0xB1, 0xFF, 0xF0, 0x47, 0x57, 0x58, 0x38, 0x75, 0x82, 0x42, 0x62,
+  0x62, 0x51, 0x81, 0x41, 0x91, 0x31, 0xA1, 0x31, 0xA1, 0x31, 0x74, 0x21,
+  0x62, 0x31, 0x21, 0x42, 0x41, 0x31, 0x41, 0x51, 0x31, 0x31, 0x61, 0x21,
+  0x41, 0x61, 0x21, 0x41, 0x51, 0x31, 0x42, 0x41, 0x31, 0x66, 0x21, 0xE1,
+  0xE1, 0xE1, 0xF0, 0x1E, 0x25, 0x28, 0x57, 0x78, 0xF3, 0x21, 0x1F, 0x12,
+  0x21, 0xF1, 0x22, 0x1F, 0x02, 0x31, 0xF0, 0x14, 0x1E, 0x24, 0x1D, 0x26,
+  0x1C, 0x26, 0x1B, 0x27, 0x1B, 0x27, 0x1A, 0x28, 0x1A, 0xC8, 0x1B, 0x18,
+  0x1B, 0x17, 0x1C, 0x17, 0x1C, 0x16, 0x1D, 0x15, 0x2E, 0x12, 0x77, 0x70,
+  0x4C, 0x91, 0x72, 0x71, 0x92, 0x61, 0xA1, 0x61, 0xA1, 0x61, 0xA1, 0x51,
+  0xA1, 0x61, 0x92, 0x61, 0x82, 0x7A, 0x81, 0x83, 0x51, 0xB1, 0x51, 0xC1,
+  0x41, 0xC1, 0x41, 0xC1, 0x31, 0xD1, 0x31, 0xC1, 0x41, 0xB1, 0x51, 0xA1,
+  0x3E, 0x40, 0x86, 0x31, 0x62, 0x55, 0x42, 0x93, 0x32, 0xA2, 0x41, 0xC1,
+  0x31, 0xD1, 0x21, 0xF2, 0x1F, 0x21, 0xF1, 0x2F, 0x11, 0xF2, 0x1F, 0x21,
+  0xF2, 0x1F, 0x21, 0xF2, 0x2F, 0x21, 0xB2, 0x51, 0x92, 0x72, 0x53, 0x96,
+  0x80, 0x4B, 0x91, 0x72, 0x81, 0x82, 0x61, 0xA1, 0x61, 0xB1, 0x51, 0xB1,
+  0x51, 0xB1, 0x41, 0xC1, 0x41, 0xC1, 0x41, 0xC1, 0x41, 0xB1, 0x51, 0xB1,
+  0x41, 0xC1, 0x41, 0xC1, 0x41, 0xB1, 0x51, 0xA1, 0x51, 0xA2, 0x51, 0x92,
+  0x61, 0x82, 0x5B, 0x70, 0x4F, 0x08, 0x1A, 0x17, 0x1A, 0x27, 0x1A, 0x27,
+  0x1A, 0x27, 0x1F, 0x31, 0xF4, 0x16, 0x1C, 0x15, 0x1D, 0x7D, 0x15, 0x1C,
+  0x16, 0x1C, 0x1F, 0x41, 0xF4, 0x1B, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1B,
+  0x26, 0x1B, 0x23, 0xF1, 0x40, 0x4F, 0x17, 0x1A, 0x26, 0x1B, 0x26, 0x1B,
+  0x26, 0x1B, 0x17, 0x1F, 0x31, 0xF4, 0x16, 0x1C, 0x15, 0x1D, 0x7D, 0x15,
+  0x1C, 0x16, 0x1C, 0x1F, 0x41, 0xF4, 0x1F, 0x31, 0xF4, 0x1F, 0x41, 0xF4,
+  0x1F, 0x19, 0xB0, 0x87, 0x21, 0x62, 0x64, 0x51, 0x93, 0x41, 0xB2, 0x31,
+  0xC1, 0x31, 0xF2, 0x1F, 0x11, 0xF2, 0x1F, 0x21, 0xF1, 0x1F, 0x21, 0x88,
+  0x11, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xD1, 0x41, 0xB1, 0x52, 0xA1,
+  0x63, 0x63, 0x87, 0x70, 0x56, 0x46, 0x71, 0x91, 0x91, 0xA1, 0x91, 0xA1,
+  0x91, 0xA1, 0x91, 0xA1, 0x82, 0x91, 0x91, 0xA1, 0x91, 0xA1, 0x9C, 0x91,
+  0x92, 0x81, 0xA1, 0x91, 0xA1, 0x91, 0xA1, 0x91, 0xA1, 0x81, 0xA1, 0x91,
+  0xA1, 0x91, 0xA1, 0x91, 0xA1, 0x66, 0x56, 0x40, 0x4D, 0xA1, 0xF1, 0x1F,
+  0x01, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF0, 0x1F, 0x11, 0xF1, 0x1F,
+  0x11, 0xF1, 0x1F, 0x01, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x01, 0xF1, 0x1A,
+  0xD4, 0x8C, 0xE1, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x41, 0xF3, 0x1F, 0x41,
+  0xF4, 0x1F, 0x41, 0xF3, 0x27, 0x1A, 0x18, 0x1A, 0x17, 0x1B, 0x17, 0x1B,
+  0x17, 0x1A, 0x18, 0x1A, 0x18, 0x28, 0x1A, 0x25, 0x2D, 0x5C, 0x47, 0x46,
+  0x71, 0x92, 0x81, 0x82, 0xA1, 0x72, 0xB1, 0x62, 0xC1, 0x52, 0xC1, 0x42,
+  0xE1, 0x32, 0xF0, 0x12, 0x2F, 0x11, 0x15, 0xE2, 0x33, 0xC2, 0x52, 0xC1,
+  0x72, 0xB1, 0x72, 0xB1, 0x81, 0xA1, 0x92, 0x91, 0x92, 0x91, 0x92, 0x91,
+  0xA1, 0x67, 0x74, 0x30, 0x59, 0xD1, 0xF1, 0x1F, 0x21, 0xF2, 0x1F, 0x21,
+  0xF2, 0x1F, 0x11, 0xF2, 0x1F, 0x21, 0xF2, 0x1F, 0x11, 0xF2, 0x1F, 0x21,
+  0xA1, 0x61, 0xA1, 0x61, 0xA1, 0x51, 0xA1, 0x61, 0xA1, 0x61, 0xA1, 0x1F,
+  0x21, 0x44, 0xB4, 0x72, 0xA3, 0x81, 0x11, 0x92, 0x11, 0x81, 0x21, 0x82,
+  0x11, 0x81, 0x21, 0x72, 0x21, 0x81, 0x21, 0x71, 0x21, 0x91, 0x21, 0x62,
+  0x21, 0x81, 0x41, 0x42, 0x31, 0x81, 0x41, 0x41, 0x41, 0x81, 0x41, 0x32,
+  0x41, 0x81, 0x41, 0x22, 0x41, 0x81, 0x61, 0x12, 0x41, 0x81, 0x63, 0x51,
+  0x81, 0x62, 0x61, 0x81, 0xD1, 0x91, 0xD1, 0x81, 0xE1, 0x81, 0xE1, 0x81,
+  0xE1, 0x66, 0x76, 0x50, 0x35, 0x77, 0x62, 0xA1, 0x84, 0x91, 0x84, 0x82,
+  0x81, 0x21, 0x82, 0x81, 0x22, 0x71, 0x91, 0x22, 0x71, 0x82, 0x32, 0x61,
+  0x82, 0x32, 0x52, 0x81, 0x51, 0x52, 0x81, 0x52, 0x41, 0x82, 0x52, 0x41,
+  0x82, 0x62, 0x31, 0x81, 0x72, 0x22, 0x81, 0x81, 0x22, 0x81, 0x82, 0x11,
+  0x82, 0x82, 0x11, 0x82, 0x91, 0x11, 0x81, 0xA3, 0x67, 0x72, 0x60, 0x85,
+  0xA2, 0x52, 0x71, 0x82, 0x51, 0xA1, 0x41, 0xB2, 0x21, 0xD1, 0x21, 0xD1,
+  0x11, 0xE1, 0x11, 0xE2, 0xF0, 0x2F, 0x02, 0xE1, 0x11, 0xE1, 0x11, 0xD1,
+  0x21, 0xD1, 0x22, 0xB1, 0x41, 0xA1, 0x52, 0x81, 0x72, 0x52, 0xA5, 0x80,
+  0x4B, 0xA1, 0x72, 0x71, 0x92, 0x61, 0xA1, 0x61, 0xA1, 0x61, 0xA1, 0x51,
+  0xB1, 0x51, 0xA1, 0x61, 0x91, 0x71, 0x72, 0x88, 0x91, 0xF2, 0x1F, 0x21,
+  0xF2, 0x1F, 0x11, 0xF2, 0x1F, 0x21, 0xF2, 0x1E, 0x99, 0x85, 0xA2, 0x52,
+  0x71, 0x82, 0x51, 0xA1, 0x41, 0xB2, 0x21, 0xD1, 0x11, 0xE1, 0x11, 0xE1,
+  0x11, 0xE2, 0xF0, 0x2F, 0x02, 0xE1, 0x11, 0xE1, 0x11, 0xD1, 0x21, 0xD1,
+  0x22, 0xB1, 0x41, 0xA1, 0x52, 0x81, 0x72, 0x52, 0x96, 0xC2, 0xD3, 0xD8,
+  0x42, 0x32, 0x64, 0x40, 0x4B, 0xA1, 0x72, 0x71, 0x92, 0x61, 0xA1, 0x61,
+  0xA1, 0x61, 0xA1, 0x51, 0xB1, 0x51, 0xA1, 0x61, 0x91, 0x71, 0x72, 0x88,
+  0x91, 0x62, 0x91, 0x72, 0x81, 0x73, 0x71, 0x82, 0x61, 0x92, 0x61, 0xA2,
+  0x51, 0xA2, 0x51, 0xB2, 0x17, 0x83, 0x96, 0x21, 0x72, 0x54, 0x61, 0x83,
+  0x51, 0xA1, 0x51, 0xB1, 0x51, 0xF2, 0x1F, 0x22, 0xF2, 0x2F, 0x25, 0xF2,
+  0x4F, 0x22, 0xF3, 0x1F, 0x21, 0x31, 0xD1, 0x31, 0xD1, 0x31, 0xC1, 0x33,
+  0xA1, 0x41, 0x13, 0x62, 0x51, 0x37, 0x70, 0x2F, 0x01, 0x17, 0x16, 0x11,
+  0x17, 0x16, 0x11, 0x17, 0x15, 0x12, 0x16, 0x16, 0x19, 0x1F, 0x11, 0xF1,
+  0x1F, 0x01, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF0, 0x1F, 0x11, 0xF1,
+  0x1F, 0x11, 0xF0, 0x1F, 0x11, 0xBB, 0x60, 0x16, 0x56, 0x31, 0xB1, 0x41,
+  0xC1, 0x41, 0xB1, 0x51, 0xB1, 0x51, 0xB1, 0x51, 0xB1, 0x41, 0xC1, 0x41,
+  0xB1, 0x51, 0xB1, 0x51, 0xB1, 0x51, 0xB1, 0x41, 0xB2, 0x41, 0xB1, 0x51,
+  0xB1, 0x51, 0xA2, 0x51, 0xA1, 0x71, 0x81, 0x82, 0x52, 0xB5, 0xA0, 0x07,
+  0x77, 0x22, 0xD1, 0x52, 0xC2, 0x61, 0xC1, 0x71, 0xB1, 0x81, 0xA2, 0x82,
+  0x91, 0x92, 0x82, 0x92, 0x81, 0xB1, 0x72, 0xB1, 0x62, 0xC1, 0x61, 0xD2,
+  0x42, 0xD2, 0x41, 0xE2, 0x32, 0xF0, 0x13, 0x1F, 0x11, 0x21, 0xF2, 0x11,
+  0x2F, 0x23, 0xF3, 0x3D, 0x17, 0x57, 0x21, 0xE1, 0x41, 0xD2, 0x41, 0xD1,
+  0x51, 0x52, 0x61, 0x51, 0x52, 0x52, 0x51, 0x42, 0x11, 0x41, 0x61, 0x42,
+  0x11, 0x41, 0x61, 0x32, 0x21, 0x32, 0x51, 0x42, 0x21, 0x32, 0x51, 0x32,
+  0x31, 0x31, 0x61, 0x32, 0x31, 0x22, 0x61, 0x22, 0x41, 0x22, 0x61, 0x22,
+  0x41, 0x21, 0x71, 0x12, 0x51, 0x21, 0x71, 0x12, 0x51, 0x12, 0x73, 0x61,
+  0x11, 0x83, 0x61, 0x11, 0x73, 0x73, 0x73, 0x72, 0x80, 0x46, 0x56, 0x52,
+  0xA2, 0x82, 0x82, 0x92, 0x72, 0xB2, 0x61, 0xC2, 0x51, 0xE2, 0x32, 0xF0,
+  0x12, 0x2F, 0x14, 0xF3, 0x2F, 0x33, 0xF2, 0x21, 0x1F, 0x12, 0x22, 0xE2,
+  0x41, 0xD2, 0x52, 0xB2, 0x72, 0xA1, 0x82, 0x91, 0xA2, 0x71, 0xB2, 0x56,
+  0x57, 0x30, 0x16, 0x56, 0x31, 0xA2, 0x52, 0x82, 0x71, 0x72, 0x82, 0x61,
+  0x92, 0x51, 0xB1, 0x42, 0xB2, 0x22, 0xD1, 0x12, 0xE3, 0xF1, 0x1F, 0x21,
+  0xF2, 0x1F, 0x11, 0xF2, 0x1F, 0x21, 0xF2, 0x1F, 0x11, 0xF2, 0x1C, 0xB7,
+  0x4D, 0x42, 0x91, 0x51, 0x91, 0x61, 0x82, 0x52, 0x72, 0x62, 0x62, 0xE2,
+  0xE2, 0xF0, 0x1F, 0x01, 0xF0, 0x2E, 0x2E, 0x2E, 0x28, 0x15, 0x28, 0x25,
+  0x19, 0x15, 0x1A, 0x14, 0x1B, 0x13, 0x2A, 0x23, 0xE3, 0x56, 0x51, 0xA1,
+  0xA1, 0x92, 0x92, 0x91, 0xA1, 0x92, 0x92, 0x91, 0xA1, 0xA1, 0x92, 0x92,
+  0x91, 0xA1, 0xA1, 0x92, 0x92, 0x91, 0xA1, 0xA1, 0x92, 0x96, 0x50, 0x01,
+  0x71, 0x71, 0x81, 0x71, 0x71, 0x81, 0x71, 0x71, 0x71, 0x81, 0x71, 0x71,
+  0x71, 0x81, 0x71, 0x71, 0x71, 0x81, 0x71, 0x71, 0x71, 0x81, 0x71, 0x71,
+  0x71, 0x90, 0x56, 0x92, 0x91, 0xA1, 0xA1, 0x92, 0x92, 0x91, 0xA1, 0x92,
+  0x92, 0x91, 0xA1, 0xA1, 0x92, 0x92, 0x91, 0xA1, 0x92, 0x92, 0x91, 0xA1,
+  0x92, 0x92, 0x55, 0x60, 0x71, 0xB3, 0x92, 0x12, 0x72, 0x22, 0x62, 0x42,
+  0x42, 0x61, 0x32, 0x72, 0x12, 0x93, 0xA2, 0x0F, 0x60, 0x02, 0x33, 0x33,
+  0x33, 0x32, 0x67, 0x72, 0x62, 0xF1, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0x69,
+  0x52, 0x72, 0x41, 0xA1, 0x31, 0xB1, 0x21, 0xC1, 0x21, 0xB1, 0x31, 0x93,
+  0x32, 0x63, 0x11, 0x56, 0x44, 0x44, 0xF3, 0x1F, 0x31, 0xF2, 0x2F, 0x22,
+  0xF2, 0x1F, 0x31, 0x45, 0x91, 0x22, 0x42, 0x72, 0x11, 0x81, 0x63, 0x92,
+  0x52, 0xB1, 0x51, 0xC1, 0x42, 0xC1, 0x41, 0xD1, 0x41, 0xD1, 0x41, 0xC1,
+  0x51, 0xC1, 0x43, 0xA1, 0x53, 0x91, 0x61, 0x22, 0x52, 0x44, 0x36, 0x60,
+  0x77, 0x21, 0x52, 0x64, 0x32, 0x93, 0x21, 0xC1, 0x31, 0xC1, 0x21, 0xF1,
+  0x1F, 0x01, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x12, 0xC2, 0x21, 0xB2, 0x42,
+  0x63, 0x77, 0x70, 0xE4, 0xF1, 0x2F, 0x12, 0xF1, 0x1F, 0x21, 0xF1, 0x27,
+  0x63, 0x26, 0x15, 0x22, 0x15, 0x27, 0x21, 0x14, 0x1A, 0x34, 0x1A, 0x33,
+  0x1C, 0x22, 0x1D, 0x13, 0x1D, 0x13, 0x1C, 0x23, 0x1C, 0x23, 0x1B, 0x33,
+  0x1B, 0x25, 0x18, 0x21, 0x16, 0x25, 0x21, 0x27, 0x63, 0x42, 0x75, 0x83,
+  0x52, 0x52, 0x82, 0x32, 0xA1, 0x22, 0xC1, 0x11, 0xD3, 0xDF, 0x3F, 0x01,
+  0xF0, 0x1F, 0x11, 0xF0, 0x2A, 0x23, 0x27, 0x36, 0x75, 0xB8, 0x92, 0xF1,
+  0x2F, 0x21, 0xF3, 0x1F, 0x21, 0xED, 0xA1, 0xF3, 0x1F, 0x31, 0xF2, 0x1F,
+  0x31, 0xF3, 0x1F, 0x31, 0xF3, 0x1F, 0x21, 0xF3, 0x1F, 0x31, 0xF3, 0x1F,
+  0x21, 0xEC, 0x70, 0x65, 0x35, 0x42, 0x52, 0x12, 0x61, 0x83, 0x61, 0xA2,
+  0x51, 0xB2, 0x51, 0xB2, 0x41, 0xC2, 0x41, 0xC1, 0x51, 0xC1, 0x51, 0xB2,
+  0x51, 0xB2, 0x52, 0x92, 0x71, 0x81, 0x11, 0x82, 0x42, 0x21, 0x95, 0x32,
+  0xF2, 0x2F, 0x21, 0xF3, 0x1F, 0x21, 0xF2, 0x2F, 0x12, 0xA7, 0xB0, 0x44,
+  0xF2, 0x1F, 0x21, 0xF1, 0x1F, 0x21, 0xF2, 0x1F, 0x21, 0x35, 0x91, 0x12,
+  0x42, 0x71, 0x11, 0x81, 0x62, 0x91, 0x61, 0xA1, 0x61, 0xA1, 0x51, 0xB1,
+  0x51, 0xA2, 0x51, 0xA2, 0x51, 0xA2, 0x41, 0xB2, 0x41, 0xB2, 0x41, 0xA2,
+  0x51, 0xA2, 0x26, 0x57, 0xA2, 0xD2, 0xD2, 0xD2, 0xFF, 0xF8, 0x6E, 0x1E,
+  0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x1E, 0x17,
+  0xE1, 0xD2, 0xD2, 0xD2, 0xC2, 0xFF, 0xF5, 0xAE, 0x1E, 0x1E, 0x1E, 0x1D,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1D, 0x1E, 0x1E, 0x1E, 0x1D, 0x2D, 0x1E, 0x1E,
+  0x1D, 0x1D, 0x2C, 0x26, 0x78, 0x54, 0xF1, 0x2F, 0x11, 0xF2, 0x1F, 0x21,
+  0xF1, 0x2F, 0x12, 0x46, 0x61, 0x62, 0x91, 0x52, 0xA1, 0x32, 0xB2, 0x22,
+  0xC2, 0x12, 0xD1, 0x12, 0xE2, 0x12, 0xD1, 0x32, 0xB2, 0x33, 0xA2, 0x42,
+  0xA1, 0x62, 0x91, 0x72, 0x72, 0x72, 0x45, 0x66, 0x10, 0x76, 0xD1, 0xE1,
+  0xE1, 0xE1, 0xD1, 0xE1, 0xE1, 0xE1, 0xD1, 0xE1, 0xE1, 0xE1, 0xE1, 0xD1,
+  0xE1, 0xE1, 0xE1, 0xD1, 0xE1, 0x7E, 0x10, 0x33, 0x24, 0x34, 0x54, 0x34,
+  0x32, 0x43, 0x43, 0x51, 0x42, 0x52, 0x61, 0x41, 0x61, 0x62, 0x41, 0x61,
+  0x62, 0x32, 0x61, 0x61, 0x42, 0x52, 0x61, 0x41, 0x62, 0x61, 0x41, 0x61,
+  0x62, 0x41, 0x61, 0x62, 0x32, 0x61, 0x61, 0x42, 0x52, 0x61, 0x41, 0x62,
+  0x61, 0x25, 0x43, 0x44, 0x43, 0x35, 0x81, 0x12, 0x51, 0x63, 0x81, 0x52,
+  0x91, 0x51, 0xA1, 0x51, 0xA1, 0x42, 0xA1, 0x41, 0xA1, 0x51, 0xA1, 0x51,
+  0xA1, 0x51, 0xA1, 0x41, 0xB1, 0x41, 0xA1, 0x51, 0xA1, 0x26, 0x65, 0x75,
+  0x92, 0x52, 0x52, 0x82, 0x31, 0xB2, 0x12, 0xC1, 0x11, 0xD2, 0xE2, 0xE2,
+  0xE2, 0xD1, 0x11, 0xC2, 0x12, 0xB1, 0x31, 0x92, 0x52, 0x52, 0x86, 0x70,
+  0x44, 0x36, 0xA1, 0x12, 0x52, 0x93, 0x81, 0x72, 0xA2, 0x62, 0xB1, 0x61,
+  0xC1, 0x61, 0xC1, 0x51, 0xD1, 0x51, 0xD1, 0x51, 0xC1, 0x62, 0xA2, 0x62,
+  0xA1, 0x61, 0x12, 0x81, 0x71, 0x22, 0x52, 0x81, 0x36, 0xA1, 0xF4, 0x1F,
+  0x31, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x18, 0xC0, 0x66, 0x34, 0x42, 0x52,
+  0x21, 0x61, 0x82, 0x11, 0x51, 0xA3, 0x41, 0xC2, 0x41, 0xC1, 0x41, 0xD1,
+  0x41, 0xD1, 0x41, 0xC2, 0x41, 0xC2, 0x41, 0xB2, 0x52, 0x93, 0x61, 0x82,
+  0x11, 0x72, 0x52, 0x21, 0x86, 0x31, 0xF3, 0x1F, 0x31, 0xF3, 0x1F, 0x31,
+  0xF2, 0x1F, 0x31, 0xE8, 0x40, 0x45, 0x45, 0x81, 0x32, 0x41, 0x81, 0x22,
+  0xE3, 0xF1, 0x2F, 0x21, 0xF2, 0x1F, 0x31, 0xF3, 0x1F, 0x31, 0xF2, 0x1F,
+  0x31, 0xF3, 0x1F, 0x31, 0xDD, 0x60, 0x76, 0x11, 0x52, 0x53, 0x41, 0x91,
+  0x31, 0xA1, 0x31, 0xE2, 0xE7, 0xC5, 0xE2, 0xE1, 0x21, 0xB1, 0x12, 0xB1,
+  0x12, 0xA1, 0x24, 0x62, 0x31, 0x27, 0x50, 0x41, 0xC1, 0xC1, 0xC1, 0xC1,
+  0x8D, 0x31, 0xC1, 0xC1, 0xC1, 0xB1, 0xC1, 0xC1, 0xC1, 0xB1, 0xC1, 0xC1,
+  0xC1, 0x92, 0x12, 0x63, 0x46, 0x40, 0x04, 0x74, 0x31, 0xA1, 0x21, 0xB1,
+  0x21, 0xB1, 0x21, 0xB1, 0x21, 0xA2, 0x21, 0xA1, 0x21, 0xB1, 0x21, 0xB1,
+  0x21, 0xB1, 0x21, 0xB1, 0x21, 0xA2, 0x21, 0x83, 0x32, 0x53, 0x11, 0x46,
+  0x43, 0x07, 0x57, 0x22, 0xB1, 0x61, 0xA1, 0x71, 0x92, 0x72, 0x81, 0x82,
+  0x72, 0x82, 0x71, 0xA1, 0x61, 0xB1, 0x52, 0xB2, 0x41, 0xC2, 0x32, 0xD1,
+  0x31, 0xE1, 0x21, 0xF0, 0x12, 0x1F, 0x03, 0xB0, 0x05, 0x75, 0x11, 0xC2,
+  0x21, 0xC1, 0x31, 0x41, 0x62, 0x31, 0x42, 0x51, 0x41, 0x42, 0x42, 0x41,
+  0x32, 0x11, 0x31, 0x51, 0x32, 0x11, 0x31, 0x51, 0x22, 0x21, 0x22, 0x51,
+  0x22, 0x21, 0x21, 0x61, 0x12, 0x31, 0x12, 0x61, 0x12, 0x31, 0x11, 0x73,
+  0x41, 0x11, 0x72, 0x53, 0x72, 0x61, 0x70, 0x45, 0x55, 0x52, 0x92, 0x72,
+  0x62, 0x92, 0x52, 0xB2, 0x32, 0xD2, 0x12, 0xF0, 0x3F, 0x12, 0xF1, 0x4D,
+  0x23, 0x2B, 0x25, 0x29, 0x26, 0x28, 0x28, 0x26, 0x2A, 0x23, 0x65, 0x62,
+  0x46, 0x65, 0x52, 0xB1, 0x81, 0xA2, 0x81, 0xA1, 0x92, 0x82, 0x92, 0x72,
+  0xB1, 0x71, 0xC2, 0x52, 0xC2, 0x42, 0xE1, 0x41, 0xF0, 0x13, 0x2F, 0x02,
+  0x12, 0xF1, 0x21, 0x1F, 0x33, 0xF3, 0x2F, 0x41, 0xF4, 0x2F, 0x41, 0xF4,
+  0x2F, 0x32, 0xF4, 0x1E, 0xAB, 0x3D, 0x31, 0x92, 0x41, 0x82, 0x51, 0x72,
+  0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0x81, 0x42, 0x82, 0x32,
+  0x92, 0x2D, 0x30, 0x83, 0x71, 0x91, 0xA1, 0xA1, 0xA1, 0x91, 0xA1, 0xA1,
+  0xA1, 0x91, 0x91, 0x73, 0xA2, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x91,
+  0xA1, 0xA1, 0xA1, 0xB2, 0x60, 0xB1, 0x42, 0x42, 0x41, 0x51, 0x51, 0x42,
+  0x42, 0x41, 0x51, 0x51, 0x42, 0x42, 0x41, 0x51, 0x51, 0x42, 0x42, 0x41,
+  0x51, 0x42, 0x42, 0x41, 0x50, 0x52, 0xA1, 0x91, 0x91, 0x91, 0x91, 0x91,
+  0x91, 0x81, 0x91, 0x91, 0x92, 0x93, 0x62, 0x71, 0x91, 0x91, 0x82, 0x81,
+  0x91, 0x91, 0x91, 0x81, 0x82, 0x63, 0x70, 0x34, 0x71, 0x22, 0x22, 0x52,
+  0x12, 0x42, 0x41, 0x12, 0x62, 0x21, 0x21, 0x83, 0x30 };
 
 const GFXglyph FreeMonoOblique18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  21,    0,    1 },   // 0x20 ' '
   {     0,   7,  22,  21,    9,  -21 },   // 0x21 '!'
-  {    20,  13,  10,  21,    7,  -20 },   // 0x22 '"'
-  {    37,  15,  24,  21,    5,  -21 },   // 0x23 '#'
-  {    82,  16,  26,  21,    4,  -22 },   // 0x24 '$'
-  {   134,  16,  21,  21,    5,  -20 },   // 0x25 '%'
-  {   176,  13,  18,  21,    5,  -17 },   // 0x26 '&'
-  {   206,   5,  10,  21,   12,  -20 },   // 0x27 '''
-  {   213,   8,  25,  21,   12,  -20 },   // 0x28 '('
-  {   238,   8,  25,  21,    5,  -20 },   // 0x29 ')'
-  {   263,  14,  11,  21,    7,  -19 },   // 0x2A '*'
-  {   283,  15,  17,  21,    5,  -17 },   // 0x2B '+'
-  {   315,   9,  10,  21,    4,   -4 },   // 0x2C ','
-  {   327,  16,   1,  21,    5,   -9 },   // 0x2D '-'
-  {   329,   5,   5,  21,    8,   -4 },   // 0x2E '.'
-  {   333,  19,  26,  21,    3,  -22 },   // 0x2F '/'
-  {   395,  14,  21,  21,    5,  -20 },   // 0x30 '0'
-  {   432,  13,  21,  21,    4,  -20 },   // 0x31 '1'
-  {   467,  17,  21,  21,    3,  -20 },   // 0x32 '2'
-  {   512,  16,  21,  21,    3,  -20 },   // 0x33 '3'
-  {   554,  14,  21,  21,    5,  -20 },   // 0x34 '4'
-  {   591,  17,  21,  21,    4,  -20 },   // 0x35 '5'
-  {   636,  16,  21,  21,    6,  -20 },   // 0x36 '6'
-  {   678,  13,  21,  21,    8,  -20 },   // 0x37 '7'
-  {   713,  15,  21,  21,    5,  -20 },   // 0x38 '8'
-  {   753,  15,  21,  21,    5,  -20 },   // 0x39 '9'
-  {   793,   7,  15,  21,    8,  -14 },   // 0x3A ':'
-  {   807,  11,  20,  21,    4,  -14 },   // 0x3B ';'
-  {   835,  17,  16,  21,    5,  -17 },   // 0x3C '<'
-  {   869,  19,   6,  21,    3,  -12 },   // 0x3D '='
-  {   884,  18,  16,  21,    3,  -17 },   // 0x3E '>'
-  {   920,  12,  20,  21,    8,  -19 },   // 0x3F '?'
-  {   950,  15,  23,  21,    5,  -20 },   // 0x40 '@'
-  {   994,  21,  20,  21,    0,  -19 },   // 0x41 'A'
-  {  1047,  18,  20,  21,    2,  -19 },   // 0x42 'B'
-  {  1092,  18,  20,  21,    4,  -19 },   // 0x43 'C'
-  {  1137,  18,  20,  21,    2,  -19 },   // 0x44 'D'
-  {  1182,  20,  20,  21,    2,  -19 },   // 0x45 'E'
-  {  1232,  20,  20,  21,    2,  -19 },   // 0x46 'F'
-  {  1282,  18,  20,  21,    4,  -19 },   // 0x47 'G'
-  {  1327,  21,  20,  21,    2,  -19 },   // 0x48 'H'
-  {  1380,  17,  20,  21,    4,  -19 },   // 0x49 'I'
-  {  1423,  20,  20,  21,    4,  -19 },   // 0x4A 'J'
-  {  1473,  21,  20,  21,    2,  -19 },   // 0x4B 'K'
-  {  1526,  18,  20,  21,    2,  -19 },   // 0x4C 'L'
-  {  1571,  24,  20,  21,    1,  -19 },   // 0x4D 'M'
-  {  1631,  22,  20,  21,    2,  -19 },   // 0x4E 'N'
-  {  1686,  17,  20,  21,    4,  -19 },   // 0x4F 'O'
-  {  1729,  18,  20,  21,    2,  -19 },   // 0x50 'P'
-  {  1774,  17,  24,  21,    4,  -19 },   // 0x51 'Q'
-  {  1825,  18,  20,  21,    2,  -19 },   // 0x52 'R'
-  {  1870,  18,  20,  21,    3,  -19 },   // 0x53 'S'
-  {  1915,  17,  20,  21,    5,  -19 },   // 0x54 'T'
-  {  1958,  18,  20,  21,    5,  -19 },   // 0x55 'U'
-  {  2003,  21,  20,  21,    4,  -19 },   // 0x56 'V'
-  {  2056,  20,  20,  21,    4,  -19 },   // 0x57 'W'
-  {  2106,  21,  20,  21,    2,  -19 },   // 0x58 'X'
-  {  2159,  18,  20,  21,    5,  -19 },   // 0x59 'Y'
-  {  2204,  17,  20,  21,    4,  -19 },   // 0x5A 'Z'
-  {  2247,  11,  25,  21,    9,  -20 },   // 0x5B '['
-  {  2282,   8,  27,  21,    9,  -22 },   // 0x5C '\'
-  {  2309,  11,  25,  21,    5,  -20 },   // 0x5D ']'
-  {  2344,  13,   9,  21,    7,  -20 },   // 0x5E '^'
-  {  2359,  21,   1,  21,   -1,    4 },   // 0x5F '_'
-  {  2362,   5,   5,  21,    9,  -21 },   // 0x60 '`'
-  {  2366,  16,  15,  21,    3,  -14 },   // 0x61 'a'
-  {  2396,  19,  21,  21,    1,  -20 },   // 0x62 'b'
-  {  2446,  17,  15,  21,    4,  -14 },   // 0x63 'c'
-  {  2478,  18,  21,  21,    4,  -20 },   // 0x64 'd'
-  {  2526,  16,  15,  21,    4,  -14 },   // 0x65 'e'
-  {  2556,  19,  21,  21,    4,  -20 },   // 0x66 'f'
-  {  2606,  19,  22,  21,    4,  -14 },   // 0x67 'g'
-  {  2659,  18,  21,  21,    2,  -20 },   // 0x68 'h'
-  {  2707,  15,  22,  21,    3,  -21 },   // 0x69 'i'
-  {  2749,  15,  29,  21,    3,  -21 },   // 0x6A 'j'
-  {  2804,  18,  21,  21,    2,  -20 },   // 0x6B 'k'
-  {  2852,  15,  21,  21,    3,  -20 },   // 0x6C 'l'
-  {  2892,  20,  15,  21,    1,  -14 },   // 0x6D 'm'
-  {  2930,  17,  15,  21,    2,  -14 },   // 0x6E 'n'
-  {  2962,  16,  15,  21,    4,  -14 },   // 0x6F 'o'
-  {  2992,  20,  22,  21,    0,  -14 },   // 0x70 'p'
-  {  3047,  19,  22,  21,    4,  -14 },   // 0x71 'q'
-  {  3100,  19,  15,  21,    3,  -14 },   // 0x72 'r'
-  {  3136,  15,  15,  21,    4,  -14 },   // 0x73 's'
-  {  3165,  13,  20,  21,    5,  -19 },   // 0x74 't'
-  {  3198,  15,  15,  21,    4,  -14 },   // 0x75 'u'
-  {  3227,  19,  15,  21,    4,  -14 },   // 0x76 'v'
-  {  3263,  17,  15,  21,    5,  -14 },   // 0x77 'w'
-  {  3295,  19,  15,  21,    2,  -14 },   // 0x78 'x'
-  {  3331,  21,  22,  21,    1,  -14 },   // 0x79 'y'
-  {  3389,  16,  15,  21,    4,  -14 },   // 0x7A 'z'
-  {  3419,  11,  25,  21,    8,  -20 },   // 0x7B '{'
-  {  3454,   6,  24,  21,    9,  -19 },   // 0x7C '|'
-  {  3472,  10,  25,  21,    6,  -20 },   // 0x7D '}'
-  {  3504,  15,   5,  21,    5,  -11 } }; // 0x7E '~'
+  {    19,  13,  10,  21,    7,  -20 },   // 0x22 '"'
+  {    39,  15,  24,  21,    5,  -21 },   // 0x23 '#'
+  {    86,  16,  26,  21,    4,  -22 },   // 0x24 '$'
+  {   127,  16,  21,  21,    5,  -20 },   // 0x25 '%'
+  {   162,  13,  18,  21,    5,  -17 },   // 0x26 '&'
+  {   194,   5,  10,  21,   12,  -20 },   // 0x27 '''
+  {   204,   8,  25,  21,   12,  -20 },   // 0x28 '('
+  {   230,   8,  25,  21,    5,  -20 },   // 0x29 ')'
+  {   256,  14,  11,  21,    7,  -19 },   // 0x2A '*'
+  {   274,  15,  17,  21,    5,  -17 },   // 0x2B '+'
+  {   292,   9,  10,  21,    4,   -4 },   // 0x2C ','
+  {   303,  16,   1,  21,    5,   -9 },   // 0x2D '-'
+  {   305,   5,   5,  21,    8,   -4 },   // 0x2E '.'
+  {   309,  19,  26,  21,    3,  -22 },   // 0x2F '/'
+  {   349,  14,  21,  21,    5,  -20 },   // 0x30 '0'
+  {   390,  13,  21,  21,    4,  -20 },   // 0x31 '1'
+  {   415,  17,  21,  21,    3,  -20 },   // 0x32 '2'
+  {   445,  16,  21,  21,    3,  -20 },   // 0x33 '3'
+  {   476,  14,  21,  21,    5,  -20 },   // 0x34 '4'
+  {   511,  17,  21,  21,    4,  -20 },   // 0x35 '5'
+  {   545,  16,  21,  21,    6,  -20 },   // 0x36 '6'
+  {   580,  13,  21,  21,    8,  -20 },   // 0x37 '7'
+  {   602,  15,  21,  21,    5,  -20 },   // 0x38 '8'
+  {   642,  15,  21,  21,    5,  -20 },   // 0x39 '9'
+  {   677,   7,  15,  21,    8,  -14 },   // 0x3A ':'
+  {   689,  11,  20,  21,    4,  -14 },   // 0x3B ';'
+  {   707,  17,  16,  21,    5,  -17 },   // 0x3C '<'
+  {   728,  19,   6,  21,    3,  -12 },   // 0x3D '='
+  {   734,  18,  16,  21,    3,  -17 },   // 0x3E '>'
+  {   755,  12,  20,  21,    8,  -19 },   // 0x3F '?'
+  {   776,  15,  23,  21,    5,  -20 },   // 0x40 '@'
+  {   823,  21,  20,  21,    0,  -19 },   // 0x41 'A'
+  {   864,  18,  20,  21,    2,  -19 },   // 0x42 'B'
+  {   902,  18,  20,  21,    4,  -19 },   // 0x43 'C'
+  {   937,  18,  20,  21,    2,  -19 },   // 0x44 'D'
+  {   976,  20,  20,  21,    2,  -19 },   // 0x45 'E'
+  {  1013,  20,  20,  21,    2,  -19 },   // 0x46 'F'
+  {  1047,  18,  20,  21,    4,  -19 },   // 0x47 'G'
+  {  1084,  21,  20,  21,    2,  -19 },   // 0x48 'H'
+  {  1124,  17,  20,  21,    4,  -19 },   // 0x49 'I'
+  {  1153,  20,  20,  21,    4,  -19 },   // 0x4A 'J'
+  {  1186,  21,  20,  21,    2,  -19 },   // 0x4B 'K'
+  {  1228,  18,  20,  21,    2,  -19 },   // 0x4C 'L'
+  {  1261,  24,  20,  21,    1,  -19 },   // 0x4D 'M'
+  {  1324,  22,  20,  21,    2,  -19 },   // 0x4E 'N'
+  {  1379,  17,  20,  21,    4,  -19 },   // 0x4F 'O'
+  {  1416,  18,  20,  21,    2,  -19 },   // 0x50 'P'
+  {  1449,  17,  24,  21,    4,  -19 },   // 0x51 'Q'
+  {  1492,  18,  20,  21,    2,  -19 },   // 0x52 'R'
+  {  1530,  18,  20,  21,    3,  -19 },   // 0x53 'S'
+  {  1567,  17,  20,  21,    5,  -19 },   // 0x54 'T'
+  {  1603,  18,  20,  21,    5,  -19 },   // 0x55 'U'
+  {  1643,  21,  20,  21,    4,  -19 },   // 0x56 'V'
+  {  1684,  20,  20,  21,    4,  -19 },   // 0x57 'W'
+  {  1749,  21,  20,  21,    2,  -19 },   // 0x58 'X'
+  {  1790,  18,  20,  21,    5,  -19 },   // 0x59 'Y'
+  {  1824,  17,  20,  21,    4,  -19 },   // 0x5A 'Z'
+  {  1857,  11,  25,  21,    9,  -20 },   // 0x5B '['
+  {  1883,   8,  27,  21,    9,  -22 },   // 0x5C '\'
+  {  1910,  11,  25,  21,    5,  -20 },   // 0x5D ']'
+  {  1936,  13,   9,  21,    7,  -20 },   // 0x5E '^'
+  {  1951,  21,   1,  21,   -1,    4 },   // 0x5F '_'
+  {  1953,   5,   5,  21,    9,  -21 },   // 0x60 '`'
+  {  1958,  16,  15,  21,    3,  -14 },   // 0x61 'a'
+  {  1985,  19,  21,  21,    1,  -20 },   // 0x62 'b'
+  {  2028,  17,  15,  21,    4,  -14 },   // 0x63 'c'
+  {  2055,  18,  21,  21,    4,  -20 },   // 0x64 'd'
+  {  2098,  16,  15,  21,    4,  -14 },   // 0x65 'e'
+  {  2121,  19,  21,  21,    4,  -20 },   // 0x66 'f'
+  {  2151,  19,  22,  21,    4,  -14 },   // 0x67 'g'
+  {  2195,  18,  21,  21,    2,  -20 },   // 0x68 'h'
+  {  2236,  15,  22,  21,    3,  -21 },   // 0x69 'i'
+  {  2257,  15,  29,  21,    3,  -21 },   // 0x6A 'j'
+  {  2285,  18,  21,  21,    2,  -20 },   // 0x6B 'k'
+  {  2325,  15,  21,  21,    3,  -20 },   // 0x6C 'l'
+  {  2347,  20,  15,  21,    1,  -14 },   // 0x6D 'm'
+  {  2392,  17,  15,  21,    2,  -14 },   // 0x6E 'n'
+  {  2423,  16,  15,  21,    4,  -14 },   // 0x6F 'o'
+  {  2448,  20,  22,  21,    0,  -14 },   // 0x70 'p'
+  {  2492,  19,  22,  21,    4,  -14 },   // 0x71 'q'
+  {  2537,  19,  15,  21,    3,  -14 },   // 0x72 'r'
+  {  2562,  15,  15,  21,    4,  -14 },   // 0x73 's'
+  {  2587,  13,  20,  21,    5,  -19 },   // 0x74 't'
+  {  2610,  15,  15,  21,    4,  -14 },   // 0x75 'u'
+  {  2641,  19,  15,  21,    4,  -14 },   // 0x76 'v'
+  {  2672,  17,  15,  21,    5,  -14 },   // 0x77 'w'
+  {  2719,  19,  15,  21,    2,  -14 },   // 0x78 'x'
+  {  2748,  21,  22,  21,    1,  -14 },   // 0x79 'y'
+  {  2789,  16,  15,  21,    4,  -14 },   // 0x7A 'z'
+  {  2811,  11,  25,  21,    8,  -20 },   // 0x7B '{'
+  {  2837,   6,  24,  21,    9,  -19 },   // 0x7C '|'
+  {  2861,  10,  25,  21,    6,  -20 },   // 0x7D '}'
+  {  2887,  15,   5,  21,    5,  -11 } }; // 0x7E '~'
 
 const GFXfont FreeMonoOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique18pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique18pt7bGlyphs,
-  0x20, 0x7E, 35 };
+  0x20, 0x7E, 35, 1,
+  NULL, 0, 1 };
 
-// Approx. 4186 bytes
+// Approx. 3573 bytes
@@ -182,6 +182,7 @@ const GFXglyph FreeMonoOblique9pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeMonoOblique9pt7b PROGMEM = {
   (uint8_t  *)FreeMonoOblique9pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique9pt7bGlyphs,
-  0x20, 0x7E, 18 };
+  0x20, 0x7E, 18, 1,
+  NULL, 0, 0 };
 
 // Approx. 1654 bytes
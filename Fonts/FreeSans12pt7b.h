@@ -265,6 +265,7 @@ const GFXglyph FreeSans12pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeSans12pt7b PROGMEM = {
   (uint8_t  *)FreeSans12pt7bBitmaps,
   (GFXglyph *)FreeSans12pt7bGlyphs,
-  0x20, 0x7E, 29 };
+  0x20, 0x7E, 29, 1,
+  NULL, 0, 0 };
 
 // Approx. 2641 bytes
@@ -1,452 +1,349 @@
 const uint8_t FreeSans18pt7bBitmaps[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x3F, 0xFC, 0xE3, 0xF1,
-  0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8E, 0x82, 0x41, 0x00, 0x01, 0xC3, 0x80,
-  0x38, 0x70, 0x06, 0x0E, 0x00, 0xC1, 0x80, 0x38, 0x70, 0x07, 0x0E, 0x0F,
-  0xFF, 0xF9, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0xE1, 0xC0, 0x1C, 0x38, 0x03,
-  0x87, 0x00, 0x70, 0xE0, 0x0C, 0x18, 0x3F, 0xFF, 0xF7, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xC1, 0xC3, 0x80, 0x30, 0x60, 0x06, 0x0C, 0x01, 0xC3, 0x80, 0x38,
-  0x70, 0x07, 0x0E, 0x00, 0xC1, 0x80, 0x03, 0x00, 0x0F, 0xC0, 0x3F, 0xF0,
-  0x3F, 0xF8, 0x7B, 0x3C, 0xF3, 0x1C, 0xE3, 0x0E, 0xE3, 0x0E, 0xE3, 0x0E,
-  0xE3, 0x00, 0xE3, 0x00, 0xF3, 0x00, 0x7B, 0x00, 0x7F, 0x80, 0x1F, 0xF0,
-  0x07, 0xFC, 0x03, 0x7E, 0x03, 0x0F, 0x03, 0x07, 0xE3, 0x07, 0xE3, 0x07,
-  0xE3, 0x07, 0xE3, 0x0F, 0x73, 0x3E, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xE0,
-  0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x78, 0x00,
-  0xE0, 0x0F, 0xF0, 0x06, 0x00, 0xFF, 0xC0, 0x70, 0x07, 0x0E, 0x07, 0x00,
-  0x70, 0x38, 0x38, 0x03, 0x00, 0xC3, 0x80, 0x18, 0x06, 0x1C, 0x00, 0xE0,
-  0x71, 0xC0, 0x03, 0x87, 0x8C, 0x00, 0x1F, 0xF8, 0xE0, 0x00, 0x7F, 0x86,
-  0x00, 0x01, 0xF8, 0x70, 0x00, 0x00, 0x03, 0x03, 0xC0, 0x00, 0x38, 0x7F,
-  0x80, 0x01, 0x87, 0xFE, 0x00, 0x1C, 0x38, 0x70, 0x00, 0xC3, 0x81, 0xC0,
-  0x0E, 0x18, 0x06, 0x00, 0xE0, 0xC0, 0x30, 0x07, 0x07, 0x03, 0x80, 0x70,
-  0x1C, 0x38, 0x03, 0x80, 0xFF, 0xC0, 0x38, 0x03, 0xFC, 0x01, 0x80, 0x07,
-  0x80, 0x01, 0xF0, 0x00, 0x7F, 0x80, 0x0F, 0xFC, 0x01, 0xE1, 0xE0, 0x1C,
-  0x0E, 0x01, 0xC0, 0xE0, 0x1C, 0x0E, 0x01, 0xE1, 0xE0, 0x0E, 0x3C, 0x00,
-  0x77, 0x80, 0x07, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0xE0, 0x03, 0xCF, 0x1C,
-  0x78, 0x79, 0xC7, 0x03, 0xDC, 0xE0, 0x1F, 0x8E, 0x00, 0xF8, 0xE0, 0x0F,
-  0x0E, 0x00, 0x70, 0xF0, 0x0F, 0x87, 0xC3, 0xFC, 0x7F, 0xFD, 0xC3, 0xFF,
-  0x0E, 0x0F, 0xC0, 0xF0, 0xFF, 0xFF, 0xFA, 0x40, 0x06, 0x06, 0x0C, 0x0C,
-  0x18, 0x18, 0x38, 0x30, 0x70, 0x70, 0x70, 0x60, 0xE0, 0xE0, 0xE0, 0xE0,
-  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0x70, 0x70, 0x70, 0x30, 0x38, 0x18,
-  0x18, 0x0C, 0x0C, 0x06, 0x03, 0xC0, 0x60, 0x30, 0x30, 0x38, 0x18, 0x1C,
-  0x0C, 0x0E, 0x0E, 0x0E, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x06, 0x0E, 0x0E, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x30, 0x30,
-  0x60, 0xC0, 0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xC7, 0x81, 0xE0, 0xEC,
-  0x73, 0x88, 0x40, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-  0x80, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01,
-  0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xFF,
-  0xF6, 0xDA, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xC0, 0x30, 0x18,
-  0x06, 0x01, 0x80, 0xC0, 0x30, 0x0C, 0x06, 0x01, 0x80, 0x60, 0x30, 0x0C,
-  0x03, 0x00, 0xC0, 0x60, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x30, 0x18, 0x06,
-  0x01, 0x80, 0xC0, 0x30, 0x00, 0x07, 0xE0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3C,
-  0x3C, 0x78, 0x1E, 0x70, 0x0E, 0x70, 0x0E, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
-  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0,
-  0x07, 0xE0, 0x07, 0xE0, 0x0F, 0x70, 0x0E, 0x70, 0x0E, 0x78, 0x1E, 0x3C,
-  0x3C, 0x1F, 0xF8, 0x1F, 0xF0, 0x07, 0xE0, 0x03, 0x03, 0x07, 0x0F, 0x3F,
-  0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xE0, 0x1F, 0xF8,
-  0x3F, 0xFC, 0x7C, 0x3E, 0x70, 0x0F, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07,
-  0x00, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8,
-  0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x70, 0x00,
-  0x60, 0x00, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0,
-  0x07, 0xFE, 0x07, 0xFF, 0x87, 0x83, 0xC3, 0x80, 0xF3, 0x80, 0x39, 0xC0,
-  0x1C, 0xE0, 0x0E, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x7F, 0x00, 0x3F, 0x00,
-  0x1F, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0xF0, 0x01,
-  0xF8, 0x00, 0xFE, 0x00, 0x77, 0x00, 0x73, 0xE0, 0xF8, 0xFF, 0xF8, 0x3F,
-  0xF8, 0x07, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x00, 0xF8,
-  0x00, 0xF8, 0x01, 0xF8, 0x03, 0xB8, 0x03, 0x38, 0x07, 0x38, 0x0E, 0x38,
-  0x1C, 0x38, 0x18, 0x38, 0x38, 0x38, 0x70, 0x38, 0x60, 0x38, 0xE0, 0x38,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x1F, 0xFF, 0x0F, 0xFF, 0x8F, 0xFF,
-  0xC7, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x39,
-  0xF0, 0x3F, 0xFE, 0x1F, 0xFF, 0x8F, 0x83, 0xE7, 0x00, 0xF0, 0x00, 0x3C,
-  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xFC, 0x00,
-  0xEF, 0x00, 0x73, 0xC0, 0xF0, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xE0, 0x00,
-  0x03, 0xE0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3C, 0x1E, 0x38, 0x0E, 0x70, 0x0E,
-  0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xE3, 0xE0, 0xEF, 0xF8, 0xFF, 0xFC,
-  0xFC, 0x3E, 0xF0, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
-  0x60, 0x07, 0x70, 0x0F, 0x70, 0x0E, 0x3C, 0x3E, 0x3F, 0xFC, 0x1F, 0xF8,
-  0x07, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x00, 0x0E,
-  0x00, 0x1C, 0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0,
-  0x00, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00,
-  0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0C, 0x00,
-  0x1C, 0x00, 0x1C, 0x00, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x87, 0x83,
-  0xC7, 0x80, 0xF3, 0x80, 0x39, 0xC0, 0x1C, 0xE0, 0x0E, 0x78, 0x0F, 0x1E,
-  0x0F, 0x07, 0xFF, 0x01, 0xFF, 0x03, 0xFF, 0xE3, 0xE0, 0xF9, 0xC0, 0x1D,
-  0xC0, 0x0F, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0xF7, 0x00,
-  0x73, 0xE0, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x07, 0xE0,
-  0x1F, 0xF8, 0x3F, 0xFC, 0x7C, 0x3C, 0x70, 0x0E, 0xF0, 0x0E, 0xE0, 0x06,
-  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0x70, 0x0F, 0x78, 0x3F,
-  0x3F, 0xFF, 0x1F, 0xF7, 0x07, 0xC7, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E,
-  0x70, 0x0E, 0x70, 0x1C, 0x78, 0x3C, 0x3F, 0xF8, 0x1F, 0xF0, 0x07, 0xC0,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x07, 0xFF, 0xB6, 0xD6, 0x00, 0x00, 0x80, 0x03, 0xC0, 0x07, 0xE0,
-  0x0F, 0xC0, 0x3F, 0x80, 0x7E, 0x00, 0xFC, 0x01, 0xF0, 0x00, 0xE0, 0x00,
-  0x7C, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00,
-  0x7E, 0x00, 0x0F, 0x00, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x80, 0x80, 0x00, 0x70, 0x00, 0x3E, 0x00, 0x0F, 0xE0, 0x00, 0xFC,
-  0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0x80, 0x0F, 0xC0,
-  0x1F, 0x80, 0x7F, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x01, 0xC0, 0x00,
-  0x80, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0xE1, 0xFF, 0xE3, 0xC3, 0xEF, 0x01,
-  0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0xF0,
-  0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0E,
-  0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x03, 0x80,
-  0x07, 0x00, 0x0E, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0xC0, 0x01, 0xF8, 0x0F, 0xE0, 0x03, 0xE0, 0x01, 0xF0,
-  0x07, 0x80, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x1E,
-  0x3C, 0x03, 0xE0, 0x1E, 0x38, 0x0F, 0xF3, 0x8E, 0x78, 0x1E, 0x3F, 0x0F,
-  0x70, 0x38, 0x1F, 0x07, 0x70, 0x78, 0x0F, 0x07, 0xE0, 0x70, 0x0E, 0x07,
-  0xE0, 0x70, 0x0E, 0x07, 0xE0, 0xE0, 0x0E, 0x07, 0xE0, 0xE0, 0x1C, 0x07,
-  0xE0, 0xE0, 0x1C, 0x0E, 0xE0, 0xE0, 0x1C, 0x0E, 0xE0, 0xE0, 0x38, 0x1C,
-  0xF0, 0x70, 0x78, 0x3C, 0x70, 0x78, 0xFC, 0x78, 0x78, 0x3F, 0xDF, 0xF0,
-  0x38, 0x1F, 0x0F, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-  0x0F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x0E, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x03,
-  0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xDC, 0x00, 0x07, 0x78,
-  0x00, 0x3C, 0xE0, 0x00, 0xE3, 0x80, 0x03, 0x8F, 0x00, 0x1E, 0x1C, 0x00,
-  0x70, 0x70, 0x01, 0xC1, 0xE0, 0x0E, 0x03, 0x80, 0x38, 0x0E, 0x00, 0xE0,
-  0x3C, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x83, 0xC0, 0x0E,
-  0x0E, 0x00, 0x3C, 0x78, 0x00, 0xF1, 0xE0, 0x01, 0xC7, 0x00, 0x07, 0xBC,
-  0x00, 0x1E, 0xF0, 0x00, 0x3B, 0x80, 0x00, 0xF0, 0xFF, 0xFC, 0x1F, 0xFF,
-  0xE3, 0xFF, 0xFE, 0x70, 0x03, 0xCE, 0x00, 0x3D, 0xC0, 0x03, 0xB8, 0x00,
-  0x77, 0x00, 0x0E, 0xE0, 0x01, 0xDC, 0x00, 0x73, 0x80, 0x1E, 0x7F, 0xFF,
-  0x8F, 0xFF, 0xF1, 0xFF, 0xFF, 0x38, 0x00, 0xF7, 0x00, 0x0E, 0xE0, 0x00,
-  0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x03,
-  0xF8, 0x00, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF, 0x1F, 0xFF, 0x80, 0x00, 0xFF,
-  0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFE, 0x07, 0xE0, 0x7C, 0x3E, 0x00, 0x78,
-  0xF0, 0x00, 0xE7, 0x80, 0x03, 0xDC, 0x00, 0x07, 0x70, 0x00, 0x03, 0x80,
-  0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00,
-  0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x1D, 0xC0, 0x00, 0x77,
-  0x00, 0x03, 0xDE, 0x00, 0x0E, 0x3C, 0x00, 0x78, 0xF8, 0x03, 0xC1, 0xF8,
-  0x1F, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0xF8,
-  0x0F, 0xFF, 0xE0, 0xFF, 0xFF, 0x0E, 0x00, 0xF8, 0xE0, 0x03, 0xCE, 0x00,
-  0x1C, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xFE, 0x00, 0x07, 0xE0,
-  0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0x7E,
-  0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xE0, 0x00, 0xEE, 0x00, 0x0E,
-  0xE0, 0x01, 0xEE, 0x00, 0x3C, 0xE0, 0x0F, 0x8F, 0xFF, 0xF0, 0xFF, 0xFE,
-  0x0F, 0xFF, 0x80, 0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0x80, 0x00,
-  0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38,
-  0x00, 0x0E, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xEE, 0x00,
-  0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00,
-  0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0E, 0x00,
-  0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38,
-  0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 0xF3, 0x80, 0x01, 0xC0, 0x00,
-  0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00,
-  0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x7F,
-  0x80, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x0F, 0x80, 0xFC, 0x1E, 0x00,
-  0x3E, 0x3C, 0x00, 0x0E, 0x78, 0x00, 0x0F, 0x70, 0x00, 0x07, 0x70, 0x00,
-  0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x03,
-  0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xF0, 0x00,
-  0x07, 0x70, 0x00, 0x07, 0x70, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0x3C, 0x00,
-  0x1F, 0x1E, 0x00, 0x3F, 0x0F, 0xC0, 0xF7, 0x07, 0xFF, 0xE7, 0x03, 0xFF,
-  0xC3, 0x00, 0xFF, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0,
-  0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0,
-  0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80,
-  0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00,
-  0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00,
-  0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0,
-  0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1F, 0x80, 0x7E,
-  0x01, 0xF8, 0x07, 0xE0, 0x1F, 0xC0, 0xF7, 0x87, 0x9F, 0xFE, 0x3F, 0xF0,
-  0x3F, 0x00, 0xE0, 0x01, 0xEE, 0x00, 0x3C, 0xE0, 0x07, 0x8E, 0x00, 0xF0,
-  0xE0, 0x1E, 0x0E, 0x03, 0xE0, 0xE0, 0x7C, 0x0E, 0x0F, 0x80, 0xE1, 0xF0,
-  0x0E, 0x1E, 0x00, 0xE3, 0xC0, 0x0E, 0x7C, 0x00, 0xEF, 0xE0, 0x0F, 0xCE,
-  0x00, 0xF8, 0xF0, 0x0F, 0x07, 0x80, 0xE0, 0x3C, 0x0E, 0x03, 0xC0, 0xE0,
-  0x1E, 0x0E, 0x00, 0xF0, 0xE0, 0x0F, 0x0E, 0x00, 0x78, 0xE0, 0x03, 0xCE,
-  0x00, 0x3C, 0xE0, 0x01, 0xEE, 0x00, 0x0F, 0xE0, 0x01, 0xC0, 0x03, 0x80,
-  0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01,
-  0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70,
-  0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00,
-  0x38, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0x00, 0x1F, 0xF8,
-  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
-  0x00, 0x3F, 0xEE, 0x00, 0x77, 0xEE, 0x00, 0x77, 0xEE, 0x00, 0x77, 0xE7,
-  0x00, 0xE7, 0xE7, 0x00, 0xE7, 0xE7, 0x00, 0xE7, 0xE3, 0x81, 0xC7, 0xE3,
-  0x81, 0xC7, 0xE3, 0x81, 0xC7, 0xE1, 0xC3, 0x87, 0xE1, 0xC3, 0x87, 0xE1,
-  0xC3, 0x87, 0xE0, 0xE7, 0x07, 0xE0, 0xE7, 0x07, 0xE0, 0xE7, 0x07, 0xE0,
-  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x3C, 0x07, 0xE0,
-  0x3C, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0xC0, 0x07,
-  0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xEF, 0x00, 0x7E, 0x70, 0x07, 0xE7, 0x80,
-  0x7E, 0x3C, 0x07, 0xE1, 0xC0, 0x7E, 0x1E, 0x07, 0xE0, 0xE0, 0x7E, 0x0F,
-  0x07, 0xE0, 0x78, 0x7E, 0x03, 0x87, 0xE0, 0x3C, 0x7E, 0x01, 0xE7, 0xE0,
-  0x0E, 0x7E, 0x00, 0xF7, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE,
-  0x00, 0x1F, 0xE0, 0x01, 0xFE, 0x00, 0x0F, 0x00, 0x7F, 0x00, 0x01, 0xFF,
-  0xF0, 0x01, 0xFF, 0xFC, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0,
-  0x00, 0xF1, 0xE0, 0x00, 0x3C, 0xE0, 0x00, 0x0E, 0x70, 0x00, 0x07, 0x70,
-  0x00, 0x03, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-  0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03,
-  0xB8, 0x00, 0x03, 0x9C, 0x00, 0x01, 0xCF, 0x00, 0x01, 0xE3, 0xC0, 0x01,
-  0xE0, 0xF0, 0x01, 0xE0, 0x3E, 0x03, 0xE0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF,
-  0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3,
-  0x80, 0x3E, 0xE0, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0,
-  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x1E, 0xFF, 0xFF, 0x3F, 0xFF,
-  0x8F, 0xFF, 0xC3, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03,
-  0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0,
-  0x00, 0x38, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xFF,
-  0xFC, 0x01, 0xF0, 0x1F, 0x01, 0xE0, 0x03, 0xC1, 0xE0, 0x00, 0xF1, 0xE0,
-  0x00, 0x3C, 0xE0, 0x00, 0x0E, 0x70, 0x00, 0x07, 0x70, 0x00, 0x01, 0xF8,
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F,
-  0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xB8, 0x00, 0x03,
-  0x9C, 0x00, 0x01, 0xCF, 0x00, 0x39, 0xE3, 0xC0, 0x1F, 0xE0, 0xF0, 0x07,
-  0xE0, 0x3E, 0x03, 0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xEE, 0x00, 0x3F,
-  0x83, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x20, 0xFF, 0xFE, 0x0F, 0xFF,
-  0xF8, 0xFF, 0xFF, 0xCE, 0x00, 0x3C, 0xE0, 0x01, 0xEE, 0x00, 0x0E, 0xE0,
-  0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x01, 0xCE,
-  0x00, 0x3C, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8E, 0x00, 0x3C,
-  0xE0, 0x01, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x00,
-  0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0xE0, 0x00, 0xFE, 0x00,
-  0x0F, 0x03, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0x83, 0xE0, 0x7C, 0x38,
-  0x01, 0xE7, 0x00, 0x0E, 0x70, 0x00, 0xE7, 0x00, 0x00, 0x70, 0x00, 0x07,
-  0x80, 0x00, 0x3E, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xF8,
-  0x00, 0x3F, 0xE0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xE0, 0x00,
-  0x7E, 0x00, 0x07, 0xF0, 0x00, 0x77, 0x80, 0x0E, 0x7C, 0x03, 0xE3, 0xFF,
-  0xFC, 0x1F, 0xFF, 0x80, 0x3F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x80, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07,
-  0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E,
-  0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C,
-  0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38,
-  0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0xE0, 0x00, 0xFC, 0x00,
-  0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
-  0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00,
-  0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00,
-  0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x1E, 0xF0, 0x07,
-  0x9F, 0x01, 0xF1, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0x7F, 0x00, 0xE0, 0x00,
-  0x7F, 0x80, 0x03, 0xFC, 0x00, 0x1C, 0xE0, 0x01, 0xE7, 0x80, 0x0F, 0x3C,
-  0x00, 0x70, 0xE0, 0x07, 0x87, 0x80, 0x3C, 0x1C, 0x01, 0xC0, 0xE0, 0x0E,
-  0x07, 0x80, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x38, 0x07, 0x83, 0x80, 0x1C,
-  0x1C, 0x00, 0xE0, 0xE0, 0x07, 0x8E, 0x00, 0x1C, 0x70, 0x00, 0xE3, 0x80,
-  0x07, 0xB8, 0x00, 0x1D, 0xC0, 0x00, 0xEE, 0x00, 0x07, 0xE0, 0x00, 0x1F,
-  0x00, 0x00, 0xF8, 0x00, 0x03, 0x80, 0x00, 0x70, 0x03, 0xC0, 0x0F, 0x70,
-  0x03, 0xC0, 0x0F, 0x78, 0x03, 0xE0, 0x0F, 0x78, 0x03, 0xE0, 0x0E, 0x38,
-  0x07, 0xE0, 0x0E, 0x38, 0x07, 0xF0, 0x1E, 0x3C, 0x07, 0x70, 0x1E, 0x3C,
-  0x07, 0x70, 0x1C, 0x1C, 0x0E, 0x70, 0x1C, 0x1C, 0x0E, 0x38, 0x3C, 0x1C,
-  0x0E, 0x38, 0x3C, 0x1E, 0x1E, 0x38, 0x38, 0x0E, 0x1C, 0x38, 0x38, 0x0E,
-  0x1C, 0x1C, 0x38, 0x0E, 0x1C, 0x1C, 0x78, 0x0F, 0x3C, 0x1C, 0x70, 0x07,
-  0x38, 0x0E, 0x70, 0x07, 0x38, 0x0E, 0x70, 0x07, 0x38, 0x0E, 0x70, 0x07,
-  0x70, 0x0E, 0xE0, 0x03, 0xF0, 0x07, 0xE0, 0x03, 0xF0, 0x07, 0xE0, 0x03,
-  0xF0, 0x07, 0xE0, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0xE0, 0x03, 0xC0, 0x01,
-  0xE0, 0x03, 0xC0, 0xF0, 0x00, 0x7B, 0xC0, 0x07, 0x8F, 0x00, 0x38, 0x78,
-  0x03, 0xC1, 0xE0, 0x3C, 0x07, 0x81, 0xC0, 0x3C, 0x1E, 0x00, 0xF1, 0xE0,
-  0x03, 0x8E, 0x00, 0x1E, 0xF0, 0x00, 0x7F, 0x00, 0x01, 0xF0, 0x00, 0x0F,
-  0x80, 0x00, 0x7C, 0x00, 0x07, 0xF0, 0x00, 0x3B, 0x80, 0x03, 0xDE, 0x00,
-  0x3C, 0x78, 0x01, 0xC1, 0xC0, 0x1E, 0x0F, 0x01, 0xE0, 0x3C, 0x0E, 0x00,
-  0xE0, 0xF0, 0x07, 0x8F, 0x00, 0x1E, 0x70, 0x00, 0xF7, 0x80, 0x03, 0xC0,
-  0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x78, 0xF0, 0x01, 0xE1, 0xE0, 0x03, 0x81,
-  0xE0, 0x0F, 0x01, 0xC0, 0x1C, 0x03, 0xC0, 0x78, 0x03, 0xC1, 0xE0, 0x07,
-  0x83, 0x80, 0x07, 0x8F, 0x00, 0x07, 0x1C, 0x00, 0x0F, 0x78, 0x00, 0x0E,
-  0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
-  0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80,
-  0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00,
-  0x00, 0x70, 0x00, 0x7F, 0xFF, 0xEF, 0xFF, 0xFD, 0xFF, 0xFF, 0x80, 0x00,
-  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E,
-  0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-  0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x7C, 0x00,
-  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xE3, 0x8E, 0x38, 0xE3,
-  0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3,
-  0x8E, 0x38, 0xE3, 0x8F, 0xFF, 0xFC, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x60,
-  0x0C, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x01, 0x80, 0x20, 0x0C, 0x03, 0x00,
-  0x40, 0x18, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x06,
-  0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
-  0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
-  0x1C, 0x7F, 0xFF, 0xFC, 0x07, 0x00, 0x78, 0x03, 0xC0, 0x3F, 0x01, 0xD8,
-  0x0C, 0xE0, 0xE3, 0x06, 0x1C, 0x70, 0xE3, 0x83, 0x18, 0x1D, 0xC0, 0x6C,
-  0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0xF0, 0xE0, 0xE0,
-  0xE0, 0x07, 0xF0, 0x0F, 0xFC, 0x0F, 0xFF, 0x0F, 0x03, 0xC7, 0x00, 0xE0,
-  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0xFE, 0x0F, 0xFF, 0x1F, 0xF3,
-  0x9F, 0x01, 0xCF, 0x00, 0xE7, 0x00, 0x73, 0x80, 0x79, 0xE0, 0xFC, 0x7F,
-  0xEF, 0x9F, 0xE3, 0xC7, 0xE1, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
-  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE3, 0xE0, 0xEF, 0xF8,
-  0xFF, 0xFC, 0xFC, 0x3E, 0xF8, 0x1E, 0xF0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07,
-  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0E,
-  0xF8, 0x1E, 0xFC, 0x3C, 0xEF, 0xFC, 0xEF, 0xF8, 0xE3, 0xE0, 0x07, 0xF0,
-  0x1F, 0xF8, 0x3F, 0xFC, 0x3C, 0x1E, 0x78, 0x0E, 0x70, 0x07, 0xE0, 0x00,
-  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x07,
-  0x70, 0x07, 0x78, 0x0E, 0x7C, 0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0,
-  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
-  0x1C, 0x00, 0x0E, 0x0F, 0xC7, 0x1F, 0xFB, 0x9F, 0xFF, 0xDF, 0x07, 0xEF,
-  0x01, 0xF7, 0x00, 0x7F, 0x80, 0x3F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03,
-  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x77, 0x00, 0x7B, 0xC0, 0x7D, 0xF0,
-  0x7E, 0x7F, 0xFB, 0x1F, 0xF9, 0x83, 0xF0, 0xC0, 0x07, 0xE0, 0x1F, 0xF8,
-  0x3F, 0xFC, 0x7C, 0x1E, 0x70, 0x0E, 0x60, 0x06, 0xE0, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x07,
-  0x78, 0x0E, 0x3C, 0x1E, 0x3F, 0xFC, 0x1F, 0xF8, 0x07, 0xE0, 0x0E, 0x3C,
-  0xF9, 0xC3, 0x87, 0x0E, 0x7F, 0xFF, 0xFC, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
-  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0x07, 0xC7, 0x1F,
-  0xF7, 0x3F, 0xFF, 0x3C, 0x3F, 0x78, 0x0F, 0x70, 0x0F, 0xE0, 0x07, 0xE0,
-  0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x70,
-  0x0F, 0x78, 0x0F, 0x7C, 0x3F, 0x3F, 0xF7, 0x1F, 0xE7, 0x07, 0xC7, 0x00,
-  0x07, 0x00, 0x07, 0x00, 0x0E, 0x70, 0x0E, 0x78, 0x1E, 0x3F, 0xFC, 0x1F,
-  0xF8, 0x07, 0xE0, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
-  0x1C, 0x00, 0x38, 0x00, 0x71, 0xF8, 0xE7, 0xFD, 0xDF, 0xFB, 0xF0, 0xFF,
-  0xC0, 0xFF, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
-  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07,
-  0xE0, 0x0F, 0xC0, 0x1C, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x1C, 0x71, 0xC7, 0x00, 0x00, 0x07, 0x1C, 0x71, 0xC7, 0x1C,
-  0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
-  0x73, 0xFF, 0xFB, 0xC0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
-  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x3C, 0xE0, 0x78, 0xE0, 0xF0,
-  0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00, 0xEF, 0x80, 0xFF, 0x80,
-  0xFB, 0xC0, 0xF1, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0x70, 0xE0, 0x78,
-  0xE0, 0x3C, 0xE0, 0x1C, 0xE0, 0x1E, 0xE0, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE3, 0xE0, 0xF8, 0xE7, 0xF1, 0xFE,
-  0xEF, 0xFB, 0xFE, 0xF8, 0x7F, 0x0F, 0xF0, 0x3E, 0x07, 0xF0, 0x1C, 0x07,
-  0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07,
-  0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07,
-  0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07, 0xE0, 0x1C, 0x07,
-  0xE0, 0x1C, 0x07, 0xE3, 0xF1, 0xCF, 0xFB, 0xBF, 0xF7, 0xE1, 0xFF, 0x81,
-  0xFE, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F,
-  0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x0F, 0xC0,
-  0x1F, 0x80, 0x38, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x87, 0x83, 0xC7,
-  0x80, 0xF3, 0x80, 0x3B, 0x80, 0x1F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01,
-  0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3B, 0x80, 0x39, 0xE0, 0x3C, 0x78,
-  0x3C, 0x3F, 0xFE, 0x0F, 0xFE, 0x01, 0xFC, 0x00, 0xE3, 0xE0, 0xE7, 0xF8,
-  0xEF, 0xFC, 0xFC, 0x3E, 0xF8, 0x1E, 0xF0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07,
-  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0E,
-  0xF8, 0x1E, 0xFC, 0x3E, 0xFF, 0xFC, 0xEF, 0xF8, 0xE3, 0xE0, 0xE0, 0x00,
-  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x07, 0xE1,
-  0x8F, 0xFC, 0xCF, 0xFF, 0x67, 0x83, 0xF7, 0x80, 0xFB, 0x80, 0x3F, 0xC0,
-  0x1F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
-  0x00, 0x3B, 0x80, 0x3D, 0xE0, 0x3E, 0xF8, 0x3F, 0x3F, 0xFF, 0x8F, 0xFD,
-  0xC1, 0xF8, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
-  0x07, 0x00, 0x03, 0x80, 0xE3, 0xF7, 0xFB, 0xFF, 0x8F, 0x07, 0x83, 0x81,
-  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70,
-  0x38, 0x00, 0x0F, 0xC0, 0xFF, 0x87, 0xFF, 0x3C, 0x1E, 0xE0, 0x3B, 0x80,
-  0x0E, 0x00, 0x3C, 0x00, 0x7F, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x00,
-  0x3F, 0x80, 0x7E, 0x01, 0xFC, 0x1F, 0x7F, 0xF8, 0xFF, 0xC1, 0xFC, 0x00,
-  0x38, 0x70, 0xE1, 0xCF, 0xFF, 0xFF, 0x9C, 0x38, 0x70, 0xE1, 0xC3, 0x87,
-  0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0xE7, 0xC7, 0x80, 0xE0, 0x0F, 0xC0,
-  0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0xF0, 0x07,
-  0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x03, 0xFC,
-  0x0F, 0xFC, 0x3F, 0x7F, 0xEE, 0xFF, 0x9C, 0x7E, 0x38, 0x70, 0x03, 0xB8,
-  0x03, 0x9C, 0x01, 0xC7, 0x00, 0xE3, 0x80, 0xE1, 0xC0, 0x70, 0x70, 0x38,
-  0x38, 0x38, 0x1C, 0x1C, 0x07, 0x0E, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0x77,
-  0x00, 0x3B, 0x80, 0x1D, 0xC0, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00,
-  0x70, 0x00, 0xF0, 0x1C, 0x03, 0xB8, 0x1F, 0x03, 0xDC, 0x0F, 0x81, 0xCE,
-  0x07, 0xC0, 0xE7, 0x83, 0xE0, 0x71, 0xC3, 0xB8, 0x70, 0xE1, 0xDC, 0x38,
-  0x70, 0xEE, 0x1C, 0x1C, 0x63, 0x0E, 0x0E, 0x71, 0xCE, 0x07, 0x38, 0xE7,
-  0x03, 0x9C, 0x73, 0x80, 0xEC, 0x19, 0x80, 0x7E, 0x0F, 0xC0, 0x3F, 0x07,
-  0xE0, 0x0F, 0x83, 0xF0, 0x07, 0x80, 0xF0, 0x03, 0xC0, 0x78, 0x01, 0xE0,
-  0x3C, 0x00, 0x70, 0x07, 0x38, 0x0E, 0x3C, 0x1C, 0x1C, 0x1C, 0x0E, 0x38,
-  0x0F, 0x70, 0x07, 0x70, 0x03, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x03, 0xE0,
-  0x07, 0xE0, 0x07, 0x70, 0x0E, 0x78, 0x1E, 0x38, 0x1C, 0x1C, 0x38, 0x1E,
-  0x78, 0x0E, 0x70, 0x07, 0x70, 0x07, 0x38, 0x03, 0x9C, 0x01, 0xC7, 0x01,
-  0xC3, 0x80, 0xE1, 0xC0, 0x70, 0x70, 0x70, 0x38, 0x38, 0x1C, 0x3C, 0x07,
-  0x1C, 0x03, 0x8E, 0x01, 0xCE, 0x00, 0x77, 0x00, 0x3B, 0x80, 0x1F, 0x80,
-  0x07, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38,
-  0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x0F,
-  0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xF9, 0xFF, 0xF0, 0x00, 0xE0, 0x03, 0x80,
-  0x0E, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x1C, 0x00, 0x70,
-  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x07, 0x0F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-  0x1C, 0x1C, 0x1C, 0x1C, 0x38, 0xF8, 0xE0, 0xF8, 0x38, 0x1C, 0x1C, 0x1C,
-  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1F, 0x0F, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0xF8, 0x38,
-  0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x1F,
-  0x07, 0x1F, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-  0x38, 0x38, 0xF8, 0xF0, 0xE0, 0x38, 0x00, 0xFC, 0x03, 0xFC, 0x1F, 0x3E,
-  0x3C, 0x1F, 0xE0, 0x1F, 0x80, 0x1E, 0x00 };
+  0x0F, 0xFF, 0x61, 0x12, 0x12, 0x17, 0xC0, 0x03, 0x36, 0x36, 0x36, 0x36,
+  0x36, 0x36, 0x33, 0x11, 0x51, 0x21, 0x51, 0x10, 0x73, 0x43, 0x93, 0x43,
+  0x92, 0x53, 0x92, 0x52, 0x93, 0x43, 0x93, 0x43, 0x5F, 0x22, 0xF2, 0x2F,
+  0x25, 0x34, 0x39, 0x34, 0x39, 0x34, 0x39, 0x34, 0x39, 0x25, 0x25, 0xF3,
+  0x1F, 0x31, 0xF3, 0x53, 0x43, 0x92, 0x52, 0xA2, 0x52, 0x93, 0x43, 0x93,
+  0x43, 0x93, 0x43, 0x92, 0x52, 0x70, 0x62, 0xC6, 0x8A, 0x6B, 0x44, 0x12,
+  0x24, 0x24, 0x22, 0x33, 0x23, 0x32, 0x43, 0x13, 0x32, 0x43, 0x13, 0x32,
+  0x43, 0x13, 0x32, 0x83, 0x32, 0x84, 0x22, 0x94, 0x12, 0x98, 0xA9, 0x99,
+  0x82, 0x16, 0x72, 0x44, 0x62, 0x56, 0x32, 0x56, 0x32, 0x56, 0x32, 0x56,
+  0x32, 0x44, 0x13, 0x22, 0x25, 0x2D, 0x4B, 0x77, 0xB2, 0xE2, 0xE2, 0x80,
+  0xF5, 0x2B, 0x4B, 0x39, 0x89, 0x29, 0xA7, 0x39, 0x34, 0x36, 0x39, 0x36,
+  0x35, 0x39, 0x28, 0x24, 0x3A, 0x28, 0x24, 0x3A, 0x36, 0x33, 0x3C, 0x34,
+  0x43, 0x2D, 0xA3, 0x3E, 0x84, 0x2F, 0x16, 0x43, 0xFB, 0x26, 0x4F, 0x13,
+  0x48, 0xE2, 0x4A, 0xC3, 0x43, 0x43, 0xC2, 0x43, 0x63, 0xA3, 0x42, 0x82,
+  0x93, 0x52, 0x82, 0x93, 0x53, 0x63, 0x83, 0x73, 0x43, 0x93, 0x7A, 0x83,
+  0x98, 0x92, 0xC4, 0x40, 0x75, 0xD8, 0xBA, 0x94, 0x44, 0x83, 0x63, 0x83,
+  0x63, 0x83, 0x63, 0x84, 0x44, 0x93, 0x34, 0xB3, 0x14, 0xC7, 0xD5, 0xE7,
+  0xB4, 0x24, 0x33, 0x34, 0x44, 0x23, 0x33, 0x64, 0x13, 0x23, 0x86, 0x33,
+  0x95, 0x33, 0x94, 0x43, 0xA3, 0x44, 0x85, 0x45, 0x48, 0x3D, 0x13, 0x4A,
+  0x43, 0x56, 0x64, 0x0F, 0x61, 0x12, 0x11, 0x52, 0x62, 0x52, 0x62, 0x52,
+  0x62, 0x53, 0x52, 0x53, 0x53, 0x53, 0x52, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x62, 0x63, 0x53, 0x53, 0x62, 0x63, 0x62, 0x62,
+  0x72, 0x62, 0x72, 0x72, 0x02, 0x72, 0x72, 0x62, 0x63, 0x62, 0x63, 0x62,
+  0x63, 0x53, 0x53, 0x62, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x52, 0x53, 0x53, 0x53, 0x52, 0x53, 0x52, 0x53, 0x52, 0x62, 0x52,
+  0x52, 0x60, 0x42, 0x82, 0x82, 0x43, 0x12, 0x1D, 0x34, 0x64, 0x53, 0x12,
+  0x33, 0x23, 0x31, 0x41, 0x20, 0x72, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x7F,
+  0xFF, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x27, 0x0C, 0x12, 0x12,
+  0x12, 0x11, 0x12, 0x10, 0x0F, 0x90, 0x0C, 0x82, 0x82, 0x72, 0x82, 0x82,
+  0x72, 0x82, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x82, 0x82, 0x72, 0x82,
+  0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x82, 0x72, 0x82, 0x80, 0x56, 0x99,
+  0x6B, 0x44, 0x44, 0x34, 0x64, 0x23, 0x83, 0x23, 0x83, 0x13, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0x94, 0x13, 0x83, 0x23,
+  0x83, 0x24, 0x64, 0x34, 0x44, 0x5A, 0x69, 0x96, 0x50, 0x62, 0x62, 0x53,
+  0x44, 0x2F, 0x75, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x56, 0x8A, 0x5C,
+  0x35, 0x45, 0x23, 0x88, 0x87, 0xA6, 0xA3, 0xD3, 0xD3, 0xC4, 0xB4, 0xB4,
+  0xA5, 0x96, 0x95, 0x95, 0xA4, 0xC3, 0xC3, 0xD2, 0xD3, 0xDF, 0xFF, 0x30,
+  0x57, 0x9A, 0x6C, 0x44, 0x54, 0x43, 0x74, 0x23, 0x93, 0x23, 0x93, 0x23,
+  0x93, 0xE3, 0xC4, 0x97, 0xA6, 0xB8, 0xE4, 0xE4, 0xE3, 0xE6, 0xB6, 0xB7,
+  0xA3, 0x13, 0x93, 0x25, 0x55, 0x3D, 0x5B, 0x87, 0x50, 0xA3, 0xD3, 0xC4,
+  0xB5, 0xB5, 0xA6, 0x93, 0x13, 0x92, 0x23, 0x83, 0x23, 0x73, 0x33, 0x63,
+  0x43, 0x62, 0x53, 0x53, 0x53, 0x43, 0x63, 0x42, 0x73, 0x33, 0x73, 0x3F,
+  0xFF, 0x3A, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x33, 0x3D, 0x4D, 0x3E, 0x33,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x25, 0x6D, 0x4E, 0x35, 0x55, 0x23, 0x84,
+  0xE4, 0xE3, 0xE3, 0xE3, 0xE3, 0xE6, 0xA3, 0x14, 0x93, 0x24, 0x64, 0x4D,
+  0x5B, 0x86, 0x60, 0x65, 0x99, 0x6B, 0x44, 0x54, 0x33, 0x73, 0x23, 0x83,
+  0x23, 0xD2, 0xD3, 0xD3, 0x35, 0x53, 0x19, 0x3E, 0x26, 0x45, 0x14, 0x83,
+  0x14, 0x87, 0xA6, 0xA6, 0xA3, 0x12, 0xA3, 0x13, 0x84, 0x13, 0x83, 0x34,
+  0x45, 0x3C, 0x5A, 0x86, 0x50, 0x0F, 0xFF, 0x3D, 0x2D, 0x3C, 0x3D, 0x2D,
+  0x3C, 0x3D, 0x2D, 0x3D, 0x2D, 0x3D, 0x2D, 0x3D, 0x3C, 0x3D, 0x3D, 0x3C,
+  0x3D, 0x3D, 0x3D, 0x2D, 0x3D, 0x3A, 0x57, 0x8B, 0x5D, 0x44, 0x54, 0x34,
+  0x74, 0x23, 0x93, 0x23, 0x93, 0x23, 0x93, 0x24, 0x74, 0x34, 0x54, 0x5B,
+  0x79, 0x6D, 0x35, 0x55, 0x23, 0x93, 0x13, 0xA7, 0xB6, 0xB6, 0xB6, 0xA4,
+  0x13, 0x93, 0x25, 0x55, 0x3D, 0x5B, 0x87, 0x50, 0x56, 0x8A, 0x5C, 0x35,
+  0x44, 0x33, 0x83, 0x14, 0x83, 0x13, 0xA2, 0x13, 0xA6, 0xA6, 0xA6, 0x94,
+  0x13, 0x84, 0x14, 0x56, 0x2E, 0x39, 0x13, 0x55, 0x33, 0xD3, 0xD2, 0xD3,
+  0x23, 0x83, 0x23, 0x73, 0x34, 0x54, 0x4B, 0x69, 0x95, 0x60, 0x0C, 0xFF,
+  0x3C, 0x0C, 0xFF, 0x3C, 0x12, 0x12, 0x12, 0x11, 0x12, 0x10, 0xF1, 0x1D,
+  0x4B, 0x69, 0x68, 0x78, 0x69, 0x69, 0x5C, 0x3E, 0x5D, 0x7D, 0x6D, 0x7C,
+  0x7D, 0x6D, 0x4F, 0x02, 0x0F, 0xFF, 0x6F, 0xFF, 0x6F, 0xFF, 0x60, 0x01,
+  0xF1, 0x3E, 0x5D, 0x7D, 0x6D, 0x7C, 0x7D, 0x6D, 0x4B, 0x69, 0x68, 0x78,
+  0x69, 0x69, 0x6B, 0x3E, 0x1F, 0x10, 0x46, 0x7A, 0x4C, 0x34, 0x45, 0x14,
+  0x77, 0x96, 0x96, 0x93, 0xC3, 0xB3, 0xB4, 0x95, 0x95, 0x95, 0xA3, 0xB4,
+  0xB3, 0xC3, 0xC3, 0xFF, 0xFC, 0x3C, 0x3C, 0x3C, 0x37, 0xD8, 0xF6, 0xEF,
+  0x1F, 0x3D, 0x67, 0x7B, 0x5C, 0x59, 0x4F, 0x05, 0x74, 0xF3, 0x45, 0x4F,
+  0x54, 0x34, 0x85, 0x84, 0x33, 0x78, 0x23, 0x33, 0x24, 0x64, 0x36, 0x44,
+  0x13, 0x63, 0x65, 0x53, 0x13, 0x54, 0x74, 0x56, 0x63, 0x83, 0x66, 0x63,
+  0x83, 0x66, 0x53, 0x93, 0x66, 0x53, 0x83, 0x76, 0x53, 0x83, 0x63, 0x13,
+  0x53, 0x83, 0x63, 0x13, 0x53, 0x73, 0x63, 0x24, 0x53, 0x54, 0x54, 0x33,
+  0x54, 0x36, 0x34, 0x44, 0x58, 0x19, 0x63, 0x65, 0x46, 0x84, 0xFE, 0x5F,
+  0xD5, 0xFD, 0x78, 0x3F, 0x1F, 0x1F, 0x3E, 0xF5, 0x9C, 0x85, 0xF2, 0x5F,
+  0x26, 0xF0, 0x7F, 0x03, 0x13, 0xF0, 0x31, 0x4D, 0x42, 0x3D, 0x33, 0x3D,
+  0x33, 0x4B, 0x44, 0x3B, 0x35, 0x3B, 0x35, 0x49, 0x37, 0x39, 0x37, 0x39,
+  0x37, 0x47, 0xF0, 0x7F, 0x15, 0xF2, 0x54, 0xA3, 0x53, 0xB4, 0x34, 0xB4,
+  0x34, 0xC3, 0x33, 0xD4, 0x14, 0xD4, 0x14, 0xE3, 0x13, 0xF0, 0x40, 0x0E,
+  0x5F, 0x13, 0xF2, 0x23, 0xA4, 0x23, 0xB4, 0x13, 0xC3, 0x13, 0xC3, 0x13,
+  0xC3, 0x13, 0xC3, 0x13, 0xB3, 0x23, 0xA4, 0x2F, 0x13, 0xF1, 0x3F, 0x22,
+  0x3B, 0x41, 0x3C, 0x31, 0x3D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x7B, 0x41,
+  0xF2, 0x2F, 0x13, 0xE5, 0x88, 0xCC, 0x8F, 0x06, 0x66, 0x54, 0x5A, 0x43,
+  0x4C, 0x32, 0x4D, 0x41, 0x3F, 0x03, 0x13, 0xF3, 0x3F, 0x43, 0xF4, 0x3F,
+  0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF1, 0x31, 0x3F, 0x03, 0x13,
+  0xE4, 0x14, 0xD3, 0x34, 0xB4, 0x35, 0x94, 0x56, 0x65, 0x6F, 0x09, 0xCC,
+  0x77, 0x0D, 0x7F, 0x05, 0xF1, 0x43, 0x95, 0x33, 0xB4, 0x23, 0xC3, 0x23,
+  0xD3, 0x13, 0xD3, 0x13, 0xD7, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+  0xE6, 0xD7, 0xD3, 0x13, 0xD3, 0x13, 0xC4, 0x13, 0xB4, 0x23, 0x95, 0x3F,
+  0x14, 0xF0, 0x5D, 0x70, 0x0F, 0x21, 0xF2, 0x1F, 0x21, 0x3F, 0x03, 0xF0,
+  0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0xF2, 0x1F, 0x21,
+  0xF2, 0x13, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0,
+  0x3F, 0x03, 0xF0, 0xFF, 0xF9, 0x0F, 0xFF, 0x9E, 0x3E, 0x3E, 0x3E, 0x3E,
+  0x3E, 0x3E, 0x3E, 0xF0, 0x2F, 0x02, 0xF0, 0x23, 0xE3, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE0, 0x98, 0xDD, 0xAF, 0x17,
+  0x57, 0x65, 0x4B, 0x53, 0x4E, 0x32, 0x4F, 0x04, 0x13, 0xF2, 0x31, 0x3F,
+  0x53, 0xF6, 0x3F, 0x63, 0xF6, 0x3B, 0xDB, 0xDB, 0xDF, 0x37, 0xF2, 0x31,
+  0x3F, 0x23, 0x13, 0xF1, 0x41, 0x4F, 0x04, 0x24, 0xD5, 0x34, 0xB6, 0x46,
+  0x64, 0x13, 0x5E, 0x23, 0x6C, 0x42, 0x88, 0x62, 0x03, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xDF, 0xFF, 0xF3, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x0F, 0xFF,
+  0xFF, 0x30, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+  0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB6, 0x86, 0x86, 0x86, 0x87, 0x64,
+  0x14, 0x44, 0x2C, 0x3A, 0x66, 0x40, 0x03, 0xC4, 0x13, 0xB4, 0x23, 0xA4,
+  0x33, 0x94, 0x43, 0x84, 0x53, 0x75, 0x53, 0x65, 0x63, 0x55, 0x73, 0x45,
+  0x83, 0x44, 0x93, 0x34, 0xA3, 0x25, 0xA3, 0x17, 0x96, 0x23, 0x95, 0x34,
+  0x84, 0x54, 0x73, 0x74, 0x63, 0x74, 0x63, 0x84, 0x53, 0x94, 0x43, 0x94,
+  0x43, 0xA4, 0x33, 0xB4, 0x23, 0xB4, 0x23, 0xC4, 0x13, 0xD4, 0x03, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xCF, 0xFF, 0x00,
+  0x05, 0xEA, 0xEA, 0xEB, 0xCC, 0xCC, 0xC9, 0x13, 0xA3, 0x16, 0x13, 0xA3,
+  0x16, 0x13, 0xA3, 0x16, 0x23, 0x83, 0x26, 0x23, 0x83, 0x26, 0x23, 0x83,
+  0x26, 0x33, 0x63, 0x36, 0x33, 0x63, 0x36, 0x33, 0x63, 0x36, 0x43, 0x43,
+  0x46, 0x43, 0x43, 0x46, 0x43, 0x43, 0x46, 0x53, 0x23, 0x56, 0x53, 0x23,
+  0x56, 0x53, 0x23, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x74, 0x76,
+  0x74, 0x73, 0x04, 0xD7, 0xD8, 0xC9, 0xB9, 0xBA, 0xA6, 0x14, 0x96, 0x23,
+  0x96, 0x24, 0x86, 0x34, 0x76, 0x43, 0x76, 0x44, 0x66, 0x53, 0x66, 0x54,
+  0x56, 0x64, 0x46, 0x73, 0x46, 0x74, 0x36, 0x84, 0x26, 0x93, 0x26, 0x94,
+  0x16, 0xAA, 0xB9, 0xB9, 0xC8, 0xC8, 0xD4, 0x97, 0xF0, 0xDB, 0xF0, 0x95,
+  0x75, 0x74, 0xB4, 0x54, 0xD4, 0x34, 0xF0, 0x42, 0x3F, 0x23, 0x23, 0xF2,
+  0x31, 0x3F, 0x37, 0xF4, 0x6F, 0x46, 0xF4, 0x6F, 0x46, 0xF4, 0x6F, 0x46,
+  0xF4, 0x31, 0x3F, 0x23, 0x23, 0xF2, 0x32, 0x4F, 0x04, 0x34, 0xD4, 0x54,
+  0xB4, 0x75, 0x75, 0x9F, 0x0B, 0xDF, 0x07, 0x90, 0x0E, 0x4F, 0x03, 0xF1,
+  0x23, 0x95, 0x13, 0xB7, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xB7, 0xA4, 0x1F,
+  0x12, 0xF0, 0x3E, 0x43, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F,
+  0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x97, 0xF0, 0xDB, 0xF0,
+  0x95, 0x75, 0x74, 0xB4, 0x54, 0xD4, 0x34, 0xF0, 0x42, 0x3F, 0x23, 0x23,
+  0xF2, 0x31, 0x3F, 0x46, 0xF4, 0x6F, 0x46, 0xF4, 0x6F, 0x46, 0xF4, 0x6F,
+  0x46, 0xF3, 0x41, 0x3F, 0x23, 0x23, 0xF2, 0x32, 0x4A, 0x32, 0x43, 0x49,
+  0x85, 0x49, 0x67, 0x57, 0x68, 0xF3, 0x8D, 0x13, 0xB7, 0x53, 0xF8, 0x2F,
+  0x91, 0x10, 0x0F, 0x05, 0xF2, 0x3F, 0x32, 0x3B, 0x42, 0x3C, 0x41, 0x3D,
+  0x31, 0x3D, 0x31, 0x3D, 0x31, 0x3D, 0x31, 0x3D, 0x31, 0x3C, 0x32, 0x3B,
+  0x42, 0xF2, 0x3F, 0x14, 0xF2, 0x33, 0xB4, 0x23, 0xC4, 0x13, 0xD3, 0x13,
+  0xD3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3, 0x13, 0xD3, 0x13,
+  0xD7, 0xD4, 0x68, 0xAC, 0x7E, 0x55, 0x65, 0x43, 0xA4, 0x23, 0xC3, 0x23,
+  0xC3, 0x23, 0xF2, 0x3F, 0x24, 0xF2, 0x5F, 0x18, 0xDB, 0xBB, 0xD9, 0xF0,
+  0x5F, 0x24, 0xF2, 0x6E, 0x6E, 0x7D, 0x31, 0x4B, 0x32, 0x58, 0x53, 0xF1,
+  0x5E, 0x98, 0x60, 0x0F, 0xFF, 0xC8, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+  0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+  0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+  0x3F, 0x13, 0xF1, 0x38, 0x03, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+  0xD7, 0xB4, 0x14, 0x94, 0x25, 0x75, 0x3F, 0x05, 0xCA, 0x76, 0x03, 0xE8,
+  0xD8, 0xD3, 0x23, 0xC4, 0x24, 0xB4, 0x24, 0xB3, 0x43, 0xA4, 0x44, 0x94,
+  0x53, 0x93, 0x63, 0x93, 0x64, 0x73, 0x83, 0x73, 0x83, 0x73, 0x84, 0x53,
+  0xA3, 0x53, 0xA3, 0x53, 0xA4, 0x33, 0xC3, 0x33, 0xC3, 0x33, 0xC4, 0x13,
+  0xE3, 0x13, 0xE3, 0x13, 0xE6, 0xF1, 0x5F, 0x15, 0xF2, 0x39, 0x13, 0xA4,
+  0xA4, 0x13, 0xA4, 0xA4, 0x14, 0x95, 0x94, 0x14, 0x95, 0x93, 0x33, 0x86,
+  0x93, 0x33, 0x87, 0x74, 0x34, 0x73, 0x13, 0x74, 0x34, 0x73, 0x13, 0x73,
+  0x53, 0x63, 0x23, 0x73, 0x53, 0x63, 0x33, 0x54, 0x53, 0x63, 0x33, 0x54,
+  0x54, 0x44, 0x33, 0x53, 0x73, 0x43, 0x43, 0x53, 0x73, 0x43, 0x53, 0x43,
+  0x73, 0x43, 0x53, 0x34, 0x74, 0x24, 0x53, 0x33, 0x93, 0x23, 0x73, 0x23,
+  0x93, 0x23, 0x73, 0x23, 0x93, 0x23, 0x73, 0x23, 0x93, 0x13, 0x83, 0x13,
+  0xB6, 0x96, 0xB6, 0x96, 0xB6, 0x96, 0xB5, 0xB4, 0xD4, 0xB4, 0xD4, 0xB4,
+  0x60, 0x04, 0xD4, 0x14, 0xB4, 0x34, 0xA3, 0x44, 0x94, 0x54, 0x74, 0x74,
+  0x63, 0x84, 0x54, 0x94, 0x34, 0xB3, 0x33, 0xC4, 0x14, 0xD7, 0xF0, 0x5F,
+  0x15, 0xF1, 0x5F, 0x07, 0xE3, 0x13, 0xD4, 0x14, 0xB4, 0x34, 0xA3, 0x53,
+  0x94, 0x54, 0x74, 0x74, 0x63, 0x93, 0x54, 0x94, 0x34, 0xB4, 0x23, 0xC4,
+  0x14, 0xD4, 0x04, 0xE4, 0x24, 0xD4, 0x34, 0xB4, 0x44, 0xB3, 0x64, 0x94,
+  0x73, 0x93, 0x84, 0x74, 0x94, 0x54, 0xA4, 0x53, 0xC4, 0x34, 0xD3, 0x33,
+  0xE4, 0x14, 0xF0, 0x31, 0x3F, 0x25, 0xF3, 0x5F, 0x43, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53,
+  0xA0, 0x1F, 0x31, 0xF3, 0x1F, 0x3F, 0x04, 0xE4, 0xE5, 0xE4, 0xE4, 0xE4,
+  0xE4, 0xF0, 0x4E, 0x4E, 0x4E, 0x4F, 0x04, 0xE4, 0xE4, 0xE4, 0xE5, 0xE4,
+  0xE4, 0xE4, 0xE5, 0xEF, 0xFF, 0xC0, 0x0F, 0x63, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xF3, 0x02,
+  0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82, 0x91, 0x92,
+  0x82, 0x91, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x82, 0x92,
+  0x82, 0x0F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0xF6, 0x53, 0x94, 0x94, 0x86, 0x73, 0x12,
+  0x72, 0x23, 0x53, 0x32, 0x52, 0x43, 0x33, 0x43, 0x33, 0x52, 0x32, 0x63,
+  0x13, 0x72, 0x12, 0x83, 0x0F, 0xFC, 0x04, 0x44, 0x43, 0x53, 0x53, 0x57,
+  0x8A, 0x6C, 0x44, 0x64, 0x33, 0x83, 0xE3, 0xE3, 0xE3, 0xA7, 0x5C, 0x39,
+  0x23, 0x25, 0x73, 0x24, 0x83, 0x23, 0x93, 0x23, 0x84, 0x24, 0x56, 0x3A,
+  0x15, 0x28, 0x34, 0x36, 0x44, 0x03, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+  0xD3, 0x35, 0x53, 0x19, 0x3E, 0x26, 0x45, 0x15, 0x64, 0x14, 0x83, 0x13,
+  0x97, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0x83, 0x15, 0x64, 0x16, 0x44,
+  0x23, 0x1A, 0x23, 0x19, 0x33, 0x35, 0x50, 0x57, 0x7A, 0x5C, 0x44, 0x54,
+  0x24, 0x73, 0x23, 0x96, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xA3, 0x13,
+  0x93, 0x14, 0x73, 0x25, 0x54, 0x3C, 0x5A, 0x86, 0x50, 0xE3, 0xE3, 0xE3,
+  0xE3, 0xE3, 0xE3, 0xE3, 0x56, 0x33, 0x3A, 0x13, 0x2F, 0x01, 0x55, 0x61,
+  0x47, 0x51, 0x39, 0x89, 0x7B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x31, 0x39,
+  0x41, 0x47, 0x51, 0x55, 0x62, 0xC1, 0x23, 0xA2, 0x25, 0x64, 0x20, 0x56,
+  0x8A, 0x5C, 0x35, 0x54, 0x23, 0x83, 0x22, 0xA2, 0x13, 0xAF, 0xFF, 0x9D,
+  0x3D, 0x3E, 0x39, 0x31, 0x47, 0x33, 0x45, 0x43, 0xC5, 0xA8, 0x65, 0x43,
+  0x34, 0x25, 0x23, 0x43, 0x43, 0x43, 0x2F, 0x62, 0x34, 0x34, 0x34, 0x34,
+  0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32,
+  0x55, 0x33, 0x39, 0x13, 0x2E, 0x24, 0x46, 0x14, 0x74, 0x13, 0x87, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3, 0x13, 0x84, 0x14, 0x74, 0x15, 0x46,
+  0x2A, 0x13, 0x38, 0x23, 0x55, 0x33, 0xD3, 0xD3, 0xC3, 0x23, 0x83, 0x24,
+  0x64, 0x3C, 0x5A, 0x86, 0x50, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0x36, 0x33, 0x29, 0x13, 0x1A, 0x16, 0x4A, 0x68, 0x86, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x0C,
+  0x9F, 0xFF, 0xC0, 0x33, 0x33, 0x33, 0x33, 0xF6, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0xF0, 0x14, 0x20, 0x03, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x74, 0x23, 0x64, 0x33, 0x54, 0x43,
+  0x44, 0x53, 0x34, 0x63, 0x24, 0x73, 0x14, 0x83, 0x15, 0x79, 0x75, 0x14,
+  0x64, 0x34, 0x53, 0x53, 0x53, 0x54, 0x43, 0x63, 0x43, 0x64, 0x33, 0x74,
+  0x23, 0x83, 0x23, 0x84, 0x13, 0x93, 0x10, 0x0F, 0xFF, 0xFF, 0x30, 0x03,
+  0x35, 0x55, 0x33, 0x27, 0x38, 0x13, 0x19, 0x19, 0x15, 0x47, 0x48, 0x65,
+  0x67, 0x73, 0x76, 0x83, 0x76, 0x83, 0x76, 0x83, 0x76, 0x83, 0x76, 0x83,
+  0x76, 0x83, 0x76, 0x83, 0x76, 0x83, 0x76, 0x83, 0x76, 0x83, 0x76, 0x83,
+  0x76, 0x83, 0x76, 0x83, 0x73, 0x03, 0x36, 0x33, 0x29, 0x13, 0x1A, 0x16,
+  0x4A, 0x68, 0x86, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x93, 0x57, 0x8B, 0x5D, 0x44, 0x54, 0x34, 0x74, 0x23,
+  0x93, 0x13, 0xA7, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB3, 0x13, 0x93, 0x24,
+  0x74, 0x34, 0x54, 0x4D, 0x5B, 0x87, 0x50, 0x03, 0x35, 0x53, 0x28, 0x33,
+  0x1A, 0x26, 0x45, 0x15, 0x64, 0x14, 0x83, 0x13, 0x97, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA7, 0x83, 0x15, 0x64, 0x16, 0x45, 0x1E, 0x23, 0x19, 0x33,
+  0x35, 0x53, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD0, 0x56, 0x42, 0x3A, 0x22,
+  0x2C, 0x12, 0x24, 0x56, 0x14, 0x75, 0x13, 0x98, 0x97, 0xB6, 0xB6, 0xB6,
+  0xB6, 0xB6, 0xB3, 0x13, 0x94, 0x14, 0x75, 0x15, 0x56, 0x2F, 0x03, 0xA1,
+  0x35, 0x63, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x30, 0x03, 0x36, 0x18,
+  0x1B, 0x34, 0x54, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x60, 0x46, 0x69, 0x4B, 0x24, 0x54, 0x13, 0x73,
+  0x13, 0xB3, 0xB4, 0xB7, 0x89, 0x79, 0x87, 0xA7, 0x86, 0x87, 0x55, 0x1C,
+  0x3A, 0x57, 0x40, 0x23, 0x43, 0x43, 0x43, 0x2F, 0x62, 0x34, 0x34, 0x34,
+  0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x52, 0x53,
+  0x40, 0x03, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x96, 0x96, 0x96, 0x88, 0x6A, 0x46, 0x1A, 0x13, 0x19, 0x23, 0x36, 0x33,
+  0x13, 0xA3, 0x13, 0x93, 0x23, 0x93, 0x33, 0x83, 0x33, 0x73, 0x43, 0x73,
+  0x53, 0x63, 0x53, 0x53, 0x63, 0x53, 0x73, 0x43, 0x73, 0x33, 0x83, 0x33,
+  0x93, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xB5, 0xC5, 0xC5, 0xD3, 0x70, 0x04,
+  0x73, 0x83, 0x13, 0x65, 0x64, 0x13, 0x65, 0x63, 0x23, 0x65, 0x63, 0x24,
+  0x55, 0x63, 0x33, 0x43, 0x13, 0x43, 0x43, 0x43, 0x13, 0x43, 0x43, 0x43,
+  0x13, 0x43, 0x53, 0x32, 0x32, 0x43, 0x53, 0x23, 0x33, 0x23, 0x63, 0x23,
+  0x33, 0x23, 0x63, 0x23, 0x33, 0x23, 0x73, 0x12, 0x52, 0x22, 0x86, 0x56,
+  0x86, 0x56, 0x95, 0x56, 0x94, 0x74, 0xA4, 0x74, 0xA4, 0x74, 0x50, 0x13,
+  0x93, 0x23, 0x73, 0x34, 0x53, 0x53, 0x53, 0x63, 0x33, 0x74, 0x13, 0x93,
+  0x13, 0xA5, 0xB4, 0xD3, 0xC5, 0xA6, 0xA3, 0x13, 0x83, 0x24, 0x64, 0x33,
+  0x63, 0x53, 0x43, 0x64, 0x24, 0x73, 0x23, 0x93, 0x13, 0x93, 0x23, 0x93,
+  0x23, 0x93, 0x33, 0x73, 0x43, 0x73, 0x43, 0x73, 0x53, 0x53, 0x63, 0x53,
+  0x63, 0x44, 0x73, 0x33, 0x83, 0x33, 0x83, 0x23, 0xA3, 0x13, 0xA3, 0x13,
+  0xA6, 0xC5, 0xC5, 0xC4, 0xE3, 0xE3, 0xD3, 0xE3, 0xD4, 0xD3, 0xB6, 0xB5,
+  0xC4, 0xB0, 0x1D, 0x2D, 0x2D, 0xC3, 0xB3, 0xB3, 0xB4, 0xA4, 0xA4, 0xA4,
+  0xB3, 0xB3, 0xB4, 0xA4, 0xA4, 0xA4, 0xBF, 0xFF, 0x00, 0x53, 0x44, 0x35,
+  0x33, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x43,
+  0x35, 0x33, 0x55, 0x53, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x55, 0x44, 0x53, 0x0F, 0xFF, 0xF6, 0x03, 0x54, 0x45,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63,
+  0x55, 0x53, 0x35, 0x33, 0x43, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x35, 0x34, 0x43, 0x50, 0x23, 0xB6, 0x88, 0x55, 0x25,
+  0x34, 0x58, 0x86, 0xA4, 0x20 };
 
 const GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
   {     0,   3,  26,  12,    4,  -25 },   // 0x21 '!'
-  {    10,   9,   9,  12,    1,  -24 },   // 0x22 '"'
-  {    21,  19,  24,  19,    0,  -23 },   // 0x23 '#'
-  {    78,  16,  30,  19,    2,  -26 },   // 0x24 '$'
-  {   138,  29,  25,  31,    1,  -24 },   // 0x25 '%'
-  {   229,  20,  25,  23,    2,  -24 },   // 0x26 '&'
-  {   292,   3,   9,   7,    2,  -24 },   // 0x27 '''
-  {   296,   8,  33,  12,    3,  -25 },   // 0x28 '('
-  {   329,   8,  33,  12,    1,  -25 },   // 0x29 ')'
-  {   362,  10,  10,  14,    2,  -25 },   // 0x2A '*'
-  {   375,  16,  16,  20,    2,  -15 },   // 0x2B '+'
-  {   407,   3,   9,  10,    3,   -3 },   // 0x2C ','
-  {   411,   8,   3,  12,    2,  -10 },   // 0x2D '-'
-  {   414,   3,   4,   9,    3,   -3 },   // 0x2E '.'
-  {   416,  10,  26,  10,    0,  -25 },   // 0x2F '/'
-  {   449,  16,  25,  19,    2,  -24 },   // 0x30 '0'
-  {   499,   8,  25,  19,    4,  -24 },   // 0x31 '1'
-  {   524,  16,  25,  19,    2,  -24 },   // 0x32 '2'
-  {   574,  17,  25,  19,    1,  -24 },   // 0x33 '3'
-  {   628,  16,  25,  19,    1,  -24 },   // 0x34 '4'
-  {   678,  17,  25,  19,    1,  -24 },   // 0x35 '5'
-  {   732,  16,  25,  19,    2,  -24 },   // 0x36 '6'
-  {   782,  16,  25,  19,    2,  -24 },   // 0x37 '7'
-  {   832,  17,  25,  19,    1,  -24 },   // 0x38 '8'
-  {   886,  16,  25,  19,    1,  -24 },   // 0x39 '9'
-  {   936,   3,  19,   9,    3,  -18 },   // 0x3A ':'
-  {   944,   3,  24,   9,    3,  -18 },   // 0x3B ';'
-  {   953,  17,  17,  20,    2,  -16 },   // 0x3C '<'
-  {   990,  17,   9,  20,    2,  -12 },   // 0x3D '='
-  {  1010,  17,  17,  20,    2,  -16 },   // 0x3E '>'
-  {  1047,  15,  26,  19,    3,  -25 },   // 0x3F '?'
-  {  1096,  32,  31,  36,    1,  -25 },   // 0x40 '@'
-  {  1220,  22,  26,  23,    1,  -25 },   // 0x41 'A'
-  {  1292,  19,  26,  23,    3,  -25 },   // 0x42 'B'
-  {  1354,  22,  26,  25,    1,  -25 },   // 0x43 'C'
-  {  1426,  20,  26,  24,    3,  -25 },   // 0x44 'D'
-  {  1491,  18,  26,  22,    3,  -25 },   // 0x45 'E'
-  {  1550,  17,  26,  21,    3,  -25 },   // 0x46 'F'
-  {  1606,  24,  26,  27,    1,  -25 },   // 0x47 'G'
-  {  1684,  19,  26,  25,    3,  -25 },   // 0x48 'H'
-  {  1746,   3,  26,  10,    4,  -25 },   // 0x49 'I'
-  {  1756,  14,  26,  18,    1,  -25 },   // 0x4A 'J'
-  {  1802,  20,  26,  24,    3,  -25 },   // 0x4B 'K'
-  {  1867,  15,  26,  20,    3,  -25 },   // 0x4C 'L'
-  {  1916,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
-  {  1994,  20,  26,  26,    3,  -25 },   // 0x4E 'N'
-  {  2059,  25,  26,  27,    1,  -25 },   // 0x4F 'O'
-  {  2141,  18,  26,  23,    3,  -25 },   // 0x50 'P'
-  {  2200,  25,  28,  27,    1,  -25 },   // 0x51 'Q'
-  {  2288,  20,  26,  25,    3,  -25 },   // 0x52 'R'
-  {  2353,  20,  26,  23,    1,  -25 },   // 0x53 'S'
-  {  2418,  19,  26,  22,    1,  -25 },   // 0x54 'T'
-  {  2480,  19,  26,  25,    3,  -25 },   // 0x55 'U'
-  {  2542,  21,  26,  23,    1,  -25 },   // 0x56 'V'
-  {  2611,  32,  26,  33,    0,  -25 },   // 0x57 'W'
-  {  2715,  21,  26,  23,    1,  -25 },   // 0x58 'X'
-  {  2784,  23,  26,  24,    0,  -25 },   // 0x59 'Y'
-  {  2859,  19,  26,  22,    1,  -25 },   // 0x5A 'Z'
-  {  2921,   6,  33,  10,    2,  -25 },   // 0x5B '['
-  {  2946,  10,  26,  10,    0,  -25 },   // 0x5C '\'
-  {  2979,   6,  33,  10,    1,  -25 },   // 0x5D ']'
-  {  3004,  13,  13,  16,    2,  -24 },   // 0x5E '^'
-  {  3026,  21,   2,  19,   -1,    5 },   // 0x5F '_'
-  {  3032,   7,   5,   9,    1,  -25 },   // 0x60 '`'
-  {  3037,  17,  19,  19,    1,  -18 },   // 0x61 'a'
-  {  3078,  16,  26,  20,    2,  -25 },   // 0x62 'b'
-  {  3130,  16,  19,  18,    1,  -18 },   // 0x63 'c'
-  {  3168,  17,  26,  20,    1,  -25 },   // 0x64 'd'
-  {  3224,  16,  19,  19,    1,  -18 },   // 0x65 'e'
-  {  3262,   7,  26,  10,    1,  -25 },   // 0x66 'f'
-  {  3285,  16,  27,  19,    1,  -18 },   // 0x67 'g'
-  {  3339,  15,  26,  19,    2,  -25 },   // 0x68 'h'
-  {  3388,   3,  26,   8,    2,  -25 },   // 0x69 'i'
-  {  3398,   6,  34,   9,    0,  -25 },   // 0x6A 'j'
-  {  3424,  16,  26,  18,    2,  -25 },   // 0x6B 'k'
-  {  3476,   3,  26,   7,    2,  -25 },   // 0x6C 'l'
-  {  3486,  24,  19,  28,    2,  -18 },   // 0x6D 'm'
-  {  3543,  15,  19,  19,    2,  -18 },   // 0x6E 'n'
-  {  3579,  17,  19,  19,    1,  -18 },   // 0x6F 'o'
-  {  3620,  16,  25,  20,    2,  -18 },   // 0x70 'p'
-  {  3670,  17,  25,  20,    1,  -18 },   // 0x71 'q'
-  {  3724,   9,  19,  12,    2,  -18 },   // 0x72 'r'
-  {  3746,  14,  19,  17,    2,  -18 },   // 0x73 's'
-  {  3780,   7,  23,  10,    1,  -22 },   // 0x74 't'
-  {  3801,  15,  19,  19,    2,  -18 },   // 0x75 'u'
-  {  3837,  17,  19,  17,    0,  -18 },   // 0x76 'v'
-  {  3878,  25,  19,  25,    0,  -18 },   // 0x77 'w'
-  {  3938,  16,  19,  17,    0,  -18 },   // 0x78 'x'
-  {  3976,  17,  27,  17,    0,  -18 },   // 0x79 'y'
-  {  4034,  15,  19,  17,    1,  -18 },   // 0x7A 'z'
-  {  4070,   8,  33,  12,    1,  -25 },   // 0x7B '{'
-  {  4103,   2,  33,   9,    3,  -25 },   // 0x7C '|'
-  {  4112,   8,  33,  12,    3,  -25 },   // 0x7D '}'
-  {  4145,  15,   7,  18,    1,  -15 } }; // 0x7E '~'
+  {     7,   9,   9,  12,    1,  -24 },   // 0x22 '"'
+  {    20,  19,  24,  19,    0,  -23 },   // 0x23 '#'
+  {    66,  16,  30,  19,    2,  -26 },   // 0x24 '$'
+  {   120,  29,  25,  31,    1,  -24 },   // 0x25 '%'
+  {   184,  20,  25,  23,    2,  -24 },   // 0x26 '&'
+  {   231,   3,   9,   7,    2,  -24 },   // 0x27 '''
+  {   235,   8,  33,  12,    3,  -25 },   // 0x28 '('
+  {   268,   8,  33,  12,    1,  -25 },   // 0x29 ')'
+  {   302,  10,  10,  14,    2,  -25 },   // 0x2A '*'
+  {   317,  16,  16,  20,    2,  -15 },   // 0x2B '+'
+  {   333,   3,   9,  10,    3,   -3 },   // 0x2C ','
+  {   340,   8,   3,  12,    2,  -10 },   // 0x2D '-'
+  {   342,   3,   4,   9,    3,   -3 },   // 0x2E '.'
+  {   343,  10,  26,  10,    0,  -25 },   // 0x2F '/'
+  {   370,  16,  25,  19,    2,  -24 },   // 0x30 '0'
+  {   405,   8,  25,  19,    4,  -24 },   // 0x31 '1'
+  {   429,  16,  25,  19,    2,  -24 },   // 0x32 '2'
+  {   456,  17,  25,  19,    1,  -24 },   // 0x33 '3'
+  {   489,  16,  25,  19,    1,  -24 },   // 0x34 '4'
+  {   524,  17,  25,  19,    1,  -24 },   // 0x35 '5'
+  {   555,  16,  25,  19,    2,  -24 },   // 0x36 '6'
+  {   593,  16,  25,  19,    2,  -24 },   // 0x37 '7'
+  {   618,  17,  25,  19,    1,  -24 },   // 0x38 '8'
+  {   656,  16,  25,  19,    1,  -24 },   // 0x39 '9'
+  {   694,   3,  19,   9,    3,  -18 },   // 0x3A ':'
+  {   697,   3,  24,   9,    3,  -18 },   // 0x3B ';'
+  {   706,  17,  17,  20,    2,  -16 },   // 0x3C '<'
+  {   724,  17,   9,  20,    2,  -12 },   // 0x3D '='
+  {   731,  17,  17,  20,    2,  -16 },   // 0x3E '>'
+  {   750,  15,  26,  19,    3,  -25 },   // 0x3F '?'
+  {   777,  32,  31,  36,    1,  -25 },   // 0x40 '@'
+  {   861,  22,  26,  23,    1,  -25 },   // 0x41 'A'
+  {   911,  19,  26,  23,    3,  -25 },   // 0x42 'B'
+  {   952,  22,  26,  25,    1,  -25 },   // 0x43 'C'
+  {   997,  20,  26,  24,    3,  -25 },   // 0x44 'D'
+  {  1036,  18,  26,  22,    3,  -25 },   // 0x45 'E'
+  {  1073,  17,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  1100,  24,  26,  27,    1,  -25 },   // 0x47 'G'
+  {  1148,  19,  26,  25,    3,  -25 },   // 0x48 'H'
+  {  1174,   3,  26,  10,    4,  -25 },   // 0x49 'I'
+  {  1178,  14,  26,  18,    1,  -25 },   // 0x4A 'J'
+  {  1206,  20,  26,  24,    3,  -25 },   // 0x4B 'K'
+  {  1258,  15,  26,  20,    3,  -25 },   // 0x4C 'L'
+  {  1284,  24,  26,  30,    3,  -25 },   // 0x4D 'M'
+  {  1346,  20,  26,  26,    3,  -25 },   // 0x4E 'N'
+  {  1387,  25,  26,  27,    1,  -25 },   // 0x4F 'O'
+  {  1436,  18,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  1472,  25,  28,  27,    1,  -25 },   // 0x51 'Q'
+  {  1526,  20,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  1574,  20,  26,  23,    1,  -25 },   // 0x53 'S'
+  {  1611,  19,  26,  22,    1,  -25 },   // 0x54 'T'
+  {  1648,  19,  26,  25,    3,  -25 },   // 0x55 'U'
+  {  1678,  21,  26,  23,    1,  -25 },   // 0x56 'V'
+  {  1726,  32,  26,  33,    0,  -25 },   // 0x57 'W'
+  {  1813,  21,  26,  23,    1,  -25 },   // 0x58 'X'
+  {  1862,  23,  26,  24,    0,  -25 },   // 0x59 'Y'
+  {  1909,  19,  26,  22,    1,  -25 },   // 0x5A 'Z'
+  {  1938,   6,  33,  10,    2,  -25 },   // 0x5B '['
+  {  1967,  10,  26,  10,    0,  -25 },   // 0x5C '\'
+  {  1993,   6,  33,  10,    1,  -25 },   // 0x5D ']'
+  {  2022,  13,  13,  16,    2,  -24 },   // 0x5E '^'
+  {  2044,  21,   2,  19,   -1,    5 },   // 0x5F '_'
+  {  2046,   7,   5,   9,    1,  -25 },   // 0x60 '`'
+  {  2051,  17,  19,  19,    1,  -18 },   // 0x61 'a'
+  {  2081,  16,  26,  20,    2,  -25 },   // 0x62 'b'
+  {  2119,  16,  19,  18,    1,  -18 },   // 0x63 'c'
+  {  2145,  17,  26,  20,    1,  -25 },   // 0x64 'd'
+  {  2183,  16,  19,  19,    1,  -18 },   // 0x65 'e'
+  {  2207,   7,  26,  10,    1,  -25 },   // 0x66 'f'
+  {  2232,  16,  27,  19,    1,  -18 },   // 0x67 'g'
+  {  2273,  15,  26,  19,    2,  -25 },   // 0x68 'h'
+  {  2303,   3,  26,   8,    2,  -25 },   // 0x69 'i'
+  {  2307,   6,  34,   9,    0,  -25 },   // 0x6A 'j'
+  {  2338,  16,  26,  18,    2,  -25 },   // 0x6B 'k'
+  {  2383,   3,  26,   7,    2,  -25 },   // 0x6C 'l'
+  {  2387,  24,  19,  28,    2,  -18 },   // 0x6D 'm'
+  {  2429,  15,  19,  19,    2,  -18 },   // 0x6E 'n'
+  {  2452,  17,  19,  19,    1,  -18 },   // 0x6F 'o'
+  {  2479,  16,  25,  20,    2,  -18 },   // 0x70 'p'
+  {  2516,  17,  25,  20,    1,  -18 },   // 0x71 'q'
+  {  2553,   9,  19,  12,    2,  -18 },   // 0x72 'r'
+  {  2573,  14,  19,  17,    2,  -18 },   // 0x73 's'
+  {  2595,   7,  23,  10,    1,  -22 },   // 0x74 't'
+  {  2617,  15,  19,  19,    2,  -18 },   // 0x75 'u'
+  {  2640,  17,  19,  17,    0,  -18 },   // 0x76 'v'
+  {  2675,  25,  19,  25,    0,  -18 },   // 0x77 'w'
+  {  2735,  16,  19,  17,    0,  -18 },   // 0x78 'x'
+  {  2768,  17,  27,  17,    0,  -18 },   // 0x79 'y'
+  {  2810,  15,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  2829,   8,  33,  12,    1,  -25 },   // 0x7B '{'
+  {  2862,   2,  33,   9,    3,  -25 },   // 0x7C '|'
+  {  2865,   8,  33,  12,    3,  -25 },   // 0x7D '}'
+  {  2899,  15,   7,  18,    1,  -15 } }; // 0x7E '~'
 
 const GFXfont FreeSans18pt7b PROGMEM = {
   (uint8_t  *)FreeSans18pt7bBitmaps,
   (GFXglyph *)FreeSans18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42, 1,
+  NULL, 0, 1 };
 
-// Approx. 4831 bytes
+// Approx. 3581 bytes
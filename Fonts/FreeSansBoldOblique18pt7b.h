@@ -1,545 +1,388 @@
 const uint8_t FreeSansBoldOblique18pt7bBitmaps[] PROGMEM = {
-  0x06, 0x01, 0xC0, 0x7C, 0x1F, 0x0F, 0xC3, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
-  0xC0, 0xF0, 0x7C, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1C, 0x07, 0x01, 0xC0,
-  0x60, 0x7C, 0x1F, 0x07, 0xC3, 0xF0, 0xF8, 0x00, 0x78, 0x7B, 0xC3, 0xFE,
-  0x3F, 0xE1, 0xEF, 0x0F, 0x78, 0x7B, 0x83, 0x9C, 0x1C, 0xC0, 0xC0, 0x00,
-  0x3C, 0x38, 0x00, 0xF1, 0xE0, 0x07, 0x87, 0x00, 0x1E, 0x3C, 0x00, 0xF0,
-  0xE0, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8,
-  0x0F, 0x0E, 0x00, 0x3C, 0x78, 0x00, 0xE1, 0xE0, 0x07, 0x8F, 0x00, 0x1C,
-  0x3C, 0x07, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE3, 0xFF, 0xFF,
-  0x01, 0xE3, 0xC0, 0x0F, 0x0E, 0x00, 0x3C, 0x78, 0x01, 0xE1, 0xC0, 0x07,
-  0x8F, 0x00, 0x3C, 0x38, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x80, 0x00, 0xFC,
-  0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x0F, 0xFF, 0xC3, 0xE6, 0x78, 0x78, 0xCF,
-  0x1E, 0x39, 0xE3, 0xC7, 0x3C, 0x78, 0xC0, 0x0F, 0x98, 0x01, 0xFF, 0x00,
-  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
-  0x03, 0xBE, 0x00, 0x67, 0xCF, 0x8C, 0xF9, 0xF1, 0x9F, 0x3E, 0x77, 0xC7,
-  0xEF, 0xF8, 0x7F, 0xFE, 0x0F, 0xFF, 0x80, 0xFF, 0xE0, 0x03, 0xE0, 0x00,
-  0x38, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x07, 0x01, 0xE0,
-  0x03, 0x81, 0xFE, 0x00, 0xC0, 0xFF, 0x80, 0x70, 0x7F, 0xF0, 0x38, 0x1E,
-  0x3C, 0x1C, 0x0F, 0x07, 0x06, 0x03, 0x81, 0xC3, 0x80, 0xE0, 0xF1, 0xC0,
-  0x3C, 0x78, 0xE0, 0x0F, 0xFE, 0x30, 0x01, 0xFF, 0x1C, 0x00, 0x7F, 0x8E,
-  0x00, 0x07, 0x83, 0x00, 0x00, 0x01, 0x83, 0xE0, 0x00, 0xE3, 0xFE, 0x00,
-  0x71, 0xFF, 0x80, 0x18, 0xFF, 0xF0, 0x0C, 0x3C, 0x3C, 0x07, 0x1C, 0x07,
-  0x03, 0x87, 0x01, 0xC0, 0xC1, 0xE1, 0xE0, 0x60, 0x7F, 0xF8, 0x38, 0x0F,
-  0xFC, 0x1C, 0x03, 0xFE, 0x06, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x03,
-  0xFC, 0x00, 0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x3F, 0x3C, 0x01, 0xF1, 0xE0,
-  0x0F, 0x8F, 0x00, 0x7C, 0xF0, 0x03, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x3F,
-  0x00, 0x03, 0xF0, 0x00, 0x7F, 0xC7, 0x8F, 0xFE, 0x3C, 0xFC, 0xFB, 0xCF,
-  0x83, 0xFE, 0xF8, 0x1F, 0xE7, 0xC0, 0x7E, 0x3E, 0x03, 0xE1, 0xF0, 0x1F,
-  0x0F, 0xE3, 0xFC, 0x7F, 0xFF, 0xE1, 0xFF, 0xFF, 0x87, 0xFE, 0x7C, 0x0F,
-  0xE1, 0xF0, 0x7B, 0xFF, 0xEF, 0x7B, 0x9C, 0xC0, 0x00, 0x78, 0x07, 0x80,
-  0x78, 0x03, 0x80, 0x3C, 0x03, 0xC0, 0x1E, 0x01, 0xE0, 0x1E, 0x00, 0xF0,
-  0x0F, 0x00, 0x78, 0x03, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xF0, 0x07,
-  0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0,
-  0x07, 0x80, 0x1C, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xE0, 0x07, 0x80,
-  0x1C, 0x00, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xE0, 0x0F, 0x00, 0x78,
-  0x01, 0xC0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
-  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x1E,
-  0x00, 0xF0, 0x07, 0x80, 0x78, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x1E, 0x01,
-  0xE0, 0x1E, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x03, 0x00, 0x70, 0x07,
-  0x04, 0x63, 0xFF, 0xF7, 0xFF, 0x1F, 0x83, 0xF0, 0x3B, 0x87, 0x38, 0x21,
-  0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-  0x00, 0x7C, 0x07, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xE0,
-  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E,
-  0x00, 0x3E, 0x7C, 0xF3, 0xE7, 0xC1, 0x87, 0x0C, 0x39, 0xE3, 0x00, 0x7F,
-  0xDF, 0xFF, 0xFB, 0xFE, 0x7D, 0xF7, 0xBE, 0xF8, 0x00, 0x0E, 0x00, 0x18,
-  0x00, 0x70, 0x00, 0xC0, 0x03, 0x80, 0x06, 0x00, 0x1C, 0x00, 0x30, 0x00,
-  0xE0, 0x01, 0x80, 0x07, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x60, 0x01, 0xC0,
-  0x03, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x70, 0x00, 0xC0, 0x03, 0x80, 0x06,
-  0x00, 0x1C, 0x00, 0x30, 0x00, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x7F, 0xC0,
-  0x7F, 0xF8, 0x3F, 0xFE, 0x0F, 0x8F, 0xC7, 0xC1, 0xF1, 0xE0, 0x7C, 0xF8,
-  0x1F, 0x3E, 0x07, 0xDF, 0x01, 0xF7, 0xC0, 0x7D, 0xF0, 0x3F, 0x7C, 0x0F,
-  0xBF, 0x03, 0xEF, 0x80, 0xFB, 0xE0, 0x3E, 0xF8, 0x1F, 0x3E, 0x07, 0xCF,
-  0x81, 0xE3, 0xE0, 0xF8, 0xFC, 0x7C, 0x1F, 0xFF, 0x07, 0xFF, 0x80, 0xFF,
-  0xC0, 0x0F, 0x80, 0x00, 0x00, 0x70, 0x03, 0x80, 0x3C, 0x03, 0xE0, 0xFF,
-  0x3F, 0xF3, 0xFF, 0x9F, 0xFC, 0x03, 0xE0, 0x1F, 0x01, 0xF0, 0x0F, 0x80,
-  0x7C, 0x03, 0xE0, 0x1E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x3E,
-  0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x1F, 0x80,
-  0x07, 0xFF, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xE0, 0x7E, 0x1F, 0x83, 0xE0,
-  0x7C, 0x1F, 0x03, 0xE1, 0xF0, 0x1F, 0x0F, 0x80, 0xF8, 0x00, 0x0F, 0x80,
-  0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0xFC,
-  0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F,
-  0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFF, 0xE1, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0,
-  0x7F, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0xE0, 0x7F,
-  0xFF, 0x0F, 0x83, 0xF0, 0xF0, 0x1F, 0x1F, 0x01, 0xF1, 0xE0, 0x1F, 0x00,
-  0x03, 0xE0, 0x00, 0xFC, 0x00, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0x80,
-  0x0F, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xCF, 0x80, 0x7C,
-  0xF8, 0x07, 0xCF, 0x80, 0xF8, 0xFC, 0x3F, 0x8F, 0xFF, 0xF0, 0x7F, 0xFE,
-  0x03, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xFC, 0x00,
-  0x7F, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xEF, 0x80, 0x3D, 0xF0, 0x0F,
-  0x7C, 0x03, 0xCF, 0x80, 0xF1, 0xF0, 0x1C, 0x3E, 0x07, 0x07, 0xC1, 0xE1,
-  0xF0, 0x78, 0x3E, 0x1E, 0x07, 0xC3, 0xFF, 0xFE, 0x7F, 0xFF, 0xDF, 0xFF,
-  0xFB, 0xFF, 0xFF, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x78, 0x00, 0x1F,
-  0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0xF0, 0x3F, 0xFF, 0x03,
-  0xFF, 0xF0, 0x3F, 0xFF, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x00,
-  0xF7, 0xE0, 0x0F, 0xFF, 0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0x83, 0xF0, 0xFC,
-  0x3E, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07,
-  0x8F, 0x80, 0xF8, 0xF8, 0x1F, 0x8F, 0xC3, 0xF0, 0xFF, 0xFE, 0x07, 0xFF,
-  0xC0, 0x3F, 0xF8, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x0F,
-  0xFF, 0x03, 0xFF, 0xE0, 0xF8, 0x7E, 0x3E, 0x07, 0xC7, 0x80, 0x01, 0xF0,
-  0x00, 0x3C, 0xFC, 0x07, 0xFF, 0xC1, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xE1,
-  0xF8, 0xF8, 0x1F, 0x3E, 0x03, 0xE7, 0x80, 0x7C, 0xF0, 0x0F, 0x9E, 0x01,
-  0xE3, 0xC0, 0x7C, 0x78, 0x1F, 0x0F, 0x87, 0xE0, 0xFF, 0xF8, 0x1F, 0xFE,
-  0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x7F, 0xFF, 0xEF, 0xFF, 0xF9, 0xFF,
-  0xFF, 0x7F, 0xFF, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
-  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00, 0x7C,
-  0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x07, 0xC0,
-  0x00, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00,
-  0x07, 0xC0, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0xE0, 0xFF,
-  0xFF, 0x0F, 0x81, 0xF1, 0xF0, 0x0F, 0x1E, 0x00, 0xF1, 0xE0, 0x1E, 0x1F,
-  0x07, 0xE0, 0xFF, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0xF8, 0x1F, 0xFF, 0x83,
-  0xF0, 0xFC, 0x7C, 0x07, 0xC7, 0xC0, 0x7C, 0xF8, 0x07, 0xCF, 0x80, 0x7C,
-  0xF8, 0x0F, 0x8F, 0x80, 0xF8, 0xFC, 0x3F, 0x0F, 0xFF, 0xF0, 0x7F, 0xFE,
-  0x03, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x0F,
-  0xFF, 0x03, 0xFF, 0xE0, 0xFC, 0x3E, 0x3F, 0x03, 0xC7, 0xC0, 0x79, 0xF0,
-  0x0F, 0x3E, 0x01, 0xE7, 0xC0, 0x3C, 0xF8, 0x0F, 0x9F, 0x03, 0xE3, 0xF0,
-  0xFC, 0x7F, 0xFF, 0x87, 0xFF, 0xF0, 0x7F, 0xFE, 0x07, 0xE7, 0x80, 0x01,
-  0xF0, 0x00, 0x3C, 0x7C, 0x0F, 0x8F, 0xC3, 0xE1, 0xFF, 0xF8, 0x1F, 0xFE,
-  0x01, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x0F, 0x87, 0xC3, 0xC3, 0xE1, 0xF0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xF0, 0xF0,
-  0xF8, 0x7C, 0x00, 0x07, 0xC1, 0xF0, 0x78, 0x3E, 0x0F, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x83, 0xE0, 0xF0, 0x7C,
-  0x1F, 0x00, 0xC0, 0x70, 0x18, 0x0E, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x20,
-  0x00, 0x3C, 0x00, 0x3F, 0x80, 0x3F, 0xE0, 0x3F, 0xFC, 0x3F, 0xFC, 0x1F,
-  0xFC, 0x07, 0xFC, 0x00, 0xFC, 0x00, 0x1F, 0xF0, 0x03, 0xFF, 0x80, 0x1F,
-  0xFE, 0x00, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x78, 0x00,
-  0x03, 0x00, 0x1F, 0xFF, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-  0xC7, 0xFF, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xF8, 0x18, 0x00, 0x03, 0xC0,
-  0x00, 0x7F, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x3F,
-  0xF8, 0x01, 0xFF, 0x00, 0x07, 0xE0, 0x07, 0xFC, 0x07, 0xFF, 0x07, 0xFF,
-  0x87, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0x80, 0x07, 0x80, 0x00, 0x80, 0x00,
-  0x00, 0x03, 0xF8, 0x03, 0xFF, 0xC1, 0xFF, 0xF8, 0xFF, 0xFE, 0x7E, 0x1F,
-  0xDF, 0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xC0, 0x03, 0xE0,
-  0x01, 0xF8, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F,
-  0x80, 0x07, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0xC0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFE,
-  0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x0F, 0xC0, 0x03, 0xE0, 0x0F, 0x80, 0x00,
-  0xF8, 0x0F, 0x00, 0x00, 0x3C, 0x0F, 0x01, 0xF1, 0xCF, 0x0F, 0x03, 0xFD,
-  0xC7, 0x8F, 0x03, 0xFF, 0xE1, 0xC7, 0x03, 0xE3, 0xE0, 0xE7, 0x03, 0xC0,
-  0xF0, 0x73, 0x83, 0xC0, 0x78, 0x3B, 0x81, 0xE0, 0x38, 0x1D, 0xC1, 0xE0,
-  0x1C, 0x1C, 0xC0, 0xF0, 0x1C, 0x0E, 0xE0, 0x70, 0x0E, 0x0F, 0x70, 0x78,
-  0x0E, 0x07, 0x38, 0x3C, 0x0F, 0x07, 0x1C, 0x1E, 0x0F, 0x87, 0x8E, 0x0F,
-  0x8F, 0xCF, 0x87, 0x07, 0xFF, 0xFF, 0x83, 0xC1, 0xFE, 0x7F, 0x00, 0xE0,
-  0x3C, 0x1F, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F,
-  0xC0, 0x01, 0x00, 0x03, 0xF8, 0x07, 0x80, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-  0x1F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-  0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x03,
-  0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0x7C, 0x00, 0x7E, 0xF8, 0x00, 0xF9,
-  0xF0, 0x03, 0xF3, 0xE0, 0x07, 0xC3, 0xE0, 0x1F, 0x87, 0xC0, 0x3E, 0x0F,
-  0x80, 0xF8, 0x1F, 0x01, 0xF0, 0x3E, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8,
-  0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xF1, 0xF0, 0x03, 0xE7, 0xC0, 0x07, 0xCF,
-  0x80, 0x0F, 0xBE, 0x00, 0x1F, 0x7C, 0x00, 0x3F, 0xF0, 0x00, 0x7C, 0x07,
-  0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x0F,
-  0xC0, 0x3F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x1F,
-  0x80, 0x1E, 0x1F, 0x80, 0x3E, 0x1F, 0x00, 0x7C, 0x1F, 0xFF, 0xF8, 0x1F,
-  0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0x3E, 0x00, 0xFC, 0x3E,
-  0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x7E, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x7C,
-  0x00, 0xF8, 0x7C, 0x01, 0xF8, 0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF,
-  0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xF8, 0x01,
-  0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x07, 0xE0, 0x7F, 0x0F, 0xC0, 0x3F, 0x1F,
-  0x80, 0x1F, 0x3F, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x7E, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x7C, 0xF8,
-  0x00, 0x7C, 0xFC, 0x00, 0xF8, 0xFC, 0x01, 0xF8, 0x7F, 0x07, 0xF0, 0x7F,
-  0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07,
-  0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x0F,
-  0x80, 0x7E, 0x0F, 0x80, 0x3F, 0x0F, 0x80, 0x1F, 0x1F, 0x80, 0x1F, 0x1F,
-  0x80, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x3F,
-  0x00, 0x1F, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E,
-  0x00, 0x3E, 0x7E, 0x00, 0x7C, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0xF8, 0x7C,
-  0x01, 0xF8, 0x7C, 0x07, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x07,
-  0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-  0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F,
-  0xFF, 0xF0, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFF,
-  0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x07,
-  0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xE0, 0xF8,
-  0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFE,
-  0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00,
-  0xFC, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
-  0x80, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFC, 0x03,
-  0xFF, 0xFE, 0x07, 0xE0, 0x7E, 0x0F, 0x80, 0x3F, 0x1F, 0x00, 0x1F, 0x3E,
-  0x00, 0x1F, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0xF8, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x07, 0xFE, 0xF8,
-  0x07, 0xFE, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xFC, 0x00, 0x7E, 0xFC,
-  0x00, 0x7C, 0x7E, 0x00, 0xFC, 0x7F, 0x83, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F,
-  0xFF, 0xBC, 0x0F, 0xFF, 0x38, 0x03, 0xFC, 0x38, 0x03, 0xE0, 0x07, 0xC0,
-  0xF8, 0x01, 0xF0, 0x7E, 0x00, 0x7C, 0x1F, 0x00, 0x3F, 0x07, 0xC0, 0x0F,
-  0x81, 0xF0, 0x03, 0xE0, 0xFC, 0x00, 0xF8, 0x3E, 0x00, 0x3E, 0x0F, 0x80,
-  0x1F, 0x83, 0xE0, 0x07, 0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFC, 0x1F,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC1, 0xF0, 0x03, 0xE0, 0x7C, 0x00, 0xF8,
-  0x3F, 0x00, 0x3E, 0x0F, 0x80, 0x0F, 0x83, 0xE0, 0x07, 0xE0, 0xF8, 0x01,
-  0xF0, 0x3E, 0x00, 0x7C, 0x1F, 0x80, 0x1F, 0x07, 0xC0, 0x0F, 0xC1, 0xF0,
-  0x03, 0xF0, 0x7C, 0x00, 0xF8, 0x3F, 0x00, 0x3E, 0x00, 0x07, 0xC3, 0xF0,
-  0xFC, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x7E, 0x1F, 0x07, 0xC1, 0xF0, 0x7C,
-  0x3F, 0x0F, 0xC3, 0xE0, 0xF8, 0x3E, 0x0F, 0x87, 0xE1, 0xF0, 0x7C, 0x1F,
-  0x07, 0xC3, 0xF0, 0xFC, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00,
-  0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xE0,
-  0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-  0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x7C, 0x0F,
-  0x8F, 0x81, 0xF8, 0xF8, 0x1F, 0x0F, 0x81, 0xF0, 0xF8, 0x1F, 0x0F, 0xC3,
-  0xF0, 0xFF, 0xFE, 0x07, 0xFF, 0xC0, 0x3F, 0xF8, 0x01, 0xFC, 0x00, 0x07,
-  0xC0, 0x0F, 0xC1, 0xF0, 0x07, 0xE0, 0x7C, 0x03, 0xF0, 0x3F, 0x03, 0xF8,
-  0x0F, 0x81, 0xF8, 0x03, 0xE0, 0xFC, 0x00, 0xF8, 0x7E, 0x00, 0x7E, 0x3F,
-  0x00, 0x1F, 0x1F, 0x80, 0x07, 0xCF, 0xC0, 0x01, 0xF7, 0xE0, 0x00, 0x7F,
-  0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x00,
-  0xFE, 0xFC, 0x00, 0x3F, 0x1F, 0x80, 0x1F, 0x87, 0xE0, 0x07, 0xC0, 0xFC,
-  0x01, 0xF0, 0x3F, 0x00, 0x7C, 0x07, 0xE0, 0x1F, 0x01, 0xFC, 0x0F, 0xC0,
-  0x3F, 0x03, 0xE0, 0x0F, 0xE0, 0xF8, 0x01, 0xF8, 0x3E, 0x00, 0x3F, 0x00,
-  0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x03,
-  0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x01, 0xF0,
-  0x00, 0x7C, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00,
-  0x3E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xE0, 0x03,
-  0xF8, 0x01, 0xFC, 0x07, 0xF0, 0x07, 0xF8, 0x1F, 0xE0, 0x0F, 0xF0, 0x3F,
-  0xC0, 0x3F, 0xE0, 0x7F, 0x80, 0x7F, 0xC0, 0xFF, 0x01, 0xFF, 0x01, 0xFE,
-  0x03, 0xFE, 0x07, 0xDC, 0x07, 0x7C, 0x0F, 0xB8, 0x1E, 0xF8, 0x1F, 0x70,
-  0x3D, 0xF0, 0x3E, 0xF0, 0xF7, 0xC0, 0xF9, 0xE1, 0xEF, 0x81, 0xF3, 0xC7,
-  0x9F, 0x03, 0xE7, 0x8F, 0x3E, 0x07, 0xCF, 0x3C, 0x7C, 0x0F, 0x9E, 0x79,
-  0xF0, 0x3E, 0x3C, 0xE3, 0xE0, 0x7C, 0x7B, 0xC7, 0xC0, 0xF8, 0xF7, 0x8F,
-  0x81, 0xF1, 0xFE, 0x1E, 0x07, 0xE3, 0xFC, 0x7C, 0x0F, 0x87, 0xF0, 0xF8,
-  0x1F, 0x0F, 0xE1, 0xF0, 0x3E, 0x1F, 0x83, 0xE0, 0x7C, 0x3F, 0x0F, 0x81,
-  0xF0, 0x7E, 0x1F, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x7E, 0x00, 0xF8, 0x1F,
-  0xC0, 0x1F, 0x03, 0xF8, 0x03, 0xE0, 0x7F, 0x80, 0x7C, 0x0F, 0xF0, 0x1F,
-  0x01, 0xFF, 0x03, 0xE0, 0x7F, 0xE0, 0x7C, 0x0F, 0xBC, 0x0F, 0x81, 0xF7,
-  0xC1, 0xF0, 0x3E, 0xF8, 0x7C, 0x0F, 0x8F, 0x0F, 0x81, 0xF1, 0xF1, 0xF0,
-  0x3E, 0x3E, 0x3E, 0x07, 0xC3, 0xC7, 0xC0, 0xF8, 0x7D, 0xF0, 0x3E, 0x0F,
-  0xBE, 0x07, 0xC0, 0xF7, 0xC0, 0xF8, 0x1F, 0xF8, 0x1F, 0x01, 0xFE, 0x03,
-  0xC0, 0x3F, 0xC0, 0xF8, 0x07, 0xF8, 0x1F, 0x00, 0x7F, 0x03, 0xE0, 0x0F,
-  0xE0, 0x7C, 0x01, 0xF8, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xE0, 0x00,
-  0x3F, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x7E, 0x07, 0xF0,
-  0x7E, 0x01, 0xF8, 0x7C, 0x00, 0x7E, 0x3E, 0x00, 0x1F, 0x3E, 0x00, 0x0F,
-  0x9E, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xEF, 0x80, 0x01, 0xFF, 0x80, 0x00,
-  0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x3E, 0xF8, 0x00,
-  0x1F, 0x7C, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x9F, 0x80, 0x0F, 0x87, 0xE0,
-  0x0F, 0x83, 0xF8, 0x1F, 0x80, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x0F,
-  0xFF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0,
-  0x3F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0, 0xF8, 0x07, 0xE1, 0xF0, 0x07, 0xC3,
-  0xE0, 0x0F, 0x8F, 0xC0, 0x1F, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0xF8, 0x7C,
-  0x01, 0xF0, 0xF8, 0x07, 0xC3, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x0F, 0xFF,
-  0xF8, 0x1F, 0xFF, 0x80, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00,
-  0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00,
-  0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0x07,
-  0xF0, 0x7E, 0x01, 0xF8, 0x7E, 0x00, 0x7E, 0x3E, 0x00, 0x1F, 0x3E, 0x00,
-  0x0F, 0x9E, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xEF, 0x80, 0x01, 0xF7, 0x80,
-  0x00, 0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x3E, 0xF8,
-  0x02, 0x1F, 0x7C, 0x03, 0x9F, 0x3E, 0x03, 0xFF, 0x9F, 0x81, 0xFF, 0x87,
-  0xE0, 0x7F, 0x83, 0xF8, 0x3F, 0xC0, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF0,
-  0x0F, 0xFF, 0xFC, 0x01, 0xFE, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x07, 0xFF,
-  0xF8, 0x07, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x0F, 0x80,
-  0x3F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x1F, 0x80,
-  0x1E, 0x1F, 0x00, 0x3E, 0x1F, 0x00, 0x7C, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF,
-  0xE0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3E, 0x01, 0xF8, 0x3E, 0x00,
-  0xF8, 0x3E, 0x00, 0xF8, 0x7E, 0x00, 0xF8, 0x7C, 0x00, 0xF8, 0x7C, 0x01,
-  0xF0, 0x7C, 0x01, 0xF0, 0x7C, 0x01, 0xF0, 0xFC, 0x01, 0xF0, 0xF8, 0x01,
-  0xF0, 0xF8, 0x01, 0xF0, 0x00, 0x3F, 0xC0, 0x07, 0xFF, 0xC0, 0x3F, 0xFF,
-  0x81, 0xFF, 0xFF, 0x0F, 0xC0, 0xFC, 0x3E, 0x01, 0xF1, 0xF0, 0x07, 0xC7,
-  0xC0, 0x1F, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFF,
-  0x80, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x03, 0xFE,
-  0x00, 0x01, 0xF8, 0x00, 0x03, 0xEF, 0x80, 0x0F, 0xBE, 0x00, 0x3C, 0xFC,
-  0x01, 0xF3, 0xF8, 0x1F, 0x87, 0xFF, 0xFE, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF,
-  0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x3E,
-  0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x00,
-  0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xC0,
-  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00, 0x07,
-  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0xFC, 0x00,
-  0x00, 0x0F, 0x80, 0x1F, 0x1F, 0x80, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00,
-  0x3F, 0x1F, 0x00, 0x3E, 0x1F, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E, 0x00,
-  0x7E, 0x3E, 0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x3E, 0x00, 0x7C, 0x7C, 0x00,
-  0x7C, 0x7C, 0x00, 0xFC, 0x7C, 0x00, 0xF8, 0x7C, 0x00, 0xF8, 0x7C, 0x00,
-  0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x01, 0xF8, 0xF8, 0x01, 0xF0, 0xF8, 0x01,
-  0xF0, 0xF8, 0x03, 0xE0, 0xFE, 0x0F, 0xE0, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF,
-  0x80, 0x1F, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x03,
-  0xE7, 0xC0, 0x0F, 0x9F, 0x00, 0x7C, 0x7C, 0x01, 0xF1, 0xF0, 0x0F, 0x87,
-  0xC0, 0x3E, 0x1F, 0x01, 0xF0, 0x7C, 0x07, 0x81, 0xF0, 0x3E, 0x03, 0xC0,
-  0xF0, 0x0F, 0x07, 0xC0, 0x3E, 0x1E, 0x00, 0xF8, 0xF8, 0x03, 0xE3, 0xC0,
-  0x0F, 0x9F, 0x00, 0x3E, 0x78, 0x00, 0xFB, 0xE0, 0x01, 0xEF, 0x00, 0x07,
-  0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xE0,
-  0x00, 0x1F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x07, 0xE0, 0x1F, 0xF8,
-  0x07, 0xE0, 0x3F, 0xF8, 0x0F, 0xE0, 0x3E, 0xF8, 0x0F, 0xE0, 0x7E, 0xF8,
-  0x1F, 0xE0, 0x7C, 0xF8, 0x1F, 0xE0, 0x7C, 0xF8, 0x3F, 0xE0, 0xF8, 0xF8,
-  0x3D, 0xE0, 0xF8, 0x78, 0x3D, 0xE1, 0xF0, 0x78, 0x79, 0xE1, 0xF0, 0x78,
-  0x79, 0xE1, 0xE0, 0x78, 0xF9, 0xE3, 0xE0, 0x78, 0xF1, 0xE3, 0xC0, 0x79,
-  0xF1, 0xE7, 0xC0, 0x79, 0xE1, 0xE7, 0x80, 0x79, 0xE1, 0xE7, 0x80, 0x7B,
-  0xC1, 0xEF, 0x80, 0x7B, 0xC1, 0xEF, 0x00, 0x7F, 0x81, 0xFF, 0x00, 0x7F,
-  0x81, 0xFE, 0x00, 0x7F, 0x01, 0xFE, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x7F,
-  0x01, 0xFC, 0x00, 0x7E, 0x01, 0xF8, 0x00, 0x3E, 0x01, 0xF8, 0x00, 0x3C,
-  0x01, 0xF0, 0x00, 0x03, 0xF0, 0x07, 0xE0, 0x7E, 0x01, 0xF8, 0x07, 0xE0,
-  0x7E, 0x00, 0xFC, 0x1F, 0x80, 0x1F, 0x83, 0xE0, 0x01, 0xF8, 0xF8, 0x00,
-  0x3F, 0x3F, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFC,
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0x7F, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x3E, 0xF8, 0x00, 0x0F, 0xDF, 0x80, 0x03, 0xF3, 0xF0, 0x00, 0xFC,
-  0x3F, 0x00, 0x3F, 0x07, 0xE0, 0x07, 0xE0, 0xFC, 0x01, 0xF8, 0x0F, 0xC0,
-  0x7E, 0x01, 0xF8, 0x1F, 0x80, 0x3F, 0x80, 0x7C, 0x00, 0xFD, 0xF8, 0x07,
-  0xE7, 0xE0, 0x1F, 0x1F, 0x80, 0xFC, 0x3E, 0x07, 0xE0, 0xFC, 0x1F, 0x03,
-  0xF0, 0xFC, 0x07, 0xC7, 0xE0, 0x1F, 0x1F, 0x00, 0x7E, 0xFC, 0x00, 0xFB,
-  0xE0, 0x03, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00,
-  0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01,
-  0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-  0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x83, 0xFF,
-  0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-  0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00,
-  0x07, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-  0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00,
-  0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00,
-  0x03, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xF0, 0x7F, 0xFF, 0xF0, 0x00, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x1F,
-  0xF0, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00,
-  0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
-  0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x0F, 0x00,
-  0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
-  0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x00, 0xE7, 0x39, 0xCE, 0x31, 0x8C,
-  0x63, 0x1C, 0xE7, 0x39, 0xCE, 0x31, 0x8C, 0x63, 0x9C, 0xE7, 0x38, 0x01,
-  0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x1F, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
-  0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00,
-  0x1E, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F,
-  0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00,
-  0x1E, 0x00, 0x3C, 0x00, 0x78, 0x1F, 0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF,
-  0x00, 0x00, 0x7C, 0x00, 0xFC, 0x01, 0xFC, 0x01, 0xFC, 0x03, 0xFC, 0x03,
-  0x9E, 0x07, 0x9E, 0x0F, 0x1E, 0x0F, 0x1E, 0x1E, 0x1E, 0x1C, 0x0F, 0x3C,
-  0x0F, 0x78, 0x0F, 0x78, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xF3, 0x8C, 0x71, 0x80, 0x01, 0xFE, 0x01, 0xFF, 0xE0,
-  0xFF, 0xF8, 0x7F, 0xFF, 0x1F, 0x0F, 0xC7, 0x81, 0xF0, 0x00, 0x7C, 0x00,
-  0xFE, 0x07, 0xFF, 0x87, 0xFF, 0xE3, 0xFE, 0xF9, 0xF0, 0x7C, 0xF8, 0x1F,
-  0x3E, 0x0F, 0xCF, 0x87, 0xF3, 0xFF, 0xF8, 0xFF, 0xFE, 0x1F, 0xEF, 0x81,
-  0xE3, 0xF0, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00,
-  0x07, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF9, 0xF8, 0x0F, 0xFF,
-  0xC1, 0xFF, 0xFE, 0x1F, 0xFF, 0xE1, 0xFC, 0x3F, 0x1F, 0x83, 0xF1, 0xF0,
-  0x1F, 0x3E, 0x01, 0xF3, 0xE0, 0x1F, 0x3C, 0x01, 0xF3, 0xC0, 0x1F, 0x3C,
-  0x03, 0xE7, 0xC0, 0x3E, 0x7E, 0x07, 0xC7, 0xF1, 0xFC, 0x7F, 0xFF, 0x87,
-  0xFF, 0xF0, 0xFB, 0xFE, 0x0F, 0x9F, 0x80, 0x00, 0xFC, 0x01, 0xFF, 0xC0,
-  0xFF, 0xF8, 0x7F, 0xFF, 0x3F, 0x0F, 0xCF, 0x81, 0xF7, 0xC0, 0x7D, 0xF0,
-  0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x0F,
-  0xBE, 0x07, 0xCF, 0xC3, 0xF1, 0xFF, 0xF8, 0x7F, 0xFC, 0x0F, 0xFE, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00,
-  0x3E, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x7E, 0x7C,
-  0x07, 0xFD, 0xF0, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x0F, 0xE3, 0xF8, 0x3E,
-  0x07, 0xE1, 0xF0, 0x1F, 0x87, 0xC0, 0x3C, 0x3E, 0x00, 0xF0, 0xF8, 0x07,
-  0xC3, 0xE0, 0x1F, 0x0F, 0x80, 0x7C, 0x3E, 0x03, 0xE0, 0xF8, 0x1F, 0x83,
-  0xF0, 0xFE, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x7E,
-  0x7C, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0xE0, 0x3F, 0xFE, 0x0F, 0xFF, 0xE3,
-  0xF0, 0x7E, 0x7C, 0x07, 0xDF, 0x00, 0xFB, 0xE0, 0x1F, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x1F, 0x3F,
-  0x07, 0xE3, 0xFF, 0xF8, 0x7F, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0x80, 0x00,
-  0x00, 0xF8, 0x1F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7C, 0x07, 0xC0, 0x3E, 0x0F,
-  0xFE, 0x7F, 0xF3, 0xFF, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C,
-  0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x78, 0x07, 0xC0, 0x3E, 0x01,
-  0xF0, 0x0F, 0x80, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x7C, 0x07, 0xFD,
-  0xF0, 0x3F, 0xF7, 0x81, 0xFF, 0xFE, 0x0F, 0xE3, 0xF8, 0x3E, 0x07, 0xE1,
-  0xF8, 0x0F, 0x87, 0xC0, 0x3C, 0x1E, 0x00, 0xF0, 0xF8, 0x03, 0xC3, 0xE0,
-  0x1F, 0x0F, 0x80, 0x78, 0x3E, 0x03, 0xE0, 0xF8, 0x1F, 0x83, 0xF0, 0xFE,
-  0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0x3F, 0xEF, 0x00, 0x3E, 0x7C, 0x00,
-  0x01, 0xF0, 0x00, 0x07, 0xC3, 0xE0, 0x3E, 0x0F, 0x80, 0xF8, 0x3F, 0x0F,
-  0xC0, 0x7F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xE0,
-  0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-  0x00, 0x0F, 0x80, 0x00, 0xF8, 0xF8, 0x0F, 0xBF, 0xE0, 0xFF, 0xFF, 0x0F,
-  0xFF, 0xF1, 0xFC, 0x3F, 0x1F, 0x81, 0xF1, 0xF0, 0x1F, 0x1F, 0x01, 0xF1,
-  0xE0, 0x1F, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x3E,
-  0x7C, 0x03, 0xE7, 0xC0, 0x7C, 0x7C, 0x07, 0xC7, 0xC0, 0x7C, 0x7C, 0x07,
-  0xCF, 0x80, 0x78, 0x07, 0xC1, 0xF0, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00,
-  0x3E, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x0F, 0x83, 0xE0, 0xF8, 0x3E,
-  0x0F, 0x87, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC3, 0xE0, 0xF8, 0x3E, 0x00,
-  0x00, 0x3E, 0x00, 0x78, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x1F,
-  0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
-  0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x1F,
-  0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xF0, 0x1F, 0xC0, 0x3F, 0x80,
-  0x7E, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00,
-  0x0F, 0x80, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
-  0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x07, 0xC7, 0xE0, 0x3E, 0x7E, 0x01,
-  0xF7, 0xE0, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x3F, 0xFC,
-  0x01, 0xFF, 0xE0, 0x0F, 0xDF, 0x00, 0xFC, 0xFC, 0x07, 0xC3, 0xE0, 0x3E,
-  0x1F, 0x01, 0xF0, 0xFC, 0x0F, 0x83, 0xE0, 0xF8, 0x1F, 0x87, 0xC0, 0xFC,
-  0x00, 0x07, 0xC1, 0xF0, 0x7C, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x1F,
-  0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x87,
-  0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC3, 0xE0, 0xF8, 0x3E, 0x00, 0x0F, 0x8F,
-  0x83, 0xF0, 0x3E, 0xFF, 0x3F, 0xE0, 0xF7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-  0xFF, 0x1F, 0xC7, 0xF8, 0x7C, 0x7C, 0x0F, 0x81, 0xF1, 0xF0, 0x3E, 0x07,
-  0xCF, 0x81, 0xF0, 0x3E, 0x3E, 0x07, 0xC0, 0xF8, 0xF8, 0x1F, 0x03, 0xE3,
-  0xE0, 0x7C, 0x0F, 0x8F, 0x81, 0xF0, 0x3E, 0x7C, 0x0F, 0x81, 0xF1, 0xF0,
-  0x3E, 0x07, 0xC7, 0xC0, 0xF8, 0x1F, 0x1F, 0x03, 0xE0, 0x7C, 0x7C, 0x0F,
-  0x81, 0xE3, 0xE0, 0x7C, 0x0F, 0x8F, 0x81, 0xF0, 0x3E, 0x00, 0x0F, 0x8F,
-  0x80, 0xFB, 0xFE, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0x1F, 0xC3, 0xF1, 0xF8,
-  0x1F, 0x1F, 0x01, 0xF1, 0xF0, 0x1F, 0x3E, 0x01, 0xF3, 0xE0, 0x3E, 0x3E,
-  0x03, 0xE3, 0xE0, 0x3E, 0x3C, 0x03, 0xE7, 0xC0, 0x3E, 0x7C, 0x07, 0xC7,
-  0xC0, 0x7C, 0x7C, 0x07, 0xC7, 0x80, 0x7C, 0xF8, 0x07, 0x80, 0x00, 0xFE,
-  0x00, 0x7F, 0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xE3, 0xF8, 0xFE, 0x7C, 0x0F,
-  0xDF, 0x00, 0xFB, 0xE0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x1F,
-  0xFC, 0x03, 0xEF, 0x80, 0x7D, 0xF8, 0x1F, 0x3F, 0x07, 0xE3, 0xFF, 0xF8,
-  0x7F, 0xFE, 0x07, 0xFF, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xE7, 0xE0, 0x0F,
-  0xBF, 0xC0, 0x7D, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xF0, 0xFC, 0x1F, 0x81,
-  0xF0, 0x7C, 0x07, 0xC3, 0xE0, 0x1F, 0x0F, 0x80, 0x7C, 0x3E, 0x01, 0xF0,
-  0xF0, 0x07, 0xC3, 0xC0, 0x3E, 0x1F, 0x00, 0xF8, 0x7E, 0x07, 0xC1, 0xFC,
-  0x7F, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xC0, 0xFB, 0xFE, 0x03, 0xE7, 0xE0,
-  0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F,
-  0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x01,
-  0xF1, 0xF0, 0x7F, 0xDF, 0x0F, 0xFD, 0xF1, 0xFF, 0xFE, 0x3F, 0x8F, 0xE3,
-  0xE0, 0x7E, 0x7C, 0x03, 0xE7, 0xC0, 0x3E, 0xF8, 0x03, 0xCF, 0x80, 0x3C,
-  0xF8, 0x07, 0xCF, 0x80, 0x7C, 0xF8, 0x0F, 0x8F, 0x81, 0xF8, 0xFC, 0x3F,
-  0x87, 0xFF, 0xF8, 0x7F, 0xFF, 0x83, 0xFF, 0xF0, 0x1F, 0x9F, 0x00, 0x01,
-  0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00,
-  0x3E, 0x00, 0x03, 0xE0, 0x00, 0x3E, 0x00, 0x0F, 0x8E, 0x1F, 0x7C, 0x3F,
-  0xF0, 0xFF, 0xE1, 0xFC, 0x03, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x3E, 0x00,
-  0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0x3E,
-  0x00, 0x7C, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0x01, 0xFC, 0x01, 0xFF, 0xC0,
-  0xFF, 0xF8, 0x7F, 0xFF, 0x3F, 0x0F, 0xCF, 0x81, 0xF3, 0xF0, 0x00, 0xFF,
-  0x80, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x7F, 0xF8, 0x03, 0xFE, 0x00, 0x1F,
-  0xBE, 0x03, 0xEF, 0xC1, 0xFB, 0xFF, 0xFC, 0x7F, 0xFE, 0x0F, 0xFF, 0x00,
-  0xFE, 0x00, 0x0F, 0x81, 0xF0, 0x7C, 0x0F, 0x81, 0xF0, 0xFF, 0xBF, 0xF7,
-  0xFE, 0x3E, 0x07, 0xC0, 0xF8, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
-  0xF8, 0x1F, 0x03, 0xE0, 0x7F, 0x0F, 0xE1, 0xFC, 0x1F, 0x80, 0x1F, 0x01,
-  0xF1, 0xF0, 0x1F, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x3E, 0x03, 0xE3, 0xE0,
-  0x3E, 0x3E, 0x03, 0xE7, 0xC0, 0x7C, 0x7C, 0x07, 0xC7, 0xC0, 0x7C, 0x7C,
-  0x07, 0xC7, 0xC0, 0x7C, 0xF8, 0x0F, 0x8F, 0x81, 0xF8, 0xF8, 0x3F, 0x8F,
-  0xFF, 0xF8, 0xFF, 0xFF, 0x07, 0xFD, 0xF0, 0x3F, 0x1F, 0x00, 0xF8, 0x0F,
-  0xFE, 0x03, 0xEF, 0x81, 0xF3, 0xE0, 0x7C, 0xF8, 0x3E, 0x3E, 0x0F, 0x8F,
-  0x87, 0xC1, 0xE1, 0xF0, 0x78, 0xF8, 0x1E, 0x3E, 0x07, 0x9F, 0x01, 0xF7,
-  0x80, 0x7F, 0xE0, 0x1F, 0xF0, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x80,
-  0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xF8, 0x1F, 0x07, 0xFF, 0x03, 0xE0, 0xFB,
-  0xE0, 0xFC, 0x1F, 0x7C, 0x1F, 0x87, 0xCF, 0x87, 0xF0, 0xF9, 0xF0, 0xFE,
-  0x3E, 0x3E, 0x3D, 0xC7, 0xC3, 0xC7, 0xB9, 0xF0, 0x79, 0xE7, 0x3E, 0x0F,
-  0x3C, 0xE7, 0x81, 0xEF, 0x1D, 0xF0, 0x3D, 0xE3, 0xBC, 0x07, 0xBC, 0x7F,
-  0x80, 0xFF, 0x0F, 0xE0, 0x1F, 0xE1, 0xFC, 0x03, 0xF8, 0x3F, 0x00, 0x7F,
-  0x07, 0xE0, 0x0F, 0xC0, 0xF8, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0x0F, 0xC1,
-  0xF8, 0x3F, 0x07, 0xC0, 0x7C, 0x3E, 0x01, 0xF9, 0xF8, 0x03, 0xEF, 0xC0,
-  0x0F, 0xBE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x01, 0xFC, 0x00, 0x03,
-  0xE0, 0x00, 0x1F, 0xC0, 0x00, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x3E, 0xF8,
-  0x01, 0xFB, 0xF0, 0x07, 0xC7, 0xC0, 0x3E, 0x1F, 0x81, 0xF8, 0x7E, 0x0F,
-  0xC0, 0xF8, 0x00, 0x1F, 0x80, 0x7C, 0x3E, 0x03, 0xE0, 0xF8, 0x0F, 0x03,
-  0xE0, 0x7C, 0x0F, 0x81, 0xE0, 0x3E, 0x0F, 0x80, 0xF8, 0x3C, 0x03, 0xE1,
-  0xF0, 0x07, 0x87, 0x80, 0x1F, 0x3E, 0x00, 0x7C, 0xF0, 0x01, 0xF7, 0xC0,
-  0x07, 0xDE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xC0, 0x01, 0xFE, 0x00, 0x03,
-  0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0,
-  0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x01,
-  0xF8, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xE1, 0xFF, 0xFC, 0x3F,
-  0xFF, 0x87, 0xFF, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-  0xF0, 0x01, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
-  0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xFF, 0xF8, 0xFF, 0xFF, 0x1F, 0xFF,
-  0xE3, 0xFF, 0xFC, 0x00, 0x00, 0x7C, 0x03, 0xF0, 0x1F, 0xC0, 0xFE, 0x03,
-  0xE0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01,
-  0xE0, 0x0F, 0x80, 0x3C, 0x01, 0xF0, 0x1F, 0x80, 0x70, 0x01, 0xF8, 0x01,
-  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
-  0xF0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xFC, 0x07, 0xE0, 0x0F, 0x80,
-  0x1E, 0x00, 0x03, 0x81, 0xC0, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0E,
-  0x07, 0x03, 0x81, 0xC0, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x1C, 0x0E, 0x07,
-  0x03, 0x81, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x1C, 0x0E, 0x07, 0x01,
-  0x80, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x07, 0xC0, 0x1F, 0x80, 0xFE, 0x00,
-  0x78, 0x01, 0xE0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00,
-  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x7E, 0x00, 0x38, 0x07, 0xE0,
-  0x3E, 0x00, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80,
-  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x01, 0xF8, 0x0F, 0xE0, 0x3F, 0x00,
-  0xF8, 0x00, 0x0F, 0x00, 0x1F, 0xC1, 0xDF, 0xF0, 0xEE, 0x3F, 0xE6, 0x07,
-  0xF0, 0x01, 0xE0 };
+  0x52, 0x83, 0x75, 0x55, 0x46, 0x45, 0x55, 0x55, 0x55, 0x54, 0x64, 0x55,
+  0x54, 0x64, 0x64, 0x64, 0x63, 0x73, 0x73, 0x72, 0x65, 0x55, 0x55, 0x46,
+  0x45, 0x50, 0x14, 0x44, 0x14, 0x49, 0x39, 0x44, 0x14, 0x44, 0x14, 0x44,
+  0x13, 0x53, 0x23, 0x53, 0x22, 0x62, 0x30, 0xA4, 0x43, 0xB4, 0x34, 0xA4,
+  0x43, 0xB4, 0x34, 0xA4, 0x43, 0x7F, 0x34, 0xF3, 0x3F, 0x43, 0xF3, 0x74,
+  0x43, 0xB4, 0x34, 0xB3, 0x44, 0xA4, 0x34, 0xB3, 0x44, 0x7F, 0x34, 0xF3,
+  0x4F, 0x33, 0xF3, 0x74, 0x34, 0xA4, 0x43, 0xB4, 0x34, 0xA4, 0x43, 0xB4,
+  0x34, 0xA4, 0x43, 0xB0, 0xC2, 0xF2, 0x2F, 0x06, 0xAA, 0x8C, 0x6E, 0x45,
+  0x22, 0x24, 0x44, 0x32, 0x24, 0x34, 0x33, 0x24, 0x34, 0x33, 0x24, 0x34,
+  0x32, 0xA5, 0x22, 0xA9, 0xBA, 0xAA, 0xAA, 0xC8, 0xB8, 0xA3, 0x15, 0xA2,
+  0x25, 0x25, 0x32, 0x25, 0x25, 0x32, 0x25, 0x25, 0x23, 0x15, 0x36, 0x19,
+  0x4E, 0x5D, 0x7B, 0xB5, 0xF0, 0x3F, 0x12, 0xF2, 0x2B, 0xF6, 0x37, 0x4B,
+  0x36, 0x89, 0x26, 0x98, 0x35, 0xB6, 0x36, 0x43, 0x45, 0x36, 0x45, 0x35,
+  0x27, 0x36, 0x34, 0x37, 0x35, 0x43, 0x38, 0x43, 0x43, 0x39, 0xB3, 0x2B,
+  0x93, 0x3B, 0x83, 0x3E, 0x45, 0x2F, 0x82, 0x55, 0xD3, 0x39, 0xA3, 0x3A,
+  0xA2, 0x3C, 0x82, 0x44, 0x44, 0x73, 0x33, 0x73, 0x63, 0x43, 0x73, 0x62,
+  0x54, 0x44, 0x62, 0x6C, 0x53, 0x7A, 0x53, 0x89, 0x62, 0xB5, 0x50, 0xB5,
+  0xE8, 0xCA, 0xAB, 0x96, 0x24, 0x95, 0x34, 0x95, 0x34, 0x95, 0x24, 0xAB,
+  0xB9, 0xD6, 0xE6, 0xD9, 0x34, 0x3B, 0x34, 0x26, 0x25, 0x14, 0x25, 0x59,
+  0x15, 0x68, 0x25, 0x76, 0x35, 0x75, 0x45, 0x75, 0x47, 0x38, 0x3F, 0x34,
+  0xF3, 0x4A, 0x25, 0x67, 0x45, 0x10, 0x14, 0x1D, 0x14, 0x14, 0x13, 0x23,
+  0x22, 0x30, 0x94, 0x84, 0x84, 0x93, 0x94, 0x84, 0x94, 0x84, 0x84, 0x94,
+  0x84, 0x94, 0x94, 0x84, 0x94, 0x94, 0x84, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0xA3, 0xA4, 0x94, 0x94, 0xA3, 0xA4, 0xA3, 0x70,
+  0x73, 0xA4, 0xA3, 0xA4, 0x94, 0x94, 0xA3, 0xA4, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x85, 0x84, 0x94, 0x94, 0x84, 0x94, 0x94, 0x84,
+  0x94, 0x84, 0x84, 0x94, 0x84, 0x84, 0x94, 0x84, 0x84, 0x90, 0x62, 0x93,
+  0x93, 0x51, 0x32, 0x3E, 0x1B, 0x36, 0x56, 0x63, 0x13, 0x43, 0x23, 0x51,
+  0x41, 0x40, 0x94, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0x7F, 0x21, 0xFF, 0x41,
+  0xF2, 0x74, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0x90, 0x25, 0x25, 0x24, 0x25,
+  0x25, 0x52, 0x43, 0x42, 0x43, 0x24, 0x32, 0x50, 0x19, 0x1F, 0x31, 0x91,
+  0x15, 0x15, 0x14, 0x15, 0x15, 0x10, 0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2,
+  0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2,
+  0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC2, 0xC3, 0xC0, 0x86, 0xB9, 0x7C, 0x5D,
+  0x55, 0x36, 0x35, 0x55, 0x34, 0x65, 0x25, 0x65, 0x25, 0x65, 0x15, 0x75,
+  0x15, 0x75, 0x15, 0x66, 0x15, 0x65, 0x16, 0x65, 0x15, 0x75, 0x15, 0x75,
+  0x15, 0x65, 0x25, 0x65, 0x25, 0x64, 0x35, 0x55, 0x36, 0x35, 0x5D, 0x5C,
+  0x7A, 0xA5, 0x90, 0x93, 0xA3, 0x94, 0x85, 0x58, 0x2A, 0x2B, 0x2B, 0x85,
+  0x85, 0x75, 0x85, 0x85, 0x85, 0x84, 0x85, 0x85, 0x85, 0x85, 0x75, 0x85,
+  0x85, 0x85, 0x85, 0x75, 0x60, 0xB6, 0xCB, 0x9D, 0x7E, 0x66, 0x46, 0x55,
+  0x65, 0x55, 0x65, 0x45, 0x75, 0x45, 0x75, 0xF0, 0x5F, 0x15, 0xF0, 0x5F,
+  0x05, 0xF0, 0x6D, 0x6E, 0x6D, 0x6D, 0x7D, 0x7D, 0x6E, 0x6F, 0x0F, 0x14,
+  0xF2, 0x4F, 0x15, 0xF1, 0x40, 0x97, 0xBB, 0x8D, 0x6F, 0x04, 0x55, 0x64,
+  0x47, 0x53, 0x57, 0x53, 0x48, 0x5E, 0x5D, 0x6A, 0x9B, 0x8C, 0x9B, 0xAE,
+  0x6F, 0x05, 0xF0, 0x52, 0x58, 0x52, 0x58, 0x52, 0x57, 0x53, 0x64, 0x73,
+  0xF1, 0x5E, 0x7C, 0xA7, 0x90, 0xD6, 0xC7, 0xB7, 0xB8, 0xB8, 0xA3, 0x15,
+  0x94, 0x15, 0x84, 0x15, 0x84, 0x25, 0x74, 0x35, 0x73, 0x45, 0x63, 0x55,
+  0x54, 0x45, 0x54, 0x55, 0x44, 0x65, 0x4F, 0x22, 0xF2, 0x1F, 0x31, 0xF3,
+  0xB5, 0xE5, 0xE4, 0xE5, 0xE5, 0xE5, 0x50, 0x7D, 0x6E, 0x6E, 0x6E, 0x54,
+  0xF1, 0x4F, 0x04, 0xF1, 0x41, 0x69, 0xC7, 0xE6, 0xE5, 0x64, 0x64, 0x56,
+  0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xF0, 0x43, 0x57, 0x53, 0x56, 0x63, 0x64,
+  0x64, 0xF0, 0x6D, 0x8B, 0xB7, 0x90, 0x96, 0xBA, 0x8C, 0x6D, 0x55, 0x46,
+  0x35, 0x65, 0x34, 0xE5, 0xE4, 0x26, 0x7D, 0x5F, 0x04, 0xF1, 0x36, 0x46,
+  0x35, 0x65, 0x25, 0x75, 0x24, 0x85, 0x24, 0x85, 0x24, 0x84, 0x34, 0x75,
+  0x34, 0x65, 0x45, 0x46, 0x5D, 0x6C, 0x8A, 0xB6, 0x90, 0x1F, 0x31, 0xF2,
+  0x2F, 0x21, 0xF3, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xE4, 0xE5, 0xD5,
+  0xD5, 0xE5, 0xD5, 0xE5, 0xD5, 0xE5, 0xD5, 0xE5, 0xD5, 0xE5, 0xE5, 0xE0,
+  0x97, 0xBB, 0x7E, 0x5F, 0x14, 0x56, 0x53, 0x58, 0x43, 0x49, 0x43, 0x48,
+  0x44, 0x55, 0x65, 0xE7, 0xB8, 0xD6, 0xE5, 0x64, 0x63, 0x57, 0x53, 0x57,
+  0x52, 0x58, 0x52, 0x58, 0x52, 0x57, 0x53, 0x57, 0x53, 0x64, 0x64, 0xF1,
+  0x5E, 0x7B, 0xB7, 0x90, 0x96, 0xBA, 0x8C, 0x6D, 0x56, 0x45, 0x36, 0x64,
+  0x35, 0x74, 0x25, 0x84, 0x25, 0x84, 0x25, 0x84, 0x25, 0x75, 0x25, 0x65,
+  0x36, 0x46, 0x3F, 0x14, 0xF0, 0x5E, 0x66, 0x24, 0xE5, 0xE4, 0x35, 0x65,
+  0x36, 0x45, 0x4E, 0x6C, 0x8A, 0xB6, 0x90, 0x45, 0x45, 0x44, 0x45, 0x45,
+  0xFF, 0xFF, 0xE5, 0x45, 0x44, 0x45, 0x45, 0x40, 0x55, 0x55, 0x54, 0x55,
+  0x55, 0xFF, 0xFF, 0xF8, 0x55, 0x55, 0x45, 0x55, 0x58, 0x27, 0x37, 0x27,
+  0x35, 0x46, 0x28, 0xF3, 0x1F, 0x04, 0xC7, 0x99, 0x7C, 0x4C, 0x5B, 0x79,
+  0xA6, 0xD9, 0xAB, 0xAC, 0x9C, 0xA9, 0xC7, 0xF0, 0x4F, 0x22, 0x30, 0x3F,
+  0x22, 0xF2, 0x3F, 0x23, 0xF2, 0xFF, 0xFF, 0xF7, 0xF2, 0x3F, 0x22, 0xF2,
+  0x3F, 0x23, 0x32, 0xF2, 0x4F, 0x07, 0xC9, 0xAC, 0x9C, 0xAB, 0xA9, 0xD6,
+  0xA9, 0x7B, 0x5C, 0x4C, 0x79, 0x97, 0xC4, 0xF0, 0x1F, 0x30, 0x67, 0x9C,
+  0x5E, 0x3F, 0x02, 0x64, 0x71, 0x56, 0xB8, 0xA8, 0xA8, 0x5C, 0x5C, 0x6B,
+  0x6A, 0x7A, 0x7A, 0x7A, 0x6C, 0x4D, 0x5D, 0x4F, 0xFF, 0x45, 0xD5, 0xC6,
+  0xC5, 0xD5, 0xB0, 0xF2, 0x8F, 0x7E, 0xF2, 0xF2, 0xE7, 0x77, 0xA6, 0xC5,
+  0x95, 0xF0, 0x57, 0x4F, 0x34, 0x64, 0x75, 0x33, 0x24, 0x44, 0x68, 0x13,
+  0x34, 0x34, 0x6D, 0x43, 0x33, 0x65, 0x35, 0x53, 0x23, 0x64, 0x64, 0x53,
+  0x23, 0x54, 0x74, 0x53, 0x13, 0x64, 0x73, 0x63, 0x13, 0x54, 0x83, 0x53,
+  0x22, 0x64, 0x73, 0x63, 0x13, 0x63, 0x83, 0x54, 0x13, 0x54, 0x73, 0x63,
+  0x23, 0x54, 0x64, 0x53, 0x33, 0x54, 0x55, 0x44, 0x33, 0x55, 0x36, 0x25,
+  0x43, 0x5F, 0x55, 0x45, 0x82, 0x78, 0x37, 0x45, 0x59, 0x4F, 0xF0, 0x4F,
+  0xE6, 0xD1, 0xE7, 0x84, 0xF0, 0xF3, 0xF2, 0xF1, 0xF5, 0x9F, 0x00, 0xE6,
+  0xF1, 0x7F, 0x18, 0xE9, 0xE9, 0xDA, 0xDA, 0xC5, 0x15, 0xB6, 0x15, 0xB5,
+  0x25, 0xA6, 0x25, 0xA5, 0x45, 0x86, 0x45, 0x85, 0x55, 0x75, 0x65, 0x75,
+  0x65, 0x6F, 0x25, 0xF3, 0x5F, 0x34, 0xF5, 0x35, 0xA5, 0x25, 0xB5, 0x25,
+  0xB5, 0x15, 0xC5, 0x15, 0xCA, 0xD5, 0x5F, 0x09, 0xF2, 0x7F, 0x35, 0xF5,
+  0x46, 0x86, 0x45, 0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x36, 0xA4, 0x46, 0x95,
+  0x45, 0x95, 0x5F, 0x36, 0xF2, 0x6F, 0x45, 0xF4, 0x55, 0x96, 0x45, 0xA5,
+  0x45, 0xA5, 0x36, 0xA5, 0x35, 0xB5, 0x35, 0xA5, 0x45, 0x96, 0x4F, 0x44,
+  0xF4, 0x5F, 0x36, 0xF0, 0x90, 0xB8, 0xEC, 0xAF, 0x08, 0xF2, 0x66, 0x67,
+  0x46, 0x86, 0x36, 0xA5, 0x26, 0xB5, 0x25, 0xC5, 0x16, 0xF3, 0x5F, 0x45,
+  0xF4, 0x5F, 0x35, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xC5, 0x25, 0xC5,
+  0x26, 0xA5, 0x36, 0x96, 0x47, 0x57, 0x5F, 0x37, 0xF1, 0xAC, 0xE8, 0xA0,
+  0x5E, 0xAF, 0x18, 0xF2, 0x6F, 0x45, 0x58, 0x65, 0x59, 0x64, 0x5A, 0x53,
+  0x6A, 0x53, 0x6A, 0x53, 0x5B, 0x53, 0x5B, 0x53, 0x5B, 0x52, 0x6B, 0x52,
+  0x5B, 0x53, 0x5B, 0x53, 0x5B, 0x53, 0x5B, 0x52, 0x6A, 0x53, 0x5B, 0x53,
+  0x5A, 0x54, 0x59, 0x64, 0x57, 0x74, 0xF4, 0x5F, 0x36, 0xF1, 0x8D, 0xB0,
+  0x5F, 0x45, 0xF3, 0x6F, 0x35, 0xF4, 0x55, 0xF4, 0x5F, 0x45, 0xF4, 0x5F,
+  0x36, 0xF3, 0x5F, 0x45, 0xF4, 0xF2, 0x7F, 0x26, 0xF3, 0x6F, 0x36, 0x5F,
+  0x45, 0xF4, 0x5F, 0x36, 0xF3, 0x5F, 0x45, 0xF4, 0x5F, 0x3F, 0x54, 0xF4,
+  0x5F, 0x45, 0xF4, 0x50, 0x5F, 0x35, 0xF3, 0x4F, 0x35, 0xF3, 0x55, 0xF3,
+  0x5F, 0x35, 0xF2, 0x6F, 0x25, 0xF3, 0x5F, 0x35, 0xF3, 0xF1, 0x6F, 0x26,
+  0xF2, 0x6F, 0x17, 0x5F, 0x35, 0xF2, 0x6F, 0x25, 0xF3, 0x5F, 0x35, 0xF3,
+  0x5F, 0x26, 0xF2, 0x5F, 0x35, 0xF3, 0x5F, 0x30, 0xB8, 0xEC, 0xAF, 0x08,
+  0xF2, 0x66, 0x66, 0x55, 0x96, 0x35, 0xB5, 0x25, 0xC5, 0x25, 0xF3, 0x5F,
+  0x45, 0xF4, 0x5F, 0x35, 0x9F, 0x08, 0xF1, 0x8A, 0x15, 0x8A, 0x15, 0xD5,
+  0x15, 0xD5, 0x16, 0xB6, 0x16, 0xB5, 0x36, 0x96, 0x38, 0x58, 0x4F, 0x55,
+  0xE1, 0x46, 0xC2, 0x39, 0x84, 0x33, 0x65, 0xA5, 0x65, 0xA5, 0x56, 0xA5,
+  0x55, 0xA6, 0x55, 0xA5, 0x65, 0xA5, 0x56, 0xA5, 0x55, 0xB5, 0x55, 0xA6,
+  0x55, 0xA5, 0x6F, 0x55, 0xF6, 0x5F, 0x65, 0xF6, 0x55, 0xA5, 0x65, 0xA5,
+  0x56, 0xA5, 0x55, 0xB5, 0x55, 0xA6, 0x55, 0xA5, 0x65, 0xA5, 0x56, 0xA5,
+  0x55, 0xA6, 0x55, 0xA6, 0x55, 0xA5, 0x56, 0xA5, 0x50, 0x55, 0x46, 0x46,
+  0x45, 0x55, 0x55, 0x55, 0x46, 0x45, 0x55, 0x55, 0x55, 0x46, 0x46, 0x45,
+  0x55, 0x55, 0x55, 0x46, 0x45, 0x55, 0x55, 0x55, 0x46, 0x46, 0x45, 0x50,
+  0xF0, 0x5F, 0x05, 0xF0, 0x5E, 0x6E, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xE6,
+  0xE5, 0xF0, 0x5F, 0x05, 0xE6, 0xE6, 0xE5, 0xF0, 0x54, 0x56, 0x53, 0x56,
+  0x63, 0x56, 0x54, 0x56, 0x54, 0x56, 0x54, 0x64, 0x64, 0xF0, 0x6D, 0x8B,
+  0xA7, 0xA0, 0x55, 0xA6, 0x55, 0x96, 0x65, 0x86, 0x66, 0x67, 0x75, 0x66,
+  0x95, 0x56, 0xA5, 0x46, 0xA6, 0x36, 0xB5, 0x36, 0xC5, 0x26, 0xD5, 0x16,
+  0xEB, 0xEC, 0xED, 0xDE, 0xC7, 0x16, 0xC6, 0x36, 0xA6, 0x46, 0xA5, 0x66,
+  0x95, 0x66, 0x95, 0x76, 0x85, 0x77, 0x66, 0x86, 0x65, 0x97, 0x55, 0xA6,
+  0x55, 0xB6, 0x40, 0x55, 0xD5, 0xD5, 0xD5, 0xC6, 0xC5, 0xD5, 0xD5, 0xC6,
+  0xC5, 0xD5, 0xD5, 0xD5, 0xC6, 0xC5, 0xD5, 0xD5, 0xD5, 0xC6, 0xC5, 0xD5,
+  0xD5, 0xDF, 0xFF, 0x71, 0xF2, 0x10, 0x67, 0xA7, 0x77, 0x98, 0x68, 0x98,
+  0x68, 0x89, 0x68, 0x89, 0x68, 0x79, 0x78, 0x79, 0x65, 0x13, 0x73, 0x15,
+  0x65, 0x13, 0x64, 0x15, 0x65, 0x13, 0x64, 0x15, 0x65, 0x14, 0x44, 0x15,
+  0x65, 0x24, 0x44, 0x15, 0x65, 0x24, 0x34, 0x25, 0x65, 0x24, 0x34, 0x25,
+  0x65, 0x24, 0x24, 0x35, 0x65, 0x24, 0x24, 0x25, 0x65, 0x34, 0x23, 0x35,
+  0x65, 0x34, 0x14, 0x35, 0x65, 0x34, 0x14, 0x35, 0x65, 0x38, 0x44, 0x66,
+  0x38, 0x35, 0x65, 0x47, 0x45, 0x65, 0x47, 0x45, 0x65, 0x46, 0x55, 0x65,
+  0x46, 0x45, 0x65, 0x56, 0x45, 0x60, 0x65, 0xA5, 0x76, 0x95, 0x67, 0x95,
+  0x67, 0x95, 0x68, 0x85, 0x68, 0x75, 0x79, 0x65, 0x6A, 0x65, 0x65, 0x14,
+  0x65, 0x65, 0x15, 0x55, 0x65, 0x15, 0x45, 0x65, 0x34, 0x45, 0x65, 0x35,
+  0x35, 0x65, 0x35, 0x35, 0x65, 0x44, 0x35, 0x65, 0x45, 0x15, 0x65, 0x55,
+  0x15, 0x65, 0x64, 0x15, 0x65, 0x6A, 0x65, 0x78, 0x74, 0x88, 0x65, 0x88,
+  0x65, 0x97, 0x65, 0x97, 0x65, 0x96, 0x65, 0xB5, 0x60, 0xB8, 0xF0, 0xCB,
+  0xF0, 0x9F, 0x27, 0x66, 0x75, 0x68, 0x64, 0x5B, 0x63, 0x5C, 0x52, 0x5D,
+  0x52, 0x4E, 0x51, 0x5E, 0x51, 0x5E, 0xAF, 0x0A, 0xF0, 0xAE, 0x51, 0x5E,
+  0x51, 0x5E, 0x51, 0x5D, 0x52, 0x5C, 0x62, 0x6B, 0x54, 0x69, 0x55, 0x76,
+  0x67, 0xF2, 0x9F, 0x0B, 0xCF, 0x08, 0xB0, 0x5E, 0x9F, 0x16, 0xF3, 0x5F,
+  0x44, 0x58, 0x64, 0x59, 0x54, 0x59, 0x53, 0x69, 0x53, 0x5A, 0x53, 0x59,
+  0x54, 0x59, 0x54, 0x58, 0x54, 0xF4, 0x4F, 0x35, 0xF2, 0x6E, 0x95, 0xF2,
+  0x6F, 0x25, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x26, 0xF2, 0x5F, 0x35, 0xF3,
+  0x5F, 0x30, 0xB7, 0xF1, 0xCB, 0xF0, 0x9F, 0x27, 0x75, 0x75, 0x68, 0x64,
+  0x6A, 0x63, 0x5C, 0x52, 0x5D, 0x52, 0x4E, 0x51, 0x5E, 0x51, 0x5E, 0x51,
+  0x4F, 0x0A, 0xF0, 0xAE, 0x51, 0x5E, 0x51, 0x59, 0x14, 0x51, 0x58, 0x32,
+  0x52, 0x57, 0xB2, 0x66, 0xA4, 0x66, 0x85, 0x75, 0x86, 0xF4, 0x7F, 0x38,
+  0xF3, 0x98, 0x43, 0xF7, 0x25, 0x5F, 0x18, 0xF3, 0x6F, 0x35, 0xF5, 0x45,
+  0x96, 0x45, 0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x36, 0xA4, 0x45, 0xA5, 0x45,
+  0x95, 0x5F, 0x36, 0xF1, 0x7F, 0x36, 0xF4, 0x55, 0x86, 0x55, 0x95, 0x55,
+  0x95, 0x46, 0x95, 0x45, 0xA5, 0x45, 0x95, 0x55, 0x95, 0x55, 0x95, 0x46,
+  0x95, 0x45, 0xA5, 0x45, 0xA5, 0x40, 0xA8, 0xBD, 0x8F, 0x06, 0xF2, 0x46,
+  0x66, 0x45, 0x85, 0x35, 0x95, 0x35, 0x95, 0x35, 0xF2, 0x6F, 0x17, 0xF0,
+  0xCB, 0xE9, 0xF0, 0x9E, 0xD9, 0xF1, 0x6F, 0x25, 0x15, 0xB5, 0x15, 0xB4,
+  0x26, 0x95, 0x27, 0x66, 0x4F, 0x35, 0xF1, 0x7D, 0xB9, 0x80, 0x1F, 0x51,
+  0xFF, 0xFF, 0x28, 0x5F, 0x06, 0xF0, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF0,
+  0x6F, 0x05, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x06, 0xF0, 0x5F, 0x15, 0xF1,
+  0x5F, 0x15, 0xF0, 0x6F, 0x05, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x06, 0xC0,
+  0x45, 0xA5, 0x36, 0xA5, 0x35, 0xB5, 0x35, 0xA6, 0x35, 0xA5, 0x45, 0xA5,
+  0x35, 0xB5, 0x35, 0xA6, 0x35, 0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x35, 0xB5,
+  0x35, 0xA6, 0x35, 0xA5, 0x45, 0xA5, 0x45, 0xA5, 0x35, 0xB5, 0x35, 0xA6,
+  0x35, 0xA5, 0x45, 0xA5, 0x45, 0x95, 0x57, 0x57, 0x6F, 0x27, 0xF1, 0xAC,
+  0xE8, 0xB0, 0x06, 0xBB, 0xA5, 0x25, 0xA5, 0x25, 0x95, 0x35, 0x95, 0x35,
+  0x85, 0x45, 0x85, 0x45, 0x75, 0x55, 0x74, 0x65, 0x65, 0x74, 0x64, 0x84,
+  0x55, 0x85, 0x44, 0x95, 0x35, 0x95, 0x34, 0xA5, 0x25, 0xA5, 0x24, 0xB5,
+  0x15, 0xC4, 0x14, 0xD9, 0xD8, 0xE7, 0xF0, 0x7F, 0x06, 0xF1, 0x6F, 0x15,
+  0xE0, 0x05, 0x86, 0x8A, 0x86, 0x7B, 0x77, 0x75, 0x15, 0x77, 0x66, 0x15,
+  0x68, 0x65, 0x25, 0x68, 0x65, 0x25, 0x59, 0x55, 0x35, 0x54, 0x14, 0x55,
+  0x44, 0x54, 0x14, 0x45, 0x54, 0x44, 0x24, 0x45, 0x54, 0x44, 0x24, 0x44,
+  0x64, 0x35, 0x24, 0x35, 0x64, 0x34, 0x34, 0x34, 0x74, 0x25, 0x34, 0x25,
+  0x74, 0x24, 0x44, 0x24, 0x84, 0x24, 0x44, 0x24, 0x84, 0x14, 0x54, 0x15,
+  0x84, 0x14, 0x54, 0x14, 0x98, 0x69, 0x98, 0x68, 0xA7, 0x78, 0xA7, 0x77,
+  0xB7, 0x77, 0xB6, 0x86, 0xD5, 0x86, 0xD4, 0x95, 0xC0, 0x66, 0x96, 0x66,
+  0x86, 0x86, 0x66, 0x96, 0x56, 0xA6, 0x55, 0xC6, 0x35, 0xD6, 0x26, 0xE5,
+  0x16, 0xF0, 0xBF, 0x1A, 0xF3, 0x8F, 0x48, 0xF4, 0x7F, 0x57, 0xF4, 0x8F,
+  0x3A, 0xF2, 0xAF, 0x15, 0x15, 0xF0, 0x61, 0x6D, 0x62, 0x6C, 0x64, 0x6A,
+  0x65, 0x6A, 0x65, 0x69, 0x67, 0x67, 0x68, 0x66, 0x69, 0x75, 0x15, 0xA6,
+  0x16, 0x86, 0x26, 0x85, 0x36, 0x76, 0x45, 0x66, 0x56, 0x55, 0x66, 0x46,
+  0x75, 0x36, 0x85, 0x35, 0x96, 0x16, 0xA5, 0x15, 0xBA, 0xC9, 0xE8, 0xE7,
+  0xF0, 0x6F, 0x16, 0xF1, 0x5F, 0x25, 0xF2, 0x5F, 0x25, 0xF1, 0x6F, 0x15,
+  0xF2, 0x5F, 0x25, 0xF2, 0x5D, 0x5F, 0x55, 0xF4, 0x6F, 0x46, 0xF4, 0xF3,
+  0x6F, 0x36, 0xF3, 0x6F, 0x37, 0xF2, 0x7F, 0x27, 0xF3, 0x6F, 0x36, 0xF3,
+  0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3,
+  0x7F, 0x27, 0xF3, 0xF4, 0x6F, 0x45, 0xF5, 0x5F, 0x46, 0x78, 0x78, 0x78,
+  0x69, 0x64, 0xB4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xB4, 0xA5, 0xA4, 0xB4,
+  0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xB4, 0xA5, 0xA4,
+  0xB4, 0xB4, 0xB8, 0x68, 0x78, 0x78, 0x70, 0x03, 0x23, 0x23, 0x23, 0x23,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x33, 0x23, 0x23, 0x23, 0x23, 0x23, 0x32,
+  0x32, 0x32, 0x32, 0x33, 0x23, 0x23, 0x23, 0x23, 0x78, 0x78, 0x78, 0x68,
+  0xB4, 0xB4, 0xB4, 0xA5, 0xA4, 0xB4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xB4,
+  0xA4, 0xB4, 0xB4, 0xB4, 0xA5, 0xA4, 0xB4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4,
+  0xB4, 0x69, 0x68, 0x78, 0x78, 0x70, 0x95, 0xA6, 0x97, 0x97, 0x88, 0x83,
+  0x24, 0x64, 0x24, 0x54, 0x34, 0x54, 0x34, 0x44, 0x44, 0x43, 0x64, 0x24,
+  0x64, 0x14, 0x74, 0x14, 0x78, 0x84, 0x0F, 0xFF, 0xF3, 0x04, 0x23, 0x32,
+  0x33, 0x32, 0x78, 0x8C, 0x5D, 0x4F, 0x03, 0x54, 0x63, 0x46, 0x5D, 0x5A,
+  0x76, 0xC4, 0xE3, 0x91, 0x52, 0x55, 0x52, 0x56, 0x52, 0x55, 0x62, 0x54,
+  0x72, 0xF0, 0x3F, 0x04, 0x81, 0x56, 0x43, 0x62, 0x55, 0xF0, 0x5F, 0x05,
+  0xF0, 0x5F, 0x04, 0xF0, 0x5F, 0x05, 0xF0, 0x52, 0x67, 0xE5, 0xF1, 0x4F,
+  0x14, 0x74, 0x63, 0x65, 0x63, 0x57, 0x52, 0x58, 0x52, 0x58, 0x52, 0x49,
+  0x52, 0x49, 0x52, 0x48, 0x52, 0x58, 0x52, 0x66, 0x53, 0x73, 0x73, 0xF1,
+  0x4F, 0x04, 0x51, 0x95, 0x52, 0x67, 0x86, 0x9B, 0x6D, 0x4F, 0x02, 0x64,
+  0x62, 0x56, 0x51, 0x57, 0x51, 0x5D, 0x5C, 0x5D, 0x5D, 0x5D, 0x57, 0x51,
+  0x56, 0x52, 0x64, 0x63, 0xE4, 0xD6, 0xB9, 0x77, 0xF1, 0x5F, 0x25, 0xF2,
+  0x5F, 0x25, 0xF2, 0x5F, 0x15, 0xF2, 0x59, 0x62, 0x57, 0x91, 0x56, 0xF1,
+  0x5F, 0x15, 0x73, 0x75, 0x56, 0x64, 0x57, 0x64, 0x58, 0x44, 0x59, 0x44,
+  0x58, 0x54, 0x58, 0x54, 0x58, 0x54, 0x57, 0x55, 0x56, 0x65, 0x64, 0x76,
+  0xF1, 0x6F, 0x17, 0xE9, 0x62, 0x56, 0x87, 0xAA, 0x7D, 0x5F, 0x03, 0x65,
+  0x62, 0x57, 0x51, 0x58, 0x51, 0x58, 0x51, 0xFF, 0xFF, 0x1E, 0x5E, 0x57,
+  0x52, 0x65, 0x63, 0xF0, 0x4E, 0x7A, 0xA7, 0x80, 0x85, 0x67, 0x58, 0x58,
+  0x55, 0x75, 0x85, 0x5B, 0x2B, 0x2A, 0x55, 0x85, 0x85, 0x85, 0x85, 0x75,
+  0x85, 0x85, 0x85, 0x84, 0x85, 0x85, 0x85, 0x85, 0x75, 0x85, 0x80, 0x95,
+  0x35, 0x79, 0x15, 0x6A, 0x14, 0x6F, 0x15, 0x73, 0x75, 0x56, 0x64, 0x67,
+  0x54, 0x58, 0x45, 0x49, 0x44, 0x59, 0x44, 0x58, 0x54, 0x58, 0x45, 0x57,
+  0x55, 0x56, 0x65, 0x64, 0x76, 0xF1, 0x6F, 0x08, 0x91, 0x4A, 0x52, 0x5F,
+  0x25, 0xF2, 0x54, 0x57, 0x55, 0x57, 0x55, 0x64, 0x67, 0xE9, 0xCC, 0x7B,
+  0x65, 0xE5, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x53, 0x57,
+  0x51, 0x95, 0xF1, 0x4F, 0x13, 0x74, 0x63, 0x66, 0x53, 0x57, 0x53, 0x57,
+  0x53, 0x48, 0x52, 0x57, 0x53, 0x57, 0x53, 0x57, 0x53, 0x57, 0x52, 0x58,
+  0x52, 0x57, 0x53, 0x57, 0x53, 0x57, 0x53, 0x57, 0x52, 0x58, 0x43, 0x55,
+  0x55, 0x55, 0x45, 0xFF, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55,
+  0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x50,
+  0xA5, 0xA4, 0xA5, 0xA5, 0xFF, 0xF9, 0x5A, 0x5A, 0x5A, 0x59, 0x5A, 0x5A,
+  0x5A, 0x5A, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x4A, 0x5A, 0x5A, 0x5A, 0x59,
+  0x5A, 0x5A, 0x5A, 0x59, 0x67, 0x78, 0x78, 0x68, 0x5A, 0x55, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x14, 0xF1, 0x5F, 0x15, 0xF1, 0x56, 0x55, 0x55, 0x55,
+  0x55, 0x56, 0x53, 0x67, 0x52, 0x68, 0x51, 0x69, 0xB9, 0xBA, 0xBA, 0xC9,
+  0xC9, 0x61, 0x58, 0x62, 0x67, 0x54, 0x57, 0x54, 0x57, 0x54, 0x66, 0x55,
+  0x55, 0x56, 0x64, 0x56, 0x64, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55,
+  0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x45,
+  0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x50, 0x45, 0x35, 0x56, 0x65,
+  0x18, 0x29, 0x54, 0x1F, 0x63, 0xFC, 0x37, 0x38, 0x45, 0x35, 0x65, 0x65,
+  0x35, 0x65, 0x65, 0x25, 0x65, 0x65, 0x35, 0x65, 0x65, 0x35, 0x65, 0x65,
+  0x35, 0x65, 0x65, 0x35, 0x65, 0x65, 0x25, 0x65, 0x65, 0x35, 0x65, 0x65,
+  0x35, 0x65, 0x65, 0x35, 0x65, 0x65, 0x35, 0x65, 0x64, 0x35, 0x65, 0x65,
+  0x35, 0x65, 0x65, 0x30, 0x45, 0x35, 0x75, 0x19, 0x5F, 0x13, 0xF2, 0x37,
+  0x46, 0x36, 0x65, 0x35, 0x75, 0x35, 0x75, 0x25, 0x85, 0x25, 0x75, 0x35,
+  0x75, 0x35, 0x75, 0x34, 0x85, 0x25, 0x85, 0x25, 0x75, 0x35, 0x75, 0x35,
+  0x75, 0x34, 0x85, 0x25, 0x84, 0x30, 0x87, 0xAB, 0x6E, 0x4F, 0x03, 0x73,
+  0x72, 0x56, 0x61, 0x58, 0x51, 0x58, 0xA9, 0xA9, 0xA8, 0xB8, 0x51, 0x58,
+  0x51, 0x66, 0x52, 0x65, 0x63, 0xF0, 0x4E, 0x6B, 0xA7, 0x80, 0x65, 0x26,
+  0x95, 0x18, 0x75, 0x1A, 0x6F, 0x16, 0x74, 0x65, 0x66, 0x55, 0x57, 0x54,
+  0x58, 0x54, 0x58, 0x54, 0x58, 0x54, 0x49, 0x54, 0x48, 0x54, 0x58, 0x54,
+  0x66, 0x55, 0x73, 0x75, 0xF1, 0x6F, 0x06, 0x51, 0x97, 0x52, 0x69, 0x5F,
+  0x25, 0xF2, 0x4F, 0x25, 0xF2, 0x5F, 0x25, 0xF2, 0x5F, 0x15, 0xF2, 0x75,
+  0x35, 0x59, 0x15, 0x4A, 0x15, 0x3F, 0x13, 0x73, 0x73, 0x56, 0x62, 0x58,
+  0x52, 0x58, 0x51, 0x59, 0x42, 0x59, 0x42, 0x58, 0x52, 0x58, 0x52, 0x57,
+  0x53, 0x56, 0x63, 0x64, 0x74, 0xF1, 0x4F, 0x15, 0xE7, 0x62, 0x5F, 0x05,
+  0xF0, 0x5F, 0x05, 0xE5, 0xF0, 0x5F, 0x05, 0xF0, 0x5F, 0x05, 0x50, 0x45,
+  0x33, 0x45, 0x15, 0x4A, 0x4B, 0x47, 0x86, 0x95, 0xA5, 0x95, 0xA5, 0xA5,
+  0xA5, 0xA5, 0x95, 0xA5, 0xA5, 0xA5, 0xA4, 0xA5, 0xA0, 0x77, 0x9B, 0x6D,
+  0x4F, 0x02, 0x64, 0x62, 0x56, 0x52, 0x6C, 0x99, 0xC7, 0xD7, 0xC9, 0x9C,
+  0x61, 0x57, 0x51, 0x65, 0x61, 0xF1, 0x3E, 0x5C, 0x87, 0x70, 0x45, 0x65,
+  0x55, 0x65, 0x65, 0x49, 0x1A, 0x1A, 0x35, 0x65, 0x65, 0x55, 0x65, 0x65,
+  0x65, 0x65, 0x55, 0x65, 0x65, 0x67, 0x47, 0x47, 0x56, 0x40, 0x35, 0x75,
+  0x35, 0x75, 0x25, 0x75, 0x35, 0x75, 0x35, 0x75, 0x35, 0x75, 0x35, 0x75,
+  0x25, 0x75, 0x35, 0x75, 0x35, 0x75, 0x35, 0x75, 0x35, 0x75, 0x25, 0x75,
+  0x35, 0x66, 0x35, 0x57, 0x3F, 0x23, 0xF1, 0x59, 0x15, 0x66, 0x35, 0x40,
+  0x05, 0x7B, 0x75, 0x15, 0x65, 0x25, 0x65, 0x25, 0x55, 0x35, 0x55, 0x35,
+  0x45, 0x54, 0x45, 0x54, 0x35, 0x64, 0x35, 0x64, 0x25, 0x75, 0x14, 0x8A,
+  0x89, 0xA8, 0xA7, 0xB7, 0xB6, 0xC6, 0xA0, 0x05, 0x65, 0x5B, 0x65, 0x55,
+  0x15, 0x56, 0x55, 0x15, 0x56, 0x45, 0x25, 0x47, 0x45, 0x25, 0x47, 0x35,
+  0x35, 0x34, 0x13, 0x35, 0x44, 0x34, 0x13, 0x25, 0x54, 0x24, 0x23, 0x25,
+  0x54, 0x24, 0x23, 0x24, 0x64, 0x14, 0x33, 0x15, 0x64, 0x14, 0x33, 0x14,
+  0x74, 0x14, 0x38, 0x78, 0x47, 0x88, 0x47, 0x87, 0x56, 0x97, 0x56, 0x96,
+  0x65, 0xA6, 0x65, 0x90, 0x46, 0x56, 0x56, 0x55, 0x75, 0x45, 0x86, 0x26,
+  0x95, 0x16, 0xA5, 0x15, 0xC9, 0xD8, 0xE7, 0xF1, 0x5F, 0x17, 0xE8, 0xDA,
+  0xB5, 0x15, 0xA6, 0x16, 0x95, 0x35, 0x85, 0x46, 0x66, 0x46, 0x56, 0x65,
+  0x50, 0x36, 0x85, 0x45, 0x75, 0x55, 0x74, 0x65, 0x65, 0x65, 0x64, 0x75,
+  0x55, 0x75, 0x54, 0x85, 0x45, 0x94, 0x44, 0xA5, 0x25, 0xA5, 0x24, 0xB5,
+  0x15, 0xB5, 0x14, 0xC9, 0xD9, 0xD8, 0xF0, 0x7F, 0x06, 0xF1, 0x6F, 0x15,
+  0xF2, 0x5F, 0x15, 0xF1, 0x5E, 0x8E, 0x7F, 0x06, 0xF0, 0x5F, 0x20, 0x4F,
+  0x04, 0xF0, 0x4F, 0x04, 0xED, 0x6C, 0x6C, 0x6C, 0x6B, 0x7B, 0x6C, 0x6C,
+  0x6C, 0x6C, 0x6C, 0x6C, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0x95, 0x86,
+  0x77, 0x67, 0x75, 0x94, 0xA4, 0xA4, 0x94, 0xA4, 0xA4, 0xA4, 0x95, 0x94,
+  0x95, 0x76, 0x83, 0xB6, 0xA4, 0xA4, 0xA4, 0xA4, 0x94, 0xA4, 0xA4, 0xA4,
+  0x94, 0xA4, 0xA4, 0xA7, 0x76, 0x95, 0xA4, 0x70, 0x63, 0x63, 0x62, 0x63,
+  0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63,
+  0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63,
+  0x63, 0x63, 0x72, 0x71, 0xF1, 0x74, 0xA5, 0x96, 0x77, 0xA4, 0xA4, 0xA4,
+  0x94, 0xA4, 0xA4, 0xA4, 0x94, 0xA4, 0xA4, 0xA4, 0xA6, 0xB3, 0x86, 0x75,
+  0x94, 0x95, 0x94, 0xA4, 0xA4, 0xA4, 0x94, 0xA4, 0xA4, 0x95, 0x76, 0x77,
+  0x76, 0x85, 0x90, 0x44, 0xB7, 0x53, 0x19, 0x43, 0x13, 0x39, 0x22, 0x67,
+  0xB4, 0x30 };
 
 const GFXglyph FreeSansBoldOblique18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  10,    0,    1 },   // 0x20 ' '
   {     0,  10,  25,  12,    4,  -24 },   // 0x21 '!'
-  {    32,  13,   9,  17,    6,  -25 },   // 0x22 '"'
-  {    47,  22,  24,  19,    1,  -23 },   // 0x23 '#'
-  {   113,  19,  31,  19,    2,  -26 },   // 0x24 '$'
-  {   187,  26,  26,  31,    5,  -25 },   // 0x25 '%'
-  {   272,  21,  25,  25,    3,  -24 },   // 0x26 '&'
-  {   338,   5,   9,   8,    6,  -25 },   // 0x27 '''
-  {   344,  13,  33,  12,    3,  -25 },   // 0x28 '('
-  {   398,  13,  33,  12,   -1,  -25 },   // 0x29 ')'
-  {   452,  12,  11,  14,    5,  -25 },   // 0x2A '*'
-  {   469,  18,  16,  20,    3,  -15 },   // 0x2B '+'
-  {   505,   7,  11,  10,    1,   -4 },   // 0x2C ','
-  {   515,  10,   4,  12,    2,  -10 },   // 0x2D '-'
-  {   520,   6,   5,  10,    2,   -4 },   // 0x2E '.'
-  {   524,  15,  25,  10,    0,  -24 },   // 0x2F '/'
-  {   571,  18,  25,  19,    3,  -24 },   // 0x30 '0'
-  {   628,  13,  25,  19,    6,  -24 },   // 0x31 '1'
-  {   669,  21,  25,  19,    1,  -24 },   // 0x32 '2'
-  {   735,  20,  25,  19,    2,  -24 },   // 0x33 '3'
-  {   798,  19,  25,  19,    2,  -24 },   // 0x34 '4'
-  {   858,  20,  24,  19,    2,  -23 },   // 0x35 '5'
-  {   918,  19,  25,  19,    3,  -24 },   // 0x36 '6'
-  {   978,  19,  24,  19,    5,  -23 },   // 0x37 '7'
-  {  1035,  20,  25,  19,    2,  -24 },   // 0x38 '8'
-  {  1098,  19,  25,  19,    2,  -24 },   // 0x39 '9'
-  {  1158,   9,  18,  12,    4,  -17 },   // 0x3A ':'
-  {  1179,  10,  24,  12,    3,  -17 },   // 0x3B ';'
-  {  1209,  19,  17,  20,    3,  -16 },   // 0x3C '<'
-  {  1250,  20,  12,  20,    2,  -13 },   // 0x3D '='
-  {  1280,  19,  17,  20,    1,  -15 },   // 0x3E '>'
-  {  1321,  18,  26,  21,    6,  -25 },   // 0x3F '?'
-  {  1380,  33,  31,  34,    3,  -25 },   // 0x40 '@'
-  {  1508,  23,  26,  25,    1,  -25 },   // 0x41 'A'
-  {  1583,  24,  26,  25,    3,  -25 },   // 0x42 'B'
-  {  1661,  24,  26,  25,    4,  -25 },   // 0x43 'C'
-  {  1739,  24,  26,  25,    3,  -25 },   // 0x44 'D'
-  {  1817,  24,  26,  23,    3,  -25 },   // 0x45 'E'
-  {  1895,  23,  26,  21,    3,  -25 },   // 0x46 'F'
-  {  1970,  24,  26,  27,    4,  -25 },   // 0x47 'G'
-  {  2048,  26,  26,  25,    2,  -25 },   // 0x48 'H'
-  {  2133,  10,  26,  10,    2,  -25 },   // 0x49 'I'
-  {  2166,  20,  26,  19,    2,  -25 },   // 0x4A 'J'
-  {  2231,  26,  26,  25,    3,  -25 },   // 0x4B 'K'
-  {  2316,  18,  26,  21,    3,  -25 },   // 0x4C 'L'
-  {  2375,  31,  26,  29,    2,  -25 },   // 0x4D 'M'
-  {  2476,  27,  26,  25,    2,  -25 },   // 0x4E 'N'
-  {  2564,  25,  26,  27,    4,  -25 },   // 0x4F 'O'
-  {  2646,  23,  26,  23,    3,  -25 },   // 0x50 'P'
-  {  2721,  25,  27,  27,    4,  -25 },   // 0x51 'Q'
-  {  2806,  24,  26,  25,    3,  -25 },   // 0x52 'R'
-  {  2884,  22,  26,  23,    3,  -25 },   // 0x53 'S'
-  {  2956,  21,  26,  21,    5,  -25 },   // 0x54 'T'
-  {  3025,  24,  26,  25,    4,  -25 },   // 0x55 'U'
-  {  3103,  22,  26,  23,    6,  -25 },   // 0x56 'V'
-  {  3175,  32,  26,  33,    6,  -25 },   // 0x57 'W'
-  {  3279,  27,  26,  23,    1,  -25 },   // 0x58 'X'
-  {  3367,  22,  26,  23,    6,  -25 },   // 0x59 'Y'
-  {  3439,  25,  26,  21,    1,  -25 },   // 0x5A 'Z'
-  {  3521,  15,  33,  12,    1,  -25 },   // 0x5B '['
-  {  3583,   5,  25,  10,    5,  -24 },   // 0x5C '\'
-  {  3599,  15,  33,  12,   -1,  -25 },   // 0x5D ']'
-  {  3661,  16,  15,  20,    4,  -23 },   // 0x5E '^'
-  {  3691,  21,   3,  19,   -2,    5 },   // 0x5F '_'
-  {  3699,   5,   5,  12,    6,  -25 },   // 0x60 '`'
-  {  3703,  18,  19,  19,    2,  -18 },   // 0x61 'a'
-  {  3746,  20,  26,  21,    2,  -25 },   // 0x62 'b'
-  {  3811,  18,  19,  19,    3,  -18 },   // 0x63 'c'
-  {  3854,  22,  26,  21,    3,  -25 },   // 0x64 'd'
-  {  3926,  19,  19,  19,    2,  -18 },   // 0x65 'e'
-  {  3972,  13,  26,  12,    3,  -25 },   // 0x66 'f'
-  {  4015,  22,  27,  21,    1,  -18 },   // 0x67 'g'
-  {  4090,  20,  26,  21,    2,  -25 },   // 0x68 'h'
-  {  4155,  10,  26,  10,    2,  -25 },   // 0x69 'i'
-  {  4188,  15,  34,  10,   -2,  -25 },   // 0x6A 'j'
-  {  4252,  21,  26,  19,    2,  -25 },   // 0x6B 'k'
-  {  4321,  10,  26,  10,    2,  -25 },   // 0x6C 'l'
-  {  4354,  30,  19,  31,    2,  -18 },   // 0x6D 'm'
-  {  4426,  20,  19,  21,    2,  -18 },   // 0x6E 'n'
-  {  4474,  19,  19,  21,    3,  -18 },   // 0x6F 'o'
-  {  4520,  22,  27,  21,    0,  -18 },   // 0x70 'p'
-  {  4595,  20,  27,  21,    3,  -18 },   // 0x71 'q'
-  {  4663,  15,  19,  14,    2,  -18 },   // 0x72 'r'
-  {  4699,  18,  19,  19,    2,  -18 },   // 0x73 's'
-  {  4742,  11,  23,  12,    4,  -22 },   // 0x74 't'
-  {  4774,  20,  19,  21,    3,  -18 },   // 0x75 'u'
-  {  4822,  18,  19,  19,    5,  -18 },   // 0x76 'v'
-  {  4865,  27,  19,  27,    4,  -18 },   // 0x77 'w'
-  {  4930,  22,  19,  19,    1,  -18 },   // 0x78 'x'
-  {  4983,  22,  27,  19,    1,  -18 },   // 0x79 'y'
-  {  5058,  19,  19,  17,    1,  -18 },   // 0x7A 'z'
-  {  5104,  14,  33,  14,    2,  -25 },   // 0x7B '{'
-  {  5162,   9,  33,  10,    2,  -25 },   // 0x7C '|'
-  {  5200,  14,  33,  14,    2,  -25 },   // 0x7D '}'
-  {  5258,  17,   6,  20,    3,  -10 } }; // 0x7E '~'
+  {    26,  13,   9,  17,    6,  -25 },   // 0x22 '"'
+  {    43,  22,  24,  19,    1,  -23 },   // 0x23 '#'
+  {    88,  19,  31,  19,    2,  -26 },   // 0x24 '$'
+  {   141,  26,  26,  31,    5,  -25 },   // 0x25 '%'
+  {   203,  21,  25,  25,    3,  -24 },   // 0x26 '&'
+  {   246,   5,   9,   8,    6,  -25 },   // 0x27 '''
+  {   254,  13,  33,  12,    3,  -25 },   // 0x28 '('
+  {   288,  13,  33,  12,   -1,  -25 },   // 0x29 ')'
+  {   322,  12,  11,  14,    5,  -25 },   // 0x2A '*'
+  {   338,  18,  16,  20,    3,  -15 },   // 0x2B '+'
+  {   356,   7,  11,  10,    1,   -4 },   // 0x2C ','
+  {   368,  10,   4,  12,    2,  -10 },   // 0x2D '-'
+  {   372,   6,   5,  10,    2,   -4 },   // 0x2E '.'
+  {   378,  15,  25,  10,    0,  -24 },   // 0x2F '/'
+  {   404,  18,  25,  19,    3,  -24 },   // 0x30 '0'
+  {   447,  13,  25,  19,    6,  -24 },   // 0x31 '1'
+  {   473,  21,  25,  19,    1,  -24 },   // 0x32 '2'
+  {   509,  20,  25,  19,    2,  -24 },   // 0x33 '3'
+  {   545,  19,  25,  19,    2,  -24 },   // 0x34 '4'
+  {   583,  20,  24,  19,    2,  -23 },   // 0x35 '5'
+  {   618,  19,  25,  19,    3,  -24 },   // 0x36 '6'
+  {   657,  19,  24,  19,    5,  -23 },   // 0x37 '7'
+  {   684,  20,  25,  19,    2,  -24 },   // 0x38 '8'
+  {   724,  19,  25,  19,    2,  -24 },   // 0x39 '9'
+  {   763,   9,  18,  12,    4,  -17 },   // 0x3A ':'
+  {   776,  10,  24,  12,    3,  -17 },   // 0x3B ';'
+  {   795,  19,  17,  20,    3,  -16 },   // 0x3C '<'
+  {   815,  20,  12,  20,    2,  -13 },   // 0x3D '='
+  {   830,  19,  17,  20,    1,  -15 },   // 0x3E '>'
+  {   850,  18,  26,  21,    6,  -25 },   // 0x3F '?'
+  {   879,  33,  31,  34,    3,  -25 },   // 0x40 '@'
+  {   971,  23,  26,  25,    1,  -25 },   // 0x41 'A'
+  {  1014,  24,  26,  25,    3,  -25 },   // 0x42 'B'
+  {  1061,  24,  26,  25,    4,  -25 },   // 0x43 'C'
+  {  1104,  24,  26,  25,    3,  -25 },   // 0x44 'D'
+  {  1152,  24,  26,  23,    3,  -25 },   // 0x45 'E'
+  {  1192,  23,  26,  21,    3,  -25 },   // 0x46 'F'
+  {  1232,  24,  26,  27,    4,  -25 },   // 0x47 'G'
+  {  1278,  26,  26,  25,    2,  -25 },   // 0x48 'H'
+  {  1329,  10,  26,  10,    2,  -25 },   // 0x49 'I'
+  {  1356,  20,  26,  19,    2,  -25 },   // 0x4A 'J'
+  {  1394,  26,  26,  25,    3,  -25 },   // 0x4B 'K'
+  {  1443,  18,  26,  21,    3,  -25 },   // 0x4C 'L'
+  {  1470,  31,  26,  29,    2,  -25 },   // 0x4D 'M'
+  {  1554,  27,  26,  25,    2,  -25 },   // 0x4E 'N'
+  {  1617,  25,  26,  27,    4,  -25 },   // 0x4F 'O'
+  {  1663,  23,  26,  23,    3,  -25 },   // 0x50 'P'
+  {  1706,  25,  27,  27,    4,  -25 },   // 0x51 'Q'
+  {  1757,  24,  26,  25,    3,  -25 },   // 0x52 'R'
+  {  1806,  22,  26,  23,    3,  -25 },   // 0x53 'S'
+  {  1846,  21,  26,  21,    5,  -25 },   // 0x54 'T'
+  {  1884,  24,  26,  25,    4,  -25 },   // 0x55 'U'
+  {  1934,  22,  26,  23,    6,  -25 },   // 0x56 'V'
+  {  1981,  32,  26,  33,    6,  -25 },   // 0x57 'W'
+  {  2061,  27,  26,  23,    1,  -25 },   // 0x58 'X'
+  {  2110,  22,  26,  23,    6,  -25 },   // 0x59 'Y'
+  {  2153,  25,  26,  21,    1,  -25 },   // 0x5A 'Z'
+  {  2193,  15,  33,  12,    1,  -25 },   // 0x5B '['
+  {  2227,   5,  25,  10,    5,  -24 },   // 0x5C '\'
+  {  2252,  15,  33,  12,   -1,  -25 },   // 0x5D ']'
+  {  2286,  16,  15,  20,    4,  -23 },   // 0x5E '^'
+  {  2310,  21,   3,  19,   -2,    5 },   // 0x5F '_'
+  {  2313,   5,   5,  12,    6,  -25 },   // 0x60 '`'
+  {  2318,  18,  19,  19,    2,  -18 },   // 0x61 'a'
+  {  2348,  20,  26,  21,    2,  -25 },   // 0x62 'b'
+  {  2394,  18,  19,  19,    3,  -18 },   // 0x63 'c'
+  {  2420,  22,  26,  21,    3,  -25 },   // 0x64 'd'
+  {  2466,  19,  19,  19,    2,  -18 },   // 0x65 'e'
+  {  2492,  13,  26,  12,    3,  -25 },   // 0x66 'f'
+  {  2519,  22,  27,  21,    1,  -18 },   // 0x67 'g'
+  {  2568,  20,  26,  21,    2,  -25 },   // 0x68 'h'
+  {  2615,  10,  26,  10,    2,  -25 },   // 0x69 'i'
+  {  2640,  15,  34,  10,   -2,  -25 },   // 0x6A 'j'
+  {  2673,  21,  26,  19,    2,  -25 },   // 0x6B 'k'
+  {  2717,  10,  26,  10,    2,  -25 },   // 0x6C 'l'
+  {  2744,  30,  19,  31,    2,  -18 },   // 0x6D 'm'
+  {  2800,  20,  19,  21,    2,  -18 },   // 0x6E 'n'
+  {  2838,  19,  19,  21,    3,  -18 },   // 0x6F 'o'
+  {  2866,  22,  27,  21,    0,  -18 },   // 0x70 'p'
+  {  2915,  20,  27,  21,    3,  -18 },   // 0x71 'q'
+  {  2963,  15,  19,  14,    2,  -18 },   // 0x72 'r'
+  {  2985,  18,  19,  19,    2,  -18 },   // 0x73 's'
+  {  3010,  11,  23,  12,    4,  -22 },   // 0x74 't'
+  {  3034,  20,  19,  21,    3,  -18 },   // 0x75 'u'
+  {  3072,  18,  19,  19,    5,  -18 },   // 0x76 'v'
+  {  3103,  27,  19,  27,    4,  -18 },   // 0x77 'w'
+  {  3160,  22,  19,  19,    1,  -18 },   // 0x78 'x'
+  {  3193,  22,  27,  19,    1,  -18 },   // 0x79 'y'
+  {  3239,  19,  19,  17,    1,  -18 },   // 0x7A 'z'
+  {  3262,  14,  33,  14,    2,  -25 },   // 0x7B '{'
+  {  3296,   9,  33,  10,    2,  -25 },   // 0x7C '|'
+  {  3329,  14,  33,  14,    2,  -25 },   // 0x7D '}'
+  {  3363,  17,   6,  20,    3,  -10 } }; // 0x7E '~'
 
 const GFXfont FreeSansBoldOblique18pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique18pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42, 1,
+  NULL, 0, 1 };
 
-// Approx. 5943 bytes
+// Approx. 4046 bytes
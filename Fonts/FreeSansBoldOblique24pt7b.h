@@ -1,893 +1,508 @@
 const uint8_t FreeSansBoldOblique24pt7bBitmaps[] PROGMEM = {
-  0x01, 0xE0, 0x07, 0xF0, 0x1F, 0xC0, 0xFF, 0x03, 0xF8, 0x0F, 0xE0, 0x3F,
-  0x80, 0xFE, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xE0, 0x1F,
-  0x80, 0x7E, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
-  0x80, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1F,
-  0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xFE, 0x03, 0xF8, 0x00,
-  0x7E, 0x0F, 0xDF, 0x83, 0xF7, 0xE0, 0xFF, 0xF0, 0x7E, 0xFC, 0x1F, 0xBF,
-  0x07, 0xEF, 0xC1, 0xFB, 0xE0, 0x7C, 0xF8, 0x1F, 0x3C, 0x07, 0x8F, 0x01,
-  0xE3, 0x80, 0x70, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x3E, 0x0F, 0x80, 0x03,
-  0xE0, 0xF8, 0x00, 0x1F, 0x07, 0xC0, 0x01, 0xF0, 0x7C, 0x00, 0x0F, 0x83,
-  0xE0, 0x00, 0xF8, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8,
-  0x7F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F,
-  0x83, 0xE0, 0x00, 0x7C, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0x00, 0x3E, 0x0F,
-  0x80, 0x03, 0xE0, 0xF8, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xF8, 0x7C, 0x00,
-  0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x83, 0xFF,
-  0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0x07, 0xC0, 0x00, 0xF8, 0x3E,
-  0x00, 0x0F, 0x83, 0xE0, 0x00, 0x7C, 0x1F, 0x00, 0x07, 0xC1, 0xF0, 0x00,
-  0x3E, 0x0F, 0x80, 0x01, 0xF0, 0xF8, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0xF8,
-  0x3C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x1F,
-  0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x07, 0xF3, 0x9F, 0xC1, 0xF8, 0xE3, 0xF0,
-  0x7C, 0x38, 0xFC, 0x3F, 0x0E, 0x3F, 0x0F, 0xC7, 0x8F, 0xC3, 0xF1, 0xC0,
-  0x00, 0xFE, 0x70, 0x00, 0x3F, 0xDC, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xFF,
-  0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x77, 0xF8, 0x00, 0x1C, 0xFE,
-  0x00, 0x07, 0x3F, 0x8F, 0xE3, 0xCF, 0xE3, 0xF8, 0xE3, 0xF8, 0xFE, 0x38,
-  0xFC, 0x3F, 0x8E, 0x7F, 0x0F, 0xF3, 0x9F, 0xC3, 0xFD, 0xFF, 0xE0, 0x7F,
-  0xFF, 0xF0, 0x1F, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x80,
-  0x00, 0x01, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07,
-  0x80, 0x7F, 0xE0, 0x00, 0xF0, 0x0F, 0xFF, 0x00, 0x1E, 0x01, 0xFF, 0xF0,
-  0x01, 0xC0, 0x3F, 0xFF, 0x80, 0x3C, 0x07, 0xE1, 0xF8, 0x07, 0x80, 0x78,
-  0x07, 0x80, 0xF0, 0x0F, 0x80, 0x78, 0x0E, 0x00, 0xF0, 0x07, 0x81, 0xC0,
-  0x0F, 0x00, 0xF8, 0x3C, 0x00, 0xF0, 0x0F, 0x07, 0x80, 0x0F, 0xC3, 0xF0,
-  0xF0, 0x00, 0xFF, 0xFE, 0x0E, 0x00, 0x07, 0xFF, 0xC1, 0xE0, 0x00, 0x7F,
-  0xF8, 0x3C, 0x00, 0x03, 0xFF, 0x07, 0x80, 0x00, 0x0F, 0xC0, 0x70, 0x00,
-  0x00, 0x00, 0x0E, 0x03, 0xF0, 0x00, 0x01, 0xE0, 0xFF, 0xC0, 0x00, 0x3C,
-  0x1F, 0xFE, 0x00, 0x03, 0x83, 0xFF, 0xE0, 0x00, 0x70, 0x7F, 0xFF, 0x00,
-  0x0F, 0x0F, 0xC3, 0xF0, 0x01, 0xE0, 0xF0, 0x0F, 0x00, 0x3C, 0x1F, 0x00,
-  0xF0, 0x03, 0x81, 0xE0, 0x0F, 0x00, 0x78, 0x1E, 0x01, 0xF0, 0x0F, 0x01,
-  0xE0, 0x1E, 0x01, 0xE0, 0x1F, 0x87, 0xE0, 0x1C, 0x01, 0xFF, 0xFC, 0x03,
-  0x80, 0x0F, 0xFF, 0x80, 0x78, 0x00, 0xFF, 0xF0, 0x0F, 0x00, 0x07, 0xFE,
-  0x01, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0xF0,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00,
-  0x3F, 0x9F, 0xC0, 0x03, 0xF8, 0x7E, 0x00, 0x1F, 0xC3, 0xF0, 0x00, 0xFE,
-  0x1F, 0x00, 0x07, 0xF1, 0xF8, 0x00, 0x3F, 0xCF, 0xC0, 0x01, 0xFE, 0xFC,
-  0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x07, 0xC1, 0xFF,
-  0xF8, 0x3E, 0x3F, 0xFF, 0xE3, 0xE3, 0xFE, 0x3F, 0x1F, 0x1F, 0xC1, 0xFD,
-  0xF1, 0xFC, 0x07, 0xFF, 0x8F, 0xC0, 0x3F, 0xF8, 0xFE, 0x00, 0xFF, 0xC7,
-  0xF0, 0x07, 0xFC, 0x3F, 0x80, 0x1F, 0xC1, 0xFC, 0x00, 0xFE, 0x0F, 0xF0,
-  0x1F, 0xF8, 0x7F, 0xC1, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-  0xFC, 0x3F, 0xFF, 0xCF, 0xE0, 0x7F, 0xF8, 0x7F, 0x80, 0xFF, 0x00, 0x00,
-  0x7E, 0xFD, 0xFF, 0xEF, 0xDF, 0xBF, 0x7C, 0xF9, 0xE3, 0xC7, 0x00, 0x00,
-  0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0xC0, 0x07, 0xC0, 0x07, 0xC0,
-  0x07, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x01, 0xF8,
-  0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x3E, 0x00, 0x1F,
-  0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x01,
-  0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80,
-  0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x1E,
-  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-  0x3E, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00,
-  0x1E, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x7C,
-  0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x01, 0xF0, 0x00,
-  0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0,
-  0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E,
-  0x00, 0x1F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xE0, 0x03,
-  0xE0, 0x03, 0xF0, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x00,
-  0x7C, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x00,
-  0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x03, 0x80, 0x07,
-  0x00, 0x0E, 0x07, 0x3C, 0x6F, 0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0x0F, 0xE0,
-  0x1F, 0xC0, 0x7F, 0x81, 0xEF, 0x87, 0x8F, 0x0E, 0x1E, 0x08, 0x10, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-  0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00,
-  0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xC7, 0xF1, 0xF8, 0xFE, 0x3F,
-  0x8F, 0xE0, 0x38, 0x1C, 0x07, 0x03, 0xC0, 0xE0, 0xF0, 0xFC, 0x3C, 0x0C,
-  0x00, 0x7F, 0xFD, 0xFF, 0xF7, 0xFF, 0x9F, 0xFE, 0xFF, 0xFB, 0xFF, 0xE0,
-  0x7F, 0x7F, 0x7F, 0x7E, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x70, 0x00, 0x0E,
-  0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x03,
-  0x80, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x01,
-  0xC0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00,
-  0x70, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00,
-  0x38, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
-  0x0E, 0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00,
-  0x07, 0x00, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-  0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0,
-  0x1F, 0xC7, 0xF8, 0x1F, 0xC1, 0xFE, 0x1F, 0xC0, 0x7F, 0x0F, 0xC0, 0x3F,
-  0x8F, 0xE0, 0x1F, 0xC7, 0xF0, 0x0F, 0xE3, 0xF0, 0x07, 0xF3, 0xF8, 0x03,
-  0xF9, 0xFC, 0x01, 0xFC, 0xFC, 0x01, 0xFE, 0xFE, 0x00, 0xFE, 0x7F, 0x00,
-  0x7F, 0x3F, 0x80, 0x3F, 0x9F, 0xC0, 0x1F, 0xCF, 0xE0, 0x1F, 0xEF, 0xE0,
-  0x0F, 0xE7, 0xF0, 0x07, 0xF3, 0xF8, 0x03, 0xF9, 0xFC, 0x03, 0xF8, 0xFE,
-  0x01, 0xFC, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0xFE, 0x1F, 0xE0, 0x7F, 0x0F,
-  0xF8, 0xFF, 0x03, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80,
-  0x1F, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x0F,
-  0x80, 0x0F, 0x80, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xF0, 0x3F, 0xF9, 0xFF,
-  0xF8, 0xFF, 0xFC, 0xFF, 0xFE, 0x7F, 0xFF, 0x00, 0x3F, 0x80, 0x1F, 0x80,
-  0x0F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xF8, 0x01, 0xFC,
-  0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x0F,
-  0xE0, 0x07, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00,
-  0x7F, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0,
-  0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0x07, 0xFC, 0x07, 0xF0, 0x1F, 0xE0, 0x7F,
-  0x00, 0x7F, 0x03, 0xF0, 0x03, 0xF8, 0x1F, 0x80, 0x1F, 0xC1, 0xF8, 0x00,
-  0xFE, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0,
-  0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0xFF,
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x7F,
-  0x80, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
-  0xFC, 0x1F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xF0, 0x07,
-  0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xC0, 0xFE, 0x1F, 0xF0, 0x7F, 0x01, 0xFC,
-  0x1F, 0x80, 0x7F, 0x07, 0xE0, 0x1F, 0xC3, 0xF0, 0x07, 0xF0, 0xFC, 0x01,
-  0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x80, 0x01,
-  0xFF, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x80,
-  0x01, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F,
-  0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x3F, 0x80,
-  0x3F, 0xCF, 0xE0, 0x0F, 0xE3, 0xF8, 0x07, 0xF8, 0xFF, 0x83, 0xFC, 0x3F,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0,
-  0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00,
-  0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00,
-  0x3F, 0xF8, 0x00, 0x3D, 0xFC, 0x00, 0x3C, 0xFE, 0x00, 0x3E, 0x7E, 0x00,
-  0x3E, 0x7F, 0x00, 0x1E, 0x3F, 0x80, 0x1E, 0x1F, 0xC0, 0x1E, 0x0F, 0xC0,
-  0x1F, 0x07, 0xE0, 0x1F, 0x07, 0xF0, 0x1F, 0x03, 0xF8, 0x1F, 0x01, 0xFC,
-  0x0F, 0x80, 0xFC, 0x0F, 0x80, 0xFE, 0x0F, 0x80, 0x7F, 0x07, 0xFF, 0xFF,
-  0xF7, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-  0xFE, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00,
-  0x7F, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-  0xF0, 0x0F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x7C, 0x00, 0x00, 0x0F,
-  0x80, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x03, 0xE3, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x03, 0xFF,
-  0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x1F, 0xE1, 0xFF, 0x03, 0xF0, 0x1F, 0xE0,
-  0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0xFE, 0x1F,
-  0xC0, 0x3F, 0x83, 0xF8, 0x07, 0xF0, 0x7F, 0x83, 0xFC, 0x0F, 0xFF, 0xFF,
-  0x80, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x0F,
-  0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFE,
-  0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x1F, 0xC3,
-  0xFC, 0x1F, 0x80, 0xFE, 0x0F, 0xC0, 0x3F, 0x0F, 0xC0, 0x00, 0x07, 0xE0,
-  0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0xFC, 0x01, 0xF9,
-  0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x3F,
-  0xE1, 0xFF, 0x1F, 0xE0, 0x7F, 0x8F, 0xE0, 0x1F, 0xCF, 0xE0, 0x0F, 0xE7,
-  0xF0, 0x07, 0xF3, 0xF0, 0x03, 0xF9, 0xF8, 0x01, 0xF8, 0xFC, 0x01, 0xFC,
-  0x7E, 0x00, 0xFE, 0x3F, 0x00, 0xFE, 0x1F, 0xC0, 0xFF, 0x0F, 0xF0, 0xFF,
-  0x03, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x1F, 0xFF,
-  0x80, 0x07, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xCF,
-  0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
-  0x9F, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x1F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xE0,
-  0x00, 0x03, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F,
-  0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-  0x01, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
-  0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-  0xC0, 0xFE, 0x0F, 0xF0, 0x3E, 0x01, 0xFC, 0x1F, 0x80, 0x3F, 0x07, 0xC0,
-  0x0F, 0xC1, 0xF0, 0x03, 0xF0, 0x7C, 0x01, 0xF8, 0x1F, 0x00, 0xFC, 0x03,
-  0xF0, 0x7F, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0,
-  0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0x81, 0xFE, 0x1F, 0xE0, 0xFE, 0x03,
-  0xFC, 0x3F, 0x00, 0x7F, 0x1F, 0xC0, 0x1F, 0xC7, 0xE0, 0x07, 0xF3, 0xF8,
-  0x01, 0xFC, 0xFE, 0x00, 0x7F, 0x3F, 0x80, 0x3F, 0x8F, 0xE0, 0x0F, 0xE3,
-  0xFC, 0x07, 0xF0, 0xFF, 0x87, 0xFC, 0x3F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x00, 0x3F,
-  0xC0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFF, 0x00,
-  0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x3F, 0xC3, 0xF8, 0x3F, 0xC0, 0xFE,
-  0x1F, 0xC0, 0x3F, 0x1F, 0xC0, 0x1F, 0x8F, 0xE0, 0x0F, 0xC7, 0xE0, 0x07,
-  0xE7, 0xF0, 0x03, 0xF3, 0xF8, 0x01, 0xF9, 0xFC, 0x01, 0xFC, 0xFE, 0x00,
-  0xFE, 0x7F, 0x00, 0xFE, 0x3F, 0xC0, 0xFF, 0x1F, 0xF0, 0xFF, 0x87, 0xFF,
-  0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x3F, 0xF3, 0xF0, 0x07,
-  0xE3, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0x7E, 0x1F, 0xC0, 0x7E, 0x0F, 0xF0, 0xFF, 0x07, 0xFF, 0xFF, 0x01,
-  0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0x00,
-  0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7E, 0x0F, 0xE0,
-  0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x07, 0xF0, 0x7F, 0x07,
-  0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0,
-  0x7E, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0,
-  0x03, 0x80, 0x1C, 0x00, 0x70, 0x03, 0xC0, 0x0E, 0x00, 0xF0, 0x0F, 0xC0,
-  0x3C, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE0, 0x00,
-  0x01, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x0F, 0xFF, 0xE0,
-  0x1F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
-  0x0F, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFE,
-  0x00, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00,
-  0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xF8,
-  0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x80, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF,
-  0xFF, 0xF1, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8F,
-  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-  0xFF, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF8, 0xFF,
-  0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x80, 0x04, 0x00, 0x00, 0x01, 0xE0, 0x00,
-  0x00, 0x7E, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-  0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0,
-  0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF,
-  0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80,
-  0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFE,
-  0x1F, 0xFF, 0xFE, 0x3F, 0xC1, 0xFF, 0x3F, 0x80, 0xFF, 0x7F, 0x00, 0x7F,
-  0x7E, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8,
-  0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFE, 0x00,
-  0x01, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-  0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00,
-  0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00,
-  0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x00, 0x07,
-  0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x07, 0xE0,
-  0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-  0x00, 0x0F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x03, 0xF1,
-  0xF1, 0xF0, 0x7C, 0x00, 0xFF, 0xCF, 0x07, 0x87, 0xE0, 0x1F, 0xFF, 0xF8,
-  0x3C, 0x7E, 0x01, 0xF8, 0x7F, 0x81, 0xE3, 0xE0, 0x1F, 0x01, 0xF8, 0x0F,
-  0x3E, 0x01, 0xF0, 0x0F, 0xC0, 0x79, 0xF0, 0x1F, 0x00, 0x7C, 0x03, 0xDF,
-  0x00, 0xF0, 0x03, 0xE0, 0x1C, 0xF8, 0x0F, 0x80, 0x1E, 0x01, 0xE7, 0xC0,
-  0x78, 0x00, 0xF0, 0x0F, 0x3C, 0x07, 0xC0, 0x0F, 0x00, 0xF3, 0xE0, 0x3C,
-  0x00, 0x78, 0x07, 0x9F, 0x03, 0xE0, 0x07, 0x80, 0x78, 0xF8, 0x1F, 0x00,
-  0x7C, 0x07, 0xC7, 0xC0, 0xF8, 0x07, 0xC0, 0x7C, 0x3E, 0x07, 0xC0, 0x7E,
-  0x07, 0xC1, 0xF0, 0x3F, 0x07, 0xF8, 0xFC, 0x0F, 0x81, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x7E, 0x07, 0xFF, 0xBF, 0xFC, 0x01, 0xF0, 0x1F, 0xF8, 0xFF, 0x80,
-  0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0x80, 0x00, 0x01, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-  0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-  0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F,
-  0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
-  0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x03, 0xFB,
-  0xF8, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x07, 0xE3, 0xF8, 0x00, 0x0F, 0xE3,
-  0xF8, 0x00, 0x0F, 0xC3, 0xF8, 0x00, 0x1F, 0xC3, 0xF8, 0x00, 0x1F, 0x83,
-  0xF8, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x7F, 0x01,
-  0xFC, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0xFC, 0x01, 0xFF, 0xFF,
-  0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-  0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x0F, 0xE0, 0x00,
-  0xFE, 0x1F, 0xC0, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0xFE, 0x3F, 0x80, 0x00,
-  0xFE, 0x3F, 0x80, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-  0x7F, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-  0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-  0xFF, 0x03, 0xF8, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-  0x7F, 0x07, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0x7E, 0x07, 0xF0, 0x00,
-  0xFE, 0x0F, 0xF0, 0x03, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-  0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-  0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F, 0xC0, 0x07, 0xFC, 0x1F, 0xC0, 0x01,
-  0xFC, 0x1F, 0xC0, 0x01, 0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0x80, 0x01,
-  0xFC, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xF8, 0x7F, 0x00, 0x07,
-  0xF8, 0x7F, 0x00, 0x0F, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-  0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE,
-  0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFF,
-  0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF,
-  0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0x03, 0xFE, 0x07, 0xFC, 0x01,
-  0xFF, 0x0F, 0xF0, 0x00, 0xFF, 0x0F, 0xE0, 0x00, 0x7F, 0x1F, 0xE0, 0x00,
-  0x7F, 0x1F, 0xC0, 0x00, 0x7F, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x00, 0x7F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xF8, 0xFE, 0x00, 0x03,
-  0xF8, 0xFF, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0x07, 0xF0, 0x7F, 0x80, 0x1F,
-  0xF0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-  0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF8,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-  0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
-  0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xF8, 0x03, 0xFE, 0x07, 0xF0, 0x01,
-  0xFF, 0x07, 0xF0, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00,
-  0x7F, 0x0F, 0xF0, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x7F, 0x0F, 0xE0, 0x00,
-  0x7F, 0x0F, 0xE0, 0x00, 0x7F, 0x0F, 0xE0, 0x00, 0x7F, 0x1F, 0xC0, 0x00,
-  0x7F, 0x1F, 0xC0, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0xFE, 0x1F, 0xC0, 0x00,
-  0xFE, 0x1F, 0xC0, 0x01, 0xFE, 0x3F, 0x80, 0x01, 0xFC, 0x3F, 0x80, 0x01,
-  0xFC, 0x3F, 0x80, 0x03, 0xF8, 0x3F, 0x80, 0x07, 0xF8, 0x7F, 0x00, 0x0F,
-  0xF0, 0x7F, 0x00, 0x1F, 0xF0, 0x7F, 0x00, 0x7F, 0xE0, 0x7F, 0xFF, 0xFF,
-  0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE,
-  0x00, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF,
-  0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-  0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xF8, 0x00,
-  0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00,
-  0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-  0xE0, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-  0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-  0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF,
-  0xFE, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00,
-  0x00, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00,
-  0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
-  0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-  0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-  0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xC0, 0x00,
-  0x00, 0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x00, 0x3F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x03, 0xFF,
-  0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
-  0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFC, 0x07, 0xFC, 0x0F, 0xF8,
-  0x00, 0xFF, 0x0F, 0xF0, 0x00, 0x3F, 0x87, 0xF0, 0x00, 0x1F, 0xC7, 0xF0,
-  0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x01, 0xFC,
-  0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-  0x00, 0x3F, 0xFF, 0x3F, 0x00, 0x1F, 0xFF, 0xBF, 0x80, 0x0F, 0xFF, 0x9F,
-  0xC0, 0x07, 0xFF, 0xCF, 0xE0, 0x03, 0xFF, 0xE7, 0xF0, 0x03, 0xFF, 0xF3,
-  0xF8, 0x00, 0x01, 0xF9, 0xFC, 0x00, 0x01, 0xF8, 0xFF, 0x00, 0x00, 0xFC,
-  0x7F, 0x80, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0xFF, 0x0F, 0xF0, 0x00, 0xFF,
-  0x87, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0xF8, 0x03, 0xFF, 0xFC,
-  0x78, 0x00, 0x7F, 0xFC, 0x3C, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xFC,
-  0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x3F, 0x80,
-  0xFE, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0x3F,
-  0x80, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8, 0x00,
-  0x3F, 0x80, 0xFF, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFE, 0x03, 0xF8,
-  0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x07, 0xF0, 0x0F, 0xFF, 0xFF, 0xFE, 0x03,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-  0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8, 0x0F, 0xE0, 0x00,
-  0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0xFC, 0x07, 0xF0,
-  0x00, 0x7F, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x3F, 0x80, 0x01, 0xFC, 0x07,
-  0xF0, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x01, 0xFC,
-  0x07, 0xF0, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00,
-  0xFE, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x7F, 0x00, 0x07, 0xF0, 0x1F, 0xC0,
-  0x00, 0xFE, 0x00, 0x01, 0xFC, 0x07, 0xF0, 0x3F, 0x80, 0xFE, 0x03, 0xF8,
-  0x0F, 0xE0, 0x3F, 0x81, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC,
-  0x0F, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x7F, 0x01, 0xFC,
-  0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFE,
-  0x03, 0xF8, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0xFE,
-  0x03, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00,
-  0x3F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80,
-  0x00, 0x07, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07,
-  0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xF0, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x0F, 0xE0, 0xFE, 0x03, 0xFC, 0x1F, 0xC0, 0x7F, 0x03, 0xF8, 0x0F, 0xE0,
-  0xFE, 0x01, 0xFC, 0x1F, 0xC0, 0x3F, 0x83, 0xF8, 0x0F, 0xE0, 0x7F, 0x01,
-  0xFC, 0x0F, 0xF0, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x03,
-  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x00, 0x1F, 0xE0,
-  0x00, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
-  0x7F, 0x00, 0x1F, 0xF0, 0x03, 0xF8, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x1F,
-  0xE0, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x1F, 0xE0, 0x00, 0x7F,
-  0x01, 0xFE, 0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0x1F, 0xC1, 0xFE, 0x00,
-  0x00, 0xFE, 0x1F, 0xE0, 0x00, 0x0F, 0xE3, 0xFE, 0x00, 0x00, 0x7F, 0x3F,
-  0xC0, 0x00, 0x03, 0xFB, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x01,
-  0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0x9F, 0xE0, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0x00, 0x7F, 0x83, 0xFC, 0x00,
-  0x03, 0xF8, 0x1F, 0xF0, 0x00, 0x1F, 0xC0, 0x7F, 0x80, 0x01, 0xFC, 0x01,
-  0xFE, 0x00, 0x0F, 0xE0, 0x0F, 0xF0, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x03,
-  0xF8, 0x01, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xF8, 0x01, 0xFC, 0x00, 0x3F,
-  0xE0, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x03, 0xF8,
-  0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC, 0x00, 0x01, 0xFC,
-  0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xF8,
-  0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF0,
-  0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0,
-  0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0,
-  0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80,
-  0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00,
-  0x00, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF,
-  0x80, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x01,
-  0xFF, 0xC0, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0xFF, 0xF0,
-  0x1F, 0xFC, 0x00, 0x7F, 0xF8, 0x0F, 0xFE, 0x00, 0x7D, 0xF8, 0x07, 0xEF,
-  0x00, 0x3E, 0xFC, 0x03, 0xF7, 0x80, 0x3F, 0xFE, 0x03, 0xFB, 0xC0, 0x1F,
-  0x7F, 0x01, 0xFD, 0xE0, 0x1F, 0xBF, 0x00, 0xFE, 0xF0, 0x0F, 0x9F, 0x80,
-  0x7E, 0x78, 0x0F, 0xDF, 0xC0, 0x7F, 0x3E, 0x07, 0xCF, 0xE0, 0x3F, 0x9F,
-  0x07, 0xE7, 0xF0, 0x1F, 0xCF, 0x83, 0xE3, 0xF0, 0x0F, 0xE7, 0xC3, 0xF1,
-  0xF8, 0x07, 0xE3, 0xE1, 0xF9, 0xFC, 0x07, 0xF1, 0xF0, 0xF8, 0xFE, 0x03,
-  0xF8, 0xF8, 0xFC, 0x7F, 0x01, 0xFC, 0x7C, 0x7C, 0x3F, 0x00, 0xFC, 0x3E,
-  0x7E, 0x1F, 0x80, 0x7E, 0x1F, 0x3E, 0x1F, 0xC0, 0x7F, 0x0F, 0xBF, 0x0F,
-  0xE0, 0x3F, 0x87, 0xDF, 0x07, 0xE0, 0x1F, 0xC3, 0xFF, 0x83, 0xF0, 0x0F,
-  0xC1, 0xFF, 0xC3, 0xF8, 0x0F, 0xE0, 0xFF, 0xC1, 0xFC, 0x07, 0xF0, 0x7F,
-  0xE0, 0xFE, 0x03, 0xF8, 0x3F, 0xE0, 0x7E, 0x01, 0xFC, 0x1F, 0xF0, 0x3F,
-  0x00, 0xFC, 0x0F, 0xF0, 0x3F, 0x80, 0xFE, 0x07, 0xF8, 0x1F, 0xC0, 0x7F,
-  0x03, 0xF8, 0x0F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xE0, 0x3F, 0xC0,
-  0x01, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0xFF, 0x80, 0x07, 0xF0, 0x1F,
-  0xF0, 0x00, 0xFC, 0x07, 0xFF, 0x00, 0x3F, 0x80, 0xFF, 0xE0, 0x07, 0xF0,
-  0x1F, 0xFC, 0x00, 0xFE, 0x03, 0xFF, 0xC0, 0x1F, 0x80, 0xFF, 0xF8, 0x03,
-  0xF0, 0x1F, 0xFF, 0x80, 0xFE, 0x03, 0xFB, 0xF0, 0x1F, 0xC0, 0x7E, 0x7E,
-  0x03, 0xF8, 0x0F, 0xC7, 0xE0, 0x7E, 0x03, 0xF8, 0xFC, 0x0F, 0xC0, 0x7F,
-  0x1F, 0x83, 0xF8, 0x0F, 0xE1, 0xF8, 0x7F, 0x01, 0xF8, 0x3F, 0x0F, 0xE0,
-  0x3F, 0x07, 0xF1, 0xF8, 0x0F, 0xE0, 0x7E, 0x3F, 0x01, 0xFC, 0x0F, 0xCF,
-  0xE0, 0x3F, 0x00, 0xFD, 0xFC, 0x07, 0xE0, 0x1F, 0xBF, 0x81, 0xFC, 0x03,
-  0xF7, 0xE0, 0x3F, 0x80, 0x3F, 0xFC, 0x07, 0xF0, 0x07, 0xFF, 0x80, 0xFC,
-  0x00, 0xFF, 0xF0, 0x1F, 0x80, 0x0F, 0xFC, 0x07, 0xF0, 0x01, 0xFF, 0x80,
-  0xFE, 0x00, 0x3F, 0xF0, 0x1F, 0xC0, 0x03, 0xFE, 0x03, 0xF0, 0x00, 0x7F,
-  0xC0, 0x7E, 0x00, 0x07, 0xF0, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x00, 0x00,
-  0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01,
-  0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-  0x3F, 0xF0, 0x3F, 0xF8, 0x1F, 0xF0, 0x03, 0xFE, 0x07, 0xF0, 0x00, 0x7F,
-  0x83, 0xF8, 0x00, 0x0F, 0xF1, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00,
-  0x7F, 0x3F, 0x80, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF7, 0xF0, 0x00,
-  0x01, 0xFD, 0xFC, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x1F, 0xDF, 0xC0,
-  0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0xFE, 0xFE,
-  0x00, 0x00, 0x3F, 0xBF, 0x80, 0x00, 0x0F, 0xEF, 0xE0, 0x00, 0x07, 0xF3,
-  0xF8, 0x00, 0x01, 0xFC, 0xFE, 0x00, 0x00, 0xFE, 0x3F, 0xC0, 0x00, 0x7F,
-  0x8F, 0xF0, 0x00, 0x1F, 0xC1, 0xFE, 0x00, 0x0F, 0xE0, 0x7F, 0xC0, 0x0F,
-  0xF8, 0x1F, 0xFC, 0x0F, 0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-  0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x03,
-  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xE0, 0x3F,
-  0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xC1, 0xFE, 0x00, 0xFF, 0x83, 0xF8,
-  0x00, 0xFF, 0x07, 0xF0, 0x00, 0xFE, 0x0F, 0xE0, 0x01, 0xFC, 0x1F, 0xC0,
-  0x03, 0xF8, 0x7F, 0x00, 0x07, 0xF0, 0xFE, 0x00, 0x1F, 0xC1, 0xFC, 0x00,
-  0x3F, 0x83, 0xF8, 0x00, 0xFE, 0x07, 0xF0, 0x07, 0xFC, 0x1F, 0xFF, 0xFF,
-  0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE,
-  0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00,
-  0x1F, 0xC0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x0F,
-  0xE0, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x01, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xF0,
-  0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xF0, 0x3F,
-  0xF0, 0x1F, 0xF0, 0x03, 0xFE, 0x07, 0xF8, 0x00, 0x7F, 0x83, 0xFC, 0x00,
-  0x0F, 0xF1, 0xFE, 0x00, 0x03, 0xFC, 0x7F, 0x00, 0x00, 0x7F, 0x3F, 0x80,
-  0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x01, 0xFD, 0xFC,
-  0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x1F, 0xDF, 0x80, 0x00, 0x07, 0xFF,
-  0xE0, 0x00, 0x03, 0xFB, 0xF8, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x3F,
-  0xBF, 0x80, 0x00, 0x0F, 0xEF, 0xE0, 0x01, 0x87, 0xF3, 0xF8, 0x00, 0xF1,
-  0xFC, 0xFE, 0x00, 0x7C, 0xFE, 0x3F, 0xC0, 0x3F, 0xFF, 0x8F, 0xF0, 0x07,
-  0xFF, 0xC1, 0xFE, 0x01, 0xFF, 0xE0, 0x7F, 0xC0, 0x3F, 0xF8, 0x1F, 0xFC,
-  0x0F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F,
-  0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x9F, 0x80,
-  0x01, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x01, 0xFF, 0xFF,
-  0xF0, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF,
-  0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xE0,
-  0x03, 0xFE, 0x0F, 0xF0, 0x00, 0xFF, 0x07, 0xF0, 0x00, 0x3F, 0x83, 0xF8,
-  0x00, 0x1F, 0xC1, 0xFC, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x07, 0xE0, 0xFE,
-  0x00, 0x07, 0xF0, 0x7F, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x0F, 0xF0, 0x1F,
-  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x07,
-  0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0x01,
-  0xFC, 0x00, 0x7F, 0x80, 0xFE, 0x00, 0x1F, 0xC0, 0x7F, 0x00, 0x0F, 0xE0,
-  0x3F, 0x80, 0x07, 0xF0, 0x1F, 0xC0, 0x03, 0xF8, 0x1F, 0xC0, 0x01, 0xFC,
-  0x0F, 0xE0, 0x01, 0xFC, 0x07, 0xF0, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x7F,
-  0x01, 0xFC, 0x00, 0x3F, 0x81, 0xFC, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x0F,
-  0xE0, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F,
-  0xFF, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-  0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xC0, 0x7F, 0xC1, 0xFE, 0x00, 0xFF,
-  0x07, 0xF0, 0x01, 0xFC, 0x3F, 0x80, 0x07, 0xF0, 0xFE, 0x00, 0x1F, 0xC3,
-  0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0xFF,
-  0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
-  0xFE, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-  0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFC,
-  0x00, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x1F, 0xCF, 0xE0, 0x00, 0x7E, 0x3F,
-  0x80, 0x03, 0xF8, 0xFF, 0x00, 0x1F, 0xE3, 0xFF, 0x01, 0xFF, 0x07, 0xFF,
-  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-  0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
-  0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8,
-  0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00,
-  0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00,
-  0x01, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-  0xC0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00,
-  0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
-  0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x7F, 0x00,
-  0x00, 0x0F, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x7F,
-  0x07, 0xF0, 0x00, 0x7F, 0x07, 0xF0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0xFE,
-  0x0F, 0xE0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0xFE, 0x0F, 0xE0, 0x00, 0xFE,
-  0x0F, 0xE0, 0x01, 0xFC, 0x1F, 0xC0, 0x01, 0xFC, 0x1F, 0xC0, 0x01, 0xFC,
-  0x1F, 0xC0, 0x01, 0xFC, 0x1F, 0xC0, 0x01, 0xFC, 0x3F, 0x80, 0x03, 0xF8,
-  0x3F, 0x80, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF8, 0x3F, 0x80, 0x03, 0xF8,
-  0x3F, 0x80, 0x07, 0xF0, 0x7F, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x07, 0xF0,
-  0x7F, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x07, 0xF0, 0x7F, 0x00, 0x0F, 0xE0,
-  0xFE, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x0F, 0xE0,
-  0xFE, 0x00, 0x1F, 0xC0, 0xFE, 0x00, 0x1F, 0xC0, 0xFF, 0x00, 0x3F, 0x80,
-  0xFF, 0xC0, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
-  0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF9, 0xFC, 0x00, 0x0F, 0xE7,
-  0xF0, 0x00, 0x7F, 0x1F, 0xC0, 0x01, 0xFC, 0x7F, 0x00, 0x0F, 0xE1, 0xFC,
-  0x00, 0x3F, 0x87, 0xF0, 0x01, 0xFC, 0x1F, 0xC0, 0x07, 0xF0, 0x3F, 0x00,
-  0x3F, 0x80, 0xFC, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xF0, 0x0F, 0xC0, 0x1F,
-  0x80, 0x3F, 0x80, 0xFE, 0x00, 0xFE, 0x03, 0xF0, 0x03, 0xF8, 0x1F, 0xC0,
-  0x0F, 0xE0, 0x7E, 0x00, 0x1F, 0x83, 0xF8, 0x00, 0x7E, 0x0F, 0xC0, 0x01,
-  0xF8, 0x7E, 0x00, 0x07, 0xE1, 0xF8, 0x00, 0x1F, 0x8F, 0xC0, 0x00, 0x7E,
-  0x3F, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x07, 0xE7, 0xE0, 0x00, 0x0F, 0xFF,
-  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00,
-  0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00,
-  0xFE, 0x00, 0x7F, 0x80, 0x1F, 0xFF, 0xC0, 0x0F, 0xF0, 0x03, 0xFB, 0xF8,
-  0x01, 0xFE, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0xC0, 0x1F, 0xCF, 0xE0, 0x0F,
-  0xF8, 0x03, 0xF9, 0xFC, 0x03, 0xFF, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0xE0,
-  0x1F, 0xC7, 0xF0, 0x1F, 0xFC, 0x07, 0xF0, 0x7E, 0x03, 0xFF, 0x80, 0xFE,
-  0x0F, 0xC0, 0x7D, 0xF0, 0x1F, 0x81, 0xF8, 0x1F, 0xBE, 0x07, 0xF0, 0x3F,
-  0x03, 0xE7, 0xC0, 0xFC, 0x07, 0xE0, 0xFC, 0xF8, 0x3F, 0x80, 0xFC, 0x1F,
-  0x1F, 0x07, 0xE0, 0x1F, 0x83, 0xE3, 0xE0, 0xFC, 0x03, 0xF0, 0xFC, 0x7C,
-  0x3F, 0x00, 0x7E, 0x1F, 0x0F, 0x87, 0xE0, 0x0F, 0xC7, 0xE1, 0xF1, 0xF8,
-  0x01, 0xF8, 0xF8, 0x3E, 0x3F, 0x00, 0x3F, 0x3F, 0x07, 0xCF, 0xC0, 0x07,
-  0xE7, 0xC0, 0xF9, 0xF8, 0x00, 0xFC, 0xF8, 0x1F, 0x3E, 0x00, 0x1F, 0xBE,
-  0x03, 0xEF, 0xC0, 0x01, 0xF7, 0xC0, 0x7D, 0xF0, 0x00, 0x3F, 0xF8, 0x0F,
-  0xFE, 0x00, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x3F, 0xF0,
-  0x00, 0x1F, 0xF0, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x00,
-  0x7F, 0x80, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0x01, 0xFC,
-  0x00, 0x7F, 0x80, 0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x01,
-  0xFC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0xFF,
-  0x00, 0x1F, 0xE0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x03, 0xFC,
-  0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0xFF, 0x07, 0xF8, 0x00,
-  0x03, 0xFC, 0x3F, 0x80, 0x00, 0x1F, 0xE3, 0xF8, 0x00, 0x00, 0x7F, 0x3F,
-  0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
-  0x7F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-  0xF0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-  0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFE,
-  0x00, 0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0xFF, 0x3F, 0xC0, 0x00, 0x0F,
-  0xF1, 0xFE, 0x00, 0x00, 0xFF, 0x07, 0xF8, 0x00, 0x07, 0xF0, 0x3F, 0xC0,
-  0x00, 0x7F, 0x01, 0xFE, 0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00, 0x7F, 0x80,
-  0x3F, 0xC0, 0x07, 0xF8, 0x01, 0xFF, 0x00, 0x7F, 0x80, 0x07, 0xF8, 0x07,
-  0xFC, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF7, 0xF8, 0x00, 0x7F,
-  0xBF, 0xC0, 0x07, 0xF8, 0xFE, 0x00, 0x3F, 0x87, 0xF8, 0x03, 0xFC, 0x3F,
-  0xC0, 0x3F, 0xC0, 0xFE, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x3F, 0xC1,
-  0xFE, 0x00, 0xFE, 0x0F, 0xE0, 0x07, 0xF0, 0xFE, 0x00, 0x3F, 0x8F, 0xE0,
-  0x00, 0xFE, 0x7F, 0x00, 0x07, 0xF7, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x01,
-  0xFF, 0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF,
-  0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFC, 0x00,
-  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00,
-  0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
-  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF,
-  0x01, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-  0xC0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0x80,
-  0x1F, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0x7E, 0x00, 0x03, 0xF0,
-  0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03,
-  0xF0, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
-  0x03, 0xF0, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x7E,
-  0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
-  0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
-  0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F,
-  0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0xC0,
-  0x0F, 0xFE, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x00, 0x81,
-  0xC3, 0xC7, 0x8F, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0xC7, 0x8F, 0x1E,
-  0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x8F, 0x1E, 0x3C, 0x38, 0x70, 0xE1,
-  0xC3, 0x87, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0x00, 0x7F, 0xF8, 0x03, 0xFF,
-  0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0x00, 0x01, 0xF8, 0x00,
-  0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8,
-  0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03,
-  0xF8, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00,
-  0x03, 0xF8, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x7F,
-  0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00,
-  0x7F, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0,
-  0x00, 0x7F, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x01, 0xFF,
-  0xE0, 0x0F, 0xFE, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x3F, 0xFC, 0x00,
-  0x00, 0x1F, 0x80, 0x00, 0xFE, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0x80, 0x07,
-  0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x80, 0x3E, 0xFC, 0x01, 0xF3, 0xE0,
-  0x1F, 0x1F, 0x01, 0xF8, 0xF8, 0x0F, 0x87, 0xE0, 0xFC, 0x3F, 0x07, 0xC0,
-  0xF8, 0x7C, 0x07, 0xC7, 0xE0, 0x3E, 0x3E, 0x01, 0xFB, 0xF0, 0x0F, 0xDF,
-  0x00, 0x3F, 0xF0, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xE0, 0xF8, 0xF0, 0xF1, 0xE1,
-  0xC3, 0xC3, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF,
-  0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x7F, 0x03, 0xFC, 0x3F, 0x00,
-  0xFE, 0x1F, 0x80, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x1F,
-  0xFF, 0xC0, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xF7, 0xF0, 0xFF,
-  0x83, 0xF8, 0xFF, 0x01, 0xF8, 0x7F, 0x00, 0xFC, 0x7F, 0x00, 0xFE, 0x3F,
-  0x80, 0x7F, 0x1F, 0xC0, 0x7F, 0x8F, 0xF0, 0xFF, 0x87, 0xFF, 0xFF, 0xC3,
-  0xFF, 0xFF, 0xE0, 0xFF, 0xF7, 0xF8, 0x3F, 0xF3, 0xFC, 0x07, 0xE0, 0x00,
-  0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFC, 0x00,
-  0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x3F, 0x80, 0x1F,
-  0x9F, 0xFC, 0x03, 0xF7, 0xFF, 0xC0, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-  0x83, 0xFF, 0x0F, 0xF0, 0x7F, 0x80, 0xFF, 0x0F, 0xE0, 0x1F, 0xE3, 0xF8,
-  0x01, 0xFC, 0x7F, 0x00, 0x3F, 0x8F, 0xC0, 0x07, 0xF1, 0xF8, 0x00, 0xFE,
-  0x7F, 0x00, 0x1F, 0xCF, 0xC0, 0x03, 0xF9, 0xF8, 0x00, 0xFE, 0x3F, 0x00,
-  0x1F, 0xC7, 0xE0, 0x03, 0xF9, 0xFC, 0x00, 0xFE, 0x3F, 0xC0, 0x3F, 0xC7,
-  0xF8, 0x0F, 0xF0, 0xFF, 0x83, 0xFC, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF,
-  0xC0, 0xFF, 0xFF, 0xF0, 0x1F, 0x9F, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF,
-  0xE0, 0x7F, 0xFF, 0xF0, 0x7F, 0x83, 0xFC, 0x7F, 0x00, 0xFE, 0x3F, 0x00,
-  0x7F, 0x3F, 0x80, 0x3F, 0x9F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
-  0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC,
-  0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x3F, 0x80, 0x3F, 0x9F,
-  0xE0, 0x3F, 0x87, 0xF8, 0x3F, 0x83, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0,
-  0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x07,
-  0xE0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x7F, 0x00, 0x3F,
-  0xF3, 0xF8, 0x03, 0xFF, 0xDF, 0x80, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-  0xE0, 0x3F, 0xC3, 0xFF, 0x03, 0xFC, 0x0F, 0xF8, 0x3F, 0xC0, 0x3F, 0x81,
-  0xFC, 0x01, 0xFC, 0x1F, 0xC0, 0x07, 0xE0, 0xFE, 0x00, 0x3F, 0x07, 0xF0,
-  0x03, 0xF8, 0x7F, 0x00, 0x1F, 0x83, 0xF8, 0x00, 0xFC, 0x1F, 0xC0, 0x07,
-  0xE0, 0xFE, 0x00, 0x3F, 0x07, 0xF0, 0x03, 0xF0, 0x3F, 0x80, 0x3F, 0x81,
-  0xFC, 0x01, 0xFC, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xC3, 0xFF, 0x01, 0xFF,
-  0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xCF,
-  0xE0, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xFC, 0x00,
-  0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0x87, 0xF8,
-  0x7F, 0x01, 0xFE, 0x7F, 0x00, 0x7F, 0x3F, 0x80, 0x3F, 0xBF, 0x80, 0x1F,
-  0xDF, 0xC0, 0x0F, 0xEF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00,
-  0x00, 0x3F, 0x80, 0x3F, 0x9F, 0xE0, 0x3F, 0x87, 0xF8, 0x3F, 0xC3, 0xFF,
-  0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x1F, 0xF0, 0x0F, 0xF8, 0x07, 0xFE,
-  0x01, 0xFF, 0x80, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xF0, 0x01,
-  0xFC, 0x03, 0xFF, 0xF1, 0xFF, 0xF8, 0x7F, 0xFE, 0x1F, 0xFF, 0x80, 0xFE,
-  0x00, 0x3F, 0x80, 0x0F, 0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x00,
-  0x1F, 0xC0, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
-  0xE0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0,
-  0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x07, 0xC3, 0xF8,
-  0x01, 0xFF, 0x9F, 0x80, 0x1F, 0xFE, 0xFC, 0x01, 0xFF, 0xFF, 0xE0, 0x1F,
-  0xFF, 0xFF, 0x01, 0xFE, 0x1F, 0xF8, 0x1F, 0xE0, 0x3F, 0x80, 0xFE, 0x01,
-  0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0x7F, 0x00, 0x3F, 0x07, 0xF0, 0x01, 0xF8,
-  0x3F, 0x80, 0x0F, 0x81, 0xF8, 0x00, 0x7C, 0x1F, 0xC0, 0x07, 0xE0, 0xFE,
-  0x00, 0x3F, 0x07, 0xF0, 0x01, 0xF0, 0x3F, 0x80, 0x1F, 0x81, 0xFC, 0x00,
-  0xFC, 0x0F, 0xE0, 0x0F, 0xE0, 0x7F, 0x80, 0xFF, 0x03, 0xFE, 0x1F, 0xF0,
-  0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xF7, 0xE0, 0x07,
-  0xFE, 0x7F, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01,
-  0xFC, 0x0F, 0xE0, 0x0F, 0xC0, 0x7F, 0x00, 0xFE, 0x03, 0xFC, 0x1F, 0xE0,
-  0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x00, 0x01,
-  0xFF, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xE0,
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xFE, 0x0F,
-  0xC0, 0x1F, 0xCF, 0xFE, 0x03, 0xFB, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x0F,
-  0xFF, 0xFF, 0xC3, 0xFF, 0x07, 0xF8, 0x7F, 0x80, 0x7F, 0x0F, 0xE0, 0x0F,
-  0xE1, 0xFC, 0x01, 0xFC, 0x7F, 0x00, 0x3F, 0x0F, 0xE0, 0x07, 0xE1, 0xFC,
-  0x01, 0xFC, 0x3F, 0x00, 0x3F, 0x87, 0xE0, 0x07, 0xF1, 0xFC, 0x00, 0xFC,
-  0x3F, 0x80, 0x1F, 0x87, 0xF0, 0x07, 0xF0, 0xFC, 0x00, 0xFE, 0x1F, 0x80,
-  0x1F, 0xC7, 0xF0, 0x03, 0xF0, 0xFE, 0x00, 0x7E, 0x1F, 0xC0, 0x1F, 0xC3,
-  0xF0, 0x03, 0xF8, 0xFE, 0x00, 0x7F, 0x1F, 0xC0, 0x0F, 0xC0, 0x01, 0xFC,
-  0x07, 0xF0, 0x1F, 0x80, 0x7E, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xE0, 0x3F, 0x80, 0xFE,
-  0x03, 0xF8, 0x0F, 0xC0, 0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7E,
-  0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0x7F,
-  0x01, 0xFC, 0x07, 0xE0, 0x1F, 0x80, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x0F,
-  0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3F,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0xFE,
-  0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x03, 0xF8,
-  0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0,
-  0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80,
-  0x07, 0xF0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00,
-  0x1F, 0x80, 0x03, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00,
-  0x7E, 0x00, 0x0F, 0xC0, 0x03, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xC0, 0x0F,
-  0xF8, 0x03, 0xFE, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F,
-  0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x07,
-  0xF0, 0x00, 0x00, 0x7F, 0x00, 0xFE, 0x07, 0xE0, 0x3F, 0xC0, 0x7E, 0x07,
-  0xF8, 0x0F, 0xE0, 0xFF, 0x00, 0xFE, 0x1F, 0xC0, 0x0F, 0xE3, 0xF8, 0x00,
-  0xFC, 0x7F, 0x00, 0x0F, 0xCF, 0xE0, 0x01, 0xFD, 0xFC, 0x00, 0x1F, 0xFF,
-  0x80, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00,
-  0x3F, 0xFF, 0xC0, 0x03, 0xFE, 0xFE, 0x00, 0x3F, 0xCF, 0xE0, 0x03, 0xF0,
-  0xFE, 0x00, 0x7F, 0x07, 0xF0, 0x07, 0xF0, 0x7F, 0x00, 0x7F, 0x07, 0xF8,
-  0x07, 0xE0, 0x3F, 0x80, 0x7E, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0xC0, 0xFE,
-  0x01, 0xFC, 0x0F, 0xC0, 0x1F, 0xE0, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0x80,
-  0x7E, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0x80, 0xFC, 0x03, 0xF0, 0x1F, 0xC0,
-  0x7F, 0x01, 0xFC, 0x07, 0xE0, 0x3F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xC0,
-  0x3F, 0x01, 0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7E, 0x03, 0xF8, 0x0F, 0xE0,
-  0x3F, 0x80, 0xFC, 0x03, 0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xE0,
-  0x1F, 0x80, 0xFE, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0xFC, 0x03, 0xF0, 0x07,
-  0xE3, 0xFF, 0x0F, 0xFC, 0x07, 0xEF, 0xFF, 0x3F, 0xFE, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF8, 0x7F, 0xF0, 0xFF,
-  0x0F, 0xE0, 0x3F, 0xC0, 0x7F, 0x0F, 0xE0, 0x3F, 0x80, 0x7F, 0x1F, 0xC0,
-  0x3F, 0x80, 0x7E, 0x1F, 0xC0, 0x3F, 0x00, 0x7E, 0x1F, 0xC0, 0x3F, 0x00,
-  0xFE, 0x1F, 0x80, 0x7F, 0x00, 0xFE, 0x3F, 0x80, 0x7F, 0x00, 0xFC, 0x3F,
-  0x80, 0x7F, 0x00, 0xFC, 0x3F, 0x80, 0x7E, 0x01, 0xFC, 0x3F, 0x00, 0x7E,
-  0x01, 0xFC, 0x3F, 0x00, 0xFE, 0x01, 0xFC, 0x7F, 0x00, 0xFE, 0x01, 0xF8,
-  0x7F, 0x00, 0xFE, 0x01, 0xF8, 0x7F, 0x00, 0xFC, 0x03, 0xF8, 0x7E, 0x01,
-  0xFC, 0x03, 0xF8, 0x7E, 0x01, 0xFC, 0x03, 0xF8, 0xFE, 0x01, 0xFC, 0x03,
-  0xF0, 0xFE, 0x01, 0xF8, 0x03, 0xF0, 0xFE, 0x01, 0xF8, 0x07, 0xF0, 0x07,
-  0xF0, 0xFE, 0x00, 0xFE, 0x7F, 0xF0, 0x1F, 0x9F, 0xFF, 0x03, 0xFF, 0xFF,
-  0xF0, 0xFF, 0xFF, 0xFE, 0x1F, 0xF8, 0x3F, 0xC3, 0xFC, 0x03, 0xF8, 0x7F,
-  0x00, 0x7F, 0x0F, 0xE0, 0x0F, 0xE3, 0xF8, 0x01, 0xF8, 0x7F, 0x00, 0x3F,
-  0x0F, 0xC0, 0x0F, 0xE1, 0xF8, 0x01, 0xFC, 0x7F, 0x00, 0x3F, 0x8F, 0xE0,
-  0x07, 0xE1, 0xFC, 0x00, 0xFC, 0x3F, 0x00, 0x3F, 0x87, 0xE0, 0x07, 0xF1,
-  0xFC, 0x00, 0xFE, 0x3F, 0x80, 0x1F, 0x87, 0xF0, 0x03, 0xF0, 0xFC, 0x00,
-  0xFE, 0x3F, 0x80, 0x1F, 0xC7, 0xF0, 0x03, 0xF8, 0xFE, 0x00, 0x7E, 0x00,
-  0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF,
-  0xFC, 0x07, 0xFF, 0xFF, 0x83, 0xFC, 0x1F, 0xE1, 0xFE, 0x03, 0xFC, 0xFF,
-  0x00, 0xFF, 0x3F, 0x80, 0x1F, 0xDF, 0xC0, 0x07, 0xF7, 0xF0, 0x01, 0xFD,
-  0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x03,
-  0xFB, 0xF8, 0x00, 0xFE, 0xFE, 0x00, 0x3F, 0xBF, 0x80, 0x1F, 0xCF, 0xF0,
-  0x0F, 0xF3, 0xFC, 0x07, 0xF8, 0x7F, 0x83, 0xFC, 0x1F, 0xFF, 0xFE, 0x03,
-  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x00, 0x7F, 0x00,
-  0x00, 0x01, 0xFC, 0x3F, 0x00, 0x0F, 0xCF, 0xFE, 0x00, 0x7E, 0xFF, 0xF8,
-  0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0x01, 0xFF, 0x87, 0xF8, 0x0F,
-  0xF0, 0x1F, 0xE0, 0xFF, 0x00, 0xFF, 0x07, 0xF0, 0x03, 0xF8, 0x3F, 0x80,
-  0x1F, 0xC1, 0xF8, 0x00, 0xFE, 0x0F, 0xC0, 0x07, 0xF0, 0xFE, 0x00, 0x3F,
-  0x87, 0xF0, 0x01, 0xFC, 0x3F, 0x00, 0x1F, 0xC1, 0xF8, 0x00, 0xFE, 0x1F,
-  0xC0, 0x07, 0xF0, 0xFE, 0x00, 0x7F, 0x07, 0xF8, 0x07, 0xF8, 0x3F, 0xC0,
-  0x7F, 0x81, 0xFF, 0x87, 0xF8, 0x1F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC,
-  0x07, 0xF7, 0xFF, 0xC0, 0x3F, 0x1F, 0xF8, 0x01, 0xF8, 0x7F, 0x00, 0x1F,
-  0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x3F, 0x00,
-  0x00, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x00,
-  0x07, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x87, 0xF0,
-  0x0F, 0xFE, 0x7F, 0x01, 0xFF, 0xF7, 0xE0, 0x3F, 0xFF, 0x7E, 0x07, 0xFF,
-  0xFF, 0xE0, 0xFF, 0x07, 0xFE, 0x1F, 0xE0, 0x3F, 0xE3, 0xFC, 0x03, 0xFC,
-  0x3F, 0x80, 0x1F, 0xC7, 0xF0, 0x01, 0xFC, 0x7F, 0x00, 0x1F, 0xC7, 0xF0,
-  0x01, 0xF8, 0xFE, 0x00, 0x1F, 0x8F, 0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x3F,
-  0x8F, 0xE0, 0x03, 0xF8, 0xFE, 0x00, 0x7F, 0x0F, 0xE0, 0x07, 0xF0, 0xFE,
-  0x00, 0xFF, 0x0F, 0xF0, 0x1F, 0xF0, 0x7F, 0x87, 0xFF, 0x07, 0xFF, 0xFF,
-  0xE0, 0x3F, 0xFF, 0x7E, 0x03, 0xFF, 0xEF, 0xE0, 0x1F, 0xFC, 0xFE, 0x00,
-  0x7F, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80,
-  0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x07,
-  0xF0, 0xF0, 0x7F, 0x3F, 0x07, 0xE7, 0xE0, 0x7E, 0xFE, 0x0F, 0xFF, 0xE0,
-  0xFF, 0xFE, 0x0F, 0xFC, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00,
-  0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80,
-  0x03, 0xF8, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0,
-  0x00, 0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x07,
-  0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0x1F, 0xC0, 0x7F, 0x1F,
-  0xC0, 0x7F, 0x1F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x0F,
-  0xFF, 0xF0, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00,
-  0x0F, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0xFC, 0x00, 0xFE, 0xFE,
-  0x00, 0xFE, 0xFF, 0x03, 0xFC, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x3F,
-  0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x03, 0xFE, 0x00, 0x03, 0xF0, 0x1F, 0xC0,
-  0x7F, 0x01, 0xFC, 0x07, 0xE0, 0x3F, 0x80, 0xFE, 0x1F, 0xFF, 0x7F, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xC7, 0xF0, 0x1F, 0xC0, 0x7E, 0x01, 0xF8, 0x0F, 0xE0,
-  0x3F, 0x80, 0xFE, 0x03, 0xF0, 0x0F, 0xC0, 0x7F, 0x01, 0xFC, 0x07, 0xE0,
-  0x1F, 0x80, 0xFE, 0x03, 0xF8, 0x0F, 0xE0, 0x3F, 0xF0, 0xFF, 0xC3, 0xFF,
-  0x07, 0xFC, 0x0F, 0xE0, 0x0F, 0xC0, 0x0F, 0xE1, 0xF8, 0x01, 0xFC, 0x7F,
-  0x00, 0x3F, 0x0F, 0xE0, 0x0F, 0xE1, 0xFC, 0x01, 0xFC, 0x3F, 0x00, 0x3F,
-  0x87, 0xE0, 0x07, 0xE1, 0xFC, 0x00, 0xFC, 0x3F, 0x80, 0x3F, 0x87, 0xF0,
-  0x07, 0xF0, 0xFC, 0x00, 0xFE, 0x1F, 0x80, 0x1F, 0x87, 0xF0, 0x03, 0xF0,
-  0xFE, 0x00, 0xFE, 0x1F, 0x80, 0x1F, 0xC3, 0xF0, 0x03, 0xF0, 0xFE, 0x00,
-  0x7E, 0x1F, 0xC0, 0x1F, 0xC3, 0xF8, 0x07, 0xF8, 0x7F, 0x01, 0xFF, 0x0F,
-  0xF0, 0x7F, 0xC1, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x03, 0xFF, 0xEF,
-  0xE0, 0x3F, 0xF9, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x7F, 0x7F,
-  0x00, 0x3F, 0xBF, 0x80, 0x3F, 0x8F, 0xC0, 0x1F, 0xC7, 0xE0, 0x1F, 0xC3,
-  0xF0, 0x0F, 0xC1, 0xFC, 0x0F, 0xE0, 0xFE, 0x07, 0xE0, 0x7F, 0x07, 0xF0,
-  0x3F, 0x83, 0xF0, 0x0F, 0xC3, 0xF8, 0x07, 0xE1, 0xF8, 0x03, 0xF1, 0xFC,
-  0x01, 0xF8, 0xFC, 0x00, 0xFC, 0xFC, 0x00, 0x7E, 0x7E, 0x00, 0x3F, 0x7E,
-  0x00, 0x0F, 0xBF, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF,
-  0x80, 0x00, 0xFF, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F,
-  0xE0, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0x01, 0xFF,
-  0xF8, 0x1F, 0xE0, 0x3F, 0x7F, 0x03, 0xFC, 0x0F, 0xEF, 0xE0, 0xFF, 0x81,
-  0xF9, 0xFC, 0x1F, 0xF0, 0x7F, 0x3F, 0x83, 0xFE, 0x0F, 0xC3, 0xF0, 0xFF,
-  0xC3, 0xF8, 0x7E, 0x1E, 0xF8, 0x7E, 0x0F, 0xC7, 0xDF, 0x1F, 0xC1, 0xF8,
-  0xFB, 0xE3, 0xF0, 0x3F, 0x1E, 0x7C, 0x7E, 0x07, 0xE7, 0xCF, 0x9F, 0x80,
-  0xFC, 0xF1, 0xF3, 0xF0, 0x1F, 0xBE, 0x3E, 0xFC, 0x03, 0xF7, 0x87, 0xDF,
-  0x80, 0x7E, 0xF0, 0xFF, 0xE0, 0x0F, 0xFE, 0x1F, 0xFC, 0x01, 0xFF, 0x83,
-  0xFF, 0x00, 0x3F, 0xF0, 0x7F, 0xE0, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0x7F,
-  0x81, 0xFF, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x01, 0xFC, 0x07, 0xF8, 0x00,
-  0x3F, 0x80, 0xFE, 0x00, 0x00, 0x03, 0xFC, 0x07, 0xF8, 0x1F, 0xE0, 0x7F,
-  0x80, 0x7F, 0x03, 0xF8, 0x03, 0xF8, 0x3F, 0x80, 0x1F, 0xE3, 0xF8, 0x00,
-  0x7F, 0x3F, 0x80, 0x03, 0xF9, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
-  0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x01, 0xFC, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x80, 0x00,
-  0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xDF, 0xC0, 0x01, 0xFC,
-  0xFE, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0xFE, 0x1F, 0xC0, 0x0F, 0xE0, 0xFE,
-  0x00, 0xFF, 0x07, 0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0xFF, 0x00, 0xFF, 0x00,
-  0x0F, 0xE0, 0x03, 0xF0, 0x7F, 0x00, 0x3F, 0x83, 0xF8, 0x01, 0xF8, 0x1F,
-  0xC0, 0x1F, 0xC0, 0xFE, 0x00, 0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0xC0,
-  0x7E, 0x00, 0xFE, 0x07, 0xE0, 0x07, 0xF0, 0x3F, 0x00, 0x3F, 0x83, 0xF0,
-  0x01, 0xFC, 0x1F, 0x80, 0x0F, 0xE1, 0xF8, 0x00, 0x3F, 0x0F, 0xC0, 0x01,
-  0xF8, 0xFC, 0x00, 0x0F, 0xC7, 0xC0, 0x00, 0x7F, 0x7E, 0x00, 0x03, 0xFB,
-  0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0x80,
-  0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF8, 0x00,
-  0x01, 0xFF, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07,
-  0xF8, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFF,
-  0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0x80,
-  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xF8,
-  0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-  0x80, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x07,
-  0xF8, 0x00, 0x03, 0xFC, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
-  0x7F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-  0xE0, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF0, 0x07, 0xFC,
-  0x01, 0xFE, 0x00, 0xFF, 0x80, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01,
-  0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8,
-  0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-  0x3F, 0x00, 0x7F, 0x80, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xFC, 0x00, 0x3F,
-  0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0,
-  0x01, 0xF0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x01,
-  0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xF8, 0x01, 0xFE, 0x00, 0x7F,
-  0x80, 0x0F, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x1C, 0x01,
-  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
-  0x03, 0xC0, 0x1C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x3C, 0x01,
-  0xE0, 0x0F, 0x00, 0x78, 0x03, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
-  0x03, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0x80, 0x3C, 0x01,
-  0xE0, 0x0F, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x70,
-  0x07, 0x80, 0x3C, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01,
-  0xFE, 0x00, 0x7F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x1F,
-  0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0F, 0x80,
-  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00,
-  0xFF, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x07, 0xF8, 0x03, 0xF0, 0x00, 0xF8,
-  0x00, 0x3E, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-  0x1F, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x1F,
-  0x80, 0x07, 0xC0, 0x01, 0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x80,
-  0x3F, 0xC0, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0xFF, 0x80, 0x07, 0xFF,
-  0x03, 0xDF, 0xFE, 0x0F, 0xF0, 0x7F, 0xFB, 0x80, 0xFF, 0xE0, 0x01, 0xFF,
-  0x00, 0x03, 0xF0 };
+  0x74, 0xA7, 0x77, 0x68, 0x67, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77,
+  0x76, 0x86, 0x86, 0x85, 0x95, 0x95, 0x85, 0x95, 0x95, 0x94, 0xA4, 0xA4,
+  0xA3, 0xFF, 0x67, 0x77, 0x77, 0x77, 0x77, 0x67, 0x77, 0x70, 0x16, 0x56,
+  0x16, 0x56, 0x16, 0x5C, 0x56, 0x16, 0x56, 0x16, 0x56, 0x16, 0x56, 0x15,
+  0x65, 0x25, 0x65, 0x24, 0x74, 0x34, 0x74, 0x33, 0x83, 0x40, 0xD5, 0x55,
+  0xE5, 0x55, 0xD5, 0x55, 0xE5, 0x55, 0xD5, 0x55, 0xE5, 0x55, 0xD5, 0x55,
+  0x9F, 0x94, 0xFA, 0x4F, 0xA4, 0xF9, 0x5F, 0x99, 0x55, 0x5E, 0x54, 0x5E,
+  0x55, 0x5E, 0x55, 0x5D, 0x55, 0x5E, 0x55, 0x5E, 0x54, 0x5A, 0xF9, 0x4F,
+  0xA4, 0xF9, 0x5F, 0x95, 0xF9, 0x85, 0x55, 0xE5, 0x55, 0xD5, 0x55, 0xE5,
+  0x55, 0xD5, 0x55, 0xE5, 0x55, 0xE5, 0x45, 0xE5, 0x55, 0xE5, 0x54, 0xF0,
+  0xF1, 0x3F, 0x83, 0xF8, 0x3F, 0x4A, 0xDF, 0x0A, 0xF2, 0x8F, 0x37, 0xF5,
+  0x57, 0x23, 0x27, 0x56, 0x33, 0x36, 0x55, 0x43, 0x36, 0x46, 0x43, 0x36,
+  0x46, 0x34, 0x36, 0x46, 0x33, 0xE7, 0x23, 0xE8, 0x13, 0xEC, 0xF0, 0xCF,
+  0x0D, 0xDF, 0x0D, 0xEE, 0xCF, 0x0C, 0xE3, 0x18, 0xE3, 0x27, 0xE3, 0x27,
+  0x37, 0x34, 0x27, 0x37, 0x33, 0x37, 0x37, 0x33, 0x36, 0x47, 0x33, 0x27,
+  0x48, 0x23, 0x27, 0x48, 0x1C, 0x6F, 0x47, 0xF4, 0x8F, 0x1B, 0xEF, 0x08,
+  0xF5, 0x3F, 0x83, 0xF8, 0x3F, 0x74, 0xF7, 0x3F, 0x10, 0x76, 0xF1, 0x48,
+  0xAD, 0x48, 0xCB, 0x48, 0xDB, 0x38, 0xF0, 0x94, 0x76, 0x46, 0x84, 0x84,
+  0x84, 0x74, 0x85, 0x84, 0x73, 0x94, 0x94, 0x63, 0xA4, 0x85, 0x54, 0xA4,
+  0x84, 0x54, 0xB6, 0x46, 0x44, 0xCF, 0x05, 0x3E, 0xD5, 0x4E, 0xC5, 0x4F,
+  0x1A, 0x54, 0xF4, 0x67, 0x3F, 0xF2, 0x37, 0x6F, 0x44, 0x5A, 0xF1, 0x45,
+  0xCF, 0x03, 0x5D, 0xE3, 0x5F, 0x0C, 0x44, 0x64, 0x6B, 0x45, 0x48, 0x4A,
+  0x45, 0x58, 0x4A, 0x36, 0x49, 0x49, 0x46, 0x48, 0x58, 0x47, 0x48, 0x48,
+  0x48, 0x64, 0x68, 0x39, 0xF0, 0x83, 0xBD, 0x84, 0xBC, 0x84, 0xDA, 0x84,
+  0xF1, 0x67, 0xF0, 0x6F, 0x6A, 0xF2, 0xDF, 0x0F, 0x0E, 0xF0, 0xD7, 0x27,
+  0xC7, 0x46, 0xC7, 0x46, 0xC7, 0x45, 0xD7, 0x36, 0xD8, 0x26, 0xD8, 0x16,
+  0xF0, 0xDF, 0x1C, 0xF3, 0xAF, 0x48, 0xF4, 0xAF, 0x2D, 0x55, 0x5E, 0x55,
+  0x3F, 0x23, 0x53, 0x93, 0x63, 0x53, 0x75, 0x71, 0x53, 0x77, 0xC3, 0x68,
+  0xB3, 0x79, 0xA3, 0x79, 0x94, 0x7A, 0x75, 0x7A, 0x75, 0x87, 0xA4, 0x95,
+  0xB5, 0xFA, 0x4F, 0xB4, 0xF1, 0x27, 0x6C, 0x48, 0x78, 0xF0, 0x16, 0x16,
+  0x1C, 0x16, 0x16, 0x16, 0x15, 0x25, 0x24, 0x34, 0x33, 0x40, 0xC5, 0xB5,
+  0xB5, 0xB6, 0xB5, 0xB5, 0xB6, 0xB5, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6,
+  0xB5, 0xB6, 0xB5, 0xC5, 0xB6, 0xB5, 0xC5, 0xC5, 0xB6, 0xB5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xD4, 0xD5, 0xC5, 0xC5,
+  0xC5, 0xD5, 0xC5, 0xC5, 0xD4, 0xD5, 0x90, 0x95, 0xD4, 0xD5, 0xC5, 0xC5,
+  0xD4, 0xD5, 0xC5, 0xC5, 0xD4, 0xD5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xB5, 0xC5, 0xC5, 0xC5, 0xB6, 0xB5, 0xC5, 0xB6,
+  0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB6, 0xB5, 0xB5, 0xB6, 0xB5, 0xB5, 0xB6,
+  0xB5, 0xB5, 0xB5, 0xC0, 0x74, 0xB3, 0xC3, 0xC3, 0x63, 0x24, 0x32, 0x1F,
+  0xE1, 0xD5, 0x78, 0x77, 0x86, 0x41, 0x54, 0x43, 0x44, 0x34, 0x45, 0x16,
+  0x15, 0xC5, 0xF3, 0x6F, 0x36, 0xF3, 0x5F, 0x45, 0xF3, 0x6F, 0x36, 0xF3,
+  0x69, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0x71, 0xF8, 0x1F, 0x89, 0x6F, 0x36,
+  0xF3, 0x6F, 0x35, 0xF4, 0x5F, 0x36, 0xF3, 0x6F, 0x36, 0xB0, 0x37, 0x37,
+  0x36, 0x37, 0x37, 0x37, 0x73, 0x63, 0x73, 0x64, 0x63, 0x54, 0x46, 0x44,
+  0x62, 0x80, 0x1D, 0x1D, 0x1C, 0x2C, 0x1D, 0x1D, 0x10, 0x17, 0x17, 0x17,
+  0x16, 0x17, 0x17, 0x17, 0x10, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2,
+  0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2,
+  0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2,
+  0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2,
+  0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0xC7, 0xF1, 0xBC,
+  0xF0, 0x9F, 0x18, 0xF3, 0x77, 0x38, 0x67, 0x58, 0x47, 0x77, 0x46, 0x87,
+  0x37, 0x87, 0x37, 0x87, 0x36, 0x97, 0x27, 0x97, 0x27, 0x97, 0x26, 0x98,
+  0x17, 0x97, 0x27, 0x97, 0x27, 0x97, 0x27, 0x97, 0x27, 0x88, 0x17, 0x97,
+  0x27, 0x97, 0x27, 0x97, 0x27, 0x87, 0x37, 0x87, 0x37, 0x87, 0x37, 0x77,
+  0x48, 0x67, 0x49, 0x38, 0x6F, 0x37, 0xF3, 0x8F, 0x1A, 0xDD, 0xBF, 0x17,
+  0xC0, 0xC5, 0xB5, 0xC5, 0xB6, 0x98, 0x6B, 0x2E, 0x3E, 0x2F, 0x02, 0xF0,
+  0xA7, 0xA6, 0xB6, 0xA7, 0xA7, 0xA7, 0xA6, 0xA7, 0xA7, 0xA7, 0xA6, 0xB6,
+  0xA7, 0xA7, 0xA7, 0xA6, 0xB6, 0xA7, 0xA7, 0xA7, 0xA6, 0xA7, 0xA7, 0x70,
+  0xF0, 0x8F, 0x3D, 0xEF, 0x2B, 0xF4, 0x9F, 0x58, 0x85, 0x97, 0x77, 0x86,
+  0x79, 0x76, 0x6A, 0x76, 0x6A, 0x75, 0x6B, 0x75, 0x6A, 0x7F, 0x77, 0xF6,
+  0x7F, 0x77, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x49, 0xF3, 0xAF, 0x39, 0xF3,
+  0x9F, 0x3A, 0xF3, 0x9F, 0x49, 0xF4, 0x8F, 0x58, 0xF5, 0x8F, 0x6F, 0x76,
+  0xF8, 0x6F, 0x85, 0xF9, 0x5F, 0x95, 0xF8, 0x60, 0xC9, 0xF0, 0xDB, 0xF1,
+  0x9F, 0x37, 0xF5, 0x67, 0x49, 0x57, 0x77, 0x56, 0x87, 0x56, 0x87, 0x46,
+  0x97, 0x46, 0x96, 0xF4, 0x7F, 0x37, 0xF2, 0x8E, 0xBF, 0x0A, 0xF1, 0xBF,
+  0x0C, 0xEC, 0xF3, 0x9F, 0x38, 0xF4, 0x7F, 0x47, 0xF4, 0x7F, 0x47, 0x27,
+  0x98, 0x27, 0x97, 0x37, 0x88, 0x39, 0x58, 0x4F, 0x75, 0xF5, 0x6F, 0x48,
+  0xF2, 0xBD, 0xF0, 0x8C, 0xF2, 0x8F, 0x19, 0xF0, 0xAE, 0xAF, 0x0A, 0xEB,
+  0xD4, 0x17, 0xC4, 0x27, 0xB5, 0x26, 0xB5, 0x27, 0xB4, 0x37, 0xA4, 0x47,
+  0x94, 0x56, 0x95, 0x56, 0x85, 0x57, 0x75, 0x67, 0x65, 0x77, 0x65, 0x76,
+  0x65, 0x77, 0x55, 0x87, 0x5F, 0x81, 0xF9, 0x1F, 0x91, 0xF8, 0x2F, 0x8F,
+  0x07, 0xF3, 0x6F, 0x37, 0xF3, 0x7F, 0x37, 0xF3, 0x6F, 0x46, 0x70, 0x9F,
+  0x39, 0xF3, 0x9F, 0x38, 0xF4, 0x8F, 0x38, 0xF4, 0x85, 0xF7, 0x5F, 0x65,
+  0xF7, 0x5F, 0x75, 0xF6, 0x53, 0x6D, 0xF1, 0xAF, 0x39, 0xF4, 0x8F, 0x47,
+  0x84, 0x96, 0x67, 0x8F, 0x57, 0xF5, 0x7F, 0x57, 0xF5, 0x7F, 0x57, 0xF4,
+  0x74, 0x79, 0x74, 0x78, 0x75, 0x78, 0x75, 0x85, 0x86, 0xF6, 0x7F, 0x48,
+  0xF3, 0xAF, 0x1D, 0xCF, 0x28, 0xD0, 0xD7, 0xF0, 0xCC, 0xEA, 0xF1, 0x8F,
+  0x36, 0x74, 0x85, 0x67, 0x75, 0x68, 0x64, 0x6F, 0x46, 0xF3, 0x6F, 0x46,
+  0xF3, 0x73, 0x69, 0x62, 0xA7, 0xF4, 0x5F, 0x64, 0xF6, 0x49, 0x49, 0x38,
+  0x68, 0x37, 0x87, 0x27, 0x97, 0x27, 0x97, 0x26, 0xA7, 0x26, 0xA6, 0x36,
+  0x97, 0x36, 0x97, 0x36, 0x87, 0x47, 0x68, 0x48, 0x48, 0x6F, 0x46, 0xF3,
+  0x8F, 0x1A, 0xEC, 0xBF, 0x17, 0xC0, 0x2F, 0x92, 0xF9, 0x2F, 0x83, 0xF8,
+  0x2F, 0x92, 0xF9, 0xF3, 0x7F, 0x37, 0xF3, 0x7F, 0x37, 0xF3, 0x7F, 0x37,
+  0xF3, 0x7F, 0x46, 0xF4, 0x6F, 0x46, 0xF4, 0x7F, 0x46, 0xF4, 0x6F, 0x47,
+  0xF4, 0x6F, 0x47, 0xF4, 0x6F, 0x47, 0xF4, 0x6F, 0x47, 0xF4, 0x6F, 0x47,
+  0xF4, 0x6F, 0x47, 0xF4, 0x7F, 0x46, 0xF4, 0x7F, 0x40, 0xD7, 0xF1, 0xDC,
+  0xF0, 0xAF, 0x28, 0xF4, 0x67, 0x58, 0x65, 0x87, 0x56, 0x96, 0x55, 0xA6,
+  0x55, 0xA6, 0x55, 0x96, 0x65, 0x86, 0x86, 0x57, 0x8F, 0x1B, 0xEC, 0xEA,
+  0xF2, 0x8F, 0x46, 0x84, 0x85, 0x77, 0x84, 0x69, 0x73, 0x79, 0x73, 0x6A,
+  0x72, 0x7A, 0x72, 0x7A, 0x72, 0x79, 0x73, 0x79, 0x73, 0x87, 0x74, 0x94,
+  0x94, 0xF6, 0x6F, 0x48, 0xF3, 0x8F, 0x1C, 0xDF, 0x08, 0xC0, 0xC7, 0xF1,
+  0xBC, 0xEA, 0xF1, 0x8F, 0x36, 0x84, 0x75, 0x86, 0x74, 0x78, 0x63, 0x79,
+  0x63, 0x79, 0x63, 0x6A, 0x62, 0x7A, 0x62, 0x7A, 0x62, 0x79, 0x72, 0x79,
+  0x72, 0x78, 0x73, 0x86, 0x83, 0x94, 0x94, 0xF6, 0x4F, 0x65, 0xF4, 0x7A,
+  0x26, 0x96, 0x37, 0xF3, 0x6F, 0x46, 0xF3, 0x6F, 0x46, 0x47, 0x76, 0x58,
+  0x48, 0x5F, 0x47, 0xF2, 0x8F, 0x1A, 0xEC, 0xCF, 0x07, 0xD0, 0x57, 0x57,
+  0x57, 0x56, 0x57, 0x57, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x57, 0x57,
+  0x56, 0x57, 0x57, 0x57, 0x50, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77, 0x77,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x77, 0x76, 0x77, 0x77, 0x77, 0xB3,
+  0xA3, 0xB3, 0xA4, 0xA3, 0x94, 0x86, 0x84, 0xA2, 0xC0, 0xFA, 0x1F, 0x73,
+  0xF5, 0x6F, 0x29, 0xEC, 0xBF, 0x08, 0xF2, 0x7F, 0x17, 0xF1, 0x9E, 0xBC,
+  0xE9, 0xF2, 0xBF, 0x0D, 0xDF, 0x1C, 0xF2, 0xCF, 0x1C, 0xF0, 0xEC, 0xF1,
+  0xAF, 0x46, 0xF7, 0x4F, 0xA1, 0x50, 0x3F, 0x83, 0xF8, 0x3F, 0x83, 0xF8,
+  0x3F, 0x73, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x83, 0xF8, 0x3F,
+  0x73, 0xF8, 0x3F, 0x83, 0xF8, 0x30, 0x51, 0xFA, 0x4F, 0x76, 0xF4, 0xAF,
+  0x1C, 0xEF, 0x0C, 0xF1, 0xCF, 0x2C, 0xF1, 0xDD, 0xF0, 0xBF, 0x29, 0xEC,
+  0xBE, 0x9F, 0x17, 0xF1, 0x7F, 0x28, 0xF0, 0xBC, 0xE9, 0xF2, 0x6F, 0x53,
+  0xF7, 0x1F, 0xA0, 0xA7, 0xED, 0x9F, 0x17, 0xF3, 0x5F, 0x54, 0xF5, 0x38,
+  0x59, 0x27, 0x78, 0x17, 0x97, 0x16, 0xAE, 0xAE, 0xA7, 0xF1, 0x7F, 0x27,
+  0xF1, 0x7F, 0x09, 0xE9, 0xE9, 0xE8, 0xF0, 0x8F, 0x07, 0xF1, 0x6F, 0x35,
+  0xF3, 0x6F, 0x35, 0xFF, 0xFF, 0xFE, 0x7F, 0x27, 0xF2, 0x7F, 0x27, 0xF1,
+  0x7F, 0x27, 0xF2, 0x7E, 0xF9, 0xAF, 0xF1, 0xF2, 0xFB, 0xF6, 0xF7, 0xF9,
+  0xF4, 0x98, 0xAF, 0x18, 0xE8, 0xE7, 0xF3, 0x7C, 0x6F, 0x67, 0x97, 0xF8,
+  0x68, 0x6F, 0xB5, 0x76, 0xFD, 0x56, 0x5C, 0x63, 0x53, 0x55, 0x5A, 0xA2,
+  0x45, 0x44, 0x68, 0xF3, 0x54, 0x36, 0x86, 0x48, 0x64, 0x35, 0x85, 0x76,
+  0x74, 0x25, 0x85, 0x86, 0x74, 0x25, 0x75, 0x95, 0x84, 0x15, 0x84, 0xA5,
+  0x83, 0x25, 0x75, 0xA4, 0x84, 0x25, 0x74, 0xB4, 0x84, 0x24, 0x75, 0xA4,
+  0x84, 0x25, 0x74, 0xB4, 0x84, 0x25, 0x65, 0xA4, 0x84, 0x35, 0x65, 0x95,
+  0x75, 0x35, 0x65, 0x85, 0x75, 0x45, 0x65, 0x76, 0x65, 0x55, 0x66, 0x58,
+  0x36, 0x65, 0x6F, 0xC7, 0x66, 0xC1, 0xC9, 0x57, 0xA3, 0x9B, 0x67, 0x67,
+  0x6D, 0x7F, 0xF9, 0x7F, 0xF9, 0x7F, 0xF8, 0x9F, 0xF7, 0xBB, 0x3F, 0x7F,
+  0x9F, 0x7F, 0x8F, 0x9F, 0x4F, 0xF0, 0xBF, 0x60, 0xF4, 0x9F, 0x7A, 0xF7,
+  0xAF, 0x6B, 0xF6, 0xBF, 0x5C, 0xF5, 0xCF, 0x4D, 0xF3, 0xF0, 0xF2, 0x71,
+  0x7F, 0x17, 0x27, 0xF1, 0x63, 0x7F, 0x07, 0x37, 0xF0, 0x64, 0x7E, 0x74,
+  0x7E, 0x65, 0x7D, 0x76, 0x7B, 0x77, 0x7B, 0x77, 0x7A, 0x78, 0x7A, 0x69,
+  0x79, 0xF8, 0x9F, 0x88, 0xFA, 0x6F, 0xB6, 0xFB, 0x5F, 0xC5, 0x7D, 0x74,
+  0x7E, 0x74, 0x7E, 0x73, 0x7F, 0x07, 0x37, 0xF1, 0x71, 0x7F, 0x2F, 0x0F,
+  0x27, 0x7F, 0x4D, 0xF7, 0xAF, 0x88, 0xFA, 0x7F, 0xA7, 0xFB, 0x67, 0xB8,
+  0x67, 0xC7, 0x57, 0xD7, 0x57, 0xD7, 0x57, 0xD6, 0x67, 0xC7, 0x58, 0xA8,
+  0x6F, 0xA7, 0xF9, 0x8F, 0x89, 0xF9, 0x7F, 0xB6, 0xFB, 0x67, 0xB9, 0x57,
+  0xD7, 0x57, 0xD7, 0x47, 0xE7, 0x47, 0xE7, 0x47, 0xE7, 0x47, 0xD7, 0x47,
+  0xD8, 0x47, 0xC8, 0x5F, 0xC5, 0xFB, 0x6F, 0xA6, 0xFA, 0x7F, 0x89, 0xF5,
+  0xC0, 0xF1, 0x8F, 0x6E, 0xF1, 0xF2, 0xDF, 0x5B, 0xF7, 0x9F, 0x97, 0xA6,
+  0x96, 0x99, 0x94, 0x8C, 0x84, 0x7E, 0x73, 0x8E, 0x73, 0x7F, 0x07, 0x27,
+  0xFA, 0x7F, 0x98, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F, 0x97, 0xFA, 0x7F, 0xA7,
+  0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xF1, 0x63, 0x7F, 0x07, 0x38, 0xD8,
+  0x38, 0xD7, 0x58, 0xA9, 0x5A, 0x6A, 0x7F, 0x98, 0xF8, 0xAF, 0x6C, 0xF4,
+  0xF0, 0xF0, 0xF5, 0x9E, 0x7F, 0x3E, 0xF5, 0xBF, 0x89, 0xF9, 0x8F, 0x98,
+  0xFA, 0x77, 0x99, 0x67, 0xB9, 0x57, 0xC8, 0x57, 0xD7, 0x57, 0xD7, 0x48,
+  0xD7, 0x47, 0xE7, 0x47, 0xE7, 0x47, 0xE7, 0x47, 0xE7, 0x37, 0xF0, 0x73,
+  0x7E, 0x74, 0x7E, 0x74, 0x7E, 0x74, 0x7D, 0x83, 0x7E, 0x74, 0x7E, 0x74,
+  0x7D, 0x75, 0x7C, 0x84, 0x7C, 0x85, 0x7B, 0x95, 0x79, 0xA6, 0xFA, 0x7F,
+  0x97, 0xF9, 0x8F, 0x89, 0xF6, 0xBF, 0x2F, 0x00, 0x7F, 0xA7, 0xFA, 0x6F,
+  0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x77, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7,
+  0xFA, 0x7F, 0x97, 0xFA, 0xF9, 0x8F, 0x89, 0xF8, 0x8F, 0x98, 0xF9, 0x8F,
+  0x98, 0x7F, 0xA7, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F, 0x97,
+  0xFA, 0x7F, 0xAF, 0xA7, 0xFA, 0x6F, 0xB6, 0xFB, 0x6F, 0xB6, 0xFA, 0x70,
+  0x8F, 0x97, 0xFA, 0x7F, 0x98, 0xF9, 0x8F, 0x98, 0xF9, 0x77, 0xFA, 0x7F,
+  0xA7, 0xFA, 0x7F, 0xA7, 0xF9, 0x7F, 0xA7, 0xFA, 0xF7, 0xAF, 0x79, 0xF8,
+  0x9F, 0x7A, 0xF7, 0xAF, 0x7A, 0x7F, 0x97, 0xFA, 0x7F, 0xA7, 0xFA, 0x7F,
+  0xA7, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F, 0xA7, 0xF9, 0x7F, 0xA7, 0xFA, 0x7F,
+  0xA7, 0xFA, 0x7F, 0x90, 0xF1, 0x9F, 0x6F, 0x0F, 0x1F, 0x3D, 0xF6, 0xBF,
+  0x89, 0xFA, 0x7A, 0x79, 0x69, 0xB8, 0x48, 0xE7, 0x47, 0xF0, 0x73, 0x7F,
+  0x17, 0x37, 0xFA, 0x7F, 0xB7, 0xFA, 0x7F, 0xB7, 0xFB, 0x7A, 0xE2, 0x6B,
+  0xE1, 0x7B, 0xD2, 0x7B, 0xD2, 0x7B, 0xD2, 0x7A, 0xE2, 0x7F, 0x36, 0x27,
+  0xF2, 0x63, 0x8F, 0x16, 0x38, 0xF0, 0x73, 0x8E, 0x84, 0x8C, 0x94, 0x9A,
+  0x96, 0xA6, 0xB6, 0xFC, 0x7F, 0xB8, 0xF4, 0x15, 0x9F, 0x13, 0x4C, 0xD4,
+  0x4E, 0x8F, 0x10, 0x77, 0xE7, 0x77, 0xE7, 0x77, 0xE7, 0x77, 0xD7, 0x87,
+  0xD7, 0x77, 0xE7, 0x77, 0xE7, 0x77, 0xE7, 0x77, 0xD7, 0x78, 0xD7, 0x77,
+  0xE7, 0x77, 0xE7, 0x77, 0xD7, 0x8F, 0xC7, 0xFD, 0x7F, 0xD7, 0xFD, 0x7F,
+  0xC8, 0xFC, 0x77, 0xE7, 0x77, 0xE7, 0x77, 0xE7, 0x77, 0xD7, 0x77, 0xE7,
+  0x77, 0xE7, 0x77, 0xE7, 0x77, 0xD7, 0x87, 0xD7, 0x77, 0xE7, 0x77, 0xE7,
+  0x77, 0xE7, 0x77, 0xD7, 0x87, 0xD7, 0x77, 0xE7, 0x70, 0x77, 0x77, 0x67,
+  0x77, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77,
+  0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x77,
+  0x67, 0x77, 0x77, 0x77, 0x77, 0x67, 0x77, 0x70, 0xF5, 0x7F, 0x57, 0xF5,
+  0x7F, 0x47, 0xF5, 0x7F, 0x57, 0xF5, 0x7F, 0x48, 0xF4, 0x7F, 0x57, 0xF5,
+  0x7F, 0x57, 0xF4, 0x7F, 0x57, 0xF5, 0x7F, 0x57, 0xF5, 0x7F, 0x47, 0xF5,
+  0x7F, 0x57, 0xF5, 0x75, 0x77, 0x85, 0x77, 0x76, 0x77, 0x75, 0x78, 0x75,
+  0x78, 0x75, 0x77, 0x76, 0x77, 0x76, 0x84, 0x96, 0xF5, 0x7F, 0x49, 0xF3,
+  0xAF, 0x0D, 0xDF, 0x18, 0xE0, 0x87, 0xD8, 0x88, 0xC8, 0x97, 0xB9, 0xA7,
+  0xA9, 0xB7, 0x98, 0xD7, 0x88, 0xD7, 0x88, 0xE7, 0x78, 0xF0, 0x76, 0x8F,
+  0x17, 0x58, 0xF2, 0x74, 0x8F, 0x27, 0x39, 0xF3, 0x72, 0x8F, 0x57, 0x18,
+  0xF6, 0xF0, 0xF6, 0xF1, 0xF6, 0xF2, 0xF5, 0xF2, 0xF5, 0xF3, 0xF4, 0xF3,
+  0xF3, 0xA2, 0x8F, 0x29, 0x38, 0xF2, 0x85, 0x8F, 0x17, 0x69, 0xF0, 0x77,
+  0x8E, 0x79, 0x8D, 0x79, 0x8D, 0x7A, 0x8C, 0x7A, 0x9A, 0x7C, 0x8A, 0x7C,
+  0x99, 0x7D, 0x89, 0x7D, 0x98, 0x7E, 0x87, 0x77, 0xF2, 0x7F, 0x27, 0xF1,
+  0x7F, 0x27, 0xF2, 0x7F, 0x27, 0xF1, 0x7F, 0x27, 0xF2, 0x7F, 0x27, 0xF2,
+  0x7F, 0x17, 0xF2, 0x7F, 0x27, 0xF2, 0x7F, 0x27, 0xF1, 0x7F, 0x27, 0xF2,
+  0x7F, 0x27, 0xF1, 0x7F, 0x27, 0xF2, 0x7F, 0x27, 0xF2, 0x7F, 0x17, 0xF2,
+  0x7F, 0x2F, 0x81, 0xF8, 0x1F, 0xFF, 0xFF, 0xF4, 0x10, 0x7A, 0xDB, 0x7A,
+  0xDA, 0x8A, 0xCB, 0x8A, 0xCB, 0x7B, 0xBC, 0x7B, 0xBC, 0x7B, 0xA5, 0x16,
+  0x86, 0x14, 0xA5, 0x16, 0x86, 0x14, 0x9D, 0x77, 0x14, 0x95, 0x17, 0x77,
+  0x14, 0x86, 0x16, 0x87, 0x14, 0x85, 0x26, 0x86, 0x24, 0x76, 0x17, 0x77,
+  0x25, 0x65, 0x27, 0x77, 0x25, 0x56, 0x27, 0x77, 0x25, 0x55, 0x36, 0x87,
+  0x25, 0x46, 0x36, 0x86, 0x35, 0x46, 0x27, 0x77, 0x35, 0x45, 0x37, 0x77,
+  0x35, 0x36, 0x37, 0x77, 0x35, 0x35, 0x46, 0x86, 0x45, 0x26, 0x46, 0x86,
+  0x45, 0x25, 0x47, 0x77, 0x45, 0x16, 0x47, 0x77, 0x45, 0x15, 0x56, 0x87,
+  0x4B, 0x56, 0x86, 0x5B, 0x47, 0x77, 0x5A, 0x57, 0x77, 0x5A, 0x57, 0x77,
+  0x59, 0x66, 0x87, 0x59, 0x66, 0x86, 0x68, 0x67, 0x77, 0x68, 0x67, 0x77,
+  0x67, 0x76, 0x80, 0x78, 0xE6, 0x78, 0xD7, 0x79, 0xC7, 0x79, 0xC7, 0x79,
+  0xC6, 0x7B, 0xA7, 0x7B, 0xA7, 0x7B, 0xA7, 0x7C, 0x96, 0x7D, 0x96, 0x7E,
+  0x77, 0x77, 0x16, 0x77, 0x76, 0x26, 0x77, 0x76, 0x36, 0x66, 0x77, 0x36,
+  0x66, 0x77, 0x36, 0x57, 0x77, 0x46, 0x47, 0x76, 0x56, 0x47, 0x76, 0x57,
+  0x36, 0x77, 0x66, 0x36, 0x77, 0x66, 0x27, 0x76, 0x86, 0x17, 0x76, 0x86,
+  0x17, 0x67, 0x86, 0x16, 0x77, 0x9C, 0x77, 0x9C, 0x76, 0xAC, 0x76, 0xBA,
+  0x77, 0xBA, 0x77, 0xBA, 0x77, 0xC9, 0x76, 0xD9, 0x76, 0xE7, 0x77, 0xE7,
+  0x70, 0xF1, 0x9F, 0x7E, 0xF3, 0xF3, 0xEF, 0x6C, 0xF8, 0xAF, 0xA8, 0xA6,
+  0xB6, 0x9A, 0x96, 0x7D, 0x85, 0x7F, 0x08, 0x38, 0xF0, 0x83, 0x7F, 0x27,
+  0x27, 0xF3, 0x72, 0x7F, 0x37, 0x17, 0xF4, 0x71, 0x7F, 0x47, 0x17, 0xF4,
+  0x71, 0x7F, 0x4E, 0xF4, 0x71, 0x7F, 0x47, 0x17, 0xF4, 0x71, 0x7F, 0x47,
+  0x17, 0xF3, 0x72, 0x7F, 0x37, 0x27, 0xF2, 0x73, 0x8F, 0x08, 0x38, 0xF0,
+  0x75, 0x8D, 0x76, 0x9A, 0x96, 0xB6, 0xA8, 0xFA, 0xAF, 0x8C, 0xF6, 0xEF,
+  0x3F, 0x3E, 0xF7, 0x9F, 0x10, 0x7F, 0x3D, 0xF6, 0x9F, 0x88, 0xF9, 0x7F,
+  0x97, 0xFA, 0x58, 0x99, 0x57, 0xB8, 0x57, 0xC7, 0x57, 0xC7, 0x57, 0xC7,
+  0x47, 0xD7, 0x47, 0xC7, 0x57, 0xC7, 0x57, 0xB7, 0x67, 0x99, 0x5F, 0xA6,
+  0xFA, 0x6F, 0x97, 0xF8, 0x7F, 0x79, 0xF5, 0xB7, 0xF9, 0x7F, 0x97, 0xF8,
+  0x7F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0x87, 0xF9, 0x7F, 0x97, 0xF9,
+  0x7F, 0x90, 0xF1, 0x9F, 0x7E, 0xF3, 0xF3, 0xEF, 0x6C, 0xF8, 0xAF, 0xA8,
+  0xA6, 0xA7, 0x9A, 0x96, 0x8C, 0x85, 0x8E, 0x83, 0x8F, 0x08, 0x37, 0xF2,
+  0x72, 0x7F, 0x37, 0x27, 0xF3, 0x72, 0x6F, 0x47, 0x17, 0xF4, 0x71, 0x7F,
+  0x47, 0x16, 0xF5, 0xEF, 0x47, 0x17, 0xF4, 0x71, 0x7F, 0x47, 0x17, 0xF4,
+  0x71, 0x7C, 0x24, 0x72, 0x7B, 0x43, 0x72, 0x7A, 0x52, 0x73, 0x88, 0xF0,
+  0x38, 0x9D, 0x58, 0x8C, 0x69, 0x8B, 0x6B, 0x6A, 0x8F, 0xB9, 0xFA, 0xAF,
+  0xAA, 0xFA, 0xBE, 0x26, 0xE9, 0x64, 0xFF, 0x12, 0x70, 0x7F, 0x6C, 0xF8,
+  0xAF, 0x98, 0xFB, 0x7F, 0xB7, 0xFC, 0x67, 0xB9, 0x58, 0xC8, 0x57, 0xE7,
+  0x57, 0xE7, 0x57, 0xE6, 0x67, 0xE6, 0x57, 0xE7, 0x57, 0xD7, 0x67, 0xB8,
+  0x7F, 0xA8, 0xF9, 0x8F, 0x8A, 0xF8, 0xAF, 0x99, 0xFA, 0x77, 0xB8, 0x77,
+  0xC7, 0x77, 0xC7, 0x77, 0xC7, 0x77, 0xC7, 0x67, 0xD7, 0x67, 0xC7, 0x77,
+  0xC7, 0x77, 0xC7, 0x77, 0xC7, 0x67, 0xD7, 0x67, 0xD7, 0x67, 0xD7, 0x60,
+  0xE9, 0xF3, 0xF0, 0xDF, 0x3B, 0xF5, 0x9F, 0x77, 0xF9, 0x68, 0x79, 0x58,
+  0x98, 0x57, 0xB7, 0x47, 0xC7, 0x47, 0xC7, 0x47, 0xF8, 0x7F, 0x88, 0xF7,
+  0xBF, 0x4F, 0x1F, 0x0F, 0x4C, 0xF4, 0xCF, 0x5D, 0xF2, 0xF2, 0xEF, 0x5A,
+  0xF7, 0x8F, 0x87, 0xF8, 0x72, 0x7E, 0x72, 0x7E, 0x63, 0x7D, 0x73, 0x8B,
+  0x83, 0xA7, 0x95, 0xF9, 0x6F, 0x97, 0xF7, 0x9F, 0x4D, 0xF1, 0xF2, 0xAC,
+  0x1F, 0xC1, 0xFF, 0xFF, 0xFF, 0xF5, 0x1F, 0xCB, 0x7F, 0x67, 0xF6, 0x7F,
+  0x57, 0xF6, 0x7F, 0x67, 0xF6, 0x7F, 0x58, 0xF5, 0x7F, 0x67, 0xF6, 0x7F,
+  0x67, 0xF5, 0x7F, 0x67, 0xF6, 0x7F, 0x67, 0xF6, 0x7F, 0x57, 0xF6, 0x7F,
+  0x67, 0xF6, 0x7F, 0x57, 0xF6, 0x7F, 0x67, 0xF6, 0x7F, 0x67, 0xF5, 0x7F,
+  0x67, 0xF2, 0x57, 0xD7, 0x57, 0xD7, 0x57, 0xC7, 0x57, 0xD7, 0x57, 0xD7,
+  0x57, 0xD7, 0x57, 0xD7, 0x57, 0xC7, 0x57, 0xD7, 0x57, 0xD7, 0x57, 0xD7,
+  0x57, 0xD7, 0x47, 0xD7, 0x57, 0xD7, 0x57, 0xD7, 0x57, 0xD7, 0x57, 0xC7,
+  0x57, 0xD7, 0x57, 0xD7, 0x57, 0xD7, 0x57, 0xD7, 0x57, 0xC7, 0x57, 0xD7,
+  0x57, 0xD7, 0x57, 0xD7, 0x57, 0xC7, 0x67, 0xC7, 0x68, 0xA7, 0x7A, 0x69,
+  0x8F, 0x89, 0xF7, 0xBF, 0x5D, 0xF3, 0xF0, 0xF0, 0xF5, 0x9F, 0x10, 0x08,
+  0xE7, 0x27, 0xE7, 0x27, 0xD7, 0x37, 0xD7, 0x37, 0xC7, 0x47, 0xC7, 0x47,
+  0xB7, 0x57, 0xB7, 0x66, 0xA7, 0x76, 0xA6, 0x86, 0x97, 0x86, 0x96, 0x97,
+  0x77, 0x97, 0x76, 0xA7, 0x67, 0xA7, 0x66, 0xC6, 0x57, 0xC6, 0x56, 0xD6,
+  0x46, 0xE6, 0x46, 0xE6, 0x36, 0xF0, 0x63, 0x6F, 0x06, 0x26, 0xF1, 0x62,
+  0x6F, 0x2C, 0xF3, 0xCF, 0x3B, 0xF4, 0xAF, 0x5A, 0xF5, 0x9F, 0x69, 0xF7,
+  0x7F, 0x87, 0xF8, 0x6F, 0x40, 0x07, 0xA8, 0xAF, 0x0A, 0x8A, 0x71, 0x7A,
+  0x8A, 0x71, 0x79, 0x99, 0x72, 0x79, 0x99, 0x72, 0x78, 0xA8, 0x73, 0x78,
+  0xA8, 0x73, 0x77, 0xB7, 0x75, 0x67, 0xB7, 0x75, 0x67, 0x51, 0x57, 0x66,
+  0x66, 0x61, 0x56, 0x76, 0x66, 0x52, 0x56, 0x67, 0x65, 0x62, 0x55, 0x77,
+  0x65, 0x53, 0x55, 0x68, 0x65, 0x53, 0x55, 0x68, 0x64, 0x63, 0x54, 0x69,
+  0x64, 0x54, 0x54, 0x69, 0x63, 0x64, 0x53, 0x6A, 0x63, 0x55, 0x53, 0x6A,
+  0x62, 0x65, 0x52, 0x6B, 0x62, 0x56, 0x52, 0x6B, 0x62, 0x56, 0x52, 0x5C,
+  0x61, 0x57, 0x51, 0x6D, 0x51, 0x57, 0x51, 0x5E, 0xB7, 0xBE, 0xA8, 0xAF,
+  0x0A, 0x8A, 0xF0, 0x99, 0x9F, 0x19, 0x99, 0xF1, 0x8A, 0x8F, 0x28, 0xA8,
+  0xF2, 0x7B, 0x8F, 0x27, 0xB7, 0xF3, 0x7B, 0x7F, 0x10, 0x88, 0xC8, 0x99,
+  0xA8, 0xB8, 0xA8, 0xB8, 0x98, 0xD8, 0x78, 0xE8, 0x68, 0xF0, 0x85, 0x8F,
+  0x28, 0x47, 0xF3, 0x83, 0x7F, 0x57, 0x28, 0xF5, 0xF1, 0xF6, 0xF0, 0xF8,
+  0xDF, 0x9C, 0xFB, 0xAF, 0xC9, 0xFD, 0x9F, 0xD9, 0xFC, 0xAF, 0xBC, 0xFA,
+  0xCF, 0x9E, 0xF7, 0xF0, 0xF6, 0x72, 0x7F, 0x58, 0x28, 0xF3, 0x83, 0x8F,
+  0x28, 0x58, 0xF1, 0x76, 0x8F, 0x07, 0x78, 0xE8, 0x88, 0xC8, 0x98, 0xB8,
+  0xA9, 0x98, 0xC8, 0x89, 0xC9, 0x70, 0x08, 0xD7, 0x18, 0xC8, 0x18, 0xB8,
+  0x37, 0xB7, 0x48, 0x98, 0x48, 0x88, 0x67, 0x87, 0x77, 0x77, 0x88, 0x58,
+  0x97, 0x57, 0xA7, 0x47, 0xB7, 0x37, 0xD7, 0x27, 0xD7, 0x17, 0xEE, 0xF0,
+  0xEF, 0x1C, 0xF2, 0xBF, 0x3A, 0xF5, 0x9F, 0x58, 0xF6, 0x7F, 0x77, 0xF7,
+  0x7F, 0x77, 0xF6, 0x7F, 0x77, 0xF7, 0x7F, 0x77, 0xF7, 0x7F, 0x67, 0xF7,
+  0x7F, 0x77, 0xF7, 0x7F, 0x30, 0x8F, 0xA7, 0xFB, 0x7F, 0xB7, 0xFB, 0x7F,
+  0xB7, 0xFA, 0xF9, 0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8,
+  0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8, 0x9F, 0x89, 0xF8,
+  0x9F, 0x89, 0xF8, 0x8F, 0x98, 0xF9, 0x8F, 0x98, 0xF9, 0x8F, 0x98, 0xFA,
+  0xFA, 0x7F, 0xB7, 0xFB, 0x7F, 0xB7, 0xFA, 0x8F, 0xA7, 0x9C, 0x9B, 0xAB,
+  0xAB, 0x9C, 0x96, 0xF0, 0x6F, 0x06, 0xE7, 0xE6, 0xF0, 0x6F, 0x06, 0xF0,
+  0x6E, 0x7E, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xE7, 0xE6, 0xF0, 0x6F, 0x06,
+  0xE7, 0xE6, 0xF0, 0x6F, 0x06, 0xF0, 0x6E, 0x7E, 0x6F, 0x06, 0xF0, 0x6F,
+  0x06, 0xE6, 0xF0, 0x6F, 0x06, 0xF0, 0x6E, 0x7E, 0x6F, 0x0B, 0xAB, 0xAB,
+  0x9C, 0x9C, 0x90, 0x01, 0x63, 0x44, 0x34, 0x34, 0x43, 0x43, 0x43, 0x43,
+  0x43, 0x43, 0x44, 0x34, 0x34, 0x34, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+  0x44, 0x34, 0x34, 0x34, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x34,
+  0x34, 0x34, 0x34, 0x9C, 0x9C, 0x9B, 0xAB, 0xAB, 0xF0, 0x6E, 0x7E, 0x6F,
+  0x06, 0xF0, 0x6F, 0x06, 0xE6, 0xF0, 0x6F, 0x06, 0xF0, 0x6E, 0x7E, 0x6F,
+  0x06, 0xF0, 0x6F, 0x06, 0xE7, 0xE6, 0xF0, 0x6F, 0x06, 0xE7, 0xE6, 0xF0,
+  0x6F, 0x06, 0xF0, 0x6E, 0x7E, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xE7, 0xE6,
+  0xF0, 0x6F, 0x06, 0x9C, 0x9B, 0xAB, 0xAB, 0x9C, 0x90, 0xB6, 0xF0, 0x7D,
+  0x8D, 0x8C, 0x9B, 0xAB, 0xB9, 0x51, 0x69, 0x52, 0x58, 0x53, 0x57, 0x63,
+  0x57, 0x54, 0x65, 0x64, 0x65, 0x56, 0x54, 0x57, 0x53, 0x67, 0x53, 0x58,
+  0x61, 0x68, 0x61, 0x5A, 0xAB, 0x50, 0x1F, 0xFF, 0xFF, 0xA1, 0xFD, 0x10,
+  0x05, 0x34, 0x44, 0x34, 0x43, 0x44, 0x43, 0xB9, 0xDF, 0x08, 0xF3, 0x6F,
+  0x55, 0xF5, 0x47, 0x68, 0x46, 0x87, 0x46, 0x86, 0xF3, 0x7F, 0x19, 0xAF,
+  0x07, 0xF2, 0x6F, 0x45, 0xC1, 0x74, 0x95, 0x73, 0x87, 0x64, 0x78, 0x63,
+  0x78, 0x73, 0x78, 0x73, 0x77, 0x83, 0x84, 0x94, 0xF6, 0x4F, 0x65, 0xC1,
+  0x85, 0xA2, 0x87, 0x6F, 0x00, 0x77, 0xF5, 0x6F, 0x66, 0xF5, 0x7F, 0x57,
+  0xF5, 0x6F, 0x66, 0xF5, 0x7F, 0x57, 0xF5, 0x73, 0x7A, 0x62, 0xB8, 0x61,
+  0xD6, 0xF6, 0x6F, 0x75, 0xA4, 0x85, 0x87, 0x84, 0x78, 0x83, 0x7A, 0x73,
+  0x7A, 0x73, 0x6B, 0x73, 0x6B, 0x72, 0x7B, 0x72, 0x6C, 0x72, 0x6B, 0x73,
+  0x6B, 0x73, 0x6B, 0x72, 0x7A, 0x73, 0x88, 0x83, 0x87, 0x84, 0x95, 0x85,
+  0xF6, 0x5F, 0x66, 0xF5, 0x76, 0x2B, 0xF3, 0x6B, 0xB8, 0xF0, 0xCB, 0xF1,
+  0x8F, 0x36, 0xF4, 0x58, 0x58, 0x37, 0x87, 0x36, 0x97, 0x27, 0x97, 0x26,
+  0xF3, 0x7F, 0x37, 0xF3, 0x6F, 0x37, 0xF3, 0x7F, 0x37, 0xF3, 0x7F, 0x37,
+  0x97, 0x27, 0x97, 0x28, 0x77, 0x48, 0x57, 0x5F, 0x56, 0xF3, 0x8F, 0x1A,
+  0xDE, 0x8B, 0xF7, 0x7F, 0x77, 0xF7, 0x6F, 0x86, 0xF7, 0x7F, 0x77, 0xF7,
+  0x7F, 0x76, 0xF7, 0x7C, 0x73, 0x7A, 0xA2, 0x79, 0xC1, 0x68, 0xF6, 0x7F,
+  0x77, 0x84, 0xA6, 0x86, 0x95, 0x88, 0x76, 0x79, 0x75, 0x7B, 0x65, 0x7B,
+  0x65, 0x7A, 0x74, 0x7B, 0x65, 0x7B, 0x65, 0x7B, 0x65, 0x7B, 0x65, 0x7A,
+  0x66, 0x79, 0x76, 0x79, 0x76, 0x87, 0x87, 0x84, 0xA7, 0xF6, 0x8F, 0x69,
+  0xF5, 0xAA, 0x27, 0xC6, 0xF3, 0xB7, 0xF0, 0xDB, 0xF0, 0x8F, 0x36, 0xF5,
+  0x58, 0x48, 0x47, 0x78, 0x27, 0x97, 0x27, 0x97, 0x17, 0xA7, 0x17, 0xA7,
+  0x1F, 0x91, 0xFF, 0xFF, 0xD1, 0x7F, 0x37, 0xF3, 0x7F, 0x37, 0x97, 0x28,
+  0x77, 0x48, 0x58, 0x4F, 0x56, 0xF3, 0x8F, 0x0B, 0xDF, 0x07, 0xB0, 0xB7,
+  0x99, 0x89, 0x8A, 0x8A, 0x77, 0xB7, 0xB6, 0xC6, 0xB7, 0x8E, 0x3E, 0x4E,
+  0x4E, 0x77, 0xB7, 0xB7, 0xB6, 0xC6, 0xB7, 0xB7, 0xB6, 0xC6, 0xB7, 0xB7,
+  0xB7, 0xB6, 0xC6, 0xB7, 0xB7, 0xB7, 0xB6, 0xC6, 0xB7, 0xB0, 0xD5, 0x47,
+  0xAA, 0x26, 0xAC, 0x16, 0x9F, 0x58, 0xF6, 0x78, 0x4A, 0x68, 0x77, 0x77,
+  0x87, 0x67, 0x97, 0x67, 0xA6, 0x57, 0xB6, 0x57, 0xB5, 0x66, 0xC5, 0x57,
+  0xB6, 0x57, 0xB6, 0x57, 0xB5, 0x67, 0xA6, 0x67, 0xA6, 0x67, 0x97, 0x68,
+  0x78, 0x69, 0x49, 0x8F, 0x68, 0xF6, 0x9D, 0x16, 0xAA, 0x27, 0xC6, 0x46,
+  0xF8, 0x6F, 0x77, 0x67, 0x96, 0x77, 0x87, 0x78, 0x58, 0x8F, 0x5A, 0xF3,
+  0xCF, 0x0F, 0x29, 0xF0, 0x77, 0xF5, 0x7F, 0x56, 0xF6, 0x6F, 0x57, 0xF5,
+  0x7F, 0x57, 0xF5, 0x6F, 0x66, 0xF5, 0x75, 0x69, 0x72, 0xB7, 0x71, 0xD6,
+  0xF7, 0x5F, 0x74, 0xA5, 0x84, 0x88, 0x74, 0x79, 0x74, 0x79, 0x73, 0x7A,
+  0x64, 0x7A, 0x64, 0x79, 0x74, 0x6A, 0x74, 0x6A, 0x73, 0x7A, 0x64, 0x7A,
+  0x64, 0x79, 0x74, 0x6A, 0x74, 0x6A, 0x73, 0x7A, 0x64, 0x7A, 0x64, 0x79,
+  0x74, 0x6A, 0x73, 0x7A, 0x73, 0x7A, 0x64, 0x77, 0x77, 0x76, 0x86, 0x77,
+  0x77, 0xFF, 0xF3, 0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x68, 0x67,
+  0x77, 0x77, 0x77, 0x67, 0x77, 0x77, 0x77, 0x68, 0x67, 0x77, 0x77, 0x77,
+  0x68, 0x67, 0x77, 0x77, 0xC7, 0xC7, 0xC7, 0xC6, 0xD6, 0xC7, 0xFF, 0xFF,
+  0x96, 0xC7, 0xC7, 0xC7, 0xC6, 0xC7, 0xC7, 0xC7, 0xC6, 0xD6, 0xC7, 0xC7,
+  0xC7, 0xC6, 0xD6, 0xC7, 0xC7, 0xC7, 0xC6, 0xD6, 0xC7, 0xC7, 0xC6, 0xD6,
+  0xC7, 0xC7, 0xC7, 0xC6, 0xD6, 0xC7, 0x9A, 0x99, 0xA9, 0x99, 0xA6, 0xD0,
+  0x77, 0xF6, 0x6F, 0x76, 0xF6, 0x7F, 0x67, 0xF6, 0x6F, 0x76, 0xF6, 0x7F,
+  0x67, 0xF6, 0x78, 0x76, 0x67, 0x87, 0x66, 0x87, 0x75, 0x88, 0x74, 0x7A,
+  0x73, 0x7B, 0x63, 0x7C, 0x62, 0x7C, 0x71, 0x7D, 0xEE, 0xEE, 0xED, 0xF1,
+  0xCF, 0x1C, 0x91, 0x7B, 0x82, 0x7B, 0x64, 0x7A, 0x75, 0x79, 0x75, 0x79,
+  0x75, 0x88, 0x67, 0x78, 0x67, 0x77, 0x77, 0x86, 0x78, 0x76, 0x69, 0x85,
+  0x77, 0x77, 0x76, 0x86, 0x77, 0x77, 0x77, 0x76, 0x86, 0x77, 0x77, 0x77,
+  0x76, 0x77, 0x77, 0x77, 0x76, 0x86, 0x77, 0x77, 0x77, 0x76, 0x77, 0x77,
+  0x77, 0x76, 0x86, 0x77, 0x77, 0x77, 0x76, 0x86, 0x77, 0x77, 0x70, 0x57,
+  0x46, 0x86, 0x96, 0x3A, 0x4A, 0x76, 0x1C, 0x2D, 0x5F, 0xF6, 0x4F, 0xF6,
+  0x49, 0x4B, 0x48, 0x47, 0x78, 0x77, 0x47, 0x77, 0x87, 0x37, 0x87, 0x86,
+  0x47, 0x86, 0x96, 0x47, 0x86, 0x87, 0x46, 0x87, 0x87, 0x37, 0x87, 0x86,
+  0x47, 0x87, 0x86, 0x47, 0x86, 0x87, 0x46, 0x96, 0x87, 0x46, 0x87, 0x87,
+  0x37, 0x87, 0x86, 0x47, 0x87, 0x86, 0x47, 0x86, 0x87, 0x46, 0x87, 0x87,
+  0x46, 0x87, 0x87, 0x37, 0x87, 0x86, 0x47, 0x86, 0x96, 0x47, 0x86, 0x87,
+  0x40, 0x57, 0x47, 0x97, 0x2B, 0x76, 0x2D, 0x6F, 0x74, 0xF8, 0x4A, 0x58,
+  0x48, 0x87, 0x47, 0x97, 0x47, 0x97, 0x37, 0xA6, 0x47, 0xA6, 0x46, 0xA7,
+  0x46, 0xA7, 0x37, 0xA7, 0x37, 0xA6, 0x47, 0xA6, 0x46, 0xA7, 0x46, 0xA7,
+  0x37, 0xA7, 0x37, 0xA6, 0x47, 0xA6, 0x46, 0xA7, 0x37, 0xA7, 0x37, 0xA7,
+  0x37, 0xA6, 0x40, 0xB8, 0xF1, 0xDB, 0xF1, 0x9F, 0x37, 0xF5, 0x58, 0x58,
+  0x48, 0x78, 0x28, 0x88, 0x27, 0xA7, 0x17, 0xB7, 0x17, 0xB7, 0x17, 0xBE,
+  0xCE, 0xCE, 0xB7, 0x17, 0xB7, 0x17, 0xB7, 0x17, 0xA7, 0x28, 0x88, 0x28,
+  0x78, 0x48, 0x58, 0x5F, 0x57, 0xF3, 0x9F, 0x1B, 0xDF, 0x17, 0xC0, 0x77,
+  0x46, 0xC6, 0x2B, 0xA6, 0x1D, 0x8F, 0x68, 0xF7, 0x7A, 0x48, 0x78, 0x78,
+  0x58, 0x88, 0x57, 0xA7, 0x57, 0xA7, 0x56, 0xB7, 0x56, 0xB7, 0x47, 0xB7,
+  0x47, 0xB7, 0x46, 0xB7, 0x56, 0xB7, 0x47, 0xB7, 0x47, 0xA7, 0x58, 0x88,
+  0x58, 0x78, 0x6A, 0x48, 0x6F, 0x86, 0xF7, 0x77, 0x1D, 0x86, 0x3A, 0xA6,
+  0x47, 0xB7, 0xF7, 0x7F, 0x77, 0xF7, 0x6F, 0x77, 0xF7, 0x7F, 0x77, 0xF7,
+  0x6F, 0x86, 0xF8, 0xB6, 0x47, 0x8B, 0x27, 0x7D, 0x16, 0x7E, 0x16, 0x6F,
+  0x75, 0x85, 0xA4, 0x87, 0x93, 0x88, 0x84, 0x7A, 0x73, 0x7B, 0x73, 0x7B,
+  0x73, 0x7B, 0x63, 0x7C, 0x63, 0x7B, 0x73, 0x7B, 0x73, 0x7B, 0x73, 0x7A,
+  0x74, 0x7A, 0x74, 0x79, 0x84, 0x87, 0x95, 0x84, 0xB5, 0xF7, 0x7E, 0x16,
+  0x7D, 0x17, 0x8B, 0x27, 0xA7, 0x46, 0xF7, 0x6F, 0x67, 0xF6, 0x7F, 0x67,
+  0xF6, 0x6F, 0x76, 0xF6, 0x7F, 0x67, 0xF6, 0x77, 0x57, 0x44, 0x57, 0x26,
+  0x56, 0x26, 0x66, 0x17, 0x5F, 0x05, 0xF0, 0x5A, 0xA8, 0xC7, 0xC7, 0xD7,
+  0xD6, 0xE6, 0xD7, 0xD7, 0xD7, 0xD6, 0xE6, 0xD7, 0xD7, 0xD7, 0xD6, 0xD7,
+  0xD7, 0xD7, 0xD0, 0xB8, 0xDD, 0x9F, 0x17, 0xF3, 0x5F, 0x54, 0x75, 0x83,
+  0x77, 0x73, 0x77, 0x73, 0x8F, 0x1B, 0xDF, 0x0A, 0xF1, 0x9F, 0x19, 0xF1,
+  0xBE, 0xDB, 0xF0, 0x9F, 0x27, 0x16, 0xA7, 0x17, 0x97, 0x18, 0x68, 0x3F,
+  0x54, 0xF5, 0x5F, 0x28, 0xF0, 0xC9, 0x90, 0x66, 0x77, 0x77, 0x77, 0x76,
+  0x77, 0x77, 0x4D, 0x1D, 0x1F, 0xC3, 0x77, 0x77, 0x68, 0x67, 0x77, 0x77,
+  0x77, 0x68, 0x67, 0x77, 0x77, 0x68, 0x67, 0x77, 0x77, 0x77, 0xA4, 0xA4,
+  0xA5, 0x96, 0x75, 0x46, 0xA7, 0x46, 0xA7, 0x37, 0xA6, 0x47, 0x97, 0x47,
+  0x97, 0x46, 0xA7, 0x46, 0xA6, 0x47, 0xA6, 0x47, 0x97, 0x47, 0x97, 0x46,
+  0xA7, 0x46, 0xA6, 0x47, 0xA6, 0x47, 0x97, 0x46, 0xA7, 0x46, 0xA6, 0x47,
+  0xA6, 0x47, 0x97, 0x47, 0x88, 0x47, 0x79, 0x48, 0x59, 0x5F, 0x75, 0xF7,
+  0x6D, 0x17, 0x7B, 0x27, 0x96, 0xF2, 0x07, 0xA7, 0x17, 0xA7, 0x17, 0x97,
+  0x36, 0x97, 0x36, 0x87, 0x46, 0x86, 0x57, 0x67, 0x57, 0x66, 0x67, 0x57,
+  0x67, 0x56, 0x86, 0x47, 0x86, 0x46, 0x96, 0x37, 0x96, 0x36, 0xA6, 0x26,
+  0xB6, 0x26, 0xB6, 0x16, 0xD5, 0x16, 0xDB, 0xEB, 0xEA, 0xF0, 0x9F, 0x19,
+  0xF1, 0x8F, 0x28, 0xE0, 0x07, 0x77, 0x7E, 0x77, 0x7E, 0x68, 0x76, 0x17,
+  0x68, 0x67, 0x17, 0x59, 0x66, 0x27, 0x59, 0x57, 0x27, 0x59, 0x56, 0x46,
+  0x4A, 0x47, 0x46, 0x44, 0x15, 0x46, 0x56, 0x35, 0x15, 0x37, 0x56, 0x35,
+  0x15, 0x36, 0x66, 0x34, 0x25, 0x36, 0x66, 0x25, 0x25, 0x26, 0x76, 0x24,
+  0x35, 0x26, 0x76, 0x15, 0x35, 0x16, 0x86, 0x14, 0x45, 0x16, 0x86, 0x14,
+  0x4B, 0x9B, 0x4B, 0x9A, 0x5A, 0xAA, 0x5A, 0xA9, 0x69, 0xC8, 0x69, 0xC8,
+  0x68, 0xD7, 0x78, 0xD7, 0x77, 0xC0, 0x68, 0x78, 0x68, 0x68, 0x87, 0x67,
+  0x97, 0x57, 0xA8, 0x37, 0xC7, 0x27, 0xD7, 0x27, 0xEE, 0xF0, 0xDF, 0x2B,
+  0xF3, 0xAF, 0x49, 0xF6, 0x7F, 0x69, 0xF4, 0xAF, 0x3C, 0xF1, 0xDF, 0x07,
+  0x17, 0xD7, 0x27, 0xC8, 0x28, 0xB7, 0x47, 0xA7, 0x57, 0x98, 0x58, 0x78,
+  0x77, 0x68, 0x88, 0x50, 0x47, 0xB6, 0x57, 0xA7, 0x57, 0xA6, 0x67, 0x97,
+  0x67, 0x96, 0x87, 0x77, 0x87, 0x76, 0x97, 0x66, 0xA7, 0x66, 0xA7, 0x56,
+  0xB7, 0x56, 0xB7, 0x46, 0xD6, 0x46, 0xD6, 0x36, 0xE6, 0x35, 0xF0, 0x71,
+  0x6F, 0x07, 0x15, 0xF1, 0xDF, 0x1C, 0xF3, 0xBF, 0x3A, 0xF4, 0x9F, 0x59,
+  0xF5, 0x8F, 0x68, 0xF6, 0x7F, 0x77, 0xF7, 0x6F, 0x76, 0xF7, 0x7F, 0x3A,
+  0xF3, 0xBF, 0x3A, 0xF4, 0x8F, 0x66, 0xF8, 0x6F, 0x56, 0xF5, 0x6F, 0x46,
+  0xF5, 0x6F, 0x5F, 0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x8F,
+  0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x8F, 0x28, 0xF2, 0x8F,
+  0x28, 0xF2, 0xF6, 0x5F, 0x65, 0xF6, 0x4F, 0x65, 0xF6, 0x50, 0xC6, 0xA8,
+  0x99, 0x98, 0x99, 0x95, 0xD5, 0xC6, 0xC5, 0xD5, 0xD5, 0xD5, 0xC5, 0xD5,
+  0xD5, 0xD5, 0xC6, 0xC5, 0xD5, 0xC6, 0x98, 0xA6, 0xC6, 0xB8, 0xC6, 0xD5,
+  0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xC5, 0xD5, 0xD5, 0xD5, 0xC5, 0xD5, 0xD5,
+  0xD8, 0xA8, 0xA8, 0xB7, 0xC6, 0x90, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94,
+  0x94, 0x93, 0x94, 0x94, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94, 0x94, 0x84,
+  0x94, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94,
+  0x94, 0x93, 0x94, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94, 0x94, 0x93, 0x94,
+  0x94, 0x90, 0x96, 0xC7, 0xB7, 0xB8, 0xA8, 0xD5, 0xD5, 0xD5, 0xC5, 0xD5,
+  0xD5, 0xD5, 0xC5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xC8, 0xB6, 0xC6,
+  0xA8, 0x96, 0xC5, 0xD5, 0xC5, 0xD5, 0xD5, 0xD5, 0xD5, 0xC5, 0xD5, 0xD5,
+  0xD5, 0xC6, 0xC5, 0xD5, 0x99, 0x98, 0x99, 0x98, 0xA6, 0xC0, 0x45, 0xF0,
+  0x9C, 0xB6, 0x41, 0xC5, 0x85, 0xC1, 0x37, 0xBC, 0x9E, 0x64 };
 
 const GFXglyph FreeSansBoldOblique24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  13,    0,    1 },   // 0x20 ' '
   {     0,  14,  34,  16,    5,  -33 },   // 0x21 '!'
-  {    60,  18,  12,  22,    8,  -33 },   // 0x22 '"'
-  {    87,  29,  33,  26,    2,  -31 },   // 0x23 '#'
-  {   207,  26,  42,  26,    3,  -35 },   // 0x24 '$'
-  {   344,  36,  34,  42,    6,  -32 },   // 0x25 '%'
-  {   497,  29,  35,  34,    4,  -33 },   // 0x26 '&'
-  {   624,   7,  12,  11,    8,  -33 },   // 0x27 '''
-  {   635,  17,  44,  16,    4,  -33 },   // 0x28 '('
-  {   729,  17,  44,  16,    0,  -34 },   // 0x29 ')'
-  {   823,  15,  15,  18,    7,  -33 },   // 0x2A '*'
-  {   852,  24,  22,  27,    4,  -21 },   // 0x2B '+'
-  {   918,  10,  15,  13,    1,   -6 },   // 0x2C ','
-  {   937,  14,   6,  16,    3,  -15 },   // 0x2D '-'
-  {   948,   8,   7,  13,    3,   -6 },   // 0x2E '.'
-  {   955,  20,  34,  13,    0,  -32 },   // 0x2F '/'
-  {  1040,  25,  35,  26,    4,  -33 },   // 0x30 '0'
-  {  1150,  17,  33,  26,    8,  -32 },   // 0x31 '1'
-  {  1221,  29,  34,  26,    1,  -33 },   // 0x32 '2'
-  {  1345,  26,  35,  26,    3,  -33 },   // 0x33 '3'
-  {  1459,  25,  32,  26,    3,  -31 },   // 0x34 '4'
-  {  1559,  27,  34,  26,    3,  -32 },   // 0x35 '5'
-  {  1674,  25,  35,  26,    4,  -33 },   // 0x36 '6'
-  {  1784,  26,  33,  26,    6,  -32 },   // 0x37 '7'
-  {  1892,  26,  35,  26,    3,  -33 },   // 0x38 '8'
-  {  2006,  25,  35,  26,    4,  -33 },   // 0x39 '9'
-  {  2116,  12,  25,  16,    5,  -24 },   // 0x3A ':'
-  {  2154,  14,  33,  16,    3,  -24 },   // 0x3B ';'
-  {  2212,  26,  23,  27,    4,  -22 },   // 0x3C '<'
-  {  2287,  26,  18,  27,    3,  -19 },   // 0x3D '='
-  {  2346,  26,  23,  27,    1,  -21 },   // 0x3E '>'
-  {  2421,  24,  35,  29,    8,  -34 },   // 0x3F '?'
-  {  2526,  45,  41,  46,    3,  -34 },   // 0x40 '@'
-  {  2757,  32,  34,  34,    1,  -33 },   // 0x41 'A'
-  {  2893,  32,  34,  34,    4,  -33 },   // 0x42 'B'
-  {  3029,  32,  36,  34,    5,  -34 },   // 0x43 'C'
-  {  3173,  32,  34,  34,    4,  -33 },   // 0x44 'D'
-  {  3309,  32,  34,  31,    4,  -33 },   // 0x45 'E'
-  {  3445,  32,  34,  29,    3,  -33 },   // 0x46 'F'
-  {  3581,  33,  36,  37,    5,  -34 },   // 0x47 'G'
-  {  3730,  35,  34,  34,    3,  -33 },   // 0x48 'H'
-  {  3879,  14,  34,  13,    3,  -33 },   // 0x49 'I'
-  {  3939,  27,  35,  26,    3,  -33 },   // 0x4A 'J'
-  {  4058,  37,  34,  34,    3,  -33 },   // 0x4B 'K'
-  {  4216,  24,  34,  29,    4,  -33 },   // 0x4C 'L'
-  {  4318,  41,  34,  39,    3,  -33 },   // 0x4D 'M'
-  {  4493,  35,  34,  34,    3,  -33 },   // 0x4E 'N'
-  {  4642,  34,  36,  37,    5,  -34 },   // 0x4F 'O'
-  {  4795,  31,  34,  31,    4,  -33 },   // 0x50 'P'
-  {  4927,  34,  37,  37,    5,  -34 },   // 0x51 'Q'
-  {  5085,  33,  34,  34,    4,  -33 },   // 0x52 'R'
-  {  5226,  30,  36,  31,    4,  -34 },   // 0x53 'S'
-  {  5361,  28,  34,  29,    7,  -33 },   // 0x54 'T'
-  {  5480,  32,  35,  34,    6,  -33 },   // 0x55 'U'
-  {  5620,  30,  34,  31,    8,  -33 },   // 0x56 'V'
-  {  5748,  43,  34,  44,    8,  -33 },   // 0x57 'W'
-  {  5931,  37,  34,  31,    1,  -33 },   // 0x58 'X'
-  {  6089,  29,  34,  31,    9,  -33 },   // 0x59 'Y'
-  {  6213,  33,  34,  29,    1,  -33 },   // 0x5A 'Z'
-  {  6354,  21,  43,  16,    1,  -33 },   // 0x5B '['
-  {  6467,   7,  36,  13,    6,  -34 },   // 0x5C '\'
-  {  6499,  21,  43,  16,   -1,  -33 },   // 0x5D ']'
-  {  6612,  21,  20,  27,    6,  -32 },   // 0x5E '^'
-  {  6665,  29,   4,  26,   -3,    6 },   // 0x5F '_'
-  {  6680,   7,   7,  16,    8,  -35 },   // 0x60 '`'
-  {  6687,  25,  26,  26,    2,  -24 },   // 0x61 'a'
-  {  6769,  27,  35,  29,    3,  -33 },   // 0x62 'b'
-  {  6888,  25,  26,  26,    4,  -24 },   // 0x63 'c'
-  {  6970,  29,  35,  29,    4,  -33 },   // 0x64 'd'
-  {  7097,  25,  26,  26,    3,  -24 },   // 0x65 'e'
-  {  7179,  18,  34,  16,    4,  -33 },   // 0x66 'f'
-  {  7256,  29,  35,  29,    2,  -24 },   // 0x67 'g'
-  {  7383,  27,  34,  29,    3,  -33 },   // 0x68 'h'
-  {  7498,  14,  34,  13,    3,  -33 },   // 0x69 'i'
-  {  7558,  19,  44,  13,   -2,  -33 },   // 0x6A 'j'
-  {  7663,  28,  34,  26,    3,  -33 },   // 0x6B 'k'
-  {  7782,  14,  34,  13,    3,  -33 },   // 0x6C 'l'
-  {  7842,  40,  25,  42,    3,  -24 },   // 0x6D 'm'
-  {  7967,  27,  25,  29,    3,  -24 },   // 0x6E 'n'
-  {  8052,  26,  26,  29,    4,  -24 },   // 0x6F 'o'
-  {  8137,  29,  35,  29,    1,  -24 },   // 0x70 'p'
-  {  8264,  28,  35,  29,    3,  -24 },   // 0x71 'q'
-  {  8387,  20,  25,  18,    3,  -24 },   // 0x72 'r'
-  {  8450,  24,  26,  26,    3,  -24 },   // 0x73 's'
-  {  8528,  14,  32,  16,    5,  -30 },   // 0x74 't'
-  {  8584,  27,  26,  29,    4,  -24 },   // 0x75 'u'
-  {  8672,  25,  25,  26,    6,  -24 },   // 0x76 'v'
-  {  8751,  35,  25,  37,    6,  -24 },   // 0x77 'w'
-  {  8861,  29,  25,  26,    1,  -24 },   // 0x78 'x'
-  {  8952,  29,  35,  26,    2,  -24 },   // 0x79 'y'
-  {  9079,  26,  25,  23,    1,  -24 },   // 0x7A 'z'
-  {  9161,  18,  43,  18,    4,  -33 },   // 0x7B '{'
-  {  9258,  13,  43,  13,    3,  -33 },   // 0x7C '|'
-  {  9328,  18,  43,  18,    2,  -33 },   // 0x7D '}'
-  {  9425,  22,   8,  27,    5,  -14 } }; // 0x7E '~'
+  {    34,  18,  12,  22,    8,  -33 },   // 0x22 '"'
+  {    58,  29,  33,  26,    2,  -31 },   // 0x23 '#'
+  {   120,  26,  42,  26,    3,  -35 },   // 0x24 '$'
+  {   201,  36,  34,  42,    6,  -32 },   // 0x25 '%'
+  {   290,  29,  35,  34,    4,  -33 },   // 0x26 '&'
+  {   358,   7,  12,  11,    8,  -33 },   // 0x27 '''
+  {   370,  17,  44,  16,    4,  -33 },   // 0x28 '('
+  {   415,  17,  44,  16,    0,  -34 },   // 0x29 ')'
+  {   460,  15,  15,  18,    7,  -33 },   // 0x2A '*'
+  {   481,  24,  22,  27,    4,  -21 },   // 0x2B '+'
+  {   514,  10,  15,  13,    1,   -6 },   // 0x2C ','
+  {   530,  14,   6,  16,    3,  -15 },   // 0x2D '-'
+  {   537,   8,   7,  13,    3,   -6 },   // 0x2E '.'
+  {   545,  20,  34,  13,    0,  -32 },   // 0x2F '/'
+  {   597,  25,  35,  26,    4,  -33 },   // 0x30 '0'
+  {   661,  17,  33,  26,    8,  -32 },   // 0x31 '1'
+  {   696,  29,  34,  26,    1,  -33 },   // 0x32 '2'
+  {   752,  26,  35,  26,    3,  -33 },   // 0x33 '3'
+  {   808,  25,  32,  26,    3,  -31 },   // 0x34 '4'
+  {   863,  27,  34,  26,    3,  -32 },   // 0x35 '5'
+  {   918,  25,  35,  26,    4,  -33 },   // 0x36 '6'
+  {   978,  26,  33,  26,    6,  -32 },   // 0x37 '7'
+  {  1029,  26,  35,  26,    3,  -33 },   // 0x38 '8'
+  {  1090,  25,  35,  26,    4,  -33 },   // 0x39 '9'
+  {  1150,  12,  25,  16,    5,  -24 },   // 0x3A ':'
+  {  1169,  14,  33,  16,    3,  -24 },   // 0x3B ';'
+  {  1197,  26,  23,  27,    4,  -22 },   // 0x3C '<'
+  {  1230,  26,  18,  27,    3,  -19 },   // 0x3D '='
+  {  1254,  26,  23,  27,    1,  -21 },   // 0x3E '>'
+  {  1287,  24,  35,  29,    8,  -34 },   // 0x3F '?'
+  {  1336,  45,  41,  46,    3,  -34 },   // 0x40 '@'
+  {  1460,  32,  34,  34,    1,  -33 },   // 0x41 'A'
+  {  1525,  32,  34,  34,    4,  -33 },   // 0x42 'B'
+  {  1585,  32,  36,  34,    5,  -34 },   // 0x43 'C'
+  {  1648,  32,  34,  34,    4,  -33 },   // 0x44 'D'
+  {  1712,  32,  34,  31,    4,  -33 },   // 0x45 'E'
+  {  1764,  32,  34,  29,    3,  -33 },   // 0x46 'F'
+  {  1816,  33,  36,  37,    5,  -34 },   // 0x47 'G'
+  {  1887,  35,  34,  34,    3,  -33 },   // 0x48 'H'
+  {  1953,  14,  34,  13,    3,  -33 },   // 0x49 'I'
+  {  1988,  27,  35,  26,    3,  -33 },   // 0x4A 'J'
+  {  2045,  37,  34,  34,    3,  -33 },   // 0x4B 'K'
+  {  2119,  24,  34,  29,    4,  -33 },   // 0x4C 'L'
+  {  2169,  41,  34,  39,    3,  -33 },   // 0x4D 'M'
+  {  2283,  35,  34,  34,    3,  -33 },   // 0x4E 'N'
+  {  2365,  34,  36,  37,    5,  -34 },   // 0x4F 'O'
+  {  2441,  31,  34,  31,    4,  -33 },   // 0x50 'P'
+  {  2498,  34,  37,  37,    5,  -34 },   // 0x51 'Q'
+  {  2577,  33,  34,  34,    4,  -33 },   // 0x52 'R'
+  {  2640,  30,  36,  31,    4,  -34 },   // 0x53 'S'
+  {  2700,  28,  34,  29,    7,  -33 },   // 0x54 'T'
+  {  2750,  32,  35,  34,    6,  -33 },   // 0x55 'U'
+  {  2819,  30,  34,  31,    8,  -33 },   // 0x56 'V'
+  {  2885,  43,  34,  44,    8,  -33 },   // 0x57 'W'
+  {  2997,  37,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  3066,  29,  34,  31,    9,  -33 },   // 0x59 'Y'
+  {  3125,  33,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  3177,  21,  43,  16,    1,  -33 },   // 0x5B '['
+  {  3231,   7,  36,  13,    6,  -34 },   // 0x5C '\'
+  {  3267,  21,  43,  16,   -1,  -33 },   // 0x5D ']'
+  {  3321,  21,  20,  27,    6,  -32 },   // 0x5E '^'
+  {  3354,  29,   4,  26,   -3,    6 },   // 0x5F '_'
+  {  3360,   7,   7,  16,    8,  -35 },   // 0x60 '`'
+  {  3367,  25,  26,  26,    2,  -24 },   // 0x61 'a'
+  {  3413,  27,  35,  29,    3,  -33 },   // 0x62 'b'
+  {  3476,  25,  26,  26,    4,  -24 },   // 0x63 'c'
+  {  3518,  29,  35,  29,    4,  -33 },   // 0x64 'd'
+  {  3581,  25,  26,  26,    3,  -24 },   // 0x65 'e'
+  {  3623,  18,  34,  16,    4,  -33 },   // 0x66 'f'
+  {  3658,  29,  35,  29,    2,  -24 },   // 0x67 'g'
+  {  3724,  27,  34,  29,    3,  -33 },   // 0x68 'h'
+  {  3787,  14,  34,  13,    3,  -33 },   // 0x69 'i'
+  {  3820,  19,  44,  13,   -2,  -33 },   // 0x6A 'j'
+  {  3864,  28,  34,  26,    3,  -33 },   // 0x6B 'k'
+  {  3924,  14,  34,  13,    3,  -33 },   // 0x6C 'l'
+  {  3959,  40,  25,  42,    3,  -24 },   // 0x6D 'm'
+  {  4033,  27,  25,  29,    3,  -24 },   // 0x6E 'n'
+  {  4083,  26,  26,  29,    4,  -24 },   // 0x6F 'o'
+  {  4127,  29,  35,  29,    1,  -24 },   // 0x70 'p'
+  {  4191,  28,  35,  29,    3,  -24 },   // 0x71 'q'
+  {  4256,  20,  25,  18,    3,  -24 },   // 0x72 'r'
+  {  4287,  24,  26,  26,    3,  -24 },   // 0x73 's'
+  {  4327,  14,  32,  16,    5,  -30 },   // 0x74 't'
+  {  4359,  27,  26,  29,    4,  -24 },   // 0x75 'u'
+  {  4410,  25,  25,  26,    6,  -24 },   // 0x76 'v'
+  {  4456,  35,  25,  37,    6,  -24 },   // 0x77 'w'
+  {  4530,  29,  25,  26,    1,  -24 },   // 0x78 'x'
+  {  4576,  29,  35,  26,    2,  -24 },   // 0x79 'y'
+  {  4639,  26,  25,  23,    1,  -24 },   // 0x7A 'z'
+  {  4678,  18,  43,  18,    4,  -33 },   // 0x7B '{'
+  {  4722,  13,  43,  13,    3,  -33 },   // 0x7C '|'
+  {  4766,  18,  43,  18,    2,  -33 },   // 0x7D '}'
+  {  4810,  22,   8,  27,    5,  -14 } }; // 0x7E '~'
 
 const GFXfont FreeSansBoldOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeSansBoldOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56, 1,
+  NULL, 0, 1 };
 
-// Approx. 10119 bytes
+// Approx. 5494 bytes
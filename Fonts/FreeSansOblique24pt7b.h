@@ -1,840 +1,524 @@
 const uint8_t FreeSansOblique24pt7bBitmaps[] PROGMEM = {
-  0x01, 0xE0, 0x3C, 0x0F, 0x81, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x3C, 0x07,
-  0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03,
-  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x18, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x07, 0x80, 0xF0, 0x1E, 0x00, 0x78,
-  0x7B, 0xC3, 0xDE, 0x1F, 0xE1, 0xEF, 0x0F, 0x78, 0x7B, 0xC3, 0xDC, 0x1C,
-  0xE0, 0xE7, 0x07, 0x30, 0x31, 0x81, 0x80, 0x00, 0x07, 0x81, 0xC0, 0x00,
-  0x78, 0x3C, 0x00, 0x07, 0x03, 0xC0, 0x00, 0xF0, 0x38, 0x00, 0x0E, 0x07,
-  0x80, 0x01, 0xE0, 0x70, 0x00, 0x1E, 0x0F, 0x00, 0x01, 0xC0, 0xF0, 0x00,
-  0x3C, 0x0E, 0x00, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-  0xFE, 0x00, 0x70, 0x3C, 0x00, 0x0F, 0x03, 0x80, 0x00, 0xF0, 0x78, 0x00,
-  0x0E, 0x07, 0x80, 0x01, 0xE0, 0x70, 0x00, 0x1C, 0x0F, 0x00, 0x03, 0xC0,
-  0xE0, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0x81, 0xE0, 0x0F, 0xFF, 0xFF, 0xE0,
-  0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xE0, 0x0F, 0x03, 0x80, 0x00, 0xE0,
-  0x78, 0x00, 0x1E, 0x07, 0x00, 0x01, 0xC0, 0xF0, 0x00, 0x1C, 0x0F, 0x00,
-  0x03, 0xC0, 0xE0, 0x00, 0x38, 0x1E, 0x00, 0x07, 0x81, 0xC0, 0x00, 0x78,
-  0x3C, 0x00, 0x07, 0x03, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x30,
-  0x00, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0x7F,
-  0xFF, 0xE0, 0x1F, 0x18, 0xF8, 0x0F, 0x8E, 0x1F, 0x07, 0xC3, 0x83, 0xC1,
-  0xE0, 0xE0, 0xF0, 0x70, 0x38, 0x3C, 0x3C, 0x0C, 0x0F, 0x0F, 0x07, 0x00,
-  0x03, 0xC1, 0xC0, 0x00, 0xF0, 0x70, 0x00, 0x3E, 0x1C, 0x00, 0x0F, 0xE6,
-  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-  0x3F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xC7, 0xF0, 0x00, 0x70, 0x7C,
-  0x00, 0x1C, 0x0F, 0x00, 0x06, 0x03, 0xCF, 0x03, 0x80, 0xF3, 0xC0, 0xE0,
-  0x3C, 0xF0, 0x38, 0x0E, 0x3C, 0x0E, 0x07, 0x8F, 0x03, 0x01, 0xE3, 0xE1,
-  0xC0, 0xF0, 0xF8, 0x70, 0x78, 0x1F, 0x9C, 0xFC, 0x03, 0xFF, 0xFE, 0x00,
-  0x7F, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x80, 0x1F, 0x00, 0x00, 0x70, 0x07, 0xFC, 0x00, 0x0E,
-  0x00, 0xFF, 0xE0, 0x01, 0xC0, 0x1E, 0x1E, 0x00, 0x3C, 0x03, 0x80, 0xF0,
-  0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0,
-  0x07, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x3C, 0x00, 0xE0, 0x0E, 0x03, 0x80,
-  0x0E, 0x00, 0xE0, 0x70, 0x00, 0xF0, 0x1C, 0x0E, 0x00, 0x07, 0x87, 0xC1,
-  0xE0, 0x00, 0x7F, 0xF8, 0x1C, 0x00, 0x03, 0xFE, 0x03, 0x80, 0x00, 0x0F,
-  0x80, 0x70, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x1F,
-  0x00, 0x00, 0x1C, 0x07, 0xFC, 0x00, 0x03, 0x80, 0xFF, 0xE0, 0x00, 0x70,
-  0x1E, 0x1E, 0x00, 0x0F, 0x03, 0x80, 0xF0, 0x00, 0xE0, 0x70, 0x07, 0x00,
-  0x1C, 0x07, 0x00, 0x70, 0x03, 0x80, 0xE0, 0x07, 0x00, 0x70, 0x0E, 0x00,
-  0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x1C, 0x00,
-  0xF0, 0x1C, 0x03, 0x80, 0x07, 0x87, 0xC0, 0x70, 0x00, 0x7F, 0xF8, 0x07,
-  0x00, 0x03, 0xFE, 0x00, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF8, 0x00,
-  0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0xF8, 0x7C, 0x00, 0x78, 0x0F,
-  0x00, 0x1E, 0x03, 0xC0, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x3C, 0x00, 0xF0,
-  0x1E, 0x00, 0x3C, 0x07, 0x80, 0x0F, 0x87, 0xC0, 0x01, 0xE3, 0xE0, 0x00,
-  0x7F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-  0x03, 0xFF, 0x00, 0x01, 0xFB, 0xE0, 0x70, 0xF8, 0x7C, 0x1C, 0x7C, 0x1F,
-  0x0E, 0x3C, 0x03, 0xE3, 0x9E, 0x00, 0x79, 0xE7, 0x80, 0x1F, 0xF3, 0xC0,
-  0x03, 0xF8, 0xF0, 0x00, 0xFE, 0x3C, 0x00, 0x1F, 0x0F, 0x00, 0x07, 0xC3,
-  0xE0, 0x03, 0xF8, 0xF8, 0x03, 0xFE, 0x3F, 0x83, 0xF7, 0xC7, 0xFF, 0xF8,
-  0xF0, 0xFF, 0xFC, 0x3E, 0x1F, 0xFC, 0x07, 0x81, 0xFC, 0x00, 0x00, 0x7B,
-  0xDF, 0xEF, 0x7B, 0xDC, 0xE7, 0x31, 0x80, 0x00, 0x0E, 0x00, 0x38, 0x00,
-  0xE0, 0x03, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xE0, 0x03, 0x80,
-  0x0F, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0x00, 0x0E,
-  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00,
-  0x1C, 0x00, 0x78, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E,
-  0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80,
-  0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x30, 0x00,
-  0x70, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x70, 0x00, 0xE0,
-  0x00, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00,
-  0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07,
-  0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x01, 0xE0, 0x03, 0x80,
-  0x07, 0x00, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x07,
-  0x00, 0x0E, 0x00, 0x3C, 0x00, 0x70, 0x01, 0xE0, 0x03, 0x80, 0x0F, 0x00,
-  0x1C, 0x00, 0x78, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x70,
-  0x01, 0xC0, 0x07, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x38, 0x18, 0xE3,
-  0x7B, 0xBF, 0xFF, 0xF3, 0xFF, 0x01, 0xE0, 0x1F, 0xC0, 0xF7, 0x07, 0x9E,
-  0x1C, 0x38, 0x20, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00,
-  0x00, 0x1C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07,
-  0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3E, 0x7C, 0xF9, 0xE7,
-  0xC1, 0x83, 0x0C, 0x18, 0x63, 0xC6, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0x7D, 0xF7, 0xBE, 0xF8, 0x00, 0x00, 0x18, 0x00, 0x01, 0xC0, 0x00,
-  0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00,
-  0x00, 0x30, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00, 0x01, 0xC0, 0x00, 0x0C,
-  0x00, 0x00, 0xE0, 0x00, 0x06, 0x00, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00,
-  0x38, 0x00, 0x01, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xC0, 0x00, 0x0E, 0x00,
-  0x00, 0x60, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x38,
-  0x00, 0x01, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xC0, 0x00, 0x0E, 0x00, 0x00,
-  0x60, 0x00, 0x07, 0x00, 0x00, 0x30, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x0F, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF,
-  0xE0, 0x3F, 0x0F, 0xC0, 0xF8, 0x07, 0x81, 0xE0, 0x0F, 0x87, 0x80, 0x0F,
-  0x1F, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x79, 0xE0, 0x00, 0xF3,
-  0xC0, 0x01, 0xE7, 0x80, 0x07, 0xDE, 0x00, 0x0F, 0xBC, 0x00, 0x1E, 0x78,
-  0x00, 0x3C, 0xF0, 0x00, 0x79, 0xE0, 0x00, 0xF7, 0x80, 0x03, 0xEF, 0x00,
-  0x07, 0xDE, 0x00, 0x0F, 0x3C, 0x00, 0x1E, 0x78, 0x00, 0x7C, 0xF0, 0x00,
-  0xF1, 0xE0, 0x03, 0xE3, 0xC0, 0x07, 0x87, 0xC0, 0x1F, 0x0F, 0x80, 0x7C,
-  0x0F, 0xC3, 0xF0, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x1F, 0xFC, 0x00,
-  0x0F, 0xC0, 0x00, 0x00, 0x18, 0x01, 0xC0, 0x1C, 0x01, 0xE0, 0x1F, 0x0F,
-  0xFB, 0xFF, 0xDF, 0xFC, 0xFF, 0xE0, 0x0F, 0x00, 0x78, 0x07, 0xC0, 0x3C,
-  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00,
-  0x78, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x07, 0xC0, 0x3C,
-  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x07, 0xC0, 0x3C, 0x00, 0x00, 0x03, 0xFC,
-  0x00, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x0F,
-  0xC0, 0xFC, 0x03, 0xE0, 0x07, 0xC0, 0xF8, 0x00, 0xF8, 0x1F, 0x00, 0x0F,
-  0x03, 0xC0, 0x01, 0xE0, 0xF8, 0x00, 0x3C, 0x1E, 0x00, 0x07, 0x80, 0x00,
-  0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F,
-  0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xFF,
-  0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFC,
-  0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFF, 0x80, 0x3F,
-  0xFF, 0xE0, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x1E, 0x0F,
-  0x00, 0x0F, 0x0F, 0x80, 0x07, 0x87, 0x80, 0x03, 0xC0, 0x00, 0x03, 0xC0,
-  0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0xE0,
-  0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F,
-  0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-  0x79, 0xE0, 0x00, 0x3C, 0xF0, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x3C, 0x00,
-  0x0F, 0x1E, 0x00, 0x0F, 0x0F, 0x80, 0x1F, 0x83, 0xF0, 0x3F, 0x81, 0xFF,
-  0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x07, 0xBC,
-  0x00, 0x0F, 0xBC, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x78, 0x00, 0x7C, 0x78,
-  0x00, 0xF8, 0x78, 0x00, 0xF0, 0x78, 0x01, 0xE0, 0xF0, 0x03, 0xC0, 0xF0,
-  0x07, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x1E, 0x01, 0xF0, 0x3C, 0x01, 0xE0,
-  0x78, 0x01, 0xE0, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
-  0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80,
-  0x00, 0x0F, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF8, 0x03, 0xFF,
-  0xFF, 0x00, 0x7F, 0xFF, 0xE0, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x78, 0x00,
-  0x00, 0x1E, 0x00, 0x00, 0x03, 0xC7, 0xE0, 0x00, 0xF7, 0xFF, 0x80, 0x1F,
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0x80, 0xFE, 0x03, 0xF0, 0x1F, 0x00, 0x3F,
-  0x03, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x70,
-  0x00, 0x00, 0x1E, 0x1E, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0xF0, 0x7C, 0x00,
-  0x3C, 0x0F, 0x80, 0x0F, 0x80, 0xFC, 0x07, 0xE0, 0x1F, 0xFF, 0xF8, 0x01,
-  0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x07,
-  0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xFE, 0x01, 0xF8,
-  0x3E, 0x03, 0xE0, 0x1F, 0x07, 0xC0, 0x1F, 0x0F, 0x80, 0x0F, 0x0F, 0x00,
-  0x0F, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x1F,
-  0x80, 0x3C, 0x7F, 0xE0, 0x3D, 0xFF, 0xF0, 0x7B, 0xFF, 0xF8, 0x7F, 0xC1,
-  0xF8, 0x7F, 0x00, 0x7C, 0x7E, 0x00, 0x7C, 0xFC, 0x00, 0x3C, 0xF8, 0x00,
-  0x3C, 0xF8, 0x00, 0x3C, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x38, 0xF0, 0x00,
-  0x78, 0xF0, 0x00, 0x78, 0xF0, 0x00, 0xF0, 0xF8, 0x01, 0xF0, 0x7C, 0x03,
-  0xE0, 0x7E, 0x0F, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x0F, 0xFE,
-  0x00, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xE1, 0xFF,
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80,
-  0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03,
-  0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0x80,
-  0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1E,
-  0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x1F,
-  0xFF, 0x80, 0x1F, 0xFF, 0xE0, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0x7C, 0x0F,
-  0x00, 0x1E, 0x0F, 0x00, 0x0F, 0x07, 0x80, 0x07, 0x83, 0xC0, 0x03, 0xC1,
-  0xE0, 0x03, 0xC0, 0xF8, 0x03, 0xC0, 0x7E, 0x07, 0xC0, 0x1F, 0xFF, 0xC0,
-  0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x07, 0xE0, 0x7E,
-  0x07, 0xC0, 0x0F, 0x07, 0x80, 0x07, 0xC7, 0xC0, 0x01, 0xE3, 0xC0, 0x00,
-  0xF3, 0xC0, 0x00, 0x79, 0xE0, 0x00, 0x3C, 0xF0, 0x00, 0x1C, 0x78, 0x00,
-  0x1E, 0x3C, 0x00, 0x0F, 0x1F, 0x00, 0x0F, 0x0F, 0xC0, 0x0F, 0x83, 0xF0,
-  0x3F, 0x81, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x01,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xFC,
-  0x03, 0xFF, 0xFC, 0x07, 0xF0, 0x7E, 0x07, 0xC0, 0x3E, 0x0F, 0x80, 0x1F,
-  0x0F, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x3C, 0x00, 0x0F,
-  0x3C, 0x00, 0x0F, 0x3C, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0x3C, 0x00, 0x3F,
-  0x3E, 0x00, 0x7E, 0x3E, 0x00, 0xFE, 0x1F, 0x83, 0xFE, 0x1F, 0xFF, 0xFE,
-  0x0F, 0xFF, 0xBC, 0x07, 0xFE, 0x3C, 0x01, 0xF8, 0x7C, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0xF0, 0x01, 0xF0,
-  0xF0, 0x03, 0xE0, 0xF8, 0x07, 0xC0, 0xFC, 0x1F, 0xC0, 0x7F, 0xFF, 0x80,
-  0x3F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xC1, 0xF0,
-  0x78, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x1F,
-  0x07, 0x83, 0xE0, 0xF8, 0x00, 0x03, 0xE0, 0x7C, 0x0F, 0x03, 0xE0, 0x7C,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x7C, 0x0F,
-  0x81, 0xE0, 0x7C, 0x01, 0x80, 0x30, 0x0C, 0x01, 0x80, 0x60, 0x3C, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00,
-  0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00,
-  0x03, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00,
-  0x01, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x0E,
-  0x00, 0x00, 0x00, 0x80, 0x1F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF,
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF,
-  0xC7, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF8, 0x04, 0x00, 0x00, 0x01, 0xC0,
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00,
-  0x3F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFE,
-  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
-  0x3F, 0x80, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x01,
-  0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00,
-  0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFE,
-  0x00, 0x3F, 0xF8, 0x0F, 0xFF, 0xC1, 0xFF, 0xFE, 0x1F, 0x03, 0xE3, 0xE0,
-  0x1F, 0x7C, 0x00, 0xF7, 0x80, 0x0F, 0x78, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
-  0x01, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
-  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x00,
-  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x80,
-  0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xE0, 0x00, 0x3E,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0x7F, 0xE0, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0,
-  0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-  0xFC, 0x00, 0x00, 0x01, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0xF8,
-  0x00, 0xFC, 0x00, 0x3E, 0x0F, 0x80, 0x1F, 0xF9, 0xE1, 0xF0, 0x78, 0x03,
-  0xFF, 0xCF, 0x07, 0x87, 0xC0, 0x3F, 0x0F, 0xF0, 0x3C, 0x7C, 0x03, 0xE0,
-  0x3F, 0x01, 0xE3, 0xC0, 0x3E, 0x01, 0xF8, 0x0F, 0x3E, 0x03, 0xE0, 0x0F,
-  0x80, 0x79, 0xE0, 0x1E, 0x00, 0x7C, 0x03, 0xDF, 0x01, 0xE0, 0x03, 0xC0,
-  0x3E, 0xF0, 0x1F, 0x00, 0x3E, 0x01, 0xE7, 0x80, 0xF0, 0x01, 0xE0, 0x0F,
-  0x38, 0x07, 0x80, 0x0F, 0x00, 0xFB, 0xC0, 0x78, 0x00, 0xF0, 0x07, 0x9E,
-  0x03, 0xC0, 0x07, 0x80, 0x7C, 0xF0, 0x1E, 0x00, 0x78, 0x07, 0xC7, 0x80,
-  0xF0, 0x07, 0xC0, 0x7E, 0x3C, 0x07, 0x80, 0x7C, 0x07, 0xE1, 0xE0, 0x3E,
-  0x07, 0xE0, 0x7E, 0x0F, 0x00, 0xF8, 0x7F, 0x8F, 0xC0, 0x7C, 0x07, 0xFF,
-  0x7F, 0xFC, 0x01, 0xE0, 0x1F, 0xF1, 0xFF, 0x80, 0x0F, 0x00, 0x7E, 0x0F,
-  0xF0, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-  0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0xF8, 0x00, 0x00,
-  0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x1E,
-  0x7C, 0x00, 0x00, 0x79, 0xF0, 0x00, 0x03, 0xC7, 0xC0, 0x00, 0x0F, 0x1F,
-  0x00, 0x00, 0x78, 0x3C, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x0F, 0x03, 0xE0,
-  0x00, 0x78, 0x0F, 0x80, 0x01, 0xE0, 0x3E, 0x00, 0x0F, 0x00, 0xF8, 0x00,
-  0x3C, 0x03, 0xE0, 0x01, 0xE0, 0x0F, 0x80, 0x0F, 0x80, 0x1E, 0x00, 0x3C,
-  0x00, 0x7C, 0x01, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF,
-  0xFF, 0x00, 0xFF, 0xFF, 0xFC, 0x07, 0xC0, 0x01, 0xF0, 0x3E, 0x00, 0x03,
-  0xC0, 0xF8, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0xF8,
-  0xF8, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x0F, 0x9F, 0x00, 0x00, 0x3E, 0xF8,
-  0x00, 0x00, 0x7B, 0xE0, 0x00, 0x01, 0xF0, 0x01, 0xFF, 0xFF, 0x00, 0x0F,
-  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xE0, 0x3E, 0x00,
-  0x1F, 0x81, 0xE0, 0x00, 0x7C, 0x0F, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x0F,
-  0x03, 0xC0, 0x00, 0x78, 0x3C, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x3C, 0x0F,
-  0x00, 0x01, 0xE0, 0x78, 0x00, 0x1E, 0x07, 0xC0, 0x03, 0xE0, 0x3F, 0xFF,
-  0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFE,
-  0x07, 0x80, 0x01, 0xF0, 0x3C, 0x00, 0x07, 0xC1, 0xE0, 0x00, 0x1E, 0x0F,
-  0x00, 0x00, 0xF0, 0xF0, 0x00, 0x07, 0x87, 0x80, 0x00, 0x3C, 0x3C, 0x00,
-  0x01, 0xE1, 0xE0, 0x00, 0x1E, 0x1F, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x0F,
-  0x87, 0x80, 0x00, 0xF8, 0x3C, 0x00, 0x1F, 0x81, 0xFF, 0xFF, 0xF8, 0x1F,
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x01, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x1F,
-  0xFF, 0xFC, 0x00, 0xFE, 0x03, 0xF0, 0x07, 0xE0, 0x03, 0xE0, 0x3E, 0x00,
-  0x07, 0x81, 0xF0, 0x00, 0x1E, 0x07, 0x80, 0x00, 0x3C, 0x3C, 0x00, 0x00,
-  0xF1, 0xF0, 0x00, 0x03, 0xC7, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-  0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x01, 0xF3, 0xC0, 0x00, 0x07,
-  0x8F, 0x80, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x07, 0xC1,
-  0xF0, 0x00, 0x3E, 0x03, 0xE0, 0x03, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x1F,
-  0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x3F,
-  0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x07, 0xFF,
-  0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x3E, 0x00, 0x3F, 0x80, 0x78, 0x00,
-  0x1F, 0x80, 0xF0, 0x00, 0x1F, 0x03, 0xE0, 0x00, 0x1E, 0x07, 0xC0, 0x00,
-  0x3E, 0x0F, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00,
-  0xF0, 0xF8, 0x00, 0x01, 0xE1, 0xF0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x07,
-  0x87, 0x80, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0x78,
-  0x7C, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x01, 0xE1, 0xE0, 0x00, 0x07, 0x87,
-  0xC0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x78, 0x3C,
-  0x00, 0x01, 0xF0, 0x78, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x0F, 0x03, 0xE0,
-  0x00, 0x3E, 0x07, 0x80, 0x01, 0xF8, 0x0F, 0x00, 0x0F, 0xE0, 0x1F, 0xFF,
-  0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-  0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x78, 0x00,
-  0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-  0x00, 0x0F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-  0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0x80,
-  0x7F, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07,
-  0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0,
-  0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-  0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
-  0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
-  0xFF, 0xC0, 0xFF, 0xFF, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F,
-  0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-  0xF0, 0x07, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-  0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
-  0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3E, 0x00,
-  0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xC0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x07,
-  0xFF, 0xFF, 0xC0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xC0, 0x00, 0xF8, 0x0F,
-  0xC0, 0x00, 0x3E, 0x07, 0x80, 0x00, 0x1F, 0x07, 0x80, 0x00, 0x07, 0x87,
-  0xC0, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03,
-  0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
-  0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x1F, 0xFF,
-  0xBC, 0x00, 0x0F, 0xFF, 0xDE, 0x00, 0x0F, 0xFF, 0xEF, 0x00, 0x07, 0xFF,
-  0xF7, 0x80, 0x00, 0x00, 0x73, 0xC0, 0x00, 0x00, 0x39, 0xE0, 0x00, 0x00,
-  0x3C, 0xF0, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00,
-  0x0F, 0x8F, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x0F, 0xC3, 0xF0, 0x00,
-  0x0F, 0xE0, 0xFC, 0x00, 0x1F, 0xF0, 0x7F, 0x80, 0x7F, 0x78, 0x1F, 0xFF,
-  0xFE, 0x38, 0x03, 0xFF, 0xFE, 0x1C, 0x00, 0xFF, 0xFC, 0x0E, 0x00, 0x0F,
-  0xF0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x03, 0xC0,
-  0x78, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x01, 0xF0, 0x3E, 0x00, 0x00, 0xF0,
-  0x1E, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x3C, 0x0F, 0x80, 0x00, 0x3E,
-  0x07, 0xC0, 0x00, 0x1F, 0x03, 0xC0, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x07,
-  0x80, 0xF0, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x01,
-  0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
-  0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x00,
-  0x0F, 0x01, 0xE0, 0x00, 0x07, 0x81, 0xF0, 0x00, 0x07, 0xC0, 0xF8, 0x00,
-  0x03, 0xE0, 0x78, 0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00, 0xF0, 0x1E, 0x00,
-  0x00, 0x78, 0x1F, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x3C, 0x07, 0x80,
-  0x00, 0x1E, 0x03, 0xC0, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x0F, 0x81, 0xF0,
-  0x00, 0x07, 0xC0, 0xF0, 0x00, 0x03, 0xC0, 0x78, 0x00, 0x01, 0xE0, 0x00,
-  0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xE0, 0x3C, 0x07, 0x81, 0xF0, 0x3E, 0x07,
-  0x80, 0xF0, 0x1E, 0x07, 0xC0, 0xF8, 0x1E, 0x03, 0xC0, 0x78, 0x1F, 0x03,
-  0xE0, 0x78, 0x0F, 0x01, 0xE0, 0x7C, 0x0F, 0x81, 0xE0, 0x3C, 0x07, 0x81,
-  0xF0, 0x3E, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0xC0, 0xF8, 0x1E, 0x00, 0x00,
-  0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0,
-  0x00, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x80, 0x00, 0x07,
-  0xC0, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0xF0,
-  0x01, 0xE0, 0x78, 0x00, 0xF0, 0x78, 0x00, 0xF8, 0x3C, 0x00, 0x78, 0x1E,
-  0x00, 0x3C, 0x0F, 0x00, 0x3E, 0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x7E, 0x00,
-  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFC, 0x00,
-  0x00, 0x01, 0xE0, 0x00, 0x0F, 0xC0, 0x78, 0x00, 0x07, 0xC0, 0x1E, 0x00,
-  0x03, 0xE0, 0x0F, 0x80, 0x03, 0xF0, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0xF0,
-  0x00, 0xFC, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x07,
-  0xC0, 0x3F, 0x00, 0x01, 0xE0, 0x1F, 0x80, 0x00, 0x78, 0x0F, 0x80, 0x00,
-  0x1E, 0x07, 0xC0, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x03, 0xE3, 0xF0, 0x00,
-  0x00, 0xF1, 0xFC, 0x00, 0x00, 0x3C, 0xFF, 0x00, 0x00, 0x0F, 0x7F, 0xE0,
-  0x00, 0x07, 0xFE, 0xF8, 0x00, 0x01, 0xFE, 0x1E, 0x00, 0x00, 0x7F, 0x07,
-  0xC0, 0x00, 0x1F, 0x80, 0xF0, 0x00, 0x0F, 0xC0, 0x3E, 0x00, 0x03, 0xE0,
-  0x07, 0x80, 0x00, 0xF0, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x0F,
-  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-  0x78, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x03, 0xE0, 0x07, 0x80, 0x00, 0xF8,
-  0x03, 0xE0, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x07, 0xC0, 0x3C, 0x00, 0x00,
-  0xF8, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xF8,
-  0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00,
-  0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F,
-  0x80, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
-  0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
-  0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0,
-  0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00,
-  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0,
-  0x01, 0xF8, 0x00, 0x00, 0x7E, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x0F, 0xF0,
-  0x00, 0x03, 0xF8, 0x1F, 0xE0, 0x00, 0x0F, 0xF0, 0x3F, 0xC0, 0x00, 0x1F,
-  0xC0, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0xFF, 0x00, 0x00, 0xEF, 0x03, 0xFE,
-  0x00, 0x03, 0xFE, 0x07, 0xBC, 0x00, 0x0F, 0x78, 0x0F, 0x3C, 0x00, 0x1E,
-  0xF0, 0x1E, 0x78, 0x00, 0x79, 0xE0, 0x3C, 0xF0, 0x00, 0xF3, 0xC0, 0xF9,
-  0xE0, 0x03, 0xCF, 0x81, 0xE3, 0xC0, 0x07, 0x9E, 0x03, 0xC7, 0x80, 0x1E,
-  0x3C, 0x07, 0x8F, 0x00, 0x38, 0x78, 0x1F, 0x1E, 0x00, 0xF0, 0xF0, 0x3C,
-  0x1E, 0x03, 0xC3, 0xE0, 0x78, 0x3C, 0x07, 0x87, 0x80, 0xF0, 0x78, 0x1E,
-  0x0F, 0x01, 0xE0, 0xF0, 0x3C, 0x1E, 0x07, 0xC1, 0xE0, 0xF0, 0x7C, 0x0F,
-  0x03, 0xC1, 0xE0, 0xF0, 0x1E, 0x07, 0x87, 0x81, 0xE0, 0x3C, 0x0F, 0x0E,
-  0x03, 0xC0, 0x78, 0x0F, 0x3C, 0x07, 0x81, 0xF0, 0x1E, 0x70, 0x1F, 0x03,
-  0xC0, 0x3D, 0xE0, 0x3C, 0x07, 0x80, 0x7F, 0x80, 0x78, 0x0F, 0x00, 0xFF,
-  0x00, 0xF0, 0x3E, 0x01, 0xFC, 0x01, 0xE0, 0x78, 0x03, 0xF8, 0x07, 0xC0,
-  0xF0, 0x07, 0xE0, 0x0F, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x01, 0xF0,
-  0x00, 0x03, 0xC0, 0x7E, 0x00, 0x01, 0xF0, 0x3F, 0x80, 0x00, 0x78, 0x0F,
-  0xE0, 0x00, 0x1E, 0x03, 0xFC, 0x00, 0x07, 0x80, 0xFF, 0x00, 0x03, 0xE0,
-  0x3F, 0xE0, 0x00, 0xF0, 0x1F, 0xF8, 0x00, 0x3C, 0x07, 0x9E, 0x00, 0x0F,
-  0x01, 0xE7, 0xC0, 0x03, 0xC0, 0x78, 0xF0, 0x01, 0xF0, 0x1E, 0x3E, 0x00,
-  0x78, 0x0F, 0x87, 0x80, 0x1E, 0x03, 0xC1, 0xF0, 0x07, 0x80, 0xF0, 0x7C,
-  0x01, 0xE0, 0x3C, 0x0F, 0x00, 0xF8, 0x1F, 0x03, 0xE0, 0x3C, 0x07, 0x80,
-  0x78, 0x0F, 0x01, 0xE0, 0x1F, 0x03, 0xC0, 0x78, 0x07, 0xC1, 0xF0, 0x1E,
-  0x00, 0xF8, 0x78, 0x0F, 0x80, 0x3E, 0x1E, 0x03, 0xC0, 0x07, 0x87, 0x80,
-  0xF0, 0x01, 0xF1, 0xE0, 0x3C, 0x00, 0x3C, 0xF8, 0x0F, 0x00, 0x0F, 0xBC,
-  0x07, 0xC0, 0x03, 0xEF, 0x01, 0xE0, 0x00, 0x7F, 0xC0, 0x78, 0x00, 0x1F,
-  0xF0, 0x1E, 0x00, 0x03, 0xFC, 0x0F, 0x80, 0x00, 0xFE, 0x03, 0xC0, 0x00,
-  0x1F, 0x80, 0xF0, 0x00, 0x07, 0xE0, 0x3C, 0x00, 0x01, 0xF8, 0x00, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x1F, 0xC0, 0x0F, 0xC0, 0x03, 0xF0,
-  0x0F, 0x80, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x0F,
-  0x07, 0x80, 0x00, 0x07, 0xC7, 0xC0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00,
-  0xF3, 0xC0, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00,
-  0x1E, 0xF0, 0x00, 0x00, 0x0F, 0x78, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,
-  0x07, 0xFC, 0x00, 0x00, 0x03, 0xDE, 0x00, 0x00, 0x01, 0xEF, 0x00, 0x00,
-  0x00, 0xF7, 0x80, 0x00, 0x00, 0xFB, 0xC0, 0x00, 0x00, 0x79, 0xE0, 0x00,
-  0x00, 0x3C, 0xF0, 0x00, 0x00, 0x3E, 0x78, 0x00, 0x00, 0x1E, 0x3E, 0x00,
-  0x00, 0x1F, 0x0F, 0x00, 0x00, 0x1F, 0x07, 0xC0, 0x00, 0x1F, 0x03, 0xF0,
-  0x00, 0x1F, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x3F, 0x80, 0x7F, 0x80, 0x1F,
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
-  0x0F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
-  0x7F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xE0, 0x3E, 0x00, 0x3F, 0x81, 0xE0,
-  0x00, 0x7C, 0x0F, 0x00, 0x01, 0xE0, 0xF8, 0x00, 0x0F, 0x07, 0xC0, 0x00,
-  0x78, 0x3C, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x1E, 0x0F, 0x00, 0x01, 0xE0,
-  0xF8, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0xF8, 0x3C, 0x00, 0x0F, 0x81, 0xE0,
-  0x01, 0xF8, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-  0x80, 0x3F, 0xFF, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0,
-  0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0x80, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
-  0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
-  0x00, 0x03, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-  0x80, 0x0F, 0xF0, 0x1F, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x0F, 0xC0, 0x00,
-  0xFC, 0x0F, 0x80, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x0F, 0x07, 0x80, 0x00,
-  0x07, 0xC7, 0xC0, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0x00, 0xF3, 0xC0, 0x00,
-  0x00, 0x79, 0xE0, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x00, 0x1E, 0xF0, 0x00,
-  0x00, 0x0F, 0x78, 0x00, 0x00, 0x07, 0xB8, 0x00, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0x03, 0xDE, 0x00, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x00, 0xF7, 0x80,
-  0x00, 0x00, 0x7B, 0xC0, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x00, 0x3C, 0xF0,
-  0x00, 0x00, 0x3C, 0x78, 0x00, 0x08, 0x3E, 0x3E, 0x00, 0x0E, 0x1E, 0x0F,
-  0x00, 0x0F, 0x9F, 0x07, 0xC0, 0x07, 0xFF, 0x03, 0xF0, 0x01, 0xFF, 0x00,
-  0xFC, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xE0,
-  0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x7E, 0x00, 0x0F, 0xF0, 0x1F,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-  0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFE,
-  0x03, 0xE0, 0x00, 0xFC, 0x0F, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x03, 0xC1,
-  0xF0, 0x00, 0x0F, 0x07, 0xC0, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0xF0, 0x78,
-  0x00, 0x03, 0xC1, 0xE0, 0x00, 0x1E, 0x0F, 0x80, 0x00, 0x78, 0x3E, 0x00,
-  0x03, 0xE0, 0xF0, 0x00, 0x1F, 0x03, 0xC0, 0x01, 0xF8, 0x0F, 0xFF, 0xFF,
-  0xC0, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0,
-  0x1E, 0x00, 0x07, 0xE0, 0xF8, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x1E, 0x0F,
-  0x00, 0x00, 0x78, 0x3C, 0x00, 0x01, 0xE0, 0xF0, 0x00, 0x07, 0x87, 0xC0,
-  0x00, 0x1E, 0x1F, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x03, 0xC1, 0xE0, 0x00,
-  0x0F, 0x07, 0x80, 0x00, 0x3C, 0x3E, 0x00, 0x00, 0xF0, 0xF0, 0x00, 0x03,
-  0xC3, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0xFC,
-  0x00, 0x1F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0, 0x7F, 0x01,
-  0xF0, 0x00, 0xFC, 0x0F, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x0F, 0x07, 0x00,
-  0x00, 0x78, 0x78, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0x1E, 0x1E, 0x00, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F,
-  0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07,
-  0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x01, 0xE7,
-  0x80, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0x71, 0xE0, 0x00, 0x07, 0x8F, 0x00,
-  0x00, 0x3C, 0x7C, 0x00, 0x03, 0xC1, 0xF0, 0x00, 0x7C, 0x0F, 0xE0, 0x1F,
-  0xC0, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00,
-  0x03, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x7F,
-  0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x01, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00,
-  0x00, 0x78, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F,
-  0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01,
-  0xE0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00,
-  0x00, 0x03, 0xC0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,
-  0x7C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x0F, 0x00, 0x00, 0x3C, 0x1E,
-  0x00, 0x00, 0xF8, 0x7C, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x03, 0xC1, 0xE0,
-  0x00, 0x07, 0x83, 0xC0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x3E, 0x1F, 0x00,
-  0x00, 0x7C, 0x3C, 0x00, 0x00, 0xF0, 0x78, 0x00, 0x01, 0xE0, 0xF0, 0x00,
-  0x03, 0xC3, 0xE0, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x1F, 0x0F, 0x00, 0x00,
-  0x3C, 0x1E, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x01, 0xF0, 0xF8, 0x00, 0x03,
-  0xE1, 0xF0, 0x00, 0x07, 0x83, 0xC0, 0x00, 0x0F, 0x07, 0x80, 0x00, 0x1E,
-  0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x01, 0xE0,
-  0xF0, 0x00, 0x03, 0xC1, 0xE0, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x1E, 0x07,
-  0x80, 0x00, 0x7C, 0x0F, 0x80, 0x01, 0xF0, 0x0F, 0x80, 0x07, 0xE0, 0x1F,
-  0xC0, 0x7F, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1F,
-  0xFF, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x0F, 0xBE, 0x00, 0x00, 0x79, 0xF0, 0x00, 0x07, 0xC7, 0x80, 0x00,
-  0x3C, 0x3C, 0x00, 0x03, 0xE1, 0xE0, 0x00, 0x1E, 0x0F, 0x80, 0x01, 0xF0,
-  0x7C, 0x00, 0x0F, 0x03, 0xE0, 0x00, 0xF8, 0x1F, 0x00, 0x0F, 0x80, 0x78,
-  0x00, 0x78, 0x03, 0xC0, 0x07, 0xC0, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x03,
-  0xE0, 0x07, 0xC0, 0x1E, 0x00, 0x3E, 0x01, 0xF0, 0x01, 0xF0, 0x0F, 0x00,
-  0x07, 0x80, 0xF0, 0x00, 0x3C, 0x07, 0x80, 0x01, 0xE0, 0x78, 0x00, 0x0F,
-  0x07, 0xC0, 0x00, 0x7C, 0x3C, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x1F, 0x1E,
-  0x00, 0x00, 0xF9, 0xF0, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x1E, 0xF0, 0x00,
-  0x00, 0xF7, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF0,
-  0x00, 0x1F, 0x00, 0x03, 0xDE, 0x00, 0x07, 0xE0, 0x00, 0xFB, 0xC0, 0x00,
-  0xFC, 0x00, 0x1E, 0x78, 0x00, 0x3F, 0x80, 0x07, 0xCF, 0x00, 0x07, 0xF0,
-  0x00, 0xF9, 0xE0, 0x01, 0xFE, 0x00, 0x3E, 0x3C, 0x00, 0x7F, 0xC0, 0x07,
-  0xC7, 0x80, 0x0F, 0x78, 0x01, 0xF0, 0xF0, 0x03, 0xEF, 0x00, 0x3E, 0x1E,
-  0x00, 0x79, 0xE0, 0x0F, 0x83, 0xC0, 0x1F, 0x3C, 0x01, 0xF0, 0x78, 0x03,
-  0xC7, 0x80, 0x3C, 0x0F, 0x00, 0xF8, 0xF0, 0x0F, 0x80, 0xE0, 0x1E, 0x1E,
-  0x01, 0xE0, 0x1C, 0x07, 0xC1, 0xC0, 0x7C, 0x03, 0x80, 0xF0, 0x3C, 0x0F,
-  0x00, 0x70, 0x3E, 0x07, 0x83, 0xE0, 0x0E, 0x07, 0x80, 0xF0, 0x78, 0x01,
-  0xC1, 0xF0, 0x1E, 0x1F, 0x00, 0x3C, 0x3C, 0x03, 0xC3, 0xE0, 0x07, 0x8F,
-  0x80, 0x78, 0x78, 0x00, 0xF1, 0xE0, 0x0F, 0x1F, 0x00, 0x1E, 0x7C, 0x01,
-  0xE3, 0xC0, 0x03, 0xCF, 0x00, 0x3C, 0xF8, 0x00, 0x7B, 0xE0, 0x07, 0x9E,
-  0x00, 0x0F, 0x78, 0x00, 0xF7, 0xC0, 0x01, 0xFF, 0x00, 0x1E, 0xF0, 0x00,
-  0x3F, 0xC0, 0x03, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x7F, 0x80, 0x00, 0xFE,
-  0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00,
-  0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7C,
-  0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x3E, 0x00,
-  0x7C, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x1F,
-  0x00, 0x01, 0xF0, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-  0x0F, 0x80, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00,
-  0x07, 0xC3, 0xE0, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x03, 0xEF, 0x80,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-  0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,
-  0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x0F, 0xBE, 0x00,
-  0x00, 0x01, 0xF3, 0xE0, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x03, 0xE1,
-  0xF0, 0x00, 0x00, 0x7C, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0xF8, 0x00, 0x01,
-  0xF0, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x03, 0xE0,
-  0x00, 0xF8, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,
-  0x1F, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0xF8,
-  0x00, 0x00, 0x7D, 0xF0, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x1F, 0x1F, 0x80,
-  0x00, 0xF8, 0x3E, 0x00, 0x03, 0xE0, 0xF8, 0x00, 0x1F, 0x01, 0xF0, 0x00,
-  0xF8, 0x07, 0xC0, 0x07, 0xC0, 0x0F, 0x00, 0x3E, 0x00, 0x3E, 0x01, 0xF0,
-  0x00, 0xF8, 0x07, 0xC0, 0x01, 0xF0, 0x3E, 0x00, 0x07, 0xC1, 0xF0, 0x00,
-  0x0F, 0x0F, 0x80, 0x00, 0x3E, 0x7C, 0x00, 0x00, 0x79, 0xE0, 0x00, 0x01,
-  0xFF, 0x80, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F,
-  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x80,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x03, 0xC0, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-  0x07, 0x80, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-  0xE0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0,
-  0x1F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07,
-  0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-  0x03, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x80,
-  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-  0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xC0, 0x1F,
-  0xF0, 0x07, 0xFC, 0x01, 0xFE, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-  0x03, 0xC0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01,
-  0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-  0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xF8, 0x00,
-  0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E,
-  0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x0F, 0x00,
-  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01,
-  0xE0, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x0F, 0xF8, 0x03, 0xFE, 0x00, 0xE3,
-  0x8E, 0x38, 0xE1, 0x86, 0x18, 0x61, 0x87, 0x1C, 0x71, 0xC7, 0x0C, 0x30,
-  0xC3, 0x0C, 0x38, 0xE3, 0x8E, 0x38, 0x61, 0x86, 0x18, 0x61, 0xC7, 0x1C,
-  0x71, 0xC0, 0x00, 0x7F, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0x03, 0xFE, 0x00,
-  0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x03,
-  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0,
-  0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
-  0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E,
-  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00,
-  0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x03,
-  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x7F, 0x80, 0x3F, 0xE0,
-  0x0F, 0xF8, 0x03, 0xFE, 0x00, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1F, 0x00,
-  0x1F, 0xC0, 0x0E, 0xE0, 0x0E, 0x70, 0x0F, 0x38, 0x07, 0x1C, 0x07, 0x0E,
-  0x03, 0x83, 0x83, 0x81, 0xC3, 0xC0, 0xE1, 0xC0, 0x71, 0xC0, 0x39, 0xE0,
-  0x0E, 0xE0, 0x07, 0xF0, 0x03, 0xF0, 0x01, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0x78, 0x3C, 0x1C, 0x0E, 0x0E, 0x07, 0x00,
-  0x1F, 0xE0, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0, 0x7E,
-  0x07, 0xE1, 0xF0, 0x07, 0xC3, 0xC0, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xE0, 0x0F, 0xFF,
-  0xC0, 0xFF, 0xFF, 0x07, 0xFF, 0x9E, 0x1F, 0xC0, 0x3C, 0x7C, 0x00, 0x78,
-  0xF0, 0x00, 0xF3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x1F, 0x1E,
-  0x00, 0x7E, 0x3F, 0x07, 0xFC, 0x3F, 0xFF, 0x7E, 0x7F, 0xFC, 0xFC, 0x7F,
-  0xF0, 0xF8, 0x3F, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x83, 0xE0, 0x03, 0xC7, 0xFC,
-  0x01, 0xEF, 0xFF, 0x00, 0xFF, 0xFF, 0xC0, 0xF7, 0x83, 0xF0, 0x7F, 0x00,
-  0xF8, 0x3F, 0x00, 0x3E, 0x1F, 0x00, 0x0F, 0x1F, 0x80, 0x07, 0x8F, 0x80,
-  0x03, 0xC7, 0x80, 0x01, 0xE3, 0xC0, 0x00, 0xF1, 0xE0, 0x00, 0x79, 0xF0,
-  0x00, 0x3C, 0xF0, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0x3C, 0x00, 0x0F, 0x1E,
-  0x00, 0x0F, 0x9F, 0x00, 0x07, 0x8F, 0xC0, 0x07, 0xC7, 0xE0, 0x07, 0xC3,
-  0xF8, 0x07, 0xC1, 0xFE, 0x0F, 0xC1, 0xEF, 0xFF, 0xE0, 0xF3, 0xFF, 0xC0,
-  0x78, 0xFF, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF,
-  0x80, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xE0, 0xF8, 0x7E, 0x01, 0xF1,
-  0xF0, 0x03, 0xCF, 0x80, 0x0F, 0x3C, 0x00, 0x3D, 0xF0, 0x00, 0x07, 0x80,
-  0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
-  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x0F, 0x3C,
-  0x00, 0x3C, 0xF8, 0x01, 0xE1, 0xF0, 0x0F, 0x87, 0xE0, 0xFC, 0x0F, 0xFF,
-  0xE0, 0x3F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00,
-  0x3C, 0x00, 0x3F, 0x07, 0x80, 0x1F, 0xF8, 0xF0, 0x0F, 0xFF, 0x3E, 0x03,
-  0xFF, 0xF7, 0x80, 0xFC, 0x1F, 0xF0, 0x3F, 0x00, 0xFE, 0x07, 0xC0, 0x0F,
-  0xC1, 0xF0, 0x01, 0xF0, 0x3C, 0x00, 0x3E, 0x0F, 0x80, 0x07, 0xC1, 0xE0,
-  0x00, 0x78, 0x3C, 0x00, 0x1F, 0x0F, 0x80, 0x03, 0xC1, 0xE0, 0x00, 0x78,
-  0x3C, 0x00, 0x0F, 0x07, 0x80, 0x01, 0xE0, 0xF0, 0x00, 0x7C, 0x1E, 0x00,
-  0x0F, 0x03, 0xC0, 0x03, 0xE0, 0x78, 0x00, 0x7C, 0x0F, 0x80, 0x1F, 0x80,
-  0xF8, 0x07, 0xF0, 0x1F, 0x83, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFE,
-  0xF0, 0x03, 0xFF, 0x1E, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x80,
-  0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0xFE, 0x0F, 0xC1,
-  0xF0, 0x07, 0xC7, 0xC0, 0x0F, 0x8F, 0x00, 0x0F, 0x3C, 0x00, 0x1E, 0x78,
-  0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
-  0x03, 0xC0, 0x00, 0x07, 0x80, 0x03, 0xCF, 0x80, 0x0F, 0x0F, 0x80, 0x3E,
-  0x1F, 0x81, 0xF8, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x1F, 0xFC, 0x00,
-  0x0F, 0xE0, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x07, 0xF8, 0x0F, 0xE0, 0x3E,
-  0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x7F, 0xF0, 0xFF, 0xE3,
-  0xFF, 0xC0, 0x78, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x3E,
-  0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x1E, 0x00,
-  0x3C, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E,
-  0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-  0xFE, 0x3C, 0x01, 0xFF, 0xE7, 0x00, 0xFF, 0xFE, 0xE0, 0x1F, 0x83, 0xFC,
-  0x07, 0xC0, 0x3F, 0x81, 0xF0, 0x03, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x00,
-  0x0F, 0x81, 0xE0, 0x01, 0xF0, 0x78, 0x00, 0x3E, 0x0F, 0x00, 0x07, 0xC1,
-  0xE0, 0x00, 0xF0, 0x38, 0x00, 0x1E, 0x0F, 0x00, 0x03, 0xC1, 0xE0, 0x00,
-  0xF8, 0x3C, 0x00, 0x1F, 0x07, 0x80, 0x03, 0xC0, 0xF0, 0x00, 0xF8, 0x1E,
-  0x00, 0x3F, 0x03, 0xE0, 0x07, 0xE0, 0x3E, 0x01, 0xF8, 0x07, 0xE0, 0xFF,
-  0x00, 0x7F, 0xFD, 0xE0, 0x0F, 0xFF, 0x3C, 0x00, 0xFF, 0xCF, 0x00, 0x07,
-  0xE1, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x03, 0xE0,
-  0x3C, 0x00, 0xF8, 0x07, 0xE0, 0x7F, 0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF,
-  0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x01, 0xE0, 0x00,
-  0x03, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x83, 0xF0, 0x0F,
-  0x1F, 0xF0, 0x1E, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xFF, 0x87, 0xE1, 0xFC,
-  0x07, 0xC3, 0xF0, 0x07, 0x87, 0xC0, 0x0F, 0x1F, 0x00, 0x1E, 0x3E, 0x00,
-  0x3C, 0x78, 0x00, 0x78, 0xF0, 0x01, 0xE1, 0xE0, 0x03, 0xC7, 0xC0, 0x07,
-  0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x78, 0x78, 0x00, 0xF1,
-  0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x0F, 0x8F, 0x00, 0x1E, 0x1E,
-  0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xC0, 0x01,
-  0xE0, 0x3C, 0x0F, 0x01, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0xC0,
-  0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
-  0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x00, 0x00, 0x07,
-  0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00,
-  0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
-  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00,
-  0x07, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
-  0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0,
-  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00,
-  0x78, 0x00, 0x3E, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x0F, 0xE0, 0x03, 0xE0,
-  0x00, 0x01, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
-  0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xC0, 0x0F, 0x81, 0xE0, 0x0F, 0x80,
-  0xF0, 0x0F, 0x80, 0xF0, 0x1F, 0x00, 0x78, 0x1F, 0x00, 0x3C, 0x1F, 0x00,
-  0x1E, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x0F, 0x1E, 0x00, 0x07, 0xBF, 0x80,
-  0x03, 0xFF, 0xC0, 0x01, 0xFD, 0xE0, 0x01, 0xFC, 0xF8, 0x00, 0xFC, 0x3C,
-  0x00, 0x7C, 0x1F, 0x00, 0x3C, 0x07, 0x80, 0x1E, 0x03, 0xC0, 0x1F, 0x01,
-  0xF0, 0x0F, 0x00, 0x78, 0x07, 0x80, 0x3E, 0x03, 0xC0, 0x0F, 0x01, 0xE0,
-  0x07, 0x81, 0xE0, 0x03, 0xE0, 0xF0, 0x00, 0xF0, 0x78, 0x00, 0x7C, 0x00,
-  0x01, 0xE0, 0x3C, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x3C, 0x07,
-  0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03,
-  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80,
-  0xF0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0xF0, 0x1E, 0x00, 0x00,
-  0x07, 0xE0, 0x1F, 0x80, 0xF9, 0xFF, 0x07, 0xFC, 0x0F, 0x3F, 0xF8, 0xFF,
-  0xE0, 0xF7, 0xFF, 0x9F, 0xFF, 0x0F, 0xF0, 0xFF, 0xC3, 0xF0, 0xFC, 0x07,
-  0xF8, 0x1F, 0x1F, 0x80, 0x3F, 0x00, 0xF1, 0xF0, 0x03, 0xE0, 0x0F, 0x1E,
-  0x00, 0x3C, 0x00, 0xF1, 0xE0, 0x03, 0xC0, 0x0F, 0x1E, 0x00, 0x3C, 0x00,
-  0xF1, 0xE0, 0x07, 0x80, 0x0F, 0x3C, 0x00, 0x78, 0x01, 0xF3, 0xC0, 0x07,
-  0x80, 0x1E, 0x3C, 0x00, 0x78, 0x01, 0xE3, 0xC0, 0x0F, 0x80, 0x1E, 0x3C,
-  0x00, 0xF0, 0x01, 0xE7, 0xC0, 0x0F, 0x00, 0x3C, 0x78, 0x00, 0xF0, 0x03,
-  0xC7, 0x80, 0x0F, 0x00, 0x3C, 0x78, 0x01, 0xE0, 0x03, 0xC7, 0x80, 0x1E,
-  0x00, 0x3C, 0xF8, 0x01, 0xE0, 0x07, 0x8F, 0x00, 0x1E, 0x00, 0x78, 0xF0,
-  0x01, 0xE0, 0x07, 0x8F, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x07, 0xE0, 0x1F,
-  0x3F, 0xF0, 0x3C, 0xFF, 0xF0, 0x7B, 0xFF, 0xE0, 0xFF, 0x07, 0xE1, 0xF8,
-  0x07, 0xC7, 0xE0, 0x07, 0x8F, 0x80, 0x0F, 0x1F, 0x00, 0x1E, 0x3C, 0x00,
-  0x3C, 0x78, 0x00, 0x78, 0xF0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07,
-  0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x3E, 0x3C, 0x00, 0x78, 0xF0, 0x00, 0xF1,
-  0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x0F, 0x8F, 0x00, 0x1E, 0x3E,
-  0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF1, 0xE0, 0x03, 0xC0, 0x00,
-  0x1F, 0x80, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0xFE,
-  0x0F, 0xC1, 0xF0, 0x0F, 0x87, 0xC0, 0x0F, 0x8F, 0x00, 0x0F, 0x3C, 0x00,
-  0x1E, 0x78, 0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xC0, 0x00, 0xF7, 0x80, 0x01,
-  0xFE, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x3D,
-  0xE0, 0x00, 0xF3, 0xC0, 0x01, 0xE7, 0x80, 0x07, 0x8F, 0x80, 0x1F, 0x0F,
-  0x80, 0x7C, 0x1F, 0x83, 0xF8, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x1F,
-  0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x3C, 0x7F, 0xE0,
-  0x07, 0xBF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x3D, 0xE0, 0xFC, 0x07, 0xF0,
-  0x0F, 0x80, 0xFC, 0x00, 0xF8, 0x1F, 0x00, 0x0F, 0x07, 0xC0, 0x01, 0xE0,
-  0xF8, 0x00, 0x3C, 0x1F, 0x00, 0x07, 0x83, 0xC0, 0x00, 0xF0, 0x78, 0x00,
-  0x1E, 0x1F, 0x00, 0x03, 0xC3, 0xC0, 0x00, 0xF0, 0x78, 0x00, 0x1E, 0x0F,
-  0x00, 0x03, 0xC3, 0xE0, 0x00, 0xF8, 0x7C, 0x00, 0x1E, 0x0F, 0x80, 0x07,
-  0xC1, 0xF8, 0x01, 0xF0, 0x3F, 0x80, 0x7C, 0x0F, 0xF8, 0x3F, 0x81, 0xEF,
-  0xFF, 0xE0, 0x3C, 0xFF, 0xF8, 0x07, 0x8F, 0xFC, 0x00, 0xF0, 0xFE, 0x00,
-  0x3E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E, 0x00,
-  0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x03,
-  0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-  0xF8, 0xF0, 0x1F, 0xFF, 0x3C, 0x0F, 0xFF, 0xDF, 0x07, 0xE0, 0xFF, 0x83,
-  0xE0, 0x1F, 0xE1, 0xF0, 0x03, 0xF8, 0x78, 0x00, 0xFE, 0x3C, 0x00, 0x1F,
-  0x8F, 0x00, 0x07, 0xC7, 0x80, 0x01, 0xF1, 0xE0, 0x00, 0x7C, 0x78, 0x00,
-  0x1F, 0x3C, 0x00, 0x0F, 0x8F, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0xF8, 0xF0,
-  0x00, 0x3E, 0x3C, 0x00, 0x1F, 0x8F, 0x00, 0x0F, 0xC3, 0xC0, 0x03, 0xF0,
-  0xF8, 0x01, 0xFC, 0x1F, 0x00, 0xFF, 0x07, 0xE0, 0xFF, 0xC0, 0xFF, 0xFD,
-  0xE0, 0x1F, 0xFE, 0x78, 0x03, 0xFF, 0x3E, 0x00, 0x3F, 0x0F, 0x80, 0x00,
-  0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x07, 0xC0, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3E,
-  0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x87, 0xCF, 0xC3, 0xCF, 0xE1, 0xEF,
-  0xE0, 0xFF, 0x80, 0x7F, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x0F,
-  0x00, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
-  0x78, 0x00, 0x3C, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80,
-  0x03, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00,
-  0x00, 0x3F, 0x80, 0x07, 0xFF, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0xFC,
-  0x1F, 0x87, 0x80, 0x3C, 0x7C, 0x01, 0xE3, 0xC0, 0x0F, 0x1E, 0x00, 0x00,
-  0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0xE0, 0x03, 0xFF,
-  0xC0, 0x07, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xBC,
-  0x00, 0x3D, 0xE0, 0x01, 0xEF, 0x00, 0x1F, 0x7C, 0x01, 0xF3, 0xF0, 0x1F,
-  0x8F, 0xFF, 0xF8, 0x7F, 0xFF, 0x80, 0xFF, 0xF0, 0x01, 0xFE, 0x00, 0x03,
-  0xC0, 0x1E, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC1, 0xFF, 0xEF, 0xFF,
-  0x7F, 0xF0, 0x78, 0x03, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
-  0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x3C, 0x01, 0xE0,
-  0x0F, 0x00, 0x78, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x0F, 0xF0, 0x7F, 0x81,
-  0xF8, 0x07, 0xC0, 0x0F, 0x00, 0x0F, 0x0F, 0x00, 0x1E, 0x0F, 0x00, 0x1E,
-  0x1F, 0x00, 0x1E, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x1E, 0x1E, 0x00, 0x3C,
-  0x1E, 0x00, 0x3C, 0x3E, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x3C,
-  0x3C, 0x00, 0x7C, 0x3C, 0x00, 0x78, 0x78, 0x00, 0x78, 0x78, 0x00, 0x78,
-  0x78, 0x00, 0x78, 0x78, 0x00, 0xF8, 0x78, 0x00, 0xF0, 0xF0, 0x01, 0xF0,
-  0xF0, 0x03, 0xF0, 0xF0, 0x07, 0xF0, 0xF8, 0x1F, 0xF0, 0xFF, 0xFF, 0xE0,
-  0x7F, 0xFD, 0xE0, 0x3F, 0xF1, 0xE0, 0x1F, 0xC0, 0x00, 0xF0, 0x00, 0x7F,
-  0xC0, 0x01, 0xEF, 0x00, 0x0F, 0xBC, 0x00, 0x3C, 0x78, 0x01, 0xE1, 0xE0,
-  0x07, 0x87, 0x80, 0x3C, 0x1E, 0x01, 0xF0, 0x78, 0x07, 0x81, 0xE0, 0x3E,
-  0x07, 0x80, 0xF0, 0x1E, 0x07, 0x80, 0x38, 0x1E, 0x00, 0xF0, 0xF0, 0x03,
-  0xC7, 0xC0, 0x0F, 0x1E, 0x00, 0x3C, 0xF0, 0x00, 0xF3, 0xC0, 0x03, 0xDE,
-  0x00, 0x07, 0x78, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00,
-  0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x07, 0xC0, 0x0F, 0x78, 0x03,
-  0xE0, 0x0F, 0xBC, 0x03, 0xF0, 0x07, 0x9E, 0x01, 0xF8, 0x03, 0xCF, 0x00,
-  0xFC, 0x03, 0xC7, 0x80, 0xFE, 0x01, 0xE3, 0xC0, 0x77, 0x01, 0xE0, 0xE0,
-  0x7B, 0x80, 0xF0, 0x70, 0x39, 0xC0, 0xF0, 0x38, 0x3C, 0xE0, 0x78, 0x1C,
-  0x1E, 0x78, 0x78, 0x0F, 0x1E, 0x3C, 0x3C, 0x07, 0x8F, 0x1E, 0x3C, 0x03,
-  0xC7, 0x0F, 0x1E, 0x01, 0xE7, 0x87, 0x9E, 0x00, 0xF3, 0x81, 0xCF, 0x00,
-  0x7B, 0xC0, 0xEF, 0x00, 0x3D, 0xC0, 0x77, 0x80, 0x1F, 0xE0, 0x3F, 0x80,
-  0x0F, 0xF0, 0x1F, 0xC0, 0x07, 0xF0, 0x0F, 0xC0, 0x01, 0xF8, 0x07, 0xE0,
-  0x00, 0xF8, 0x03, 0xE0, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0xF0,
-  0x00, 0x00, 0x03, 0xC0, 0x07, 0xC0, 0xF8, 0x01, 0xE0, 0x1E, 0x00, 0xF0,
-  0x07, 0x80, 0x78, 0x00, 0xF0, 0x3C, 0x00, 0x3C, 0x1F, 0x00, 0x0F, 0x8F,
-  0x80, 0x01, 0xE7, 0xC0, 0x00, 0x7D, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
-  0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xC0, 0x00,
-  0x07, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xF7, 0x80, 0x00, 0xF9, 0xF0,
-  0x00, 0x3C, 0x3C, 0x00, 0x1E, 0x0F, 0x80, 0x0F, 0x01, 0xE0, 0x07, 0x80,
-  0x7C, 0x03, 0xE0, 0x0F, 0x01, 0xF0, 0x03, 0xE0, 0xF8, 0x00, 0x78, 0x00,
-  0x03, 0xC0, 0x01, 0xE0, 0x78, 0x00, 0x78, 0x0F, 0x00, 0x0F, 0x01, 0xE0,
-  0x03, 0xC0, 0x3C, 0x00, 0x78, 0x07, 0xC0, 0x1E, 0x00, 0x78, 0x07, 0xC0,
-  0x0F, 0x00, 0xF0, 0x01, 0xE0, 0x3C, 0x00, 0x3C, 0x07, 0x80, 0x07, 0x81,
-  0xE0, 0x00, 0xF0, 0x3C, 0x00, 0x1E, 0x0F, 0x00, 0x03, 0xC1, 0xC0, 0x00,
-  0x3C, 0x78, 0x00, 0x07, 0x9E, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x1E, 0xF0,
-  0x00, 0x03, 0xDE, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 0x01,
-  0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x78, 0x00,
-  0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-  0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xE0,
-  0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0,
-  0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
-  0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-  0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
-  0x00, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE0, 0xFF,
-  0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0xFE,
-  0x00, 0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
-  0x07, 0x80, 0x0F, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x00,
-  0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
-  0x38, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x78, 0x00,
-  0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xE0, 0x00,
-  0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x70,
-  0x07, 0x00, 0x60, 0x06, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0C, 0x01, 0xC0,
-  0x1C, 0x01, 0xC0, 0x1C, 0x01, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x00,
-  0x30, 0x07, 0x00, 0x70, 0x07, 0x00, 0x60, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-  0xE0, 0x0C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0x80, 0x38, 0x03,
-  0x80, 0x38, 0x03, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x60, 0x0E,
-  0x00, 0xE0, 0x06, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x0F,
-  0x00, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1E,
-  0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x1C,
-  0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0F,
-  0x00, 0x07, 0x00, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF0,
-  0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xC0,
-  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
-  0x0F, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x01, 0xFE,
-  0x00, 0xCF, 0xFC, 0x0E, 0xE3, 0xF0, 0xE6, 0x07, 0xFF, 0x60, 0x0F, 0xF0,
-  0x00, 0x1E, 0x00 };
+  0x74, 0x74, 0x65, 0x64, 0x74, 0x74, 0x74, 0x64, 0x74, 0x74, 0x74, 0x74,
+  0x64, 0x74, 0x74, 0x74, 0x74, 0x64, 0x74, 0x74, 0x74, 0x73, 0x83, 0x83,
+  0x82, 0x92, 0xFF, 0xA4, 0x74, 0x64, 0x74, 0x74, 0x70, 0x14, 0x44, 0x14,
+  0x44, 0x14, 0x48, 0x44, 0x14, 0x44, 0x14, 0x44, 0x14, 0x44, 0x13, 0x53,
+  0x23, 0x53, 0x23, 0x53, 0x22, 0x62, 0x32, 0x62, 0x30, 0xD4, 0x63, 0xF0,
+  0x45, 0x4F, 0x03, 0x64, 0xE4, 0x63, 0xF0, 0x36, 0x4E, 0x46, 0x3F, 0x04,
+  0x54, 0xF0, 0x36, 0x4E, 0x46, 0x39, 0xF8, 0x5F, 0x85, 0xF8, 0xA3, 0x64,
+  0xE4, 0x63, 0xF0, 0x45, 0x4F, 0x03, 0x64, 0xE4, 0x63, 0xF0, 0x36, 0x4E,
+  0x46, 0x3F, 0x04, 0x54, 0xF0, 0x36, 0x49, 0xF8, 0x5F, 0x85, 0xF8, 0x94,
+  0x63, 0xF0, 0x36, 0x4E, 0x46, 0x3F, 0x03, 0x64, 0xF0, 0x36, 0x4E, 0x46,
+  0x3F, 0x03, 0x64, 0xE4, 0x63, 0xF0, 0x45, 0x4F, 0x03, 0x64, 0xE0, 0xF1,
+  0x3F, 0x82, 0xF6, 0x8F, 0x0D, 0xCF, 0x09, 0xF3, 0x85, 0x32, 0x35, 0x75,
+  0x33, 0x45, 0x55, 0x43, 0x54, 0x54, 0x53, 0x54, 0x53, 0x63, 0x54, 0x44,
+  0x62, 0x64, 0x44, 0x53, 0xE4, 0x53, 0xE4, 0x53, 0xE5, 0x43, 0xE7, 0x22,
+  0xF1, 0xBF, 0x1D, 0xF0, 0xDF, 0x0C, 0xF1, 0xBE, 0x33, 0x7D, 0x35, 0x5D,
+  0x36, 0x4D, 0x27, 0x42, 0x46, 0x37, 0x42, 0x46, 0x37, 0x42, 0x46, 0x37,
+  0x33, 0x46, 0x36, 0x43, 0x46, 0x27, 0x43, 0x54, 0x36, 0x44, 0x54, 0x35,
+  0x46, 0x62, 0x32, 0x68, 0xF2, 0xAF, 0x0E, 0x9F, 0x43, 0xF8, 0x3F, 0x82,
+  0xF8, 0x3F, 0x83, 0xF1, 0xFE, 0x4A, 0x5F, 0x23, 0x99, 0xE3, 0x9B, 0xC3,
+  0x94, 0x44, 0xB4, 0x83, 0x74, 0xA3, 0x83, 0x93, 0x93, 0x93, 0x93, 0x83,
+  0x93, 0xA3, 0x73, 0xA3, 0xA3, 0x64, 0xA3, 0x93, 0x73, 0xB3, 0x93, 0x63,
+  0xC4, 0x73, 0x63, 0xE4, 0x45, 0x54, 0xEC, 0x63, 0xF1, 0x97, 0x3F, 0x45,
+  0x83, 0xFF, 0x23, 0xFF, 0x24, 0x85, 0xF4, 0x37, 0x9F, 0x13, 0x7B, 0xE3,
+  0x74, 0x44, 0xD4, 0x63, 0x74, 0xC3, 0x63, 0x93, 0xB3, 0x73, 0x93, 0xA3,
+  0x73, 0xA3, 0x93, 0x83, 0xA3, 0x84, 0x83, 0x93, 0x93, 0x93, 0x93, 0x83,
+  0xA4, 0x73, 0x83, 0xC4, 0x45, 0x73, 0xDC, 0x83, 0xE9, 0x93, 0xF2, 0x57,
+  0xF0, 0x6F, 0x2A, 0xF0, 0xCD, 0x54, 0x5B, 0x47, 0x4B, 0x47, 0x4A, 0x48,
+  0x4A, 0x48, 0x4A, 0x47, 0x4B, 0x47, 0x4B, 0x54, 0x5D, 0x43, 0x5E, 0xBF,
+  0x19, 0xF2, 0x7F, 0x28, 0xF1, 0xAF, 0x06, 0x15, 0x63, 0x45, 0x45, 0x53,
+  0x35, 0x55, 0x43, 0x34, 0x85, 0x33, 0x24, 0xA4, 0x24, 0x24, 0xA9, 0x24,
+  0xC7, 0x34, 0xC7, 0x34, 0xD5, 0x44, 0xD5, 0x45, 0xB7, 0x35, 0x99, 0x37,
+  0x56, 0x15, 0x3F, 0x13, 0x44, 0xE4, 0x54, 0xB7, 0x46, 0x7E, 0x14, 0x14,
+  0x18, 0x14, 0x14, 0x14, 0x13, 0x23, 0x23, 0x22, 0x32, 0x30, 0xC3, 0xB3,
+  0xB3, 0xB3, 0xC3, 0xB3, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4,
+  0xB3, 0xC3, 0xB3, 0xC3, 0xC3, 0xB3, 0xC3, 0xC3, 0xC3, 0xB4, 0xB3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xD2, 0xD3,
+  0xC3, 0xC3, 0xD2, 0xD3, 0xC3, 0xD2, 0xA0, 0xA2, 0xD3, 0xC3, 0xD2, 0xD3,
+  0xC3, 0xC3, 0xC3, 0xD3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xB4, 0xB3, 0xC3, 0xC3, 0xB4, 0xB3, 0xC3, 0xC3, 0xB3,
+  0xC3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB3, 0xB3, 0xC3,
+  0xB3, 0xB3, 0xB3, 0xC0, 0x73, 0xB3, 0xA3, 0x62, 0x33, 0x32, 0x14, 0x13,
+  0x1F, 0x32, 0xA7, 0x48, 0x76, 0x41, 0x35, 0x42, 0x44, 0x34, 0x35, 0x15,
+  0x24, 0xC3, 0xF5, 0x3F, 0x44, 0xF4, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF4,
+  0x3A, 0xFF, 0xFF, 0xFF, 0x1A, 0x3F, 0x53, 0xF5, 0x3F, 0x44, 0xF4, 0x3F,
+  0x53, 0xF5, 0x3F, 0x53, 0xF4, 0x3F, 0x53, 0xD0, 0x25, 0x25, 0x25, 0x24,
+  0x25, 0x52, 0x52, 0x42, 0x52, 0x42, 0x34, 0x32, 0x50, 0x1F, 0xFF, 0x11,
+  0x15, 0x15, 0x14, 0x15, 0x15, 0x10, 0xF4, 0x2F, 0x33, 0xF2, 0x3F, 0x33,
+  0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x32, 0xF3, 0x3F, 0x32, 0xF3, 0x3F, 0x32,
+  0xF3, 0x3F, 0x32, 0xF3, 0x3F, 0x32, 0xF3, 0x3F, 0x32, 0xF3, 0x3F, 0x32,
+  0xF3, 0x3F, 0x32, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x2F, 0x33,
+  0xF3, 0x2F, 0x33, 0xF3, 0x2F, 0x33, 0xF3, 0x2F, 0x33, 0xF3, 0x2F, 0x30,
+  0xC6, 0xEB, 0xBD, 0x9F, 0x07, 0x64, 0x66, 0x58, 0x46, 0x49, 0x54, 0x4B,
+  0x43, 0x5B, 0x43, 0x4C, 0x43, 0x4C, 0x42, 0x4D, 0x42, 0x4D, 0x42, 0x4C,
+  0x51, 0x4D, 0x51, 0x4D, 0x42, 0x4D, 0x42, 0x4D, 0x42, 0x4D, 0x41, 0x4D,
+  0x51, 0x4D, 0x51, 0x4D, 0x42, 0x4D, 0x42, 0x4C, 0x52, 0x4C, 0x43, 0x4B,
+  0x53, 0x4B, 0x44, 0x59, 0x54, 0x58, 0x56, 0x64, 0x67, 0xF0, 0x9D, 0xBB,
+  0xE6, 0xC0, 0xB2, 0xA3, 0x93, 0x94, 0x85, 0x49, 0x1C, 0x1B, 0x2B, 0x94,
+  0x94, 0x85, 0x84, 0x94, 0x94, 0x94, 0x85, 0x84, 0x94, 0x94, 0x94, 0x85,
+  0x84, 0x94, 0x94, 0x94, 0x85, 0x84, 0x94, 0x94, 0x94, 0x85, 0x84, 0x70,
+  0xE8, 0xF1, 0xDD, 0xF0, 0xBF, 0x29, 0x66, 0x68, 0x5A, 0x56, 0x5B, 0x56,
+  0x5C, 0x46, 0x4D, 0x45, 0x5D, 0x45, 0x4E, 0x4F, 0x74, 0xF8, 0x4F, 0x75,
+  0xF6, 0x5F, 0x65, 0xF5, 0x6F, 0x47, 0xF3, 0x7F, 0x37, 0xF3, 0x7F, 0x37,
+  0xF4, 0x6F, 0x56, 0xF5, 0x5F, 0x65, 0xF6, 0x5F, 0x74, 0xF7, 0x4F, 0x8F,
+  0x74, 0xF7, 0x5F, 0x75, 0xF7, 0x50, 0xD7, 0xF0, 0xCB, 0xF0, 0x9F, 0x28,
+  0x66, 0x66, 0x59, 0x55, 0x5B, 0x45, 0x4C, 0x44, 0x5C, 0x44, 0x4D, 0x4F,
+  0x54, 0xF6, 0x4F, 0x54, 0xF3, 0x7D, 0xAF, 0x09, 0xF1, 0xAE, 0xCF, 0x46,
+  0xF6, 0x5F, 0x64, 0xF6, 0x4F, 0x64, 0x24, 0xF0, 0x42, 0x4F, 0x04, 0x24,
+  0xE4, 0x34, 0xE4, 0x34, 0xD4, 0x45, 0xA6, 0x56, 0x67, 0x6F, 0x38, 0xF1,
+  0xAD, 0xE8, 0xC0, 0xF5, 0x3F, 0x54, 0xF4, 0x5F, 0x36, 0xF2, 0x7F, 0x17,
+  0xF1, 0x8F, 0x04, 0x14, 0xE5, 0x14, 0xD5, 0x15, 0xC5, 0x24, 0xC5, 0x34,
+  0xB5, 0x44, 0xB4, 0x54, 0xA4, 0x54, 0xA4, 0x64, 0x94, 0x74, 0x84, 0x84,
+  0x74, 0x85, 0x64, 0x94, 0x64, 0xA4, 0x6F, 0x81, 0xFF, 0xF1, 0x1F, 0x8F,
+  0x04, 0xF5, 0x4F, 0x54, 0xF4, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF4, 0x57,
+  0x9F, 0x29, 0xF3, 0x9F, 0x39, 0xF3, 0x84, 0xF8, 0x4F, 0x84, 0xF7, 0x4F,
+  0x84, 0xF8, 0x4F, 0x74, 0xF8, 0x43, 0x6D, 0x41, 0xCA, 0xF3, 0x9F, 0x47,
+  0x77, 0x67, 0x5A, 0x66, 0x4C, 0x5F, 0x84, 0xF8, 0x4F, 0x84, 0xF8, 0x4F,
+  0x84, 0xF8, 0x3F, 0x84, 0x44, 0xF0, 0x44, 0x4E, 0x45, 0x5C, 0x46, 0x5B,
+  0x57, 0x67, 0x68, 0xF3, 0xAF, 0x1C, 0xDF, 0x27, 0xE0, 0xD6, 0xF0, 0xBC,
+  0xDA, 0xF0, 0x86, 0x55, 0x75, 0x85, 0x55, 0x95, 0x45, 0xB4, 0x44, 0xC4,
+  0x35, 0xF4, 0x4F, 0x54, 0xF4, 0x45, 0x69, 0x43, 0xA7, 0x41, 0xD5, 0x41,
+  0xF0, 0x49, 0x56, 0x47, 0x95, 0x36, 0xA5, 0x26, 0xC4, 0x25, 0xD4, 0x25,
+  0xD4, 0x24, 0xE4, 0x24, 0xE3, 0x34, 0xD4, 0x34, 0xD4, 0x34, 0xC4, 0x45,
+  0xA5, 0x55, 0x85, 0x66, 0x56, 0x8F, 0x18, 0xF0, 0xBB, 0xF0, 0x7B, 0x3F,
+  0x74, 0xF7, 0x4F, 0x73, 0xF8, 0xF6, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF6,
+  0x4F, 0x64, 0xF7, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF6, 0x4F, 0x74, 0xF6,
+  0x4F, 0x64, 0xF6, 0x5F, 0x64, 0xF6, 0x4F, 0x65, 0xF6, 0x4F, 0x65, 0xF6,
+  0x4F, 0x64, 0xF7, 0x4F, 0x64, 0xF7, 0x4F, 0x64, 0xF7, 0x4F, 0x65, 0xF6,
+  0x4F, 0x60, 0xD7, 0xF0, 0xCC, 0xEA, 0xF1, 0x86, 0x66, 0x65, 0x95, 0x64,
+  0xB4, 0x54, 0xC4, 0x54, 0xC4, 0x54, 0xC4, 0x54, 0xB4, 0x65, 0x94, 0x76,
+  0x65, 0x9F, 0x0B, 0xDC, 0xDA, 0xF1, 0x86, 0x66, 0x65, 0xA4, 0x54, 0xC5,
+  0x35, 0xD4, 0x34, 0xE4, 0x24, 0xF0, 0x42, 0x4F, 0x04, 0x24, 0xF0, 0x33,
+  0x4E, 0x43, 0x4E, 0x43, 0x5C, 0x44, 0x6A, 0x55, 0x66, 0x76, 0xF3, 0x8F,
+  0x1B, 0xCF, 0x08, 0xB0, 0xB7, 0xF0, 0xBB, 0xF0, 0x8F, 0x17, 0x75, 0x66,
+  0x58, 0x55, 0x5A, 0x54, 0x4C, 0x43, 0x4D, 0x43, 0x4D, 0x42, 0x4E, 0x42,
+  0x4E, 0x42, 0x4D, 0x52, 0x4D, 0x52, 0x4C, 0x62, 0x5A, 0x63, 0x59, 0x74,
+  0x65, 0x94, 0xF5, 0x5D, 0x14, 0x7A, 0x34, 0x96, 0x45, 0xF4, 0x5F, 0x44,
+  0xF4, 0x5F, 0x44, 0x44, 0xB5, 0x44, 0xA5, 0x55, 0x85, 0x66, 0x57, 0x7F,
+  0x19, 0xDC, 0xBF, 0x07, 0xC0, 0x55, 0x55, 0x54, 0x55, 0x55, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x25, 0x55, 0x54, 0x55, 0x55, 0x50, 0x65, 0x65, 0x64,
+  0x65, 0x65, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x56, 0x56, 0x56, 0x46,
+  0x59, 0x29, 0x28, 0x29, 0x28, 0x27, 0x47, 0x29, 0xFA, 0x1F, 0x83, 0xF5,
+  0x5F, 0x47, 0xF1, 0x9E, 0x9F, 0x09, 0xE9, 0xF0, 0x9E, 0x9F, 0x17, 0xF3,
+  0x6F, 0x57, 0xF5, 0x8F, 0x58, 0xF5, 0x8F, 0x59, 0xF4, 0x9F, 0x49, 0xF4,
+  0x9F, 0x56, 0xF7, 0x3F, 0xA1, 0x50, 0x3F, 0x83, 0xF7, 0x3F, 0x83, 0xF8,
+  0xFF, 0xFF, 0xFF, 0xF1, 0xF8, 0x3F, 0x83, 0xF7, 0x4F, 0x73, 0x51, 0xFA,
+  0x3F, 0x76, 0xF5, 0x9F, 0x49, 0xF4, 0x9F, 0x49, 0xF5, 0x8F, 0x58, 0xF5,
+  0x8F, 0x57, 0xF5, 0x6F, 0x37, 0xF1, 0x9E, 0x9F, 0x09, 0xE9, 0xF0, 0x9E,
+  0x9F, 0x17, 0xF4, 0x5F, 0x53, 0xF8, 0x1F, 0xA0, 0x87, 0xBB, 0x7E, 0x5F,
+  0x14, 0x56, 0x53, 0x58, 0x51, 0x5A, 0x41, 0x4B, 0x41, 0x4B, 0x8C, 0x8B,
+  0x5F, 0x04, 0xF0, 0x5E, 0x5E, 0x5E, 0x5E, 0x5D, 0x6D, 0x6E, 0x5E, 0x5E,
+  0x5F, 0x04, 0xF1, 0x4F, 0x05, 0xF0, 0x4F, 0xFF, 0xFF, 0xF5, 0x4F, 0x14,
+  0xF1, 0x4F, 0x14, 0xF0, 0x5D, 0xF8, 0xAF, 0xF1, 0xF2, 0xFB, 0xF6, 0xF7,
+  0xFA, 0xF3, 0xA9, 0x9F, 0x08, 0xF0, 0x8D, 0x7F, 0x47, 0xB6, 0xF7, 0x6A,
+  0x6F, 0xA5, 0x86, 0xFB, 0x57, 0x5B, 0x6C, 0x55, 0x5A, 0xA2, 0x44, 0x55,
+  0x49, 0xC2, 0x45, 0x44, 0x58, 0x64, 0x86, 0x43, 0x58, 0x57, 0x67, 0x43,
+  0x48, 0x58, 0x67, 0x42, 0x57, 0x59, 0x58, 0x42, 0x48, 0x4A, 0x58, 0x41,
+  0x57, 0x4B, 0x48, 0x51, 0x47, 0x5A, 0x58, 0x42, 0x47, 0x4B, 0x49, 0x42,
+  0x38, 0x4B, 0x48, 0x51, 0x47, 0x4B, 0x49, 0x42, 0x47, 0x4B, 0x48, 0x52,
+  0x47, 0x4A, 0x48, 0x53, 0x47, 0x49, 0x57, 0x63, 0x47, 0x48, 0x57, 0x64,
+  0x47, 0x56, 0x66, 0x65, 0x48, 0x54, 0x83, 0x67, 0x57, 0xB1, 0xD9, 0x48,
+  0x93, 0xAB, 0x49, 0x65, 0x8D, 0x5F, 0xFB, 0x5F, 0xFA, 0x6F, 0xFA, 0x6F,
+  0xFA, 0x7F, 0xF9, 0x99, 0x5F, 0x8F, 0x7F, 0xAF, 0x6F, 0xBF, 0x2F, 0xF1,
+  0xAF, 0x70, 0xF4, 0x6F, 0x87, 0xF8, 0x7F, 0x78, 0xF6, 0xAF, 0x54, 0x15,
+  0xF4, 0x42, 0x5F, 0x44, 0x25, 0xF3, 0x43, 0x5F, 0x34, 0x35, 0xF2, 0x45,
+  0x4F, 0x15, 0x54, 0xF1, 0x46, 0x5E, 0x47, 0x5E, 0x47, 0x5D, 0x48, 0x5D,
+  0x48, 0x5C, 0x49, 0x5B, 0x5A, 0x4B, 0x4B, 0x59, 0xF6, 0x9F, 0x68, 0xF7,
+  0x8F, 0x77, 0x5D, 0x56, 0x5F, 0x04, 0x65, 0xF0, 0x54, 0x5F, 0x15, 0x44,
+  0xF2, 0x53, 0x5F, 0x25, 0x34, 0xF3, 0x52, 0x5F, 0x35, 0x15, 0xF5, 0x41,
+  0x5F, 0x55, 0x7F, 0x2C, 0xF4, 0xAF, 0x68, 0xF6, 0x75, 0xC6, 0x64, 0xE5,
+  0x64, 0xF0, 0x46, 0x4F, 0x04, 0x64, 0xF0, 0x45, 0x4F, 0x14, 0x54, 0xF0,
+  0x46, 0x4F, 0x04, 0x64, 0xE4, 0x65, 0xC5, 0x7F, 0x59, 0xF4, 0xAF, 0x58,
+  0xF8, 0x64, 0xE5, 0x64, 0xF0, 0x55, 0x4F, 0x14, 0x54, 0xF1, 0x44, 0x4F,
+  0x24, 0x44, 0xF2, 0x44, 0x4F, 0x24, 0x44, 0xF1, 0x44, 0x5F, 0x14, 0x44,
+  0xF1, 0x54, 0x4F, 0x05, 0x54, 0xD6, 0x6F, 0x76, 0xF7, 0x7F, 0x68, 0xF4,
+  0xA0, 0xF0, 0x8F, 0x4D, 0xF0, 0xF2, 0xCF, 0x4A, 0x77, 0x69, 0x6B, 0x57,
+  0x5E, 0x46, 0x5F, 0x04, 0x64, 0xF2, 0x44, 0x4F, 0x34, 0x35, 0xF3, 0x43,
+  0x4F, 0xA4, 0xFB, 0x4F, 0xB4, 0xFA, 0x4F, 0xB4, 0xFB, 0x4F, 0xA4, 0xFB,
+  0x4F, 0xB4, 0xFB, 0x4F, 0xB4, 0xFB, 0x4F, 0x54, 0x24, 0xF4, 0x52, 0x4F,
+  0x44, 0x35, 0xF2, 0x53, 0x5F, 0x24, 0x55, 0xF0, 0x55, 0x5E, 0x57, 0x5B,
+  0x68, 0x77, 0x7A, 0xF4, 0xCF, 0x2E, 0xEF, 0x48, 0xE0, 0x7F, 0x2E, 0xF4,
+  0xCF, 0x5A, 0xF7, 0x95, 0xB7, 0x84, 0xE6, 0x74, 0xF0, 0x56, 0x5F, 0x14,
+  0x65, 0xF1, 0x55, 0x4F, 0x34, 0x54, 0xF3, 0x45, 0x4F, 0x34, 0x45, 0xF3,
+  0x44, 0x5F, 0x34, 0x44, 0xF4, 0x44, 0x4F, 0x44, 0x44, 0xF3, 0x44, 0x5F,
+  0x34, 0x45, 0xF3, 0x44, 0x4F, 0x44, 0x44, 0xF3, 0x44, 0x5F, 0x34, 0x45,
+  0xF2, 0x54, 0x4F, 0x34, 0x54, 0xF2, 0x55, 0x4F, 0x24, 0x55, 0xF1, 0x46,
+  0x5F, 0x05, 0x64, 0xE6, 0x74, 0xC7, 0x8F, 0x78, 0xF7, 0x9F, 0x5B, 0xF2,
+  0xE0, 0x7F, 0x97, 0xF9, 0x7F, 0x87, 0xF9, 0x75, 0xFB, 0x4F, 0xC4, 0xFB,
+  0x5F, 0xB5, 0xFB, 0x4F, 0xC4, 0xFC, 0x4F, 0xB5, 0xFB, 0x5F, 0xB4, 0xFC,
+  0xF8, 0x8F, 0x87, 0xF8, 0x8F, 0x88, 0x4F, 0xC4, 0xFB, 0x5F, 0xB5, 0xFB,
+  0x4F, 0xC4, 0xFC, 0x4F, 0xB5, 0xFB, 0x5F, 0xB4, 0xFC, 0x4F, 0xCF, 0x96,
+  0xFA, 0x6F, 0xA6, 0xF9, 0x70, 0x7F, 0x87, 0xF8, 0x7F, 0x86, 0xF8, 0x75,
+  0xFA, 0x4F, 0xB4, 0xFA, 0x5F, 0xA5, 0xFA, 0x4F, 0xB4, 0xFB, 0x4F, 0xA5,
+  0xFA, 0x5F, 0xA4, 0xFB, 0xF5, 0xAF, 0x59, 0xF6, 0x9F, 0x69, 0x4F, 0xB4,
+  0xFA, 0x5F, 0xA5, 0xFA, 0x4F, 0xB4, 0xFB, 0x4F, 0xA5, 0xFA, 0x5F, 0xA4,
+  0xFB, 0x4F, 0xB4, 0xFA, 0x5F, 0xA4, 0xFB, 0x4F, 0xB0, 0xF2, 0x9F, 0x6E,
+  0xF1, 0xF4, 0xDF, 0x6B, 0x78, 0x88, 0x6E, 0x57, 0x6F, 0x15, 0x64, 0xF3,
+  0x55, 0x4F, 0x54, 0x45, 0xF5, 0x44, 0x4F, 0xD4, 0xFD, 0x5F, 0xD4, 0xFE,
+  0x4F, 0xD4, 0xFE, 0x4F, 0xE4, 0xDE, 0x14, 0xEE, 0x14, 0xDF, 0x01, 0x4D,
+  0xF0, 0x14, 0xF9, 0x32, 0x4F, 0x93, 0x24, 0xF8, 0x42, 0x4F, 0x84, 0x24,
+  0xF7, 0x52, 0x5F, 0x65, 0x34, 0xF5, 0x54, 0x5F, 0x36, 0x46, 0xF1, 0x75,
+  0x6D, 0x95, 0x88, 0x71, 0x46, 0xF5, 0x33, 0x9F, 0x24, 0x3A, 0xE6, 0x3D,
+  0x8F, 0x10, 0x74, 0xF3, 0x47, 0x4F, 0x34, 0x74, 0xF2, 0x56, 0x5F, 0x25,
+  0x65, 0xF2, 0x47, 0x4F, 0x34, 0x74, 0xF3, 0x46, 0x5F, 0x25, 0x65, 0xF2,
+  0x56, 0x4F, 0x34, 0x74, 0xF3, 0x47, 0x4F, 0x34, 0x65, 0xF2, 0x56, 0x5F,
+  0x25, 0x64, 0xF3, 0x47, 0xFB, 0x7F, 0xB6, 0xFC, 0x6F, 0xB7, 0x4F, 0x34,
+  0x74, 0xF3, 0x46, 0x5F, 0x25, 0x65, 0xF2, 0x56, 0x4F, 0x34, 0x74, 0xF3,
+  0x47, 0x4F, 0x34, 0x65, 0xF2, 0x56, 0x5F, 0x24, 0x74, 0xF3, 0x47, 0x4F,
+  0x34, 0x74, 0xF2, 0x56, 0x5F, 0x25, 0x64, 0xF3, 0x47, 0x4F, 0x34, 0x70,
+  0x65, 0x65, 0x65, 0x64, 0x74, 0x74, 0x65, 0x65, 0x64, 0x74, 0x74, 0x65,
+  0x65, 0x64, 0x74, 0x74, 0x65, 0x65, 0x64, 0x74, 0x74, 0x65, 0x65, 0x64,
+  0x74, 0x74, 0x65, 0x65, 0x64, 0x74, 0x74, 0x65, 0x65, 0x64, 0x70, 0xF6,
+  0x4F, 0x64, 0xF5, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF5, 0x5F, 0x54, 0xF6,
+  0x4F, 0x64, 0xF6, 0x4F, 0x55, 0xF5, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF5,
+  0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF5, 0x5F, 0x54, 0xF6, 0x46, 0x4B, 0x46,
+  0x4B, 0x45, 0x4B, 0x55, 0x4B, 0x46, 0x4B, 0x46, 0x4A, 0x56, 0x58, 0x57,
+  0x65, 0x69, 0xF1, 0xAE, 0xCB, 0xF1, 0x7D, 0x74, 0xF2, 0x67, 0x4F, 0x15,
+  0x94, 0xF0, 0x59, 0x5D, 0x6A, 0x5C, 0x6B, 0x4C, 0x6C, 0x4B, 0x5D, 0x5A,
+  0x5E, 0x58, 0x6F, 0x04, 0x86, 0xF1, 0x47, 0x5F, 0x34, 0x65, 0xF3, 0x55,
+  0x5F, 0x45, 0x36, 0xF5, 0x43, 0x7F, 0x54, 0x28, 0xF5, 0x41, 0xAF, 0x3A,
+  0x15, 0xF3, 0x84, 0x4F, 0x37, 0x55, 0xF2, 0x67, 0x4F, 0x16, 0x85, 0xF0,
+  0x5A, 0x4F, 0x04, 0xB5, 0xE4, 0xB5, 0xE4, 0xC5, 0xC5, 0xC5, 0xC5, 0xD5,
+  0xB4, 0xE5, 0xB4, 0xF0, 0x5A, 0x4F, 0x05, 0x95, 0xF1, 0x58, 0x4F, 0x25,
+  0x84, 0xF3, 0x57, 0x74, 0xF3, 0x4F, 0x34, 0xF2, 0x5F, 0x25, 0xF2, 0x4F,
+  0x34, 0xF2, 0x5F, 0x25, 0xF2, 0x4F, 0x34, 0xF3, 0x4F, 0x25, 0xF2, 0x5F,
+  0x24, 0xF3, 0x4F, 0x34, 0xF2, 0x5F, 0x24, 0xF3, 0x4F, 0x34, 0xF2, 0x5F,
+  0x25, 0xF2, 0x4F, 0x34, 0xF3, 0x4F, 0x25, 0xF2, 0x5F, 0x24, 0xF3, 0x4F,
+  0x3F, 0xFF, 0xF4, 0x1F, 0x61, 0x76, 0xF5, 0x67, 0x7F, 0x37, 0x68, 0xF3,
+  0x76, 0x8F, 0x28, 0x68, 0xF2, 0x77, 0x8F, 0x18, 0x78, 0xF1, 0x31, 0x46,
+  0x9F, 0x09, 0x64, 0x14, 0xE4, 0x14, 0x74, 0x24, 0xD4, 0x14, 0x74, 0x24,
+  0xC4, 0x24, 0x74, 0x24, 0xC4, 0x24, 0x65, 0x24, 0xB4, 0x25, 0x64, 0x34,
+  0xB4, 0x24, 0x74, 0x34, 0xA4, 0x34, 0x74, 0x34, 0xA3, 0x44, 0x65, 0x34,
+  0x94, 0x44, 0x64, 0x54, 0x74, 0x45, 0x64, 0x54, 0x74, 0x44, 0x74, 0x54,
+  0x64, 0x54, 0x74, 0x54, 0x64, 0x54, 0x65, 0x54, 0x54, 0x55, 0x64, 0x64,
+  0x54, 0x54, 0x74, 0x64, 0x44, 0x64, 0x74, 0x64, 0x43, 0x74, 0x74, 0x74,
+  0x24, 0x74, 0x65, 0x74, 0x23, 0x75, 0x64, 0x84, 0x14, 0x74, 0x74, 0x88,
+  0x84, 0x74, 0x88, 0x84, 0x65, 0x87, 0x94, 0x64, 0x97, 0x85, 0x64, 0x96,
+  0x94, 0x74, 0xA4, 0xA4, 0x70, 0x75, 0xF3, 0x47, 0x6F, 0x15, 0x67, 0xF1,
+  0x47, 0x7F, 0x14, 0x78, 0xF0, 0x47, 0x8E, 0x57, 0x9D, 0x47, 0xAD, 0x47,
+  0x42, 0x4D, 0x47, 0x42, 0x5C, 0x47, 0x43, 0x4B, 0x57, 0x43, 0x5A, 0x47,
+  0x54, 0x4A, 0x47, 0x45, 0x59, 0x47, 0x45, 0x59, 0x47, 0x46, 0x48, 0x56,
+  0x56, 0x57, 0x47, 0x48, 0x47, 0x47, 0x48, 0x56, 0x47, 0x48, 0x55, 0x57,
+  0x49, 0x54, 0x47, 0x59, 0x54, 0x47, 0x4B, 0x44, 0x47, 0x4B, 0x53, 0x47,
+  0x4C, 0x42, 0x57, 0x4C, 0x51, 0x47, 0x5C, 0x51, 0x47, 0x4E, 0x97, 0x4E,
+  0x97, 0x4F, 0x08, 0x65, 0xF0, 0x77, 0x4F, 0x26, 0x74, 0xF2, 0x67, 0x4F,
+  0x26, 0x70, 0xF1, 0x8F, 0x7E, 0xF2, 0xF2, 0xEF, 0x6B, 0x87, 0x7A, 0x6C,
+  0x68, 0x5F, 0x06, 0x65, 0xF2, 0x55, 0x5F, 0x44, 0x54, 0xF5, 0x53, 0x5F,
+  0x64, 0x34, 0xF7, 0x42, 0x4F, 0x84, 0x24, 0xF8, 0x41, 0x4F, 0x94, 0x14,
+  0xF9, 0x41, 0x4F, 0x98, 0xF9, 0x9F, 0x94, 0x14, 0xF9, 0x41, 0x4F, 0x94,
+  0x14, 0xF8, 0x51, 0x4F, 0x84, 0x24, 0xF8, 0x42, 0x4F, 0x75, 0x24, 0xF7,
+  0x43, 0x5F, 0x55, 0x44, 0xF4, 0x55, 0x5F, 0x25, 0x66, 0xF0, 0x58, 0x6C,
+  0x79, 0x78, 0x8A, 0xF6, 0xEF, 0x3F, 0x1F, 0x0F, 0x69, 0xF0, 0x7F, 0x2C,
+  0xF4, 0xAF, 0x58, 0xF7, 0x75, 0xB7, 0x64, 0xE5, 0x64, 0xF0, 0x45, 0x5F,
+  0x04, 0x55, 0xF0, 0x45, 0x4F, 0x14, 0x54, 0xF1, 0x45, 0x4F, 0x04, 0x55,
+  0xF0, 0x45, 0x5E, 0x55, 0x4E, 0x56, 0x4C, 0x67, 0xF7, 0x6F, 0x77, 0xF5,
+  0x9F, 0x3B, 0x4F, 0x95, 0xF9, 0x5F, 0x94, 0xFA, 0x4F, 0xA4, 0xF9, 0x5F,
+  0x95, 0xF9, 0x4F, 0xA4, 0xFA, 0x4F, 0x95, 0xF9, 0x4F, 0xA4, 0xFA, 0xF1,
+  0x8F, 0x7E, 0xF2, 0xF2, 0xEF, 0x6B, 0x87, 0x7A, 0x6C, 0x68, 0x6E, 0x66,
+  0x5F, 0x25, 0x55, 0xF4, 0x45, 0x4F, 0x55, 0x35, 0xF6, 0x43, 0x4F, 0x74,
+  0x24, 0xF8, 0x42, 0x4F, 0x84, 0x14, 0xF9, 0x41, 0x4F, 0x94, 0x14, 0xF9,
+  0x41, 0x3F, 0xA8, 0xF9, 0x41, 0x4F, 0x94, 0x14, 0xF9, 0x41, 0x4F, 0x94,
+  0x14, 0xF8, 0x42, 0x4F, 0x84, 0x24, 0xF7, 0x43, 0x4F, 0x01, 0x55, 0x35,
+  0xD3, 0x44, 0x54, 0xC5, 0x25, 0x55, 0xBB, 0x66, 0xB9, 0x86, 0xB7, 0xA7,
+  0x79, 0xAF, 0x9B, 0xF8, 0xBE, 0x36, 0xD8, 0x75, 0xFE, 0x3F, 0xF8, 0x7F,
+  0x4B, 0xF6, 0x9F, 0x77, 0xF8, 0x75, 0xD6, 0x64, 0xF0, 0x56, 0x4F, 0x14,
+  0x55, 0xF1, 0x45, 0x5F, 0x14, 0x54, 0xF2, 0x45, 0x4F, 0x24, 0x54, 0xF1,
+  0x45, 0x5F, 0x14, 0x55, 0xF0, 0x55, 0x4F, 0x05, 0x64, 0xD6, 0x7F, 0x77,
+  0xF7, 0x8F, 0x78, 0xF8, 0x74, 0xE6, 0x55, 0xF0, 0x55, 0x5F, 0x14, 0x54,
+  0xF2, 0x45, 0x4F, 0x24, 0x54, 0xF2, 0x44, 0x5F, 0x24, 0x45, 0xF1, 0x45,
+  0x4F, 0x24, 0x54, 0xF2, 0x45, 0x4F, 0x24, 0x45, 0xF2, 0x44, 0x4F, 0x34,
+  0x44, 0xF3, 0x44, 0xE9, 0xF2, 0xED, 0xF3, 0xAF, 0x49, 0x77, 0x77, 0x5C,
+  0x66, 0x4E, 0x55, 0x4F, 0x14, 0x53, 0xF2, 0x44, 0x4F, 0x24, 0x44, 0xF2,
+  0x44, 0x4F, 0xA5, 0xF9, 0x6F, 0x97, 0xF7, 0xBF, 0x4E, 0xF1, 0xF1, 0xF1,
+  0xEF, 0x4B, 0xF6, 0x9F, 0x87, 0xF9, 0x5F, 0xA4, 0x24, 0xF4, 0x42, 0x4F,
+  0x44, 0x24, 0xF4, 0x33, 0x4F, 0x34, 0x34, 0xF3, 0x43, 0x5F, 0x14, 0x55,
+  0xD5, 0x67, 0x87, 0x8F, 0x5A, 0xF3, 0xCF, 0x0F, 0x29, 0xD0, 0x1F, 0xC1,
+  0xFC, 0x1F, 0xC1, 0xFB, 0xD4, 0xF8, 0x5F, 0x85, 0xF8, 0x4F, 0x94, 0xF9,
+  0x4F, 0x85, 0xF8, 0x5F, 0x84, 0xF9, 0x4F, 0x85, 0xF8, 0x5F, 0x84, 0xF9,
+  0x4F, 0x94, 0xF8, 0x5F, 0x85, 0xF8, 0x4F, 0x94, 0xF9, 0x4F, 0x85, 0xF8,
+  0x5F, 0x84, 0xF9, 0x4F, 0x85, 0xF8, 0x5F, 0x84, 0xF9, 0x4F, 0x94, 0xF8,
+  0x5F, 0x30, 0x54, 0xF3, 0x45, 0x4F, 0x34, 0x54, 0xF2, 0x54, 0x5F, 0x25,
+  0x45, 0xF2, 0x45, 0x4F, 0x34, 0x54, 0xF3, 0x44, 0x5F, 0x25, 0x45, 0xF2,
+  0x54, 0x4F, 0x34, 0x54, 0xF3, 0x45, 0x4F, 0x34, 0x45, 0xF2, 0x54, 0x5F,
+  0x25, 0x44, 0xF3, 0x45, 0x4F, 0x34, 0x54, 0xF2, 0x54, 0x5F, 0x25, 0x45,
+  0xF2, 0x45, 0x4F, 0x34, 0x54, 0xF3, 0x44, 0x5F, 0x25, 0x45, 0xF2, 0x54,
+  0x4F, 0x34, 0x54, 0xF3, 0x45, 0x4F, 0x25, 0x54, 0xF2, 0x46, 0x4F, 0x15,
+  0x65, 0xE5, 0x85, 0xC6, 0x87, 0x78, 0xAF, 0x5C, 0xF2, 0xF0, 0xF0, 0xF4,
+  0x9F, 0x00, 0x05, 0xF4, 0xAF, 0x35, 0x15, 0xF3, 0x42, 0x5F, 0x25, 0x34,
+  0xF2, 0x44, 0x4F, 0x15, 0x44, 0xF1, 0x45, 0x5E, 0x55, 0x5E, 0x46, 0x5D,
+  0x56, 0x5C, 0x58, 0x4C, 0x49, 0x4B, 0x59, 0x4B, 0x4A, 0x4A, 0x5A, 0x59,
+  0x4B, 0x58, 0x5B, 0x58, 0x4D, 0x47, 0x4E, 0x47, 0x4E, 0x46, 0x4F, 0x04,
+  0x55, 0xF0, 0x54, 0x4F, 0x15, 0x35, 0xF1, 0x53, 0x4F, 0x25, 0x25, 0xF3,
+  0x42, 0x4F, 0x44, 0x14, 0xF5, 0x41, 0x4F, 0x58, 0xF6, 0x8F, 0x67, 0xF7,
+  0x7F, 0x85, 0xF4, 0x04, 0xF0, 0x5E, 0x41, 0x4E, 0x6D, 0x51, 0x4E, 0x6D,
+  0x42, 0x4D, 0x7C, 0x52, 0x4D, 0x7C, 0x52, 0x4C, 0x8B, 0x53, 0x4B, 0x9B,
+  0x53, 0x4B, 0x41, 0x4A, 0x54, 0x4A, 0x51, 0x4A, 0x54, 0x4A, 0x42, 0x49,
+  0x55, 0x49, 0x52, 0x49, 0x55, 0x49, 0x43, 0x49, 0x46, 0x48, 0x53, 0x48,
+  0x57, 0x38, 0x44, 0x48, 0x48, 0x37, 0x55, 0x37, 0x58, 0x37, 0x46, 0x46,
+  0x49, 0x36, 0x56, 0x45, 0x59, 0x36, 0x47, 0x45, 0x4A, 0x35, 0x57, 0x44,
+  0x5A, 0x44, 0x48, 0x44, 0x5A, 0x43, 0x58, 0x44, 0x4B, 0x43, 0x49, 0x43,
+  0x5B, 0x42, 0x59, 0x43, 0x4C, 0x42, 0x4A, 0x42, 0x5C, 0x41, 0x5A, 0x42,
+  0x4D, 0x41, 0x4B, 0x41, 0x5D, 0x9B, 0x41, 0x4E, 0x8C, 0x9E, 0x8C, 0x8F,
+  0x07, 0xE7, 0xF0, 0x7E, 0x6F, 0x16, 0xF0, 0x6F, 0x16, 0xF0, 0x5F, 0x25,
+  0xF1, 0x5F, 0x10, 0x86, 0xF1, 0x69, 0x5F, 0x15, 0xA5, 0xF0, 0x5C, 0x5D,
+  0x5D, 0x5C, 0x5F, 0x05, 0xA5, 0xF1, 0x59, 0x5F, 0x35, 0x75, 0xF4, 0x56,
+  0x5F, 0x65, 0x55, 0xF6, 0x54, 0x5F, 0x75, 0x35, 0xF9, 0x51, 0x5F, 0xAA,
+  0xFC, 0x8F, 0xD7, 0xFF, 0x05, 0xFF, 0x07, 0xFD, 0x8F, 0xC9, 0xFB, 0x51,
+  0x5F, 0x95, 0x25, 0xF8, 0x54, 0x5F, 0x75, 0x45, 0xF6, 0x56, 0x5F, 0x45,
+  0x75, 0xF3, 0x59, 0x5F, 0x15, 0xA5, 0xF0, 0x5C, 0x5D, 0x5D, 0x5C, 0x5E,
+  0x6A, 0x6F, 0x05, 0x96, 0xF1, 0x67, 0x6F, 0x35, 0x70, 0x05, 0xF5, 0x51,
+  0x5F, 0x35, 0x25, 0xF2, 0x53, 0x6F, 0x05, 0x55, 0xF0, 0x55, 0x5E, 0x57,
+  0x5C, 0x58, 0x5B, 0x5A, 0x4A, 0x5B, 0x58, 0x5C, 0x58, 0x5D, 0x56, 0x5E,
+  0x55, 0x5F, 0x14, 0x45, 0xF2, 0x52, 0x5F, 0x44, 0x24, 0xF5, 0xAF, 0x59,
+  0xF7, 0x7F, 0x86, 0xFA, 0x4F, 0xB4, 0xFA, 0x5F, 0xA4, 0xFB, 0x4F, 0xB4,
+  0xFA, 0x5F, 0xA5, 0xFA, 0x4F, 0xB4, 0xFB, 0x4F, 0xA5, 0xFA, 0x5F, 0xA4,
+  0xF5, 0x9F, 0xA9, 0xF9, 0xAF, 0x99, 0xFA, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F,
+  0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F,
+  0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F,
+  0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0x5F, 0xD5, 0xFD, 0xFB,
+  0x8F, 0xB8, 0xFB, 0x8F, 0xB7, 0x99, 0x99, 0x99, 0x98, 0x94, 0xE4, 0xE4,
+  0xE4, 0xD5, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0xE4, 0xE4, 0xE4, 0xD4,
+  0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0xE4, 0xE4,
+  0xE4, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0xE4, 0xE4, 0xE9, 0x89, 0x99,
+  0x99, 0x90, 0x03, 0x33, 0x33, 0x33, 0x33, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0x43, 0x33, 0x33, 0x33, 0x33, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x33,
+  0x33, 0x33, 0x33, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x33, 0x33, 0x33,
+  0x33, 0x99, 0x99, 0x99, 0x89, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0xE4, 0xE4,
+  0xE4, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4,
+  0xE4, 0xE4, 0xE4, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0xD4, 0xE4, 0xE4, 0xE4,
+  0xD5, 0xD4, 0xE4, 0xE4, 0xE4, 0x98, 0x99, 0x99, 0x99, 0x90, 0xA4, 0xD4,
+  0xC5, 0xB7, 0xA3, 0x13, 0x93, 0x23, 0x84, 0x23, 0x83, 0x33, 0x73, 0x43,
+  0x73, 0x53, 0x53, 0x63, 0x44, 0x63, 0x43, 0x73, 0x33, 0x83, 0x24, 0x93,
+  0x13, 0xA7, 0xA6, 0xB3, 0x1F, 0xFF, 0xC0, 0x05, 0x44, 0x54, 0x53, 0x63,
+  0x53, 0x63, 0xB8, 0xCD, 0x9F, 0x07, 0xF2, 0x56, 0x66, 0x45, 0x95, 0x44,
+  0xB4, 0xF4, 0x4F, 0x44, 0xF4, 0x3F, 0x44, 0xF2, 0x69, 0xE6, 0xF1, 0x5C,
+  0x24, 0x47, 0x84, 0x35, 0xB4, 0x34, 0xC4, 0x24, 0xC4, 0x34, 0xC4, 0x34,
+  0xB5, 0x34, 0xA6, 0x36, 0x59, 0x4E, 0x16, 0x2D, 0x26, 0x3B, 0x45, 0x56,
+  0x84, 0x10, 0x74, 0xF6, 0x4F, 0x55, 0xF5, 0x4F, 0x64, 0xF6, 0x4F, 0x64,
+  0xF5, 0x4F, 0x64, 0x55, 0xB4, 0x39, 0x94, 0x1C, 0x8F, 0x36, 0x41, 0x45,
+  0x65, 0x78, 0x55, 0x6A, 0x54, 0x5C, 0x43, 0x6C, 0x43, 0x5D, 0x43, 0x4E,
+  0x43, 0x4E, 0x43, 0x4E, 0x42, 0x5E, 0x42, 0x4E, 0x43, 0x4E, 0x43, 0x4E,
+  0x43, 0x4D, 0x52, 0x5D, 0x43, 0x6B, 0x53, 0x6A, 0x54, 0x78, 0x55, 0x85,
+  0x65, 0x41, 0xF0, 0x54, 0x2C, 0x74, 0x3A, 0xF2, 0x6A, 0xA7, 0xDB, 0x9E,
+  0x7F, 0x15, 0x75, 0x54, 0x68, 0x53, 0x5A, 0x42, 0x5B, 0x42, 0x4C, 0x41,
+  0x5F, 0x24, 0xF3, 0x4F, 0x25, 0xF2, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3,
+  0x4F, 0x34, 0xC4, 0x24, 0xC4, 0x25, 0xA4, 0x45, 0x85, 0x46, 0x56, 0x6F,
+  0x07, 0xE9, 0xCC, 0x7A, 0xF7, 0x5F, 0x74, 0xF8, 0x4F, 0x84, 0xF8, 0x4F,
+  0x75, 0xF7, 0x4F, 0x84, 0xC6, 0x54, 0xAA, 0x34, 0x8C, 0x25, 0x7E, 0x14,
+  0x76, 0x59, 0x66, 0x87, 0x65, 0xA6, 0x55, 0xB5, 0x64, 0xC5, 0x55, 0xC5,
+  0x54, 0xE4, 0x54, 0xD5, 0x45, 0xD4, 0x54, 0xE4, 0x54, 0xE4, 0x54, 0xE4,
+  0x54, 0xD5, 0x54, 0xD4, 0x64, 0xC5, 0x64, 0xC5, 0x65, 0xA6, 0x75, 0x87,
+  0x76, 0x58, 0x8F, 0x49, 0xD1, 0x4A, 0xA3, 0x4C, 0x6F, 0x10, 0xB6, 0xEB,
+  0xBE, 0x7F, 0x16, 0x75, 0x65, 0x59, 0x53, 0x5A, 0x53, 0x4C, 0x42, 0x4D,
+  0x42, 0x4D, 0x41, 0x4E, 0x41, 0xF7, 0x1F, 0xFE, 0x1F, 0x71, 0x4F, 0x44,
+  0xF4, 0x4F, 0x44, 0xF4, 0x4D, 0x42, 0x5B, 0x44, 0x59, 0x54, 0x66, 0x66,
+  0xF1, 0x8E, 0xAB, 0xE7, 0xA0, 0xA5, 0x87, 0x78, 0x77, 0x75, 0xA4, 0xB4,
+  0xB4, 0xA5, 0x7B, 0x4B, 0x3C, 0x74, 0xA4, 0xB4, 0xB4, 0xB4, 0xA5, 0xA4,
+  0xB4, 0xB4, 0xB4, 0xA5, 0xA4, 0xB4, 0xB4, 0xB4, 0xA4, 0xB4, 0xB4, 0xB4,
+  0xB4, 0xA4, 0xB4, 0xB0, 0xC6, 0xF4, 0xA3, 0x49, 0xC2, 0x38, 0xF0, 0x13,
+  0x86, 0x58, 0x75, 0x87, 0x65, 0xA6, 0x64, 0xB5, 0x64, 0xC5, 0x64, 0xC5,
+  0x54, 0xD5, 0x54, 0xD5, 0x54, 0xD4, 0x63, 0xE4, 0x54, 0xE4, 0x54, 0xD5,
+  0x54, 0xD5, 0x54, 0xD4, 0x64, 0xC5, 0x64, 0xB6, 0x65, 0xA6, 0x75, 0x86,
+  0x86, 0x58, 0x9D, 0x14, 0x9C, 0x24, 0xAA, 0x24, 0xD6, 0x44, 0xF8, 0x4F,
+  0x74, 0x74, 0xB5, 0x74, 0xA5, 0x86, 0x67, 0x9F, 0x2A, 0xF1, 0xDC, 0xF2,
+  0x8E, 0x74, 0xF4, 0x4F, 0x35, 0xF3, 0x4F, 0x44, 0xF4, 0x4F, 0x44, 0xF3,
+  0x4F, 0x44, 0x56, 0x84, 0x39, 0x74, 0x1C, 0x6F, 0x25, 0x94, 0x64, 0x77,
+  0x54, 0x69, 0x44, 0x5A, 0x43, 0x5B, 0x43, 0x5B, 0x43, 0x4C, 0x43, 0x4B,
+  0x44, 0x4B, 0x43, 0x5B, 0x43, 0x4C, 0x43, 0x4C, 0x43, 0x4B, 0x44, 0x4B,
+  0x43, 0x4C, 0x43, 0x4C, 0x43, 0x4B, 0x53, 0x4B, 0x44, 0x4B, 0x43, 0x4C,
+  0x43, 0x4C, 0x43, 0x4B, 0x44, 0x74, 0x74, 0x64, 0x74, 0x74, 0xFF, 0xF5,
+  0x47, 0x47, 0x46, 0x47, 0x47, 0x47, 0x47, 0x46, 0x47, 0x47, 0x47, 0x47,
+  0x46, 0x47, 0x47, 0x47, 0x47, 0x46, 0x47, 0x47, 0x47, 0x47, 0x46, 0x47,
+  0x47, 0xD4, 0xE4, 0xE4, 0xE4, 0xE4, 0xFF, 0xFF, 0xF9, 0x5D, 0x4E, 0x4E,
+  0x4E, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4E, 0x4E, 0x4E, 0x4D, 0x5D,
+  0x4E, 0x4E, 0x4E, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4D, 0x4E, 0x4E, 0x4E,
+  0x4D, 0x5D, 0x4D, 0x5A, 0x89, 0x8A, 0x7B, 0x5D, 0x74, 0xF6, 0x4F, 0x55,
+  0xF5, 0x4F, 0x64, 0xF6, 0x4F, 0x64, 0xF5, 0x4F, 0x64, 0xF6, 0x4A, 0x56,
+  0x49, 0x57, 0x48, 0x57, 0x47, 0x59, 0x46, 0x5A, 0x45, 0x5B, 0x44, 0x5B,
+  0x53, 0x5C, 0x43, 0x4E, 0x41, 0x7D, 0xCD, 0x71, 0x4C, 0x72, 0x5B, 0x64,
+  0x4B, 0x55, 0x5A, 0x47, 0x4A, 0x47, 0x49, 0x57, 0x58, 0x49, 0x48, 0x49,
+  0x57, 0x4A, 0x47, 0x4A, 0x46, 0x4B, 0x55, 0x4C, 0x45, 0x4C, 0x54, 0x74,
+  0x74, 0x64, 0x74, 0x74, 0x74, 0x74, 0x64, 0x74, 0x74, 0x74, 0x74, 0x64,
+  0x74, 0x74, 0x74, 0x74, 0x64, 0x74, 0x74, 0x74, 0x74, 0x64, 0x74, 0x74,
+  0x74, 0x74, 0x64, 0x74, 0x74, 0x74, 0x74, 0x64, 0x74, 0x70, 0xD6, 0x86,
+  0x75, 0x29, 0x59, 0x64, 0x2B, 0x3B, 0x54, 0x1C, 0x2D, 0x48, 0x4A, 0x46,
+  0x46, 0x78, 0x65, 0x36, 0x96, 0x84, 0x35, 0xA5, 0x94, 0x34, 0xB4, 0xA4,
+  0x34, 0xB4, 0xA4, 0x34, 0xB4, 0xA4, 0x34, 0xA4, 0xB4, 0x24, 0xB4, 0xA5,
+  0x24, 0xB4, 0xA4, 0x34, 0xB4, 0xA4, 0x34, 0xA5, 0xA4, 0x34, 0xA4, 0xB4,
+  0x25, 0xA4, 0xA4, 0x34, 0xB4, 0xA4, 0x34, 0xB4, 0xA4, 0x34, 0xA4, 0xB4,
+  0x34, 0xA4, 0xB4, 0x25, 0xA4, 0xA4, 0x34, 0xB4, 0xA4, 0x34, 0xB4, 0xA4,
+  0x34, 0xA4, 0xB4, 0x30, 0xD6, 0x85, 0x2A, 0x64, 0x2C, 0x54, 0x1D, 0x58,
+  0x56, 0x46, 0x85, 0x36, 0xA4, 0x35, 0xB4, 0x35, 0xB4, 0x34, 0xC4, 0x34,
+  0xC4, 0x34, 0xB4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xB5, 0x34,
+  0xB4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xB5, 0x34, 0xB4, 0x35,
+  0xB4, 0x34, 0xC4, 0x34, 0xC4, 0x34, 0xB4, 0x40, 0xB6, 0xEB, 0xAF, 0x07,
+  0xF1, 0x67, 0x56, 0x55, 0x85, 0x45, 0xA5, 0x34, 0xC4, 0x24, 0xD4, 0x24,
+  0xD4, 0x14, 0xE4, 0x14, 0xE4, 0x14, 0xE8, 0xF0, 0x8E, 0x41, 0x4E, 0x41,
+  0x4E, 0x41, 0x4D, 0x42, 0x4D, 0x42, 0x4C, 0x43, 0x5A, 0x54, 0x58, 0x55,
+  0x65, 0x76, 0xF1, 0x7E, 0xBB, 0xE6, 0xB0, 0xF1, 0x6C, 0x43, 0xAA, 0x41,
+  0xD8, 0xF4, 0x84, 0x14, 0x56, 0x77, 0x85, 0x76, 0xA5, 0x65, 0xC4, 0x55,
+  0xD4, 0x55, 0xD4, 0x55, 0xD4, 0x54, 0xE4, 0x54, 0xE4, 0x45, 0xE4, 0x44,
+  0xE4, 0x54, 0xE4, 0x54, 0xE4, 0x45, 0xD5, 0x45, 0xD4, 0x55, 0xC5, 0x56,
+  0xA5, 0x67, 0x85, 0x69, 0x57, 0x64, 0x1F, 0x07, 0x42, 0xD8, 0x43, 0xAA,
+  0x44, 0x7B, 0x5F, 0x74, 0xF8, 0x4F, 0x84, 0xF8, 0x4F, 0x75, 0xF7, 0x4F,
+  0x84, 0xF8, 0x4F, 0x80, 0xB6, 0xF2, 0xB3, 0x47, 0xD2, 0x46, 0xE1, 0x55,
+  0x65, 0x95, 0x58, 0x84, 0x5A, 0x74, 0x4B, 0x73, 0x4D, 0x63, 0x4D, 0x53,
+  0x4E, 0x53, 0x4E, 0x53, 0x4E, 0x52, 0x4E, 0x53, 0x4E, 0x53, 0x4E, 0x53,
+  0x4E, 0x53, 0x4D, 0x63, 0x4C, 0x64, 0x4C, 0x64, 0x5A, 0x75, 0x58, 0x85,
+  0x65, 0xA6, 0xE1, 0x48, 0xC2, 0x49, 0xA2, 0x5B, 0x64, 0x5F, 0x64, 0xF7,
+  0x4F, 0x74, 0xF6, 0x5F, 0x65, 0xF6, 0x4F, 0x74, 0xF6, 0x5F, 0x65, 0x70,
+  0xD4, 0x45, 0x26, 0x44, 0x27, 0x44, 0x17, 0x59, 0x87, 0x96, 0xB6, 0xB5,
+  0xC4, 0xD4, 0xD4, 0xC4, 0xD4, 0xD4, 0xD4, 0xD4, 0xC5, 0xC4, 0xD4, 0xD4,
+  0xD4, 0xC5, 0xC4, 0xD4, 0xD4, 0xD0, 0xA7, 0xCB, 0x8E, 0x6F, 0x05, 0x65,
+  0x64, 0x49, 0x43, 0x59, 0x43, 0x4A, 0x43, 0x4F, 0x24, 0xF2, 0x5F, 0x18,
+  0xEB, 0xBC, 0xBC, 0xCA, 0xF0, 0x6F, 0x24, 0x14, 0xC4, 0x14, 0xC4, 0x14,
+  0xB5, 0x15, 0x95, 0x26, 0x76, 0x3F, 0x24, 0xF1, 0x7C, 0xB8, 0x80, 0x64,
+  0x94, 0x84, 0x94, 0x94, 0x94, 0x5C, 0x1C, 0x1B, 0x54, 0x94, 0x84, 0x94,
+  0x94, 0x94, 0x94, 0x84, 0x94, 0x94, 0x94, 0x94, 0x84, 0x94, 0x94, 0x94,
+  0x85, 0x84, 0x94, 0x98, 0x58, 0x66, 0x85, 0x60, 0x44, 0xC4, 0x44, 0xB4,
+  0x54, 0xB4, 0x45, 0xB4, 0x44, 0xC4, 0x44, 0xC4, 0x44, 0xB4, 0x54, 0xB4,
+  0x45, 0xB4, 0x44, 0xC4, 0x44, 0xC4, 0x44, 0xB5, 0x44, 0xB4, 0x44, 0xC4,
+  0x44, 0xC4, 0x44, 0xC4, 0x44, 0xB5, 0x44, 0xB4, 0x44, 0xB5, 0x44, 0xA6,
+  0x44, 0x97, 0x45, 0x69, 0x4F, 0x46, 0xD1, 0x47, 0xA3, 0x48, 0x7E, 0x04,
+  0xD9, 0xD4, 0x14, 0xC5, 0x14, 0xC4, 0x34, 0xA4, 0x44, 0xA4, 0x44, 0x94,
+  0x54, 0x85, 0x54, 0x84, 0x64, 0x75, 0x64, 0x74, 0x74, 0x64, 0x93, 0x64,
+  0x94, 0x44, 0xA4, 0x35, 0xA4, 0x34, 0xB4, 0x24, 0xC4, 0x24, 0xC4, 0x14,
+  0xE3, 0x14, 0xE7, 0xF0, 0x6F, 0x16, 0xF1, 0x5F, 0x25, 0xE0, 0x04, 0x95,
+  0xA4, 0x14, 0x95, 0x95, 0x14, 0x86, 0x94, 0x24, 0x86, 0x94, 0x24, 0x86,
+  0x84, 0x34, 0x77, 0x84, 0x34, 0x73, 0x13, 0x74, 0x53, 0x64, 0x13, 0x74,
+  0x53, 0x63, 0x23, 0x64, 0x63, 0x54, 0x23, 0x64, 0x63, 0x54, 0x24, 0x44,
+  0x74, 0x34, 0x34, 0x44, 0x74, 0x34, 0x34, 0x34, 0x84, 0x33, 0x44, 0x34,
+  0x84, 0x24, 0x44, 0x24, 0x94, 0x23, 0x63, 0x24, 0x94, 0x14, 0x63, 0x14,
+  0xA4, 0x13, 0x73, 0x14, 0xA8, 0x77, 0xB8, 0x77, 0xB7, 0x86, 0xD6, 0x86,
+  0xD5, 0x95, 0xE5, 0x95, 0xE4, 0xA4, 0xD0, 0x64, 0xB5, 0x65, 0xA4, 0x84,
+  0x94, 0x94, 0x84, 0xB4, 0x64, 0xC4, 0x55, 0xC5, 0x35, 0xE4, 0x25, 0xF0,
+  0x51, 0x4F, 0x28, 0xF3, 0x7F, 0x55, 0xF6, 0x5F, 0x56, 0xF4, 0x7F, 0x39,
+  0xF1, 0x51, 0x4F, 0x05, 0x25, 0xE4, 0x44, 0xD4, 0x55, 0xB4, 0x74, 0xA4,
+  0x85, 0x85, 0x94, 0x75, 0xA5, 0x55, 0xC4, 0x50, 0x64, 0xD4, 0x64, 0xC4,
+  0x74, 0xC4, 0x74, 0xB4, 0x84, 0xB4, 0x85, 0x94, 0xA4, 0x85, 0xA4, 0x84,
+  0xB4, 0x74, 0xC4, 0x74, 0xC4, 0x64, 0xD4, 0x64, 0xD4, 0x54, 0xE4, 0x53,
+  0xF1, 0x43, 0x4F, 0x14, 0x24, 0xF2, 0x42, 0x4F, 0x24, 0x14, 0xF3, 0x41,
+  0x4F, 0x38, 0xF4, 0x7F, 0x57, 0xF6, 0x5F, 0x75, 0xF7, 0x4F, 0x84, 0xF7,
+  0x4F, 0x74, 0xF8, 0x4F, 0x74, 0xF7, 0x5F, 0x38, 0xF3, 0x8F, 0x47, 0xF5,
+  0x5F, 0x70, 0x7F, 0x36, 0xF4, 0x6F, 0x46, 0xF3, 0xF5, 0x5F, 0x45, 0xF4,
+  0x5F, 0x45, 0xF4, 0x5F, 0x44, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x45, 0xF4,
+  0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x4F, 0x5F, 0x55,
+  0xF5, 0x5F, 0x55, 0xF5, 0x40, 0xB5, 0x96, 0x97, 0x94, 0xB4, 0xC4, 0xC4,
+  0xB4, 0xC4, 0xC4, 0xC4, 0xB5, 0xB4, 0xC4, 0xC4, 0xC4, 0xB4, 0xC4, 0xB4,
+  0xB4, 0xA5, 0xB3, 0xD4, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xB5,
+  0xB4, 0xC4, 0xC4, 0xC4, 0xB4, 0xC4, 0xC4, 0xC3, 0xD3, 0xD4, 0xC6, 0xA6,
+  0xB5, 0xA0, 0x93, 0x93, 0x92, 0xA2, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93,
+  0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0xA2, 0x93, 0x93, 0x93, 0x92,
+  0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93,
+  0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0xA2, 0x90, 0xA5,
+  0xB5, 0xB6, 0xC4, 0xD3, 0xD3, 0xC4, 0xC4, 0xC4, 0xB4, 0xC4, 0xC4, 0xC4,
+  0xB5, 0xB4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD3, 0xB5, 0xA4,
+  0xB4, 0xB4, 0xC4, 0xB4, 0xC4, 0xC4, 0xC4, 0xB5, 0xB4, 0xC4, 0xC4, 0xC4,
+  0xB4, 0xC4, 0xC4, 0xB4, 0x97, 0x96, 0x95, 0xB0, 0x44, 0xF0, 0x89, 0x22,
+  0xA6, 0x31, 0x33, 0x64, 0x32, 0x26, 0xB1, 0x29, 0x8F, 0x04, 0x40 };
 
 const GFXglyph FreeSansOblique24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  13,    0,    1 },   // 0x20 ' '
   {     0,  11,  34,  13,    6,  -33 },   // 0x21 '!'
-  {    47,  13,  12,  17,    8,  -32 },   // 0x22 '"'
-  {    67,  28,  34,  26,    3,  -32 },   // 0x23 '#'
-  {   186,  26,  42,  26,    3,  -35 },   // 0x24 '$'
-  {   323,  36,  34,  42,    6,  -32 },   // 0x25 '%'
-  {   476,  26,  34,  31,    4,  -32 },   // 0x26 '&'
-  {   587,   5,  12,   9,    8,  -32 },   // 0x27 '''
-  {   595,  15,  44,  16,    5,  -33 },   // 0x28 '('
-  {   678,  15,  44,  16,    1,  -33 },   // 0x29 ')'
-  {   761,  14,  13,  18,    8,  -33 },   // 0x2A '*'
-  {   784,  23,  22,  27,    5,  -20 },   // 0x2B '+'
-  {   848,   7,  12,  13,    3,   -4 },   // 0x2C ','
-  {   859,  12,   4,  16,    5,  -14 },   // 0x2D '-'
-  {   865,   6,   5,  13,    4,   -4 },   // 0x2E '.'
-  {   869,  21,  35,  13,   -1,  -33 },   // 0x2F '/'
-  {   961,  23,  34,  26,    5,  -32 },   // 0x30 '0'
-  {  1059,  13,  33,  26,   10,  -32 },   // 0x31 '1'
-  {  1113,  27,  33,  26,    2,  -32 },   // 0x32 '2'
-  {  1225,  25,  34,  26,    3,  -32 },   // 0x33 '3'
-  {  1332,  24,  33,  26,    3,  -32 },   // 0x34 '4'
-  {  1431,  27,  34,  26,    3,  -32 },   // 0x35 '5'
-  {  1546,  24,  34,  26,    4,  -32 },   // 0x36 '6'
-  {  1648,  26,  33,  26,    6,  -32 },   // 0x37 '7'
-  {  1756,  25,  34,  26,    3,  -32 },   // 0x38 '8'
-  {  1863,  24,  34,  26,    4,  -32 },   // 0x39 '9'
-  {  1965,  10,  25,  13,    5,  -24 },   // 0x3A ':'
-  {  1997,  11,  32,  13,    4,  -24 },   // 0x3B ';'
-  {  2041,  26,  23,  27,    4,  -22 },   // 0x3C '<'
-  {  2116,  26,  12,  27,    3,  -16 },   // 0x3D '='
-  {  2155,  26,  23,  27,    2,  -21 },   // 0x3E '>'
-  {  2230,  20,  35,  26,    9,  -34 },   // 0x3F '?'
-  {  2318,  45,  42,  48,    4,  -34 },   // 0x40 '@'
-  {  2555,  30,  34,  31,    1,  -33 },   // 0x41 'A'
-  {  2683,  29,  34,  31,    4,  -33 },   // 0x42 'B'
-  {  2807,  30,  36,  33,    5,  -34 },   // 0x43 'C'
-  {  2942,  31,  34,  33,    4,  -33 },   // 0x44 'D'
-  {  3074,  31,  34,  31,    4,  -33 },   // 0x45 'E'
-  {  3206,  30,  34,  28,    4,  -33 },   // 0x46 'F'
-  {  3334,  33,  36,  37,    5,  -34 },   // 0x47 'G'
-  {  3483,  33,  34,  34,    4,  -33 },   // 0x48 'H'
-  {  3624,  11,  34,  13,    5,  -33 },   // 0x49 'I'
-  {  3671,  25,  35,  24,    2,  -33 },   // 0x4A 'J'
-  {  3781,  34,  34,  31,    4,  -33 },   // 0x4B 'K'
-  {  3926,  22,  34,  26,    4,  -33 },   // 0x4C 'L'
-  {  4020,  39,  34,  40,    4,  -33 },   // 0x4D 'M'
-  {  4186,  34,  34,  34,    4,  -33 },   // 0x4E 'N'
-  {  4331,  33,  36,  36,    5,  -34 },   // 0x4F 'O'
-  {  4480,  29,  34,  30,    4,  -33 },   // 0x50 'P'
-  {  4604,  33,  38,  36,    5,  -34 },   // 0x51 'Q'
-  {  4761,  30,  34,  33,    4,  -33 },   // 0x52 'R'
-  {  4889,  29,  36,  31,    4,  -34 },   // 0x53 'S'
-  {  5020,  28,  34,  29,    7,  -33 },   // 0x54 'T'
-  {  5139,  31,  35,  34,    6,  -33 },   // 0x55 'U'
-  {  5275,  29,  34,  30,    8,  -33 },   // 0x56 'V'
-  {  5399,  43,  34,  44,    8,  -33 },   // 0x57 'W'
-  {  5582,  36,  34,  31,    1,  -33 },   // 0x58 'X'
-  {  5735,  30,  34,  32,    8,  -33 },   // 0x59 'Y'
-  {  5863,  34,  34,  29,    1,  -33 },   // 0x5A 'Z'
-  {  6008,  18,  44,  13,    1,  -33 },   // 0x5B '['
-  {  6107,   6,  35,  13,    7,  -33 },   // 0x5C '\'
-  {  6134,  18,  44,  13,   -1,  -33 },   // 0x5D ']'
-  {  6233,  17,  18,  22,    6,  -32 },   // 0x5E '^'
-  {  6272,  29,   2,  26,   -3,    7 },   // 0x5F '_'
-  {  6280,   8,   7,  16,    8,  -34 },   // 0x60 '`'
-  {  6287,  23,  27,  26,    3,  -25 },   // 0x61 'a'
-  {  6365,  25,  35,  26,    3,  -33 },   // 0x62 'b'
-  {  6475,  22,  27,  24,    4,  -25 },   // 0x63 'c'
-  {  6550,  27,  35,  26,    4,  -33 },   // 0x64 'd'
-  {  6669,  23,  27,  26,    4,  -25 },   // 0x65 'e'
-  {  6747,  15,  34,  12,    3,  -33 },   // 0x66 'f'
-  {  6811,  27,  36,  26,    2,  -25 },   // 0x67 'g'
-  {  6933,  23,  34,  25,    3,  -33 },   // 0x68 'h'
-  {  7031,  11,  34,  10,    3,  -33 },   // 0x69 'i'
-  {  7078,  18,  44,  11,   -2,  -33 },   // 0x6A 'j'
-  {  7177,  25,  34,  24,    3,  -33 },   // 0x6B 'k'
-  {  7284,  11,  34,  10,    3,  -33 },   // 0x6C 'l'
-  {  7331,  36,  26,  38,    3,  -25 },   // 0x6D 'm'
-  {  7448,  23,  26,  25,    3,  -25 },   // 0x6E 'n'
-  {  7523,  23,  27,  26,    4,  -25 },   // 0x6F 'o'
-  {  7601,  27,  36,  26,    1,  -25 },   // 0x70 'p'
-  {  7723,  26,  36,  26,    3,  -25 },   // 0x71 'q'
-  {  7840,  17,  26,  15,    3,  -25 },   // 0x72 'r'
-  {  7896,  21,  27,  24,    3,  -25 },   // 0x73 's'
-  {  7967,  13,  32,  12,    4,  -30 },   // 0x74 't'
-  {  8019,  24,  26,  25,    4,  -24 },   // 0x75 'u'
-  {  8097,  22,  25,  23,    6,  -24 },   // 0x76 'v'
-  {  8166,  33,  25,  34,    6,  -24 },   // 0x77 'w'
-  {  8270,  26,  25,  23,    1,  -24 },   // 0x78 'x'
-  {  8352,  27,  35,  23,    0,  -24 },   // 0x79 'y'
-  {  8471,  25,  25,  23,    1,  -24 },   // 0x7A 'z'
-  {  8550,  16,  44,  16,    5,  -33 },   // 0x7B '{'
-  {  8638,  12,  44,  12,    3,  -33 },   // 0x7C '|'
-  {  8704,  16,  44,  16,   -1,  -33 },   // 0x7D '}'
-  {  8792,  21,   7,  27,    6,  -19 } }; // 0x7E '~'
+  {    33,  13,  12,  17,    8,  -32 },   // 0x22 '"'
+  {    57,  28,  34,  26,    3,  -32 },   // 0x23 '#'
+  {   131,  26,  42,  26,    3,  -35 },   // 0x24 '$'
+  {   220,  36,  34,  42,    6,  -32 },   // 0x25 '%'
+  {   312,  26,  34,  31,    4,  -32 },   // 0x26 '&'
+  {   382,   5,  12,   9,    8,  -32 },   // 0x27 '''
+  {   394,  15,  44,  16,    5,  -33 },   // 0x28 '('
+  {   439,  15,  44,  16,    1,  -33 },   // 0x29 ')'
+  {   484,  14,  13,  18,    8,  -33 },   // 0x2A '*'
+  {   505,  23,  22,  27,    5,  -20 },   // 0x2B '+'
+  {   536,   7,  12,  13,    3,   -4 },   // 0x2C ','
+  {   549,  12,   4,  16,    5,  -14 },   // 0x2D '-'
+  {   552,   6,   5,  13,    4,   -4 },   // 0x2E '.'
+  {   558,  21,  35,  13,   -1,  -33 },   // 0x2F '/'
+  {   612,  23,  34,  26,    5,  -32 },   // 0x30 '0'
+  {   674,  13,  33,  26,   10,  -32 },   // 0x31 '1'
+  {   708,  27,  33,  26,    2,  -32 },   // 0x32 '2'
+  {   762,  25,  34,  26,    3,  -32 },   // 0x33 '3'
+  {   819,  24,  33,  26,    3,  -32 },   // 0x34 '4'
+  {   876,  27,  34,  26,    3,  -32 },   // 0x35 '5'
+  {   933,  24,  34,  26,    4,  -32 },   // 0x36 '6'
+  {   995,  26,  33,  26,    6,  -32 },   // 0x37 '7'
+  {  1046,  25,  34,  26,    3,  -32 },   // 0x38 '8'
+  {  1108,  24,  34,  26,    4,  -32 },   // 0x39 '9'
+  {  1169,  10,  25,  13,    5,  -24 },   // 0x3A ':'
+  {  1185,  11,  32,  13,    4,  -24 },   // 0x3B ';'
+  {  1208,  26,  23,  27,    4,  -22 },   // 0x3C '<'
+  {  1242,  26,  12,  27,    3,  -16 },   // 0x3D '='
+  {  1258,  26,  23,  27,    2,  -21 },   // 0x3E '>'
+  {  1292,  20,  35,  26,    9,  -34 },   // 0x3F '?'
+  {  1337,  45,  42,  48,    4,  -34 },   // 0x40 '@'
+  {  1466,  30,  34,  31,    1,  -33 },   // 0x41 'A'
+  {  1538,  29,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  1609,  30,  36,  33,    5,  -34 },   // 0x43 'C'
+  {  1677,  31,  34,  33,    4,  -33 },   // 0x44 'D'
+  {  1753,  31,  34,  31,    4,  -33 },   // 0x45 'E'
+  {  1805,  30,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  1857,  33,  36,  37,    5,  -34 },   // 0x47 'G'
+  {  1934,  33,  34,  34,    4,  -33 },   // 0x48 'H'
+  {  2016,  11,  34,  13,    5,  -33 },   // 0x49 'I'
+  {  2051,  25,  35,  24,    2,  -33 },   // 0x4A 'J'
+  {  2107,  34,  34,  31,    4,  -33 },   // 0x4B 'K'
+  {  2187,  22,  34,  26,    4,  -33 },   // 0x4C 'L'
+  {  2237,  39,  34,  40,    4,  -33 },   // 0x4D 'M'
+  {  2357,  34,  34,  34,    4,  -33 },   // 0x4E 'N'
+  {  2450,  33,  36,  36,    5,  -34 },   // 0x4F 'O'
+  {  2530,  29,  34,  30,    4,  -33 },   // 0x50 'P'
+  {  2591,  33,  38,  36,    5,  -34 },   // 0x51 'Q'
+  {  2675,  30,  34,  33,    4,  -33 },   // 0x52 'R'
+  {  2751,  29,  36,  31,    4,  -34 },   // 0x53 'S'
+  {  2818,  28,  34,  29,    7,  -33 },   // 0x54 'T'
+  {  2870,  31,  35,  34,    6,  -33 },   // 0x55 'U'
+  {  2954,  29,  34,  30,    8,  -33 },   // 0x56 'V'
+  {  3027,  43,  34,  44,    8,  -33 },   // 0x57 'W'
+  {  3147,  36,  34,  31,    1,  -33 },   // 0x58 'X'
+  {  3225,  30,  34,  32,    8,  -33 },   // 0x59 'Y'
+  {  3289,  34,  34,  29,    1,  -33 },   // 0x5A 'Z'
+  {  3341,  18,  44,  13,    1,  -33 },   // 0x5B '['
+  {  3386,   6,  35,  13,    7,  -33 },   // 0x5C '\'
+  {  3421,  18,  44,  13,   -1,  -33 },   // 0x5D ']'
+  {  3466,  17,  18,  22,    6,  -32 },   // 0x5E '^'
+  {  3496,  29,   2,  26,   -3,    7 },   // 0x5F '_'
+  {  3499,   8,   7,  16,    8,  -34 },   // 0x60 '`'
+  {  3506,  23,  27,  26,    3,  -25 },   // 0x61 'a'
+  {  3554,  25,  35,  26,    3,  -33 },   // 0x62 'b'
+  {  3621,  22,  27,  24,    4,  -25 },   // 0x63 'c'
+  {  3664,  27,  35,  26,    4,  -33 },   // 0x64 'd'
+  {  3730,  23,  27,  26,    4,  -25 },   // 0x65 'e'
+  {  3773,  15,  34,  12,    3,  -33 },   // 0x66 'f'
+  {  3808,  27,  36,  26,    2,  -25 },   // 0x67 'g'
+  {  3877,  23,  34,  25,    3,  -33 },   // 0x68 'h'
+  {  3941,  11,  34,  10,    3,  -33 },   // 0x69 'i'
+  {  3973,  18,  44,  11,   -2,  -33 },   // 0x6A 'j'
+  {  4016,  25,  34,  24,    3,  -33 },   // 0x6B 'k'
+  {  4079,  11,  34,  10,    3,  -33 },   // 0x6C 'l'
+  {  4114,  36,  26,  38,    3,  -25 },   // 0x6D 'm'
+  {  4192,  23,  26,  25,    3,  -25 },   // 0x6E 'n'
+  {  4244,  23,  27,  26,    4,  -25 },   // 0x6F 'o'
+  {  4291,  27,  36,  26,    1,  -25 },   // 0x70 'p'
+  {  4360,  26,  36,  26,    3,  -25 },   // 0x71 'q'
+  {  4428,  17,  26,  15,    3,  -25 },   // 0x72 'r'
+  {  4458,  21,  27,  24,    3,  -25 },   // 0x73 's'
+  {  4499,  13,  32,  12,    4,  -30 },   // 0x74 't'
+  {  4532,  24,  26,  25,    4,  -24 },   // 0x75 'u'
+  {  4583,  22,  25,  23,    6,  -24 },   // 0x76 'v'
+  {  4630,  33,  25,  34,    6,  -24 },   // 0x77 'w'
+  {  4711,  26,  25,  23,    1,  -24 },   // 0x78 'x'
+  {  4760,  27,  35,  23,    0,  -24 },   // 0x79 'y'
+  {  4826,  25,  25,  23,    1,  -24 },   // 0x7A 'z'
+  {  4865,  16,  44,  16,    5,  -33 },   // 0x7B '{'
+  {  4910,  12,  44,  12,    3,  -33 },   // 0x7C '|'
+  {  4955,  16,  44,  16,   -1,  -33 },   // 0x7D '}'
+  {  5000,  21,   7,  27,    6,  -19 } }; // 0x7E '~'
 
 const GFXfont FreeSansOblique24pt7b PROGMEM = {
   (uint8_t  *)FreeSansOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansOblique24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56, 1,
+  NULL, 0, 1 };
 
-// Approx. 9483 bytes
+// Approx. 5687 bytes
@@ -1,429 +1,358 @@
 const uint8_t FreeSerif18pt7bBitmaps[] PROGMEM = {
-  0x6F, 0xFF, 0xFF, 0xFE, 0x66, 0x66, 0x66, 0x64, 0x40, 0x00, 0x6F, 0xF6,
-  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0x46, 0x42, 0x42, 0x42, 0x03, 0x06, 0x01,
-  0x83, 0x00, 0xC1, 0x80, 0x61, 0xC0, 0x30, 0xC0, 0x38, 0x60, 0x18, 0x30,
-  0xFF, 0xFF, 0x7F, 0xFF, 0x83, 0x06, 0x01, 0x86, 0x00, 0xC3, 0x00, 0xC1,
-  0x87, 0xFF, 0xFF, 0xFF, 0xFE, 0x18, 0x30, 0x0C, 0x18, 0x06, 0x18, 0x06,
-  0x0C, 0x03, 0x06, 0x01, 0x83, 0x00, 0xC1, 0x80, 0x60, 0xC0, 0x02, 0x00,
-  0x10, 0x03, 0xE0, 0x64, 0xE6, 0x23, 0x61, 0x1B, 0x08, 0x58, 0x42, 0xE2,
-  0x03, 0x90, 0x1F, 0x80, 0x7E, 0x00, 0xFC, 0x01, 0xF0, 0x0F, 0xC0, 0x4E,
-  0x02, 0x38, 0x10, 0xE0, 0x87, 0x04, 0x3C, 0x21, 0xE1, 0x1B, 0xC9, 0xCF,
-  0xFC, 0x1F, 0x80, 0x10, 0x00, 0x80, 0x07, 0x80, 0x20, 0x0F, 0xF0, 0x70,
-  0x0F, 0x07, 0xD0, 0x0F, 0x02, 0x18, 0x07, 0x01, 0x18, 0x07, 0x00, 0x8C,
-  0x03, 0x80, 0x4C, 0x01, 0x80, 0x44, 0x00, 0xC0, 0x26, 0x00, 0x60, 0x22,
-  0x0F, 0x30, 0x33, 0x1F, 0xCC, 0x73, 0x1E, 0x37, 0xF1, 0x8E, 0x19, 0xE1,
-  0x8E, 0x04, 0x00, 0x86, 0x02, 0x00, 0xC7, 0x01, 0x00, 0xC3, 0x80, 0x80,
-  0x61, 0x80, 0x80, 0x60, 0xC0, 0x40, 0x30, 0x60, 0x40, 0x30, 0x38, 0xE0,
-  0x30, 0x0F, 0xE0, 0x18, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x00, 0x7E, 0x00,
-  0x00, 0x61, 0x80, 0x00, 0x60, 0x60, 0x00, 0x30, 0x30, 0x00, 0x18, 0x18,
-  0x00, 0x0C, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x8E, 0x00, 0x01, 0xCE,
-  0x00, 0x00, 0x7C, 0x3F, 0xC0, 0x38, 0x07, 0x80, 0x3E, 0x03, 0x80, 0x77,
-  0x01, 0x80, 0x73, 0xC0, 0x80, 0xF0, 0xF0, 0xC0, 0x70, 0x7C, 0xC0, 0x78,
-  0x1E, 0x40, 0x3C, 0x07, 0xC0, 0x1E, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x0F,
-  0xC0, 0xFF, 0x0D, 0xF0, 0xC7, 0xFC, 0x7F, 0xC1, 0xFC, 0x1F, 0x80, 0x3C,
-  0x00, 0xFF, 0xFE, 0x92, 0x40, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0,
-  0xC0, 0x60, 0x70, 0x30, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0,
-  0x70, 0x38, 0x0C, 0x06, 0x03, 0x80, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x00,
-  0xC0, 0x30, 0x0C, 0x80, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x0C,
-  0x07, 0x01, 0x80, 0xC0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
-  0xE0, 0x60, 0x30, 0x38, 0x18, 0x0C, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x00, 0x0C, 0x00, 0xC0, 0x0C, 0x0C, 0x46, 0xE4, 0xF7, 0x5E, 0x1F, 0x00,
-  0xC0, 0x17, 0x8E, 0x4E, 0xE4, 0xFC, 0xC6, 0x0C, 0x00, 0xC0, 0x01, 0x80,
-  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-  0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
-  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x6F, 0xFF,
-  0x11, 0x24, 0x80, 0xFF, 0xFF, 0x6F, 0xF6, 0x00, 0xC0, 0x60, 0x18, 0x06,
-  0x03, 0x80, 0xC0, 0x30, 0x1C, 0x06, 0x01, 0x80, 0xE0, 0x30, 0x0C, 0x07,
-  0x01, 0x80, 0x60, 0x38, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x18, 0x0E, 0x03,
-  0x00, 0x03, 0xE0, 0x0E, 0x70, 0x1C, 0x38, 0x38, 0x1C, 0x38, 0x1C, 0x78,
-  0x1E, 0x70, 0x0E, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0x70, 0x0E, 0x70,
-  0x0E, 0x78, 0x1E, 0x38, 0x1C, 0x38, 0x1C, 0x1C, 0x38, 0x0C, 0x30, 0x03,
-  0xC0, 0x06, 0x03, 0x83, 0xE3, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E,
-  0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80,
-  0xE0, 0x38, 0x0E, 0x03, 0x81, 0xE1, 0xFF, 0x07, 0xC0, 0x1F, 0xF0, 0x3F,
-  0xF8, 0x70, 0xF8, 0x60, 0x3C, 0xC0, 0x3C, 0x80, 0x1C, 0x00, 0x1C, 0x00,
-  0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00,
-  0xC0, 0x00, 0x80, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x01, 0x10,
-  0x02, 0x3F, 0xFE, 0x7F, 0xFC, 0xFF, 0xFC, 0x0F, 0xC0, 0xFF, 0x0C, 0x3C,
-  0x80, 0xE4, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x04, 0x00, 0x40, 0x04, 0x00,
-  0xF8, 0x1F, 0xE0, 0x0F, 0x00, 0x1C, 0x00, 0xE0, 0x03, 0x00, 0x18, 0x00,
-  0xC0, 0x06, 0x00, 0x60, 0x03, 0x78, 0x73, 0xFF, 0x0F, 0xC0, 0x00, 0x30,
-  0x00, 0x30, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xB0, 0x01, 0x30, 0x03, 0x30,
-  0x06, 0x30, 0x04, 0x30, 0x08, 0x30, 0x18, 0x30, 0x10, 0x30, 0x20, 0x30,
-  0x60, 0x30, 0xC0, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x30, 0x00, 0x30,
-  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x7F, 0xC3,
-  0xFE, 0x1F, 0xE1, 0x80, 0x08, 0x00, 0xC0, 0x07, 0xC0, 0x7F, 0x81, 0xFF,
-  0x00, 0xFC, 0x01, 0xE0, 0x07, 0x80, 0x1C, 0x00, 0x60, 0x03, 0x00, 0x18,
-  0x00, 0xC0, 0x06, 0x00, 0x60, 0x07, 0x78, 0x73, 0xFF, 0x0F, 0xC0, 0x00,
-  0x0E, 0x00, 0xF8, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C,
-  0x00, 0x7C, 0x00, 0x79, 0xF0, 0x7F, 0xFC, 0xF8, 0x3C, 0xF0, 0x1E, 0xF0,
-  0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0x70, 0x0F, 0x78,
-  0x0F, 0x78, 0x0E, 0x3C, 0x1E, 0x1E, 0x3C, 0x0F, 0xF8, 0x07, 0xE0, 0x3F,
-  0xFD, 0xFF, 0xF7, 0xFF, 0xF0, 0x06, 0x80, 0x18, 0x00, 0x60, 0x03, 0x00,
-  0x0C, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0xE0, 0x03, 0x00,
-  0x0C, 0x00, 0x70, 0x01, 0x80, 0x06, 0x00, 0x38, 0x00, 0xC0, 0x03, 0x00,
-  0x1C, 0x00, 0x60, 0x00, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x07, 0xC0, 0x3C,
-  0x03, 0xC0, 0x3E, 0x03, 0x70, 0x67, 0x8C, 0x3D, 0x81, 0xF0, 0x0F, 0x81,
-  0x7C, 0x21, 0xE6, 0x0E, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36,
-  0x06, 0x70, 0xE3, 0xFC, 0x0F, 0x80, 0x07, 0xC0, 0x1F, 0xF0, 0x3C, 0x78,
-  0x38, 0x3C, 0x78, 0x1E, 0x70, 0x1E, 0xF0, 0x0E, 0xF0, 0x0F, 0xF0, 0x0F,
-  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF8, 0x0F, 0x78, 0x0F, 0x3C, 0x3F,
-  0x1F, 0xEE, 0x0F, 0x9E, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x78,
-  0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x70, 0x00, 0x6F, 0xF6,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x67, 0xBC, 0xC0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x19, 0xEF, 0x78, 0x42, 0x22, 0x20, 0x00, 0x00, 0xC0,
-  0x00, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0x03, 0xF0,
-  0x03, 0xF0, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00,
-  0x03, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xC0,
-  0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x80,
-  0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-  0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0xFC,
-  0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0xF0,
-  0x00, 0x30, 0x00, 0x00, 0x1F, 0x81, 0xFF, 0x18, 0x7D, 0x81, 0xEC, 0x07,
-  0xF0, 0x3F, 0x81, 0xE0, 0x0F, 0x00, 0x70, 0x03, 0x80, 0x38, 0x01, 0x80,
-  0x08, 0x00, 0xC0, 0x04, 0x00, 0x20, 0x02, 0x00, 0x10, 0x00, 0x80, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x3C, 0x01, 0xE0, 0x07, 0x00, 0x00, 0x7F, 0x00,
-  0x01, 0xFF, 0xC0, 0x07, 0x80, 0xF0, 0x0F, 0x00, 0x38, 0x1C, 0x00, 0x1C,
-  0x38, 0x00, 0x0C, 0x38, 0x00, 0x06, 0x70, 0x1E, 0x02, 0x70, 0x3F, 0xE3,
-  0xF0, 0x71, 0xE1, 0xE0, 0xE0, 0xC1, 0xE0, 0xC0, 0xC1, 0xE0, 0xC1, 0xC1,
-  0xE1, 0x81, 0xC1, 0xE1, 0x81, 0x83, 0xE1, 0x83, 0x82, 0xE1, 0x83, 0x86,
-  0x71, 0xC7, 0x8C, 0x70, 0xF9, 0xF8, 0x38, 0xF0, 0xF0, 0x3C, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x07, 0x80, 0x70, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0x5C, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x8E, 0x00,
-  0x01, 0x8F, 0x00, 0x01, 0x87, 0x00, 0x03, 0x07, 0x80, 0x03, 0x03, 0x80,
-  0x02, 0x03, 0xC0, 0x06, 0x03, 0xC0, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0,
-  0x0C, 0x01, 0xE0, 0x18, 0x00, 0xF0, 0x18, 0x00, 0xF0, 0x30, 0x00, 0x78,
-  0x30, 0x00, 0x78, 0x70, 0x00, 0x7C, 0xFC, 0x01, 0xFF, 0xFF, 0xFC, 0x03,
-  0xFF, 0xF8, 0x1E, 0x0F, 0xC1, 0xE0, 0x3C, 0x1E, 0x01, 0xE1, 0xE0, 0x1E,
-  0x1E, 0x01, 0xE1, 0xE0, 0x1E, 0x1E, 0x03, 0xC1, 0xE0, 0x78, 0x1F, 0xFE,
-  0x01, 0xFF, 0xF0, 0x1E, 0x07, 0xC1, 0xE0, 0x1E, 0x1E, 0x00, 0xF1, 0xE0,
-  0x0F, 0x1E, 0x00, 0xF1, 0xE0, 0x0F, 0x1E, 0x00, 0xF1, 0xE0, 0x1E, 0x1E,
-  0x07, 0xE3, 0xFF, 0xF8, 0xFF, 0xFE, 0x00, 0x00, 0xFE, 0x08, 0x0F, 0xFF,
-  0x60, 0xFC, 0x1F, 0x87, 0xC0, 0x1E, 0x3C, 0x00, 0x38, 0xF0, 0x00, 0x67,
-  0x80, 0x01, 0x9E, 0x00, 0x02, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00,
-  0x3C, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F,
-  0x00, 0x02, 0x1F, 0x00, 0x38, 0x3F, 0x03, 0x80, 0x7F, 0xFC, 0x00, 0x3F,
-  0x80, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x78, 0x3F, 0x80, 0xF0, 0x0F,
-  0x81, 0xE0, 0x0F, 0x83, 0xC0, 0x0F, 0x07, 0x80, 0x0F, 0x0F, 0x00, 0x1E,
-  0x1E, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x78, 0xF0, 0x00, 0xF1,
-  0xE0, 0x01, 0xE3, 0xC0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x1E, 0x1E,
-  0x00, 0x3C, 0x3C, 0x00, 0xF0, 0x78, 0x01, 0xE0, 0xF0, 0x0F, 0x81, 0xE0,
-  0x7E, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x87, 0xFF,
-  0xF8, 0x3C, 0x01, 0x83, 0xC0, 0x08, 0x3C, 0x00, 0x83, 0xC0, 0x00, 0x3C,
-  0x00, 0x03, 0xC0, 0x00, 0x3C, 0x02, 0x03, 0xC0, 0x60, 0x3F, 0xFE, 0x03,
-  0xFF, 0xE0, 0x3C, 0x06, 0x03, 0xC0, 0x20, 0x3C, 0x00, 0x03, 0xC0, 0x00,
-  0x3C, 0x00, 0x03, 0xC0, 0x01, 0x3C, 0x00, 0x23, 0xC0, 0x06, 0x3C, 0x01,
-  0xE7, 0xFF, 0xFE, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0x00,
-  0x67, 0x80, 0x13, 0xC0, 0x09, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C,
-  0x02, 0x1E, 0x03, 0x0F, 0xFF, 0x87, 0xFF, 0xC3, 0xC0, 0x61, 0xE0, 0x10,
-  0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80,
-  0x03, 0xC0, 0x03, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0x04, 0x07, 0xFF,
-  0xB8, 0x1F, 0x03, 0xF0, 0xF8, 0x01, 0xE3, 0xE0, 0x01, 0xC7, 0x80, 0x01,
-  0x9E, 0x00, 0x01, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03,
-  0xC0, 0x00, 0x07, 0x80, 0x07, 0xFF, 0x00, 0x07, 0xDE, 0x00, 0x07, 0xBC,
-  0x00, 0x0F, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x3C, 0xF0, 0x00, 0x78, 0xF0,
-  0x00, 0xF1, 0xF0, 0x01, 0xE1, 0xF0, 0x03, 0xC1, 0xF8, 0x1F, 0x00, 0xFF,
-  0xFC, 0x00, 0x3F, 0x80, 0xFF, 0x03, 0xFD, 0xF8, 0x07, 0xE3, 0xC0, 0x0F,
-  0x0F, 0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F,
-  0x00, 0x3C, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xFF, 0xFF, 0x0F, 0xFF,
-  0xFC, 0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F, 0x00, 0x3C,
-  0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C,
-  0x00, 0xF1, 0xF8, 0x07, 0xEF, 0xF0, 0x3F, 0xC0, 0xFF, 0xBF, 0x0F, 0x07,
-  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
-  0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC3, 0xF3, 0xFE, 0x0F, 0xF0,
-  0x7E, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
-  0x3C, 0x03, 0xC6, 0x38, 0xF3, 0x8F, 0xF0, 0x7C, 0x00, 0xFF, 0x07, 0xFC,
-  0xFC, 0x03, 0xC0, 0xF0, 0x07, 0x01, 0xE0, 0x1C, 0x03, 0xC0, 0x60, 0x07,
-  0x81, 0x80, 0x0F, 0x06, 0x00, 0x1E, 0x18, 0x00, 0x3C, 0x60, 0x00, 0x79,
-  0x80, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xDF, 0x00, 0x07, 0x8F,
-  0x00, 0x0F, 0x0F, 0x00, 0x1E, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x78, 0x0F,
-  0x00, 0xF0, 0x1F, 0x01, 0xE0, 0x1F, 0x03, 0xC0, 0x1F, 0x0F, 0xC0, 0x3F,
-  0x3F, 0xC1, 0xFF, 0x80, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x1E,
-  0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C,
-  0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78,
-  0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x04, 0xF0,
-  0x01, 0x1E, 0x00, 0x63, 0xC0, 0x3C, 0xFF, 0xFF, 0xBF, 0xFF, 0xE0, 0xFC,
-  0x00, 0x03, 0xF9, 0xF0, 0x00, 0x1F, 0x87, 0x80, 0x01, 0xF8, 0x3E, 0x00,
-  0x0F, 0xC1, 0xF0, 0x00, 0x5E, 0x0B, 0xC0, 0x06, 0xF0, 0x5E, 0x00, 0x37,
-  0x82, 0x78, 0x03, 0x3C, 0x13, 0xC0, 0x19, 0xE0, 0x8F, 0x01, 0x8F, 0x04,
-  0x78, 0x0C, 0x78, 0x21, 0xE0, 0xC3, 0xC1, 0x0F, 0x06, 0x1E, 0x08, 0x3C,
-  0x60, 0xF0, 0x41, 0xE3, 0x07, 0x82, 0x07, 0xB0, 0x3C, 0x10, 0x3D, 0x81,
-  0xE0, 0x81, 0xF8, 0x0F, 0x04, 0x07, 0xC0, 0x78, 0x20, 0x3C, 0x03, 0xC1,
-  0x00, 0xE0, 0x1E, 0x1C, 0x06, 0x01, 0xFB, 0xF8, 0x10, 0x1F, 0xE0, 0xFC,
-  0x00, 0xFE, 0x78, 0x00, 0x70, 0x78, 0x00, 0x40, 0xF8, 0x00, 0x81, 0xF8,
-  0x01, 0x02, 0xF8, 0x02, 0x04, 0xF8, 0x04, 0x08, 0xF0, 0x08, 0x11, 0xF0,
-  0x10, 0x21, 0xF0, 0x20, 0x41, 0xF0, 0x40, 0x81, 0xF0, 0x81, 0x01, 0xF1,
-  0x02, 0x01, 0xE2, 0x04, 0x03, 0xE4, 0x08, 0x03, 0xE8, 0x10, 0x03, 0xF0,
-  0x20, 0x03, 0xE0, 0x40, 0x03, 0xC0, 0x80, 0x03, 0x81, 0x00, 0x07, 0x07,
-  0x00, 0x06, 0x3F, 0x80, 0x04, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00,
-  0x3E, 0x0F, 0x80, 0xF0, 0x07, 0x83, 0xC0, 0x07, 0x87, 0x80, 0x07, 0x1E,
-  0x00, 0x0F, 0x3C, 0x00, 0x1E, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0,
-  0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00,
-  0x07, 0xF8, 0x00, 0x0F, 0x78, 0x00, 0x3C, 0xF0, 0x00, 0x78, 0xE0, 0x01,
-  0xE1, 0xE0, 0x03, 0xC1, 0xE0, 0x0F, 0x01, 0xF0, 0x7C, 0x00, 0xFF, 0xE0,
-  0x00, 0x7F, 0x00, 0xFF, 0xF8, 0x1F, 0xFF, 0x83, 0xC1, 0xF0, 0xF0, 0x1E,
-  0x3C, 0x07, 0xCF, 0x00, 0xF3, 0xC0, 0x3C, 0xF0, 0x0F, 0x3C, 0x03, 0xCF,
-  0x01, 0xF3, 0xC0, 0x78, 0xF0, 0x7C, 0x3F, 0xFE, 0x0F, 0xFE, 0x03, 0xC0,
-  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00,
-  0x3C, 0x00, 0x1F, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF,
-  0x00, 0x3E, 0x0F, 0x80, 0xF0, 0x07, 0x83, 0xC0, 0x07, 0x87, 0x80, 0x0F,
-  0x1E, 0x00, 0x0F, 0x3C, 0x00, 0x1E, 0xF0, 0x00, 0x1D, 0xE0, 0x00, 0x3F,
-  0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC,
-  0x00, 0x07, 0xF8, 0x00, 0x0F, 0x70, 0x00, 0x1C, 0xF0, 0x00, 0x79, 0xE0,
-  0x00, 0xF1, 0xE0, 0x03, 0xC1, 0xC0, 0x07, 0x01, 0xC0, 0x1C, 0x01, 0xE0,
-  0xF0, 0x00, 0x7F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xF0,
-  0x03, 0xFF, 0xF0, 0x0F, 0x07, 0xC0, 0x78, 0x1E, 0x03, 0xC0, 0x78, 0x1E,
-  0x03, 0xC0, 0xF0, 0x1E, 0x07, 0x80, 0xF0, 0x3C, 0x07, 0x81, 0xE0, 0x78,
-  0x0F, 0x0F, 0x80, 0x7F, 0xF8, 0x03, 0xFE, 0x00, 0x1E, 0x78, 0x00, 0xF1,
-  0xE0, 0x07, 0x87, 0x80, 0x3C, 0x3C, 0x01, 0xE0, 0xF0, 0x0F, 0x03, 0xC0,
-  0x78, 0x0F, 0x03, 0xC0, 0x7C, 0x3F, 0x01, 0xF3, 0xFC, 0x07, 0xE0, 0x07,
-  0x84, 0x1F, 0xFC, 0x3C, 0x3E, 0x30, 0x0E, 0x70, 0x06, 0x70, 0x06, 0x70,
-  0x02, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x03,
-  0xF8, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0xC0,
-  0x0F, 0xE0, 0x0F, 0x70, 0x1E, 0x78, 0x3C, 0x4F, 0xF8, 0x43, 0xF0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x7C, 0x0F, 0x03, 0x80, 0xF0, 0x10,
-  0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00,
-  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0,
-  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F,
-  0x00, 0x00, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xFC, 0x00, 0xFF, 0x01, 0xFD,
-  0xF8, 0x01, 0xC3, 0xC0, 0x02, 0x0F, 0x00, 0x08, 0x3C, 0x00, 0x20, 0xF0,
-  0x00, 0x83, 0xC0, 0x02, 0x0F, 0x00, 0x08, 0x3C, 0x00, 0x20, 0xF0, 0x00,
-  0x83, 0xC0, 0x02, 0x0F, 0x00, 0x08, 0x3C, 0x00, 0x20, 0xF0, 0x00, 0x83,
-  0xC0, 0x02, 0x0F, 0x00, 0x08, 0x3C, 0x00, 0x20, 0xF0, 0x00, 0x81, 0xE0,
-  0x04, 0x07, 0x80, 0x30, 0x0F, 0x81, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xC0,
-  0x00, 0xFF, 0xC0, 0x7F, 0x3E, 0x00, 0x1E, 0x1E, 0x00, 0x0C, 0x0E, 0x00,
-  0x18, 0x0F, 0x00, 0x18, 0x07, 0x00, 0x10, 0x07, 0x80, 0x30, 0x07, 0x80,
-  0x30, 0x03, 0xC0, 0x60, 0x03, 0xC0, 0x60, 0x01, 0xE0, 0x40, 0x01, 0xE0,
-  0xC0, 0x00, 0xF0, 0xC0, 0x00, 0xF1, 0x80, 0x00, 0x71, 0x80, 0x00, 0x7B,
-  0x00, 0x00, 0x3B, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E,
-  0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x08, 0x00, 0xFF, 0x9F,
-  0xF0, 0x3F, 0x9F, 0x03, 0xE0, 0x07, 0x07, 0x80, 0xF0, 0x03, 0x03, 0xC0,
-  0x78, 0x01, 0x80, 0xE0, 0x1E, 0x00, 0x80, 0x78, 0x0F, 0x00, 0xC0, 0x1C,
-  0x03, 0x80, 0x60, 0x0F, 0x01, 0xE0, 0x20, 0x07, 0x81, 0xF0, 0x30, 0x01,
-  0xC0, 0xBC, 0x18, 0x00, 0xF0, 0xDE, 0x08, 0x00, 0x78, 0x67, 0x0C, 0x00,
-  0x1E, 0x23, 0xC4, 0x00, 0x0F, 0x31, 0xE6, 0x00, 0x03, 0x90, 0x7B, 0x00,
-  0x01, 0xF8, 0x3D, 0x00, 0x00, 0xFC, 0x0F, 0x80, 0x00, 0x3C, 0x07, 0xC0,
-  0x00, 0x1E, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0xE0, 0x00, 0x03, 0x00, 0x70,
-  0x00, 0x01, 0x80, 0x10, 0x00, 0x00, 0x80, 0x08, 0x00, 0x7F, 0xE0, 0xFF,
-  0x0F, 0xC0, 0x1E, 0x03, 0xE0, 0x0E, 0x00, 0xF0, 0x06, 0x00, 0x3C, 0x06,
-  0x00, 0x0F, 0x06, 0x00, 0x07, 0x86, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x7B,
-  0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03,
-  0xF0, 0x00, 0x03, 0x78, 0x00, 0x01, 0x9E, 0x00, 0x01, 0x87, 0x80, 0x01,
-  0x83, 0xE0, 0x01, 0x80, 0xF0, 0x01, 0x80, 0x3C, 0x01, 0x80, 0x1F, 0x01,
-  0xC0, 0x07, 0xC1, 0xE0, 0x03, 0xF3, 0xFE, 0x0F, 0xFE, 0xFF, 0xC0, 0xFF,
-  0x7E, 0x00, 0x1C, 0x1E, 0x00, 0x18, 0x1F, 0x00, 0x30, 0x0F, 0x00, 0x60,
-  0x07, 0x80, 0x60, 0x03, 0xC0, 0xC0, 0x03, 0xE1, 0x80, 0x01, 0xE1, 0x80,
-  0x00, 0xF3, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00,
-  0x00, 0x7E, 0x00, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0x9C,
-  0x00, 0x78, 0xC0, 0x07, 0x84, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x3C,
-  0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01,
-  0xE0, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00,
-  0x07, 0x00, 0x00, 0x78, 0x00, 0x47, 0x80, 0x06, 0x78, 0x00, 0x33, 0x80,
-  0x07, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0xFF, 0x83, 0x06, 0x0C, 0x18,
-  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
-  0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0xF0, 0xC0, 0x18, 0x06, 0x01,
-  0x80, 0x70, 0x0C, 0x03, 0x00, 0xE0, 0x18, 0x06, 0x01, 0xC0, 0x30, 0x0C,
-  0x03, 0x80, 0x60, 0x18, 0x07, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x60,
-  0x1C, 0x03, 0xFE, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18,
-  0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
-  0x0C, 0x1F, 0xF0, 0x03, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x76, 0x00, 0xCE,
-  0x03, 0x8C, 0x06, 0x1C, 0x1C, 0x18, 0x30, 0x30, 0xE0, 0x31, 0x80, 0x67,
-  0x00, 0x6C, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xE0, 0x70,
-  0x18, 0x0C, 0x03, 0x1F, 0x03, 0x8C, 0x38, 0x31, 0xC1, 0x8E, 0x0C, 0x00,
-  0x60, 0x0F, 0x01, 0x98, 0x30, 0xC3, 0x86, 0x38, 0x31, 0xC1, 0x8E, 0x0C,
-  0x78, 0xE5, 0xFB, 0xCF, 0x0C, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x39,
-  0xF0, 0x3B, 0xFC, 0x3C, 0x3E, 0x38, 0x0E, 0x38, 0x0F, 0x38, 0x07, 0x38,
-  0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x06, 0x38, 0x0E, 0x38,
-  0x0C, 0x3C, 0x1C, 0x1F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x7F, 0xE3, 0x87,
-  0xD8, 0x0F, 0x60, 0x1B, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
-  0x0E, 0x00, 0x3C, 0x01, 0x78, 0x19, 0xFF, 0xC3, 0xFE, 0x03, 0xE0, 0x00,
-  0x00, 0x00, 0x1C, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00,
-  0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x07, 0x9C, 0x1F, 0xDC, 0x38, 0x7C, 0x70,
-  0x3C, 0x70, 0x1C, 0x60, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0,
-  0x1C, 0xE0, 0x1C, 0xF0, 0x1C, 0x70, 0x1C, 0x7C, 0x3E, 0x3F, 0xDF, 0x0F,
-  0x90, 0x0F, 0x81, 0xFF, 0x08, 0x3C, 0x80, 0xE7, 0xFF, 0x7F, 0xFF, 0x00,
-  0x18, 0x00, 0xC0, 0x07, 0x00, 0x38, 0x03, 0xE0, 0x37, 0x83, 0x3F, 0xF0,
-  0xFF, 0x03, 0xF0, 0x01, 0xF0, 0x3F, 0xC3, 0x8E, 0x18, 0x00, 0xC0, 0x0E,
-  0x00, 0x70, 0x03, 0x80, 0x1C, 0x03, 0xFE, 0x1F, 0xF0, 0x38, 0x01, 0xC0,
-  0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01,
-  0xC0, 0x0E, 0x00, 0x70, 0x07, 0xC0, 0xFF, 0x80, 0x0F, 0xC0, 0x1F, 0xFF,
-  0x38, 0xFF, 0x70, 0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x30, 0x70, 0x30,
-  0x38, 0x20, 0x1C, 0x60, 0x0F, 0x80, 0x10, 0x00, 0x20, 0x00, 0x60, 0x00,
-  0x7F, 0xE0, 0x3F, 0xFC, 0x1F, 0xFE, 0x20, 0x06, 0x40, 0x02, 0xC0, 0x02,
-  0xC0, 0x04, 0xF0, 0x18, 0x7F, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x38, 0x00,
-  0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
-  0x38, 0x00, 0x38, 0xF0, 0x3B, 0xF8, 0x3E, 0x3C, 0x3C, 0x1C, 0x38, 0x1C,
-  0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C,
-  0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x7C, 0x3E, 0xFE, 0x7F, 0x18, 0x3C,
-  0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3C, 0x7C, 0x1C, 0x1C, 0x1C,
-  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xFF, 0x03, 0x03,
-  0xC1, 0xE0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC3, 0xE0, 0x70,
-  0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
-  0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x37, 0x3B, 0xF8, 0xF8, 0x00, 0x00,
-  0x1C, 0x00, 0x3E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0,
-  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x3F, 0x8E, 0x0F, 0x07, 0x06, 0x03,
-  0x86, 0x01, 0xC4, 0x00, 0xE4, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x1D, 0xC0,
-  0x0E, 0x70, 0x07, 0x1C, 0x03, 0x8F, 0x01, 0xC3, 0xC0, 0xE0, 0xF0, 0xF8,
-  0x3C, 0xFE, 0x7F, 0x80, 0x00, 0x1C, 0x7C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-  0x1C, 0x1C, 0x1C, 0x3C, 0xFF, 0x38, 0xF0, 0x7C, 0x3E, 0xFE, 0x7F, 0x83,
-  0xE3, 0xF0, 0xE0, 0xE0, 0x70, 0x1C, 0x38, 0x1C, 0x07, 0x0E, 0x07, 0x01,
-  0xC3, 0x81, 0xC0, 0x70, 0xE0, 0x70, 0x1C, 0x38, 0x1C, 0x07, 0x0E, 0x07,
-  0x01, 0xC3, 0x81, 0xC0, 0x70, 0xE0, 0x70, 0x1C, 0x38, 0x1C, 0x07, 0x0E,
-  0x07, 0x01, 0xC3, 0x81, 0xE0, 0x73, 0xF9, 0xFC, 0x7F, 0x38, 0xF0, 0xFB,
-  0xF8, 0x3E, 0x3C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38,
-  0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38,
-  0x1C, 0x78, 0x3C, 0xFE, 0x7F, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x7C, 0x78,
-  0x3E, 0x70, 0x1E, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
-  0x0F, 0xF8, 0x0F, 0x78, 0x0E, 0x7C, 0x1C, 0x3E, 0x3C, 0x0F, 0xF0, 0x07,
-  0xC0, 0x18, 0xF0, 0xFB, 0xFC, 0x3E, 0x1E, 0x38, 0x0E, 0x38, 0x0F, 0x38,
-  0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x06, 0x38,
-  0x0E, 0x38, 0x0C, 0x3E, 0x1C, 0x3B, 0xF8, 0x39, 0xE0, 0x38, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x7C, 0x00, 0xFF,
-  0x00, 0x07, 0xC4, 0x1F, 0xEC, 0x3C, 0x3C, 0x70, 0x1C, 0x70, 0x1C, 0x60,
-  0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x1C, 0xF0,
-  0x1C, 0x70, 0x1C, 0x78, 0x3C, 0x3F, 0xDC, 0x1F, 0x1C, 0x00, 0x1C, 0x00,
-  0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3E, 0x00,
-  0xFF, 0x19, 0xFF, 0x7C, 0xF3, 0x9C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0,
-  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x1F, 0x07, 0xF0, 0x3E,
-  0x58, 0x7C, 0x0F, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0xF8, 0x1F, 0x81, 0xF8,
-  0x1E, 0x03, 0xC0, 0xF0, 0x3E, 0x1A, 0x7C, 0x10, 0x30, 0x70, 0xFE, 0xFE,
-  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x79,
-  0x7E, 0x3C, 0xF8, 0x7C, 0x38, 0x3C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C,
-  0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C,
-  0x38, 0x1C, 0x38, 0x1C, 0x3C, 0x7C, 0x1F, 0xDF, 0x0F, 0x18, 0xFE, 0x1F,
-  0x7C, 0x06, 0x38, 0x04, 0x1C, 0x04, 0x1C, 0x0C, 0x0E, 0x08, 0x0E, 0x18,
-  0x07, 0x10, 0x07, 0x10, 0x07, 0x20, 0x03, 0xA0, 0x03, 0xE0, 0x01, 0xC0,
-  0x01, 0xC0, 0x00, 0x80, 0x00, 0x80, 0xFC, 0x7F, 0x1F, 0x78, 0x3C, 0x06,
-  0x38, 0x1C, 0x04, 0x38, 0x1C, 0x04, 0x1C, 0x1C, 0x0C, 0x1C, 0x0E, 0x08,
-  0x1C, 0x1E, 0x18, 0x0E, 0x17, 0x10, 0x0E, 0x37, 0x10, 0x07, 0x23, 0x30,
-  0x07, 0x63, 0xA0, 0x07, 0x43, 0xE0, 0x03, 0xC1, 0xC0, 0x03, 0x81, 0xC0,
-  0x01, 0x80, 0x80, 0x01, 0x00, 0x80, 0x7F, 0x7E, 0x1E, 0x0C, 0x07, 0x8C,
-  0x01, 0xC4, 0x00, 0x76, 0x00, 0x3E, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x03,
-  0xE0, 0x01, 0x70, 0x01, 0x1C, 0x01, 0x8F, 0x01, 0x83, 0x80, 0x80, 0xE0,
-  0xC0, 0x79, 0xF0, 0xFF, 0xFE, 0x0F, 0x7C, 0x06, 0x38, 0x06, 0x1C, 0x04,
-  0x1C, 0x0C, 0x0E, 0x0C, 0x0E, 0x08, 0x0F, 0x18, 0x07, 0x10, 0x07, 0x90,
-  0x03, 0xB0, 0x03, 0xA0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0xC0, 0x00, 0xC0,
-  0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0x00, 0x7E, 0x00,
-  0x7C, 0x00, 0x78, 0x00, 0x7F, 0xF9, 0xFF, 0xE6, 0x07, 0x10, 0x38, 0x00,
-  0xE0, 0x07, 0x00, 0x38, 0x01, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xE0, 0x07,
-  0x01, 0x38, 0x0D, 0xC0, 0x3F, 0xFF, 0xBF, 0xFE, 0x07, 0x0E, 0x1C, 0x18,
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x60, 0x60,
-  0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C,
-  0x0E, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x70, 0x38, 0x18,
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x08, 0x06, 0x06,
-  0x08, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38,
-  0x70, 0xE0, 0x3E, 0x00, 0x7F, 0x87, 0xE3, 0xFE, 0x00, 0x7C };
+  0x12, 0x1F, 0xC2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x1F,
+  0x02, 0x18, 0x12, 0x10, 0x03, 0x26, 0x26, 0x26, 0x26, 0x23, 0x11, 0x32,
+  0x21, 0x41, 0x21, 0x41, 0x21, 0x41, 0x10, 0x62, 0x52, 0x82, 0x52, 0x82,
+  0x52, 0x82, 0x43, 0x82, 0x42, 0x83, 0x42, 0x82, 0x52, 0x4F, 0x11, 0xF1,
+  0x52, 0x52, 0x82, 0x42, 0x92, 0x42, 0x82, 0x52, 0x4F, 0xF4, 0x42, 0x52,
+  0x82, 0x52, 0x82, 0x42, 0x82, 0x52, 0x82, 0x52, 0x82, 0x52, 0x82, 0x52,
+  0x82, 0x52, 0x50, 0x61, 0xC1, 0xA5, 0x62, 0x21, 0x23, 0x22, 0x31, 0x32,
+  0x12, 0x41, 0x32, 0x12, 0x41, 0x41, 0x12, 0x41, 0x41, 0x13, 0x31, 0x73,
+  0x21, 0x76, 0x86, 0x96, 0x95, 0x86, 0x71, 0x23, 0x71, 0x33, 0x61, 0x43,
+  0x51, 0x43, 0x51, 0x44, 0x41, 0x44, 0x41, 0x32, 0x14, 0x21, 0x23, 0x2A,
+  0x56, 0xA1, 0xC1, 0x60, 0x54, 0x91, 0x98, 0x53, 0x84, 0x55, 0x11, 0x84,
+  0x61, 0x42, 0x83, 0x71, 0x32, 0x83, 0x81, 0x32, 0x83, 0x81, 0x22, 0x92,
+  0x81, 0x31, 0xA2, 0x81, 0x22, 0xA2, 0x71, 0x31, 0x54, 0x22, 0x62, 0x22,
+  0x37, 0x22, 0x33, 0x22, 0x34, 0x32, 0x17, 0x32, 0x33, 0x42, 0x24, 0x42,
+  0x33, 0x61, 0xA1, 0x42, 0x71, 0x92, 0x33, 0x71, 0x82, 0x43, 0x71, 0x82,
+  0x42, 0x71, 0x82, 0x52, 0x71, 0x82, 0x52, 0x61, 0x82, 0x63, 0x33, 0x72,
+  0x87, 0x82, 0x94, 0x50, 0x94, 0xF5, 0x6F, 0x32, 0x42, 0xF1, 0x26, 0x2F,
+  0x02, 0x62, 0xF0, 0x26, 0x2F, 0x02, 0x62, 0xF0, 0x25, 0x2F, 0x13, 0x33,
+  0xF1, 0x32, 0x3F, 0x35, 0x48, 0x83, 0x84, 0x95, 0x73, 0x83, 0x13, 0x72,
+  0x83, 0x24, 0x61, 0x74, 0x44, 0x42, 0x73, 0x55, 0x22, 0x74, 0x64, 0x21,
+  0x84, 0x75, 0x94, 0x84, 0x94, 0x94, 0x76, 0x68, 0x42, 0x15, 0x42, 0x39,
+  0x39, 0x57, 0x56, 0x94, 0x30, 0x0F, 0x01, 0x12, 0x12, 0x12, 0x11, 0x81,
+  0x71, 0x71, 0x71, 0x71, 0x72, 0x62, 0x72, 0x63, 0x62, 0x72, 0x63, 0x63,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x72, 0x72, 0x73, 0x72, 0x72, 0x82,
+  0x72, 0x82, 0x82, 0x82, 0x82, 0x01, 0x92, 0x82, 0x82, 0x82, 0x72, 0x82,
+  0x72, 0x73, 0x72, 0x72, 0x73, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x62, 0x72, 0x63, 0x62, 0x72, 0x62, 0x71, 0x71, 0x71, 0x71, 0x71, 0x80,
+  0x42, 0xA2, 0xA2, 0x62, 0x31, 0x32, 0x13, 0x21, 0x24, 0x13, 0x11, 0x14,
+  0x45, 0x82, 0x91, 0x14, 0x33, 0x21, 0x23, 0x13, 0x21, 0x26, 0x22, 0x32,
+  0x52, 0xA2, 0x60, 0x72, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x7F,
+  0xF2, 0x72, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x70, 0x12, 0x1C,
+  0x31, 0x31, 0x21, 0x21, 0x21, 0x30, 0x0F, 0x10, 0x12, 0x18, 0x12, 0x10,
+  0x82, 0x72, 0x82, 0x82, 0x73, 0x72, 0x82, 0x73, 0x72, 0x82, 0x73, 0x72,
+  0x82, 0x73, 0x72, 0x82, 0x73, 0x72, 0x82, 0x73, 0x72, 0x82, 0x73, 0x72,
+  0x80, 0x65, 0x93, 0x23, 0x73, 0x43, 0x53, 0x63, 0x43, 0x63, 0x34, 0x64,
+  0x23, 0x83, 0x14, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
+  0x13, 0x83, 0x23, 0x83, 0x24, 0x64, 0x33, 0x63, 0x43, 0x63, 0x53, 0x43,
+  0x72, 0x42, 0xA4, 0x60, 0x52, 0x73, 0x55, 0x32, 0x23, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x64, 0x49, 0x55, 0x99, 0x6B, 0x43, 0x45, 0x42, 0x74,
+  0x22, 0x84, 0x21, 0xA3, 0xD3, 0xD3, 0xD2, 0xE2, 0xD2, 0xE2, 0xD2, 0xD2,
+  0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xA1, 0x31, 0xA1, 0x3D, 0x2D, 0x2E, 0x20,
+  0x46, 0x68, 0x42, 0x44, 0x21, 0x73, 0x21, 0x82, 0xB2, 0xB2, 0xB1, 0xB1,
+  0xB1, 0xA5, 0x68, 0x94, 0xB3, 0xA3, 0xB2, 0xB2, 0xB2, 0xB2, 0xA2, 0xB2,
+  0x14, 0x43, 0x2A, 0x46, 0x60, 0xA2, 0xE2, 0xD3, 0xC4, 0xC1, 0x12, 0xB1,
+  0x22, 0xA2, 0x22, 0x92, 0x32, 0x91, 0x42, 0x81, 0x52, 0x72, 0x52, 0x71,
+  0x62, 0x61, 0x72, 0x52, 0x72, 0x42, 0x82, 0x4F, 0xF2, 0xA2, 0xE2, 0xE2,
+  0xE2, 0xE2, 0xE2, 0x40, 0xF2, 0x94, 0x94, 0x84, 0x2B, 0x1B, 0x2B, 0x57,
+  0x86, 0x98, 0x69, 0x4A, 0x4A, 0x3B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A,
+  0x31, 0x44, 0x32, 0xA4, 0x66, 0xC3, 0x95, 0x94, 0xB4, 0xB4, 0xB4, 0xB4,
+  0xB5, 0xB4, 0x25, 0x5D, 0x25, 0x54, 0x24, 0x74, 0x14, 0x79, 0x88, 0x88,
+  0x88, 0x84, 0x13, 0x84, 0x14, 0x74, 0x14, 0x73, 0x34, 0x54, 0x44, 0x34,
+  0x69, 0x86, 0x50, 0x2C, 0x1D, 0x1F, 0x09, 0x21, 0x1A, 0x2C, 0x2B, 0x2C,
+  0x2C, 0x2B, 0x2C, 0x2C, 0x2B, 0x3B, 0x2C, 0x2B, 0x3B, 0x2C, 0x2B, 0x3B,
+  0x2C, 0x2B, 0x3B, 0x27, 0x45, 0x58, 0x33, 0x43, 0x22, 0x65, 0x84, 0x84,
+  0x85, 0x72, 0x13, 0x52, 0x24, 0x32, 0x44, 0x12, 0x65, 0x85, 0x61, 0x15,
+  0x41, 0x44, 0x22, 0x53, 0x12, 0x75, 0x84, 0x84, 0x84, 0x82, 0x12, 0x62,
+  0x23, 0x43, 0x38, 0x65, 0x30, 0x55, 0x99, 0x64, 0x34, 0x53, 0x54, 0x34,
+  0x64, 0x23, 0x74, 0x14, 0x83, 0x14, 0x88, 0x88, 0x88, 0x88, 0x89, 0x74,
+  0x14, 0x74, 0x24, 0x46, 0x38, 0x13, 0x55, 0x24, 0xC4, 0xB4, 0xC3, 0xC4,
+  0xB4, 0xB4, 0xA4, 0xA4, 0xA3, 0xC0, 0x12, 0x18, 0x12, 0xFF, 0x82, 0x18,
+  0x12, 0x10, 0x12, 0x24, 0x14, 0x22, 0xFF, 0xF4, 0x22, 0x41, 0x41, 0x44,
+  0x14, 0x13, 0x13, 0x13, 0x13, 0xF1, 0x2E, 0x4B, 0x6A, 0x6A, 0x6A, 0x5A,
+  0x6A, 0x6C, 0x4E, 0x5E, 0x6E, 0x6F, 0x05, 0xF0, 0x5F, 0x06, 0xE6, 0xE4,
+  0xF2, 0x10, 0x0F, 0xF6, 0xFF, 0xFF, 0xFF, 0x0F, 0xF6, 0x01, 0xF2, 0x4E,
+  0x6E, 0x6F, 0x05, 0xF0, 0x5F, 0x06, 0xE6, 0xE5, 0xE4, 0xC6, 0xA6, 0xA5,
+  0xA6, 0xA6, 0xA6, 0xB4, 0xE2, 0xF1, 0x36, 0x69, 0x32, 0x45, 0x12, 0x64,
+  0x12, 0x77, 0x67, 0x64, 0x94, 0x93, 0xA3, 0x93, 0xA2, 0xB1, 0xB2, 0xB1,
+  0xC1, 0xB1, 0xC1, 0xC1, 0xFF, 0x72, 0xA4, 0x94, 0xA3, 0x50, 0x97, 0xF0,
+  0xBB, 0x47, 0x48, 0x4A, 0x36, 0x3D, 0x34, 0x3F, 0x02, 0x43, 0xF1, 0x22,
+  0x37, 0x47, 0x12, 0x36, 0x93, 0x65, 0x33, 0x44, 0x45, 0x35, 0x25, 0x45,
+  0x26, 0x25, 0x45, 0x25, 0x35, 0x44, 0x26, 0x35, 0x44, 0x26, 0x25, 0x54,
+  0x25, 0x35, 0x11, 0x34, 0x25, 0x34, 0x22, 0x33, 0x33, 0x43, 0x23, 0x34,
+  0x52, 0x65, 0x33, 0x44, 0x46, 0x4F, 0x64, 0xF7, 0x48, 0x3A, 0xDE, 0x78,
+  0xB1, 0xF7, 0x3F, 0x63, 0xF6, 0x3F, 0x55, 0xF4, 0x11, 0x3F, 0x32, 0x14,
+  0xF2, 0x13, 0x3F, 0x12, 0x34, 0xF0, 0x24, 0x3E, 0x25, 0x4D, 0x26, 0x3D,
+  0x17, 0x4B, 0x27, 0x4B, 0xDA, 0xF0, 0x92, 0x94, 0x82, 0xB4, 0x72, 0xB4,
+  0x62, 0xD4, 0x52, 0xD4, 0x43, 0xD5, 0x26, 0x99, 0x0E, 0x8F, 0x06, 0x45,
+  0x65, 0x47, 0x45, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x47,
+  0x45, 0x46, 0x46, 0xC8, 0xD7, 0x46, 0x55, 0x48, 0x44, 0x49, 0x43, 0x49,
+  0x43, 0x49, 0x43, 0x49, 0x43, 0x49, 0x43, 0x48, 0x44, 0x46, 0x63, 0xF0,
+  0x3F, 0x05, 0x87, 0x51, 0x7C, 0x12, 0x56, 0x56, 0x45, 0x94, 0x34, 0xC3,
+  0x34, 0xD2, 0x24, 0xE2, 0x24, 0xF0, 0x11, 0x4F, 0x34, 0xF3, 0x4F, 0x34,
+  0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF4, 0x4F, 0x34, 0xF4, 0x4F, 0x34,
+  0xE1, 0x45, 0xA3, 0x56, 0x63, 0x8D, 0xC7, 0x70, 0x0E, 0xBF, 0x09, 0x45,
+  0x77, 0x48, 0x56, 0x49, 0x55, 0x4A, 0x45, 0x4B, 0x44, 0x4B, 0x44, 0x4C,
+  0x43, 0x4C, 0x43, 0x4C, 0x43, 0x4C, 0x43, 0x4C, 0x43, 0x4C, 0x43, 0x4C,
+  0x43, 0x4B, 0x44, 0x4B, 0x44, 0x4A, 0x45, 0x4A, 0x45, 0x48, 0x56, 0x46,
+  0x66, 0xF0, 0x6E, 0x90, 0x0F, 0x24, 0xF1, 0x54, 0x92, 0x54, 0xA1, 0x54,
+  0xA1, 0x54, 0xF1, 0x4F, 0x14, 0xF1, 0x48, 0x17, 0x47, 0x27, 0xD7, 0xD7,
+  0x47, 0x27, 0x48, 0x17, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0xD1, 0x24, 0xC1,
+  0x34, 0xB2, 0x34, 0x94, 0x2F, 0x31, 0xF3, 0x20, 0x0F, 0x21, 0xF1, 0x24,
+  0x92, 0x24, 0xA1, 0x24, 0xA1, 0x24, 0xD4, 0xD4, 0xD4, 0x81, 0x44, 0x72,
+  0x4D, 0x4D, 0x44, 0x72, 0x44, 0x81, 0x44, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xC6, 0xA8, 0x90, 0x87, 0x61, 0x7C, 0x13, 0x65, 0x66, 0x45, 0xA4,
+  0x35, 0xC3, 0x34, 0xE2, 0x24, 0xF1, 0x12, 0x4F, 0x34, 0xF4, 0x4F, 0x44,
+  0xF4, 0x4C, 0xBD, 0x51, 0x4E, 0x41, 0x4E, 0x41, 0x4E, 0x42, 0x4D, 0x42,
+  0x4D, 0x43, 0x4C, 0x43, 0x5B, 0x44, 0x5A, 0x45, 0x66, 0x58, 0xEC, 0x77,
+  0x08, 0x68, 0x16, 0x86, 0x34, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4,
+  0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x4F, 0x34, 0xF3, 0x44,
+  0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x44,
+  0xA4, 0x44, 0xA4, 0x44, 0xA4, 0x36, 0x86, 0x18, 0x68, 0x09, 0x16, 0x44,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x46, 0x29, 0x48, 0x56, 0x74, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x32, 0x33, 0x34, 0x23, 0x38, 0x55, 0x60, 0x08, 0x59,
+  0x26, 0x84, 0x64, 0x93, 0x74, 0x83, 0x84, 0x72, 0xA4, 0x62, 0xB4, 0x52,
+  0xC4, 0x42, 0xD4, 0x32, 0xE4, 0x22, 0xF0, 0x8F, 0x09, 0xE4, 0x15, 0xD4,
+  0x34, 0xC4, 0x44, 0xB4, 0x54, 0xA4, 0x64, 0x94, 0x74, 0x84, 0x75, 0x74,
+  0x85, 0x64, 0x95, 0x46, 0x86, 0x28, 0x5A, 0x08, 0xC6, 0xE4, 0xF0, 0x4F,
+  0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F,
+  0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4C, 0x12, 0x4B, 0x13,
+  0x4A, 0x23, 0x48, 0x42, 0xF2, 0x1F, 0x22, 0x06, 0xF1, 0x72, 0x5F, 0x06,
+  0x44, 0xE6, 0x55, 0xD6, 0x55, 0xD1, 0x14, 0x51, 0x14, 0xB2, 0x14, 0x51,
+  0x14, 0xB2, 0x14, 0x51, 0x24, 0x92, 0x24, 0x51, 0x24, 0x92, 0x24, 0x51,
+  0x34, 0x72, 0x34, 0x51, 0x34, 0x72, 0x34, 0x51, 0x44, 0x52, 0x44, 0x51,
+  0x44, 0x52, 0x44, 0x51, 0x54, 0x32, 0x54, 0x51, 0x54, 0x32, 0x54, 0x51,
+  0x64, 0x12, 0x64, 0x51, 0x64, 0x12, 0x64, 0x51, 0x66, 0x74, 0x51, 0x75,
+  0x74, 0x51, 0x74, 0x84, 0x51, 0x83, 0x84, 0x43, 0x72, 0x86, 0x17, 0x61,
+  0x78, 0x06, 0xA7, 0x24, 0xC3, 0x54, 0xC1, 0x65, 0xB1, 0x66, 0xA1, 0x61,
+  0x15, 0x91, 0x61, 0x25, 0x81, 0x61, 0x34, 0x81, 0x61, 0x35, 0x71, 0x61,
+  0x45, 0x61, 0x61, 0x55, 0x51, 0x61, 0x65, 0x41, 0x61, 0x75, 0x31, 0x61,
+  0x84, 0x31, 0x61, 0x85, 0x21, 0x61, 0x95, 0x11, 0x61, 0xA6, 0x61, 0xB5,
+  0x61, 0xC4, 0x61, 0xD3, 0x61, 0xD3, 0x53, 0xD2, 0x37, 0xC1, 0x30, 0x87,
+  0xEB, 0xA5, 0x55, 0x74, 0x94, 0x54, 0xB4, 0x44, 0xC3, 0x34, 0xD4, 0x24,
+  0xD4, 0x14, 0xF0, 0x8F, 0x08, 0xF0, 0x8F, 0x08, 0xF0, 0x8F, 0x08, 0xF0,
+  0x8F, 0x04, 0x14, 0xD4, 0x24, 0xD4, 0x33, 0xC4, 0x44, 0xB4, 0x54, 0x94,
+  0x75, 0x55, 0xAB, 0xE7, 0x80, 0x0D, 0x6E, 0x54, 0x55, 0x44, 0x74, 0x34,
+  0x75, 0x24, 0x84, 0x24, 0x84, 0x24, 0x84, 0x24, 0x84, 0x24, 0x75, 0x24,
+  0x74, 0x34, 0x55, 0x4D, 0x5B, 0x74, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+  0xD5, 0xC8, 0xA0, 0x87, 0xEB, 0xA5, 0x55, 0x74, 0x94, 0x54, 0xB4, 0x44,
+  0xB4, 0x34, 0xD4, 0x24, 0xD4, 0x14, 0xF0, 0x31, 0x4F, 0x08, 0xF0, 0x8F,
+  0x08, 0xF0, 0x8F, 0x08, 0xF0, 0x8F, 0x04, 0x13, 0xF0, 0x32, 0x4D, 0x42,
+  0x4D, 0x43, 0x4B, 0x45, 0x3B, 0x37, 0x39, 0x39, 0x45, 0x4D, 0x7F, 0x25,
+  0xF4, 0x5F, 0x45, 0xF4, 0x6F, 0x55, 0xF5, 0x60, 0x0C, 0xAE, 0x84, 0x55,
+  0x74, 0x64, 0x74, 0x74, 0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x64, 0x74,
+  0x64, 0x64, 0x74, 0x45, 0x8C, 0x99, 0xC4, 0x24, 0xB4, 0x34, 0xA4, 0x44,
+  0x94, 0x44, 0x94, 0x54, 0x84, 0x64, 0x74, 0x74, 0x64, 0x75, 0x46, 0x75,
+  0x28, 0x76, 0x54, 0x41, 0x5B, 0x44, 0x45, 0x32, 0x83, 0x23, 0x92, 0x23,
+  0x92, 0x23, 0xA1, 0x24, 0xC5, 0xC6, 0xB7, 0xA7, 0xB7, 0xB6, 0xC5, 0xC6,
+  0xB5, 0xB6, 0xA7, 0x94, 0x13, 0x74, 0x24, 0x54, 0x31, 0x29, 0x41, 0x46,
+  0x40, 0x0F, 0xFD, 0x54, 0x55, 0x64, 0x63, 0x74, 0x71, 0x84, 0xF1, 0x4F,
+  0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F,
+  0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x14, 0xF1, 0x4F, 0x06, 0xD8, 0x60,
+  0x08, 0x77, 0x16, 0xA3, 0x44, 0xC1, 0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1,
+  0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1,
+  0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1, 0x54, 0xC1,
+  0x64, 0xA1, 0x74, 0x92, 0x85, 0x62, 0xAB, 0xD7, 0x80, 0x0A, 0x77, 0x25,
+  0xC4, 0x44, 0xD2, 0x63, 0xC2, 0x74, 0xB2, 0x83, 0xB1, 0x94, 0x92, 0x94,
+  0x92, 0xA4, 0x72, 0xB4, 0x72, 0xC4, 0x61, 0xD4, 0x52, 0xE4, 0x42, 0xE4,
+  0x32, 0xF1, 0x33, 0x2F, 0x14, 0x12, 0xF3, 0x31, 0x2F, 0x35, 0xF5, 0x4F,
+  0x54, 0xF6, 0x2F, 0x72, 0xF7, 0x1B, 0x09, 0x29, 0x67, 0x25, 0x65, 0xA3,
+  0x54, 0x74, 0xA2, 0x64, 0x74, 0xA2, 0x73, 0x84, 0x91, 0x84, 0x74, 0x82,
+  0x93, 0x83, 0x82, 0x94, 0x74, 0x71, 0xA4, 0x65, 0x62, 0xB3, 0x61, 0x14,
+  0x52, 0xB4, 0x42, 0x14, 0x51, 0xC4, 0x42, 0x23, 0x42, 0xD4, 0x31, 0x34,
+  0x31, 0xE4, 0x22, 0x34, 0x22, 0xF0, 0x32, 0x15, 0x41, 0x2F, 0x06, 0x54,
+  0x11, 0xF1, 0x66, 0x5F, 0x24, 0x75, 0xF2, 0x47, 0x4F, 0x34, 0x83, 0xF4,
+  0x29, 0x3F, 0x42, 0xA1, 0xF5, 0x1B, 0x1A, 0x1A, 0x58, 0x46, 0x94, 0x75,
+  0x93, 0x94, 0x92, 0xB4, 0x72, 0xD4, 0x52, 0xE4, 0x42, 0xF1, 0x42, 0x2F,
+  0x34, 0x12, 0xF3, 0x6F, 0x54, 0xF7, 0x4F, 0x56, 0xF3, 0x21, 0x4F, 0x32,
+  0x24, 0xF1, 0x24, 0x4E, 0x25, 0x5C, 0x27, 0x4B, 0x29, 0x49, 0x2A, 0x57,
+  0x3B, 0x55, 0x4B, 0x62, 0x95, 0xB0, 0x0A, 0x68, 0x16, 0xC3, 0x54, 0xC2,
+  0x65, 0xA2, 0x84, 0x92, 0xA4, 0x82, 0xB4, 0x62, 0xC5, 0x42, 0xE4, 0x42,
+  0xF0, 0x42, 0x2F, 0x17, 0xF3, 0x6F, 0x44, 0xF5, 0x4F, 0x54, 0xF5, 0x4F,
+  0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF4, 0x6F, 0x1A, 0x70, 0x2F,
+  0x33, 0xF3, 0x23, 0xB4, 0x32, 0xB4, 0x41, 0xC3, 0xF2, 0x4F, 0x14, 0xF1,
+  0x4F, 0x23, 0xF2, 0x4F, 0x14, 0xF1, 0x4F, 0x23, 0xF2, 0x4F, 0x14, 0xF1,
+  0x4F, 0x23, 0xF2, 0x4C, 0x13, 0x4C, 0x22, 0x4D, 0x22, 0x3C, 0x32, 0xF4,
+  0x1F, 0x51, 0x09, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x57, 0x02, 0x92, 0x82, 0x82, 0x83, 0x82, 0x82,
+  0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82,
+  0x83, 0x82, 0x82, 0x83, 0x82, 0x07, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x59, 0x63, 0xB4, 0xB5, 0x93,
+  0x12, 0x92, 0x23, 0x73, 0x32, 0x72, 0x43, 0x53, 0x52, 0x52, 0x62, 0x43,
+  0x72, 0x32, 0x82, 0x23, 0x92, 0x12, 0xA2, 0x10, 0x0F, 0xF6, 0x02, 0x63,
+  0x63, 0x72, 0x72, 0x82, 0x35, 0x63, 0x32, 0x43, 0x52, 0x33, 0x52, 0x33,
+  0x52, 0xB2, 0x94, 0x72, 0x22, 0x52, 0x42, 0x43, 0x42, 0x33, 0x52, 0x33,
+  0x52, 0x33, 0x52, 0x34, 0x33, 0x21, 0x16, 0x14, 0x24, 0x42, 0x20, 0xF3,
+  0x3B, 0x5D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x32, 0x56, 0x31, 0x84,
+  0x44, 0x53, 0x37, 0x33, 0x37, 0x42, 0x38, 0x32, 0x38, 0x32, 0x38, 0x32,
+  0x38, 0x32, 0x38, 0x32, 0x38, 0x23, 0x37, 0x33, 0x37, 0x24, 0x45, 0x35,
+  0x99, 0x65, 0x56, 0x6A, 0x33, 0x45, 0x12, 0x74, 0x12, 0x82, 0x12, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC3, 0xB4, 0x91, 0x14, 0x62, 0x2B, 0x49, 0x75, 0x50,
+  0xFC, 0x3B, 0x5D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x37, 0x42, 0x35, 0x71,
+  0x34, 0x34, 0x53, 0x36, 0x43, 0x37, 0x33, 0x28, 0x32, 0x38, 0x32, 0x38,
+  0x32, 0x38, 0x32, 0x38, 0x32, 0x38, 0x32, 0x47, 0x33, 0x37, 0x33, 0x54,
+  0x53, 0x81, 0x54, 0x52, 0x14, 0x45, 0x69, 0x41, 0x54, 0x21, 0x73, 0x2B,
+  0x1F, 0x0B, 0x2B, 0x2B, 0x3A, 0x39, 0x57, 0x21, 0x45, 0x22, 0xA4, 0x86,
+  0x64, 0x75, 0x68, 0x43, 0x33, 0x42, 0xB2, 0xA3, 0xA3, 0xA3, 0xA3, 0x89,
+  0x49, 0x63, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+  0xA3, 0x95, 0x69, 0x40, 0x46, 0x9D, 0x23, 0x38, 0x13, 0x53, 0x53, 0x53,
+  0x53, 0x62, 0x53, 0x62, 0x53, 0x62, 0x63, 0x51, 0x83, 0x32, 0x95, 0xA1,
+  0xE1, 0xE2, 0xEA, 0x7C, 0x5C, 0x31, 0xA2, 0x21, 0xC1, 0x12, 0xC1, 0x12,
+  0xB1, 0x24, 0x72, 0x4B, 0x76, 0x70, 0xF3, 0x3B, 0x5D, 0x3D, 0x3D, 0x3D,
+  0x3D, 0x3D, 0x3D, 0x33, 0x46, 0x31, 0x75, 0x53, 0x44, 0x45, 0x34, 0x36,
+  0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x34, 0x36,
+  0x34, 0x36, 0x34, 0x36, 0x34, 0x36, 0x33, 0x54, 0x51, 0x72, 0x70, 0x32,
+  0x54, 0x44, 0x52, 0xFF, 0xA1, 0x44, 0x35, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x44, 0x28, 0x62, 0x64, 0x54, 0x62,
+  0xFF, 0xF0, 0x15, 0x44, 0x56, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x21, 0x32,
+  0x31, 0x73, 0x53, 0xF4, 0x3C, 0x5E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+  0x34, 0x73, 0x35, 0x45, 0x35, 0x27, 0x34, 0x28, 0x33, 0x1A, 0x32, 0x1B,
+  0x6B, 0x7A, 0x31, 0x3A, 0x32, 0x39, 0x33, 0x38, 0x33, 0x47, 0x34, 0x46,
+  0x35, 0x44, 0x55, 0x42, 0x72, 0x80, 0xB3, 0x35, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x44, 0x28, 0x23, 0x34, 0x55, 0x45, 0x17, 0x28,
+  0x55, 0x36, 0x43, 0x53, 0x63, 0x73, 0x43, 0x63, 0x73, 0x43, 0x63, 0x73,
+  0x43, 0x63, 0x73, 0x43, 0x63, 0x73, 0x43, 0x63, 0x73, 0x43, 0x63, 0x73,
+  0x43, 0x63, 0x73, 0x43, 0x63, 0x73, 0x43, 0x63, 0x73, 0x43, 0x63, 0x73,
+  0x43, 0x64, 0x63, 0x27, 0x27, 0x37, 0x23, 0x34, 0x45, 0x17, 0x55, 0x34,
+  0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63,
+  0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x34, 0x54,
+  0x27, 0x27, 0x56, 0x8A, 0x54, 0x35, 0x34, 0x55, 0x23, 0x74, 0x14, 0x88,
+  0x88, 0x88, 0x88, 0x89, 0x74, 0x14, 0x73, 0x25, 0x53, 0x45, 0x34, 0x68,
+  0x95, 0x60, 0x32, 0x34, 0x45, 0x18, 0x45, 0x44, 0x33, 0x73, 0x33, 0x74,
+  0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x82,
+  0x33, 0x73, 0x33, 0x72, 0x45, 0x43, 0x43, 0x17, 0x53, 0x24, 0x73, 0xD3,
+  0xD3, 0xD3, 0xD3, 0xD3, 0xC5, 0xA8, 0x80, 0x55, 0x31, 0x58, 0x12, 0x44,
+  0x44, 0x33, 0x73, 0x33, 0x73, 0x32, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23,
+  0x83, 0x23, 0x83, 0x23, 0x83, 0x24, 0x73, 0x33, 0x73, 0x34, 0x54, 0x48,
+  0x13, 0x55, 0x33, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xC5, 0x98, 0x32,
+  0x29, 0x15, 0x24, 0x23, 0x23, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x75, 0x57, 0x40, 0x25, 0x21, 0x12, 0x45, 0x64, 0x64,
+  0x75, 0x74, 0x75, 0x66, 0x66, 0x64, 0x74, 0x64, 0x65, 0x42, 0x11, 0x25,
+  0x20, 0x31, 0x62, 0x53, 0x47, 0x17, 0x23, 0x53, 0x53, 0x53, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x53, 0x54, 0x21, 0x16, 0x34, 0x20, 0x05, 0x45,
+  0x43, 0x54, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63,
+  0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x43, 0x63,
+  0x44, 0x35, 0x57, 0x15, 0x44, 0x32, 0x30, 0x07, 0x45, 0x15, 0x72, 0x33,
+  0x81, 0x53, 0x71, 0x53, 0x62, 0x63, 0x51, 0x73, 0x42, 0x83, 0x31, 0x93,
+  0x31, 0x93, 0x21, 0xB3, 0x11, 0xB5, 0xC3, 0xD3, 0xE1, 0xF0, 0x17, 0x06,
+  0x37, 0x35, 0x14, 0x54, 0x72, 0x33, 0x63, 0x71, 0x43, 0x63, 0x71, 0x53,
+  0x53, 0x62, 0x53, 0x63, 0x51, 0x63, 0x54, 0x42, 0x73, 0x41, 0x13, 0x31,
+  0x83, 0x32, 0x13, 0x31, 0x93, 0x21, 0x32, 0x22, 0x93, 0x12, 0x33, 0x11,
+  0xA3, 0x11, 0x45, 0xB4, 0x53, 0xC3, 0x63, 0xD2, 0x71, 0xE1, 0x81, 0x70,
+  0x17, 0x16, 0x44, 0x52, 0x74, 0x32, 0x93, 0x31, 0xB3, 0x12, 0xB5, 0xD3,
+  0xF0, 0x3D, 0x5C, 0x11, 0x3B, 0x13, 0x39, 0x23, 0x47, 0x25, 0x37, 0x17,
+  0x35, 0x27, 0x42, 0x54, 0x80, 0x07, 0x54, 0x15, 0x72, 0x33, 0x82, 0x43,
+  0x71, 0x53, 0x62, 0x63, 0x52, 0x63, 0x51, 0x74, 0x32, 0x83, 0x31, 0x94,
+  0x21, 0xA3, 0x12, 0xA3, 0x11, 0xC4, 0xC4, 0xD2, 0xE2, 0xE1, 0xF0, 0x1E,
+  0x2E, 0x1E, 0x29, 0x6A, 0x5B, 0x4B, 0x1C, 0x2C, 0x22, 0x63, 0x31, 0x63,
+  0xB3, 0xA3, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4, 0xA3, 0x71, 0x23, 0x72, 0x13,
+  0x8F, 0x01, 0xD1, 0x53, 0x43, 0x43, 0x52, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x52, 0x52, 0x62, 0x81, 0x72, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x0F, 0xFF, 0x30,
+  0x03, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x71, 0x82, 0x62, 0x51, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x53, 0x43, 0x43, 0x50, 0x25, 0xA8, 0x46, 0x39, 0xA5,
+  0x20 };
 
 const GFXglyph FreeSerif18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
   {     0,   4,  24,  12,    5,  -23 },   // 0x21 '!'
-  {    12,   8,   9,  14,    3,  -23 },   // 0x22 '"'
-  {    21,  17,  23,  17,    0,  -22 },   // 0x23 '#'
-  {    70,  13,  27,  17,    2,  -24 },   // 0x24 '$'
-  {   114,  25,  23,  29,    2,  -22 },   // 0x25 '%'
-  {   186,  25,  25,  27,    1,  -24 },   // 0x26 '&'
-  {   265,   3,   9,   7,    2,  -23 },   // 0x27 '''
-  {   269,   9,  30,  12,    2,  -23 },   // 0x28 '('
-  {   303,   9,  30,  12,    1,  -22 },   // 0x29 ')'
-  {   337,  12,  14,  18,    3,  -23 },   // 0x2A '*'
-  {   358,  16,  18,  20,    2,  -17 },   // 0x2B '+'
-  {   394,   4,   9,   9,    2,   -3 },   // 0x2C ','
-  {   399,   8,   2,  12,    1,   -8 },   // 0x2D '-'
-  {   401,   4,   4,   9,    2,   -3 },   // 0x2E '.'
-  {   403,  10,  24,  10,    0,  -23 },   // 0x2F '/'
-  {   433,  16,  24,  18,    1,  -23 },   // 0x30 '0'
-  {   481,  10,  24,  18,    3,  -23 },   // 0x31 '1'
-  {   511,  16,  24,  17,    1,  -23 },   // 0x32 '2'
-  {   559,  13,  24,  17,    2,  -23 },   // 0x33 '3'
-  {   598,  16,  23,  18,    0,  -22 },   // 0x34 '4'
-  {   644,  13,  24,  17,    2,  -23 },   // 0x35 '5'
-  {   683,  16,  24,  18,    1,  -23 },   // 0x36 '6'
-  {   731,  14,  23,  18,    1,  -22 },   // 0x37 '7'
-  {   772,  12,  25,  18,    2,  -24 },   // 0x38 '8'
-  {   810,  16,  26,  17,    1,  -24 },   // 0x39 '9'
-  {   862,   4,  17,   9,    2,  -16 },   // 0x3A ':'
-  {   871,   5,  22,   9,    2,  -16 },   // 0x3B ';'
-  {   885,  18,  18,  20,    1,  -17 },   // 0x3C '<'
-  {   926,  18,   9,  20,    1,  -12 },   // 0x3D '='
-  {   947,  18,  18,  20,    1,  -17 },   // 0x3E '>'
-  {   988,  13,  25,  16,    2,  -24 },   // 0x3F '?'
-  {  1029,  24,  25,  30,    3,  -24 },   // 0x40 '@'
-  {  1104,  24,  23,  25,    1,  -22 },   // 0x41 'A'
-  {  1173,  20,  23,  22,    1,  -22 },   // 0x42 'B'
-  {  1231,  22,  24,  23,    1,  -23 },   // 0x43 'C'
-  {  1297,  23,  23,  25,    1,  -22 },   // 0x44 'D'
-  {  1364,  20,  23,  21,    2,  -22 },   // 0x45 'E'
-  {  1422,  17,  23,  20,    2,  -22 },   // 0x46 'F'
-  {  1471,  23,  24,  25,    1,  -23 },   // 0x47 'G'
-  {  1540,  22,  23,  25,    2,  -22 },   // 0x48 'H'
-  {  1604,   9,  23,  11,    2,  -22 },   // 0x49 'I'
-  {  1630,  12,  23,  13,    0,  -22 },   // 0x4A 'J'
-  {  1665,  23,  23,  25,    2,  -22 },   // 0x4B 'K'
-  {  1732,  19,  23,  21,    2,  -22 },   // 0x4C 'L'
-  {  1787,  29,  23,  31,    1,  -22 },   // 0x4D 'M'
-  {  1871,  23,  23,  25,    1,  -22 },   // 0x4E 'N'
-  {  1938,  23,  24,  25,    1,  -23 },   // 0x4F 'O'
-  {  2007,  18,  23,  20,    1,  -22 },   // 0x50 'P'
-  {  2059,  23,  30,  25,    1,  -23 },   // 0x51 'Q'
-  {  2146,  21,  23,  23,    2,  -22 },   // 0x52 'R'
-  {  2207,  16,  24,  19,    1,  -23 },   // 0x53 'S'
-  {  2255,  20,  23,  21,    1,  -22 },   // 0x54 'T'
-  {  2313,  22,  23,  25,    2,  -22 },   // 0x55 'U'
-  {  2377,  24,  23,  25,    0,  -22 },   // 0x56 'V'
-  {  2446,  33,  23,  33,    0,  -22 },   // 0x57 'W'
-  {  2541,  25,  23,  25,    0,  -22 },   // 0x58 'X'
-  {  2613,  24,  23,  25,    1,  -22 },   // 0x59 'Y'
-  {  2682,  21,  23,  21,    0,  -22 },   // 0x5A 'Z'
-  {  2743,   7,  28,  12,    3,  -22 },   // 0x5B '['
-  {  2768,  10,  24,  10,    0,  -23 },   // 0x5C '\'
-  {  2798,   7,  28,  12,    2,  -22 },   // 0x5D ']'
-  {  2823,  15,  13,  16,    1,  -22 },   // 0x5E '^'
-  {  2848,  18,   2,  17,    0,    3 },   // 0x5F '_'
-  {  2853,   8,   6,   9,    1,  -23 },   // 0x60 '`'
-  {  2859,  13,  16,  15,    2,  -15 },   // 0x61 'a'
-  {  2885,  16,  25,  17,    1,  -24 },   // 0x62 'b'
-  {  2935,  14,  16,  16,    1,  -15 },   // 0x63 'c'
-  {  2963,  16,  25,  17,    1,  -24 },   // 0x64 'd'
-  {  3013,  13,  16,  16,    1,  -15 },   // 0x65 'e'
-  {  3039,  13,  25,  13,    0,  -24 },   // 0x66 'f'
-  {  3080,  16,  24,  16,    1,  -15 },   // 0x67 'g'
-  {  3128,  16,  25,  17,    1,  -24 },   // 0x68 'h'
-  {  3178,   8,  24,  10,    0,  -23 },   // 0x69 'i'
-  {  3202,   9,  32,  12,    0,  -23 },   // 0x6A 'j'
-  {  3238,  17,  25,  18,    1,  -24 },   // 0x6B 'k'
-  {  3292,   8,  25,   9,    0,  -24 },   // 0x6C 'l'
-  {  3317,  26,  16,  27,    1,  -15 },   // 0x6D 'm'
-  {  3369,  16,  16,  17,    1,  -15 },   // 0x6E 'n'
-  {  3401,  16,  16,  17,    1,  -15 },   // 0x6F 'o'
-  {  3433,  16,  24,  17,    1,  -15 },   // 0x70 'p'
-  {  3481,  16,  24,  17,    1,  -15 },   // 0x71 'q'
-  {  3529,  11,  16,  12,    1,  -15 },   // 0x72 'r'
-  {  3551,  10,  16,  13,    1,  -15 },   // 0x73 's'
-  {  3571,   8,  19,  10,    2,  -18 },   // 0x74 't'
-  {  3590,  16,  16,  17,    1,  -15 },   // 0x75 'u'
-  {  3622,  16,  16,  16,    0,  -15 },   // 0x76 'v'
-  {  3654,  24,  16,  24,    0,  -15 },   // 0x77 'w'
-  {  3702,  17,  16,  17,    0,  -15 },   // 0x78 'x'
-  {  3736,  16,  24,  16,    0,  -15 },   // 0x79 'y'
-  {  3784,  14,  16,  15,    0,  -15 },   // 0x7A 'z'
-  {  3812,   8,  30,  17,    3,  -23 },   // 0x7B '{'
-  {  3842,   2,  24,   7,    2,  -23 },   // 0x7C '|'
-  {  3848,   8,  30,  17,    6,  -22 },   // 0x7D '}'
-  {  3878,  16,   4,  17,    1,  -10 } }; // 0x7E '~'
+  {    16,   8,   9,  14,    3,  -23 },   // 0x22 '"'
+  {    31,  17,  23,  17,    0,  -22 },   // 0x23 '#'
+  {    75,  13,  27,  17,    2,  -24 },   // 0x24 '$'
+  {   124,  25,  23,  29,    2,  -22 },   // 0x25 '%'
+  {   196,  25,  25,  27,    1,  -24 },   // 0x26 '&'
+  {   257,   3,   9,   7,    2,  -23 },   // 0x27 '''
+  {   263,   9,  30,  12,    2,  -23 },   // 0x28 '('
+  {   293,   9,  30,  12,    1,  -22 },   // 0x29 ')'
+  {   324,  12,  14,  18,    3,  -23 },   // 0x2A '*'
+  {   351,  16,  18,  20,    2,  -17 },   // 0x2B '+'
+  {   370,   4,   9,   9,    2,   -3 },   // 0x2C ','
+  {   378,   8,   2,  12,    1,   -8 },   // 0x2D '-'
+  {   380,   4,   4,   9,    2,   -3 },   // 0x2E '.'
+  {   384,  10,  24,  10,    0,  -23 },   // 0x2F '/'
+  {   409,  16,  24,  18,    1,  -23 },   // 0x30 '0'
+  {   448,  10,  24,  18,    3,  -23 },   // 0x31 '1'
+  {   473,  16,  24,  17,    1,  -23 },   // 0x32 '2'
+  {   504,  13,  24,  17,    2,  -23 },   // 0x33 '3'
+  {   533,  16,  23,  18,    0,  -22 },   // 0x34 '4'
+  {   568,  13,  24,  17,    2,  -23 },   // 0x35 '5'
+  {   593,  16,  24,  18,    1,  -23 },   // 0x36 '6'
+  {   627,  14,  23,  18,    1,  -22 },   // 0x37 '7'
+  {   652,  12,  25,  18,    2,  -24 },   // 0x38 '8'
+  {   689,  16,  26,  17,    1,  -24 },   // 0x39 '9'
+  {   726,   4,  17,   9,    2,  -16 },   // 0x3A ':'
+  {   734,   5,  22,   9,    2,  -16 },   // 0x3B ';'
+  {   749,  18,  18,  20,    1,  -17 },   // 0x3C '<'
+  {   770,  18,   9,  20,    1,  -12 },   // 0x3D '='
+  {   777,  18,  18,  20,    1,  -17 },   // 0x3E '>'
+  {   798,  13,  25,  16,    2,  -24 },   // 0x3F '?'
+  {   826,  24,  25,  30,    3,  -24 },   // 0x40 '@'
+  {   888,  24,  23,  25,    1,  -22 },   // 0x41 'A'
+  {   932,  20,  23,  22,    1,  -22 },   // 0x42 'B'
+  {   974,  22,  24,  23,    1,  -23 },   // 0x43 'C'
+  {  1016,  23,  23,  25,    1,  -22 },   // 0x44 'D'
+  {  1060,  20,  23,  21,    2,  -22 },   // 0x45 'E'
+  {  1100,  17,  23,  20,    2,  -22 },   // 0x46 'F'
+  {  1132,  23,  24,  25,    1,  -23 },   // 0x47 'G'
+  {  1176,  22,  23,  25,    2,  -22 },   // 0x48 'H'
+  {  1221,   9,  23,  11,    2,  -22 },   // 0x49 'I'
+  {  1244,  12,  23,  13,    0,  -22 },   // 0x4A 'J'
+  {  1270,  23,  23,  25,    2,  -22 },   // 0x4B 'K'
+  {  1315,  19,  23,  21,    2,  -22 },   // 0x4C 'L'
+  {  1351,  29,  23,  31,    1,  -22 },   // 0x4D 'M'
+  {  1429,  23,  23,  25,    1,  -22 },   // 0x4E 'N'
+  {  1487,  23,  24,  25,    1,  -23 },   // 0x4F 'O'
+  {  1529,  18,  23,  20,    1,  -22 },   // 0x50 'P'
+  {  1563,  23,  30,  25,    1,  -23 },   // 0x51 'Q'
+  {  1616,  21,  23,  23,    2,  -22 },   // 0x52 'R'
+  {  1658,  16,  24,  19,    1,  -23 },   // 0x53 'S'
+  {  1693,  20,  23,  21,    1,  -22 },   // 0x54 'T'
+  {  1728,  22,  23,  25,    2,  -22 },   // 0x55 'U'
+  {  1773,  24,  23,  25,    0,  -22 },   // 0x56 'V'
+  {  1818,  33,  23,  33,    0,  -22 },   // 0x57 'W'
+  {  1891,  25,  23,  25,    0,  -22 },   // 0x58 'X'
+  {  1938,  24,  23,  25,    1,  -22 },   // 0x59 'Y'
+  {  1979,  21,  23,  21,    0,  -22 },   // 0x5A 'Z'
+  {  2018,   7,  28,  12,    3,  -22 },   // 0x5B '['
+  {  2045,  10,  24,  10,    0,  -23 },   // 0x5C '\'
+  {  2069,   7,  28,  12,    2,  -22 },   // 0x5D ']'
+  {  2096,  15,  13,  16,    1,  -22 },   // 0x5E '^'
+  {  2120,  18,   2,  17,    0,    3 },   // 0x5F '_'
+  {  2122,   8,   6,   9,    1,  -23 },   // 0x60 '`'
+  {  2128,  13,  16,  15,    2,  -15 },   // 0x61 'a'
+  {  2159,  16,  25,  17,    1,  -24 },   // 0x62 'b'
+  {  2198,  14,  16,  16,    1,  -15 },   // 0x63 'c'
+  {  2220,  16,  25,  17,    1,  -24 },   // 0x64 'd'
+  {  2261,  13,  16,  16,    1,  -15 },   // 0x65 'e'
+  {  2281,  13,  25,  13,    0,  -24 },   // 0x66 'f'
+  {  2308,  16,  24,  16,    1,  -15 },   // 0x67 'g'
+  {  2346,  16,  25,  17,    1,  -24 },   // 0x68 'h'
+  {  2387,   8,  24,  10,    0,  -23 },   // 0x69 'i'
+  {  2408,   9,  32,  12,    0,  -23 },   // 0x6A 'j'
+  {  2439,  17,  25,  18,    1,  -24 },   // 0x6B 'k'
+  {  2478,   8,  25,   9,    0,  -24 },   // 0x6C 'l'
+  {  2502,  26,  16,  27,    1,  -15 },   // 0x6D 'm'
+  {  2550,  16,  16,  17,    1,  -15 },   // 0x6E 'n'
+  {  2582,  16,  16,  17,    1,  -15 },   // 0x6F 'o'
+  {  2606,  16,  24,  17,    1,  -15 },   // 0x70 'p'
+  {  2647,  16,  24,  17,    1,  -15 },   // 0x71 'q'
+  {  2687,  11,  16,  12,    1,  -15 },   // 0x72 'r'
+  {  2706,  10,  16,  13,    1,  -15 },   // 0x73 's'
+  {  2725,   8,  19,  10,    2,  -18 },   // 0x74 't'
+  {  2746,  16,  16,  17,    1,  -15 },   // 0x75 'u'
+  {  2779,  16,  16,  16,    0,  -15 },   // 0x76 'v'
+  {  2807,  24,  16,  24,    0,  -15 },   // 0x77 'w'
+  {  2856,  17,  16,  17,    0,  -15 },   // 0x78 'x'
+  {  2885,  16,  24,  16,    0,  -15 },   // 0x79 'y'
+  {  2922,  14,  16,  15,    0,  -15 },   // 0x7A 'z'
+  {  2943,   8,  30,  17,    3,  -23 },   // 0x7B '{'
+  {  2973,   2,  24,   7,    2,  -23 },   // 0x7C '|'
+  {  2976,   8,  30,  17,    6,  -22 },   // 0x7D '}'
+  {  3007,  16,   4,  17,    1,  -10 } }; // 0x7E '~'
 
 const GFXfont FreeSerif18pt7b PROGMEM = {
   (uint8_t  *)FreeSerif18pt7bBitmaps,
   (GFXglyph *)FreeSerif18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42, 1,
+  NULL, 0, 1 };
 
-// Approx. 4558 bytes
+// Approx. 3685 bytes
@@ -1,462 +1,364 @@
 const uint8_t FreeSerifBold18pt7bBitmaps[] PROGMEM = {
-  0x7B, 0xEF, 0xFF, 0xFF, 0xF7, 0x9E, 0x71, 0xC7, 0x0C, 0x20, 0x82, 0x00,
-  0x00, 0x07, 0x3E, 0xFF, 0xFF, 0xDC, 0x60, 0x37, 0x83, 0xFC, 0x1F, 0xE0,
-  0xFF, 0x07, 0xB8, 0x3D, 0xC0, 0xCC, 0x06, 0x20, 0x31, 0x01, 0x80, 0x03,
-  0x8E, 0x00, 0xC3, 0x80, 0x30, 0xE0, 0x1C, 0x38, 0x07, 0x0E, 0x01, 0xC3,
-  0x87, 0xFF, 0xFD, 0xFF, 0xFF, 0x7F, 0xFF, 0xC1, 0x87, 0x00, 0xE1, 0xC0,
-  0x38, 0x70, 0x0E, 0x1C, 0x03, 0x86, 0x0F, 0xFF, 0xF3, 0xFF, 0xFC, 0xFF,
-  0xFF, 0x07, 0x0E, 0x01, 0xC3, 0x80, 0x70, 0xE0, 0x1C, 0x30, 0x07, 0x0C,
-  0x01, 0x87, 0x00, 0x61, 0xC0, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0xFF,
-  0x03, 0x27, 0x8C, 0x47, 0x38, 0x86, 0x71, 0x0C, 0xF2, 0x09, 0xF4, 0x03,
-  0xF8, 0x03, 0xF8, 0x07, 0xFC, 0x03, 0xFC, 0x03, 0xFE, 0x01, 0xFE, 0x03,
-  0xFC, 0x04, 0xFC, 0x08, 0xFA, 0x10, 0xF4, 0x21, 0xEC, 0x43, 0xD8, 0x8F,
-  0x3D, 0x3C, 0x3F, 0xF0, 0x1F, 0x00, 0x08, 0x00, 0x10, 0x00, 0x03, 0xC0,
-  0x18, 0x01, 0xFE, 0x0F, 0x00, 0x7C, 0xFF, 0xC0, 0x1F, 0x0F, 0x90, 0x07,
-  0xC1, 0x06, 0x00, 0xF0, 0x21, 0x80, 0x3E, 0x04, 0x30, 0x07, 0x81, 0x8C,
-  0x00, 0xF0, 0x21, 0x80, 0x1E, 0x0C, 0x60, 0x03, 0xC1, 0x18, 0x1E, 0x3C,
-  0xE3, 0x0F, 0xE7, 0xF8, 0xC3, 0xE6, 0x3C, 0x18, 0xF8, 0x40, 0x06, 0x3E,
-  0x08, 0x01, 0x87, 0x81, 0x00, 0x31, 0xF0, 0x20, 0x0C, 0x3E, 0x04, 0x01,
-  0x87, 0x81, 0x00, 0x60, 0xF0, 0x60, 0x18, 0x1E, 0x08, 0x03, 0x03, 0xC7,
-  0x00, 0xC0, 0x3F, 0xC0, 0x18, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x7F,
-  0xE0, 0x00, 0x38, 0xF8, 0x00, 0x1E, 0x1F, 0x00, 0x07, 0x83, 0xC0, 0x01,
-  0xF0, 0xF0, 0x00, 0x7C, 0x38, 0x00, 0x1F, 0x9C, 0x00, 0x03, 0xFC, 0x00,
-  0x00, 0xFE, 0x0F, 0xF0, 0x3F, 0x80, 0xF0, 0x1F, 0xF0, 0x18, 0x1C, 0xFE,
-  0x0C, 0x0E, 0x1F, 0xC3, 0x07, 0x87, 0xF1, 0x81, 0xE0, 0xFE, 0x40, 0xF8,
-  0x1F, 0xF0, 0x3F, 0x07, 0xF8, 0x0F, 0xC0, 0xFE, 0x03, 0xF8, 0x1F, 0xC0,
-  0xFE, 0x07, 0xF8, 0x9F, 0xE3, 0xFF, 0xE7, 0xFF, 0x9F, 0xF0, 0xFF, 0xC3,
-  0xF8, 0x0F, 0x80, 0x3C, 0x00, 0x6F, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0xC0, 0xE0, 0x70, 0x70, 0x38, 0x3C, 0x1E, 0x0F,
-  0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x0E, 0x07, 0x03, 0x80, 0xE0,
-  0x70, 0x18, 0x06, 0x01, 0x00, 0x40, 0x10, 0x04, 0x80, 0x30, 0x0C, 0x03,
-  0x00, 0xC0, 0x60, 0x38, 0x1C, 0x07, 0x03, 0x81, 0xC0, 0xF0, 0x78, 0x3C,
-  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xE0, 0x70, 0x38, 0x38, 0x1C, 0x0C,
-  0x0C, 0x06, 0x04, 0x04, 0x04, 0x00, 0x03, 0x00, 0x1E, 0x00, 0x78, 0x1D,
-  0xE6, 0xFB, 0x3D, 0xED, 0xF3, 0xFF, 0x01, 0xC0, 0x7F, 0xF3, 0xED, 0xFF,
-  0x33, 0xD9, 0xE6, 0x07, 0x80, 0x1E, 0x00, 0x30, 0x00, 0x00, 0xE0, 0x00,
-  0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00,
-  0x38, 0x00, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-  0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00,
-  0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x73, 0xEF, 0xFF, 0xFD, 0xF0,
-  0xC2, 0x18, 0xC6, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFD,
-  0xE0, 0x00, 0xE0, 0x3C, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x1C,
-  0x07, 0x00, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x1C,
-  0x07, 0x00, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x1C, 0x07, 0x00, 0xE0, 0x00,
-  0x03, 0xC0, 0x0E, 0x70, 0x1E, 0x78, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3E,
-  0x7C, 0x3E, 0x7C, 0x3E, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F,
-  0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3E, 0x7C, 0x3E,
-  0x7C, 0x3E, 0x3C, 0x3C, 0x3C, 0x3C, 0x1E, 0x78, 0x0E, 0x70, 0x03, 0xC0,
-  0x00, 0xC0, 0x3C, 0x0F, 0xC3, 0xFC, 0x4F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
-  0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
-  0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x1F, 0xEF, 0xFF,
-  0x03, 0xE0, 0x0F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFC, 0x30, 0xFE, 0x60, 0x7E,
-  0x40, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78,
-  0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x01,
-  0x0C, 0x03, 0x1F, 0xFF, 0x1F, 0xFF, 0x3F, 0xFE, 0x7F, 0xFE, 0xFF, 0xFE,
-  0x03, 0xF0, 0x0F, 0xF8, 0x3F, 0xFC, 0x21, 0xFE, 0x40, 0xFE, 0x00, 0x7E,
-  0x00, 0x7E, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xFC, 0x03, 0xFE,
-  0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F,
-  0x00, 0x0E, 0x70, 0x0E, 0xFC, 0x1C, 0xFE, 0x38, 0x7F, 0xE0, 0x3F, 0x80,
-  0x00, 0x38, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x1F, 0x80, 0x5F, 0x00,
-  0xBE, 0x02, 0x7C, 0x08, 0xF8, 0x31, 0xF0, 0x43, 0xE1, 0x07, 0xC4, 0x0F,
-  0x88, 0x1F, 0x20, 0x3E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x0F, 0xFE, 0x1F,
-  0xF8, 0x7F, 0xF0, 0xFF, 0xE1, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x18, 0x00,
-  0x3F, 0x80, 0xFF, 0xC1, 0xFF, 0xC3, 0xFF, 0xC3, 0xFF, 0x80, 0x3F, 0x80,
-  0x0F, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x37, 0x80, 0x4F, 0x81,
-  0x9F, 0xC6, 0x3F, 0xF8, 0x1F, 0x80, 0x00, 0x07, 0x00, 0x7C, 0x01, 0xF0,
-  0x03, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x7E, 0x00,
-  0x7F, 0xF0, 0x7F, 0xFC, 0xFC, 0x7E, 0xFC, 0x7E, 0xFC, 0x3F, 0xFC, 0x3F,
-  0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0x7C, 0x3F, 0x7C, 0x3E, 0x3C, 0x3E,
-  0x3E, 0x3C, 0x1E, 0x78, 0x07, 0xE0, 0x7F, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE,
-  0xFF, 0xFE, 0xFF, 0xFC, 0xC0, 0x1C, 0x80, 0x18, 0x80, 0x38, 0x00, 0x38,
-  0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
-  0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x80,
-  0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0xE0, 0x38, 0x78, 0x70, 0x3C,
-  0xF0, 0x1E, 0xF0, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xFE, 0x3C, 0x7F, 0xB0,
-  0x7F, 0xE0, 0x3F, 0xF0, 0x0F, 0xF8, 0x1F, 0xFC, 0x39, 0xFE, 0x70, 0xFF,
-  0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1E, 0x78, 0x3E,
-  0x7C, 0x7C, 0x3F, 0xF8, 0x0F, 0xE0, 0x07, 0xE0, 0x1E, 0x78, 0x3C, 0x7C,
-  0x7C, 0x3C, 0x7C, 0x3E, 0xFC, 0x3E, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F,
-  0xFC, 0x3F, 0xFC, 0x3F, 0x7E, 0x3F, 0x7E, 0x3F, 0x3F, 0xFE, 0x0F, 0xFE,
-  0x00, 0x7E, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xC0,
-  0x0F, 0x80, 0x3E, 0x00, 0xE0, 0x00, 0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0x00,
-  0x00, 0x07, 0xBF, 0xFF, 0xFF, 0xDE, 0x39, 0xFB, 0xF7, 0xEF, 0xC7, 0x00,
-  0x00, 0x00, 0x01, 0xE7, 0xEF, 0xFF, 0xFF, 0xBF, 0x06, 0x08, 0x30, 0xC2,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0F, 0x80, 0x07, 0xF0,
-  0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F,
-  0xC0, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00,
-  0x3F, 0x80, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0x7C, 0x00, 0x01, 0x80,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x18, 0x00, 0x03,
-  0xE0, 0x00, 0x7F, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00,
-  0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x1F, 0xC0,
-  0x0F, 0xE0, 0x07, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x00, 0xFE, 0x00, 0x1F,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xC7, 0x1F,
-  0xB8, 0x3E, 0xF0, 0xFF, 0xC3, 0xFF, 0x0F, 0xD8, 0x3F, 0x00, 0xF8, 0x07,
-  0xC0, 0x1E, 0x00, 0x60, 0x03, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x70, 0x03, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x01,
-  0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0xC0, 0xF0, 0x0F, 0x00,
-  0x38, 0x1E, 0x00, 0x0C, 0x3C, 0x07, 0x06, 0x38, 0x1F, 0x72, 0x78, 0x3C,
-  0xF3, 0x78, 0x78, 0xE1, 0xF0, 0x70, 0xE1, 0xF0, 0xF0, 0xE1, 0xF0, 0xE0,
-  0xC1, 0xF1, 0xE1, 0xC1, 0xF1, 0xC1, 0xC1, 0xF1, 0xC3, 0x82, 0xF1, 0xC3,
-  0x86, 0x71, 0xC7, 0x8C, 0x79, 0xFB, 0xF8, 0x78, 0xF1, 0xF0, 0x3C, 0x00,
-  0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x78, 0x03, 0xFF,
-  0xE0, 0x00, 0x7F, 0x80, 0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0xFE, 0x00, 0x01, 0xBF, 0x00, 0x01, 0xBF, 0x00, 0x01, 0x1F,
-  0x00, 0x03, 0x1F, 0x80, 0x02, 0x1F, 0x80, 0x06, 0x0F, 0xC0, 0x06, 0x0F,
-  0xC0, 0x04, 0x07, 0xE0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x18, 0x03,
-  0xF0, 0x18, 0x03, 0xF0, 0x30, 0x01, 0xF8, 0x30, 0x01, 0xF8, 0x70, 0x01,
-  0xFC, 0xFE, 0x0F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFE, 0x0F, 0xE1, 0xF8,
-  0x3F, 0x07, 0xC1, 0xF8, 0x3F, 0x0F, 0xC1, 0xF8, 0x7E, 0x0F, 0xC3, 0xF0,
-  0x7E, 0x1F, 0x87, 0xE0, 0xFC, 0x7C, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x01,
-  0xF8, 0xFE, 0x0F, 0xC1, 0xF8, 0x7E, 0x0F, 0xC3, 0xF0, 0x3F, 0x1F, 0x81,
-  0xF8, 0xFC, 0x0F, 0xC7, 0xE0, 0x7E, 0x3F, 0x03, 0xF1, 0xF8, 0x3F, 0x0F,
-  0xC3, 0xF0, 0xFF, 0xFF, 0x1F, 0xFF, 0xC0, 0x00, 0x7E, 0x04, 0x07, 0xFF,
-  0x18, 0x1F, 0x07, 0xF0, 0x7C, 0x03, 0xE1, 0xF0, 0x03, 0xC7, 0xC0, 0x03,
-  0x9F, 0x80, 0x03, 0x3F, 0x00, 0x06, 0x7C, 0x00, 0x05, 0xF8, 0x00, 0x03,
-  0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8,
-  0x00, 0x01, 0xF0, 0x00, 0x23, 0xF0, 0x00, 0xC3, 0xF0, 0x07, 0x03, 0xF0,
-  0x3C, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
-  0x00, 0x7E, 0x1F, 0x80, 0xFC, 0x1F, 0x81, 0xF8, 0x1F, 0x83, 0xF0, 0x1F,
-  0x07, 0xE0, 0x3F, 0x0F, 0xC0, 0x7E, 0x1F, 0x80, 0x7E, 0x3F, 0x00, 0xFC,
-  0x7E, 0x01, 0xF8, 0xFC, 0x03, 0xF1, 0xF8, 0x07, 0xE3, 0xF0, 0x0F, 0xC7,
-  0xE0, 0x1F, 0x8F, 0xC0, 0x3F, 0x1F, 0x80, 0x7C, 0x3F, 0x01, 0xF8, 0x7E,
-  0x03, 0xE0, 0xFC, 0x0F, 0x81, 0xF8, 0x1F, 0x03, 0xF0, 0xFC, 0x0F, 0xFF,
-  0xE0, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x0F, 0xC0, 0x78,
-  0x7E, 0x01, 0xC3, 0xF0, 0x06, 0x1F, 0x80, 0x10, 0xFC, 0x10, 0x87, 0xE0,
-  0x80, 0x3F, 0x0C, 0x01, 0xF8, 0xE0, 0x0F, 0xFF, 0x00, 0x7F, 0xF8, 0x03,
-  0xF1, 0xC0, 0x1F, 0x86, 0x00, 0xFC, 0x10, 0x07, 0xE0, 0x80, 0x3F, 0x00,
-  0x09, 0xF8, 0x00, 0xCF, 0xC0, 0x0C, 0x7E, 0x00, 0x63, 0xF0, 0x0F, 0x1F,
-  0x81, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0xFF, 0xFF, 0xEF, 0xFF, 0xFC,
-  0xFC, 0x0F, 0x9F, 0x80, 0x73, 0xF0, 0x06, 0x7E, 0x00, 0x4F, 0xC1, 0x09,
-  0xF8, 0x20, 0x3F, 0x0C, 0x07, 0xE3, 0x80, 0xFF, 0xF0, 0x1F, 0xFE, 0x03,
-  0xF1, 0xC0, 0x7E, 0x18, 0x0F, 0xC1, 0x01, 0xF8, 0x20, 0x3F, 0x00, 0x07,
-  0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x1F,
-  0xE0, 0x07, 0xFF, 0x00, 0x00, 0x7E, 0x02, 0x01, 0xFF, 0xE3, 0x01, 0xF0,
-  0x3F, 0x81, 0xF0, 0x07, 0xC1, 0xF0, 0x01, 0xE1, 0xF0, 0x00, 0x71, 0xF8,
-  0x00, 0x18, 0xFC, 0x00, 0x0C, 0x7C, 0x00, 0x02, 0x7E, 0x00, 0x00, 0x3F,
-  0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03,
-  0xF0, 0x0F, 0xFF, 0xF8, 0x01, 0xFE, 0x7C, 0x00, 0x7E, 0x3F, 0x00, 0x3F,
-  0x1F, 0x80, 0x1F, 0x87, 0xC0, 0x0F, 0xC1, 0xF0, 0x07, 0xE0, 0xFC, 0x03,
-  0xF0, 0x1F, 0x83, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0x80, 0x00, 0xFF,
-  0xC3, 0xFF, 0x7F, 0x81, 0xFE, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F,
-  0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F,
-  0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3F,
-  0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F,
-  0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x3F,
-  0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x7F, 0x81, 0xFE, 0xFF, 0xC3, 0xFF, 0xFF,
-  0xEF, 0xF0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
-  0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0,
-  0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x1F, 0xE7, 0xFF, 0x07, 0xFF, 0x01, 0xFE,
-  0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-  0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-  0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC,
-  0x70, 0xFC, 0xF8, 0xFC, 0xF8, 0xF8, 0xF0, 0xF8, 0x71, 0xF0, 0x7F, 0xE0,
-  0x1F, 0x80, 0xFF, 0xC3, 0xFF, 0x3F, 0xC0, 0x3E, 0x0F, 0xC0, 0x1C, 0x07,
-  0xE0, 0x18, 0x03, 0xF0, 0x18, 0x01, 0xF8, 0x18, 0x00, 0xFC, 0x18, 0x00,
-  0x7E, 0x18, 0x00, 0x3F, 0x18, 0x00, 0x1F, 0x9C, 0x00, 0x0F, 0xDF, 0x00,
-  0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x01, 0xF9, 0xF8, 0x00, 0xFC, 0xFE,
-  0x00, 0x7E, 0x3F, 0x80, 0x3F, 0x0F, 0xE0, 0x1F, 0x83, 0xF8, 0x0F, 0xC0,
-  0xFC, 0x07, 0xE0, 0x7F, 0x03, 0xF0, 0x1F, 0xC1, 0xF8, 0x07, 0xF1, 0xFE,
-  0x03, 0xFD, 0xFF, 0x8F, 0xFF, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x0F, 0xC0,
-  0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07,
-  0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
-  0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x01, 0x3F,
-  0x00, 0x19, 0xF8, 0x00, 0xCF, 0xC0, 0x0C, 0x7E, 0x00, 0x63, 0xF0, 0x0F,
-  0x1F, 0x81, 0xFB, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0x80, 0x03, 0xFE,
-  0x7F, 0x00, 0x07, 0xF8, 0x7E, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x3F, 0xC1,
-  0x7C, 0x00, 0x5F, 0x82, 0xFC, 0x01, 0xBF, 0x05, 0xF8, 0x02, 0x7E, 0x09,
-  0xF8, 0x0C, 0xFC, 0x13, 0xF0, 0x11, 0xF8, 0x23, 0xE0, 0x23, 0xF0, 0x47,
-  0xE0, 0xC7, 0xE0, 0x87, 0xC1, 0x0F, 0xC1, 0x0F, 0xC6, 0x1F, 0x82, 0x0F,
-  0x88, 0x3F, 0x04, 0x1F, 0xB0, 0x7E, 0x08, 0x3F, 0x60, 0xFC, 0x10, 0x3E,
-  0x81, 0xF8, 0x20, 0x7F, 0x03, 0xF0, 0x40, 0x7C, 0x07, 0xE0, 0x80, 0xF8,
-  0x0F, 0xC1, 0x00, 0xE0, 0x1F, 0x82, 0x01, 0xC0, 0x3F, 0x0E, 0x03, 0x80,
-  0xFF, 0x7F, 0x82, 0x03, 0xFF, 0xFE, 0x00, 0xFE, 0xFE, 0x00, 0x70, 0xFE,
-  0x00, 0x40, 0xFE, 0x00, 0x81, 0xFC, 0x01, 0x03, 0xFC, 0x02, 0x05, 0xFC,
-  0x04, 0x09, 0xFC, 0x08, 0x11, 0xFC, 0x10, 0x23, 0xF8, 0x20, 0x43, 0xF8,
-  0x40, 0x83, 0xF8, 0x81, 0x03, 0xF9, 0x02, 0x03, 0xFA, 0x04, 0x03, 0xF4,
-  0x08, 0x07, 0xF8, 0x10, 0x07, 0xF0, 0x20, 0x07, 0xE0, 0x40, 0x07, 0xC0,
-  0x80, 0x07, 0x81, 0x00, 0x0F, 0x02, 0x00, 0x0E, 0x0E, 0x00, 0x0C, 0x7F,
-  0x00, 0x08, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xF0, 0x7C, 0x01,
-  0xF0, 0x1F, 0x01, 0xF0, 0x07, 0xC1, 0xF0, 0x01, 0xF1, 0xF8, 0x00, 0xFC,
-  0xFC, 0x00, 0x7E, 0x7C, 0x00, 0x1F, 0x7E, 0x00, 0x0F, 0xFF, 0x00, 0x07,
-  0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00,
-  0x7F, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x1F, 0x3E, 0x00, 0x1F, 0x9F, 0x80,
-  0x0F, 0xC7, 0xC0, 0x07, 0xC1, 0xF0, 0x07, 0xC0, 0xFC, 0x07, 0xE0, 0x3F,
-  0x07, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xFC, 0x0F,
-  0xFF, 0xE0, 0xFC, 0x7E, 0x1F, 0x87, 0xE3, 0xF0, 0x7E, 0x7E, 0x0F, 0xCF,
-  0xC1, 0xF9, 0xF8, 0x3F, 0x3F, 0x07, 0xE7, 0xE0, 0xFC, 0xFC, 0x3F, 0x1F,
-  0x8F, 0xC3, 0xFF, 0xF0, 0x7F, 0xF8, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F,
-  0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E,
-  0x00, 0x1F, 0xE0, 0x07, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xF0,
-  0x01, 0xF0, 0x7C, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x07, 0xC1, 0xF0, 0x01,
-  0xF1, 0xF8, 0x00, 0xFC, 0xFC, 0x00, 0x7E, 0x7C, 0x00, 0x1F, 0x7E, 0x00,
-  0x0F, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xE0,
-  0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x1F, 0x3E,
-  0x00, 0x0F, 0x9F, 0x80, 0x0F, 0xC7, 0xC0, 0x07, 0xC1, 0xF0, 0x07, 0xC0,
-  0x78, 0x03, 0xC0, 0x1E, 0x07, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0x00,
-  0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-  0xF8, 0x00, 0x0F, 0xE0, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0xFC, 0x3F,
-  0x01, 0xF8, 0x3F, 0x03, 0xF0, 0x3F, 0x07, 0xE0, 0x7E, 0x0F, 0xC0, 0xFC,
-  0x1F, 0x81, 0xF8, 0x3F, 0x03, 0xF0, 0x7E, 0x07, 0xC0, 0xFC, 0x1F, 0x81,
-  0xF8, 0x7E, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x0F, 0xDF, 0xC0, 0x1F,
-  0x9F, 0x80, 0x3F, 0x1F, 0x80, 0x7E, 0x3F, 0x80, 0xFC, 0x3F, 0x81, 0xF8,
-  0x3F, 0x03, 0xF0, 0x7F, 0x07, 0xE0, 0x7F, 0x1F, 0xE0, 0x7F, 0x7F, 0xE0,
-  0xFF, 0x07, 0xC2, 0x1F, 0xF2, 0x3C, 0x3E, 0x70, 0x0E, 0xF0, 0x06, 0xF0,
-  0x06, 0xF0, 0x02, 0xF8, 0x00, 0xFE, 0x00, 0xFF, 0x80, 0x7F, 0xE0, 0x3F,
-  0xF8, 0x1F, 0xFC, 0x0F, 0xFE, 0x03, 0xFE, 0x00, 0xFF, 0x00, 0x3F, 0x80,
-  0x1F, 0xC0, 0x0F, 0xC0, 0x0F, 0xE0, 0x0E, 0xF0, 0x1E, 0xF8, 0x3C, 0x9F,
-  0xF8, 0x87, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7E, 0x3F, 0x83,
-  0xF0, 0x7C, 0x1F, 0x81, 0xC0, 0xFC, 0x06, 0x07, 0xE0, 0x20, 0x3F, 0x00,
-  0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F,
-  0x80, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x01, 0xF8, 0x00,
-  0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0x80, 0x00, 0xFC,
-  0x00, 0x0F, 0xF0, 0x01, 0xFF, 0xE0, 0xFF, 0xC1, 0xFD, 0xFE, 0x01, 0xC3,
-  0xF0, 0x02, 0x0F, 0xC0, 0x08, 0x3F, 0x00, 0x20, 0xFC, 0x00, 0x83, 0xF0,
-  0x02, 0x0F, 0xC0, 0x08, 0x3F, 0x00, 0x20, 0xFC, 0x00, 0x83, 0xF0, 0x02,
-  0x0F, 0xC0, 0x08, 0x3F, 0x00, 0x20, 0xFC, 0x00, 0x83, 0xF0, 0x02, 0x0F,
-  0xC0, 0x08, 0x3F, 0x00, 0x20, 0xFC, 0x00, 0x83, 0xF0, 0x02, 0x0F, 0xC0,
-  0x18, 0x1F, 0x80, 0x40, 0x7E, 0x03, 0x00, 0xFC, 0x18, 0x01, 0xFF, 0xC0,
-  0x00, 0xFC, 0x00, 0xFF, 0xF0, 0x7F, 0x3F, 0xC0, 0x1E, 0x1F, 0x80, 0x0C,
-  0x1F, 0x80, 0x08, 0x0F, 0xC0, 0x18, 0x0F, 0xC0, 0x18, 0x07, 0xE0, 0x10,
-  0x07, 0xE0, 0x30, 0x07, 0xE0, 0x20, 0x03, 0xF0, 0x60, 0x03, 0xF0, 0x60,
-  0x01, 0xF8, 0x40, 0x01, 0xF8, 0xC0, 0x00, 0xF8, 0x80, 0x00, 0xFC, 0x80,
-  0x00, 0xFD, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00,
-  0x00, 0x0C, 0x00, 0xFF, 0xE7, 0xFF, 0x0F, 0xCF, 0xE0, 0x7F, 0x00, 0xE1,
-  0xF8, 0x0F, 0xC0, 0x30, 0x7E, 0x03, 0xF0, 0x0C, 0x1F, 0x80, 0x7C, 0x02,
-  0x03, 0xE0, 0x1F, 0x81, 0x80, 0xFC, 0x07, 0xE0, 0x60, 0x3F, 0x03, 0xF8,
-  0x10, 0x07, 0xC0, 0xBF, 0x0C, 0x01, 0xF8, 0x2F, 0xC3, 0x00, 0x7E, 0x19,
-  0xF0, 0x80, 0x0F, 0x84, 0x7C, 0x60, 0x03, 0xF3, 0x0F, 0x98, 0x00, 0xFC,
-  0xC3, 0xE4, 0x00, 0x1F, 0x20, 0xFB, 0x00, 0x07, 0xF8, 0x1F, 0xC0, 0x00,
-  0xFC, 0x07, 0xE0, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x3E, 0x00,
-  0x01, 0xE0, 0x0F, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x70,
-  0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0xC0, 0x06, 0x00, 0x00, 0x20, 0x00,
-  0x80, 0x00, 0xFF, 0xF3, 0xFE, 0x7F, 0x80, 0x78, 0x3F, 0x80, 0x70, 0x1F,
-  0xC0, 0x60, 0x0F, 0xC0, 0xC0, 0x0F, 0xE1, 0x80, 0x07, 0xF1, 0x00, 0x03,
-  0xF3, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x00,
-  0x9F, 0x80, 0x01, 0x8F, 0xC0, 0x03, 0x0F, 0xE0, 0x06, 0x07, 0xE0, 0x06,
-  0x07, 0xF0, 0x0C, 0x03, 0xF8, 0x1C, 0x03, 0xF8, 0x3C, 0x03, 0xFC, 0xFF,
-  0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0x7F, 0x80, 0x1E, 0x3F, 0x80, 0x1C, 0x1F,
-  0x80, 0x18, 0x1F, 0xC0, 0x10, 0x0F, 0xC0, 0x30, 0x07, 0xE0, 0x20, 0x07,
-  0xE0, 0x60, 0x03, 0xF0, 0xC0, 0x03, 0xF0, 0x80, 0x01, 0xF9, 0x80, 0x01,
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01,
-  0xFF, 0x80, 0x7F, 0xFF, 0xF3, 0xFF, 0xFF, 0x9F, 0x01, 0xF8, 0xE0, 0x1F,
-  0x86, 0x01, 0xFC, 0x20, 0x0F, 0xC1, 0x00, 0xFC, 0x00, 0x07, 0xE0, 0x00,
-  0x7E, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80,
-  0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xFC, 0x01, 0x0F, 0xC0, 0x18, 0xFC,
-  0x00, 0xC7, 0xE0, 0x06, 0x7E, 0x00, 0x77, 0xF0, 0x07, 0x3F, 0x00, 0xFB,
-  0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
-  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xE0, 0x1E,
-  0x01, 0xC0, 0x38, 0x07, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x1C, 0x03, 0x80,
-  0x70, 0x07, 0x00, 0xE0, 0x1C, 0x01, 0xC0, 0x38, 0x07, 0x00, 0x70, 0x0E,
-  0x01, 0xC0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0x00, 0xE0, 0xFF, 0xFF, 0x0F,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
-  0xFF, 0xFF, 0x03, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0xEE, 0x03,
-  0x9C, 0x07, 0x1C, 0x1C, 0x38, 0x38, 0x38, 0xE0, 0x71, 0xC0, 0x77, 0x00,
-  0xEE, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0xF0,
-  0x78, 0x3C, 0x0E, 0x07, 0x0F, 0xE0, 0x3F, 0xF0, 0x78, 0xF8, 0x78, 0x7C,
-  0x78, 0x7C, 0x38, 0x7C, 0x00, 0x7C, 0x03, 0xFC, 0x1E, 0x7C, 0x7C, 0x7C,
-  0xFC, 0x7C, 0xFC, 0x7C, 0xFC, 0xFC, 0xFF, 0xFD, 0x7F, 0x7F, 0x3C, 0x3C,
-  0xFC, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F,
-  0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0xF8, 0x1F, 0x7F, 0x87, 0xE3,
-  0xF1, 0xF0, 0x7E, 0x7C, 0x0F, 0x9F, 0x03, 0xF7, 0xC0, 0xFD, 0xF0, 0x3F,
-  0x7C, 0x0F, 0xDF, 0x03, 0xF7, 0xC0, 0xFD, 0xF0, 0x3E, 0x7C, 0x1F, 0x1F,
-  0x8F, 0xC6, 0x7F, 0xC1, 0x07, 0xC0, 0x07, 0xC0, 0x7F, 0xC3, 0xC7, 0x9F,
-  0x1E, 0x78, 0x7B, 0xE1, 0xCF, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
-  0x80, 0x3F, 0x00, 0x7C, 0x00, 0xFC, 0x61, 0xFF, 0x03, 0xF0, 0x00, 0x7F,
-  0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0,
-  0x01, 0xF0, 0x00, 0x7C, 0x07, 0x9F, 0x07, 0xF7, 0xC3, 0xE3, 0xF1, 0xF8,
-  0x7C, 0x7C, 0x1F, 0x3F, 0x07, 0xCF, 0xC1, 0xF3, 0xF0, 0x7C, 0xFC, 0x1F,
-  0x3F, 0x07, 0xCF, 0xC1, 0xF1, 0xF0, 0x7C, 0x7E, 0x1F, 0x0F, 0x8F, 0xC1,
-  0xFD, 0xFC, 0x3E, 0x70, 0x0F, 0xC0, 0x7F, 0xC3, 0xC7, 0x1E, 0x1E, 0xF8,
-  0x7B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0xC0, 0x1F,
-  0x03, 0x7E, 0x18, 0xFF, 0xC1, 0xFE, 0x03, 0xF0, 0x0F, 0x83, 0xF8, 0xF3,
-  0xBE, 0xF7, 0xDC, 0xF8, 0x1F, 0x03, 0xE0, 0xFF, 0x1F, 0xE1, 0xF0, 0x3E,
-  0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07,
-  0xC0, 0xF8, 0x1F, 0x07, 0xF8, 0x0F, 0xC0, 0x1F, 0xFF, 0xDF, 0x1F, 0xFF,
-  0x07, 0x8F, 0x83, 0xE7, 0xC1, 0xF3, 0xE0, 0xF9, 0xF0, 0x7C, 0x78, 0x3C,
-  0x1E, 0x3E, 0x03, 0xFC, 0x03, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0xFF,
-  0xF1, 0xFF, 0xFE, 0x7F, 0xFF, 0x8F, 0xFF, 0xF8, 0x01, 0xFC, 0x00, 0x7F,
-  0x00, 0x73, 0xFF, 0xF0, 0x7F, 0xC0, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x00,
-  0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C,
-  0x7C, 0x3E, 0xFF, 0x1F, 0xCF, 0xCF, 0x83, 0xE7, 0xC1, 0xF3, 0xE0, 0xF9,
-  0xF0, 0x7C, 0xF8, 0x3E, 0x7C, 0x1F, 0x3E, 0x0F, 0x9F, 0x07, 0xCF, 0x83,
-  0xE7, 0xC1, 0xF3, 0xE0, 0xF9, 0xF0, 0x7D, 0xFC, 0x7F, 0x39, 0xFB, 0xF7,
-  0xE7, 0x80, 0x00, 0x00, 0xFC, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C,
-  0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x7F, 0x03, 0xC0, 0xFC, 0x1F, 0x83, 0xF0,
-  0x3C, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E,
-  0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07,
-  0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7D, 0xCF, 0xF9, 0xEE, 0x7C, 0xFF, 0x0F,
-  0x80, 0xFC, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00,
-  0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x7F, 0x9F, 0x07, 0x87,
-  0xC1, 0x81, 0xF0, 0xC0, 0x7C, 0x60, 0x1F, 0x30, 0x07, 0xDE, 0x01, 0xFF,
-  0xC0, 0x7F, 0xF0, 0x1F, 0x3E, 0x07, 0xCF, 0xC1, 0xF1, 0xF8, 0x7C, 0x3E,
-  0x1F, 0x07, 0xC7, 0xC1, 0xFB, 0xF9, 0xFF, 0xFC, 0xF9, 0xF3, 0xE7, 0xCF,
-  0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3,
-  0xE7, 0xCF, 0x9F, 0x7F, 0xFC, 0x7C, 0x1F, 0x0F, 0xBF, 0xCF, 0xF1, 0xF8,
-  0xFF, 0x3F, 0x3E, 0x0F, 0x83, 0xE7, 0xC1, 0xF0, 0x7C, 0xF8, 0x3E, 0x0F,
-  0x9F, 0x07, 0xC1, 0xF3, 0xE0, 0xF8, 0x3E, 0x7C, 0x1F, 0x07, 0xCF, 0x83,
-  0xE0, 0xF9, 0xF0, 0x7C, 0x1F, 0x3E, 0x0F, 0x83, 0xE7, 0xC1, 0xF0, 0x7C,
-  0xF8, 0x3E, 0x0F, 0x9F, 0x07, 0xC1, 0xF7, 0xF1, 0xFC, 0x7F, 0xFC, 0x7C,
-  0x3E, 0xFF, 0x1F, 0xCF, 0xCF, 0x83, 0xE7, 0xC1, 0xF3, 0xE0, 0xF9, 0xF0,
-  0x7C, 0xF8, 0x3E, 0x7C, 0x1F, 0x3E, 0x0F, 0x9F, 0x07, 0xCF, 0x83, 0xE7,
-  0xC1, 0xF3, 0xE0, 0xF9, 0xF0, 0x7D, 0xFC, 0x7F, 0x07, 0xF0, 0x0F, 0xFE,
-  0x0F, 0x8F, 0x8F, 0x87, 0xE7, 0xC1, 0xF7, 0xE0, 0xFF, 0xF0, 0x7F, 0xF8,
-  0x3F, 0xFC, 0x1F, 0xFE, 0x0F, 0xFF, 0x07, 0xEF, 0x83, 0xE7, 0xC1, 0xF1,
-  0xF1, 0xF0, 0x7F, 0xF0, 0x0F, 0xE0, 0xFE, 0x7C, 0x07, 0xDF, 0xE0, 0xFE,
-  0x3E, 0x1F, 0x07, 0xE3, 0xE0, 0x7C, 0x7C, 0x0F, 0xCF, 0x81, 0xF9, 0xF0,
-  0x3F, 0x3E, 0x07, 0xE7, 0xC0, 0xFC, 0xF8, 0x1F, 0x9F, 0x03, 0xE3, 0xE0,
-  0xFC, 0x7E, 0x3F, 0x0F, 0xBF, 0xC1, 0xF3, 0xE0, 0x3E, 0x00, 0x07, 0xC0,
-  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x1F, 0xE0,
-  0x00, 0x07, 0xC1, 0x0F, 0xF9, 0x8F, 0xCD, 0xCF, 0xC3, 0xE7, 0xC1, 0xF7,
-  0xE0, 0xFB, 0xF0, 0x7D, 0xF8, 0x3E, 0xFC, 0x1F, 0x7E, 0x0F, 0xBF, 0x07,
-  0xDF, 0x83, 0xE7, 0xE1, 0xF1, 0xF1, 0xF8, 0x7F, 0x7C, 0x1F, 0x3E, 0x00,
-  0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF8,
-  0x01, 0xFE, 0xFC, 0x73, 0xEF, 0xDF, 0xFE, 0xFC, 0xF7, 0xC3, 0xBE, 0x01,
-  0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E,
-  0x01, 0xF0, 0x1F, 0xE0, 0x1E, 0x23, 0xFE, 0x70, 0xEE, 0x06, 0xE0, 0x2F,
-  0x80, 0xFF, 0x07, 0xFC, 0x3F, 0xE0, 0xFF, 0x81, 0xF8, 0x07, 0xC0, 0x7E,
-  0x0E, 0xBF, 0xC8, 0xF8, 0x04, 0x03, 0x01, 0xC0, 0xF0, 0x7C, 0x3F, 0xEF,
-  0xF9, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0,
-  0x7C, 0x5F, 0x37, 0xF8, 0xFE, 0x1E, 0x00, 0xFC, 0x7F, 0x1F, 0x07, 0xC7,
-  0xC1, 0xF1, 0xF0, 0x7C, 0x7C, 0x1F, 0x1F, 0x07, 0xC7, 0xC1, 0xF1, 0xF0,
-  0x7C, 0x7C, 0x1F, 0x1F, 0x07, 0xC7, 0xC1, 0xF1, 0xF0, 0x7C, 0x7C, 0x1F,
-  0x1F, 0x8F, 0xC3, 0xFD, 0xFC, 0x7C, 0x60, 0xFF, 0x9F, 0xBF, 0x83, 0x0F,
-  0x81, 0x87, 0xE0, 0x81, 0xF0, 0x40, 0xF8, 0x40, 0x3E, 0x20, 0x1F, 0x30,
-  0x07, 0xD0, 0x03, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x0E,
-  0x00, 0x07, 0x00, 0x01, 0x00, 0xFF, 0x3F, 0xCF, 0x7E, 0x1F, 0x06, 0x3E,
-  0x0F, 0x06, 0x3E, 0x0F, 0x84, 0x1F, 0x0F, 0x8C, 0x1F, 0x1F, 0x88, 0x0F,
-  0x17, 0xC8, 0x0F, 0x97, 0xD8, 0x0F, 0xB3, 0xD0, 0x07, 0xE3, 0xF0, 0x07,
-  0xE3, 0xE0, 0x03, 0xC1, 0xE0, 0x03, 0xC1, 0xE0, 0x03, 0x81, 0xC0, 0x01,
-  0x80, 0xC0, 0x01, 0x80, 0x80, 0xFF, 0x3F, 0x7E, 0x0C, 0x3E, 0x08, 0x3F,
-  0x18, 0x1F, 0x30, 0x0F, 0xE0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xE0, 0x03,
-  0xF0, 0x05, 0xF8, 0x0C, 0xF8, 0x18, 0xFC, 0x30, 0x7E, 0x70, 0x7E, 0xFC,
-  0xFF, 0xFF, 0x3F, 0x7E, 0x0C, 0x7C, 0x0C, 0x3E, 0x08, 0x3E, 0x08, 0x1E,
-  0x18, 0x1F, 0x10, 0x0F, 0x30, 0x0F, 0xA0, 0x0F, 0xA0, 0x07, 0xE0, 0x07,
-  0xC0, 0x03, 0xC0, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01,
-  0x00, 0x61, 0x00, 0xF2, 0x00, 0xF6, 0x00, 0xFC, 0x00, 0x78, 0x00, 0x7F,
-  0xFD, 0xFF, 0xF7, 0x0F, 0xD0, 0x3E, 0x01, 0xF0, 0x0F, 0xC0, 0x3E, 0x01,
-  0xF0, 0x0F, 0xC0, 0x3E, 0x01, 0xF8, 0x0F, 0xC1, 0x3E, 0x05, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0x01, 0xE0, 0xF8, 0x3E, 0x07, 0x80, 0xF0, 0x1E, 0x03,
-  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0x87,
-  0x80, 0x1E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
-  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x0F, 0x80, 0x78, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xF0, 0x0F, 0x80, 0xF0,
-  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
-  0x01, 0xE0, 0x3C, 0x03, 0xC0, 0x0F, 0x0F, 0x03, 0xC0, 0x78, 0x0F, 0x01,
-  0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x03, 0xE0,
-  0xF8, 0x3C, 0x00, 0x3E, 0x00, 0x7F, 0xC6, 0xFF, 0xFF, 0x61, 0xFE, 0x00,
-  0x7C };
+  0x14, 0x15, 0x1F, 0x91, 0x42, 0x42, 0x33, 0x33, 0x34, 0x24, 0x15, 0x15,
+  0x1F, 0x73, 0x25, 0x1F, 0x31, 0x32, 0x12, 0x72, 0x14, 0x58, 0x58, 0x58,
+  0x54, 0x13, 0x54, 0x13, 0x62, 0x22, 0x72, 0x31, 0x72, 0x31, 0x72, 0x10,
+  0x63, 0x33, 0x92, 0x43, 0x92, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43,
+  0x4F, 0x21, 0xF2, 0x1F, 0x25, 0x24, 0x38, 0x34, 0x38, 0x34, 0x38, 0x34,
+  0x38, 0x34, 0x25, 0xF1, 0x2F, 0x12, 0xF1, 0x53, 0x43, 0x83, 0x43, 0x83,
+  0x43, 0x83, 0x42, 0x93, 0x42, 0x92, 0x43, 0x92, 0x43, 0x60, 0x61, 0xE1,
+  0xE1, 0xB8, 0x62, 0x21, 0x24, 0x32, 0x31, 0x33, 0x23, 0x31, 0x42, 0x23,
+  0x31, 0x42, 0x24, 0x21, 0x51, 0x25, 0x11, 0x87, 0x97, 0x89, 0x88, 0x89,
+  0x88, 0x78, 0x71, 0x26, 0x61, 0x35, 0x11, 0x41, 0x44, 0x11, 0x41, 0x44,
+  0x12, 0x31, 0x44, 0x12, 0x31, 0x34, 0x24, 0x11, 0x24, 0x4A, 0x75, 0xC1,
+  0xE1, 0x80, 0x64, 0x92, 0xA8, 0x54, 0x95, 0x2A, 0x95, 0x45, 0x21, 0x95,
+  0x51, 0x52, 0x94, 0x61, 0x42, 0x95, 0x61, 0x42, 0x94, 0x62, 0x32, 0xA4,
+  0x61, 0x42, 0xA4, 0x52, 0x32, 0xB4, 0x51, 0x32, 0x64, 0x34, 0x23, 0x32,
+  0x47, 0x28, 0x32, 0x45, 0x22, 0x34, 0x52, 0x35, 0x41, 0xB2, 0x35, 0x51,
+  0xA2, 0x44, 0x61, 0xA2, 0x35, 0x61, 0x92, 0x45, 0x61, 0x92, 0x44, 0x61,
+  0x92, 0x54, 0x52, 0x82, 0x64, 0x51, 0x92, 0x64, 0x33, 0x82, 0x88, 0x92,
+  0x95, 0x50, 0x96, 0xF3, 0xAF, 0x03, 0x35, 0xE4, 0x45, 0xD4, 0x54, 0xD5,
+  0x44, 0xD5, 0x43, 0xE6, 0x23, 0xF1, 0x8F, 0x37, 0x58, 0x67, 0x74, 0x79,
+  0x72, 0x63, 0x27, 0x52, 0x63, 0x47, 0x42, 0x54, 0x47, 0x32, 0x64, 0x57,
+  0x21, 0x65, 0x69, 0x66, 0x58, 0x76, 0x67, 0x77, 0x67, 0x67, 0x68, 0x31,
+  0x28, 0x3D, 0x2C, 0x29, 0x4A, 0x47, 0x75, 0x94, 0x40, 0x12, 0x1F, 0x51,
+  0x22, 0x22, 0x22, 0x21, 0x81, 0x62, 0x62, 0x62, 0x62, 0x72, 0x63, 0x63,
+  0x53, 0x63, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x63,
+  0x63, 0x63, 0x73, 0x63, 0x72, 0x82, 0x81, 0x91, 0x91, 0x91, 0x01, 0x92,
+  0x82, 0x82, 0x82, 0x72, 0x73, 0x63, 0x73, 0x63, 0x63, 0x64, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x53, 0x63, 0x63, 0x53, 0x63, 0x62, 0x62,
+  0x72, 0x61, 0x71, 0x71, 0x80, 0x62, 0xB4, 0xA4, 0x63, 0x14, 0x22, 0x15,
+  0x12, 0x24, 0x14, 0x12, 0x15, 0x2A, 0x73, 0x7B, 0x25, 0x12, 0x19, 0x22,
+  0x24, 0x12, 0x24, 0x22, 0x64, 0xA4, 0xB2, 0x60, 0x83, 0xF1, 0x3F, 0x13,
+  0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x38, 0xFF, 0xFC, 0x83, 0xF1,
+  0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x38, 0x13, 0x25,
+  0x1F, 0x31, 0x54, 0x24, 0x14, 0x23, 0x23, 0x23, 0x24, 0x0F, 0xF2, 0x14,
+  0x1F, 0x91, 0x41, 0x83, 0x74, 0x73, 0x83, 0x83, 0x73, 0x83, 0x83, 0x73,
+  0x83, 0x83, 0x73, 0x83, 0x83, 0x73, 0x83, 0x83, 0x73, 0x83, 0x83, 0x73,
+  0x83, 0x83, 0x73, 0x83, 0x80, 0x64, 0xA3, 0x23, 0x74, 0x24, 0x54, 0x44,
+  0x44, 0x44, 0x35, 0x45, 0x25, 0x45, 0x25, 0x45, 0x16, 0x4C, 0x4C, 0x4C,
+  0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x45, 0x25, 0x45, 0x25, 0x45, 0x34, 0x44,
+  0x44, 0x44, 0x54, 0x24, 0x73, 0x23, 0xA4, 0x60, 0x82, 0x84, 0x66, 0x48,
+  0x31, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x58, 0x1C, 0x65, 0x99, 0x6B,
+  0x4C, 0x42, 0x47, 0x22, 0x66, 0x21, 0x85, 0xB5, 0xB5, 0xB4, 0xC4, 0xB4,
+  0xC3, 0xC3, 0xD2, 0xD2, 0xD2, 0xD2, 0x81, 0x42, 0x82, 0x3D, 0x3D, 0x2D,
+  0x2E, 0x1F, 0x01, 0x66, 0x89, 0x5C, 0x41, 0x48, 0x21, 0x67, 0xA6, 0xA6,
+  0xA5, 0xB4, 0xB4, 0xB7, 0x89, 0xA6, 0xB6, 0xB5, 0xC4, 0xC4, 0xC4, 0xC3,
+  0x23, 0x83, 0x16, 0x53, 0x27, 0x33, 0x4A, 0x77, 0x70, 0xA3, 0xB4, 0xA5,
+  0xA5, 0x96, 0x81, 0x15, 0x81, 0x15, 0x71, 0x25, 0x61, 0x35, 0x52, 0x35,
+  0x51, 0x45, 0x41, 0x55, 0x31, 0x65, 0x31, 0x65, 0x21, 0x75, 0x2F, 0xFF,
+  0xF0, 0x85, 0xA5, 0xA5, 0xA5, 0xA5, 0x20, 0x4B, 0x4A, 0x4B, 0x4B, 0x42,
+  0xD2, 0xC2, 0xD2, 0xD7, 0x7A, 0x5B, 0x4C, 0x4B, 0x97, 0xB4, 0xC3, 0xC3,
+  0xD2, 0xD2, 0x14, 0x81, 0x25, 0x62, 0x27, 0x32, 0x3B, 0x66, 0x70, 0xD3,
+  0x95, 0x95, 0xA4, 0xA5, 0xA5, 0xB5, 0xA5, 0xA6, 0xAB, 0x5D, 0x26, 0x36,
+  0x16, 0x36, 0x16, 0x4C, 0x4C, 0x4C, 0x4C, 0x46, 0x15, 0x46, 0x15, 0x45,
+  0x34, 0x45, 0x35, 0x34, 0x54, 0x24, 0x86, 0x50, 0x1F, 0x01, 0xE2, 0xE1,
+  0xF0, 0x1E, 0x22, 0x93, 0x21, 0xA2, 0x31, 0x93, 0xD3, 0xC3, 0xD3, 0xD3,
+  0xC3, 0xD3, 0xD3, 0xC3, 0xD3, 0xD3, 0xC3, 0xD3, 0xC4, 0xC3, 0xD3, 0xC4,
+  0x80, 0x47, 0x73, 0x44, 0x43, 0x64, 0x24, 0x74, 0x14, 0x74, 0x15, 0x64,
+  0x15, 0x64, 0x17, 0x34, 0x38, 0x12, 0x5A, 0x7A, 0x89, 0x6B, 0x43, 0x28,
+  0x23, 0x4C, 0x6A, 0x6A, 0x79, 0x79, 0x74, 0x24, 0x55, 0x25, 0x35, 0x4B,
+  0x77, 0x50, 0x56, 0x84, 0x24, 0x54, 0x35, 0x35, 0x44, 0x35, 0x45, 0x16,
+  0x45, 0x16, 0x4C, 0x4C, 0x4C, 0x4C, 0x46, 0x16, 0x36, 0x16, 0x36, 0x2D,
+  0x5B, 0xA6, 0xA5, 0xA5, 0xB5, 0xA5, 0xA4, 0xA5, 0x95, 0x93, 0xD0, 0x14,
+  0x1F, 0x91, 0x4F, 0xB4, 0x1F, 0x91, 0x41, 0x23, 0x26, 0x16, 0x16, 0x16,
+  0x33, 0xFF, 0x14, 0x26, 0x1F, 0x61, 0x65, 0x25, 0x15, 0x24, 0x24, 0x14,
+  0x25, 0xFF, 0x62, 0xE5, 0xC7, 0xA8, 0x98, 0x97, 0xA7, 0xA7, 0xA7, 0xC7,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE8, 0xD7, 0xE5, 0xF2, 0x2F, 0x40, 0x0F, 0xFF,
+  0xCF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xC0, 0xF4, 0x2F, 0x25, 0xE7, 0xD8,
+  0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xC7, 0xA7, 0xA7, 0xA7, 0x98, 0x98, 0xA7,
+  0xC5, 0xE2, 0xFF, 0x60, 0x46, 0x6A, 0x33, 0x36, 0x13, 0x55, 0x14, 0x4A,
+  0x4A, 0x46, 0x12, 0x56, 0x85, 0x85, 0x94, 0xA2, 0xB2, 0xC1, 0xD1, 0xD1,
+  0xFF, 0xA3, 0xA5, 0x86, 0x86, 0x86, 0xA3, 0x60, 0x97, 0xF0, 0xCA, 0x56,
+  0x48, 0x4A, 0x36, 0x4D, 0x24, 0x47, 0x35, 0x23, 0x36, 0x51, 0x32, 0x12,
+  0x45, 0x42, 0x42, 0x21, 0x44, 0x43, 0x34, 0x55, 0x34, 0x34, 0x54, 0x44,
+  0x34, 0x54, 0x35, 0x25, 0x53, 0x44, 0x35, 0x53, 0x35, 0x35, 0x53, 0x34,
+  0x35, 0x11, 0x43, 0x34, 0x34, 0x22, 0x33, 0x33, 0x43, 0x23, 0x42, 0x61,
+  0x74, 0x43, 0x43, 0x56, 0x4F, 0x64, 0xF6, 0x4F, 0x65, 0x74, 0x9D, 0xE8,
+  0x70, 0xB1, 0xF7, 0x3F, 0x63, 0xF5, 0x4F, 0x55, 0xF4, 0x5F, 0x37, 0xF2,
+  0x7F, 0x12, 0x16, 0xF0, 0x21, 0x6F, 0x01, 0x35, 0xE2, 0x36, 0xD1, 0x46,
+  0xC2, 0x56, 0xB2, 0x56, 0xB1, 0x76, 0x9F, 0x09, 0xF0, 0x82, 0x96, 0x72,
+  0x96, 0x62, 0xB6, 0x52, 0xB6, 0x43, 0xB7, 0x27, 0x5C, 0x0F, 0x06, 0xF3,
+  0x57, 0x46, 0x56, 0x55, 0x56, 0x56, 0x46, 0x56, 0x46, 0x56, 0x46, 0x56,
+  0x46, 0x46, 0x56, 0x35, 0x7B, 0xAE, 0x76, 0x37, 0x56, 0x56, 0x46, 0x56,
+  0x46, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x56,
+  0x46, 0x46, 0x4F, 0x13, 0xF0, 0x60, 0x96, 0x61, 0x7B, 0x32, 0x65, 0x57,
+  0x55, 0x85, 0x45, 0xA4, 0x35, 0xC3, 0x26, 0xD2, 0x26, 0xD2, 0x25, 0xF0,
+  0x11, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26,
+  0xF3, 0x6F, 0x26, 0xF3, 0x5E, 0x13, 0x6C, 0x24, 0x69, 0x36, 0x66, 0x49,
+  0xCD, 0x87, 0x0F, 0x0A, 0xF0, 0x96, 0x46, 0x76, 0x56, 0x66, 0x66, 0x56,
+  0x75, 0x56, 0x76, 0x46, 0x76, 0x46, 0x86, 0x36, 0x86, 0x36, 0x86, 0x36,
+  0x86, 0x36, 0x86, 0x36, 0x86, 0x36, 0x86, 0x36, 0x86, 0x36, 0x85, 0x46,
+  0x76, 0x46, 0x75, 0x56, 0x65, 0x66, 0x65, 0x66, 0x46, 0x6F, 0x06, 0xF0,
+  0x80, 0x0F, 0x43, 0xF3, 0x46, 0x74, 0x46, 0x83, 0x46, 0x92, 0x46, 0xA1,
+  0x46, 0x51, 0x41, 0x46, 0x51, 0x96, 0x42, 0x96, 0x33, 0x9C, 0x9C, 0x96,
+  0x33, 0x96, 0x42, 0x96, 0x51, 0x96, 0x51, 0x96, 0xC1, 0x26, 0xB2, 0x26,
+  0xA2, 0x36, 0xA2, 0x36, 0x84, 0x36, 0x66, 0x1F, 0x51, 0xF4, 0x20, 0x0F,
+  0x41, 0xF3, 0x26, 0x65, 0x26, 0x83, 0x26, 0x92, 0x26, 0xA1, 0x26, 0x51,
+  0x41, 0x26, 0x51, 0x76, 0x42, 0x76, 0x33, 0x7C, 0x7C, 0x76, 0x33, 0x76,
+  0x42, 0x76, 0x51, 0x76, 0x51, 0x76, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xC8,
+  0xAB, 0x80, 0x96, 0x71, 0x8C, 0x32, 0x75, 0x67, 0x65, 0x95, 0x55, 0xB4,
+  0x45, 0xD3, 0x36, 0xE2, 0x36, 0xE2, 0x35, 0xF1, 0x12, 0x6F, 0x46, 0xF4,
+  0x6F, 0x46, 0xF4, 0x6F, 0x46, 0x8F, 0x2A, 0x82, 0x5B, 0x63, 0x6A, 0x63,
+  0x6A, 0x64, 0x5A, 0x65, 0x59, 0x65, 0x68, 0x67, 0x65, 0x69, 0xEE, 0x88,
+  0x0A, 0x4A, 0x18, 0x68, 0x36, 0x86, 0x46, 0x86, 0x46, 0x86, 0x46, 0x86,
+  0x46, 0x86, 0x46, 0x86, 0x46, 0x86, 0x46, 0x86, 0x4F, 0x54, 0xF5, 0x46,
+  0x86, 0x46, 0x86, 0x46, 0x86, 0x46, 0x86, 0x46, 0x86, 0x46, 0x86, 0x46,
+  0x86, 0x46, 0x86, 0x46, 0x86, 0x46, 0x86, 0x38, 0x68, 0x1A, 0x4A, 0x0B,
+  0x18, 0x46, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+  0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x48, 0x2B, 0x5B,
+  0x78, 0x96, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+  0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0x33, 0x46, 0x25, 0x36, 0x25,
+  0x35, 0x34, 0x45, 0x43, 0x35, 0x5A, 0x86, 0x70, 0x0A, 0x4A, 0x28, 0x85,
+  0x56, 0x93, 0x76, 0x82, 0x96, 0x72, 0xA6, 0x62, 0xB6, 0x52, 0xC6, 0x42,
+  0xD6, 0x32, 0xE6, 0x23, 0xE6, 0x15, 0xDD, 0xCE, 0xB6, 0x26, 0xB6, 0x27,
+  0xA6, 0x37, 0x96, 0x47, 0x86, 0x57, 0x76, 0x66, 0x76, 0x67, 0x66, 0x77,
+  0x56, 0x87, 0x38, 0x78, 0x1A, 0x3C, 0x0B, 0xB8, 0xE6, 0xF0, 0x6F, 0x06,
+  0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06,
+  0xF0, 0x6F, 0x06, 0xF0, 0x6C, 0x12, 0x6B, 0x22, 0x6B, 0x22, 0x6A, 0x23,
+  0x6A, 0x23, 0x68, 0x43, 0x66, 0x61, 0xF5, 0x1F, 0x51, 0x09, 0xD9, 0x27,
+  0xD8, 0x46, 0xD7, 0x57, 0xB8, 0x51, 0x15, 0xB1, 0x16, 0x51, 0x16, 0x92,
+  0x16, 0x51, 0x16, 0x91, 0x26, 0x51, 0x26, 0x72, 0x26, 0x51, 0x26, 0x71,
+  0x36, 0x51, 0x35, 0x71, 0x36, 0x51, 0x36, 0x52, 0x36, 0x51, 0x45, 0x51,
+  0x46, 0x51, 0x46, 0x32, 0x46, 0x51, 0x55, 0x31, 0x56, 0x51, 0x56, 0x12,
+  0x56, 0x51, 0x56, 0x12, 0x56, 0x51, 0x65, 0x11, 0x66, 0x51, 0x67, 0x66,
+  0x51, 0x75, 0x76, 0x51, 0x75, 0x76, 0x51, 0x83, 0x86, 0x51, 0x83, 0x86,
+  0x43, 0x73, 0x78, 0x18, 0x51, 0x7A, 0x07, 0x97, 0x17, 0xA3, 0x47, 0xA1,
+  0x67, 0x91, 0x67, 0x91, 0x68, 0x81, 0x61, 0x17, 0x71, 0x61, 0x27, 0x61,
+  0x61, 0x37, 0x51, 0x61, 0x37, 0x51, 0x61, 0x47, 0x41, 0x61, 0x57, 0x31,
+  0x61, 0x67, 0x21, 0x61, 0x77, 0x11, 0x61, 0x86, 0x11, 0x61, 0x88, 0x61,
+  0x97, 0x61, 0xA6, 0x61, 0xB5, 0x61, 0xC4, 0x61, 0xC4, 0x61, 0xD3, 0x53,
+  0xD2, 0x37, 0xC1, 0x30, 0x97, 0xF0, 0xDB, 0x55, 0x59, 0x57, 0x57, 0x59,
+  0x55, 0x5B, 0x53, 0x6B, 0x62, 0x6B, 0x62, 0x5D, 0x51, 0x6D, 0xCD, 0xCD,
+  0xCD, 0xCD, 0xCD, 0xCD, 0x61, 0x5D, 0x52, 0x5C, 0x62, 0x6B, 0x63, 0x5B,
+  0x55, 0x59, 0x56, 0x67, 0x67, 0x65, 0x5B, 0xDF, 0x07, 0x90, 0x0E, 0x6F,
+  0x05, 0x63, 0x64, 0x64, 0x63, 0x65, 0x62, 0x65, 0x62, 0x65, 0x62, 0x65,
+  0x62, 0x65, 0x62, 0x65, 0x62, 0x64, 0x63, 0x63, 0x64, 0xE5, 0xC7, 0x6D,
+  0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6C, 0x8A, 0xA9, 0x97, 0xF0, 0xDB,
+  0x55, 0x59, 0x57, 0x57, 0x59, 0x55, 0x5B, 0x53, 0x6B, 0x62, 0x6B, 0x62,
+  0x5D, 0x51, 0x6D, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0x61, 0x5D, 0x52,
+  0x5D, 0x52, 0x6B, 0x63, 0x5B, 0x55, 0x59, 0x57, 0x49, 0x49, 0x46, 0x5C,
+  0xBF, 0x17, 0xF3, 0x8F, 0x38, 0xF3, 0x9F, 0x2D, 0xF0, 0x73, 0x0F, 0x09,
+  0xF1, 0x86, 0x46, 0x76, 0x56, 0x66, 0x66, 0x56, 0x66, 0x56, 0x66, 0x56,
+  0x66, 0x56, 0x66, 0x56, 0x65, 0x66, 0x56, 0x66, 0x46, 0x7E, 0x9D, 0xA6,
+  0x17, 0x96, 0x26, 0x96, 0x36, 0x86, 0x37, 0x76, 0x47, 0x66, 0x56, 0x66,
+  0x57, 0x56, 0x67, 0x38, 0x67, 0x1A, 0x58, 0x55, 0x41, 0x49, 0x21, 0x34,
+  0x45, 0x23, 0x83, 0x14, 0x92, 0x14, 0x92, 0x14, 0xA1, 0x15, 0xB7, 0x99,
+  0x8A, 0x7B, 0x6B, 0x6B, 0x79, 0x98, 0xA7, 0xA7, 0xA6, 0xA7, 0x93, 0x14,
+  0x74, 0x15, 0x54, 0x21, 0x2A, 0x31, 0x46, 0x50, 0x0F, 0xFF, 0x13, 0x63,
+  0x75, 0x65, 0x55, 0x66, 0x36, 0x67, 0x26, 0x67, 0x17, 0x6F, 0x06, 0xF0,
+  0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0,
+  0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6E, 0x8B, 0xC5, 0x0A, 0x57, 0x18,
+  0x83, 0x46, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56,
+  0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56,
+  0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56, 0xA1, 0x56,
+  0x92, 0x66, 0x81, 0x76, 0x72, 0x86, 0x52, 0xAB, 0xE6, 0x80, 0x0C, 0x57,
+  0x28, 0x94, 0x46, 0xB2, 0x56, 0xB1, 0x76, 0x92, 0x76, 0x92, 0x86, 0x81,
+  0x96, 0x72, 0x96, 0x71, 0xB6, 0x52, 0xB6, 0x52, 0xC6, 0x41, 0xD6, 0x32,
+  0xE5, 0x31, 0xF0, 0x62, 0x1F, 0x06, 0x12, 0xF1, 0x7F, 0x27, 0xF3, 0x5F,
+  0x45, 0xF5, 0x4F, 0x53, 0xF6, 0x3F, 0x72, 0xA0, 0x0B, 0x2B, 0x46, 0x27,
+  0x67, 0x83, 0x46, 0x76, 0x82, 0x56, 0x76, 0x82, 0x56, 0x85, 0x81, 0x75,
+  0x86, 0x62, 0x76, 0x76, 0x62, 0x76, 0x67, 0x61, 0x95, 0x61, 0x16, 0x42,
+  0x96, 0x51, 0x16, 0x42, 0x96, 0x42, 0x25, 0x41, 0xB5, 0x41, 0x35, 0x32,
+  0xB6, 0x22, 0x45, 0x22, 0xB6, 0x22, 0x45, 0x21, 0xD5, 0x21, 0x55, 0x12,
+  0xD8, 0x67, 0xE6, 0x76, 0xF0, 0x67, 0x6F, 0x06, 0x85, 0xF1, 0x49, 0x4F,
+  0x24, 0x94, 0xF2, 0x3B, 0x3F, 0x32, 0xB2, 0xF4, 0x2B, 0x2F, 0x41, 0xD1,
+  0x90, 0x0C, 0x29, 0x28, 0x84, 0x57, 0x83, 0x77, 0x72, 0x96, 0x62, 0xA7,
+  0x42, 0xC7, 0x31, 0xE6, 0x22, 0xE9, 0xF1, 0x7F, 0x36, 0xF3, 0x7F, 0x36,
+  0xF3, 0x7F, 0x19, 0xF0, 0x12, 0x6E, 0x23, 0x6C, 0x24, 0x7A, 0x26, 0x6A,
+  0x26, 0x78, 0x28, 0x76, 0x38, 0x75, 0x48, 0x82, 0x84, 0xC0, 0x0C, 0x48,
+  0x18, 0xA4, 0x37, 0xA3, 0x56, 0xA2, 0x67, 0x91, 0x86, 0x82, 0x96, 0x71,
+  0xA6, 0x62, 0xB6, 0x42, 0xC6, 0x41, 0xE6, 0x22, 0xE9, 0xF1, 0x8F, 0x17,
+  0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36,
+  0xF2, 0x8F, 0x0A, 0x70, 0x1F, 0x42, 0xF4, 0x25, 0x76, 0x33, 0x86, 0x42,
+  0x87, 0x41, 0x96, 0x51, 0x86, 0xF0, 0x6E, 0x6E, 0x6F, 0x06, 0xE6, 0xE7,
+  0xE6, 0xE6, 0xE7, 0x91, 0x46, 0x92, 0x36, 0xA2, 0x36, 0xA2, 0x26, 0xA3,
+  0x17, 0x93, 0x26, 0x85, 0x1F, 0x51, 0xF5, 0x10, 0x0F, 0x54, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xF1, 0x03,
+  0x84, 0x83, 0x83, 0x84, 0x83, 0x83, 0x83, 0x93, 0x83, 0x83, 0x93, 0x83,
+  0x83, 0x93, 0x83, 0x83, 0x93, 0x83, 0x83, 0x93, 0x83, 0x83, 0x84, 0x83,
+  0x0F, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0xF5, 0x63, 0xB4, 0xB5, 0x96, 0x93, 0x13, 0x73, 0x23, 0x73,
+  0x33, 0x53, 0x43, 0x53, 0x53, 0x33, 0x63, 0x33, 0x73, 0x13, 0x83, 0x13,
+  0x93, 0x0F, 0xFF, 0x90, 0x03, 0x54, 0x54, 0x54, 0x63, 0x63, 0x47, 0x7A,
+  0x54, 0x35, 0x44, 0x45, 0x34, 0x45, 0x43, 0x45, 0xB5, 0x88, 0x54, 0x25,
+  0x35, 0x35, 0x26, 0x35, 0x26, 0x35, 0x26, 0x26, 0x2E, 0x11, 0x17, 0x17,
+  0x24, 0x44, 0x20, 0x06, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+  0x25, 0x65, 0x18, 0x46, 0x36, 0x35, 0x56, 0x25, 0x65, 0x25, 0x66, 0x15,
+  0x66, 0x15, 0x66, 0x15, 0x66, 0x15, 0x66, 0x15, 0x66, 0x15, 0x65, 0x25,
+  0x55, 0x36, 0x36, 0x32, 0x29, 0x51, 0x55, 0x60, 0x55, 0x79, 0x44, 0x34,
+  0x25, 0x34, 0x24, 0x44, 0x15, 0x43, 0x25, 0x95, 0x95, 0x95, 0x95, 0x96,
+  0x95, 0xA6, 0x32, 0x49, 0x66, 0x40, 0x97, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5,
+  0xD5, 0xD5, 0x74, 0x25, 0x57, 0x15, 0x45, 0x36, 0x36, 0x45, 0x35, 0x55,
+  0x26, 0x55, 0x26, 0x55, 0x26, 0x55, 0x26, 0x55, 0x26, 0x55, 0x26, 0x55,
+  0x35, 0x55, 0x36, 0x45, 0x45, 0x36, 0x57, 0x17, 0x45, 0x23, 0x40, 0x46,
+  0x79, 0x44, 0x33, 0x34, 0x44, 0x15, 0x44, 0x1F, 0xF3, 0x95, 0x95, 0x96,
+  0x95, 0x62, 0x16, 0x42, 0x3A, 0x58, 0x76, 0x40, 0x45, 0x57, 0x34, 0x23,
+  0x15, 0x14, 0x15, 0x13, 0x25, 0x65, 0x65, 0x58, 0x38, 0x45, 0x65, 0x65,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x58, 0x30,
+  0x46, 0x9F, 0x01, 0x53, 0xD5, 0x43, 0x55, 0x52, 0x55, 0x52, 0x55, 0x52,
+  0x55, 0x53, 0x45, 0x45, 0x43, 0x57, 0x88, 0x2D, 0x3D, 0x4D, 0xE3, 0xF1,
+  0x2F, 0x13, 0xF2, 0xA7, 0xB7, 0x93, 0x2E, 0x59, 0x50, 0x06, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x35, 0x45, 0x18, 0x37, 0x26, 0x25,
+  0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25,
+  0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x17,
+  0x37, 0x23, 0x26, 0x16, 0x16, 0x24, 0xF8, 0x62, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x51, 0x70, 0x64,
+  0x66, 0x56, 0x56, 0x64, 0xFF, 0x87, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x13,
+  0x29, 0x24, 0x13, 0x25, 0x28, 0x45, 0x40, 0x06, 0xD5, 0xD5, 0xD5, 0xD5,
+  0xD5, 0xD5, 0xD5, 0xD5, 0x38, 0x25, 0x54, 0x45, 0x52, 0x65, 0x42, 0x75,
+  0x32, 0x85, 0x22, 0x95, 0x14, 0x8B, 0x7B, 0x75, 0x25, 0x65, 0x26, 0x55,
+  0x36, 0x45, 0x45, 0x45, 0x55, 0x35, 0x56, 0x17, 0x29, 0x06, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x17, 0x06, 0x35, 0x55,
+  0x45, 0x18, 0x28, 0x36, 0x38, 0x26, 0x25, 0x55, 0x55, 0x25, 0x55, 0x55,
+  0x25, 0x55, 0x55, 0x25, 0x55, 0x55, 0x25, 0x55, 0x55, 0x25, 0x55, 0x55,
+  0x25, 0x55, 0x55, 0x25, 0x55, 0x55, 0x25, 0x55, 0x55, 0x25, 0x55, 0x55,
+  0x25, 0x55, 0x55, 0x25, 0x55, 0x55, 0x17, 0x37, 0x37, 0x06, 0x35, 0x45,
+  0x18, 0x37, 0x26, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25,
+  0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x25,
+  0x55, 0x25, 0x55, 0x17, 0x37, 0x57, 0x8B, 0x55, 0x35, 0x35, 0x46, 0x25,
+  0x55, 0x16, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x56, 0x15, 0x55, 0x25, 0x55,
+  0x35, 0x35, 0x5B, 0x87, 0x50, 0x07, 0x25, 0x75, 0x18, 0x57, 0x35, 0x45,
+  0x56, 0x35, 0x65, 0x35, 0x66, 0x25, 0x66, 0x25, 0x66, 0x25, 0x66, 0x25,
+  0x66, 0x25, 0x66, 0x25, 0x65, 0x35, 0x56, 0x36, 0x36, 0x45, 0x18, 0x55,
+  0x25, 0x75, 0xE5, 0xE5, 0xE5, 0xE5, 0xE6, 0xC8, 0xA0, 0x55, 0x51, 0x49,
+  0x22, 0x36, 0x22, 0x13, 0x26, 0x45, 0x25, 0x55, 0x16, 0x55, 0x16, 0x55,
+  0x16, 0x55, 0x16, 0x55, 0x16, 0x55, 0x16, 0x55, 0x16, 0x55, 0x26, 0x45,
+  0x35, 0x36, 0x47, 0x15, 0x55, 0x25, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xB6,
+  0xA8, 0x06, 0x33, 0x25, 0x16, 0x1C, 0x16, 0x24, 0x15, 0x43, 0x15, 0x85,
+  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x78, 0x50, 0x34, 0x31,
+  0x39, 0x23, 0x43, 0x13, 0x62, 0x13, 0x71, 0x15, 0x78, 0x59, 0x49, 0x59,
+  0x66, 0x85, 0x76, 0x53, 0x11, 0x18, 0x21, 0x35, 0x30, 0x51, 0x82, 0x73,
+  0x64, 0x55, 0x49, 0x19, 0x25, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+  0x55, 0x55, 0x31, 0x15, 0x22, 0x18, 0x37, 0x44, 0x30, 0x06, 0x37, 0x35,
+  0x55, 0x35, 0x55, 0x35, 0x55, 0x35, 0x55, 0x35, 0x55, 0x35, 0x55, 0x35,
+  0x55, 0x35, 0x55, 0x35, 0x55, 0x35, 0x55, 0x35, 0x55, 0x35, 0x55, 0x36,
+  0x36, 0x48, 0x17, 0x35, 0x32, 0x50, 0x09, 0x26, 0x17, 0x52, 0x45, 0x62,
+  0x46, 0x51, 0x65, 0x51, 0x65, 0x41, 0x85, 0x31, 0x85, 0x22, 0x95, 0x11,
+  0xA7, 0xB5, 0xC5, 0xC4, 0xE3, 0xE3, 0xF0, 0x18, 0x08, 0x28, 0x24, 0x16,
+  0x45, 0x52, 0x35, 0x54, 0x52, 0x35, 0x55, 0x41, 0x55, 0x45, 0x32, 0x55,
+  0x36, 0x31, 0x74, 0x31, 0x15, 0x21, 0x75, 0x21, 0x15, 0x12, 0x75, 0x12,
+  0x24, 0x11, 0x96, 0x36, 0x96, 0x35, 0xB4, 0x54, 0xB4, 0x54, 0xB3, 0x63,
+  0xD2, 0x72, 0xD2, 0x71, 0x70, 0x08, 0x26, 0x16, 0x52, 0x45, 0x51, 0x56,
+  0x32, 0x65, 0x22, 0x87, 0x96, 0xB6, 0xB5, 0xB6, 0x91, 0x16, 0x72, 0x25,
+  0x62, 0x36, 0x42, 0x56, 0x23, 0x56, 0x16, 0x28, 0x08, 0x26, 0x16, 0x52,
+  0x35, 0x62, 0x45, 0x51, 0x55, 0x51, 0x64, 0x42, 0x65, 0x31, 0x84, 0x22,
+  0x85, 0x11, 0x95, 0x11, 0xA6, 0xA5, 0xC4, 0xC3, 0xE2, 0xE2, 0xE1, 0xF0,
+  0x19, 0x24, 0x18, 0x42, 0x19, 0x41, 0x29, 0x6B, 0x4B, 0x1D, 0x1D, 0x13,
+  0x46, 0x11, 0x65, 0x85, 0x86, 0x85, 0x85, 0x86, 0x85, 0x86, 0x76, 0x51,
+  0x25, 0x61, 0x16, 0x4F, 0xF1, 0x74, 0x55, 0x55, 0x64, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x64, 0x44, 0xA4, 0x84, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x84,
+  0x0F, 0xFF, 0xFF, 0x00, 0x04, 0x85, 0x74, 0x84, 0x74, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x84, 0xA4, 0x44, 0x64, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x65, 0x55, 0x54, 0x70,
+  0x25, 0xA9, 0x32, 0x1F, 0x11, 0x24, 0x8A, 0x52 };
 
 const GFXglyph FreeSerifBold18pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,   9,    0,    1 },   // 0x20 ' '
   {     0,   6,  24,  12,    3,  -23 },   // 0x21 '!'
   {    18,  13,  10,  19,    3,  -23 },   // 0x22 '"'
-  {    35,  18,  24,  17,    0,  -23 },   // 0x23 '#'
-  {    89,  15,  28,  17,    1,  -25 },   // 0x24 '$'
-  {   142,  27,  24,  35,    4,  -23 },   // 0x25 '%'
-  {   223,  26,  25,  29,    2,  -23 },   // 0x26 '&'
-  {   305,   4,  10,  10,    3,  -23 },   // 0x27 '''
-  {   310,   9,  30,  12,    2,  -23 },   // 0x28 '('
-  {   344,   9,  30,  12,    1,  -23 },   // 0x29 ')'
-  {   378,  14,  15,  18,    2,  -23 },   // 0x2A '*'
-  {   405,  19,  19,  24,    2,  -17 },   // 0x2B '+'
-  {   451,   6,  12,   9,    1,   -5 },   // 0x2C ','
-  {   460,   8,   4,  12,    2,   -9 },   // 0x2D '-'
-  {   464,   6,   6,   9,    1,   -5 },   // 0x2E '.'
-  {   469,  11,  25,  10,   -1,  -23 },   // 0x2F '/'
-  {   504,  16,  24,  18,    1,  -23 },   // 0x30 '0'
-  {   552,  12,  24,  18,    3,  -23 },   // 0x31 '1'
-  {   588,  16,  24,  17,    1,  -23 },   // 0x32 '2'
-  {   636,  16,  24,  18,    0,  -23 },   // 0x33 '3'
-  {   684,  15,  24,  18,    1,  -23 },   // 0x34 '4'
-  {   729,  15,  24,  18,    1,  -23 },   // 0x35 '5'
-  {   774,  16,  24,  18,    1,  -23 },   // 0x36 '6'
-  {   822,  16,  24,  17,    1,  -23 },   // 0x37 '7'
-  {   870,  16,  24,  17,    1,  -23 },   // 0x38 '8'
-  {   918,  16,  24,  18,    1,  -23 },   // 0x39 '9'
-  {   966,   6,  16,  12,    3,  -15 },   // 0x3A ':'
-  {   978,   7,  22,  12,    2,  -15 },   // 0x3B ';'
-  {   998,  19,  20,  24,    2,  -18 },   // 0x3C '<'
-  {  1046,  19,  12,  24,    2,  -14 },   // 0x3D '='
-  {  1075,  19,  20,  24,    3,  -18 },   // 0x3E '>'
-  {  1123,  14,  24,  18,    2,  -23 },   // 0x3F '?'
-  {  1165,  24,  25,  33,    4,  -23 },   // 0x40 '@'
-  {  1240,  24,  24,  25,    1,  -23 },   // 0x41 'A'
-  {  1312,  21,  24,  23,    1,  -23 },   // 0x42 'B'
-  {  1375,  23,  25,  25,    1,  -23 },   // 0x43 'C'
-  {  1447,  23,  24,  26,    1,  -23 },   // 0x44 'D'
-  {  1516,  21,  24,  23,    2,  -23 },   // 0x45 'E'
-  {  1579,  19,  24,  22,    2,  -23 },   // 0x46 'F'
-  {  1636,  25,  25,  27,    1,  -23 },   // 0x47 'G'
-  {  1715,  24,  24,  27,    2,  -23 },   // 0x48 'H'
-  {  1787,  11,  24,  14,    2,  -23 },   // 0x49 'I'
-  {  1820,  16,  27,  18,    0,  -23 },   // 0x4A 'J'
-  {  1874,  25,  24,  27,    2,  -23 },   // 0x4B 'K'
-  {  1949,  21,  24,  23,    2,  -23 },   // 0x4C 'L'
-  {  2012,  31,  24,  33,    1,  -23 },   // 0x4D 'M'
-  {  2105,  23,  24,  25,    1,  -23 },   // 0x4E 'N'
-  {  2174,  25,  25,  27,    1,  -23 },   // 0x4F 'O'
-  {  2253,  19,  24,  22,    2,  -23 },   // 0x50 'P'
-  {  2310,  25,  30,  27,    1,  -23 },   // 0x51 'Q'
-  {  2404,  23,  24,  25,    2,  -23 },   // 0x52 'R'
-  {  2473,  16,  25,  20,    2,  -23 },   // 0x53 'S'
-  {  2523,  21,  24,  23,    1,  -23 },   // 0x54 'T'
-  {  2586,  22,  25,  25,    2,  -23 },   // 0x55 'U'
-  {  2655,  24,  24,  25,    0,  -23 },   // 0x56 'V'
-  {  2727,  34,  25,  34,    0,  -23 },   // 0x57 'W'
-  {  2834,  24,  24,  25,    1,  -23 },   // 0x58 'X'
-  {  2906,  24,  24,  25,    1,  -23 },   // 0x59 'Y'
-  {  2978,  21,  24,  23,    1,  -23 },   // 0x5A 'Z'
-  {  3041,   8,  29,  12,    2,  -23 },   // 0x5B '['
-  {  3070,  11,  25,  10,   -1,  -23 },   // 0x5C '\'
-  {  3105,   8,  29,  12,    2,  -23 },   // 0x5D ']'
-  {  3134,  15,  13,  20,    3,  -23 },   // 0x5E '^'
-  {  3159,  18,   3,  17,    0,    3 },   // 0x5F '_'
-  {  3166,   8,   6,  12,    0,  -23 },   // 0x60 '`'
-  {  3172,  16,  16,  18,    1,  -15 },   // 0x61 'a'
-  {  3204,  18,  24,  19,    1,  -23 },   // 0x62 'b'
-  {  3258,  14,  16,  15,    1,  -15 },   // 0x63 'c'
-  {  3286,  18,  24,  19,    1,  -23 },   // 0x64 'd'
-  {  3340,  14,  16,  16,    1,  -15 },   // 0x65 'e'
-  {  3368,  11,  24,  14,    2,  -23 },   // 0x66 'f'
-  {  3401,  17,  23,  17,    1,  -15 },   // 0x67 'g'
-  {  3450,  17,  24,  19,    1,  -23 },   // 0x68 'h'
-  {  3501,   7,  24,  10,    2,  -23 },   // 0x69 'i'
-  {  3522,  11,  31,  14,    0,  -23 },   // 0x6A 'j'
-  {  3565,  18,  24,  19,    1,  -23 },   // 0x6B 'k'
-  {  3619,   7,  24,  10,    1,  -23 },   // 0x6C 'l'
-  {  3640,  27,  16,  29,    1,  -15 },   // 0x6D 'm'
-  {  3694,  17,  16,  19,    1,  -15 },   // 0x6E 'n'
-  {  3728,  17,  16,  18,    1,  -15 },   // 0x6F 'o'
-  {  3762,  19,  23,  19,    0,  -15 },   // 0x70 'p'
-  {  3817,  17,  23,  19,    1,  -15 },   // 0x71 'q'
-  {  3866,  13,  16,  15,    1,  -15 },   // 0x72 'r'
-  {  3892,  12,  16,  14,    1,  -15 },   // 0x73 's'
-  {  3916,  10,  21,  12,    1,  -20 },   // 0x74 't'
-  {  3943,  18,  16,  20,    1,  -15 },   // 0x75 'u'
-  {  3979,  17,  16,  17,    0,  -15 },   // 0x76 'v'
-  {  4013,  24,  16,  25,    0,  -15 },   // 0x77 'w'
-  {  4061,  16,  16,  18,    1,  -15 },   // 0x78 'x'
-  {  4093,  16,  23,  17,    0,  -15 },   // 0x79 'y'
-  {  4139,  14,  16,  16,    0,  -15 },   // 0x7A 'z'
-  {  4167,  11,  31,  14,    1,  -24 },   // 0x7B '{'
-  {  4210,   3,  25,   8,    2,  -23 },   // 0x7C '|'
-  {  4220,  11,  31,  14,    3,  -24 },   // 0x7D '}'
-  {  4263,  16,   5,  18,    1,  -11 } }; // 0x7E '~'
+  {    36,  18,  24,  17,    0,  -23 },   // 0x23 '#'
+  {    82,  15,  28,  17,    1,  -25 },   // 0x24 '$'
+  {   134,  27,  24,  35,    4,  -23 },   // 0x25 '%'
+  {   206,  26,  25,  29,    2,  -23 },   // 0x26 '&'
+  {   261,   4,  10,  10,    3,  -23 },   // 0x27 '''
+  {   268,   9,  30,  12,    2,  -23 },   // 0x28 '('
+  {   298,   9,  30,  12,    1,  -23 },   // 0x29 ')'
+  {   329,  14,  15,  18,    2,  -23 },   // 0x2A '*'
+  {   356,  19,  19,  24,    2,  -17 },   // 0x2B '+'
+  {   382,   6,  12,   9,    1,   -5 },   // 0x2C ','
+  {   393,   8,   4,  12,    2,   -9 },   // 0x2D '-'
+  {   395,   6,   6,   9,    1,   -5 },   // 0x2E '.'
+  {   399,  11,  25,  10,   -1,  -23 },   // 0x2F '/'
+  {   425,  16,  24,  18,    1,  -23 },   // 0x30 '0'
+  {   464,  12,  24,  18,    3,  -23 },   // 0x31 '1'
+  {   489,  16,  24,  17,    1,  -23 },   // 0x32 '2'
+  {   519,  16,  24,  18,    0,  -23 },   // 0x33 '3'
+  {   549,  15,  24,  18,    1,  -23 },   // 0x34 '4'
+  {   583,  15,  24,  18,    1,  -23 },   // 0x35 '5'
+  {   611,  16,  24,  18,    1,  -23 },   // 0x36 '6'
+  {   644,  16,  24,  17,    1,  -23 },   // 0x37 '7'
+  {   673,  16,  24,  17,    1,  -23 },   // 0x38 '8'
+  {   710,  16,  24,  18,    1,  -23 },   // 0x39 '9'
+  {   743,   6,  16,  12,    3,  -15 },   // 0x3A ':'
+  {   751,   7,  22,  12,    2,  -15 },   // 0x3B ';'
+  {   769,  19,  20,  24,    2,  -18 },   // 0x3C '<'
+  {   790,  19,  12,  24,    2,  -14 },   // 0x3D '='
+  {   799,  19,  20,  24,    3,  -18 },   // 0x3E '>'
+  {   820,  14,  24,  18,    2,  -23 },   // 0x3F '?'
+  {   848,  24,  25,  33,    4,  -23 },   // 0x40 '@'
+  {   913,  24,  24,  25,    1,  -23 },   // 0x41 'A'
+  {   957,  21,  24,  23,    1,  -23 },   // 0x42 'B'
+  {  1002,  23,  25,  25,    1,  -23 },   // 0x43 'C'
+  {  1046,  23,  24,  26,    1,  -23 },   // 0x44 'D'
+  {  1093,  21,  24,  23,    2,  -23 },   // 0x45 'E'
+  {  1139,  19,  24,  22,    2,  -23 },   // 0x46 'F'
+  {  1178,  25,  25,  27,    1,  -23 },   // 0x47 'G'
+  {  1224,  24,  24,  27,    2,  -23 },   // 0x48 'H'
+  {  1271,  11,  24,  14,    2,  -23 },   // 0x49 'I'
+  {  1295,  16,  27,  18,    0,  -23 },   // 0x4A 'J'
+  {  1328,  25,  24,  27,    2,  -23 },   // 0x4B 'K'
+  {  1374,  21,  24,  23,    2,  -23 },   // 0x4C 'L'
+  {  1413,  31,  24,  33,    1,  -23 },   // 0x4D 'M'
+  {  1494,  23,  24,  25,    1,  -23 },   // 0x4E 'N'
+  {  1552,  25,  25,  27,    1,  -23 },   // 0x4F 'O'
+  {  1594,  19,  24,  22,    2,  -23 },   // 0x50 'P'
+  {  1629,  25,  30,  27,    1,  -23 },   // 0x51 'Q'
+  {  1678,  23,  24,  25,    2,  -23 },   // 0x52 'R'
+  {  1723,  16,  25,  20,    2,  -23 },   // 0x53 'S'
+  {  1760,  21,  24,  23,    1,  -23 },   // 0x54 'T'
+  {  1797,  22,  25,  25,    2,  -23 },   // 0x55 'U'
+  {  1846,  24,  24,  25,    0,  -23 },   // 0x56 'V'
+  {  1892,  34,  25,  34,    0,  -23 },   // 0x57 'W'
+  {  1969,  24,  24,  25,    1,  -23 },   // 0x58 'X'
+  {  2014,  24,  24,  25,    1,  -23 },   // 0x59 'Y'
+  {  2056,  21,  24,  23,    1,  -23 },   // 0x5A 'Z'
+  {  2096,   8,  29,  12,    2,  -23 },   // 0x5B '['
+  {  2123,  11,  25,  10,   -1,  -23 },   // 0x5C '\'
+  {  2148,   8,  29,  12,    2,  -23 },   // 0x5D ']'
+  {  2175,  15,  13,  20,    3,  -23 },   // 0x5E '^'
+  {  2197,  18,   3,  17,    0,    3 },   // 0x5F '_'
+  {  2200,   8,   6,  12,    0,  -23 },   // 0x60 '`'
+  {  2206,  16,  16,  18,    1,  -15 },   // 0x61 'a'
+  {  2235,  18,  24,  19,    1,  -23 },   // 0x62 'b'
+  {  2276,  14,  16,  15,    1,  -15 },   // 0x63 'c'
+  {  2298,  18,  24,  19,    1,  -23 },   // 0x64 'd'
+  {  2339,  14,  16,  16,    1,  -15 },   // 0x65 'e'
+  {  2360,  11,  24,  14,    2,  -23 },   // 0x66 'f'
+  {  2388,  17,  23,  17,    1,  -15 },   // 0x67 'g'
+  {  2421,  17,  24,  19,    1,  -23 },   // 0x68 'h'
+  {  2461,   7,  24,  10,    2,  -23 },   // 0x69 'i'
+  {  2483,  11,  31,  14,    0,  -23 },   // 0x6A 'j'
+  {  2515,  18,  24,  19,    1,  -23 },   // 0x6B 'k'
+  {  2553,   7,  24,  10,    1,  -23 },   // 0x6C 'l'
+  {  2577,  27,  16,  29,    1,  -15 },   // 0x6D 'm'
+  {  2625,  17,  16,  19,    1,  -15 },   // 0x6E 'n'
+  {  2657,  17,  16,  18,    1,  -15 },   // 0x6F 'o'
+  {  2681,  19,  23,  19,    0,  -15 },   // 0x70 'p'
+  {  2721,  17,  23,  19,    1,  -15 },   // 0x71 'q'
+  {  2761,  13,  16,  15,    1,  -15 },   // 0x72 'r'
+  {  2782,  12,  16,  14,    1,  -15 },   // 0x73 's'
+  {  2805,  10,  21,  12,    1,  -20 },   // 0x74 't'
+  {  2829,  18,  16,  20,    1,  -15 },   // 0x75 'u'
+  {  2862,  17,  16,  17,    0,  -15 },   // 0x76 'v'
+  {  2888,  24,  16,  25,    0,  -15 },   // 0x77 'w'
+  {  2933,  16,  16,  18,    1,  -15 },   // 0x78 'x'
+  {  2960,  16,  23,  17,    0,  -15 },   // 0x79 'y'
+  {  2997,  14,  16,  16,    0,  -15 },   // 0x7A 'z'
+  {  3017,  11,  31,  14,    1,  -24 },   // 0x7B '{'
+  {  3048,   3,  25,   8,    2,  -23 },   // 0x7C '|'
+  {  3052,  11,  31,  14,    3,  -24 },   // 0x7D '}'
+  {  3084,  16,   5,  18,    1,  -11 } }; // 0x7E '~'
 
 const GFXfont FreeSerifBold18pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold18pt7bBitmaps,
   (GFXglyph *)FreeSerifBold18pt7bGlyphs,
-  0x20, 0x7E, 42 };
+  0x20, 0x7E, 42, 1,
+  NULL, 0, 1 };
 
-// Approx. 4945 bytes
+// Approx. 3764 bytes
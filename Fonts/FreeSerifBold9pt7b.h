@@ -197,6 +197,7 @@ const GFXglyph FreeSerifBold9pt7bGlyphs[] PROGMEM = {
 const GFXfont FreeSerifBold9pt7b PROGMEM = {
   (uint8_t  *)FreeSerifBold9pt7bBitmaps,
   (GFXglyph *)FreeSerifBold9pt7bGlyphs,
-  0x20, 0x7E, 22 };
+  0x20, 0x7E, 22, 1,
+  NULL, 0, 0 };
 
 // Approx. 1834 bytes
@@ -1,737 +1,498 @@
 const uint8_t FreeSerifItalic24pt7bBitmaps[] PROGMEM = {
-  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0xF0, 0x1E, 0x01, 0xE0, 0x1C,
-  0x01, 0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x30, 0x07, 0x00, 0x60,
-  0x06, 0x00, 0x60, 0x04, 0x00, 0x40, 0x0C, 0x00, 0x80, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xF8, 0x0F, 0x80, 0xF8, 0x07, 0x00,
-  0x38, 0x1D, 0xE0, 0x77, 0x83, 0xDC, 0x0E, 0x70, 0x39, 0xC1, 0xEE, 0x07,
-  0x38, 0x1C, 0xC0, 0x63, 0x01, 0x8C, 0x06, 0x20, 0x10, 0x00, 0x06, 0x03,
-  0x00, 0x07, 0x03, 0x80, 0x03, 0x81, 0xC0, 0x03, 0x81, 0xC0, 0x01, 0xC0,
-  0xE0, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x70, 0x00, 0x70, 0x38, 0x00, 0x30,
-  0x18, 0x00, 0x38, 0x1C, 0x03, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0x0E,
-  0x07, 0x00, 0x06, 0x03, 0x00, 0x07, 0x03, 0x80, 0x03, 0x81, 0xC0, 0x03,
-  0x81, 0xC0, 0x01, 0xC0, 0xE0, 0x00, 0xE0, 0x70, 0x1F, 0xFF, 0xFF, 0x8F,
-  0xFF, 0xFF, 0x80, 0x70, 0x38, 0x00, 0x38, 0x1C, 0x00, 0x1C, 0x0C, 0x00,
-  0x1C, 0x0E, 0x00, 0x0E, 0x07, 0x00, 0x0E, 0x07, 0x00, 0x07, 0x03, 0x80,
-  0x03, 0x81, 0xC0, 0x03, 0x81, 0xC0, 0x01, 0xC0, 0xE0, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0xC0, 0x00, 0xFF, 0x80, 0x1C, 0x2F, 0x01,
-  0x83, 0x3C, 0x1C, 0x18, 0xE1, 0xC0, 0xC3, 0x0E, 0x06, 0x18, 0x70, 0x60,
-  0x83, 0x83, 0x04, 0x1E, 0x18, 0x00, 0xF8, 0xC0, 0x03, 0xEC, 0x00, 0x0F,
-  0xE0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xC0,
-  0x00, 0x7F, 0x00, 0x03, 0x7C, 0x00, 0x19, 0xE0, 0x01, 0x87, 0x80, 0x0C,
-  0x3C, 0x00, 0x60, 0xE2, 0x03, 0x07, 0x10, 0x30, 0x39, 0x81, 0x81, 0xCE,
-  0x0C, 0x0C, 0x70, 0x60, 0xE3, 0xC6, 0x06, 0x0F, 0x30, 0x60, 0x1F, 0x9E,
-  0x00, 0x3F, 0x80, 0x00, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x01,
-  0x80, 0x00, 0x01, 0xF0, 0x00, 0xC0, 0x03, 0xFE, 0x01, 0xE0, 0x03, 0xC7,
-  0x83, 0xE0, 0x03, 0xC0, 0x7F, 0x60, 0x03, 0xC0, 0x20, 0x70, 0x01, 0xC0,
-  0x10, 0x30, 0x01, 0xE0, 0x08, 0x38, 0x00, 0xE0, 0x04, 0x18, 0x00, 0xF0,
-  0x02, 0x1C, 0x00, 0x70, 0x02, 0x0C, 0x00, 0x38, 0x01, 0x0E, 0x00, 0x1C,
-  0x01, 0x8E, 0x00, 0x0E, 0x00, 0x86, 0x00, 0x07, 0x00, 0x87, 0x03, 0xE1,
-  0x80, 0xC3, 0x07, 0xFC, 0xE1, 0xC3, 0x87, 0xC6, 0x3F, 0x81, 0x87, 0x81,
-  0x8F, 0x81, 0xC7, 0x80, 0x40, 0x00, 0xC3, 0xC0, 0x20, 0x00, 0xE3, 0xC0,
-  0x10, 0x00, 0x61, 0xC0, 0x08, 0x00, 0x61, 0xE0, 0x04, 0x00, 0x70, 0xF0,
-  0x06, 0x00, 0x30, 0x70, 0x02, 0x00, 0x38, 0x38, 0x03, 0x00, 0x18, 0x1C,
-  0x01, 0x00, 0x1C, 0x0E, 0x01, 0x80, 0x0C, 0x07, 0x01, 0x80, 0x0E, 0x01,
-  0xC3, 0x80, 0x06, 0x00, 0x7F, 0x80, 0x06, 0x00, 0x1F, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x71,
-  0xC0, 0x00, 0x01, 0xC3, 0x80, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x38, 0x38,
-  0x00, 0x01, 0xE0, 0xE0, 0x00, 0x07, 0x87, 0x00, 0x00, 0x1E, 0x18, 0x00,
-  0x00, 0x78, 0xC0, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F,
-  0xC1, 0xFE, 0x03, 0x9F, 0x03, 0xE0, 0x3C, 0x3C, 0x07, 0x01, 0xE0, 0xF8,
-  0x1C, 0x0F, 0x03, 0xE0, 0xE0, 0x7C, 0x07, 0x83, 0x01, 0xE0, 0x1F, 0x1C,
-  0x07, 0x80, 0x7C, 0x60, 0x3E, 0x00, 0xFB, 0x00, 0xF8, 0x03, 0xFC, 0x03,
-  0xE0, 0x07, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7C,
-  0x00, 0xFC, 0x01, 0xF8, 0x0F, 0xF0, 0x03, 0xF0, 0xF3, 0xF0, 0x87, 0xFF,
-  0x07, 0xFC, 0x07, 0xF0, 0x07, 0xC0, 0x39, 0xDE, 0xE7, 0x3B, 0x9C, 0xC6,
-  0x31, 0x00, 0x00, 0x10, 0x01, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
-  0x1C, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x78, 0x03, 0x80, 0x3C,
-  0x01, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0E, 0x00,
-  0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E,
-  0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x01, 0x80, 0x0C, 0x00, 0x60,
-  0x01, 0x00, 0x0C, 0x00, 0x20, 0x00, 0x00, 0x80, 0x06, 0x00, 0x10, 0x00,
-  0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C,
-  0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0,
-  0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xC0, 0x1E, 0x00, 0xF0, 0x07,
-  0x80, 0x38, 0x03, 0xC0, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x60, 0x07, 0x00,
-  0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x10, 0x01, 0x00, 0x00, 0x01, 0x00,
-  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xE1, 0x07, 0xE1, 0x0F,
-  0xF1, 0x1F, 0x19, 0x30, 0x07, 0xC0, 0x03, 0x80, 0x0D, 0x60, 0x79, 0x3C,
-  0xF1, 0x1F, 0xE1, 0x0F, 0xE1, 0x07, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-  0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01,
-  0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C,
-  0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00,
-  0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x7C, 0xF9,
-  0xF1, 0xE1, 0xC3, 0x0C, 0x10, 0xC1, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-  0x77, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0x3C,
-  0x00, 0x01, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00,
-  0xF0, 0x00, 0x07, 0x00, 0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x00,
-  0x01, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x70,
-  0x00, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x01,
-  0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00,
-  0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xE0,
-  0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x03, 0x86,
-  0x00, 0x30, 0x18, 0x03, 0x00, 0xC0, 0x38, 0x03, 0x03, 0x80, 0x18, 0x38,
-  0x00, 0xC1, 0xC0, 0x07, 0x1C, 0x00, 0x38, 0xE0, 0x01, 0xCF, 0x00, 0x0E,
-  0x70, 0x00, 0x77, 0x80, 0x07, 0xBC, 0x00, 0x3D, 0xE0, 0x01, 0xEE, 0x00,
-  0x0F, 0xF0, 0x00, 0x77, 0x80, 0x07, 0xBC, 0x00, 0x3D, 0xC0, 0x01, 0xCE,
-  0x00, 0x1E, 0x70, 0x00, 0xF3, 0x80, 0x07, 0x1C, 0x00, 0x78, 0xE0, 0x03,
-  0x83, 0x00, 0x38, 0x18, 0x03, 0x80, 0xE0, 0x18, 0x03, 0x01, 0x80, 0x0C,
-  0x38, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0xC0, 0x3F, 0xE0,
-  0x01, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1E,
-  0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00,
-  0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00,
-  0x0F, 0x00, 0x07, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xE0,
-  0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3F, 0x01, 0xFF,
-  0xF0, 0x00, 0x3F, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xF8, 0x07, 0x07, 0xE0,
-  0x60, 0x1F, 0x06, 0x00, 0x7C, 0x20, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00,
-  0x78, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x01, 0xE0, 0x00, 0x0E, 0x00,
-  0x00, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70,
-  0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03,
-  0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x01, 0x03, 0x00, 0x08,
-  0x30, 0x00, 0xC3, 0xFF, 0xFC, 0x3F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x00,
-  0x0F, 0xC0, 0x00, 0xFF, 0xC0, 0x06, 0x0F, 0x80, 0x30, 0x1E, 0x01, 0x80,
-  0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x78,
-  0x00, 0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01,
-  0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F,
-  0x80, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80,
-  0x00, 0x1E, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0xC0, 0x70, 0x06, 0x03, 0xF8, 0x70, 0x07, 0xFF, 0x00,
-  0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x70, 0x00, 0x03, 0xC0,
-  0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x37, 0x80, 0x00,
-  0xDC, 0x00, 0x06, 0x70, 0x00, 0x33, 0xC0, 0x01, 0x8F, 0x00, 0x0C, 0x38,
-  0x00, 0x60, 0xE0, 0x03, 0x07, 0x80, 0x18, 0x1E, 0x00, 0xC0, 0x70, 0x06,
-  0x03, 0xC0, 0x30, 0x0F, 0x01, 0x80, 0x38, 0x0C, 0x00, 0xE0, 0x70, 0x07,
-  0x81, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x0F, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00,
-  0x70, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-  0xF0, 0x07, 0xFF, 0x80, 0x10, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x70, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
-  0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C,
-  0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0E, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0C, 0x00, 0x00,
-  0x70, 0x00, 0x01, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80,
-  0x70, 0x0E, 0x03, 0xF0, 0xE0, 0x07, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0x00,
-  0x00, 0x0E, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03,
-  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0,
-  0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF9, 0xF8, 0x01, 0xFF, 0xFC,
-  0x07, 0xE0, 0x7C, 0x0F, 0x80, 0x7C, 0x3E, 0x00, 0x78, 0x78, 0x00, 0x78,
-  0xF0, 0x00, 0xF3, 0xC0, 0x01, 0xE7, 0x80, 0x03, 0xCF, 0x00, 0x07, 0x9C,
-  0x00, 0x0F, 0x38, 0x00, 0x3E, 0x70, 0x00, 0x78, 0xE0, 0x00, 0xF1, 0xC0,
-  0x03, 0xC1, 0x80, 0x07, 0x83, 0x00, 0x1E, 0x03, 0x00, 0x38, 0x06, 0x01,
-  0xE0, 0x03, 0x07, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xFF, 0xF9, 0xFF, 0xFF,
-  0xCF, 0xFF, 0xFC, 0xE0, 0x00, 0xCC, 0x00, 0x0E, 0x40, 0x00, 0x60, 0x00,
-  0x07, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x01, 0x80,
-  0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x07,
-  0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00,
-  0x1C, 0x00, 0x01, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00,
-  0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0x38,
-  0x00, 0x01, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x03, 0x83,
-  0x80, 0x1C, 0x03, 0x00, 0xE0, 0x0E, 0x07, 0x00, 0x1C, 0x1C, 0x00, 0x70,
-  0x70, 0x01, 0xC1, 0xC0, 0x07, 0x07, 0x80, 0x1C, 0x1E, 0x00, 0xE0, 0x3C,
-  0x07, 0x80, 0xFC, 0x38, 0x01, 0xFB, 0xC0, 0x03, 0xF8, 0x00, 0x0F, 0xE0,
-  0x00, 0x7F, 0xC0, 0x07, 0x1F, 0x80, 0x78, 0x3F, 0x03, 0x80, 0x7C, 0x1E,
-  0x00, 0xF8, 0x70, 0x01, 0xE3, 0x80, 0x03, 0xCE, 0x00, 0x07, 0x38, 0x00,
-  0x1C, 0xE0, 0x00, 0x73, 0x80, 0x01, 0xCE, 0x00, 0x06, 0x1C, 0x00, 0x38,
-  0x70, 0x01, 0xC0, 0xE0, 0x0E, 0x01, 0xE0, 0xE0, 0x01, 0xFE, 0x00, 0x00,
-  0x1F, 0x80, 0x03, 0xC3, 0x00, 0x1C, 0x02, 0x00, 0xE0, 0x0C, 0x07, 0x00,
-  0x18, 0x3C, 0x00, 0x60, 0xE0, 0x01, 0xC7, 0x80, 0x07, 0x1E, 0x00, 0x1C,
-  0xF0, 0x00, 0x73, 0xC0, 0x01, 0xCF, 0x00, 0x07, 0x3C, 0x00, 0x3C, 0xF0,
-  0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x1E, 0x1E, 0x00, 0x78, 0x7C, 0x03,
-  0xE0, 0xF8, 0x3F, 0x01, 0xFF, 0xBC, 0x03, 0xF1, 0xE0, 0x00, 0x0F, 0x80,
-  0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
-  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x78, 0x00,
-  0x0F, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x07, 0xC3, 0xE1, 0xF0, 0x70,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x38, 0x3E, 0x1F, 0x0F, 0x83, 0x80, 0x01, 0xC0, 0x7C, 0x0F, 0x81,
-  0xF0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x07, 0x80, 0xF8, 0x1F, 0x01, 0xE0,
-  0x1C, 0x03, 0x00, 0xC0, 0x18, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0C, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0,
-  0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x3F,
-  0xC0, 0x01, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x80,
-  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8,
-  0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F,
-  0xC0, 0x00, 0x0F, 0x80, 0x00, 0x07, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-  0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x00,
-  0x0F, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x07, 0xF0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x3F, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xE0,
-  0x00, 0x7F, 0x80, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x00,
-  0xFF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x80, 0x00, 0x00,
-  0x03, 0xF0, 0x06, 0x1C, 0x0C, 0x0E, 0x1C, 0x06, 0x1C, 0x07, 0x1C, 0x07,
-  0x1C, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x3C,
-  0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00,
-  0x06, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xF8, 0x00,
-  0xF8, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F,
-  0xFF, 0x80, 0x00, 0x3F, 0x01, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x7C,
-  0x00, 0x07, 0x80, 0x7C, 0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x38, 0x3C,
-  0x00, 0x00, 0x0C, 0x3C, 0x00, 0x78, 0x07, 0x1E, 0x00, 0xFE, 0xE1, 0x9E,
-  0x00, 0xF1, 0xF0, 0xEF, 0x00, 0xE0, 0xF0, 0x37, 0x80, 0xE0, 0x38, 0x1F,
-  0x80, 0x70, 0x1C, 0x0F, 0xC0, 0x70, 0x1E, 0x07, 0xE0, 0x38, 0x0F, 0x03,
-  0xF0, 0x18, 0x07, 0x01, 0xF8, 0x1C, 0x03, 0x80, 0xFC, 0x0E, 0x01, 0xC0,
-  0xDE, 0x07, 0x01, 0xE0, 0x6F, 0x03, 0x80, 0xE0, 0x73, 0xC1, 0xC0, 0xF0,
-  0x31, 0xE0, 0xF0, 0xF8, 0x30, 0xF0, 0x38, 0xDC, 0x30, 0x3C, 0x1F, 0xC7,
-  0xF0, 0x0E, 0x07, 0x81, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x01, 0xE0, 0x00,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x03, 0xF0,
-  0x0F, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,
-  0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x03, 0xF0,
-  0x00, 0x00, 0x37, 0x80, 0x00, 0x03, 0x3C, 0x00, 0x00, 0x19, 0xE0, 0x00,
-  0x01, 0x8F, 0x80, 0x00, 0x08, 0x7C, 0x00, 0x00, 0xC3, 0xE0, 0x00, 0x0C,
-  0x0F, 0x00, 0x00, 0x60, 0x78, 0x00, 0x06, 0x03, 0xC0, 0x00, 0x20, 0x1F,
-  0x00, 0x03, 0x00, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00,
-  0x18, 0x00, 0xF0, 0x00, 0xC0, 0x07, 0x80, 0x0C, 0x00, 0x3E, 0x00, 0xE0,
-  0x01, 0xF0, 0x06, 0x00, 0x0F, 0x80, 0x70, 0x00, 0x3C, 0x03, 0x00, 0x01,
-  0xE0, 0x38, 0x00, 0x0F, 0x83, 0xC0, 0x00, 0x7C, 0x3E, 0x00, 0x07, 0xF3,
-  0xFC, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-  0x3E, 0x07, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x3E, 0x01, 0xF0, 0x03, 0xC0,
-  0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0xF0,
-  0x07, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x00, 0xF0,
-  0x3F, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x1F, 0x07, 0xE0,
-  0x01, 0xE0, 0x1F, 0x00, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xC0, 0x3C,
-  0x00, 0x7C, 0x03, 0xC0, 0x07, 0xC0, 0x7C, 0x00, 0x7C, 0x07, 0xC0, 0x07,
-  0xC0, 0x78, 0x00, 0x7C, 0x0F, 0x80, 0x0F, 0x80, 0xF8, 0x00, 0xF8, 0x0F,
-  0x00, 0x1F, 0x00, 0xF0, 0x03, 0xE0, 0x1F, 0x81, 0xFC, 0x03, 0xFF, 0xFF,
-  0x80, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x3F, 0xFF,
-  0xE0, 0x03, 0xF0, 0x1F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0xF0, 0x00, 0x78,
-  0x0F, 0x80, 0x00, 0xE0, 0x3C, 0x00, 0x03, 0x81, 0xF0, 0x00, 0x04, 0x0F,
-  0x80, 0x00, 0x10, 0x7C, 0x00, 0x00, 0x41, 0xF0, 0x00, 0x00, 0x0F, 0x80,
-  0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-  0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03,
-  0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0x01, 0xF0, 0x00, 0x02, 0x07, 0xC0, 0x00, 0x18, 0x0F, 0x80,
-  0x00, 0xC0, 0x3E, 0x00, 0x06, 0x00, 0x7C, 0x00, 0x70, 0x00, 0xFC, 0x07,
-  0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-  0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xC0, 0xFC, 0x00, 0x07, 0xC0,
-  0x1F, 0x00, 0x03, 0xE0, 0x07, 0xC0, 0x01, 0xE0, 0x01, 0xF0, 0x01, 0xF0,
-  0x00, 0x7C, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x0F, 0x00, 0x3C,
-  0x00, 0x07, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x1F, 0x00, 0x01, 0xF0, 0x0F,
-  0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x7C, 0x07, 0xC0, 0x00, 0x3E, 0x03,
-  0xE0, 0x00, 0x1F, 0x01, 0xE0, 0x00, 0x1F, 0x81, 0xF0, 0x00, 0x0F, 0x80,
-  0xF8, 0x00, 0x07, 0xC0, 0x78, 0x00, 0x03, 0xE0, 0x3C, 0x00, 0x03, 0xE0,
-  0x3E, 0x00, 0x01, 0xF0, 0x1F, 0x00, 0x01, 0xF0, 0x0F, 0x00, 0x01, 0xF0,
-  0x0F, 0x80, 0x01, 0xF8, 0x07, 0xC0, 0x01, 0xF0, 0x03, 0xE0, 0x01, 0xF0,
-  0x01, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x0F, 0xE0, 0x01, 0xFF, 0xFF, 0xC0,
-  0x03, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-  0xC0, 0x0F, 0x80, 0x1E, 0x00, 0x7C, 0x00, 0x30, 0x03, 0xE0, 0x01, 0x00,
-  0x1E, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x40, 0x0F, 0x80, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x03, 0xC0, 0x10, 0x00, 0x3E, 0x01, 0x80, 0x01, 0xF0, 0x08,
-  0x00, 0x0F, 0x01, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-  0x3E, 0x07, 0x00, 0x01, 0xE0, 0x18, 0x00, 0x1F, 0x00, 0xC0, 0x00, 0xF8,
-  0x04, 0x00, 0x07, 0x80, 0x20, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x0F, 0x80, 0x00, 0xC0,
-  0x7C, 0x00, 0x0E, 0x03, 0xC0, 0x00, 0xE0, 0x1E, 0x00, 0x0F, 0x01, 0xF8,
-  0x03, 0xF8, 0x1F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-  0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0x80, 0x1E, 0x00, 0x7C, 0x00,
-  0x30, 0x03, 0xE0, 0x01, 0x00, 0x1E, 0x00, 0x08, 0x01, 0xF0, 0x00, 0x40,
-  0x0F, 0x80, 0x02, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x3E,
-  0x00, 0x80, 0x01, 0xF0, 0x0C, 0x00, 0x0F, 0x00, 0xC0, 0x00, 0xF8, 0x0E,
-  0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xE0, 0x18, 0x00,
-  0x1F, 0x00, 0xC0, 0x00, 0xF8, 0x06, 0x00, 0x07, 0xC0, 0x20, 0x00, 0x3C,
-  0x01, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x02, 0x00, 0x1F, 0xFF, 0x8C, 0x00,
-  0xFC, 0x07, 0xF8, 0x03, 0xE0, 0x03, 0xF0, 0x0F, 0x00, 0x03, 0xC0, 0x3C,
-  0x00, 0x03, 0x80, 0xF0, 0x00, 0x07, 0x03, 0xC0, 0x00, 0x0E, 0x0F, 0x80,
-  0x00, 0x08, 0x3E, 0x00, 0x00, 0x10, 0x7C, 0x00, 0x00, 0x01, 0xF0, 0x00,
-  0x00, 0x03, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x3F,
-  0xFF, 0xE0, 0x00, 0x0F, 0xE7, 0xC0, 0x00, 0x0F, 0x0F, 0x80, 0x00, 0x1E,
-  0x1F, 0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x01, 0xE0,
-  0x78, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x0F, 0x01, 0xF0, 0x00, 0x1E, 0x01,
-  0xF0, 0x00, 0x3C, 0x01, 0xE0, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x01,
-  0xF8, 0x0F, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x03,
-  0xFF, 0xE0, 0x7F, 0xF0, 0x07, 0xF8, 0x01, 0xFC, 0x00, 0x3E, 0x00, 0x0F,
-  0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-  0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00,
-  0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0x3E,
-  0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00,
-  0x03, 0xC0, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x01,
-  0xE0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x7C, 0x00,
-  0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F,
-  0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x03, 0xF8, 0x00,
-  0xFE, 0x00, 0xFF, 0xE0, 0x7F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xE0,
-  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x01,
-  0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF0,
-  0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0xF8, 0x00,
-  0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1E,
-  0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1F, 0x00,
-  0x0F, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xF0, 0x00,
-  0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0xF8, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0,
-  0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x78, 0x00,
-  0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00,
-  0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x01, 0xC1, 0xE0, 0x07, 0xC7,
-  0x80, 0x0F, 0x8F, 0x00, 0x1F, 0x3C, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x80,
-  0x00, 0x01, 0xFF, 0xE1, 0xFF, 0x80, 0x3F, 0xC0, 0x1F, 0x80, 0x0F, 0x80,
-  0x0F, 0x00, 0x07, 0xC0, 0x0F, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x01, 0xE0,
-  0x0E, 0x00, 0x01, 0xF0, 0x0E, 0x00, 0x00, 0xF8, 0x0E, 0x00, 0x00, 0x78,
-  0x1C, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x00, 0x3E, 0x3C, 0x00, 0x00, 0x1F,
-  0x38, 0x00, 0x00, 0x0F, 0x38, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x07,
-  0xFE, 0x00, 0x00, 0x03, 0xDF, 0x00, 0x00, 0x01, 0xE7, 0xC0, 0x00, 0x01,
-  0xF3, 0xE0, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00,
-  0x3C, 0x1F, 0x00, 0x00, 0x3E, 0x07, 0xC0, 0x00, 0x1F, 0x03, 0xE0, 0x00,
-  0x0F, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x07, 0xC0, 0x1F, 0x00,
-  0x03, 0xC0, 0x07, 0x80, 0x01, 0xE0, 0x03, 0xE0, 0x01, 0xF0, 0x01, 0xF8,
-  0x01, 0xFC, 0x01, 0xFE, 0x03, 0xFF, 0xC3, 0xFF, 0xE0, 0x03, 0xFF, 0xE0,
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03,
-  0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-  0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00,
-  0x0F, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80,
-  0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01,
-  0xF0, 0x00, 0x08, 0x3C, 0x00, 0x03, 0x0F, 0x80, 0x00, 0x41, 0xF0, 0x00,
-  0x18, 0x3C, 0x00, 0x07, 0x07, 0x80, 0x01, 0xC1, 0xF8, 0x01, 0xF8, 0x7F,
-  0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0x00, 0x00, 0x3F, 0xC0,
-  0x0F, 0xC0, 0x00, 0x1F, 0xC0, 0x01, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0xFC,
-  0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00,
-  0xFF, 0x00, 0x02, 0xF0, 0x00, 0x37, 0x80, 0x01, 0xBC, 0x00, 0x19, 0xE0,
-  0x00, 0x6F, 0x80, 0x0E, 0xF8, 0x00, 0x1B, 0xE0, 0x03, 0x3E, 0x00, 0x04,
-  0x78, 0x01, 0x8F, 0x00, 0x03, 0x1E, 0x00, 0xE7, 0xC0, 0x00, 0xC7, 0x80,
-  0x31, 0xF0, 0x00, 0x21, 0xE0, 0x18, 0x78, 0x00, 0x18, 0x78, 0x0E, 0x1E,
-  0x00, 0x06, 0x1E, 0x03, 0x0F, 0x80, 0x01, 0x87, 0x81, 0x83, 0xE0, 0x00,
-  0x41, 0xF0, 0xE0, 0xF0, 0x00, 0x30, 0x7C, 0x30, 0x3C, 0x00, 0x0C, 0x0F,
-  0x18, 0x1F, 0x00, 0x03, 0x03, 0xCE, 0x07, 0xC0, 0x01, 0x80, 0xF3, 0x01,
-  0xE0, 0x00, 0x60, 0x3D, 0x80, 0xF8, 0x00, 0x18, 0x0F, 0xE0, 0x3E, 0x00,
-  0x0C, 0x03, 0xF0, 0x0F, 0x00, 0x03, 0x00, 0xF8, 0x03, 0xC0, 0x00, 0xC0,
-  0x3E, 0x01, 0xF0, 0x00, 0x70, 0x0F, 0x00, 0x7C, 0x00, 0x1C, 0x01, 0x80,
-  0x3F, 0x00, 0x0F, 0x80, 0x60, 0x1F, 0xC0, 0x0F, 0xF8, 0x10, 0x1F, 0xFE,
-  0x00, 0x03, 0xFC, 0x00, 0x3F, 0xE0, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0xF8,
-  0x00, 0x1C, 0x00, 0x1F, 0x00, 0x03, 0x80, 0x03, 0xF0, 0x00, 0x60, 0x00,
-  0x7E, 0x00, 0x0C, 0x00, 0x0B, 0xE0, 0x03, 0x80, 0x03, 0x7C, 0x00, 0x60,
-  0x00, 0x67, 0x80, 0x0C, 0x00, 0x0C, 0xF8, 0x03, 0x80, 0x03, 0x0F, 0x00,
-  0x70, 0x00, 0x61, 0xF0, 0x0C, 0x00, 0x0C, 0x3E, 0x01, 0x80, 0x01, 0x83,
-  0xC0, 0x70, 0x00, 0x60, 0x7C, 0x0C, 0x00, 0x0C, 0x07, 0x81, 0x80, 0x01,
-  0x80, 0xF8, 0x30, 0x00, 0x60, 0x0F, 0x0E, 0x00, 0x0C, 0x01, 0xE1, 0x80,
-  0x01, 0x80, 0x3E, 0x30, 0x00, 0x30, 0x03, 0xCE, 0x00, 0x0C, 0x00, 0x7D,
-  0x80, 0x01, 0x80, 0x07, 0xB0, 0x00, 0x30, 0x00, 0xF6, 0x00, 0x0E, 0x00,
-  0x1F, 0xC0, 0x01, 0x80, 0x01, 0xF0, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x0E,
-  0x00, 0x03, 0xC0, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x06, 0x00,
-  0x3F, 0xE0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xF0, 0x7C, 0x00, 0x0F, 0x00, 0x78,
-  0x00, 0x78, 0x00, 0xF0, 0x07, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x07, 0x81,
-  0xF0, 0x00, 0x1E, 0x07, 0xC0, 0x00, 0x7C, 0x3E, 0x00, 0x01, 0xF1, 0xF0,
-  0x00, 0x07, 0xC7, 0xC0, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x7C, 0xF8, 0x00,
-  0x01, 0xF7, 0xE0, 0x00, 0x0F, 0xDF, 0x00, 0x00, 0x3F, 0x7C, 0x00, 0x00,
-  0xFB, 0xF0, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x1F, 0xBE, 0x00, 0x00, 0x7C,
-  0xF8, 0x00, 0x03, 0xF3, 0xE0, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x3E, 0x3E,
-  0x00, 0x01, 0xF0, 0xF8, 0x00, 0x0F, 0x81, 0xE0, 0x00, 0x3E, 0x07, 0x80,
-  0x01, 0xF0, 0x1F, 0x00, 0x0F, 0x80, 0x3C, 0x00, 0x7C, 0x00, 0x78, 0x03,
-  0xC0, 0x00, 0xF8, 0x3E, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00,
-  0x00, 0x03, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x0F, 0x81, 0xF8,
-  0x00, 0x7C, 0x03, 0xE0, 0x03, 0xE0, 0x1F, 0x00, 0x1E, 0x00, 0x7C, 0x01,
-  0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0x78, 0x00, 0xF8, 0x03, 0xC0,
-  0x07, 0xC0, 0x3E, 0x00, 0x3C, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x00, 0x3E,
-  0x00, 0xF8, 0x03, 0xF0, 0x07, 0xC0, 0x7E, 0x00, 0x3F, 0xFF, 0xE0, 0x01,
-  0xEF, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0x80,
-  0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x00, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03,
-  0xC0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1F,
-  0xFE, 0x00, 0x00, 0xF0, 0x7C, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x78, 0x00,
-  0xF0, 0x03, 0xC0, 0x03, 0xE0, 0x1E, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x1E,
-  0x07, 0xC0, 0x00, 0x7C, 0x3E, 0x00, 0x01, 0xF1, 0xF8, 0x00, 0x07, 0xC7,
-  0xC0, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x01, 0xF7, 0xE0,
-  0x00, 0x0F, 0xDF, 0x80, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0xFB, 0xF0, 0x00,
-  0x03, 0xEF, 0xC0, 0x00, 0x1F, 0xBE, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x01,
-  0xF3, 0xE0, 0x00, 0x0F, 0x8F, 0x80, 0x00, 0x3E, 0x3E, 0x00, 0x01, 0xF0,
-  0xF8, 0x00, 0x07, 0xC3, 0xE0, 0x00, 0x3E, 0x07, 0x80, 0x01, 0xF0, 0x1F,
-  0x00, 0x07, 0x80, 0x3C, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xE0, 0x01, 0xE0,
-  0x1E, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x04, 0x0F, 0xF0, 0x00,
-  0x60, 0x7F, 0xFC, 0x07, 0x03, 0xFF, 0xFF, 0xF8, 0x38, 0x1F, 0xFF, 0x80,
-  0x00, 0x07, 0xF8, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-  0x3E, 0x0F, 0xC0, 0x03, 0xE0, 0x3E, 0x00, 0x3E, 0x01, 0xF0, 0x03, 0xC0,
-  0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x78, 0x01, 0xF0,
-  0x07, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x7C, 0x00, 0xF0,
-  0x1F, 0x80, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0x1E, 0x1E, 0x00,
-  0x01, 0xE1, 0xE0, 0x00, 0x3E, 0x1F, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x3C,
-  0x0F, 0x00, 0x03, 0xC0, 0xF8, 0x00, 0x7C, 0x07, 0x80, 0x07, 0xC0, 0x7C,
-  0x00, 0x78, 0x03, 0xC0, 0x0F, 0x80, 0x3C, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
-  0x00, 0x1E, 0x00, 0xF0, 0x01, 0xE0, 0x1F, 0x00, 0x1F, 0x03, 0xF8, 0x00,
-  0xF8, 0xFF, 0xE0, 0x0F, 0xE0, 0x00, 0x3F, 0x06, 0x01, 0xFF, 0xDC, 0x07,
-  0xC1, 0xF0, 0x1E, 0x01, 0xE0, 0x3C, 0x01, 0xC0, 0xF0, 0x03, 0x81, 0xE0,
-  0x03, 0x03, 0xC0, 0x04, 0x07, 0x80, 0x08, 0x0F, 0x80, 0x00, 0x1F, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-  0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7C, 0x08, 0x00, 0x78, 0x10,
-  0x00, 0xF0, 0x20, 0x01, 0xE0, 0xC0, 0x03, 0xC1, 0x80, 0x07, 0x83, 0x80,
-  0x1E, 0x07, 0x00, 0x3C, 0x0F, 0x00, 0xF0, 0x1F, 0x87, 0xC0, 0x23, 0xFF,
-  0x00, 0x81, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFD, 0xF0,
-  0x3E, 0x07, 0xB8, 0x07, 0xC0, 0x76, 0x00, 0xF8, 0x04, 0x80, 0x3E, 0x00,
-  0xB0, 0x07, 0xC0, 0x14, 0x00, 0xF8, 0x02, 0x00, 0x1E, 0x00, 0x00, 0x07,
-  0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00,
-  0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03,
-  0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xFF, 0x00,
-  0x00, 0x7F, 0xFE, 0x03, 0xFE, 0x1F, 0xE0, 0x01, 0xF8, 0x1F, 0x80, 0x01,
-  0xC0, 0x3E, 0x00, 0x03, 0x80, 0x7C, 0x00, 0x07, 0x00, 0xF8, 0x00, 0x0C,
-  0x03, 0xE0, 0x00, 0x18, 0x07, 0xC0, 0x00, 0x70, 0x0F, 0x80, 0x00, 0xC0,
-  0x1F, 0x00, 0x01, 0x80, 0x7C, 0x00, 0x03, 0x00, 0xF8, 0x00, 0x0E, 0x01,
-  0xF0, 0x00, 0x18, 0x07, 0xC0, 0x00, 0x30, 0x0F, 0x80, 0x00, 0x60, 0x1F,
-  0x00, 0x01, 0x80, 0x3E, 0x00, 0x03, 0x00, 0xF8, 0x00, 0x06, 0x01, 0xF0,
-  0x00, 0x18, 0x03, 0xE0, 0x00, 0x30, 0x07, 0xC0, 0x00, 0x60, 0x1F, 0x00,
-  0x00, 0xC0, 0x3E, 0x00, 0x03, 0x00, 0x7C, 0x00, 0x06, 0x00, 0xF8, 0x00,
-  0x18, 0x01, 0xF0, 0x00, 0x30, 0x03, 0xE0, 0x00, 0xC0, 0x03, 0xE0, 0x03,
-  0x80, 0x03, 0xE0, 0x0E, 0x00, 0x03, 0xF0, 0x78, 0x00, 0x03, 0xFF, 0xC0,
-  0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xF9, 0xFC, 0x00, 0x1F,
-  0x07, 0xC0, 0x00, 0x78, 0x3E, 0x00, 0x03, 0x81, 0xF0, 0x00, 0x18, 0x0F,
-  0x80, 0x01, 0xC0, 0x7C, 0x00, 0x0C, 0x01, 0xE0, 0x00, 0xC0, 0x0F, 0x80,
-  0x06, 0x00, 0x7C, 0x00, 0x60, 0x03, 0xE0, 0x07, 0x00, 0x1F, 0x00, 0x30,
-  0x00, 0xF8, 0x03, 0x00, 0x03, 0xC0, 0x18, 0x00, 0x1E, 0x01, 0x80, 0x00,
-  0xF8, 0x1C, 0x00, 0x07, 0xC0, 0xC0, 0x00, 0x3E, 0x0C, 0x00, 0x01, 0xF0,
-  0x60, 0x00, 0x07, 0x86, 0x00, 0x00, 0x3C, 0x30, 0x00, 0x01, 0xE3, 0x00,
-  0x00, 0x0F, 0xB0, 0x00, 0x00, 0x7D, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00,
-  0x0F, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x1E,
-  0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00,
-  0x00, 0xFF, 0xE3, 0xFF, 0x81, 0xFE, 0x7F, 0x01, 0xFC, 0x00, 0xF8, 0x7C,
-  0x01, 0xF0, 0x00, 0xE0, 0xF8, 0x03, 0xE0, 0x01, 0x81, 0xF0, 0x03, 0xC0,
-  0x07, 0x03, 0xE0, 0x07, 0x80, 0x0C, 0x03, 0xC0, 0x0F, 0x00, 0x18, 0x07,
-  0x80, 0x1E, 0x00, 0x60, 0x0F, 0x00, 0x7E, 0x00, 0xC0, 0x1F, 0x00, 0xFC,
-  0x03, 0x00, 0x3E, 0x03, 0xF8, 0x06, 0x00, 0x7C, 0x05, 0xF0, 0x18, 0x00,
-  0xF8, 0x1B, 0xE0, 0x30, 0x01, 0xF0, 0x33, 0xC0, 0xC0, 0x01, 0xE0, 0xC7,
-  0x83, 0x80, 0x03, 0xC1, 0x8F, 0x06, 0x00, 0x07, 0x86, 0x1E, 0x1C, 0x00,
-  0x0F, 0x0C, 0x3C, 0x30, 0x00, 0x1F, 0x30, 0x7C, 0xE0, 0x00, 0x3E, 0x60,
-  0xF9, 0x80, 0x00, 0x7D, 0x81, 0xF7, 0x00, 0x00, 0xFB, 0x03, 0xEC, 0x00,
-  0x01, 0xFC, 0x03, 0xF8, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x00, 0x03, 0xE0,
-  0x0F, 0x80, 0x00, 0x07, 0xC0, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00,
-  0x00, 0x1E, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00, 0x70,
-  0x01, 0xC0, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00,
-  0x00, 0x07, 0xFF, 0x83, 0xFF, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x7C, 0x00,
-  0x78, 0x00, 0x7C, 0x00, 0x70, 0x00, 0x3C, 0x00, 0xE0, 0x00, 0x3E, 0x01,
-  0xC0, 0x00, 0x3E, 0x01, 0x80, 0x00, 0x1F, 0x03, 0x00, 0x00, 0x1F, 0x07,
-  0x00, 0x00, 0x0F, 0x0E, 0x00, 0x00, 0x0F, 0x9C, 0x00, 0x00, 0x0F, 0xB8,
-  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x03, 0xC0,
-  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xF0,
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x38, 0xF8,
-  0x00, 0x00, 0x30, 0xF8, 0x00, 0x00, 0x60, 0x7C, 0x00, 0x00, 0xC0, 0x7C,
-  0x00, 0x01, 0xC0, 0x3C, 0x00, 0x03, 0x80, 0x3E, 0x00, 0x07, 0x00, 0x3E,
-  0x00, 0x0E, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x7F, 0x00, 0x3F,
-  0xC0, 0xFF, 0xC1, 0xFF, 0xF0, 0x7F, 0xF0, 0x7F, 0xC7, 0xF0, 0x03, 0xE0,
-  0xF8, 0x00, 0x70, 0x3E, 0x00, 0x38, 0x07, 0x80, 0x0C, 0x01, 0xE0, 0x07,
-  0x00, 0x7C, 0x03, 0x80, 0x1F, 0x00, 0xC0, 0x03, 0xC0, 0x60, 0x00, 0xF0,
-  0x30, 0x00, 0x3E, 0x1C, 0x00, 0x07, 0x8E, 0x00, 0x01, 0xE3, 0x00, 0x00,
-  0x7D, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0x3C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
-  0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x0F, 0xC0, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-  0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x81, 0xF0, 0x00, 0xFC, 0x0E, 0x00, 0x0F,
-  0xC0, 0x60, 0x00, 0xFC, 0x06, 0x00, 0x0F, 0xC0, 0x20, 0x00, 0x7C, 0x00,
-  0x00, 0x07, 0xE0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0,
-  0x00, 0x00, 0x3F, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x01, 0xF8, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x1F,
-  0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFC, 0x00,
-  0x08, 0x0F, 0xC0, 0x00, 0x80, 0xFC, 0x00, 0x0C, 0x07, 0xC0, 0x00, 0x60,
-  0x7E, 0x00, 0x07, 0x07, 0xE0, 0x01, 0xF0, 0x7F, 0xFF, 0xFF, 0x83, 0xFF,
-  0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x3C, 0x00, 0x1C, 0x00, 0x0E, 0x00,
-  0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0xE0,
-  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07,
-  0x00, 0x03, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
-  0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x07, 0x00,
-  0x03, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03,
-  0xFC, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0x80,
-  0x01, 0xE0, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
-  0xC0, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80,
-  0x01, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03,
-  0x80, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x00,
-  0x03, 0xC0, 0x00, 0xE0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07,
-  0x80, 0x00, 0xFF, 0x80, 0x07, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0xF0,
-  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x07,
-  0x00, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x70, 0x00,
-  0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
-  0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x38,
-  0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01,
-  0xC0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x38, 0x03, 0xFC, 0x00,
-  0x00, 0xF0, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03, 0xBC,
-  0x00, 0x39, 0xC0, 0x07, 0x1E, 0x00, 0x70, 0xE0, 0x0E, 0x0F, 0x00, 0xE0,
-  0x70, 0x1E, 0x07, 0x81, 0xC0, 0x38, 0x3C, 0x03, 0xC3, 0x80, 0x1C, 0x78,
-  0x01, 0xE7, 0x00, 0x0E, 0xF0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x60, 0xF0, 0xF8, 0x78, 0x3C, 0x1E, 0x0E, 0x07, 0x00, 0x1E, 0x70,
-  0x03, 0x0B, 0x80, 0x70, 0x3C, 0x07, 0x01, 0xE0, 0x70, 0x0E, 0x07, 0x00,
-  0x70, 0x78, 0x03, 0x83, 0x80, 0x38, 0x3C, 0x01, 0xC1, 0xC0, 0x0E, 0x1E,
-  0x00, 0xF0, 0xF0, 0x07, 0x0F, 0x00, 0x78, 0x78, 0x03, 0xC3, 0xC0, 0x3E,
-  0x1E, 0x01, 0x70, 0xF0, 0x17, 0x0F, 0x81, 0x38, 0xBE, 0x11, 0xC8, 0xFF,
-  0x0F, 0x83, 0xF0, 0x70, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x78,
-  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00,
-  0x78, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x0F,
-  0x80, 0x71, 0xFE, 0x03, 0x98, 0xF8, 0x3D, 0x03, 0xE1, 0xE8, 0x0F, 0x0E,
-  0x80, 0x78, 0x78, 0x03, 0xC7, 0xC0, 0x1E, 0x3C, 0x00, 0xF1, 0xE0, 0x0F,
-  0x1E, 0x00, 0x78, 0xF0, 0x03, 0xC7, 0x80, 0x3C, 0x38, 0x01, 0xE3, 0xC0,
-  0x1E, 0x1E, 0x00, 0xE0, 0xE0, 0x0E, 0x07, 0x00, 0xF0, 0x78, 0x07, 0x03,
-  0xC0, 0xE0, 0x0F, 0x0E, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x38,
-  0x60, 0x38, 0x1C, 0x1C, 0x0F, 0x0E, 0x03, 0x87, 0x80, 0x03, 0xC0, 0x00,
-  0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0xF0,
-  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x02, 0x3E, 0x01,
-  0x87, 0x80, 0xC1, 0xF0, 0x60, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00,
-  0x0E, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00,
-  0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x71,
-  0x70, 0x00, 0xC1, 0x70, 0x03, 0x80, 0xF0, 0x07, 0x80, 0xE0, 0x07, 0x01,
-  0xE0, 0x0E, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x3C, 0x01, 0xC0, 0x3C, 0x01,
-  0xC0, 0x78, 0x03, 0xC0, 0x78, 0x03, 0xC0, 0x78, 0x03, 0x80, 0xF0, 0x07,
-  0x80, 0xF0, 0x07, 0x80, 0xF0, 0x0F, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x17,
-  0x08, 0xF0, 0x27, 0x10, 0x78, 0x47, 0x20, 0x7F, 0x87, 0xC0, 0x1E, 0x07,
-  0x00, 0x00, 0x1F, 0x00, 0x1C, 0xF0, 0x1C, 0x1C, 0x0E, 0x07, 0x07, 0x01,
-  0xC3, 0xC0, 0xF1, 0xE0, 0x38, 0x70, 0x1C, 0x3C, 0x0E, 0x1F, 0x0F, 0x07,
-  0x8F, 0x01, 0xFE, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
-  0x00, 0xF0, 0x01, 0x3C, 0x00, 0xC7, 0x80, 0x61, 0xF0, 0x60, 0x3F, 0xF0,
-  0x03, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x03, 0x1C, 0x00, 0x00,
-  0xC3, 0x80, 0x00, 0x38, 0x70, 0x00, 0x06, 0x00, 0x00, 0x01, 0xC0, 0x00,
-  0x00, 0x30, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-  0xFF, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00,
-  0x00, 0x01, 0xE0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
-  0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0xF0, 0x00,
-  0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1E,
-  0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00,
-  0x03, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xC0,
-  0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x01, 0x80, 0x00, 0x38,
-  0x60, 0x00, 0x07, 0x0C, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x0F, 0x80, 0x00,
-  0x00, 0x00, 0x3F, 0x00, 0x07, 0x0E, 0x00, 0x70, 0x3E, 0x07, 0x01, 0xF0,
-  0x70, 0x0E, 0x07, 0x80, 0x70, 0x3C, 0x03, 0x81, 0xC0, 0x1C, 0x0E, 0x01,
-  0xE0, 0x70, 0x0E, 0x03, 0x80, 0xF0, 0x0E, 0x0F, 0x00, 0x30, 0xE0, 0x00,
-  0xFE, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x7E, 0x00,
-  0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x8F, 0xF0, 0x18, 0x0F, 0xC1, 0x80,
-  0x1F, 0x18, 0x00, 0x78, 0xC0, 0x01, 0xC6, 0x00, 0x0E, 0x30, 0x00, 0x61,
-  0xC0, 0x07, 0x06, 0x00, 0x70, 0x1C, 0x0E, 0x00, 0x3F, 0xC0, 0x00, 0x00,
-  0xF0, 0x00, 0x7F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
-  0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1C,
-  0x00, 0x00, 0xE0, 0x00, 0x0F, 0x03, 0x80, 0x78, 0x7E, 0x03, 0x86, 0x70,
-  0x3C, 0x43, 0x81, 0xE4, 0x1C, 0x0E, 0x40, 0xE0, 0x74, 0x0E, 0x07, 0xA0,
-  0x70, 0x3E, 0x03, 0x81, 0xE0, 0x1C, 0x0F, 0x00, 0xE0, 0xF0, 0x0E, 0x07,
-  0x80, 0x70, 0x38, 0x03, 0x81, 0xC0, 0x1C, 0x1E, 0x00, 0xC2, 0xF0, 0x0E,
-  0x27, 0x00, 0x73, 0x38, 0x03, 0x93, 0xC0, 0x1F, 0x1E, 0x00, 0xE0, 0x03,
-  0x81, 0xF0, 0x7C, 0x1F, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0xFC, 0x1F, 0x07, 0x81, 0xE0, 0x78, 0x1C, 0x07, 0x03, 0xC0, 0xF0,
-  0x38, 0x0E, 0x07, 0x81, 0xE0, 0x70, 0x1C, 0x0F, 0x03, 0x84, 0xE2, 0x39,
-  0x0F, 0x81, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01,
-  0xF0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x3F, 0xC0, 0x00, 0xF0, 0x00, 0x1E,
-  0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0x78,
-  0x00, 0x0F, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xE0,
-  0x00, 0x38, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x07, 0x00,
-  0x00, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00,
-  0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x01, 0xC7, 0x00, 0x38, 0xC0, 0x07,
-  0x30, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x7F, 0x00, 0x00, 0x78,
-  0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00,
-  0x78, 0x00, 0x03, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00,
-  0x00, 0x70, 0xFF, 0x83, 0x80, 0xF0, 0x3C, 0x06, 0x01, 0xE0, 0x60, 0x0E,
-  0x06, 0x00, 0x70, 0xE0, 0x07, 0x8C, 0x00, 0x3C, 0xC0, 0x01, 0xCC, 0x00,
-  0x0F, 0xF0, 0x00, 0xFF, 0x80, 0x07, 0x9E, 0x00, 0x38, 0xF0, 0x01, 0xC3,
-  0x80, 0x1E, 0x1E, 0x00, 0xF0, 0x70, 0x07, 0x03, 0xC2, 0x78, 0x0E, 0x13,
-  0xC0, 0x79, 0x1E, 0x01, 0xF0, 0x00, 0x07, 0x00, 0x00, 0xE1, 0xFC, 0x0F,
-  0x80, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
-  0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x70, 0x1E, 0x03, 0xC0, 0x78, 0x0E, 0x03,
-  0xC0, 0x78, 0x0E, 0x01, 0xC0, 0x78, 0x0F, 0x01, 0xC0, 0x38, 0x4F, 0x11,
-  0xE4, 0x39, 0x07, 0xC0, 0x70, 0x00, 0x07, 0x81, 0xC0, 0x78, 0xFE, 0x0F,
-  0xC1, 0xF8, 0x3C, 0x33, 0x84, 0x70, 0x78, 0x87, 0x10, 0xE0, 0xF2, 0x0E,
-  0x41, 0xC1, 0xC8, 0x39, 0x07, 0x87, 0xA0, 0x74, 0x0F, 0x0F, 0x40, 0xE8,
-  0x1E, 0x1F, 0x01, 0xE0, 0x38, 0x3C, 0x07, 0xC0, 0xF0, 0xF8, 0x0F, 0x01,
-  0xE1, 0xE0, 0x1E, 0x03, 0xC3, 0xC0, 0x38, 0x07, 0x07, 0x00, 0xF0, 0x1E,
-  0x1E, 0x01, 0xE0, 0x3C, 0x3C, 0x03, 0x80, 0x79, 0x70, 0x07, 0x00, 0xE2,
-  0xE0, 0x1E, 0x03, 0x8B, 0xC0, 0x3C, 0x07, 0x27, 0x80, 0x70, 0x0F, 0x8E,
-  0x00, 0xE0, 0x1E, 0x00, 0x07, 0x81, 0xE3, 0xFC, 0x3F, 0x83, 0xC2, 0x3C,
-  0x1E, 0x21, 0xE0, 0xF2, 0x0F, 0x07, 0x20, 0x70, 0x39, 0x07, 0x83, 0xD0,
-  0x3C, 0x1F, 0x01, 0xE0, 0xE8, 0x0E, 0x0F, 0x80, 0xF0, 0x78, 0x07, 0x83,
-  0xC0, 0x38, 0x1C, 0x01, 0xC1, 0xE0, 0x1E, 0x0F, 0x00, 0xF1, 0x70, 0x07,
-  0x0B, 0x80, 0x38, 0xBC, 0x01, 0xC9, 0xE0, 0x0F, 0x8E, 0x00, 0x38, 0x00,
-  0x00, 0x1F, 0x80, 0x07, 0x8F, 0x00, 0x70, 0x3C, 0x07, 0x00, 0xE0, 0x70,
-  0x07, 0x87, 0x80, 0x3C, 0x78, 0x01, 0xE7, 0x80, 0x0F, 0x3C, 0x00, 0x7B,
-  0xC0, 0x03, 0xDE, 0x00, 0x3D, 0xF0, 0x01, 0xEF, 0x80, 0x0F, 0x78, 0x00,
-  0xF3, 0xC0, 0x07, 0x9E, 0x00, 0x78, 0xF0, 0x03, 0x87, 0x80, 0x38, 0x1C,
-  0x03, 0x80, 0xF0, 0x38, 0x03, 0xC3, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x3C,
-  0x3F, 0x00, 0x7F, 0x8F, 0xF0, 0x01, 0xF7, 0x3F, 0x00, 0x1D, 0x83, 0xF0,
-  0x07, 0xA0, 0x3E, 0x00, 0xF8, 0x07, 0xC0, 0x1E, 0x00, 0xF8, 0x03, 0xC0,
-  0x1F, 0x00, 0xF0, 0x03, 0xE0, 0x1E, 0x00, 0x7C, 0x03, 0xC0, 0x1F, 0x00,
-  0x70, 0x03, 0xE0, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0x1F, 0x00, 0x70, 0x03,
-  0xC0, 0x0E, 0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0x78, 0x07, 0x80, 0x0F,
-  0x01, 0xE0, 0x01, 0xE0, 0x70, 0x00, 0x7C, 0x3C, 0x00, 0x0F, 0x7C, 0x00,
-  0x01, 0xC0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0,
-  0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0x8D,
-  0xC0, 0x38, 0x2E, 0x07, 0x80, 0xF0, 0x78, 0x07, 0x03, 0x80, 0x38, 0x38,
-  0x03, 0xC3, 0xC0, 0x1E, 0x3C, 0x00, 0xE1, 0xE0, 0x07, 0x1E, 0x00, 0x78,
-  0xF0, 0x03, 0x87, 0x80, 0x3C, 0x78, 0x01, 0xE3, 0xC0, 0x1F, 0x1E, 0x01,
-  0x70, 0xF0, 0x17, 0x87, 0x80, 0xBC, 0x3C, 0x09, 0xC0, 0xF1, 0x8E, 0x07,
-  0xF8, 0xF0, 0x1F, 0x07, 0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1E,
-  0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00,
-  0x3E, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0x87, 0x3F, 0x87, 0xC3, 0xC7, 0xE1,
-  0xE6, 0xF0, 0xF6, 0x00, 0x72, 0x00, 0x3A, 0x00, 0x1D, 0x00, 0x1F, 0x00,
-  0x0E, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0,
-  0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1E, 0x00, 0x0F,
-  0x00, 0x00, 0x01, 0xF8, 0x81, 0x87, 0xC1, 0x80, 0xE1, 0xC0, 0x60, 0xE0,
-  0x10, 0x70, 0x08, 0x3C, 0x04, 0x1F, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00,
-  0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x03, 0xC1, 0x01, 0xE0, 0x80, 0x70,
-  0x40, 0x38, 0x30, 0x1C, 0x38, 0x0C, 0x1C, 0x0E, 0x0F, 0x0E, 0x04, 0x7C,
-  0x00, 0x00, 0xC0, 0x18, 0x03, 0x80, 0x78, 0x1F, 0x03, 0xFF, 0x7F, 0xF0,
-  0xF0, 0x0E, 0x00, 0xE0, 0x1E, 0x01, 0xE0, 0x1C, 0x01, 0xC0, 0x3C, 0x03,
-  0xC0, 0x38, 0x03, 0x80, 0x78, 0x07, 0x80, 0x70, 0x8F, 0x10, 0xF1, 0x0F,
-  0x20, 0xFC, 0x07, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x0E, 0x7F, 0x00, 0xE0,
-  0xF0, 0x1E, 0x0E, 0x01, 0xE1, 0xE0, 0x3C, 0x1E, 0x03, 0xC1, 0xE0, 0x3C,
-  0x1C, 0x07, 0xC3, 0xC0, 0x78, 0x3C, 0x0F, 0x83, 0xC0, 0xB8, 0x38, 0x1F,
-  0x87, 0x83, 0x70, 0x78, 0x27, 0x07, 0x86, 0x70, 0x70, 0xC7, 0x1F, 0x08,
-  0xE1, 0xE1, 0x0E, 0x2E, 0x60, 0xE4, 0xFC, 0x0F, 0x87, 0x00, 0x70, 0x1C,
-  0x03, 0xBF, 0x00, 0xF1, 0xE0, 0x3C, 0x78, 0x07, 0x1E, 0x00, 0xC3, 0x80,
-  0x30, 0xE0, 0x08, 0x38, 0x06, 0x0E, 0x01, 0x03, 0x80, 0xC0, 0xF0, 0x20,
-  0x3C, 0x10, 0x07, 0x04, 0x01, 0xC2, 0x00, 0x71, 0x00, 0x1C, 0xC0, 0x07,
-  0x60, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x01, 0x00,
-  0x00, 0x0C, 0x00, 0x40, 0x3B, 0xF8, 0x01, 0x00, 0xF1, 0xE0, 0x0C, 0x03,
-  0xC3, 0x80, 0x78, 0x07, 0x0E, 0x01, 0xE0, 0x0C, 0x38, 0x0F, 0x80, 0x20,
-  0xE0, 0x6E, 0x00, 0x83, 0x81, 0x38, 0x04, 0x0F, 0x0C, 0xE0, 0x10, 0x1C,
-  0x23, 0x80, 0x80, 0x71, 0x8E, 0x06, 0x01, 0xCC, 0x38, 0x10, 0x07, 0x20,
-  0xE0, 0x80, 0x1D, 0x83, 0x86, 0x00, 0x7C, 0x07, 0x30, 0x01, 0xF0, 0x1C,
-  0x80, 0x07, 0x80, 0x74, 0x00, 0x1E, 0x01, 0xF0, 0x00, 0x70, 0x07, 0x80,
-  0x01, 0xC0, 0x1C, 0x00, 0x06, 0x00, 0x60, 0x00, 0x10, 0x01, 0x00, 0x00,
-  0x00, 0xE0, 0x38, 0x1F, 0x81, 0xF0, 0x8F, 0x09, 0x80, 0x3C, 0x40, 0x00,
-  0x72, 0x00, 0x01, 0xD0, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x38,
-  0x00, 0x00, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00,
-  0x01, 0x70, 0x00, 0x09, 0xC0, 0x00, 0x67, 0x00, 0x01, 0x1E, 0x10, 0x08,
-  0x38, 0x40, 0x40, 0xE2, 0x39, 0x03, 0xD0, 0xF8, 0x0F, 0x83, 0xC0, 0x1C,
-  0x00, 0x07, 0x80, 0x33, 0xFC, 0x03, 0xC1, 0xE0, 0x1E, 0x07, 0x80, 0x70,
-  0x3C, 0x01, 0x80, 0xE0, 0x0C, 0x07, 0x80, 0x40, 0x3C, 0x02, 0x00, 0xE0,
-  0x20, 0x07, 0x81, 0x00, 0x3C, 0x18, 0x01, 0xE0, 0x80, 0x07, 0x0C, 0x00,
-  0x38, 0x40, 0x01, 0xE4, 0x00, 0x0F, 0x60, 0x00, 0x3A, 0x00, 0x01, 0xF0,
-  0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00, 0x00,
-  0x80, 0x00, 0x0C, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00,
-  0x04, 0x00, 0x0E, 0x40, 0x00, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F,
-  0xFF, 0x87, 0xFF, 0x82, 0x00, 0x83, 0x00, 0xC1, 0x00, 0xC0, 0x00, 0xC0,
-  0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x20,
-  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x1E,
-  0x00, 0x1F, 0xC0, 0x1F, 0xF0, 0xE8, 0xFC, 0x70, 0x1E, 0x38, 0x03, 0x88,
-  0x00, 0x78, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0F,
-  0x00, 0x07, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00,
-  0x70, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0F, 0x00,
-  0x07, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x00, 0x80,
-  0x00, 0x60, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07,
-  0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x70, 0x00,
-  0x38, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x01, 0x80,
-  0x00, 0x70, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x07,
-  0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0E,
-  0x00, 0x0E, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x3C,
-  0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x18, 0x00, 0x08, 0x00, 0x1C,
-  0x00, 0x7E, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0xE0, 0x01, 0xE0,
-  0x01, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x80,
-  0x07, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x1C, 0x00,
-  0xF8, 0x00, 0x1F, 0x80, 0x00, 0xFF, 0x80, 0xC7, 0xFF, 0x87, 0xBC, 0x3F,
-  0xFE, 0x60, 0x3F, 0xF0, 0x00, 0x1F, 0x00 };
+  0x84, 0x84, 0x84, 0x84, 0x75, 0x74, 0x84, 0x83, 0x93, 0x84, 0x83, 0x93,
+  0x93, 0x92, 0x93, 0x92, 0xA2, 0xA2, 0xA1, 0xB1, 0xA2, 0xA1, 0xB1, 0xFF,
+  0xFB, 0x38, 0x57, 0x57, 0x58, 0x38, 0x23, 0x63, 0x14, 0x63, 0x14, 0x54,
+  0x13, 0x63, 0x23, 0x63, 0x23, 0x54, 0x13, 0x63, 0x23, 0x63, 0x22, 0x72,
+  0x32, 0x72, 0x32, 0x72, 0x31, 0x81, 0x40, 0xD2, 0x72, 0xD3, 0x63, 0xD3,
+  0x63, 0xC3, 0x63, 0xD3, 0x63, 0xD3, 0x63, 0xC3, 0x63, 0xD3, 0x63, 0xD2,
+  0x72, 0xD3, 0x63, 0x8F, 0x64, 0xF6, 0x83, 0x63, 0xD2, 0x72, 0xD3, 0x63,
+  0xD3, 0x63, 0xC3, 0x63, 0xD3, 0x63, 0xD3, 0x63, 0x7F, 0x73, 0xF6, 0x83,
+  0x63, 0xD3, 0x63, 0xD3, 0x62, 0xD3, 0x63, 0xD3, 0x63, 0xC3, 0x63, 0xD3,
+  0x63, 0xD3, 0x63, 0xC3, 0x63, 0xD3, 0x63, 0xC0, 0xF0, 0x1F, 0x42, 0xF4,
+  0x2E, 0x9A, 0x34, 0x11, 0x47, 0x25, 0x22, 0x45, 0x35, 0x23, 0x34, 0x36,
+  0x24, 0x24, 0x36, 0x24, 0x24, 0x35, 0x25, 0x15, 0x35, 0x25, 0x15, 0x44,
+  0x2B, 0x53, 0x2C, 0x51, 0x2E, 0x7F, 0x06, 0xF1, 0x6F, 0x16, 0xF1, 0x6F,
+  0x07, 0xE2, 0x15, 0xD2, 0x24, 0xC2, 0x44, 0xB2, 0x44, 0xB2, 0x53, 0x31,
+  0x72, 0x53, 0x31, 0x62, 0x63, 0x22, 0x62, 0x63, 0x23, 0x52, 0x62, 0x33,
+  0x52, 0x53, 0x34, 0x32, 0x62, 0x54, 0x22, 0x52, 0x86, 0x24, 0xB7, 0xF0,
+  0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xD0, 0x75, 0xC2, 0xC9, 0x84, 0xB4, 0x34,
+  0x55, 0xB4, 0x77, 0x12, 0xB4, 0x81, 0x63, 0xB3, 0x91, 0x62, 0xB4, 0x91,
+  0x53, 0xB3, 0xA1, 0x52, 0xB4, 0xA1, 0x43, 0xB3, 0xA1, 0x52, 0xC3, 0xA1,
+  0x43, 0xC3, 0x92, 0x33, 0xD3, 0x91, 0x42, 0xE3, 0x81, 0x43, 0x65, 0x42,
+  0x72, 0x42, 0x59, 0x23, 0x43, 0x43, 0x45, 0x32, 0x37, 0x62, 0x44, 0x62,
+  0x35, 0x63, 0x34, 0x81, 0xE2, 0x44, 0x81, 0xD3, 0x34, 0x91, 0xD2, 0x43,
+  0xA1, 0xC2, 0x44, 0xA1, 0xB3, 0x44, 0x92, 0xB2, 0x53, 0xA1, 0xB3, 0x53,
+  0x92, 0xB2, 0x63, 0x91, 0xB3, 0x63, 0x82, 0xB2, 0x73, 0x72, 0xB3, 0x83,
+  0x43, 0xC2, 0xA8, 0xC2, 0xC5, 0xD3, 0xF9, 0xF1, 0x4F, 0x98, 0xF6, 0x33,
+  0x3F, 0x63, 0x43, 0xF4, 0x35, 0x3F, 0x43, 0x53, 0xF3, 0x45, 0x3F, 0x34,
+  0x43, 0xF4, 0x44, 0x2F, 0x54, 0x32, 0xF6, 0x42, 0x2F, 0x77, 0xF8, 0x5F,
+  0xA4, 0xF9, 0x6F, 0x79, 0x58, 0x73, 0x25, 0x65, 0x74, 0x44, 0x73, 0x74,
+  0x55, 0x63, 0x64, 0x65, 0x53, 0x65, 0x74, 0x52, 0x74, 0x85, 0x33, 0x74,
+  0x85, 0x32, 0x75, 0x95, 0x12, 0x85, 0x98, 0x85, 0xA6, 0x95, 0xA5, 0xA6,
+  0xA5, 0xA5, 0xA6, 0x96, 0x78, 0xA6, 0x44, 0x26, 0x41, 0x4B, 0x59, 0x77,
+  0x95, 0x40, 0x23, 0x23, 0x14, 0x13, 0x23, 0x23, 0x13, 0x23, 0x22, 0x32,
+  0x32, 0x31, 0x40, 0xB1, 0xB1, 0xB2, 0xA2, 0xA2, 0xA2, 0xA3, 0xA2, 0xA3,
+  0x93, 0xA3, 0x94, 0x93, 0x94, 0x94, 0x93, 0xA3, 0x94, 0x94, 0x94, 0x93,
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xB2, 0xB2, 0xB2, 0xB2,
+  0xC2, 0xB2, 0xB2, 0xC1, 0xC2, 0xC1, 0x80, 0x81, 0xC2, 0xC1, 0xC1, 0xC2,
+  0xB2, 0xC2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+  0xA3, 0x94, 0x94, 0x94, 0x94, 0x93, 0x94, 0x94, 0x94, 0x93, 0x94, 0x93,
+  0xA3, 0x93, 0xA2, 0xA3, 0xA2, 0xA2, 0xA2, 0xA2, 0xB1, 0xB1, 0xB0, 0x71,
+  0xE3, 0xD3, 0xD3, 0xD3, 0x73, 0x41, 0x56, 0x41, 0x48, 0x31, 0x35, 0x32,
+  0x21, 0x22, 0x95, 0xC3, 0xB2, 0x11, 0x12, 0x64, 0x21, 0x24, 0x24, 0x31,
+  0x38, 0x41, 0x47, 0x41, 0x53, 0x63, 0xD3, 0xD3, 0xD2, 0x80, 0xA3, 0xF5,
+  0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3A, 0xFF, 0xFF, 0x9A, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53,
+  0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xA0, 0x33, 0x35, 0x25, 0x25, 0x34,
+  0x43, 0x42, 0x42, 0x51, 0x42, 0x51, 0x50, 0x1F, 0xF1, 0x10, 0x13, 0x1F,
+  0x01, 0x31, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2,
+  0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2,
+  0x3F, 0x24, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x23, 0xF2, 0x4F, 0x23, 0xF2,
+  0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2,
+  0x4F, 0x23, 0xF2, 0x3F, 0x30, 0xB6, 0xD3, 0x42, 0xB2, 0x72, 0x92, 0x82,
+  0x83, 0x92, 0x63, 0xA2, 0x53, 0xB2, 0x53, 0xB3, 0x33, 0xC3, 0x33, 0xC3,
+  0x24, 0xC3, 0x23, 0xD3, 0x14, 0xC4, 0x14, 0xC4, 0x14, 0xC4, 0x13, 0xD8,
+  0xD3, 0x14, 0xC4, 0x14, 0xC4, 0x13, 0xD3, 0x23, 0xC4, 0x23, 0xC4, 0x23,
+  0xC3, 0x33, 0xB4, 0x33, 0xB3, 0x52, 0xA3, 0x62, 0x93, 0x73, 0x82, 0x92,
+  0x72, 0xB2, 0x43, 0xE5, 0xB0, 0xF1, 0x1A, 0x78, 0x9C, 0x5C, 0x4D, 0x4D,
+  0x4D, 0x3D, 0x4D, 0x4D, 0x4C, 0x4D, 0x4D, 0x4D, 0x4C, 0x4D, 0x4D, 0x4C,
+  0x4D, 0x4D, 0x4D, 0x4C, 0x4D, 0x4D, 0x4C, 0x4D, 0x4D, 0x4D, 0x4C, 0x4C,
+  0x67, 0xD4, 0xA6, 0xDA, 0xAC, 0x83, 0x56, 0x62, 0x85, 0x52, 0xA5, 0x41,
+  0xC4, 0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x23, 0xF2, 0x4F,
+  0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2F,
+  0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x2B, 0x16, 0x2C, 0x15, 0x2C, 0x24, 0xF1,
+  0x4F, 0x23, 0xF2, 0x40, 0xC6, 0xEA, 0xB2, 0x55, 0x92, 0x74, 0x82, 0x94,
+  0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x24, 0xF3, 0x4F, 0x23, 0xF2, 0x4F, 0x13,
+  0xF1, 0x6D, 0xBF, 0x08, 0xF2, 0x5F, 0x35, 0xF2, 0x5F, 0x34, 0xF3, 0x4F,
+  0x34, 0xF3, 0x4F, 0x33, 0xF4, 0x3F, 0x43, 0xF3, 0x3F, 0x42, 0x73, 0x92,
+  0x77, 0x43, 0x9B, 0xC8, 0xC0, 0xF5, 0x2F, 0x43, 0xF3, 0x4F, 0x25, 0xF1,
+  0x5F, 0x16, 0xF0, 0x21, 0x4F, 0x02, 0x13, 0xF0, 0x22, 0x3E, 0x22, 0x4D,
+  0x23, 0x4C, 0x24, 0x3C, 0x25, 0x3B, 0x25, 0x4A, 0x26, 0x49, 0x27, 0x39,
+  0x27, 0x48, 0x28, 0x47, 0x29, 0x37, 0x2A, 0x36, 0x39, 0x46, 0xF5, 0x1F,
+  0x61, 0xF6, 0xD4, 0xF3, 0x3F, 0x43, 0xF3, 0x4F, 0x34, 0xF3, 0x3F, 0x34,
+  0xF3, 0x48, 0xAC, 0xAC, 0x9C, 0xA1, 0xF6, 0x1F, 0x51, 0xF6, 0x1F, 0x53,
+  0xF4, 0x6F, 0x08, 0xEA, 0xF0, 0x8F, 0x16, 0xF3, 0x5F, 0x34, 0xF4, 0x4F,
+  0x34, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x42, 0xF4, 0x3F,
+  0x43, 0xF4, 0x2F, 0x42, 0xF4, 0x28, 0x38, 0x37, 0x64, 0x3A, 0xBC, 0x7D,
+  0xF5, 0x3F, 0x15, 0xF0, 0x5F, 0x15, 0xF2, 0x5F, 0x24, 0xF2, 0x5F, 0x25,
+  0xF3, 0x4F, 0x35, 0xF2, 0x5F, 0x25, 0x26, 0xAF, 0x07, 0x66, 0x56, 0x58,
+  0x54, 0x5A, 0x44, 0x4C, 0x43, 0x4C, 0x42, 0x4D, 0x42, 0x4D, 0x42, 0x4D,
+  0x42, 0x3E, 0x42, 0x3D, 0x52, 0x3D, 0x43, 0x3D, 0x43, 0x3C, 0x45, 0x2C,
+  0x45, 0x2B, 0x47, 0x2A, 0x38, 0x28, 0x4B, 0x25, 0x3F, 0x06, 0xB0, 0x3F,
+  0x32, 0xF4, 0x2F, 0x32, 0x3D, 0x22, 0x2E, 0x32, 0x1F, 0x02, 0xF3, 0x3F,
+  0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x2F, 0x33, 0xF2, 0x3F, 0x33, 0xF2, 0x3F,
+  0x33, 0xF2, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF3, 0x3F, 0x23, 0xF2, 0x4F,
+  0x23, 0xF2, 0x3F, 0x33, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x23, 0xF3, 0x3F,
+  0x23, 0xF3, 0xA7, 0xD3, 0x53, 0xA3, 0x82, 0x83, 0x93, 0x63, 0xB3, 0x53,
+  0xB3, 0x53, 0xB3, 0x53, 0xB3, 0x54, 0xA3, 0x54, 0x93, 0x74, 0x74, 0x76,
+  0x43, 0xA6, 0x14, 0xC7, 0xF0, 0x7E, 0x9B, 0x33, 0x68, 0x45, 0x66, 0x38,
+  0x55, 0x49, 0x54, 0x3B, 0x43, 0x3D, 0x42, 0x3E, 0x32, 0x3E, 0x32, 0x3E,
+  0x32, 0x3E, 0x32, 0x3E, 0x24, 0x3C, 0x34, 0x3B, 0x36, 0x39, 0x38, 0x45,
+  0x3C, 0x89, 0xB6, 0xD4, 0x42, 0xB3, 0x81, 0x93, 0x92, 0x73, 0xB2, 0x54,
+  0xB2, 0x53, 0xC3, 0x34, 0xC3, 0x34, 0xC3, 0x24, 0xD3, 0x24, 0xD3, 0x24,
+  0xD3, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xC4, 0x24, 0xB4, 0x44, 0xA4, 0x45,
+  0x85, 0x55, 0x56, 0x7A, 0x14, 0x86, 0x34, 0xF2, 0x5F, 0x24, 0xF2, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x14, 0xF1, 0x5F, 0x14, 0xF0, 0x5F,
+  0x03, 0xF4, 0x53, 0x55, 0x45, 0x45, 0x53, 0xFF, 0xFF, 0xFF, 0xF5, 0x35,
+  0x54, 0x54, 0x55, 0x35, 0x73, 0x75, 0x65, 0x65, 0x73, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x52, 0x84, 0x75, 0x65, 0x74, 0x83, 0x82, 0x82, 0x92, 0x81, 0x91,
+  0x90, 0xFF, 0xE2, 0xF3, 0x5F, 0x17, 0xE8, 0xD7, 0xE7, 0xD8, 0xD8, 0xD8,
+  0xD7, 0xF0, 0x6F, 0x24, 0xF4, 0x6F, 0x28, 0xF2, 0x8F, 0x37, 0xF3, 0x7F,
+  0x38, 0xF2, 0x8F, 0x28, 0xF3, 0x7F, 0x35, 0xF5, 0x3F, 0x71, 0x0F, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xC0, 0x01, 0xF8, 0x3F,
+  0x65, 0xF4, 0x7F, 0x47, 0xF4, 0x8F, 0x38, 0xF3, 0x8F, 0x47, 0xF4, 0x7F,
+  0x48, 0xF3, 0x7F, 0x45, 0xF3, 0x6F, 0x17, 0xE8, 0xE8, 0xE8, 0xE7, 0xF0,
+  0x7E, 0x8E, 0x8F, 0x16, 0xF3, 0x3F, 0x61, 0xF8, 0x66, 0x92, 0x43, 0x62,
+  0x63, 0x43, 0x72, 0x43, 0x73, 0x33, 0x73, 0x33, 0x73, 0xD3, 0xC4, 0xC3,
+  0xC4, 0xB4, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xD2, 0xD2, 0xE1, 0xE1, 0xF0,
+  0x1F, 0x01, 0xE1, 0xFF, 0xFF, 0xF2, 0x3C, 0x5B, 0x5B, 0x5C, 0x3C, 0xD9,
+  0xF6, 0xEF, 0x26, 0x75, 0xE4, 0xD4, 0xA5, 0xF0, 0x48, 0x5F, 0x33, 0x74,
+  0xF5, 0x35, 0x4F, 0x72, 0x44, 0xB4, 0x83, 0x34, 0x97, 0x13, 0x42, 0x24,
+  0x94, 0x35, 0x43, 0x14, 0x83, 0x54, 0x62, 0x14, 0x73, 0x73, 0x66, 0x83,
+  0x73, 0x66, 0x73, 0x74, 0x66, 0x73, 0x74, 0x66, 0x72, 0x83, 0x76, 0x63,
+  0x83, 0x76, 0x63, 0x83, 0x62, 0x14, 0x63, 0x74, 0x62, 0x14, 0x63, 0x73,
+  0x63, 0x24, 0x53, 0x64, 0x62, 0x34, 0x54, 0x45, 0x52, 0x44, 0x63, 0x32,
+  0x13, 0x42, 0x64, 0x57, 0x37, 0x83, 0x64, 0x65, 0x94, 0xFF, 0x04, 0xFF,
+  0x04, 0xFF, 0x05, 0xF0, 0x1E, 0x68, 0x5F, 0x1F, 0x0F, 0x69, 0xB0, 0xF4,
+  0x2F, 0xB3, 0xFB, 0x3F, 0xA4, 0xFA, 0x5F, 0x86, 0xF8, 0x6F, 0x72, 0x14,
+  0xF6, 0x22, 0x4F, 0x62, 0x24, 0xF5, 0x23, 0x5F, 0x41, 0x45, 0xF3, 0x24,
+  0x5F, 0x22, 0x64, 0xF2, 0x26, 0x4F, 0x12, 0x74, 0xF1, 0x18, 0x5E, 0x28,
+  0x5D, 0xF1, 0xDF, 0x1C, 0x2B, 0x4C, 0x2B, 0x4B, 0x2C, 0x59, 0x3C, 0x59,
+  0x2D, 0x58, 0x3E, 0x48, 0x2F, 0x04, 0x73, 0xF0, 0x55, 0x4F, 0x05, 0x45,
+  0xE7, 0x28, 0x9C, 0x6F, 0x2E, 0xF1, 0xD5, 0x65, 0xC5, 0x75, 0xB5, 0x85,
+  0xA4, 0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0xA5, 0x94, 0x95, 0x95, 0x95,
+  0x95, 0x85, 0xA4, 0x66, 0xBE, 0xEF, 0x0D, 0x55, 0x6C, 0x48, 0x5A, 0x59,
+  0x59, 0x5A, 0x58, 0x4B, 0x58, 0x4B, 0x57, 0x5B, 0x57, 0x5B, 0x57, 0x4C,
+  0x56, 0x5B, 0x57, 0x5B, 0x57, 0x4B, 0x58, 0x4A, 0x58, 0x66, 0x78, 0xF4,
+  0x7F, 0x3A, 0xF0, 0x86, 0x1C, 0xF2, 0xB6, 0x76, 0xA5, 0xA5, 0x94, 0xD4,
+  0x75, 0xF0, 0x37, 0x4F, 0x13, 0x65, 0xF2, 0x16, 0x5F, 0x31, 0x55, 0xF4,
+  0x15, 0x5F, 0x95, 0xFA, 0x5F, 0x95, 0xFA, 0x5F, 0xA5, 0xF9, 0x5F, 0xA5,
+  0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xA5, 0xFA, 0x5F, 0xB5,
+  0xF3, 0x16, 0x5F, 0x22, 0x75, 0xF0, 0x28, 0x5E, 0x2A, 0x5B, 0x3C, 0x67,
+  0x3F, 0x1D, 0xF4, 0x8E, 0x6F, 0x3F, 0x3F, 0x2F, 0x26, 0x66, 0xF0, 0x59,
+  0x5E, 0x5A, 0x5D, 0x4C, 0x5B, 0x5D, 0x5A, 0x5D, 0x5A, 0x5E, 0x4A, 0x4F,
+  0x05, 0x85, 0xF0, 0x58, 0x5F, 0x05, 0x84, 0xF1, 0x57, 0x5F, 0x15, 0x75,
+  0xF1, 0x57, 0x5F, 0x15, 0x74, 0xF1, 0x66, 0x5F, 0x15, 0x75, 0xF1, 0x57,
+  0x4F, 0x25, 0x74, 0xF1, 0x57, 0x5F, 0x15, 0x75, 0xF0, 0x58, 0x4F, 0x05,
+  0x85, 0xE6, 0x85, 0xD5, 0xA5, 0xC5, 0xB4, 0xB6, 0xB6, 0x77, 0xCF, 0x4C,
+  0xF2, 0xF1, 0x6F, 0x89, 0xF5, 0xA5, 0xA4, 0xA5, 0xC2, 0xA5, 0xC1, 0xB4,
+  0xD1, 0xA5, 0xD1, 0xA5, 0xF9, 0x4F, 0xA4, 0x91, 0xE5, 0x82, 0xE5, 0x81,
+  0xF0, 0x47, 0x3E, 0xF0, 0xEF, 0x0E, 0x56, 0x3F, 0x04, 0x82, 0xE5, 0x82,
+  0xE5, 0x81, 0xF0, 0x49, 0x1F, 0x04, 0xF9, 0x5F, 0x95, 0xF9, 0x4F, 0x11,
+  0x75, 0xF0, 0x27, 0x5E, 0x37, 0x4E, 0x38, 0x4D, 0x47, 0x69, 0x76, 0xF7,
+  0x5F, 0x95, 0x6F, 0x89, 0xF5, 0xA5, 0xA4, 0xA5, 0xC2, 0xA5, 0xC1, 0xB4,
+  0xD1, 0xA5, 0xD1, 0xA5, 0xD1, 0xA5, 0xF9, 0x4F, 0x95, 0x91, 0xE5, 0x82,
+  0xE4, 0x82, 0xE5, 0x73, 0xEF, 0x0E, 0xEF, 0x04, 0x82, 0xE5, 0x82, 0xE5,
+  0x82, 0xE5, 0x81, 0xF0, 0x49, 0x1E, 0x5F, 0x95, 0xF9, 0x4F, 0x95, 0xF9,
+  0x5F, 0x95, 0xF9, 0x4F, 0x95, 0xF8, 0x7F, 0x5C, 0xF2, 0xF0, 0x87, 0x1C,
+  0xE3, 0x2A, 0x67, 0x89, 0x5B, 0x68, 0x4E, 0x48, 0x4F, 0x13, 0x74, 0xF2,
+  0x36, 0x4F, 0x33, 0x55, 0xF4, 0x15, 0x5F, 0x51, 0x55, 0xFA, 0x5F, 0xB5,
+  0xFA, 0x5F, 0xB5, 0xFB, 0x5F, 0xA6, 0xFA, 0x5E, 0xF2, 0xF2, 0x72, 0x5F,
+  0x34, 0x45, 0xF3, 0x44, 0x5F, 0x25, 0x45, 0xF2, 0x45, 0x5F, 0x24, 0x64,
+  0xF2, 0x46, 0x5F, 0x04, 0x75, 0xF0, 0x48, 0x5E, 0x49, 0x4D, 0x5A, 0x5A,
+  0x5C, 0x67, 0x5F, 0x0E, 0xF4, 0x9D, 0x6D, 0x6B, 0x98, 0xA7, 0xC5, 0xD5,
+  0xD5, 0xD5, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xE4,
+  0xE4, 0xE4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xE4, 0xD5, 0xE4, 0xDF, 0x8D,
+  0xF7, 0xE4, 0xE4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xE4, 0xE4, 0xE4, 0xD5,
+  0xD5, 0xD5, 0xD5, 0xD4, 0xE4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xE4, 0xE4,
+  0xE4, 0xD5, 0xD5, 0xC7, 0xB7, 0x9B, 0x6D, 0x60, 0x7B, 0x98, 0xB5, 0xD5,
+  0xD5, 0xD4, 0xD5, 0xD5, 0xD4, 0xE4, 0xD5, 0xD5, 0xD4, 0xD5, 0xD5, 0xD5,
+  0xD4, 0xD5, 0xD5, 0xD4, 0xE4, 0xD5, 0xD5, 0xD4, 0xD5, 0xD5, 0xD4, 0xE4,
+  0xD5, 0xC7, 0x9B, 0x70, 0xBC, 0xE7, 0xF2, 0x5F, 0x35, 0xF3, 0x4F, 0x44,
+  0xF3, 0x5F, 0x34, 0xF4, 0x4F, 0x35, 0xF3, 0x5F, 0x34, 0xF4, 0x4F, 0x35,
+  0xF3, 0x5F, 0x34, 0xF3, 0x5F, 0x35, 0xF3, 0x4F, 0x44, 0xF3, 0x5F, 0x35,
+  0xF3, 0x4F, 0x44, 0xF3, 0x5F, 0x34, 0xB3, 0x54, 0xA5, 0x34, 0xB5, 0x34,
+  0xB5, 0x24, 0xD9, 0xF1, 0x5F, 0x00, 0x7C, 0x4A, 0x98, 0x96, 0xB5, 0xB4,
+  0xD5, 0xA4, 0xE4, 0xA4, 0xF0, 0x49, 0x3F, 0x15, 0x83, 0xF2, 0x57, 0x3F,
+  0x34, 0x63, 0xF5, 0x45, 0x3F, 0x55, 0x34, 0xF6, 0x52, 0x3F, 0x84, 0x23,
+  0xF9, 0x8F, 0x9A, 0xF8, 0x41, 0x5F, 0x84, 0x25, 0xF6, 0x52, 0x5F, 0x65,
+  0x35, 0xF5, 0x45, 0x4F, 0x54, 0x55, 0xF3, 0x56, 0x5F, 0x25, 0x65, 0xF2,
+  0x48, 0x5F, 0x05, 0x94, 0xF0, 0x59, 0x5E, 0x4B, 0x4E, 0x4B, 0x5C, 0x5B,
+  0x6A, 0x79, 0x87, 0xC4, 0xD4, 0x6D, 0xF2, 0x8F, 0x56, 0xF6, 0x5F, 0x75,
+  0xF7, 0x4F, 0x75, 0xF7, 0x5F, 0x74, 0xF8, 0x4F, 0x75, 0xF7, 0x5F, 0x74,
+  0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x74, 0xF7, 0x5F, 0x75, 0xF7, 0x4F, 0x84,
+  0xF7, 0x5F, 0x75, 0xF1, 0x15, 0x4F, 0x12, 0x45, 0xF1, 0x15, 0x5F, 0x02,
+  0x54, 0xF0, 0x35, 0x4E, 0x35, 0x6A, 0x64, 0xF8, 0x2F, 0x93, 0x79, 0xF3,
+  0x8A, 0x6F, 0x27, 0xD5, 0xF1, 0x7D, 0x6F, 0x16, 0xE6, 0xF0, 0x7E, 0x6E,
+  0x8E, 0x11, 0x4E, 0x21, 0x4E, 0x21, 0x4D, 0x22, 0x4E, 0x21, 0x5B, 0x31,
+  0x5E, 0x21, 0x5B, 0x22, 0x5E, 0x13, 0x4A, 0x23, 0x4E, 0x23, 0x49, 0x32,
+  0x5E, 0x23, 0x49, 0x23, 0x5E, 0x14, 0x48, 0x24, 0x4E, 0x24, 0x47, 0x34,
+  0x4E, 0x24, 0x47, 0x24, 0x5E, 0x24, 0x46, 0x25, 0x5E, 0x15, 0x54, 0x35,
+  0x4E, 0x25, 0x54, 0x26, 0x4E, 0x26, 0x43, 0x26, 0x5E, 0x26, 0x42, 0x36,
+  0x5D, 0x27, 0x42, 0x27, 0x4E, 0x27, 0x41, 0x27, 0x5E, 0x27, 0x77, 0x5D,
+  0x28, 0x68, 0x4E, 0x28, 0x59, 0x4E, 0x28, 0x58, 0x5D, 0x38, 0x49, 0x5D,
+  0x39, 0x29, 0x6C, 0x58, 0x28, 0x7A, 0x96, 0x17, 0xC7, 0x68, 0xC9, 0x87,
+  0xD6, 0xB5, 0xE3, 0xD5, 0xE3, 0xD6, 0xD2, 0xE6, 0xD2, 0xE1, 0x15, 0xB3,
+  0xD2, 0x15, 0xB2, 0xE2, 0x24, 0xB2, 0xE2, 0x25, 0x93, 0xD2, 0x44, 0x93,
+  0xD2, 0x45, 0x82, 0xE2, 0x45, 0x82, 0xE2, 0x54, 0x73, 0xD2, 0x65, 0x62,
+  0xE2, 0x74, 0x62, 0xE2, 0x75, 0x52, 0xD2, 0x94, 0x43, 0xD2, 0x94, 0x42,
+  0xE2, 0x95, 0x32, 0xE2, 0xA4, 0x23, 0xD2, 0xB5, 0x12, 0xE2, 0xC4, 0x12,
+  0xE2, 0xC4, 0x12, 0xD3, 0xC7, 0xD2, 0xE5, 0xE2, 0xE5, 0xD3, 0xF0, 0x4D,
+  0x3F, 0x03, 0xD5, 0xF0, 0x2B, 0x9D, 0x2F, 0xF3, 0x2B, 0xF1, 0x7F, 0x5C,
+  0xF1, 0x55, 0x5E, 0x49, 0x4C, 0x4B, 0x49, 0x5C, 0x57, 0x5E, 0x46, 0x5F,
+  0x04, 0x65, 0xF0, 0x54, 0x5F, 0x15, 0x35, 0xF2, 0x53, 0x5F, 0x25, 0x26,
+  0xF2, 0x52, 0x5F, 0x35, 0x16, 0xF2, 0x61, 0x5F, 0x36, 0x15, 0xF3, 0x51,
+  0x6F, 0x26, 0x16, 0xF2, 0x61, 0x5F, 0x35, 0x25, 0xF2, 0x62, 0x5F, 0x25,
+  0x35, 0xF2, 0x53, 0x5F, 0x15, 0x45, 0xF0, 0x56, 0x4F, 0x05, 0x64, 0xE5,
+  0x75, 0xC5, 0x94, 0xB5, 0xB4, 0x94, 0xE5, 0x55, 0xF1, 0xCF, 0x57, 0xF1,
+  0x6F, 0x2F, 0x0F, 0x2D, 0x56, 0x6C, 0x58, 0x5B, 0x58, 0x5B, 0x4A, 0x59,
+  0x5A, 0x59, 0x5A, 0x59, 0x4B, 0x59, 0x4B, 0x58, 0x5B, 0x49, 0x5A, 0x59,
+  0x4A, 0x59, 0x59, 0x69, 0x57, 0x6B, 0xF2, 0xC4, 0x19, 0xE5, 0xF9, 0x5F,
+  0x94, 0xFA, 0x4F, 0x95, 0xF9, 0x5F, 0x94, 0xF9, 0x5F, 0x95, 0xF9, 0x4F,
+  0xA4, 0xF9, 0x5F, 0x87, 0xF5, 0xBF, 0x30, 0xF1, 0x7F, 0x5C, 0xF2, 0x45,
+  0x5E, 0x49, 0x4C, 0x4B, 0x4A, 0x4C, 0x58, 0x4E, 0x47, 0x4F, 0x04, 0x65,
+  0xF0, 0x54, 0x5F, 0x15, 0x36, 0xF1, 0x53, 0x5F, 0x25, 0x26, 0xF2, 0x52,
+  0x5F, 0x35, 0x16, 0xF2, 0x61, 0x6F, 0x26, 0x15, 0xF3, 0x51, 0x6F, 0x35,
+  0x16, 0xF2, 0x61, 0x5F, 0x35, 0x25, 0xF3, 0x52, 0x5F, 0x25, 0x35, 0xF2,
+  0x53, 0x5F, 0x15, 0x45, 0xF1, 0x54, 0x5F, 0x05, 0x64, 0xE5, 0x75, 0xD4,
+  0x94, 0xC4, 0xA5, 0xA4, 0xC4, 0x84, 0xF1, 0x52, 0x5F, 0x58, 0xF8, 0x2F,
+  0xC2, 0xFB, 0x3F, 0x41, 0x68, 0xD2, 0x6D, 0x73, 0x6F, 0x85, 0x36, 0xEF,
+  0x58, 0x90, 0x6F, 0x2E, 0xF1, 0xD5, 0x56, 0xC5, 0x75, 0xB5, 0x85, 0xA4,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x94, 0xA5, 0x94, 0x95, 0x95, 0x95, 0x95,
+  0x85, 0xA4, 0x76, 0xAF, 0x1C, 0xDF, 0x04, 0x44, 0xF1, 0x44, 0x4F, 0x05,
+  0x45, 0xE5, 0x54, 0xE4, 0x64, 0xE4, 0x65, 0xC5, 0x74, 0xC5, 0x75, 0xB4,
+  0x94, 0xA5, 0x94, 0xA5, 0x95, 0x94, 0xB4, 0x94, 0xB4, 0x85, 0xB5, 0x67,
+  0xB5, 0x3B, 0x97, 0x10, 0xA6, 0x52, 0x8B, 0x13, 0x75, 0x55, 0x74, 0x84,
+  0x74, 0x93, 0x64, 0xA3, 0x64, 0xB2, 0x64, 0xB1, 0x74, 0xB1, 0x75, 0xF3,
+  0x5F, 0x45, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3, 0x6F, 0x36, 0xF3,
+  0x6F, 0x35, 0xF3, 0x6F, 0x35, 0x61, 0xC4, 0x61, 0xC4, 0x61, 0xC4, 0x52,
+  0xC4, 0x52, 0xC4, 0x53, 0xA4, 0x63, 0xA4, 0x64, 0x84, 0x76, 0x45, 0x81,
+  0x3A, 0x81, 0x66, 0xA0, 0x2F, 0xA2, 0xFA, 0x15, 0x65, 0x64, 0x13, 0x85,
+  0x73, 0x12, 0x95, 0x81, 0x21, 0x95, 0x91, 0x12, 0x95, 0x91, 0x11, 0xA5,
+  0x91, 0xC4, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x74, 0xF7, 0x5F, 0x75, 0xF7,
+  0x4F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x4F, 0x75, 0xF7, 0x5F, 0x74, 0xF8,
+  0x4F, 0x75, 0xF7, 0x5F, 0x74, 0xF7, 0x5F, 0x75, 0xF5, 0x8F, 0x1E, 0xD0,
+  0x1E, 0x79, 0x48, 0xC6, 0x66, 0xE3, 0x85, 0xF0, 0x38, 0x5F, 0x03, 0x85,
+  0xF0, 0x28, 0x5F, 0x12, 0x85, 0xF0, 0x38, 0x5F, 0x02, 0x95, 0xF0, 0x28,
+  0x5F, 0x12, 0x85, 0xF0, 0x38, 0x5F, 0x02, 0x85, 0xF1, 0x28, 0x5F, 0x12,
+  0x85, 0xF0, 0x29, 0x5F, 0x02, 0x85, 0xF1, 0x28, 0x5F, 0x02, 0x95, 0xF0,
+  0x29, 0x5F, 0x02, 0x85, 0xF1, 0x28, 0x5F, 0x02, 0x95, 0xF0, 0x29, 0x5E,
+  0x2A, 0x5E, 0x2A, 0x5D, 0x2C, 0x5B, 0x3D, 0x59, 0x3F, 0x06, 0x54, 0xF2,
+  0xCF, 0x68, 0xF2, 0x0B, 0x99, 0x27, 0xD5, 0x55, 0xF0, 0x45, 0x5F, 0x03,
+  0x65, 0xF0, 0x27, 0x5E, 0x37, 0x5E, 0x29, 0x4D, 0x2A, 0x5C, 0x2A, 0x5B,
+  0x2B, 0x5A, 0x3B, 0x5A, 0x2C, 0x59, 0x2E, 0x49, 0x2E, 0x48, 0x2F, 0x05,
+  0x63, 0xF0, 0x56, 0x2F, 0x15, 0x52, 0xF2, 0x55, 0x2F, 0x34, 0x42, 0xF4,
+  0x44, 0x2F, 0x44, 0x32, 0xF5, 0x51, 0x2F, 0x65, 0x12, 0xF6, 0x7F, 0x86,
+  0xF8, 0x5F, 0x94, 0xFA, 0x4F, 0xA3, 0xFB, 0x3F, 0xC1, 0xF5, 0x0B, 0x3B,
+  0x68, 0x27, 0x77, 0xA5, 0x45, 0x95, 0xC3, 0x55, 0x95, 0xC2, 0x65, 0xA4,
+  0xB3, 0x65, 0xA4, 0xB2, 0x84, 0xA4, 0xB2, 0x84, 0xA4, 0xA2, 0x94, 0x96,
+  0x92, 0x95, 0x86, 0x82, 0xA5, 0x77, 0x82, 0xA5, 0x71, 0x15, 0x72, 0xB5,
+  0x62, 0x15, 0x72, 0xB5, 0x62, 0x24, 0x62, 0xD4, 0x52, 0x34, 0x53, 0xD4,
+  0x52, 0x34, 0x52, 0xE4, 0x42, 0x44, 0x43, 0xE4, 0x42, 0x44, 0x42, 0xF0,
+  0x52, 0x25, 0x52, 0x3F, 0x05, 0x22, 0x55, 0x22, 0xF1, 0x51, 0x26, 0x51,
+  0x3F, 0x15, 0x12, 0x65, 0x12, 0xF2, 0x78, 0x7F, 0x36, 0x86, 0xF4, 0x59,
+  0x5F, 0x55, 0x95, 0xF5, 0x4A, 0x4F, 0x64, 0xA4, 0xF6, 0x3B, 0x3F, 0x73,
+  0xB3, 0xF7, 0x2C, 0x2F, 0x91, 0xC2, 0xF2, 0x5C, 0x5A, 0x78, 0x97, 0xA5,
+  0xB4, 0xC5, 0xB3, 0xE4, 0xA3, 0xF0, 0x58, 0x3F, 0x15, 0x82, 0xF3, 0x56,
+  0x2F, 0x45, 0x53, 0xF5, 0x44, 0x3F, 0x65, 0x23, 0xF7, 0x51, 0x3F, 0x97,
+  0xFA, 0x6F, 0xC4, 0xFD, 0x5F, 0xC5, 0xFB, 0x7F, 0x98, 0xF8, 0x32, 0x4F,
+  0x73, 0x35, 0xF6, 0x24, 0x5F, 0x52, 0x65, 0xF3, 0x27, 0x5F, 0x23, 0x84,
+  0xF1, 0x39, 0x5E, 0x3A, 0x5D, 0x3C, 0x5B, 0x4C, 0x59, 0x7A, 0x86, 0xA5,
+  0xD4, 0x1B, 0x59, 0x37, 0xA5, 0x55, 0xC3, 0x65, 0xB3, 0x84, 0xB2, 0x94,
+  0xA3, 0x95, 0x83, 0xA5, 0x82, 0xC4, 0x72, 0xD4, 0x62, 0xE5, 0x43, 0xF0,
+  0x43, 0x3F, 0x14, 0x32, 0xF2, 0x51, 0x2F, 0x37, 0xF5, 0x6F, 0x55, 0xF6,
+  0x4F, 0x74, 0xF6, 0x5F, 0x65, 0xF6, 0x4F, 0x65, 0xF6, 0x5F, 0x64, 0xF7,
+  0x4F, 0x65, 0xF6, 0x5F, 0x56, 0xF4, 0x7F, 0x1E, 0xC0, 0x6F, 0x86, 0xF7,
+  0x65, 0xC6, 0x63, 0xD6, 0x72, 0xD6, 0x72, 0xD6, 0x81, 0xE5, 0xF8, 0x6F,
+  0x76, 0xF7, 0x6F, 0x76, 0xF8, 0x5F, 0x86, 0xF7, 0x6F, 0x76, 0xF7, 0x6F,
+  0x85, 0xF8, 0x6F, 0x76, 0xF7, 0x6F, 0x76, 0xF8, 0x5F, 0x86, 0xF7, 0x6E,
+  0x17, 0x6E, 0x17, 0x6E, 0x27, 0x5F, 0x02, 0x66, 0xE3, 0x56, 0xC5, 0x5F,
+  0x95, 0xF9, 0x50, 0xA7, 0x94, 0xD3, 0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xE3,
+  0xD3, 0xE3, 0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xE3,
+  0xD3, 0xE3, 0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xE3,
+  0xD3, 0xE3, 0xE3, 0xE3, 0xD4, 0xD8, 0x90, 0x04, 0xE3, 0xE4, 0xE3, 0xE3,
+  0xE4, 0xE3, 0xE4, 0xE3, 0xE3, 0xE4, 0xE3, 0xE4, 0xE3, 0xE3, 0xF0, 0x3E,
+  0x3E, 0x4E, 0x3E, 0x4E, 0x3E, 0x3E, 0x4E, 0x3E, 0x4E, 0x3E, 0x3E, 0x4E,
+  0x3E, 0x4E, 0x3E, 0x3E, 0x40, 0x89, 0xC4, 0xE3, 0xE3, 0xD4, 0xD3, 0xE3,
+  0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xE3, 0xD4, 0xD3, 0xE3, 0xE3, 0xE3, 0xD3,
+  0xE3, 0xE3, 0xE3, 0xD3, 0xE3, 0xE3, 0xE3, 0xD4, 0xD3, 0xE3, 0xE3, 0xE3,
+  0xD3, 0xE3, 0xE3, 0xE3, 0xD4, 0xD3, 0xE3, 0x98, 0x90, 0x84, 0xF1, 0x4F,
+  0x06, 0xE6, 0xD3, 0x14, 0xC3, 0x23, 0xB3, 0x34, 0xA3, 0x43, 0x93, 0x54,
+  0x83, 0x63, 0x74, 0x64, 0x63, 0x83, 0x54, 0x84, 0x43, 0xA3, 0x34, 0xA4,
+  0x23, 0xC3, 0x14, 0xC4, 0x0F, 0xFF, 0x30, 0x12, 0x54, 0x45, 0x44, 0x54,
+  0x54, 0x53, 0x63, 0xB4, 0x23, 0xA2, 0x41, 0x13, 0x83, 0x64, 0x73, 0x74,
+  0x63, 0x83, 0x63, 0x93, 0x54, 0x93, 0x53, 0x93, 0x54, 0x93, 0x53, 0xA3,
+  0x44, 0x94, 0x44, 0x93, 0x44, 0x94, 0x44, 0x94, 0x44, 0x85, 0x44, 0x81,
+  0x13, 0x44, 0x71, 0x13, 0x45, 0x61, 0x23, 0x31, 0x15, 0x41, 0x33, 0x21,
+  0x38, 0x45, 0x56, 0x53, 0x50, 0x84, 0xD7, 0xF2, 0x4F, 0x24, 0xF2, 0x4F,
+  0x23, 0xF3, 0x3F, 0x24, 0xF2, 0x3F, 0x33, 0xF2, 0x4F, 0x24, 0x45, 0x83,
+  0x38, 0x73, 0x22, 0x35, 0x54, 0x11, 0x65, 0x44, 0x11, 0x74, 0x43, 0x11,
+  0x84, 0x44, 0x94, 0x35, 0x94, 0x34, 0xA4, 0x34, 0x94, 0x34, 0xA4, 0x34,
+  0xA4, 0x34, 0x94, 0x43, 0xA4, 0x34, 0x94, 0x44, 0x93, 0x53, 0x93, 0x63,
+  0x84, 0x54, 0x83, 0x64, 0x63, 0x94, 0x43, 0xC6, 0xC0, 0xA6, 0xA3, 0x42,
+  0x73, 0x63, 0x53, 0x64, 0x43, 0x73, 0x44, 0xD4, 0xE3, 0xE4, 0xE4, 0xE3,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xA1, 0x35, 0x82, 0x44, 0x72, 0x55,
+  0x52, 0x7A, 0xA6, 0x80, 0xF5, 0x3F, 0x27, 0xF5, 0x4F, 0x54, 0xF5, 0x3F,
+  0x63, 0xF6, 0x3F, 0x54, 0xF5, 0x3F, 0x63, 0xF5, 0x4E, 0x42, 0x4C, 0x33,
+  0x11, 0x3C, 0x25, 0x11, 0x3A, 0x37, 0x49, 0x47, 0x3A, 0x37, 0x49, 0x38,
+  0x48, 0x48, 0x47, 0x49, 0x38, 0x49, 0x37, 0x49, 0x47, 0x49, 0x47, 0x49,
+  0x37, 0x49, 0x47, 0x49, 0x47, 0x48, 0x57, 0x48, 0x48, 0x47, 0x11, 0x34,
+  0x13, 0x46, 0x12, 0x33, 0x15, 0x44, 0x13, 0x32, 0x16, 0x84, 0x59, 0x46,
+  0x38, 0xB5, 0xB3, 0x24, 0x73, 0x53, 0x63, 0x63, 0x53, 0x73, 0x44, 0x64,
+  0x34, 0x73, 0x43, 0x73, 0x44, 0x63, 0x45, 0x44, 0x54, 0x34, 0x78, 0x94,
+  0xE4, 0xE4, 0xE4, 0xE4, 0xB1, 0x24, 0xA2, 0x34, 0x82, 0x45, 0x52, 0x7A,
+  0xA5, 0x90, 0xF6, 0x5F, 0x52, 0x33, 0xF3, 0x24, 0x3F, 0x23, 0x43, 0xF2,
+  0x2F, 0x93, 0xF9, 0x2F, 0x93, 0xF9, 0x3F, 0x84, 0xF8, 0x3F, 0x93, 0xF4,
+  0xDE, 0xDF, 0x34, 0xF8, 0x3F, 0x93, 0xF8, 0x4F, 0x84, 0xF8, 0x4F, 0x83,
+  0xF9, 0x3F, 0x84, 0xF8, 0x4F, 0x83, 0xF9, 0x3F, 0x84, 0xF8, 0x4F, 0x83,
+  0xF9, 0x3F, 0x93, 0xF8, 0x4F, 0x83, 0xF9, 0x3F, 0x93, 0xF8, 0x3F, 0x93,
+  0xF9, 0x2F, 0x23, 0x42, 0xF3, 0x34, 0x2F, 0x33, 0x32, 0xF5, 0x5F, 0x60,
+  0xA6, 0xD3, 0x43, 0xA3, 0x65, 0x63, 0x75, 0x53, 0x83, 0x64, 0x83, 0x64,
+  0x83, 0x63, 0x93, 0x63, 0x84, 0x63, 0x83, 0x73, 0x74, 0x83, 0x54, 0xA2,
+  0x43, 0xD7, 0xD2, 0xF3, 0x2F, 0x33, 0xF3, 0x6F, 0x09, 0xDA, 0xA1, 0x38,
+  0x72, 0x76, 0x52, 0xA5, 0x32, 0xC4, 0x32, 0xD3, 0x32, 0xD3, 0x32, 0xD2,
+  0x43, 0xB3, 0x52, 0xA3, 0x73, 0x63, 0xB8, 0x90, 0x84, 0xD7, 0xF2, 0x4F,
+  0x24, 0xF2, 0x4F, 0x23, 0xF3, 0x3F, 0x24, 0xF2, 0x4F, 0x23, 0xF3, 0x3F,
+  0x24, 0x63, 0x84, 0x46, 0x73, 0x42, 0x23, 0x64, 0x31, 0x43, 0x64, 0x21,
+  0x53, 0x63, 0x21, 0x63, 0x63, 0x11, 0x63, 0x64, 0x11, 0x63, 0x65, 0x73,
+  0x64, 0x83, 0x64, 0x83, 0x54, 0x83, 0x64, 0x83, 0x63, 0x93, 0x63, 0x93,
+  0x54, 0x92, 0x41, 0x14, 0x83, 0x31, 0x23, 0x93, 0x22, 0x23, 0x93, 0x21,
+  0x24, 0x95, 0x34, 0x93, 0x50, 0x63, 0x65, 0x55, 0x55, 0x63, 0xFF, 0xFB,
+  0x33, 0x75, 0x55, 0x46, 0x46, 0x46, 0x37, 0x36, 0x46, 0x46, 0x37, 0x36,
+  0x46, 0x46, 0x37, 0x36, 0x46, 0x34, 0x12, 0x33, 0x13, 0x32, 0x14, 0x56,
+  0x36, 0xF0, 0x3F, 0x05, 0xE5, 0xE5, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0x53,
+  0xB8, 0xE4, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x03, 0xF0, 0x4F, 0x04, 0xF0,
+  0x4F, 0x03, 0xF1, 0x3F, 0x04, 0xF0, 0x4F, 0x03, 0xF1, 0x3F, 0x04, 0xF0,
+  0x3F, 0x13, 0xF1, 0x3F, 0x04, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x03, 0xF1,
+  0x3F, 0x13, 0x93, 0x33, 0xA3, 0x32, 0xB3, 0x22, 0xD5, 0xD0, 0x84, 0xD7,
+  0xF2, 0x4F, 0x24, 0xF2, 0x4F, 0x23, 0xF3, 0x3F, 0x24, 0xF2, 0x4F, 0x23,
+  0xF3, 0x3F, 0x24, 0xF2, 0x34, 0x95, 0x37, 0x46, 0x47, 0x28, 0x46, 0x29,
+  0x36, 0x2A, 0x34, 0x3A, 0x43, 0x2C, 0x42, 0x2D, 0x32, 0x2E, 0x8C, 0x9C,
+  0x42, 0x4B, 0x33, 0x4B, 0x34, 0x3A, 0x44, 0x49, 0x45, 0x39, 0x36, 0x44,
+  0x12, 0x47, 0x34, 0x12, 0x47, 0x42, 0x13, 0x48, 0x5F, 0x23, 0x50, 0x83,
+  0x47, 0x65, 0x73, 0x74, 0x74, 0x74, 0x73, 0x74, 0x74, 0x74, 0x73, 0x74,
+  0x74, 0x74, 0x73, 0x74, 0x74, 0x74, 0x73, 0x74, 0x74, 0x73, 0x83, 0x74,
+  0x74, 0x73, 0x83, 0x41, 0x24, 0x31, 0x34, 0x21, 0x43, 0x21, 0x55, 0x73,
+  0x70, 0x54, 0x63, 0x74, 0x37, 0x56, 0x56, 0x54, 0x42, 0x23, 0x41, 0x33,
+  0x54, 0x31, 0x43, 0x31, 0x43, 0x54, 0x21, 0x53, 0x21, 0x53, 0x53, 0x21,
+  0x53, 0x21, 0x54, 0x44, 0x11, 0x63, 0x11, 0x64, 0x44, 0x11, 0x63, 0x11,
+  0x64, 0x45, 0x74, 0x73, 0x54, 0x75, 0x64, 0x45, 0x74, 0x74, 0x44, 0x84,
+  0x74, 0x44, 0x83, 0x83, 0x53, 0x84, 0x74, 0x44, 0x84, 0x74, 0x44, 0x83,
+  0x84, 0x21, 0x13, 0x93, 0x83, 0x31, 0x13, 0x84, 0x73, 0x31, 0x14, 0x84,
+  0x73, 0x21, 0x24, 0x83, 0x85, 0x33, 0x93, 0x84, 0x40, 0x54, 0x64, 0x38,
+  0x47, 0x54, 0x41, 0x34, 0x54, 0x31, 0x44, 0x54, 0x21, 0x54, 0x53, 0x21,
+  0x63, 0x63, 0x21, 0x54, 0x54, 0x11, 0x64, 0x55, 0x74, 0x53, 0x11, 0x73,
+  0x55, 0x74, 0x54, 0x84, 0x54, 0x83, 0x63, 0x93, 0x54, 0x84, 0x54, 0x84,
+  0x31, 0x13, 0x93, 0x41, 0x13, 0x93, 0x31, 0x14, 0x93, 0x21, 0x24, 0x95,
+  0x33, 0xB3, 0x40, 0xB6, 0xC4, 0x34, 0x93, 0x64, 0x73, 0x83, 0x63, 0x94,
+  0x44, 0x94, 0x34, 0xA4, 0x24, 0xB4, 0x24, 0xB4, 0x14, 0xC4, 0x14, 0xB4,
+  0x15, 0xB4, 0x15, 0xB4, 0x14, 0xB4, 0x24, 0xB4, 0x24, 0xA4, 0x34, 0xA3,
+  0x44, 0x93, 0x63, 0x83, 0x74, 0x63, 0x94, 0x42, 0xD6, 0xB0, 0xA4, 0x46,
+  0x98, 0x38, 0xB5, 0x13, 0x26, 0xB3, 0x12, 0x56, 0x94, 0x11, 0x75, 0x95,
+  0x85, 0x94, 0x95, 0x94, 0x95, 0x84, 0xA5, 0x84, 0xA5, 0x84, 0x95, 0x93,
+  0xA5, 0x84, 0xA4, 0x94, 0x95, 0x93, 0xA4, 0xA3, 0x95, 0x94, 0x94, 0xA4,
+  0x84, 0xB4, 0x74, 0xC4, 0x63, 0xD5, 0x44, 0xE4, 0x15, 0xF2, 0x3F, 0x84,
+  0xF8, 0x4F, 0x84, 0xF8, 0x3F, 0x84, 0xF8, 0x4F, 0x76, 0xF4, 0xAF, 0x20,
+  0xB5, 0xE3, 0x32, 0x13, 0x83, 0x51, 0x13, 0x64, 0x74, 0x54, 0x83, 0x63,
+  0x93, 0x53, 0x94, 0x44, 0x94, 0x34, 0xA3, 0x44, 0xA3, 0x34, 0xA4, 0x34,
+  0xA3, 0x44, 0x94, 0x34, 0xA4, 0x34, 0x95, 0x34, 0x81, 0x13, 0x44, 0x71,
+  0x14, 0x44, 0x71, 0x14, 0x44, 0x61, 0x23, 0x64, 0x32, 0x33, 0x68, 0x34,
+  0x75, 0x54, 0xF2, 0x3F, 0x24, 0xF2, 0x4F, 0x23, 0xF2, 0x4F, 0x24, 0xF2,
+  0x4F, 0x15, 0xDB, 0x40, 0x54, 0x43, 0x27, 0x45, 0x44, 0x36, 0x44, 0x22,
+  0x14, 0x44, 0x12, 0xA3, 0x21, 0xB3, 0x11, 0xC3, 0x11, 0xB5, 0xC3, 0x11,
+  0xC4, 0xD4, 0xC4, 0xD4, 0xD4, 0xC4, 0xD4, 0xD4, 0xD3, 0xD4, 0xD4, 0xD0,
+  0x76, 0x31, 0x62, 0x45, 0x52, 0x73, 0x43, 0x72, 0x53, 0x81, 0x53, 0x81,
+  0x54, 0x71, 0x55, 0xD5, 0xC5, 0xD5, 0xD5, 0xD4, 0xE4, 0x51, 0x74, 0x51,
+  0x83, 0x51, 0x83, 0x52, 0x73, 0x43, 0x72, 0x53, 0x63, 0x54, 0x43, 0x61,
+  0x35, 0x80, 0x82, 0x92, 0x93, 0x84, 0x65, 0x6A, 0x1B, 0x44, 0x83, 0x93,
+  0x84, 0x84, 0x83, 0x93, 0x84, 0x84, 0x83, 0x93, 0x84, 0x84, 0x83, 0x41,
+  0x34, 0x31, 0x44, 0x31, 0x44, 0x21, 0x56, 0x74, 0x70, 0xF9, 0x48, 0x32,
+  0x78, 0x35, 0x47, 0x45, 0x38, 0x44, 0x47, 0x45, 0x47, 0x45, 0x47, 0x45,
+  0x37, 0x54, 0x47, 0x45, 0x46, 0x55, 0x46, 0x11, 0x35, 0x36, 0x64, 0x45,
+  0x21, 0x35, 0x45, 0x12, 0x35, 0x44, 0x22, 0x35, 0x34, 0x23, 0x33, 0x54,
+  0x13, 0x34, 0x44, 0x14, 0x33, 0x11, 0x32, 0x25, 0x32, 0x12, 0x66, 0x54,
+  0x39, 0x34, 0x33, 0x83, 0x16, 0x84, 0x34, 0x74, 0x34, 0x83, 0x34, 0x92,
+  0x43, 0x92, 0x43, 0x91, 0x53, 0x82, 0x53, 0x81, 0x63, 0x72, 0x64, 0x61,
+  0x74, 0x51, 0x93, 0x51, 0x93, 0x41, 0xA3, 0x31, 0xB3, 0x22, 0xB3, 0x12,
+  0xC5, 0xD4, 0xE3, 0xF0, 0x2F, 0x11, 0xC0, 0x42, 0xB1, 0x83, 0x17, 0xA1,
+  0x84, 0x34, 0x92, 0x84, 0x43, 0x84, 0x83, 0x43, 0x84, 0x92, 0x43, 0x75,
+  0x91, 0x53, 0x62, 0x13, 0x91, 0x53, 0x61, 0x23, 0x81, 0x64, 0x42, 0x23,
+  0x81, 0x73, 0x41, 0x33, 0x71, 0x83, 0x32, 0x33, 0x62, 0x83, 0x22, 0x43,
+  0x61, 0x93, 0x21, 0x53, 0x51, 0xA3, 0x12, 0x53, 0x42, 0xA5, 0x73, 0x22,
+  0xB5, 0x73, 0x21, 0xC4, 0x83, 0x11, 0xD4, 0x85, 0xD3, 0x94, 0xE3, 0x93,
+  0xF0, 0x2A, 0x2F, 0x11, 0xB1, 0xC0, 0x83, 0x73, 0x66, 0x65, 0x41, 0x34,
+  0x41, 0x22, 0x94, 0x31, 0xF0, 0x32, 0x1F, 0x13, 0x11, 0xF2, 0x5F, 0x24,
+  0xF4, 0x3F, 0x43, 0xF4, 0x3F, 0x44, 0xF2, 0x5F, 0x21, 0x13, 0xF1, 0x12,
+  0x3F, 0x02, 0x23, 0xF0, 0x13, 0x44, 0x18, 0x15, 0x34, 0x17, 0x16, 0x33,
+  0x13, 0x32, 0x16, 0x41, 0x14, 0x57, 0x55, 0x49, 0x36, 0x54, 0x92, 0x28,
+  0x84, 0x54, 0x84, 0x64, 0x83, 0x64, 0x92, 0x73, 0x92, 0x74, 0x81, 0x84,
+  0x81, 0x93, 0x71, 0xA4, 0x61, 0xA4, 0x52, 0xA4, 0x51, 0xC3, 0x42, 0xC3,
+  0x41, 0xD4, 0x21, 0xE4, 0x12, 0xF0, 0x31, 0x1F, 0x15, 0xF1, 0x4F, 0x23,
+  0xF3, 0x3F, 0x32, 0xF4, 0x1F, 0x42, 0xF4, 0x1F, 0x41, 0xF4, 0x1F, 0x41,
+  0xE3, 0x21, 0xF0, 0x5F, 0x14, 0xF2, 0x4D, 0x4C, 0x51, 0x91, 0x52, 0x82,
+  0x51, 0x82, 0xE2, 0xE2, 0xF0, 0x2E, 0x2E, 0x2E, 0x2F, 0x01, 0xF0, 0x2E,
+  0x2E, 0x2E, 0x2F, 0x02, 0xE4, 0xC7, 0x99, 0x43, 0x11, 0x36, 0x33, 0x74,
+  0x33, 0x93, 0x31, 0xC4, 0x30, 0xC4, 0xB4, 0xC4, 0xD3, 0xD4, 0xD4, 0xD3,
+  0xE3, 0xD4, 0xD4, 0xD3, 0xD4, 0xD4, 0xD3, 0xE3, 0xD4, 0xD4, 0xC4, 0xD4,
+  0xB5, 0xB5, 0xE1, 0xF1, 0x2F, 0x03, 0xE3, 0xE3, 0xD4, 0xD4, 0xD3, 0xE3,
+  0xD4, 0xD4, 0xD3, 0xE3, 0xD4, 0xD4, 0xD3, 0xE3, 0xF0, 0x2F, 0x13, 0xC0,
+  0x0F, 0xFF, 0xFF, 0xF9, 0xB2, 0xF0, 0x3E, 0x2E, 0x3D, 0x3D, 0x3D, 0x3C,
+  0x4C, 0x4C, 0x3D, 0x3C, 0x4C, 0x4C, 0x3D, 0x3C, 0x4C, 0x4C, 0x3D, 0x3E,
+  0x2F, 0x01, 0xE3, 0xB6, 0xA4, 0xB4, 0xC3, 0xC4, 0xC4, 0xC3, 0xD3, 0xC4,
+  0xC3, 0xD3, 0xC4, 0xC4, 0xC3, 0xD3, 0xC4, 0xC3, 0xC3, 0xA5, 0xB0, 0x36,
+  0xF0, 0x97, 0x23, 0xC4, 0x41, 0x44, 0xD2, 0x27, 0xAF, 0x05, 0x40 };
 
 const GFXglyph FreeSerifItalic24pt7bGlyphs[] PROGMEM = {
   {     0,   0,   0,  12,    0,    1 },   // 0x20 ' '
   {     0,  12,  32,  16,    2,  -30 },   // 0x21 '!'
-  {    48,  14,  12,  16,    6,  -31 },   // 0x22 '"'
-  {    69,  25,  31,  23,    0,  -30 },   // 0x23 '#'
-  {   166,  21,  38,  24,    2,  -33 },   // 0x24 '$'
-  {   266,  33,  32,  39,    4,  -30 },   // 0x25 '%'
-  {   398,  30,  33,  37,    4,  -31 },   // 0x26 '&'
-  {   522,   5,  12,   9,    6,  -31 },   // 0x27 '''
-  {   530,  13,  39,  16,    2,  -30 },   // 0x28 '('
-  {   594,  13,  39,  16,    0,  -30 },   // 0x29 ')'
-  {   658,  16,  20,  23,    7,  -31 },   // 0x2A '*'
-  {   698,  23,  23,  32,    4,  -22 },   // 0x2B '+'
-  {   765,   7,  11,  12,   -1,   -4 },   // 0x2C ','
-  {   775,  11,   3,  16,    2,  -11 },   // 0x2D '-'
-  {   780,   5,   5,  12,    1,   -3 },   // 0x2E '.'
-  {   784,  21,  33,  14,    0,  -31 },   // 0x2F '/'
-  {   871,  21,  31,  23,    2,  -30 },   // 0x30 '0'
-  {   953,  17,  32,  23,    2,  -31 },   // 0x31 '1'
-  {  1021,  21,  31,  24,    0,  -30 },   // 0x32 '2'
-  {  1103,  22,  32,  23,    0,  -31 },   // 0x33 '3'
-  {  1191,  22,  32,  23,    0,  -31 },   // 0x34 '4'
-  {  1279,  22,  32,  24,    0,  -31 },   // 0x35 '5'
-  {  1367,  23,  32,  23,    1,  -31 },   // 0x36 '6'
-  {  1459,  21,  32,  23,    4,  -31 },   // 0x37 '7'
-  {  1543,  22,  32,  23,    1,  -31 },   // 0x38 '8'
-  {  1631,  22,  33,  23,    1,  -31 },   // 0x39 '9'
-  {  1722,   9,  22,  12,    2,  -20 },   // 0x3A ':'
-  {  1747,  11,  27,  12,    1,  -20 },   // 0x3B ';'
-  {  1785,  23,  25,  27,    3,  -24 },   // 0x3C '<'
-  {  1857,  24,  12,  31,    4,  -17 },   // 0x3D '='
-  {  1893,  24,  25,  27,    3,  -24 },   // 0x3E '>'
-  {  1968,  16,  33,  21,    6,  -31 },   // 0x3F '?'
-  {  2034,  33,  33,  37,    3,  -31 },   // 0x40 '@'
-  {  2171,  29,  31,  31,    0,  -30 },   // 0x41 'A'
-  {  2284,  28,  31,  28,    0,  -30 },   // 0x42 'B'
-  {  2393,  30,  33,  29,    2,  -31 },   // 0x43 'C'
-  {  2517,  33,  31,  33,    0,  -30 },   // 0x44 'D'
-  {  2645,  29,  31,  27,    0,  -30 },   // 0x45 'E'
-  {  2758,  29,  31,  27,    0,  -30 },   // 0x46 'F'
-  {  2871,  31,  33,  32,    2,  -31 },   // 0x47 'G'
-  {  2999,  36,  31,  33,    0,  -30 },   // 0x48 'H'
-  {  3139,  18,  31,  15,    0,  -30 },   // 0x49 'I'
-  {  3209,  23,  32,  20,    0,  -30 },   // 0x4A 'J'
-  {  3301,  33,  31,  30,    0,  -30 },   // 0x4B 'K'
-  {  3429,  27,  31,  27,    0,  -30 },   // 0x4C 'L'
-  {  3534,  42,  31,  39,    0,  -30 },   // 0x4D 'M'
-  {  3697,  35,  32,  32,    0,  -30 },   // 0x4E 'N'
-  {  3837,  30,  33,  31,    2,  -31 },   // 0x4F 'O'
-  {  3961,  29,  31,  27,    0,  -30 },   // 0x50 'P'
-  {  4074,  30,  41,  31,    2,  -31 },   // 0x51 'Q'
-  {  4228,  28,  31,  29,    0,  -30 },   // 0x52 'R'
-  {  4337,  23,  33,  21,    0,  -31 },   // 0x53 'S'
-  {  4432,  27,  31,  28,    4,  -30 },   // 0x54 'T'
-  {  4537,  31,  32,  33,    5,  -30 },   // 0x55 'U'
-  {  4661,  29,  32,  31,    6,  -30 },   // 0x56 'V'
-  {  4777,  39,  32,  42,    6,  -30 },   // 0x57 'W'
-  {  4933,  32,  31,  31,    0,  -30 },   // 0x58 'X'
-  {  5057,  26,  31,  28,    5,  -30 },   // 0x59 'Y'
-  {  5158,  29,  31,  26,    0,  -30 },   // 0x5A 'Z'
-  {  5271,  17,  39,  18,    1,  -31 },   // 0x5B '['
-  {  5354,  17,  33,  23,    5,  -31 },   // 0x5C '\'
-  {  5425,  17,  39,  18,    1,  -31 },   // 0x5D ']'
-  {  5508,  20,  17,  20,    0,  -31 },   // 0x5E '^'
-  {  5551,  24,   2,  23,    0,    5 },   // 0x5F '_'
-  {  5557,   8,   8,  12,    6,  -31 },   // 0x60 '`'
-  {  5565,  21,  21,  23,    1,  -20 },   // 0x61 'a'
-  {  5621,  21,  33,  22,    1,  -31 },   // 0x62 'b'
-  {  5708,  18,  22,  19,    1,  -20 },   // 0x63 'c'
-  {  5758,  24,  33,  23,    1,  -31 },   // 0x64 'd'
-  {  5857,  18,  22,  19,    1,  -20 },   // 0x65 'e'
-  {  5907,  27,  42,  20,   -4,  -31 },   // 0x66 'f'
-  {  6049,  21,  31,  21,   -1,  -20 },   // 0x67 'g'
-  {  6131,  21,  32,  23,    1,  -31 },   // 0x68 'h'
-  {  6215,  10,  32,  12,    2,  -30 },   // 0x69 'i'
-  {  6255,  19,  41,  13,   -3,  -30 },   // 0x6A 'j'
-  {  6353,  21,  33,  21,    1,  -31 },   // 0x6B 'k'
-  {  6440,  11,  33,  12,    2,  -31 },   // 0x6C 'l'
-  {  6486,  31,  21,  34,    1,  -20 },   // 0x6D 'm'
-  {  6568,  21,  21,  23,    1,  -20 },   // 0x6E 'n'
-  {  6624,  21,  22,  22,    1,  -20 },   // 0x6F 'o'
-  {  6682,  27,  31,  22,   -4,  -20 },   // 0x70 'p'
-  {  6787,  21,  31,  23,    1,  -20 },   // 0x71 'q'
-  {  6869,  17,  21,  17,    1,  -20 },   // 0x72 'r'
-  {  6914,  17,  22,  16,    0,  -20 },   // 0x73 's'
-  {  6961,  12,  26,  11,    1,  -24 },   // 0x74 't'
-  {  7000,  20,  22,  23,    1,  -20 },   // 0x75 'u'
-  {  7055,  18,  22,  21,    3,  -20 },   // 0x76 'v'
-  {  7105,  30,  22,  32,    2,  -20 },   // 0x77 'w'
-  {  7188,  22,  22,  20,   -1,  -20 },   // 0x78 'x'
-  {  7249,  21,  31,  22,    1,  -20 },   // 0x79 'y'
-  {  7331,  17,  24,  18,    0,  -19 },   // 0x7A 'z'
-  {  7382,  17,  40,  19,    2,  -31 },   // 0x7B '{'
-  {  7467,   3,  33,  13,    5,  -31 },   // 0x7C '|'
-  {  7480,  16,  41,  19,    0,  -32 },   // 0x7D '}'
-  {  7562,  22,   6,  25,    2,  -14 } }; // 0x7E '~'
+  {    30,  14,  12,  16,    6,  -31 },   // 0x22 '"'
+  {    55,  25,  31,  23,    0,  -30 },   // 0x23 '#'
+  {   116,  21,  38,  24,    2,  -33 },   // 0x24 '$'
+  {   198,  33,  32,  39,    4,  -30 },   // 0x25 '%'
+  {   295,  30,  33,  37,    4,  -31 },   // 0x26 '&'
+  {   374,   5,  12,   9,    6,  -31 },   // 0x27 '''
+  {   387,  13,  39,  16,    2,  -30 },   // 0x28 '('
+  {   427,  13,  39,  16,    0,  -30 },   // 0x29 ')'
+  {   467,  16,  20,  23,    7,  -31 },   // 0x2A '*'
+  {   502,  23,  23,  32,    4,  -22 },   // 0x2B '+'
+  {   535,   7,  11,  12,   -1,   -4 },   // 0x2C ','
+  {   547,  11,   3,  16,    2,  -11 },   // 0x2D '-'
+  {   550,   5,   5,  12,    1,   -3 },   // 0x2E '.'
+  {   554,  21,  33,  14,    0,  -31 },   // 0x2F '/'
+  {   605,  21,  31,  23,    2,  -30 },   // 0x30 '0'
+  {   665,  17,  32,  23,    2,  -31 },   // 0x31 '1'
+  {   698,  21,  31,  24,    0,  -30 },   // 0x32 '2'
+  {   748,  22,  32,  23,    0,  -31 },   // 0x33 '3'
+  {   797,  22,  32,  23,    0,  -31 },   // 0x34 '4'
+  {   854,  22,  32,  24,    0,  -31 },   // 0x35 '5'
+  {   900,  23,  32,  23,    1,  -31 },   // 0x36 '6'
+  {   959,  21,  32,  23,    4,  -31 },   // 0x37 '7'
+  {  1010,  22,  32,  23,    1,  -31 },   // 0x38 '8'
+  {  1070,  22,  33,  23,    1,  -31 },   // 0x39 '9'
+  {  1130,   9,  22,  12,    2,  -20 },   // 0x3A ':'
+  {  1144,  11,  27,  12,    1,  -20 },   // 0x3B ';'
+  {  1165,  23,  25,  27,    3,  -24 },   // 0x3C '<'
+  {  1198,  24,  12,  31,    4,  -17 },   // 0x3D '='
+  {  1209,  24,  25,  27,    3,  -24 },   // 0x3E '>'
+  {  1244,  16,  33,  21,    6,  -31 },   // 0x3F '?'
+  {  1283,  33,  33,  37,    3,  -31 },   // 0x40 '@'
+  {  1379,  29,  31,  31,    0,  -30 },   // 0x41 'A'
+  {  1443,  28,  31,  28,    0,  -30 },   // 0x42 'B'
+  {  1502,  30,  33,  29,    2,  -31 },   // 0x43 'C'
+  {  1564,  33,  31,  33,    0,  -30 },   // 0x44 'D'
+  {  1634,  29,  31,  27,    0,  -30 },   // 0x45 'E'
+  {  1694,  29,  31,  27,    0,  -30 },   // 0x46 'F'
+  {  1749,  31,  33,  32,    2,  -31 },   // 0x47 'G'
+  {  1818,  36,  31,  33,    0,  -30 },   // 0x48 'H'
+  {  1880,  18,  31,  15,    0,  -30 },   // 0x49 'I'
+  {  1912,  23,  32,  20,    0,  -30 },   // 0x4A 'J'
+  {  1962,  33,  31,  30,    0,  -30 },   // 0x4B 'K'
+  {  2033,  27,  31,  27,    0,  -30 },   // 0x4C 'L'
+  {  2086,  42,  31,  39,    0,  -30 },   // 0x4D 'M'
+  {  2193,  35,  32,  32,    0,  -30 },   // 0x4E 'N'
+  {  2277,  30,  33,  31,    2,  -31 },   // 0x4F 'O'
+  {  2352,  29,  31,  27,    0,  -30 },   // 0x50 'P'
+  {  2407,  30,  41,  31,    2,  -31 },   // 0x51 'Q'
+  {  2498,  28,  31,  29,    0,  -30 },   // 0x52 'R'
+  {  2560,  23,  33,  21,    0,  -31 },   // 0x53 'S'
+  {  2620,  27,  31,  28,    4,  -30 },   // 0x54 'T'
+  {  2676,  31,  32,  33,    5,  -30 },   // 0x55 'U'
+  {  2751,  29,  32,  31,    6,  -30 },   // 0x56 'V'
+  {  2818,  39,  32,  42,    6,  -30 },   // 0x57 'W'
+  {  2923,  32,  31,  31,    0,  -30 },   // 0x58 'X'
+  {  2989,  26,  31,  28,    5,  -30 },   // 0x59 'Y'
+  {  3045,  29,  31,  26,    0,  -30 },   // 0x5A 'Z'
+  {  3099,  17,  39,  18,    1,  -31 },   // 0x5B '['
+  {  3139,  17,  33,  23,    5,  -31 },   // 0x5C '\'
+  {  3173,  17,  39,  18,    1,  -31 },   // 0x5D ']'
+  {  3213,  20,  17,  20,    0,  -31 },   // 0x5E '^'
+  {  3244,  24,   2,  23,    0,    5 },   // 0x5F '_'
+  {  3247,   8,   8,  12,    6,  -31 },   // 0x60 '`'
+  {  3255,  21,  21,  23,    1,  -20 },   // 0x61 'a'
+  {  3305,  21,  33,  22,    1,  -31 },   // 0x62 'b'
+  {  3369,  18,  22,  19,    1,  -20 },   // 0x63 'c'
+  {  3400,  24,  33,  23,    1,  -31 },   // 0x64 'd'
+  {  3469,  18,  22,  19,    1,  -20 },   // 0x65 'e'
+  {  3506,  27,  42,  20,   -4,  -31 },   // 0x66 'f'
+  {  3576,  21,  31,  21,   -1,  -20 },   // 0x67 'g'
+  {  3632,  21,  32,  23,    1,  -31 },   // 0x68 'h'
+  {  3701,  10,  32,  12,    2,  -30 },   // 0x69 'i'
+  {  3733,  19,  41,  13,   -3,  -30 },   // 0x6A 'j'
+  {  3790,  21,  33,  21,    1,  -31 },   // 0x6B 'k'
+  {  3851,  11,  33,  12,    2,  -31 },   // 0x6C 'l'
+  {  3889,  31,  21,  34,    1,  -20 },   // 0x6D 'm'
+  {  3969,  21,  21,  23,    1,  -20 },   // 0x6E 'n'
+  {  4023,  21,  22,  22,    1,  -20 },   // 0x6F 'o'
+  {  4066,  27,  31,  22,   -4,  -20 },   // 0x70 'p'
+  {  4128,  21,  31,  23,    1,  -20 },   // 0x71 'q'
+  {  4192,  17,  21,  17,    1,  -20 },   // 0x72 'r'
+  {  4224,  17,  22,  16,    0,  -20 },   // 0x73 's'
+  {  4262,  12,  26,  11,    1,  -24 },   // 0x74 't'
+  {  4293,  20,  22,  23,    1,  -20 },   // 0x75 'u'
+  {  4346,  18,  22,  21,    3,  -20 },   // 0x76 'v'
+  {  4387,  30,  22,  32,    2,  -20 },   // 0x77 'w'
+  {  4458,  22,  22,  20,   -1,  -20 },   // 0x78 'x'
+  {  4509,  21,  31,  22,    1,  -20 },   // 0x79 'y'
+  {  4566,  17,  24,  18,    0,  -19 },   // 0x7A 'z'
+  {  4601,  17,  40,  19,    2,  -31 },   // 0x7B '{'
+  {  4644,   3,  33,  13,    5,  -31 },   // 0x7C '|'
+  {  4648,  16,  41,  19,    0,  -32 },   // 0x7D '}'
+  {  4691,  22,   6,  25,    2,  -14 } }; // 0x7E '~'
 
 const GFXfont FreeSerifItalic24pt7b PROGMEM = {
   (uint8_t  *)FreeSerifItalic24pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic24pt7bGlyphs,
-  0x20, 0x7E, 56 };
+  0x20, 0x7E, 56, 1,
+  NULL, 0, 1 };
 
-// Approx. 8251 bytes
+// Approx. 5375 bytes
@@ -0,0 +1,233 @@
+#pragma once
+#include <Arduino.h>
+#include "color.h"
+
+namespace ssd1351 {
+
+// Blend modes, used by the blending variants of fillRect, drawFastHLine and drawBitmap as well as blendBitmap.
+static const uint8_t BLEND_ALPHA = 0; // src over dst, weighted by alpha
+static const uint8_t BLEND_ADD = 1; // Per channel addition, saturating at full brightness
+static const uint8_t BLEND_MULTIPLY = 2; // Per channel multiplication, white keeps dst and black gives black
+static const uint8_t BLEND_XOR = 3; // Bitwise xor of the encoded colors, drawing the same thing twice restores dst
+
+// Alpha blending of src over dst.
+// alpha goes from 0 (dst is kept) to 255 (src replaces dst). None of these divide,
+// alpha is reduced to the precision of the color format and applied with a multiply and a shift.
+
+inline LowColor blend(LowColor dst, LowColor src, uint8_t alpha) {
+	// Spread the 5/6/5 channels of a color into a 32 bit word (gggggg00000rrrrr000000bbbbb) so all three
+	// channels can be blended with a single multiplication. alpha is reduced to 5 bits (0-32).
+	uint32_t a = (alpha + 4) >> 3;
+	uint32_t bg = (dst | (dst << 16)) & 0x07E0F81F;
+	uint32_t fg = (src | (src << 16)) & 0x07E0F81F;
+	uint32_t result = ((((fg - bg) * a) >> 5) + bg) & 0x07E0F81F;
+	return (LowColor)((result >> 16) | result);
+}
+
+inline HighColor blend(const HighColor &dst, const HighColor &src, uint8_t alpha) {
+	// Scaling alpha to 0-256 turns the division by 255 into a shift.
+	int16_t a = alpha + (alpha >> 7);
+	return HighColor(
+		dst.r + (((src.r - dst.r) * a) >> 8),
+		dst.g + (((src.g - dst.g) * a) >> 8),
+		dst.b + (((src.b - dst.b) * a) >> 8)
+	);
+}
+
+inline IndexedColor blend(IndexedColor dst, IndexedColor src, uint8_t alpha) {
+	// Same idea as for LowColor: RRRGGGBB is spread into 00000RRR 00000GGG 000000BB, which leaves
+	// enough room between channels to blend them in one go with a 5 bit alpha.
+	uint32_t a = (alpha + 4) >> 3;
+	uint32_t bg = ((dst & 0xE0) << 11) | ((dst & 0x1C) << 6) | (dst & 0x03);
+	uint32_t fg = ((src & 0xE0) << 11) | ((src & 0x1C) << 6) | (src & 0x03);
+	uint32_t result = ((((fg - bg) * a) >> 5) + bg) & 0x00070703;
+	return (IndexedColor)(((result >> 11) & 0xE0) | ((result >> 6) & 0x1C) | (result & 0x03));
+}
+
+// Two LowColor pixels at a time.
+// A 32 bit word holding two 5/6/5 pixels is split into two words that each hold three channels with at
+// least five free bits above every channel: (word & 0x07E0F81F) has red and blue of the first and green
+// of the second pixel, ((word >> 5) & 0x07C0F83F) has green of the first and blue and red of the second pixel.
+// Each of these can be blended or added with a single operation, so two pixels cost two multiplications.
+
+static const uint32_t PAIR565_MASK0 = 0x07E0F81F;
+static const uint32_t PAIR565_MASK1 = 0x07C0F83F;
+
+inline uint32_t __attribute__((always_inline)) blendPair565(uint32_t dst, uint32_t src, uint32_t alpha5) {
+	uint32_t d0 = dst & PAIR565_MASK0;
+	uint32_t s0 = src & PAIR565_MASK0;
+	uint32_t d1 = (dst >> 5) & PAIR565_MASK1;
+	uint32_t s1 = (src >> 5) & PAIR565_MASK1;
+	d0 = ((((s0 - d0) * alpha5) >> 5) + d0) & PAIR565_MASK0;
+	d1 = ((((s1 - d1) * alpha5) >> 5) + d1) & PAIR565_MASK1;
+	return d0 | (d1 << 5);
+}
+
+inline uint32_t __attribute__((always_inline)) addPair565(uint32_t dst, uint32_t src) {
+	// Channels that overflow set the bit right above them, which gets turned into a saturated channel.
+	uint32_t sum0 = (dst & PAIR565_MASK0) + (src & PAIR565_MASK0);
+	uint32_t sum1 = ((dst >> 5) & PAIR565_MASK1) + ((src >> 5) & PAIR565_MASK1);
+	uint32_t overflow5 = sum0 & 0x00010020;
+	uint32_t overflow6 = sum0 & 0x08000000;
+	sum0 |= (overflow5 - (overflow5 >> 5)) | (overflow6 - (overflow6 >> 6));
+	overflow5 = sum1 & 0x08010000;
+	overflow6 = sum1 & 0x00000040;
+	sum1 |= (overflow5 - (overflow5 >> 5)) | (overflow6 - (overflow6 >> 6));
+	return (sum0 & PAIR565_MASK0) | ((sum1 & PAIR565_MASK1) << 5);
+}
+
+inline LowColor __attribute__((always_inline)) multiply565(LowColor dst, LowColor src) {
+	// Multiplying by (src + 1) and shifting by the channel width keeps dst unchanged for a full channel.
+	uint16_t r = ((dst >> 11) * ((src >> 11) + 1)) >> 5;
+	uint16_t g = (((dst >> 5) & 0x3F) * (((src >> 5) & 0x3F) + 1)) >> 6;
+	uint16_t b = ((dst & 0x1F) * ((src & 0x1F) + 1)) >> 5;
+	return (r << 11) | (g << 5) | b;
+}
+
+inline uint32_t __attribute__((always_inline)) multiplyPair565(uint32_t dst, uint32_t src) {
+	return multiply565(dst, src) | ((uint32_t)multiply565(dst >> 16, src >> 16) << 16);
+}
+
+// Single pixel versions of the other blend modes
+
+inline LowColor blendAdd(LowColor dst, LowColor src) {
+	return addPair565(dst, src);
+}
+
+inline HighColor blendAdd(const HighColor &dst, const HighColor &src) {
+	return HighColor(
+		dst.r + src.r > 255 ? 255 : dst.r + src.r,
+		dst.g + src.g > 255 ? 255 : dst.g + src.g,
+		dst.b + src.b > 255 ? 255 : dst.b + src.b
+	);
+}
+
+inline IndexedColor blendAdd(IndexedColor dst, IndexedColor src) {
+	uint32_t sum = (((dst & 0xE0) << 11) | ((dst & 0x1C) << 6) | (dst & 0x03))
+		+ (((src & 0xE0) << 11) | ((src & 0x1C) << 6) | (src & 0x03));
+	uint32_t overflow3 = sum & 0x00080800;
+	uint32_t overflow2 = sum & 0x00000004;
+	sum |= (overflow3 - (overflow3 >> 3)) | (overflow2 - (overflow2 >> 2));
+	return (IndexedColor)(((sum >> 11) & 0xE0) | ((sum >> 6) & 0x1C) | (sum & 0x03));
+}
+
+inline LowColor blendMultiply(LowColor dst, LowColor src) {
+	return multiply565(dst, src);
+}
+
+inline HighColor blendMultiply(const HighColor &dst, const HighColor &src) {
+	return HighColor(
+		(dst.r * (src.r + 1)) >> 8,
+		(dst.g * (src.g + 1)) >> 8,
+		(dst.b * (src.b + 1)) >> 8
+	);
+}
+
+inline IndexedColor blendMultiply(IndexedColor dst, IndexedColor src) {
+	uint8_t r = ((dst >> 5) * ((src >> 5) + 1)) >> 3;
+	uint8_t g = (((dst >> 2) & 0x07) * (((src >> 2) & 0x07) + 1)) >> 3;
+	uint8_t b = ((dst & 0x03) * ((src & 0x03) + 1)) >> 2;
+	return (r << 5) | (g << 2) | b;
+}
+
+inline LowColor blendXor(LowColor dst, LowColor src) {
+	return dst ^ src;
+}
+
+inline HighColor blendXor(const HighColor &dst, const HighColor &src) {
+	return HighColor(dst.r ^ src.r, dst.g ^ src.g, dst.b ^ src.b);
+}
+
+inline IndexedColor blendXor(IndexedColor dst, IndexedColor src) {
+	return dst ^ src;
+}
+
+template <typename C>
+inline C blend(const C &dst, const C &src, uint8_t mode, uint8_t alpha) {
+	switch (mode) {
+		case BLEND_ADD:
+			return blendAdd(dst, src);
+		case BLEND_MULTIPLY:
+			return blendMultiply(dst, src);
+		case BLEND_XOR:
+			return blendXor(dst, src);
+		default:
+			return blend(dst, src, alpha);
+	}
+}
+
+// Span kernels: blend count pixels from src into dst. With src_step 0, src is a single color used for
+// the whole span, otherwise src is a row of pixels. The blend mode is resolved once per span.
+// alpha is only used by BLEND_ALPHA.
+
+template <typename C, typename Op>
+inline void __attribute__((always_inline)) blendEach(C *dst, const C *src, uint8_t src_step, uint16_t count, Op op) {
+	while (count--) {
+		*dst = op(*dst, *src);
+		dst++;
+		src += src_step;
+	}
+}
+
+template <typename C>
+inline void blendSpan(C *dst, const C *src, uint8_t src_step, uint16_t count, uint8_t mode, uint8_t alpha = 255) {
+	switch (mode) {
+		case BLEND_ALPHA:
+			blendEach(dst, src, src_step, count, [alpha](const C &d, const C &s) { return blend(d, s, alpha); });
+			break;
+		case BLEND_ADD:
+			blendEach(dst, src, src_step, count, [](const C &d, const C &s) { return blendAdd(d, s); });
+			break;
+		case BLEND_MULTIPLY:
+			blendEach(dst, src, src_step, count, [](const C &d, const C &s) { return blendMultiply(d, s); });
+			break;
+		case BLEND_XOR:
+			blendEach(dst, src, src_step, count, [](const C &d, const C &s) { return blendXor(d, s); });
+			break;
+	}
+}
+
+template <typename Op>
+inline void __attribute__((always_inline)) blendPairs565(LowColor *dst, const LowColor *src, uint8_t src_step, uint16_t count, Op op) {
+	// Works on two pixels per 32 bit load and store. memcpy keeps this legal for any alignment,
+	// and compiles down to plain word loads and stores.
+	uint32_t d, s;
+	if (!src_step) {
+		s = *src | ((uint32_t)*src << 16);
+		for (; count >= 2; count -= 2, dst += 2) {
+			memcpy(&d, dst, 4);
+			d = op(d, s);
+			memcpy(dst, &d, 4);
+		}
+	} else {
+		for (; count >= 2; count -= 2, dst += 2, src += 2) {
+			memcpy(&d, dst, 4);
+			memcpy(&s, src, 4);
+			d = op(d, s);
+			memcpy(dst, &d, 4);
+		}
+	}
+	if (count) {
+		*dst = op(*dst, *src);
+	}
+}
+
+inline void blendSpan(LowColor *dst, const LowColor *src, uint8_t src_step, uint16_t count, uint8_t mode, uint8_t alpha = 255) {
+	uint32_t alpha5 = (alpha + 4) >> 3;
+	switch (mode) {
+		case BLEND_ALPHA:
+			blendPairs565(dst, src, src_step, count, [alpha5](uint32_t d, uint32_t s) { return blendPair565(d, s, alpha5); });
+			break;
+		case BLEND_ADD:
+			blendPairs565(dst, src, src_step, count, [](uint32_t d, uint32_t s) { return addPair565(d, s); });
+			break;
+		case BLEND_MULTIPLY:
+			blendPairs565(dst, src, src_step, count, [](uint32_t d, uint32_t s) { return multiplyPair565(d, s); });
+			break;
+		case BLEND_XOR:
+			blendPairs565(dst, src, src_step, count, [](uint32_t d, uint32_t s) { return d ^ s; });
+			break;
+	}
+}
+
+}
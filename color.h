@@ -12,6 +12,14 @@ struct HighColor {
 
 	HighColor() {}
 	HighColor(int16_t _r, int16_t _g, int16_t _b) : r(_r), g(_g), b(_b) {}
+
+	bool operator==(const HighColor &other) const {
+		return r == other.r && g == other.g && b == other.b;
+	}
+
+	bool operator!=(const HighColor &other) const {
+		return !(*this == other);
+	}
 };
 
 struct RGB {
@@ -42,6 +50,14 @@ struct RGB {
 		b = clamp(_b);
 	}
 
+	bool operator==(const RGB &other) const {
+		return r == other.r && g == other.g && b == other.b;
+	}
+
+	bool operator!=(const RGB &other) const {
+		return !(*this == other);
+	}
+
 	operator HighColor() const {
 		return HighColor(r, g, b);
 	}
@@ -0,0 +1,134 @@
+#pragma once
+#include <Arduino.h>
+#include "color.h"
+
+namespace ssd1351 {
+
+inline uint8_t __attribute__((always_inline)) clampChannel(int16_t value) {
+	return value > 255 ? 255 : (value < 0 ? 0 : value);
+}
+
+// Converts 8 bit channels to a color type, the same as converting an RGB but with the channels clamped
+// to 0 - 255 first. See dither.h for the version that rounds with a threshold.
+template <typename C>
+C quantize(int16_t r, int16_t g, int16_t b);
+
+template <>
+inline LowColor __attribute__((always_inline)) quantize<LowColor>(int16_t r, int16_t g, int16_t b) {
+	return RGB(r, g, b);
+}
+
+template <>
+inline HighColor __attribute__((always_inline)) quantize<HighColor>(int16_t r, int16_t g, int16_t b) {
+	return HighColor(clampChannel(r), clampChannel(g), clampChannel(b));
+}
+
+template <>
+inline IndexedColor __attribute__((always_inline)) quantize<IndexedColor>(int16_t r, int16_t g, int16_t b) {
+	return RGB(r, g, b);
+}
+
+// The 8 bit channel values a color actually shows up as on the display, which is what conversions start
+// from, and what error diffusion needs to know how far off a quantized pixel is. Dropped low bits are filled by repeating the high bits,
+// so full brightness maps back to 255.
+
+inline void displayedChannels(LowColor c, int16_t &r, int16_t &g, int16_t &b) {
+	r = ((c >> 8) & 0xF8) | (c >> 13);
+	g = ((c >> 3) & 0xFC) | ((c >> 9) & 0x03);
+	b = ((c << 3) & 0xF8) | ((c >> 2) & 0x07);
+}
+
+inline void displayedChannels(const HighColor &c, int16_t &r, int16_t &g, int16_t &b) {
+	r = (c.r & 0xFC) | (c.r >> 6);
+	g = (c.g & 0xFC) | (c.g >> 6);
+	b = (c.b & 0xFC) | (c.b >> 6);
+}
+
+inline void displayedChannels(const RGB &c, int16_t &r, int16_t &g, int16_t &b) {
+	r = c.r;
+	g = c.g;
+	b = c.b;
+}
+
+inline void displayedChannels(IndexedColor c, int16_t &r, int16_t &g, int16_t &b) {
+	r = (c & 0xE0) | ((c >> 3) & 0x1C) | (c >> 6);
+	g = ((c << 3) & 0xE0) | (c & 0x1C) | ((c >> 3) & 0x03);
+	b = (c & 0x03) * 85;
+}
+
+// Conversion between color formats, going through the channel values the source color shows up as.
+// This is exact for anything converted to a format with at least as many bits per channel.
+
+template <typename C, typename S>
+struct ColorConverter {
+	static C __attribute__((always_inline)) convert(const S &color) {
+		int16_t r, g, b;
+		displayedChannels(color, r, g, b);
+		return quantize<C>(r, g, b);
+	}
+};
+
+template <typename C>
+struct ColorConverter<C, C> {
+	static C __attribute__((always_inline)) convert(const C &color) {
+		return color;
+	}
+};
+
+template <typename C, typename S>
+inline C __attribute__((always_inline)) convertColor(const S &color) {
+	return ColorConverter<C, S>::convert(color);
+}
+
+template <typename C, typename S>
+inline void convertRow(C *dst, const S *src, uint16_t count) {
+	while (count--) {
+		*dst++ = convertColor<C>(*src++);
+	}
+}
+
+// Row converters for the common pairs that work on two pixels per 32 bit word, like the pair blends in blend.h.
+// Every channel is moved into place with one mask and shift for both pixels, which gives the same results as
+// convertColor. Words are read and written with memcpy, so rows don't need to be aligned.
+
+inline void convertRow(IndexedColor *dst, const LowColor *src, uint16_t count) {
+	for (; count >= 2; count -= 2, src += 2, dst += 2) {
+		uint32_t p;
+		memcpy(&p, src, 4);
+		uint32_t out = ((p >> 8) & 0x00E000E0) | ((p >> 6) & 0x001C001C) | ((p >> 3) & 0x00030003);
+		dst[0] = out;
+		dst[1] = out >> 16;
+	}
+	if (count) {
+		*dst = convertColor<IndexedColor>(*src);
+	}
+}
+
+inline void convertRow(LowColor *dst, const IndexedColor *src, uint16_t count) {
+	// Dropped low bits are filled by repeating the high ones, see displayedChannels.
+	for (; count >= 2; count -= 2, src += 2, dst += 2) {
+		uint32_t p = src[0] | ((uint32_t)src[1] << 16);
+		uint32_t out = ((p & 0x00E000E0) << 8) | ((p & 0x00C000C0) << 5)
+			| ((p & 0x001C001C) << 6) | ((p & 0x001C001C) << 3)
+			| ((((p & 0x00030003) * 85) >> 3) & 0x001F001F);
+		memcpy(dst, &out, 4);
+	}
+	if (count) {
+		*dst = convertColor<LowColor>(*src);
+	}
+}
+
+inline void convertRow(LowColor *dst, const RGB *src, uint16_t count) {
+	for (; count >= 2; count -= 2, src += 2, dst += 2) {
+		uint32_t r = src[0].r | ((uint32_t)src[1].r << 16);
+		uint32_t g = src[0].g | ((uint32_t)src[1].g << 16);
+		uint32_t b = src[0].b | ((uint32_t)src[1].b << 16);
+		uint32_t out = ((r & 0x00F800F8) << 8) | ((g & 0x00FC00FC) << 3) | ((b & 0x00F800F8) >> 3);
+		memcpy(dst, &out, 4);
+	}
+	if (count) {
+		*dst = convertColor<LowColor>(*src);
+	}
+}
+
+}
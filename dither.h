@@ -0,0 +1,52 @@
+#pragma once
+#include <Arduino.h>
+#include "color.h"
+#include "convert.h"
+
+namespace ssd1351 {
+
+// 4x4 Bayer matrix for ordered dithering. Entries are thresholds from 0 to 15,
+// look them up with the screen position so patterns line up across drawing calls.
+static const uint8_t BAYER_4X4[4][4] = {
+	{ 0,  8,  2, 10},
+	{12,  4, 14,  6},
+	{ 3, 11,  1,  9},
+	{15,  7, 13,  5}
+};
+
+inline uint8_t __attribute__((always_inline)) bayerThreshold(int16_t x, int16_t y) {
+	return BAYER_4X4[y & 3][x & 3];
+}
+
+inline uint8_t __attribute__((always_inline)) ditherLevel(int16_t value, uint8_t bits, uint8_t threshold) {
+	// Picks one of the 2^bits levels a channel can have on the display, rounding up or down depending on the
+	// threshold, so that on average the wanted value comes out. (value * 8224) >> 16 is value * 32 / 255,
+	// computed without a division.
+	int32_t max = (1 << bits) - 1;
+	value = value > 255 ? 255 : (value < 0 ? 0 : value);
+	int32_t level = (((value * max * 8224) >> 16) + 2 * threshold + 1) >> 5;
+	return level > max ? max : level;
+}
+
+// Converts 8 bit channels to a color type, with the display level of every channel rounded up or down
+// depending on threshold (0 to 15, usually from bayerThreshold). The levels are the ones the display actually
+// shows (6 bits per channel in HighColor mode). See convert.h for the version without a threshold.
+template <typename C>
+C quantize(int16_t r, int16_t g, int16_t b, uint8_t threshold);
+
+template <>
+inline LowColor __attribute__((always_inline)) quantize<LowColor>(int16_t r, int16_t g, int16_t b, uint8_t threshold) {
+	return (ditherLevel(r, 5, threshold) << 11) | (ditherLevel(g, 6, threshold) << 5) | ditherLevel(b, 5, threshold);
+}
+
+template <>
+inline HighColor __attribute__((always_inline)) quantize<HighColor>(int16_t r, int16_t g, int16_t b, uint8_t threshold) {
+	return HighColor(ditherLevel(r, 6, threshold) << 2, ditherLevel(g, 6, threshold) << 2, ditherLevel(b, 6, threshold) << 2);
+}
+
+template <>
+inline IndexedColor __attribute__((always_inline)) quantize<IndexedColor>(int16_t r, int16_t g, int16_t b, uint8_t threshold) {
+	return (ditherLevel(r, 3, threshold) << 5) | (ditherLevel(g, 3, threshold) << 2) | ditherLevel(b, 2, threshold);
+}
+
+}
@@ -3,7 +3,8 @@
 #include <ssd1351.h>
 
 // This example is used to illustrate the different color modes. Select a different mode to see
-// different amounts of colour banding.
+// different amounts of colour banding. Every other frame is drawn with ordered dithering, which
+// hides most of the banding in LowColor and IndexedColor mode.
 
 typedef ssd1351::IndexedColor Color;
 // typedef ssd1351::LowColor Color;
@@ -20,6 +21,19 @@ void setup() {
   Serial.println("Display set up.");
 }
 
+void drawDithered() {
+  for(int i=0; i<128; i++) {
+    display.fillRectDithered(i, 0, 1, 16, ssd1351::RGB(i, 0, 0));
+    display.fillRectDithered(i, 32, 1, 16, ssd1351::RGB(0, i, 0));
+    display.fillRectDithered(i, 64, 1, 16, ssd1351::RGB(0, 0, i));
+  }
+  for(int i=128; i<256; i++) {
+    display.fillRectDithered(256 - i, 16, 1, 16, ssd1351::RGB(i, 0, 0));
+    display.fillRectDithered(256 - i, 48, 1, 16, ssd1351::RGB(0, i, 0));
+    display.fillRectDithered(256 - i, 80, 1, 16, ssd1351::RGB(0, 0, i));
+  }
+}
+
 void loop() {
   for(int i=0; i<128; i++) {
     display.drawLine(i, 0, i, 15, ssd1351::RGB(i, 0, 0));
@@ -43,4 +57,8 @@ void loop() {
   }
   display.updateScreen();
   delay(2000);
+
+  drawDithered();
+  display.updateScreen();
+  delay(2000);
 }
@@ -0,0 +1,73 @@
+#pragma once
+#include <Arduino.h>
+#include "gfxfont.h"
+
+namespace ssd1351 {
+
+// Glyph bitmaps of compressed fonts (made with fontconvert -c or util/compress_font.py) are run lengths instead of
+// bits: the glyph's pixels are taken row after row as one long line, which is split into runs that alternate
+// between unset and set pixels, starting with unset ones. Every run is a sequence of 4 bit values (high nibble
+// first) that add up to its length, all but the last one being 15. Every glyph starts on a new byte.
+// 18 and 24 point fonts shrink by a third or more (small ones don't, they have too few pixels per run), and
+// drawing them is faster too, since runs of set pixels are drawn as spans without looking at every pixel.
+// Only plain 1 bit fonts can be compressed.
+static const uint8_t FONT_PLAIN = 0;
+static const uint8_t FONT_RLE = 1;
+
+class GlyphSpans {
+public:
+	// Goes through the spans of set pixels of a compressed glyph, row by row. A run of set pixels that continues
+	// on the next row is split into one span per row.
+	GlyphSpans(const uint8_t *_data, uint8_t _w, uint8_t _h) : data(_data), w(_w), total(_w * _h) {}
+
+	// A glyph without any pixels, for arrays of decoders that get their glyphs later.
+	GlyphSpans() : data(nullptr), w(0), total(0) {}
+
+	bool next() {
+		// Moves to the next span, returns false when there are none left. The span is row, col and length.
+		if (remaining) {
+			row++;
+			col = 0;
+		} else {
+			if (pos >= total) {
+				return false;
+			}
+			pos += readRun();
+			if (pos >= total) {
+				return false;
+			}
+			remaining = readRun();
+			row = pos / w;
+			col = pos % w;
+		}
+		length = remaining < w - col ? remaining : w - col;
+		remaining -= length;
+		pos += length;
+		return true;
+	}
+
+	uint8_t row = 0;
+	uint8_t col = 0;
+	uint8_t length = 0;
+
+private:
+	const uint8_t *data;
+	uint8_t w;
+	uint16_t total;
+	uint16_t pos = 0;
+	uint16_t remaining = 0; // Set pixels left in the current run after this span
+	uint32_t nibble = 0;
+
+	uint16_t readRun() {
+		uint16_t run = 0;
+		uint8_t value;
+		do {
+			uint8_t byte = pgm_read_byte(data + (nibble >> 1));
+			value = nibble++ & 1 ? byte & 0x0F : byte >> 4;
+			run += value;
+		} while (value == 15);
+		return run;
+	}
+};
+
+}
@@ -10,14 +10,28 @@ For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
 
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
-Currently this only extracts the printable 7-bit ASCII chars of a font.
-Will eventually extend with some int'l chars a la ftGFX, not there yet.
-Keep 7-bit fonts around as an option in that case, more compact.
+Anti-aliased fonts (2 or 4 bits of coverage per pixel instead of 1) are
+made with -a2 or -a4 before the filename, e.g.:
+  ./fontconvert -a4 ~/Library/Fonts/FreeSans.ttf 9 > FreeSans9pt7b_aa4.h
+
+Big fonts take less flash (and draw faster) with -c, which stores run
+lengths of pixels instead of bitmaps, see fontcompression.h.  Small ones
+usually get bigger, the sizes are printed to stderr.
+
+By default this only extracts the printable 7-bit ASCII chars of a font.
+More characters are added with -u and a comma separated list of Unicode
+code points and ranges of them, e.g. degree sign, micro sign, arrows and
+Cyrillic capitals:
+  ./fontconvert -u 0xB0,0xB5,0x2190-0x2193,0x410-0x42F FreeSans.ttf 9
+These end up in a table of ranges after the ASCII chars, text using them
+is written in UTF-8.
 
 See notes at end for glyph nomenclature & other tidbits.
 */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <stdint.h>
 #include <ft2build.h>
@@ -25,6 +39,44 @@ See notes at end for glyph nomenclature & other tidbits.
 #include "../gfxfont.h" // Adafruit_GFX font structures
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
+#define MAX_RANGES 64
+
+GFXrange ranges[MAX_RANGES];
+int      rangeCount = 0;
+
+int compareRanges(const void *a, const void *b) {
+	return (int)((const GFXrange *)a)->first - (int)((const GFXrange *)b)->first;
+}
+
+// Parse a -u list like "0xB0,0x2190-0x2193" into ranges, sorted by
+// code point.  Returns 0 if the list doesn't make sense.
+int parseRanges(char *list) {
+	char *end;
+	long  from, to;
+	int   i;
+	while(*list) {
+		from = to = strtol(list, &end, 0);
+		if(end == list) return 0;
+		if(*end == '-') {
+			list = end + 1;
+			to   = strtol(list, &end, 0);
+			if(end == list) return 0;
+		}
+		if((from < 0) || (to > 0xFFFF) || (to < from) ||
+		  (rangeCount == MAX_RANGES)) return 0;
+		ranges[rangeCount].first = from;
+		ranges[rangeCount].last  = to;
+		rangeCount++;
+		list = end;
+		if(*list == ',') list++;
+		else if(*list) return 0;
+	}
+	qsort(ranges, rangeCount, sizeof(GFXrange), compareRanges);
+	for(i=1; i<rangeCount; i++) {
+		if(ranges[i].first <= ranges[i - 1].last) return 0;
+	}
+	return 1;
+}
 
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
@@ -46,9 +98,46 @@ void enbit(uint8_t value) {
 	}
 }
 
+// Output a pixel of bpp bits, most significant bit first
+void enpixel(uint8_t value, int bpp) {
+	while(bpp--) enbit(value & (1 << bpp));
+}
+
+// Output a run length as 4 bit values adding up to it, all but
+// the last one 15.  Returns the number of bits written.
+int enrun(int run) {
+	int bits = 4;
+	for(; run >= 15; run -= 15, bits += 4) enpixel(15, 4);
+	enpixel(run, 4);
+	return bits;
+}
+
+// Output the pixels of a MONO bitmap as runs alternating between
+// unset and set pixels, starting with unset ones, going through
+// the rows as if they were one long line.  Returns the number of
+// bits written.
+int enruns(FT_Bitmap *bitmap) {
+	int x, y, set, current = 0, run = 0, bits = 0;
+	for(y=0; y < bitmap->rows; y++) {
+		for(x=0; x < bitmap->width; x++) {
+			set = (bitmap->buffer[y * bitmap->pitch + x / 8] >>
+			  (7 - (x & 7))) & 1;
+			if(set != current) {
+				bits   += enrun(run);
+				run     = 0;
+				current = set;
+			}
+			run++;
+		}
+	}
+	if(run) bits += enrun(run);
+	return bits;
+}
+
 int main(int argc, char *argv[]) {
 	int                i, j, err, size, first=' ', last='~',
-	                   bitmapOffset = 0, x, y, byte;
+	                   bitmapOffset = 0, x, y, byte, bpp = 1, bits,
+	                   count, *codes, compress = 0, plainSize = 0;
 	char              *fontName, c, *ptr;
 	FT_Library         library;
 	FT_Face            face;
@@ -63,14 +152,39 @@ int main(int argc, char *argv[]) {
 	//   fontconvert [filename] [size] [last char]
 	//   fontconvert [filename] [size] [first char] [last char]
 	// Unless overridden, default first and last chars are
-	// ' ' (space) and '~', respectively
+	// ' ' (space) and '~', respectively.  Any of these can be
+	// preceded by -a2 or -a4 for an anti-aliased font, and by
+	// -u [code points] for more characters and -c for compressed
+	// glyph bitmaps.
+
+	while((argc > 1) && (argv[1][0] == '-')) {
+		if(!strcmp(argv[1], "-a2") || !strcmp(argv[1], "-a4")) {
+			bpp = argv[1][2] - '0';
+		} else if(!strcmp(argv[1], "-c")) {
+			compress = 1;
+		} else if(!strcmp(argv[1], "-u") && (argc > 2) &&
+		  parseRanges(argv[2])) {
+			argv++;
+			argc--;
+		} else {
+			argc = 0; // Print usage
+			break;
+		}
+		argv++;
+		argc--;
+	}
 
 	if(argc < 3) {
-		fprintf(stderr, "Usage: %s fontfile size [first] [last]\n",
+		fprintf(stderr, "Usage: %s [-a2|-a4|-c] [-u code points] fontfile size [first] [last]\n",
 		  argv[0]);
 		return 1;
 	}
 
+	if(compress && (bpp > 1)) {
+		fprintf(stderr, "Anti-aliased fonts can't be compressed\n");
+		return 1;
+	}
+
 	size = atoi(argv[2]);
 
 	if(argc == 4) {
@@ -86,13 +200,33 @@ int main(int argc, char *argv[]) {
 		last  = i;
 	}
 
+	if((rangeCount > 0) && ((last > 255) || (ranges[0].first <= last))) {
+		fprintf(stderr, "Code points must come after the last char\n");
+		return 1;
+	}
+
+	// All code points to convert: first to last, then the ranges.
+	count = last - first + 1;
+	for(i=0; i<rangeCount; i++) {
+		ranges[i].glyph = count;
+		count += ranges[i].last - ranges[i].first + 1;
+	}
+	if(!(codes = (int *)malloc(count * sizeof(int)))) {
+		fprintf(stderr, "Malloc error\n");
+		return 1;
+	}
+	for(i=first, j=0; i<=last; i++) codes[j++] = i;
+	for(i=0; i<rangeCount; i++) {
+		for(x=ranges[i].first; x<=ranges[i].last; x++) codes[j++] = x;
+	}
+
 	ptr = strrchr(argv[1], '/'); // Find last slash in filename
 	if(ptr) ptr++;         // First character of filename (path stripped)
 	else    ptr = argv[1]; // No path; font in local dir.
 
 	// Allocate space for font name and glyph table
 	if((!(fontName = malloc(strlen(ptr) + 20))) ||
-	   (!(table = (GFXglyph *)malloc((last - first + 1) *
+	   (!(table = (GFXglyph *)malloc(count *
 	    sizeof(GFXglyph))))) {
 		fprintf(stderr, "Malloc error\n");
 		return 1;
@@ -105,7 +239,8 @@ int main(int argc, char *argv[]) {
 	if(!ptr) ptr = &fontName[strlen(fontName)]; // If none, append
 	// Insert font size and 7/8 bit.  fontName was alloc'd w/extra
 	// space to allow this, we're not sprintfing into Forbidden Zone.
-	sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+	sprintf(ptr, "%dpt%db", size, ((last > 127) || rangeCount) ? 8 : 7);
+	if(bpp > 1) sprintf(&ptr[strlen(ptr)], "_aa%d", bpp);
 	// Space and punctuation chars in name replaced w/ underscores.  
 	for(i=0; (c=fontName[i]); i++) {
 		if(isspace(c) || ispunct(c)) fontName[i] = '_';
@@ -125,26 +260,29 @@ int main(int argc, char *argv[]) {
 	// << 6 because '26dot6' fixed-point format
 	FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
 
-	// Currently all symbols from 'first' to 'last' are processed.
-	// Fonts may contain WAY more glyphs than that, but this code
-	// will need to handle encoding stuff to deal with extracting
-	// the right symbols, and that's not done yet.
+	// All symbols from 'first' to 'last' and the -u ranges are
+	// processed.  FreeType picks the font's Unicode charmap by
+	// default, so code points can be passed straight to it.
 	// fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
 	printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
 
 	// Process glyphs and output huge bitmap data array
-	for(i=first, j=0; i<=last; i++, j++) {
+	for(j=0; j<count; j++) {
+		i = codes[j];
 		// MONO renderer provides clean image with perfect crop
-		// (no wasted pixels) via bitmap struct.
-		if((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
+		// (no wasted pixels) via bitmap struct.  The NORMAL one
+		// does the same with 8 bits of coverage per pixel, for
+		// anti-aliased fonts.
+		if((err = FT_Load_Char(face, i, (bpp > 1) ?
+		  FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO))) {
 			fprintf(stderr, "Error %d loading char '%c'\n",
 			  err, i);
 			continue;
 		}
 
-		if((err = FT_Render_Glyph(face->glyph,
-		  FT_RENDER_MODE_MONO))) {
+		if((err = FT_Render_Glyph(face->glyph, (bpp > 1) ?
+		  FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO))) {
 			fprintf(stderr, "Error %d rendering char '%c'\n",
 			  err, i);
 			continue;
@@ -174,8 +312,15 @@ int main(int argc, char *argv[]) {
 		table[j].xOffset      = g->left;
 		table[j].yOffset      = 1 - g->top;
 
-		for(y=0; y < bitmap->rows; y++) {
+		plainSize += (bitmap->width * bitmap->rows + 7) / 8;
+		for(y=0; (y < bitmap->rows) && !compress; y++) {
 			for(x=0;x < bitmap->width; x++) {
+				if(bpp > 1) {
+					// Coverage 0-255, rounded to bpp bits
+					byte = bitmap->buffer[y * bitmap->pitch + x];
+					enpixel((byte * ((1 << bpp) - 1) + 127) / 255, bpp);
+					continue;
+				}
 				byte = x / 8;
 				bit  = 0x80 >> (x & 7);
 				enbit(bitmap->buffer[
@@ -184,12 +329,14 @@ int main(int argc, char *argv[]) {
 		}
 
 		// Pad end of char bitmap to next byte boundary if needed
-		int n = (bitmap->width * bitmap->rows) & 7;
-		if(n) { // Pixel count not an even multiple of 8?
+		bits = compress ? enruns(bitmap) :
+		  bitmap->width * bitmap->rows * bpp;
+		int n = bits & 7;
+		if(n) { // Bit count not an even multiple of 8?
 			n = 8 - n; // # bits to next multiple
 			while(n--) enbit(0);
 		}
-		bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+		bitmapOffset += (bits + 7) / 8;
 
 		FT_Done_Glyph(glyph);
 	}
@@ -198,7 +345,8 @@ int main(int argc, char *argv[]) {
 
 	// Output glyph attributes table (one per character)
 	printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
-	for(i=first, j=0; i<=last; i++, j++) {
+	for(j=0; j<count; j++) {
+		i = codes[j];
 		printf("  { %5d, %3d, %3d, %3d, %4d, %4d }",
 		  table[j].bitmapOffset,
 		  table[j].width,
@@ -206,7 +354,7 @@ int main(int argc, char *argv[]) {
 		  table[j].xAdvance,
 		  table[j].xOffset,
 		  table[j].yOffset);
-		if(i < last) {
+		if(j < count - 1) {
 			printf(",   // 0x%02X", i);
 			if((i >= ' ') && (i <= '~')) {
 				printf(" '%c'", i);
@@ -214,18 +362,40 @@ int main(int argc, char *argv[]) {
 			putchar('\n');
 		}
 	}
-	printf(" }; // 0x%02X", last);
-	if((last >= ' ') && (last <= '~')) printf(" '%c'", last);
+	i = codes[count - 1];
+	printf(" }; // 0x%02X", i);
+	if((i >= ' ') && (i <= '~')) printf(" '%c'", i);
 	printf("\n\n");
 
+	// Output range table (one per -u range)
+	if(rangeCount) {
+		printf("const GFXrange %sRanges[] PROGMEM = {\n", fontName);
+		for(i=0; i<rangeCount; i++) {
+			printf("  { 0x%04X, 0x%04X, %5d }%s\n", ranges[i].first,
+			  ranges[i].last, ranges[i].glyph,
+			  (i < rangeCount - 1) ? "," : " };");
+		}
+		printf("\n");
+	}
+
 	// Output font structure
 	printf("const GFXfont %s PROGMEM = {\n", fontName);
 	printf("  (uint8_t  *)%sBitmaps,\n", fontName);
 	printf("  (GFXglyph *)%sGlyphs,\n", fontName);
-	printf("  0x%02X, 0x%02X, %ld };\n\n",
-	  first, last, face->size->metrics.height >> 6);
+	printf("  0x%02X, 0x%02X, %ld, %d,\n",
+	  first, last, face->size->metrics.height >> 6, bpp);
+	if(rangeCount) {
+		printf("  (GFXrange *)%sRanges, %d, %d };\n\n",
+		  fontName, rangeCount, compress);
+	} else {
+		printf("  NULL, 0, %d };\n\n", compress);
+	}
+	if(compress) {
+		fprintf(stderr, "Compressed bitmaps: %d bytes instead of %d\n",
+		  bitmapOffset, plainSize);
+	}
 	printf("// Approx. %d bytes\n",
-	  bitmapOffset + (last - first + 1) * 7 + 7);
+	  bitmapOffset + count * 7 + rangeCount * 6 + 7);
 	// Size estimate is based on AVR struct and pointer sizes;
 	// actual size may vary.
 
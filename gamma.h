@@ -0,0 +1,29 @@
+#pragma once
+#include <Arduino.h>
+
+// Gray scale tables generated by util/generate_gamma_table.py, for use with SSD1351::setGrayscaleTable().
+
+namespace ssd1351 {
+
+static const uint8_t gamma_1_8[63] PROGMEM = {
+	  1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+	 17,  19,  21,  23,  25,  27,  29,  32,  34,  37,  39,  42,  45,  47,  50,  53,
+	 56,  59,  62,  66,  69,  72,  76,  79,  83,  87,  91,  94,  98, 102, 106, 110,
+	115, 119, 123, 127, 132, 136, 141, 146, 150, 155, 160, 165, 170, 175, 180
+};
+
+static const uint8_t gamma_2_2[63] PROGMEM = {
+	  1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+	 17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  28,  30,  33,  35,  38,  41,
+	 43,  46,  49,  53,  56,  59,  63,  66,  70,  74,  78,  82,  86,  90,  94,  99,
+	104, 108, 113, 118, 123, 128, 134, 139, 144, 150, 156, 162, 168, 174, 180
+};
+
+static const uint8_t gamma_2_5[63] PROGMEM = {
+	  1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+	 17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  33,
+	 36,  39,  41,  44,  48,  51,  54,  58,  62,  65,  69,  73,  78,  82,  87,  91,
+	 96, 101, 106, 111, 117, 122, 128, 134, 140, 146, 153, 159, 166, 173, 180
+};
+
+}
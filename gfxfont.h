@@ -14,11 +14,20 @@ typedef struct { // Data stored PER GLYPH
 	int8_t   xOffset, yOffset; // Dist from cursor pos to UL corner
 } GFXglyph;
 
+typedef struct { // Data stored PER EXTRA RANGE of characters
+	uint16_t first, last;  // Unicode code point extents
+	uint16_t glyph;        // Index of first's glyph in GFXfont->glyph
+} GFXrange;
+
 typedef struct { // Data stored for FONT AS A WHOLE:
 	uint8_t  *bitmap;      // Glyph bitmaps, concatenated
 	GFXglyph *glyph;       // Glyph array
 	uint8_t   first, last; // ASCII extents
 	uint8_t   yAdvance;    // Newline distance (y axis)
+	uint8_t   bpp;         // Bits per pixel: 0 or 1 for plain fonts, 2 or 4 for anti-aliased ones
+	GFXrange *ranges;      // Characters beyond first..last, sorted by code point (optional)
+	uint16_t  rangeCount;  // Number of entries in ranges
+	uint8_t   compression; // 0 for plain bitmaps, 1 for run lengths (see fontcompression.h)
 } GFXfont;
 
 #endif // _GFXFONT_H_
@@ -1,21 +1,11 @@
-// This is the 'classic' fixed-space bitmap font for Adafruit_GFX since 1.0.
-// See gfxfont.h for newer custom bitmap font info.
+#pragma once
+#include <Arduino.h>
 
-#ifndef FONT5X7_H
-#define FONT5X7_H
+namespace ssd1351 {
 
-#ifdef __AVR__
- #include <avr/io.h>
- #include <avr/pgmspace.h>
-#elif defined(ESP8266)
- #include <pgmspace.h>
-#else
- #define PROGMEM
-#endif
-
-// Standard ASCII 5x7 font
-
-static const unsigned char font[] PROGMEM = {
+// The 'classic' 5x7 font of Adafruit_GFX (its glcdfont.c), for terminals. 5 bytes per character, one per
+// column, with the top row in bit 0. Named so it doesn't take the name font away from sketches.
+static const uint8_t GLCD_FONT[] PROGMEM = {
 	0x00, 0x00, 0x00, 0x00, 0x00,
 	0x3E, 0x5B, 0x4F, 0x5B, 0x3E,
 	0x3E, 0x6B, 0x4F, 0x6B, 0x3E,
@@ -273,4 +263,5 @@ static const unsigned char font[] PROGMEM = {
 	0x00, 0x3C, 0x3C, 0x3C, 0x3C,
 	0x00, 0x00, 0x00, 0x00, 0x00  // #255 NBSP
 };
-#endif // FONT5X7_H
+
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include <Arduino.h>
+#include "gfxfont.h"
+
+namespace ssd1351 {
+
+// Cache for opaque text (see setGlyphCache). Characters are stored fully rendered in the display's color type,
+// so drawing one that's cached is a plain copy of its pixels: one memcpy per row in buffered mode.
+// Entries are keyed on font, glyph, colors and text size, and the least recently used ones get dropped when there's
+// no room for a new one. The pixel memory is provided by the caller, so its size is up to the sketch.
+// Transparent text isn't cached: it only touches the glyph's set pixels, which is cheap already.
+template <typename C>
+class GlyphCache {
+public:
+	static const uint8_t MAX_ENTRIES = 32;
+
+	GlyphCache(C *_memory, uint32_t _capacity) : memory(_memory), capacity(_capacity) {}
+
+	void clear() {
+		count = 0;
+		used = 0;
+	}
+
+	void resetCounters() {
+		hits = 0;
+		misses = 0;
+	}
+
+	uint32_t getHits() const {
+		return hits;
+	}
+
+	uint32_t getMisses() const {
+		return misses;
+	}
+
+	const C *find(const GFXfont *font, uint32_t glyph, const C &fg, const C &bg, uint8_t size) {
+		// Returns the pixels of a cached character, or nullptr if it's not in the cache.
+		for (uint8_t i = 0; i < count; i++) {
+			Entry &entry = entries[i];
+			if (entry.font == font && entry.glyph == glyph && entry.size == size && entry.fg == fg && entry.bg == bg) {
+				entry.last_used = ++clock;
+				hits++;
+				return memory + entry.offset;
+			}
+		}
+		misses++;
+		return nullptr;
+	}
+
+	C *insert(const GFXfont *font, uint32_t glyph, const C &fg, const C &bg, uint8_t size, uint32_t pixels) {
+		// Makes room for a character of the given number of pixels and returns where to put them,
+		// or nullptr if it's bigger than the whole cache.
+		if (pixels > capacity) {
+			return nullptr;
+		}
+		if (count == MAX_ENTRIES) {
+			evictLeastRecentlyUsed();
+		}
+		while (used + pixels > capacity) {
+			evictLeastRecentlyUsed();
+		}
+		uint32_t offset = end();
+		if (offset + pixels > capacity) {
+			compact();
+			offset = used;
+		}
+
+		Entry &entry = entries[count++];
+		entry.font = font;
+		entry.glyph = glyph;
+		entry.size = size;
+		entry.fg = fg;
+		entry.bg = bg;
+		entry.offset = offset;
+		entry.pixels = pixels;
+		entry.last_used = ++clock;
+		used += pixels;
+		return memory + entry.offset;
+	}
+
+private:
+	struct Entry {
+		const GFXfont *font;
+		uint32_t glyph;
+		uint8_t size;
+		C fg;
+		C bg;
+		uint32_t offset;
+		uint32_t pixels;
+		uint32_t last_used;
+	};
+
+	C *memory;
+	uint32_t capacity;
+	uint32_t used = 0;
+	uint32_t clock = 0;
+	uint32_t hits = 0;
+	uint32_t misses = 0;
+	Entry entries[MAX_ENTRIES];
+	uint8_t count = 0;
+
+	uint32_t end() const {
+		// New entries go after the last one. Evicted entries leave gaps until the next compact.
+		uint32_t result = 0;
+		for (uint8_t i = 0; i < count; i++) {
+			uint32_t entry_end = entries[i].offset + entries[i].pixels;
+			result = entry_end > result ? entry_end : result;
+		}
+		return result;
+	}
+
+	void evictLeastRecentlyUsed() {
+		uint8_t oldest = 0;
+		for (uint8_t i = 1; i < count; i++) {
+			if (entries[i].last_used < entries[oldest].last_used) {
+				oldest = i;
+			}
+		}
+		used -= entries[oldest].pixels;
+		entries[oldest] = entries[--count];
+	}
+
+	void compact() {
+		// Moves the pixels of all entries to the start of memory, in the order they're stored in, closing the gaps
+		// evicted entries left. Sorting by offset first means every entry only ever moves towards the start.
+		for (uint8_t i = 1; i < count; i++) {
+			Entry entry = entries[i];
+			uint8_t j = i;
+			for (; j > 0 && entries[j - 1].offset > entry.offset; j--) {
+				entries[j] = entries[j - 1];
+			}
+			entries[j] = entry;
+		}
+		uint32_t offset = 0;
+		for (uint8_t i = 0; i < count; i++) {
+			if (entries[i].offset != offset) {
+				memmove(memory + offset, memory + entries[i].offset, entries[i].pixels * sizeof(C));
+				entries[i].offset = offset;
+			}
+			offset += entries[i].pixels;
+		}
+	}
+};
+
+}
@@ -0,0 +1,289 @@
+#pragma once
+#include <Arduino.h>
+#include "color.h"
+
+namespace ssd1351 {
+
+// A static background with sprites on top, redrawn incrementally.
+// Moving, changing, showing or hiding a sprite marks the area it covered before and the area it covers now as damaged.
+// update() then recomposites only the damaged areas (background first, then the visible sprites from the lowest
+// to the highest z) and sends them to the display, so the cost of a frame depends on how much moved rather than
+// on the size of the screen. Works with both buffer modes: in SingleBuffer mode the damaged areas are written
+// to the buffer and then pushed out on their own, in NoBuffer mode every damaged area goes out in a single window.
+//
+// Sprites are bitmaps in the display's color type, optionally with a color key for transparent pixels.
+// The bitmaps aren't copied, they need to stay around while in use.
+template <typename C, int16_t W, int16_t H, uint8_t MAX_SPRITES = 16, uint8_t MAX_DAMAGE = 8>
+class SpriteLayers {
+public:
+	static const uint8_t NO_SPRITE = 255;
+
+	SpriteLayers() {
+		invalidateAll();
+	}
+
+	void setBackground(const C &color) {
+		// A solid background
+		background = nullptr;
+		background_color = color;
+		invalidateAll();
+	}
+
+	void setBackground(const C *pixels) {
+		// A background bitmap of W * H pixels
+		background = pixels;
+		invalidateAll();
+	}
+
+	uint8_t addSprite(const C *pixels, int16_t w, int16_t h, int16_t x, int16_t y, int8_t z = 0) {
+		// Returns the id of the new sprite, or NO_SPRITE if there's no room for another one.
+		if (count == MAX_SPRITES) {
+			return NO_SPRITE;
+		}
+		uint8_t id = count++;
+		Sprite &sprite = sprites[id];
+		sprite.pixels = pixels;
+		sprite.w = w;
+		sprite.h = h;
+		sprite.x = x;
+		sprite.y = y;
+		sprite.z = z;
+		sprite.visible = true;
+		sprite.keyed = false;
+		invalidate(sprite);
+		sortByZ();
+		return id;
+	}
+
+	void setKey(uint8_t id, const C &key) {
+		// Pixels of the sprite that are equal to key are transparent.
+		sprites[id].key = key;
+		sprites[id].keyed = true;
+		invalidate(sprites[id]);
+	}
+
+	void moveTo(uint8_t id, int16_t x, int16_t y) {
+		Sprite &sprite = sprites[id];
+		if (sprite.x == x && sprite.y == y) {
+			return;
+		}
+		invalidate(sprite);
+		sprite.x = x;
+		sprite.y = y;
+		invalidate(sprite);
+	}
+
+	void setPixels(uint8_t id, const C *pixels) {
+		// Switches to another bitmap of the same size, e.g. the next frame of an animation.
+		sprites[id].pixels = pixels;
+		invalidate(sprites[id]);
+	}
+
+	void setVisible(uint8_t id, bool visible) {
+		if (sprites[id].visible != visible) {
+			sprites[id].visible = visible;
+			invalidate(sprites[id], true);
+		}
+	}
+
+	void setZ(uint8_t id, int8_t z) {
+		// Sprites with a higher z are drawn on top, sprites with the same z in the order they were added.
+		if (sprites[id].z != z) {
+			sprites[id].z = z;
+			invalidate(sprites[id]);
+			sortByZ();
+		}
+	}
+
+	void invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+		// Marks an area as damaged, so it gets recomposited by the next update.
+		if (x < 0) {
+			w += x;
+			x = 0;
+		}
+		if (y < 0) {
+			h += y;
+			y = 0;
+		}
+		w = x + w > W ? W - x : w;
+		h = y + h > H ? H - y : h;
+		if (w <= 0 || h <= 0) {
+			return;
+		}
+		addDamage({x, y, (int16_t)(x + w), (int16_t)(y + h)});
+	}
+
+	void invalidateAll() {
+		damage_count = 0;
+		invalidate(0, 0, W, H);
+	}
+
+	template <typename D>
+	void update(D &display) {
+		// Recomposites the damaged areas and sends them to the display.
+		for (uint8_t i = 0; i < damage_count; i++) {
+			const Rect &rect = damage[i];
+			Compositor compositor(*this, rect);
+			display.streamRect(rect.x0, rect.y0, rect.x1 - rect.x0, rect.y1 - rect.y0, compositor);
+			display.updateScreen(rect.x0, rect.y0, rect.x1 - rect.x0, rect.y1 - rect.y0);
+		}
+		damage_count = 0;
+	}
+
+private:
+	struct Sprite {
+		const C *pixels;
+		int16_t w;
+		int16_t h;
+		int16_t x;
+		int16_t y;
+		int8_t z;
+		bool visible;
+		bool keyed;
+		C key;
+	};
+
+	struct Rect {
+		// Half open: x0 <= x < x1, y0 <= y < y1
+		int16_t x0;
+		int16_t y0;
+		int16_t x1;
+		int16_t y1;
+
+		int32_t area() const {
+			return (int32_t)(x1 - x0) * (y1 - y0);
+		}
+
+		Rect merged(const Rect &other) const {
+			return {
+				x0 < other.x0 ? x0 : other.x0, y0 < other.y0 ? y0 : other.y0,
+				x1 > other.x1 ? x1 : other.x1, y1 > other.y1 ? y1 : other.y1
+			};
+		}
+
+		bool overlaps(const Rect &other) const {
+			return x0 < other.x1 && other.x0 < x1 && y0 < other.y1 && other.y0 < y1;
+		}
+	};
+
+	class Compositor {
+	public:
+		// Produces the pixels of a damaged area row by row, for use with streamRect. Every row is composited
+		// into a line buffer when its first pixel is asked for.
+		Compositor(const SpriteLayers &_layers, const Rect &_rect) : layers(_layers), rect(_rect), y(_rect.y0), col(0) {}
+
+		C __attribute__((always_inline)) operator()() {
+			if (!col) {
+				compositeRow();
+			}
+			C color = line[col];
+			if (++col == rect.x1 - rect.x0) {
+				col = 0;
+				y++;
+			}
+			return color;
+		}
+
+	private:
+		const SpriteLayers &layers;
+		Rect rect;
+		int16_t y;
+		int16_t col;
+		C line[W];
+
+		void compositeRow() {
+			int16_t w = rect.x1 - rect.x0;
+			if (layers.background) {
+				memcpy(line, layers.background + W * y + rect.x0, w * sizeof(C));
+			} else {
+				for (int16_t i = 0; i < w; i++) {
+					line[i] = layers.background_color;
+				}
+			}
+			for (uint8_t i = 0; i < layers.count; i++) {
+				const Sprite &sprite = layers.sprites[layers.order[i]];
+				if (!sprite.visible || y < sprite.y || y >= sprite.y + sprite.h) {
+					continue;
+				}
+				int16_t x0 = sprite.x > rect.x0 ? sprite.x : rect.x0;
+				int16_t x1 = sprite.x + sprite.w < rect.x1 ? sprite.x + sprite.w : rect.x1;
+				if (x1 <= x0) {
+					continue;
+				}
+				const C *pixels = sprite.pixels + (y - sprite.y) * sprite.w + (x0 - sprite.x);
+				C *out = line + (x0 - rect.x0);
+				if (sprite.keyed) {
+					for (int16_t x = x0; x < x1; x++, pixels++, out++) {
+						if (*pixels != sprite.key) {
+							*out = *pixels;
+						}
+					}
+				} else {
+					memcpy(out, pixels, (x1 - x0) * sizeof(C));
+				}
+			}
+		}
+	};
+
+	Sprite sprites[MAX_SPRITES];
+	uint8_t order[MAX_SPRITES]; // Sprite ids sorted by z
+	uint8_t count = 0;
+	Rect damage[MAX_DAMAGE];
+	uint8_t damage_count = 0;
+	const C *background = nullptr;
+	C background_color = C();
+
+	void invalidate(const Sprite &sprite, bool even_if_hidden = false) {
+		if (sprite.visible || even_if_hidden) {
+			invalidate(sprite.x, sprite.y, sprite.w, sprite.h);
+		}
+	}
+
+	void addDamage(Rect rect) {
+		// Damaged areas that overlap are merged, so no pixel gets sent twice. When there's no room for another
+		// area, the new one is merged with the area that grows the least by it.
+		for (uint8_t i = 0; i < damage_count;) {
+			if (damage[i].overlaps(rect)) {
+				rect = rect.merged(damage[i]);
+				// The merged area might overlap areas that were checked already, so start over without this one.
+				damage[i] = damage[--damage_count];
+				i = 0;
+			} else {
+				i++;
+			}
+		}
+		if (damage_count < MAX_DAMAGE) {
+			damage[damage_count++] = rect;
+			return;
+		}
+		uint8_t best = 0;
+		int32_t best_growth = INT32_MAX;
+		for (uint8_t i = 0; i < damage_count; i++) {
+			int32_t growth = damage[i].merged(rect).area() - damage[i].area();
+			if (growth < best_growth) {
+				best = i;
+				best_growth = growth;
+			}
+		}
+		rect = rect.merged(damage[best]);
+		damage[best] = damage[--damage_count];
+		addDamage(rect);
+	}
+
+	void sortByZ() {
+		// Insertion sort, sprites are few and mostly in order already.
+		for (uint8_t i = 0; i < count; i++) {
+			order[i] = i;
+		}
+		for (uint8_t i = 1; i < count; i++) {
+			uint8_t id = order[i];
+			uint8_t j = i;
+			for (; j > 0 && sprites[order[j - 1]].z > sprites[id].z; j--) {
+				order[j] = order[j - 1];
+			}
+			order[j] = id;
+		}
+	}
+};
+
+}
@@ -0,0 +1,225 @@
+#pragma once
+#include <Arduino.h>
+#include "gfxfont.h"
+#include "unicode.h"
+
+namespace ssd1351 {
+
+// Text alignments
+static const uint8_t ALIGN_LEFT = 0;
+static const uint8_t ALIGN_CENTER = 1;
+static const uint8_t ALIGN_RIGHT = 2;
+
+// UTF-8 text that's been laid out once: the glyph and position of every character, and the extent of every line.
+// Draw it with display.drawText(text, x, y, align) as often as needed, and use it for alignment and hit testing
+// without going through the font again. Positions are relative to the start of the first line's baseline.
+// measure() remembers what it measured last, so calling it every frame with the same text costs a single pass
+// over the string's bytes.
+// Text with more characters or lines than fit is cut off, see complete().
+template <uint8_t MAX_GLYPHS = 32, uint8_t MAX_LINES = 4>
+class MeasuredText {
+public:
+	struct Glyph {
+		const GFXglyph *glyph;
+		uint16_t code; // Code point, for the glyph cache
+		uint16_t index; // Where the character starts in the text, in bytes
+		int16_t x; // Cursor position
+		uint8_t line;
+	};
+
+	struct Line {
+		// Horizontal extent of the line's pixels, x1 is exclusive. Lines without any have x0 == x1 == 0.
+		int16_t x0;
+		int16_t x1;
+	};
+
+	bool measure(const GFXfont &_font, const char *text, uint8_t _size = 1, int16_t _wrap_width = 0, uint8_t _utf8 = UTF8_AUTO) {
+		// Lays out text in font at a text size of size. Lines wrap before characters that would end past
+		// wrap_width, 0 turns wrapping off. utf8 works like setUTF8 on the display (see unicode.h).
+		// Returns false if nothing changed since the last call.
+		bool decode = decodesUTF8(_font, _utf8);
+		uint32_t hash = 2166136261u; // 32 bit FNV-1a
+		uint16_t length = 0;
+		for (const char *c = text; *c; c++, length++) {
+			hash = (hash ^ (uint8_t)*c) * 16777619u;
+		}
+		if (font == &_font && size == _size && wrap_width == _wrap_width && utf8 == decode && text_hash == hash
+			&& text_length == length) {
+			return false;
+		}
+		if (font != &_font) {
+			font = &_font;
+			top = findFontTop(_font);
+		}
+		size = _size;
+		wrap_width = _wrap_width;
+		utf8 = decode;
+		text_hash = hash;
+		text_length = length;
+		layout(text);
+		return true;
+	}
+
+	bool complete() const {
+		// False if the text had more characters or lines than MAX_GLYPHS and MAX_LINES, the rest is missing.
+		return is_complete;
+	}
+
+	const GFXfont *getFont() const {
+		return font;
+	}
+
+	uint8_t getSize() const {
+		return size;
+	}
+
+	uint8_t glyphCount() const {
+		return glyph_count;
+	}
+
+	const Glyph &glyph(uint8_t i) const {
+		return glyphs[i];
+	}
+
+	uint8_t lineCount() const {
+		return line_count;
+	}
+
+	const Line &line(uint8_t i) const {
+		return lines[i];
+	}
+
+	int16_t lineHeight() const {
+		return font->yAdvance * size;
+	}
+
+	int16_t width() const {
+		// Width of the widest line's pixels.
+		int16_t result = 0;
+		for (uint8_t i = 0; i < line_count; i++) {
+			result = lines[i].x1 - lines[i].x0 > result ? lines[i].x1 - lines[i].x0 : result;
+		}
+		return result;
+	}
+
+	int16_t lineOffset(uint8_t i, uint8_t align) const {
+		return alignOffset(lines[i], align);
+	}
+
+	int16_t indexAt(int16_t x, int16_t y, uint8_t align = ALIGN_LEFT) const {
+		// Returns where the character at x/y (relative to where the text is drawn, with the same alignment)
+		// starts in the text, or -1 if there's none. Every character covers its line's full height and the
+		// space up to the next one.
+		int16_t line_y = y - top * size;
+		if (line_y < 0 || line_y >= line_count * lineHeight()) {
+			return -1;
+		}
+		uint8_t row = line_y / lineHeight();
+		x -= lineOffset(row, align);
+		for (uint8_t i = 0; i < glyph_count; i++) {
+			const Glyph &g = glyphs[i];
+			if (g.line == row && x >= g.x && x < g.x + g.glyph->xAdvance * size) {
+				return g.index;
+			}
+		}
+		return -1;
+	}
+
+	// The layout rules, for text too long to be measured in one go (see SSD1351::drawText).
+
+	static int16_t alignOffset(const Line &l, uint8_t align) {
+		// How far a line moves for an alignment (see ALIGN_*): centered lines have their pixels centered on the
+		// position the text is drawn at, right aligned ones end right before it.
+		return align == ALIGN_CENTER ? -(l.x1 - l.x0) / 2 - l.x0 : (align == ALIGN_RIGHT ? -l.x1 : 0);
+	}
+
+	static void extend(Line &l, const GFXglyph &glyph, int16_t cursor, uint8_t size) {
+		// Adds the pixels of a glyph drawn at cursor to a line's extent.
+		if (glyph.width && glyph.height) {
+			int16_t x0 = cursor + glyph.xOffset * size;
+			int16_t x1 = x0 + glyph.width * size;
+			bool empty = l.x0 == l.x1;
+			l.x0 = empty || x0 < l.x0 ? x0 : l.x0;
+			l.x1 = empty || x1 > l.x1 ? x1 : l.x1;
+		}
+	}
+
+	template <typename F>
+	static const char *layoutLine(const GFXfont &font, const char *text, uint8_t size, bool utf8, F &&glyph_at) {
+		// Calls glyph_at(glyph, code, cursor) for every character of the text's first line, positioned the same
+		// way measure() does without wrapping. Returns where the next line starts, or nullptr if there's none.
+		UTF8Decoder decoder;
+		int16_t cursor = 0;
+		for (; *text; text++) {
+			uint32_t code = (uint8_t)*text;
+			if (utf8 && !decoder.next(*text, code)) {
+				continue;
+			}
+			if (code == '\n') {
+				return text + 1;
+			}
+			const GFXglyph *glyph = code == '\r' ? nullptr : findGlyph(font, code);
+			if (glyph) {
+				glyph_at(*glyph, code, cursor);
+				cursor += glyph->xAdvance * size;
+			}
+		}
+		return nullptr;
+	}
+
+private:
+	const GFXfont *font = nullptr;
+	uint8_t size = 0;
+	int16_t wrap_width = 0;
+	bool utf8 = true;
+	uint32_t text_hash = 0;
+	uint16_t text_length = 0;
+	bool is_complete = true;
+	int8_t top = 0; // Highest any glyph of the font reaches above the baseline
+	Glyph glyphs[MAX_GLYPHS];
+	uint8_t glyph_count = 0;
+	Line lines[MAX_LINES];
+	uint8_t line_count = 0;
+
+	void layout(const char *text) {
+		glyph_count = 0;
+		line_count = 1;
+		lines[0] = {0, 0};
+		is_complete = true;
+
+		UTF8Decoder decoder;
+		int16_t cursor = 0;
+		uint16_t start = 0;
+		for (uint16_t i = 0; text[i]; i++) {
+			uint32_t code = (uint8_t)text[i];
+			if (utf8 && !decoder.next(text[i], code)) {
+				continue;
+			}
+			uint16_t index = start;
+			start = i + 1;
+			const GFXglyph *glyph = code == '\n' || code == '\r' ? nullptr : findGlyph(*font, code);
+			bool wraps = glyph && wrap_width > 0 && cursor > 0
+				&& cursor + (glyph->xOffset + glyph->width) * size > wrap_width;
+			if (code == '\n' || wraps) {
+				if (line_count == MAX_LINES) {
+					is_complete = false;
+					return;
+				}
+				lines[line_count++] = {0, 0};
+				cursor = 0;
+			}
+			if (!glyph) {
+				continue;
+			}
+			if (glyph_count == MAX_GLYPHS) {
+				is_complete = false;
+				return;
+			}
+			glyphs[glyph_count++] = {glyph, (uint16_t)code, index, cursor, (uint8_t)(line_count - 1)};
+			extend(lines[line_count - 1], *glyph, cursor, size);
+			cursor += glyph->xAdvance * size;
+		}
+	}
+};
+
+}
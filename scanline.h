@@ -0,0 +1,205 @@
+#pragma once
+#include <Arduino.h>
+#include "color.h"
+#include "blend.h"
+#include "convert.h"
+#include "dither.h"
+#include "sprite.h"
+#include "tilemap.h"
+#include "gfxfont.h"
+#include "unicode.h"
+#include "fontcompression.h"
+
+namespace ssd1351 {
+
+// Layers for drawLayers, which composes the screen one row at a time instead of keeping a whole frame in memory.
+// For every row, the layers are rendered into a line buffer from the first (bottom) to the last (top) one,
+// each drawing its part of the row over what the layers before left there.
+template <typename C, int16_t W>
+class ScanlineLayer {
+public:
+	virtual ~ScanlineLayer() {}
+
+	// Draws the layer's part of row y into line, which holds the W pixels of the row.
+	virtual void renderLine(C *line, int16_t y) = 0;
+
+	bool visible = true;
+};
+
+template <typename C, int16_t W>
+class SolidLayer : public ScanlineLayer<C, W> {
+public:
+	SolidLayer(const C &_color) : color(_color) {}
+
+	void renderLine(C *line, int16_t) override {
+		for (int16_t x = 0; x < W; x++) {
+			line[x] = color;
+		}
+	}
+
+	C color;
+};
+
+template <typename C, int16_t W>
+class GradientLayer : public ScanlineLayer<C, W> {
+public:
+	// A vertical gradient going from top at row y0 to bottom at row y1, with the colors repeated above and below.
+	GradientLayer(const RGB &_top, const RGB &_bottom, int16_t _y0, int16_t _y1, bool _dither = false)
+		: top(_top), bottom(_bottom), y0(_y0), y1(_y1), dither(_dither) {}
+
+	void renderLine(C *line, int16_t y) override {
+		int32_t t = y <= y0 ? 0 : (y >= y1 ? 256 : ((int32_t)(y - y0) << 8) / (y1 - y0));
+		int16_t r = top.r + ((((int16_t)bottom.r - top.r) * t) >> 8);
+		int16_t g = top.g + ((((int16_t)bottom.g - top.g) * t) >> 8);
+		int16_t b = top.b + ((((int16_t)bottom.b - top.b) * t) >> 8);
+		if (dither) {
+			for (int16_t x = 0; x < W; x++) {
+				line[x] = quantize<C>(r, g, b, bayerThreshold(x, y));
+			}
+		} else {
+			C color = quantize<C>(r, g, b);
+			for (int16_t x = 0; x < W; x++) {
+				line[x] = color;
+			}
+		}
+	}
+
+	RGB top;
+	RGB bottom;
+	int16_t y0;
+	int16_t y1;
+	bool dither;
+};
+
+template <typename C, int16_t W, uint8_t TILE_SIZE = 8>
+class TileMapLayer : public ScanlineLayer<C, W> {
+public:
+	// A tile map, scrolled so that scroll_x/scroll_y is at the top left corner of the screen.
+	TileMapLayer(const TileMap<C, TILE_SIZE> &_map) : map(_map) {}
+
+	void renderLine(C *line, int16_t y) override {
+		map.renderRow(line, scroll_x, scroll_y + y, W);
+	}
+
+	const TileMap<C, TILE_SIZE> &map;
+	int32_t scroll_x = 0;
+	int32_t scroll_y = 0;
+};
+
+template <typename C, int16_t W, typename S = C>
+class SpriteLayer : public ScanlineLayer<C, W> {
+public:
+	// A color keyed sprite (see sprite.h) with its top left corner at x/y.
+	SpriteLayer(const KeyedSprite<S> &_sprite, int16_t _x = 0, int16_t _y = 0) : sprite(_sprite), x(_x), y(_y) {}
+
+	void renderLine(C *line, int16_t row) override {
+		row -= y;
+		if (row < 0 || row >= sprite.h) {
+			return;
+		}
+		int16_t first = x < 0 ? -x : 0;
+		int16_t end = x + sprite.w > W ? W - x : sprite.w;
+		const S *pixels = sprite.pixels + row * sprite.w;
+		for (int16_t i = first; i < end; i++) {
+			if (pixels[i] != sprite.key) {
+				line[x + i] = convertColor<C>(pixels[i]);
+			}
+		}
+	}
+
+	KeyedSprite<S> sprite;
+	int16_t x;
+	int16_t y;
+};
+
+template <typename C, int16_t W, uint8_t MAX_GLYPHS = 16>
+class TextLayer : public ScanlineLayer<C, W> {
+public:
+	// A single line of text in a GFX font, starting at x with its baseline at y. The text isn't copied.
+	// Anti-aliased fonts get blended with the layers below. utf8 works like setUTF8 on the display.
+	// Run lengths of compressed fonts can't be read from the middle of a glyph, so the first MAX_GLYPHS glyphs
+	// keep a decoder that moves on from row to row. Any glyphs after those are decoded from their start on every row.
+	TextLayer(const GFXfont &_font, const char *_text, int16_t _x, int16_t _y, const C &_color)
+		: font(&_font), text(_text), x(_x), y(_y), color(_color) {}
+
+	void renderLine(C *line, int16_t row) override {
+		if (row != next_row) {
+			// Rows come one after the other while a frame is drawn, anything else starts a new one.
+			decoder_count = 0;
+		}
+		next_row = row + 1;
+		int16_t cursor = x;
+		uint8_t index = 0;
+		UTF8Decoder decoder;
+		bool decode = decodesUTF8(*font, utf8);
+		for (const char *c = text; *c && cursor < W; c++) {
+			uint32_t code = (uint8_t)*c;
+			const GFXglyph *found = !decode || decoder.next(*c, code) ? findGlyph(*font, code) : nullptr;
+			if (!found) {
+				continue;
+			}
+			const GFXglyph &glyph = *found;
+			int16_t glyph_row = row - (y + glyph.yOffset);
+			if (font->compression && index < MAX_GLYPHS) {
+				if (index == decoder_count) {
+					decoders[index] = GlyphSpans(font->bitmap + glyph.bitmapOffset, glyph.width, glyph.height);
+					has_span[index] = decoders[index].next();
+					decoder_count++;
+				}
+				drawSpans(line, decoders[index], has_span[index], glyph_row, cursor + glyph.xOffset);
+				index++;
+			} else if (glyph_row >= 0 && glyph_row < glyph.height && font->compression) {
+				GlyphSpans spans(font->bitmap + glyph.bitmapOffset, glyph.width, glyph.height);
+				bool spans_left = spans.next();
+				drawSpans(line, spans, spans_left, glyph_row, cursor + glyph.xOffset);
+			} else if (glyph_row >= 0 && glyph_row < glyph.height) {
+				// Glyph bitmaps are packed without padding, rows don't start on a new byte.
+				uint8_t bpp = font->bpp > 1 ? font->bpp : 1;
+				uint8_t full = (1 << bpp) - 1;
+				uint32_t bit = (uint32_t)glyph_row * glyph.width * bpp;
+				const uint8_t *bitmap = font->bitmap + glyph.bitmapOffset;
+				int16_t left = cursor + glyph.xOffset;
+				for (uint8_t i = 0; i < glyph.width; i++, bit += bpp) {
+					int16_t px = left + i;
+					uint8_t coverage = (pgm_read_byte(bitmap + (bit >> 3)) >> (8 - bpp - (bit & 7))) & full;
+					if (px < 0 || px >= W || !coverage) {
+						continue;
+					}
+					line[px] = coverage == full ? color : blend(line[px], color, coverage * 255 / full);
+				}
+			}
+			cursor += glyph.xAdvance;
+		}
+	}
+
+	const GFXfont *font;
+	const char *text;
+	int16_t x;
+	int16_t y;
+	C color;
+	uint8_t utf8 = UTF8_AUTO;
+
+private:
+	GlyphSpans decoders[MAX_GLYPHS];
+	bool has_span[MAX_GLYPHS];
+	uint8_t decoder_count = 0;
+	int16_t next_row = 0;
+
+	void drawSpans(C *line, GlyphSpans &spans, bool &spans_left, int16_t glyph_row, int16_t left) {
+		// Skips the spans above glyph_row and draws the ones on it, leaving spans at the first one below.
+		while (spans_left && spans.row < glyph_row) {
+			spans_left = spans.next();
+		}
+		while (spans_left && spans.row == glyph_row) {
+			for (uint8_t i = 0; i < spans.length; i++) {
+				int16_t px = left + spans.col + i;
+				if (px >= 0 && px < W) {
+					line[px] = color;
+				}
+			}
+			spans_left = spans.next();
+		}
+	}
+};
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <Arduino.h>
+#include "color.h"
+
+namespace ssd1351 {
+
+// Sprites are bitmaps with transparent pixels, drawn with drawSprite. The pixels can be of any color type
+// (or RGB) and are converted to the display's color type while drawing.
+
+template <typename S>
+struct KeyedSprite {
+	// w * h pixels, row by row. Pixels equal to key are transparent.
+	const S *pixels;
+	int16_t w;
+	int16_t h;
+	S key;
+};
+
+template <typename S>
+struct MaskedSprite {
+	// w * h pixels, row by row, and a 1 bit mask in the same layout drawBitmap uses: every row starts on a new
+	// byte, the most significant bit is the leftmost pixel. Pixels whose bit is cleared are transparent.
+	const S *pixels;
+	const uint8_t *mask;
+	int16_t w;
+	int16_t h;
+};
+
+template <typename S>
+struct RLESprite {
+	// Run length encoded sprite. For every row, runs holds pairs of counts: first the number of transparent
+	// pixels to skip, then the number of opaque pixels that follow. The pairs of a row add up to exactly w pixels.
+	// Runs longer than 255 pixels are split with pairs that have a count of 0.
+	// pixels only holds the opaque pixels, one run after the other. Use util/encode_sprite.py to create these.
+	const uint8_t *runs;
+	const S *pixels;
+	int16_t w;
+	int16_t h;
+};
+
+}
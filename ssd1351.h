@@ -21,6 +21,20 @@ MIT license, all text above must be included in any redistribution
 #include <string>
 #include <SPI.h>
 #include "color.h"
+#include "blend.h"
+#include "convert.h"
+#include "dither.h"
+#include "gamma.h"
+#include "sprite.h"
+#include "transform.h"
+#include "layers.h"
+#include "tilemap.h"
+#include "scanline.h"
+#include "glyphcache.h"
+#include "unicode.h"
+#include "fontcompression.h"
+#include "measuredtext.h"
+#include "terminal.h"
 #include "buffer.h"
 #include "gfxfont.h"
 #include "Fonts/all_fonts.h"
@@ -43,6 +57,8 @@ template <typename T> void __attribute__((always_inline)) swap(T &a, T &b) {
 // Taken from http://lists.boost.org/Archives/boost/2014/08/215954.php
 #define REQUIRES(...) typename std::enable_if<(__VA_ARGS__), int>::type = 0
 #define MEMBER_REQUIRES(...) template<bool HiddenMemberBool=true, REQUIRES(HiddenMemberBool && (__VA_ARGS__))>
+// Same thing for member templates that need an additional type parameter, like a callable.
+#define MEMBER_REQUIRES_WITH(T, ...) template<typename T, bool HiddenMemberBool=true, REQUIRES(HiddenMemberBool && (__VA_ARGS__))>
 
 namespace ssd1351 {
 
@@ -73,11 +89,11 @@ namespace ssd1351 {
 #define CMD_ROW_ADDRESS 0x75 // Set start and end row of active video RAM area
 #define CMD_WRITE_TO_RAM 0x5C // Start writing to the video ram. After this, color data can be sent.
 #define CMD_NOOP 0xAD // Sometimes used as a last command - doesn't do anything.
-
-// Text alignments
-static const uint8_t ALIGN_LEFT = 0;
-static const uint8_t ALIGN_CENTER = 1;
-static const uint8_t ALIGN_RIGHT = 2;
+#define CMD_GRAYSCALE_TABLE 0xB8 // Set the gray scale lookup table, followed by 63 pulse widths for gray levels 1-63
+#define CMD_LINEAR_GRAYSCALE 0xB9 // Reset the gray scale lookup table to the built-in linear one
+#define GRAYSCALE_TABLE_SIZE 63
+#define CMD_CONTRAST 0xC1 // Set the contrast current of the three color channels (sent in A, B, C order, which is blue, green, red)
+#define CMD_MASTER_CURRENT 0xC7 // Set the master current (0-15), which scales the contrast of all channels
 
 static const uint8_t HIGH_COLOR = 0;
 static const uint8_t LOW_COLOR = 1;
@@ -93,6 +109,91 @@ struct Rect {
 	int16_t h;
 };
 
+struct Point {
+	int16_t x;
+	int16_t y;
+};
+
+// Sub-pixel precision used by fillTriangleSubpixel and fillTriangles - coordinates are in 1/16th of a pixel.
+static const uint8_t SUBPIXEL_BITS = 4;
+
+struct EdgeWalker {
+	// Steps x0 + dx * i / dy (rounded towards zero) for i = 0, 1, 2, ... using a quotient and a
+	// remainder, Bresenham style, so only the constructor needs to divide.
+	int16_t x;
+
+	EdgeWalker(int16_t x0, int16_t dx, int16_t _dy) : x(x0), dy(_dy ? _dy : 1), dir(dx < 0 ? -1 : 1) {
+		if (dx < 0) {
+			dx = -dx;
+		}
+		quotient = _dy ? dx / dy : 0;
+		remainder = _dy ? dx % dy : 0;
+	}
+
+	void __attribute__((always_inline)) step() {
+		x += dir * quotient;
+		error += remainder;
+		if (error >= dy) {
+			error -= dy;
+			x += dir;
+		}
+	}
+
+private:
+	int16_t dy;
+	int16_t dir;
+	int16_t quotient;
+	int16_t remainder;
+	int16_t error = 0;
+};
+
+struct SubpixelEdge {
+	// An edge between two sub-pixel vertices (ya <= yb), sampled at pixel row centers.
+	// Rows first_row up to (but excluding) end_row are crossed by the edge, x is kept in 16.16 fixed point.
+	int16_t first_row;
+	int16_t end_row;
+	int32_t x_first;
+	int32_t step;
+
+	SubpixelEdge(int16_t xa, int16_t ya, int16_t xb, int16_t yb) {
+		// A row is crossed if its center (row * 16 + 8) lies in [ya, yb), which is what makes
+		// top edges inclusive and bottom edges exclusive.
+		first_row = (ya + 7) >> SUBPIXEL_BITS;
+		end_row = (yb + 7) >> SUBPIXEL_BITS;
+		if (yb == ya) {
+			step = 0;
+			x_first = (int32_t)xa << (16 - SUBPIXEL_BITS);
+			return;
+		}
+		step = ((int64_t)(xb - xa) << 16) / (yb - ya);
+		int16_t first_center = (first_row << SUBPIXEL_BITS) + (1 << (SUBPIXEL_BITS - 1));
+		x_first = ((int32_t)xa << (16 - SUBPIXEL_BITS)) + (int32_t)(((int64_t)step * (first_center - ya)) >> SUBPIXEL_BITS);
+	}
+
+	int32_t __attribute__((always_inline)) xAt(int16_t row) const {
+		return x_first + (row - first_row) * step;
+	}
+};
+
+inline uint32_t isqrt(uint32_t value) {
+	// Integer square root (rounded down), computed bit by bit without any divisions.
+	uint32_t result = 0;
+	uint32_t bit = 1UL << 30;
+	while (bit > value) {
+		bit >>= 2;
+	}
+	while (bit) {
+		if (value >= result + bit) {
+			value -= result + bit;
+			result = (result >> 1) + bit;
+		} else {
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	return result;
+}
+
 template <typename C, typename B, int W = 128, int H = 128>
 class SSD1351 : public Print {
 public:
@@ -174,7 +275,7 @@ public:
 
 		// Set start line - this needs to be 0 for a 128x128 display and 96 for a 128x96 display
 		sendCommandAndContinue(CMD_START_LINE);
-		sendDataAndContinue(H == 128 ? 0 : 96);
+		sendDataAndContinue(startLine());
 
 		// Set display offset - this is always zero
 		sendCommandAndContinue(CMD_DISPLAY_OFFSET);
@@ -184,6 +285,11 @@ public:
 		sendCommandAndContinue(CMD_FUNCTION_SELECTION);
 		sendDataAndContinue(INTERNAL_VREG);
 
+		// Set contrast and master current to their reset values, so they're in a known state for setBrightness()
+		sendContrastAndContinue();
+		sendCommandAndContinue(CMD_MASTER_CURRENT);
+		sendDataAndContinue(0x0F);
+
 		// Set display to normal operation and leave sleep mode
 		sendCommandAndContinue(CMD_NORMAL_MODE);
 		sendLastCommand(CMD_DISPLAY_WAKE);
@@ -197,6 +303,124 @@ public:
 		SPI.endTransaction();
 	}
 
+	void setRotation(uint8_t new_rotation) {
+		// Rotates the picture clockwise by 0, 90, 180 or 270 degrees (0 to 3), for panels that are mounted sideways
+		// or upside down. This only changes how the display maps its RAM to the panel, so it doesn't cost anything
+		// while drawing, and whatever is in the RAM already gets turned at once.
+		// For rotations by 90 or 270 degrees, W and H need to be the rotated size (e.g. 96 x 128 for a 128 x 96 panel).
+		// The display then fills windows column by column (vertical address increment) and gets sent columns for rows
+		// and rows for columns, so all drawing code stays the same.
+		rotation = new_rotation & 3;
+		sendOrientation();
+	}
+
+	uint8_t getRotation() const {
+		return rotation;
+	}
+
+	void setMirror(bool horizontal, bool vertical) {
+		// Mirrors the picture on the panel, on top of the rotation. Doesn't cost anything while drawing either.
+		mirror_x = horizontal;
+		mirror_y = vertical;
+		sendOrientation();
+	}
+
+	void setScrollLine(uint8_t line) {
+		// Scrolls the picture up by line rows in hardware, with the rows at the top coming back in at the bottom
+		// (of the 128 rows of video RAM, so on 128x96 panels there are 32 rows nobody sees in between).
+		// Nothing else takes this into account when drawing, so set it back to 0 before drawing anything but
+		// terminals, which use it for scrolling (see drawTerminal).
+		scroll_line = line & 127;
+		sendOrientation();
+	}
+
+	uint8_t getScrollLine() {
+		return scroll_line;
+	}
+
+	void setGrayscaleTable(const uint8_t *table) {
+		// Uploads a gray scale lookup table to the display: 63 strictly increasing pulse widths (up to 180)
+		// for the gray levels 1 to 63 of every channel. This applies gamma correction in the display
+		// itself, so it doesn't cost anything per pixel and can be swapped at any time.
+		// The table can be in flash, see gamma.h and util/generate_gamma_table.py.
+		SPI.beginTransaction(spi_settings);
+		sendCommandAndContinue(CMD_GRAYSCALE_TABLE);
+		for (uint8_t i = 0; i < GRAYSCALE_TABLE_SIZE - 1; i++) {
+			sendDataAndContinue(pgm_read_byte(table + i));
+		}
+		sendLastData(pgm_read_byte(table + GRAYSCALE_TABLE_SIZE - 1));
+		SPI.endTransaction();
+	}
+
+	void setContrast(uint8_t r, uint8_t g, uint8_t b) {
+		// Sets the full brightness contrast current of each channel, which determines the white point.
+		// setBrightness() scales these.
+		contrast[0] = r;
+		contrast[1] = g;
+		contrast[2] = b;
+		setBrightness(brightness);
+	}
+
+	void setMasterCurrent(uint8_t current) {
+		// Coarse brightness control for all channels at once, from 0 to 15 (the default).
+		SPI.beginTransaction(spi_settings);
+		sendCommandAndContinue(CMD_MASTER_CURRENT);
+		sendLastData(current & 0x0F);
+		SPI.endTransaction();
+	}
+
+	void setBrightness(uint8_t level) {
+		// Sets the brightness of the whole display (0-255) through the contrast registers.
+		// This only costs a few command bytes, nothing needs to be redrawn.
+		brightness = level;
+		SPI.beginTransaction(spi_settings);
+		sendContrastAndContinue();
+		sendLastCommand(CMD_NOOP);
+		SPI.endTransaction();
+	}
+
+	uint8_t getBrightness() const {
+		return brightness;
+	}
+
+	void fadeTo(uint8_t level, uint16_t duration_ms) {
+		// Starts fading the brightness to level over duration_ms. The fade is stepped by updateFade(),
+		// which needs to be called regularly, e.g. once per frame from the main loop or from a timer.
+		fade_from = brightness;
+		fade_to = level;
+		fade_start = millis();
+		fade_duration = duration_ms;
+		if (!duration_ms) {
+			setBrightness(level);
+		}
+	}
+
+	bool updateFade() {
+		// Moves a fade started with fadeTo() along, only talking to the display when the brightness changes.
+		// Returns whether the fade is still going.
+		if (!fade_duration) {
+			return false;
+		}
+		uint32_t elapsed = millis() - fade_start;
+		uint8_t level = fade_to;
+		if (elapsed < fade_duration) {
+			level = fade_from + ((int32_t)fade_to - fade_from) * (int32_t)elapsed / fade_duration;
+		} else {
+			fade_duration = 0;
+		}
+		if (level != brightness) {
+			setBrightness(level);
+		}
+		return fade_duration != 0;
+	}
+
+	void useLinearGrayscale() {
+		// Switches back to the display's built-in linear gray scale table.
+		SPI.beginTransaction(spi_settings);
+		sendLastCommand(CMD_LINEAR_GRAYSCALE);
+		SPI.endTransaction();
+	}
+
 	void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, const C &color) {
 		drawFastHLine(x, y, w, color);
 		drawFastHLine(x, y + h - 1, w, color);
@@ -335,22 +559,16 @@ public:
 			return;
 		}
 
-		int16_t
-		dx01 = x1 - x0,
-		dy01 = y1 - y0,
-		dx02 = x2 - x0,
-		dy02 = y2 - y0,
-		dx12 = x2 - x1,
-		dy12 = y2 - y1,
-		sa   = 0,
-		sb   = 0;
+		// Each edge is walked with a quotient/remainder stepper, which gives exactly the same
+		// x0 + dx * (y - y0) / dy as the original per-scanline division, but only divides once per edge.
+		EdgeWalker e01(x0, x1 - x0, y1 - y0);
+		EdgeWalker e02(x0, x2 - x0, y2 - y0);
+		EdgeWalker e12(x1, x2 - x1, y2 - y1);
 
 		// For upper part of triangle, find scanline crossings for segments
 		// 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-		// is included here (and second loop will be skipped, avoiding a /0
-		// error there), otherwise scanline y1 is skipped here and handled
-		// in the second loop...which also avoids a /0 error here if y0=y1
-		// (flat-topped triangle).
+		// is included here (and second loop will be skipped), otherwise
+		// scanline y1 is skipped here and handled in the second loop.
 		if(y1 == y2) {
 			last = y1;   // Include y1 scanline
 		} else {
@@ -358,14 +576,10 @@ public:
 		}
 
 		for(y = y0; y <= last; y++) {
-			a   = x0 + sa / dy01;
-			b   = x0 + sb / dy02;
-			sa += dx01;
-			sb += dx02;
-			/* longhand:
-			a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
-			b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-			*/
+			a = e01.x;
+			b = e02.x;
+			e01.step();
+			e02.step();
 			if(a > b) {
 				swap(a,b);
 			}
@@ -374,17 +588,11 @@ public:
 
 		// For lower part of triangle, find scanline crossings for segments
 		// 0-2 and 1-2.  This loop is skipped if y1=y2.
-		sa = dx12 * (y - y1);
-		sb = dx02 * (y - y0);
 		for(; y <= y2; y++) {
-			a   = x1 + sa / dy12;
-			b   = x0 + sb / dy02;
-			sa += dx12;
-			sb += dx02;
-			/* longhand:
-			a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
-			b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-			*/
+			a = e12.x;
+			b = e02.x;
+			e12.step();
+			e02.step();
 			if(a > b) {
 				swap(a,b);
 			}
@@ -392,6 +600,73 @@ public:
 		}
 	}
 
+	void fillTriangleSubpixel(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, const C &color) {
+		// Fills a triangle given in sub-pixel coordinates (1/16th of a pixel, see SUBPIXEL_BITS).
+		// Pixels are sampled at their centers and the top-left fill rule is applied: a pixel whose center
+		// lies exactly on a top or left edge is drawn, one on a bottom or right edge isn't.
+		// Triangles sharing an edge therefore never draw the same pixel twice and never leave a gap,
+		// which makes this the right primitive for meshes (see fillTriangles()).
+
+		// Sort coordinates by Y order (y2 >= y1 >= y0)
+		if (y0 > y1) {
+			swap(y0, y1); swap(x0, x1);
+		}
+		if (y1 > y2) {
+			swap(y2, y1); swap(x2, x1);
+		}
+		if (y0 > y1) {
+			swap(y0, y1); swap(x0, x1);
+		}
+
+		// Which side the middle vertex is on decides which edges are left and right edges.
+		// Zero area triangles don't cover any pixel centers.
+		int32_t area = (int32_t)(x2 - x0) * (y1 - y0) - (int32_t)(y2 - y0) * (x1 - x0);
+		if (area == 0) {
+			return;
+		}
+		bool middle_is_left = area > 0;
+
+		SubpixelEdge e02(x0, y0, x2, y2);
+		SubpixelEdge e01(x0, y0, x1, y1);
+		SubpixelEdge e12(x1, y1, x2, y2);
+
+		// Rows of the two short edges partition the rows of the long edge, so the long edge can simply
+		// be stepped from top to bottom while switching short edges at the middle vertex.
+		int16_t y = e02.first_row < 0 ? 0 : e02.first_row;
+		int16_t last = e02.end_row > H ? H : e02.end_row;
+		if (y >= last) {
+			return;
+		}
+		SubpixelEdge *short_edge = (y < e01.end_row) ? &e01 : &e12;
+		int32_t long_x = e02.xAt(y);
+		int32_t short_x = short_edge->xAt(y);
+		for (; y < last; y++) {
+			if (y == e01.end_row) {
+				short_edge = &e12;
+				short_x = e12.xAt(y);
+			}
+			if (middle_is_left) {
+				fillSpan(short_x, long_x, y, color);
+			} else {
+				fillSpan(long_x, short_x, y, color);
+			}
+			long_x += e02.step;
+			short_x += short_edge->step;
+		}
+	}
+
+	void fillTriangles(const Point *vertices, const uint16_t *indices, uint16_t triangle_count, const C &color) {
+		// Fills a mesh of triangles sharing vertices. Vertices are given in sub-pixel coordinates
+		// (see fillTriangleSubpixel), each triangle is three consecutive entries in indices.
+		// Thanks to the top-left fill rule shared edges are drawn exactly once.
+		while (triangle_count--) {
+			const Point &a = vertices[*indices++];
+			const Point &b = vertices[*indices++];
+			const Point &c = vertices[*indices++];
+			fillTriangleSubpixel(a.x, a.y, b.x, b.y, c.x, c.y, color);
+		}
+	}
+
 	void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, const C &color) {
 		drawFastHLine(x + r, y, w - 2 * r, color); // Top
 		drawFastHLine(x + r, y + h - 1, w - 2 * r, color); // Bottom
@@ -413,15 +688,11 @@ public:
 	}
 
 	void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, const C &color) {
-		int16_t i, j, byteWidth = (w + 7) / 8;
-
-		for(j = 0; j < h; j++) {
-			for(i = 0; i < w; i++) {
-				if(pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-					drawPixel(x + i, y + j, color);
-				}
-			}
-		}
+		// Draws color wherever the 1 bit bitmap is set, leaving the other pixels alone.
+		// Runs of set bits are drawn as lines, see forEachBitRun.
+		forEachBitRun(x, y, bitmap, w, h, [this, &color](int16_t run_x, int16_t run_y, int16_t length) {
+			drawFastHLine(run_x, run_y, length, color);
+		});
 	}
 
 	static int16_t getWidth(void)  { return W; }
@@ -462,45 +733,71 @@ public:
 	}
 
 	void cp437(bool use_cp437 = true) {
-		cp437 = use_cp437;
+		_cp437 = use_cp437;
+	}
+
+	void setUTF8(uint8_t mode = UTF8_ON) {
+		// By default (UTF8_AUTO), text in fonts with extra ranges (made with fontconvert -u) is decoded as UTF-8,
+		// so it can use their characters, and every byte is a character of its own in all other fonts.
+		// setUTF8(true) or setUTF8(false) always or never decodes UTF-8, see unicode.h.
+		utf8 = mode;
 	}
 
 	void setFont(const GFXfont &new_font) {
 	    font = (GFXfont *)&new_font;
 	}
 
-	void drawText(const char *str, int16_t x, int16_t y, uint8_t align=ALIGN_LEFT) {
-		uint8_t string_length = strlen(str);
-
-		Rect bounds = getTextBounds(str, x, y);
-
-		// Store previous settings for cursor and wrapping
-		uint8_t prev_cursor_x = cursor_x;
-		uint8_t prev_cursor_y = cursor_y;
-		bool prevWrap = wrap;
-
+	void setGlyphCache(GlyphCache<C> *cache) {
+		// Opaque text gets drawn from the cache (see glyphcache.h), nullptr turns caching off again.
+		glyph_cache = cache;
+	}
 
-		// Set cursor and disable wrapping
-		switch(align) {
-			case ALIGN_LEFT:
-				cursor_x = x;
-				break;
-			case ALIGN_CENTER:
-				cursor_x = x - bounds.w / 2 - (bounds.x - x);
-				break;
-			case ALIGN_RIGHT:
-				cursor_x = x - bounds.w;
-				break;
+	void drawText(const char *str, int16_t x, int16_t y, uint8_t align=ALIGN_LEFT) {
+		// Lays the text out once and draws it from that, see measuredtext.h. Lines are aligned one by one and
+		// don't wrap. Text too long for that is laid out by the same rules a line at a time, going over every
+		// line twice: once to measure it, once to draw it.
+		MeasuredText<> text;
+		text.measure(*font, str, text_size, 0, utf8);
+		if (text.complete()) {
+			drawText(text, x, y, align);
+			return;
 		}
-		cursor_y = y;
-		wrap = false;
 
-		print(str);
+		typedef MeasuredText<> Layout;
+		bool decode = decodesUTF8(*font, utf8);
+		for (const char *line = str; line; y += font->yAdvance * text_size) {
+			Layout::Line extent = {0, 0};
+			Layout::layoutLine(*font, line, text_size, decode, [&](const GFXglyph &glyph, uint32_t, int16_t cursor) {
+				Layout::extend(extent, glyph, cursor, text_size);
+			});
+			int16_t line_x = x + Layout::alignOffset(extent, align);
+			line = Layout::layoutLine(*font, line, text_size, decode, [&](const GFXglyph &glyph, uint32_t c, int16_t cursor) {
+				drawGlyph(line_x + cursor, y, glyph, c, text_color, text_bg_color, text_size);
+			});
+		}
+	}
 
-		// Restore previous cursor and wrap setting
-		cursor_x = prev_cursor_x;
-		cursor_y = prev_cursor_y;
-		wrap = prevWrap;
+	template <uint8_t MAX_GLYPHS, uint8_t MAX_LINES>
+	void drawText(const MeasuredText<MAX_GLYPHS, MAX_LINES> &text, int16_t x, int16_t y, uint8_t align=ALIGN_LEFT) {
+		// Draws text measured before in the current text colors, with the font and size it was measured with.
+		// x/y is where the first line's baseline starts (or is centered, or ends).
+		if (!text.getFont()) {
+			return;
+		}
+		GFXfont *previous_font = font;
+		font = (GFXfont *)text.getFont();
+		int16_t offsets[MAX_LINES];
+		for (uint8_t i = 0; i < text.lineCount(); i++) {
+			offsets[i] = text.lineOffset(i, align);
+		}
+		for (uint8_t i = 0; i < text.glyphCount(); i++) {
+			const auto &g = text.glyph(i);
+			drawGlyph(
+				x + g.x + offsets[g.line], y + g.line * text.lineHeight(), *g.glyph, g.code, text_color, text_bg_color,
+				text.getSize()
+			);
+		}
+		font = previous_font;
 	}
 
 	uint16_t getTextWidth(const char *str) {
@@ -509,10 +806,9 @@ public:
 
 	// Pass string and a cursor position, returns UL corner and W,H.
 	Rect getTextBounds(const char *str, int16_t x, int16_t y) {
-		uint8_t c; // Current character
-		GFXglyph *glyph;
-		uint8_t first = font->first;
-		uint8_t last  = font->last;
+		uint32_t c; // Current character
+		const GFXglyph *glyph;
+		UTF8Decoder decoder;
 		int16_t min_x = W;
 		int16_t min_y = H;
 		int16_t max_x = -1;
@@ -524,16 +820,17 @@ public:
 		int16_t glyph_x2 = 0;
 		int16_t glyph_y2 = 0;
 
-		while((c = *str++)) {
+		bool decode = decodesUTF8(*font, utf8);
+		while((c = (uint8_t)*str++)) {
+			if(decode && !decoder.next(c, c)) {
+				continue;
+			}
 			if(c != '\n') { // Not a newline
-				if((c == '\r') || (c < font->first) || (c > font->last)) {
+				if((c == '\r') || !(glyph = findGlyph(*font, c))) {
 					// Char not present in current font
 					continue;
 				}
 
-				c -= font->first;
-				glyph = &(font->glyph[c]);
-
 				if(wrap && (x + (glyph->xOffset + glyph->width) * text_size >= W)) {
 					// Line wrap
 					x  = line_start_x;  // Reset x to 0
@@ -556,7 +853,7 @@ public:
 					max_y = glyph_y2;
 				}
 
-				if ((font != &TomThumb) || *(str + 1)) {
+				if ((font != &TomThumb) || *str) {
 					x += glyph->xAdvance * text_size;
 				}
 			} else { // Newline
@@ -568,22 +865,26 @@ public:
 		return {min_x, min_y, max_x - min_x + 1, max_y - min_y + 1};
 	}
 
-	size_t write(uint8_t c) {
+	size_t write(uint8_t byte) {
 		if(!font) {
 			return 1;
 		}
 
+		uint32_t c = byte;
+		if(decodesUTF8(*font, utf8) && !utf8_decoder.next(byte, c)) {
+			return 1; // In the middle of a character
+		}
+
 		if(c == '\n') {
 			cursor_x = line_start_x;
 			cursor_y += (int16_t)text_size * (uint8_t)font->yAdvance;
 		} else if(c != '\r') {
-			uint8_t first = font->first;
-			if((c >= first) && (c <= font->last)) {
-				uint8_t c2 = c - font->first;
-				GFXglyph *glyph = &(font->glyph[c2]);
+			const GFXglyph *glyph = findGlyph(*font, c);
+			if(glyph) {
 				uint8_t w = glyph->width;
 				uint8_t h = glyph->height;
-				if((w > 0) && (h > 0)) { // Is there an associated bitmap?
+				bool opaque = text_bg_color != text_color;
+				if(((w > 0) && (h > 0)) || opaque) { // Is there an associated bitmap, or a background to draw?
 					int16_t xo = glyph->xOffset; // sic
 					if(wrap && ((cursor_x + text_size * (xo + w)) >= W)) {
 						// Drawing character would go off right edge; wrap to new line
@@ -599,49 +900,37 @@ public:
 		return 1;
 	}
 
-	void drawChar(int16_t x, int16_t y, unsigned char c, C color, C bg, uint8_t size) {
-		if (!font) {
-			return;
+	void drawChar(int16_t x, int16_t y, uint32_t c, C color, C bg, uint8_t size) {
+		// c is a Unicode code point (or just a character for plain fonts). Characters the font doesn't have
+		// are skipped.
+		const GFXglyph *glyph = font ? findGlyph(*font, c) : nullptr;
+		if (glyph) {
+			drawGlyph(x, y, *glyph, c, color, bg, size);
 		}
-		// Character is assumed previously filtered by write() to eliminate
-		// newlines, returns, non-printable characters, etc.  Calling drawChar()
-		// directly with 'bad' characters of font may cause mayhem!
-
-		c -= font->first;
-		GFXglyph *glyph = &(font->glyph[c]);
-		uint8_t *bitmap = font->bitmap;
-
-		uint16_t bo = glyph->bitmapOffset;
-		uint8_t w = glyph->width;
-		uint8_t h = glyph->height;
-		int8_t xo = glyph->xOffset;
-		int8_t yo = glyph->yOffset;
-		uint8_t xx = 0;
-		uint8_t yy = 0;
-		uint8_t bits = 0;
-		uint8_t bit = 0;
-		int16_t xo16 = 0;
-		int16_t yo16 = 0;
-
-		if(size > 1) {
-			xo16 = xo;
-			yo16 = yo;
-		}
-
-		for(yy=0; yy<h; yy++) {
-			for(xx=0; xx<w; xx++) {
-				if(!(bit++ & 7)) {
-					bits = bitmap[bo++];
-				}
-				if(bits & 0x80) {
-					if(size == 1) {
-						drawPixel(x+xo+xx, y+yo+yy, color);
-					} else {
-						fillRect(x+(xo16+xx)*size, y+(yo16+yy)*size, size, size, color);
-					}
-				}
-				bits <<= 1;
+	}
+
+	void drawGlyph(int16_t x, int16_t y, const GFXglyph &glyph, uint32_t c, const C &color, const C &bg, uint8_t size) {
+		// Draws a glyph of the current font with the cursor at x/y. c is its code point, for the glyph cache.
+		int16_t left = x + glyph.xOffset * size;
+		int16_t top = y + glyph.yOffset * size;
+
+		if (bg != color) {
+			// Opaque text fills the character's whole cell: from the cursor to the next one (or further if the glyph
+			// sticks out), and from the top of the font's highest glyph down one line height. The cell gets written
+			// in one go, in NoBuffer mode as a single window, so text can be overwritten without erasing it first.
+			int16_t right = x + glyph.xAdvance * size;
+			int16_t glyph_right = left + glyph.width * size;
+			int16_t cell_x = left < x ? left : x;
+			int16_t cell_y = y + fontTop() * size;
+			int16_t cell_w = (glyph_right > right ? glyph_right : right) - cell_x;
+			int16_t cell_h = font->yAdvance * size;
+			if (glyph_cache && cell_w <= W) {
+				drawGlyphCached(glyph, c, left, top, cell_x, cell_y, cell_w, cell_h, color, bg, size);
+			} else {
+				drawGlyphOpaque(glyph, left, top, cell_x, cell_y, cell_w, cell_h, color, bg, size);
 			}
+		} else {
+			drawGlyphRuns(glyph, left, top, color, size);
 		}
 	}
 
@@ -653,6 +942,16 @@ public:
 
 	#include "ssd1351_nobuffer.inl"
 	#include "ssd1351_singlebuffer.inl"
+	#include "ssd1351_antialiased.inl"
+	#include "ssd1351_gradient.inl"
+	#include "ssd1351_dither.inl"
+	#include "ssd1351_bitmap.inl"
+	#include "ssd1351_sprite.inl"
+	#include "ssd1351_transform.inl"
+	#include "ssd1351_tilemap.inl"
+	#include "ssd1351_scanline.inl"
+	#include "ssd1351_text.inl"
+	#include "ssd1351_terminal.inl"
 
 private:
 	typedef std::array<C, W * H> ArrayType;
@@ -681,7 +980,214 @@ private:
 	uint8_t text_size = 1;
 	bool wrap = true;   // If set, 'wrap' text at right edge of display
 	bool _cp437 = false; // If set, use correct CP437 charset (default is off)
+	uint8_t utf8 = UTF8_AUTO; // Whether text is decoded as UTF-8, see setUTF8
+	UTF8Decoder utf8_decoder; // Keeps track of characters split between write() calls
 	GFXfont *font = (GFXfont *)&TomThumb;
+	const GFXfont *font_top_font = nullptr; // The font font_top was found for
+	int8_t font_top = 0;
+	C text_ramp[16]; // Colors for every coverage level of anti-aliased text, see textRamp()
+	C ramp_color = black;
+	C ramp_bg = black;
+	uint8_t ramp_bpp = 0; // 0 until text_ramp is filled in
+	GlyphCache<C> *glyph_cache = nullptr;
+
+	// Orientation, see setRotation() and setMirror()
+	uint8_t rotation = 0;
+	bool mirror_x = false;
+	bool mirror_y = false;
+	uint8_t scroll_line = 0; // Hardware scrolling, see setScrollLine()
+
+	// Brightness control. The contrast values are the display's reset values, in red, green, blue order.
+	uint8_t contrast[3] = {0x8A, 0x51, 0x8A};
+	uint8_t brightness = 255;
+	uint8_t fade_from = 255;
+	uint8_t fade_to = 255;
+	uint32_t fade_start = 0;
+	uint16_t fade_duration = 0;
+
+	void sendContrastAndContinue() {
+		// The display expects the contrast for channels A, B and C, which are blue, green and red
+		// because the color sequence is swapped in the remap settings.
+		sendCommandAndContinue(CMD_CONTRAST);
+		sendDataAndContinue((contrast[2] * (brightness + 1)) >> 8);
+		sendDataAndContinue((contrast[1] * (brightness + 1)) >> 8);
+		sendDataAndContinue((contrast[0] * (brightness + 1)) >> 8);
+	}
+
+	uint8_t orientedRemap(uint8_t remap) {
+		// Applies the rotation and mirroring to the display's remap settings (see begin()).
+		// Relative to the default settings, bit 1 mirrors the columns, bit 4 mirrors the rows (COM scan direction)
+		// and bit 0 switches to vertical address increment. Rotations by 90 degrees swap rows and columns (transpose)
+		// and then mirror one of them.
+		bool flip_x = (rotation == 1 || rotation == 2) != mirror_x;
+		bool flip_y = (rotation == 2 || rotation == 3) != mirror_y;
+		return remap ^ (flip_x ? 0x02 : 0) ^ (flip_y ? 0x10 : 0) ^ (rotation & 1 ? 0x01 : 0);
+	}
+
+	uint8_t startLine() {
+		// 128x96 panels show RAM rows 0 to 95 when starting at line 96 with the default (reversed) COM scan direction,
+		// with the rows mirrored they need to start at line 0.
+		uint8_t panel_height = rotation & 1 ? W : H;
+		bool flip_y = (rotation == 2 || rotation == 3) != mirror_y;
+		return ((panel_height == 128 || flip_y ? 0 : 96) + scroll_line) & 127;
+	}
+
+	void sendOrientation() {
+		SPI.beginTransaction(spi_settings);
+		setColorDepth();
+		sendCommandAndContinue(CMD_START_LINE);
+		sendLastData(startLine());
+		SPI.endTransaction();
+	}
+
+	template <typename F>
+	void sendRect(int16_t x, int16_t y, int16_t w, int16_t h, F &pixels) {
+		// Sends w * h pixels, produced one by one by calling pixels(), row by row into a single video ram window,
+		// bypassing the frame buffer. x and y are in video ram rows and columns, which are only the same as screen
+		// coordinates while the start line doesn't scroll.
+		SPI.beginTransaction(spi_settings);
+		setVideoRamPosition(x, y, x + w - 1, y + h - 1);
+		sendCommandAndContinue(CMD_WRITE_TO_RAM);
+		for(y = h; y > 0; --y) {
+			for(x = w; x > 1; --x) {
+				pushColor(pixels());
+			}
+			pushColor(pixels(), true);
+			// At the end of every row, end the transaction to give other SPI devices a chance to communicate.
+			SPI.endTransaction();
+
+			// Start a new transaction, unless this is the last row
+			if (y > 1) {
+				SPI.beginTransaction(spi_settings);
+			}
+		}
+	}
+
+	uint8_t fontBpp() {
+		// Fonts made before anti-aliasing was supported leave bpp at 0.
+		return font->bpp > 1 ? font->bpp : 1;
+	}
+
+	const C *textRamp(const C &color, const C &bg) {
+		// The colors opaque text uses for every coverage level of the current font, from bg (nothing covered) to color
+		// (fully covered). They're only recalculated when the colors or the font's bits per pixel change.
+		uint8_t bpp = fontBpp();
+		if (bpp != ramp_bpp || color != ramp_color || bg != ramp_bg) {
+			uint8_t full = (1 << bpp) - 1;
+			text_ramp[0] = bg;
+			for (uint8_t i = 1; i < full; i++) {
+				text_ramp[i] = blend(bg, color, i * 255 / full);
+			}
+			text_ramp[full] = color;
+			ramp_bpp = bpp;
+			ramp_color = color;
+			ramp_bg = bg;
+		}
+		return text_ramp;
+	}
+
+	int8_t fontTop() {
+		// The highest any glyph of the current font reaches above the baseline (as a negative offset).
+		if (font != font_top_font) {
+			font_top = findFontTop(*font);
+			font_top_font = font;
+		}
+		return font_top;
+	}
+
+	void fillRectClipped(int16_t x, int16_t y, int16_t w, int16_t h, const C &color) {
+		if (clipRect(x, y, w, h)) {
+			fillRect(x, y, w, h, color);
+		}
+	}
+
+	static bool __attribute__((always_inline)) clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+		// Clips a rectangle to the screen, returns false if nothing of it is left.
+		if (x < 0) {
+			w += x;
+			x = 0;
+		}
+		if (y < 0) {
+			h += y;
+			y = 0;
+		}
+		if (x + w > W) {
+			w = W - x;
+		}
+		if (y + h > H) {
+			h = H - y;
+		}
+		return w > 0 && h > 0;
+	}
+
+	template <typename F>
+	void forEachBitRun(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, F span) {
+		// Calls span(x, y, length) for every run of set bits in a 1 bit bitmap (every row starts on a new byte,
+		// the most significant bit is the leftmost pixel), clipped to the screen. The bitmap is read a byte at a time:
+		// empty bytes are skipped and full bytes extend a run without looking at their bits.
+		int16_t byte_width = (w + 7) / 8;
+		int16_t first_row = y < 0 ? -y : 0;
+		int16_t end_row = y + h > H ? H - y : h;
+		for (int16_t j = first_row; j < end_row; j++) {
+			const uint8_t *row = bitmap + j * byte_width;
+			int16_t run_start = -1;
+			for (int16_t i = 0; i < w; i += 8) {
+				uint8_t bits = pgm_read_byte(row + i / 8);
+				if ((!bits && run_start < 0) || (bits == 0xFF && run_start >= 0)) {
+					continue;
+				}
+				uint8_t count = w - i < 8 ? w - i : 8;
+				for (uint8_t bit = 0; bit < count; bit++, bits <<= 1) {
+					if ((bits & 0x80) && run_start < 0) {
+						run_start = i + bit;
+					} else if (!(bits & 0x80) && run_start >= 0) {
+						clippedRun(x + run_start, x + i + bit, y + j, span);
+						run_start = -1;
+					}
+				}
+			}
+			if (run_start >= 0) {
+				clippedRun(x + run_start, x + w, y + j, span);
+			}
+		}
+	}
+
+	template <typename F>
+	static void __attribute__((always_inline)) clippedRun(int16_t x0, int16_t x1, int16_t y, F &span) {
+		// Calls span for the part of [x0, x1) that's on screen, if any.
+		x0 = x0 < 0 ? 0 : x0;
+		x1 = x1 > W ? W : x1;
+		if (x1 > x0) {
+			span(x0, y, x1 - x0);
+		}
+	}
+
+	static bool __attribute__((always_inline)) clipSprite(
+		int16_t x, int16_t y, int16_t w, int16_t h,
+		int16_t &first_col, int16_t &end_col, int16_t &first_row, int16_t &end_row
+	) {
+		// Finds the columns and rows of a w * h sprite at x/y that are on screen, returns false if there are none.
+		first_col = x < 0 ? -x : 0;
+		end_col = x + w > W ? W - x : w;
+		first_row = y < 0 ? -y : 0;
+		end_row = y + h > H ? H - y : h;
+		return end_col > first_col && end_row > first_row;
+	}
+
+	void __attribute__((always_inline)) fillSpan(int32_t left, int32_t right, int16_t y, const C &color) {
+		// Fills the pixels of row y whose centers lie in [left, right), both given in 16.16 fixed point.
+		int16_t x0 = (left + 0x7FFF) >> 16;
+		int16_t x1 = (right + 0x7FFF) >> 16;
+		if (x0 < 0) {
+			x0 = 0;
+		}
+		if (x1 > W) {
+			x1 = W;
+		}
+		if (x1 > x0) {
+			drawFastHLine(x0, y, x1 - x0, color);
+		}
+	}
 
 	void __attribute__((always_inline)) setVideoRamPosition(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
 		// Sets the active video RAM area of the display. After sending this command
@@ -689,13 +1195,14 @@ private:
 		// having to set the x/y address for each pixel. After each pixel, the display will internally
 		// increment to point to the next pixel:
 		// x0,y0 -> x0+1, y0, ..., x1,y0, x0,y0+1, x0+1,y0+1, ..., x1,y1
-
+		// When rotated by 90 or 270 degrees, x runs along the display's rows and y along its columns.
+		bool swapped = rotation & 1;
 		sendCommandAndContinue(CMD_COLUMN_ADDRESS);
-		sendDataAndContinue(x0);
-		sendDataAndContinue(x1);
+		sendDataAndContinue(swapped ? y0 : x0);
+		sendDataAndContinue(swapped ? y1 : x1);
 		sendCommandAndContinue(CMD_ROW_ADDRESS);
-		sendDataAndContinue(y0);
-		sendDataAndContinue(y1);
+		sendDataAndContinue(swapped ? x0 : y0);
+		sendDataAndContinue(swapped ? x1 : y1);
 	}
 
 	// ****
@@ -0,0 +1,133 @@
+// Anti-aliased drawing for single buffered mode. Anti-aliasing needs to blend with what's already on screen,
+// so this only works when there's a buffer to read from. The per color blend kernels live in color.h.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+struct ArcRange {
+	// Selects the part of a circle going clockwise from a start to an end direction.
+	// Pixels are tested with two cross products, so there's no trigonometry per pixel.
+	int32_t start_x = 0;
+	int32_t start_y = 0;
+	int32_t end_x = 0;
+	int32_t end_y = 0;
+	bool full = true;
+	bool wide = false;
+
+	bool __attribute__((always_inline)) contains(int16_t x, int16_t y) const {
+		if (full) {
+			return true;
+		}
+		bool after_start = start_x * y - start_y * x >= 0;
+		bool before_end = x * end_y - y * end_x >= 0;
+		return wide ? (after_start || before_end) : (after_start && before_end);
+	}
+};
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void drawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, const C &color) {
+	// Xiaolin Wu's line algorithm: for every step along the major axis, the exact position of the line
+	// is split between the two closest pixels on the minor axis.
+	// The position is kept in 16.16 fixed point, so the only division is the one for the gradient.
+	bool steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep) {
+		swap(x0, y0);
+		swap(x1, y1);
+	}
+	if (x0 > x1) {
+		swap(x0, x1);
+		swap(y0, y1);
+	}
+
+	int16_t dx = x1 - x0;
+	int16_t dy = y1 - y0;
+	int32_t gradient = dx ? ((int32_t)dy << 16) / dx : 0;
+	int32_t intery = (int32_t)y0 << 16;
+
+	for (; x0 <= x1; x0++) {
+		int16_t y = intery >> 16;
+		uint8_t coverage = (intery >> 8) & 0xFF;
+		if (steep) {
+			blendPixel(y, x0, color, 255 - coverage);
+			blendPixel(y + 1, x0, color, coverage);
+		} else {
+			blendPixel(x0, y, color, 255 - coverage);
+			blendPixel(x0, y + 1, color, coverage);
+		}
+		intery += gradient;
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void drawCircleAA(int16_t x0, int16_t y0, int16_t r, const C &color) {
+	drawCircleAA(x0, y0, r, color, ArcRange());
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void drawArcAA(int16_t x0, int16_t y0, int16_t r, int16_t start_angle, int16_t end_angle, const C &color) {
+	// Draws the part of a circle going clockwise from start_angle to end_angle (in degrees, 0 is 3 o'clock).
+	int16_t sweep = end_angle - start_angle;
+	if (sweep <= 0) {
+		return;
+	}
+
+	ArcRange arc;
+	if (sweep < 360) {
+		float start = start_angle * (float)M_PI / 180;
+		float end = end_angle * (float)M_PI / 180;
+		arc.start_x = cosf(start) * 1024;
+		arc.start_y = sinf(start) * 1024;
+		arc.end_x = cosf(end) * 1024;
+		arc.end_y = sinf(end) * 1024;
+		arc.full = false;
+		arc.wide = sweep > 180;
+	}
+	drawCircleAA(x0, y0, r, color, arc);
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void drawCircleAA(int16_t x0, int16_t y0, int16_t r, const C &color, const ArcRange &arc) {
+	// Wu's circle: for every column of one octant, the exact height of the circle is split between the pixel
+	// inside and the pixel outside the circle. The height is an integer square root in 8.8 fixed point,
+	// which only needs shifts and additions. Radii up to 255 pixels are supported.
+	if (r <= 0) {
+		if (!r) {
+			blendPixel(x0, y0, color, 255);
+		}
+		return;
+	}
+	if (r > 255) {
+		r = 255;
+	}
+
+	uint32_t rr = (uint32_t)r * r;
+	int16_t x_max = (r * 181) >> 8; // r / sqrt(2)
+	for (int16_t x = 0; x <= x_max; x++) {
+		uint32_t y_fixed = isqrt((rr - x * x) << 16);
+		int16_t y = y_fixed >> 8;
+		uint8_t coverage = y_fixed & 0xFF;
+		plotCirclePointsAA(x0, y0, x, y, color, 255 - coverage, arc);
+		plotCirclePointsAA(x0, y0, x, y + 1, color, coverage, arc);
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void plotCirclePointsAA(int16_t x0, int16_t y0, int16_t x, int16_t y, const C &color, uint8_t alpha, const ArcRange &arc) {
+	// Blends the (up to) eight points mirrored from (x, y) into the other octants.
+	if (!alpha) {
+		return;
+	}
+	if (arc.contains(x, y)) blendPixel(x0 + x, y0 + y, color, alpha);
+	if (arc.contains(x, -y)) blendPixel(x0 + x, y0 - y, color, alpha);
+	if (x) {
+		if (arc.contains(-x, y)) blendPixel(x0 - x, y0 + y, color, alpha);
+		if (arc.contains(-x, -y)) blendPixel(x0 - x, y0 - y, color, alpha);
+	}
+	if (x == y) {
+		return;
+	}
+	if (arc.contains(y, x)) blendPixel(x0 + y, y0 + x, color, alpha);
+	if (arc.contains(-y, x)) blendPixel(x0 - y, y0 + x, color, alpha);
+	if (x) {
+		if (arc.contains(y, -x)) blendPixel(x0 + y, y0 - x, color, alpha);
+		if (arc.contains(-y, -x)) blendPixel(x0 - y, y0 - x, color, alpha);
+	}
+}
@@ -0,0 +1,93 @@
+// Full color and opaque 1 bit bitmaps for all buffer modes.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+template <typename S>
+class BitmapReader {
+public:
+	// Reads the pixels of a (clipped) bitmap row by row, converting them to the display's color format.
+	// For use with streamRect.
+	BitmapReader(const S *_pixels, int16_t _stride, int16_t _w) : pixels(_pixels), stride(_stride), w(_w), col(0) {}
+
+	C __attribute__((always_inline)) operator()() {
+		C color = convertColor<C>(pixels[col]);
+		if (++col == w) {
+			col = 0;
+			pixels += stride;
+		}
+		return color;
+	}
+
+private:
+	const S *pixels;
+	int16_t stride;
+	int16_t w;
+	int16_t col;
+};
+
+MEMBER_REQUIRES_WITH(S, std::is_same<B, NoBuffer>::value)
+void blit(int16_t x, int16_t y, const S *pixels, int16_t w, int16_t h) {
+	// Draws w * h pixels, row by row. The pixels can be any color type (or RGB), they're converted to the
+	// display's color type on the fly. The whole visible part is sent in a single window.
+	// (SingleBuffer mode copies or converts whole rows instead, see ssd1351_singlebuffer.inl.)
+	int16_t src_x = x;
+	int16_t src_y = y;
+	int16_t src_w = w;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	BitmapReader<S> reader(pixels + (x - src_x) + src_w * (y - src_y), src_w, w);
+	streamRect(x, y, w, h, reader);
+}
+
+class BitmapBits {
+public:
+	// Reads the pixels of a (clipped) 1 bit bitmap row by row, a byte at a time, producing fg for set and
+	// bg for cleared bits. For use with streamRect.
+	BitmapBits(const uint8_t *bitmap, int16_t byte_width, int16_t _first_col, int16_t first_row, int16_t _w, const C &_fg, const C &_bg)
+		: row(bitmap + first_row * byte_width), stride(byte_width), first_col(_first_col), w(_w), col(0), fg(_fg), bg(_bg) {}
+
+	C __attribute__((always_inline)) operator()() {
+		if (!col) {
+			next = row + first_col / 8;
+			bits = pgm_read_byte(next++) << (first_col & 7);
+			remaining = 8 - (first_col & 7);
+		} else if (!remaining) {
+			bits = pgm_read_byte(next++);
+			remaining = 8;
+		}
+		C color = bits & 0x80 ? fg : bg;
+		bits <<= 1;
+		remaining--;
+		if (++col == w) {
+			col = 0;
+			row += stride;
+		}
+		return color;
+	}
+
+private:
+	const uint8_t *row;
+	const uint8_t *next;
+	int16_t stride;
+	int16_t first_col;
+	int16_t w;
+	int16_t col;
+	uint8_t bits;
+	uint8_t remaining;
+	C fg;
+	C bg;
+};
+
+void drawBitmapOpaque(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, const C &color, const C &bg) {
+	// Draws a 1 bit bitmap with color for set and bg for cleared bits, e.g. an icon over a known background.
+	// The whole (visible) rectangle is written in one go, in NoBuffer mode as a single window, so this costs about
+	// as much as a fillRect of the same size.
+	int16_t src_x = x;
+	int16_t src_y = y;
+	int16_t byte_width = (w + 7) / 8;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	BitmapBits bits(bitmap, byte_width, x - src_x, y - src_y, w, color, bg);
+	streamRect(x, y, w, h, bits);
+}
@@ -0,0 +1,103 @@
+// Dithered drawing for all buffer modes. Plain conversions from RGB truncate the low bits of every channel,
+// which shows up as banding in IndexedColor and LowColor mode. These functions take RGB colors and spread the
+// truncation error instead, either with an ordered (Bayer) pattern or by error diffusion (Floyd-Steinberg).
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+class OrderedDither {
+public:
+	// Produces a solid RGB color with ordered dithering row by row, for use with streamRect.
+	OrderedDither(const RGB &_color, int16_t _x, int16_t _y, int16_t _w) : color(_color), x(_x), y(_y), w(_w), col(0) {}
+
+	C __attribute__((always_inline)) operator()() {
+		C result = quantize<C>(color.r, color.g, color.b, bayerThreshold(x + col, y));
+		if (++col == w) {
+			col = 0;
+			y++;
+		}
+		return result;
+	}
+
+private:
+	RGB color;
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t col;
+};
+
+class ErrorDiffusion {
+public:
+	// Quantizes RGB pixels row by row for use with streamRect, spreading the error of every pixel to its
+	// neighbours to the right and below (Floyd-Steinberg: 7/16 right, 3/16 below left, 5/16 below, 1/16 below right).
+	// Only two rows of errors are kept, so this works for any height.
+	ErrorDiffusion(const RGB *_pixels, int16_t _stride, int16_t _w) : pixels(_pixels), stride(_stride), w(_w), col(0) {
+		memset(errors, 0, sizeof(errors));
+	}
+
+	C __attribute__((always_inline)) operator()() {
+		const RGB &source = pixels[col];
+		// Each row holds the three channels of every pixel one after the other, so the pixels left and right
+		// of this one are 3 entries away.
+		int16_t *current = errors[0] + (col + 1) * 3;
+		int16_t *below = errors[1] + (col + 1) * 3;
+
+		int16_t wanted[3] = {
+			(int16_t)(source.r + (current[0] >> 4)),
+			(int16_t)(source.g + (current[1] >> 4)),
+			(int16_t)(source.b + (current[2] >> 4))
+		};
+		C result = quantize<C>(wanted[0], wanted[1], wanted[2]);
+		int16_t shown[3];
+		displayedChannels(result, shown[0], shown[1], shown[2]);
+
+		for (uint8_t channel = 0; channel < 3; channel++) {
+			int16_t value = wanted[channel] > 255 ? 255 : (wanted[channel] < 0 ? 0 : wanted[channel]);
+			int16_t error = value - shown[channel];
+			current[channel + 3] += error * 7;
+			below[channel - 3] += error * 3;
+			below[channel] += error * 5;
+			below[channel + 3] += error;
+		}
+
+		if (++col == w) {
+			// Move on to the next row, the errors below become the current ones.
+			col = 0;
+			pixels += stride;
+			memcpy(errors[0], errors[1], sizeof(errors[0]));
+			memset(errors[1], 0, sizeof(errors[1]));
+		}
+		return result;
+	}
+
+private:
+	const RGB *pixels;
+	int16_t stride;
+	int16_t w;
+	int16_t col;
+	// Errors in 1/16ths for the current and the next row, with an extra pixel on either side
+	// so the edges don't need special cases.
+	int16_t errors[2][(W + 2) * 3];
+};
+
+void fillRectDithered(int16_t x, int16_t y, int16_t w, int16_t h, const RGB &color) {
+	// Fills a rect with a color that can lie between the colors the current color mode can show,
+	// by mixing the two closest ones in an ordered pattern.
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	OrderedDither dither(color, x, y, w);
+	streamRect(x, y, w, h, dither);
+}
+
+void drawRGBBitmapDithered(int16_t x, int16_t y, const RGB *pixels, int16_t w, int16_t h) {
+	// Draws w * h RGB pixels (e.g. rendered at full precision elsewhere), quantizing them to the current
+	// color mode with Floyd-Steinberg error diffusion.
+	int16_t src_x = x;
+	int16_t src_y = y;
+	int16_t src_w = w;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	ErrorDiffusion dither(pixels + (x - src_x) + src_w * (y - src_y), src_w, w);
+	streamRect(x, y, w, h, dither);
+}
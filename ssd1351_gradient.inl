@@ -0,0 +1,162 @@
+// Gradient fills for all buffer modes.
+// Channels are interpolated in 16.16 fixed point and stepped incrementally from pixel to pixel, then converted
+// straight to the display's color format (optionally with ordered dithering, see dither.h).
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+class LinearGradient {
+public:
+	// Produces the pixels of a linear gradient row by row, for use with streamRect.
+	// fx/fy is how far the gradient advances per pixel along x/y (1.0 being the whole gradient),
+	// t0 is how far along it is at the first pixel.
+	LinearGradient(const RGB &from, const RGB &to, float fx, float fy, float t0, int16_t _x, int16_t _y, int16_t _w, bool _dither)
+		: x(_x), y(_y), w(_w), col(0), dither(_dither) {
+		setup(0, from.r, to.r, fx, fy, t0);
+		setup(1, from.g, to.g, fx, fy, t0);
+		setup(2, from.b, to.b, fx, fy, t0);
+	}
+
+	C __attribute__((always_inline)) operator()() {
+		C color = dither
+			? quantize<C>(value[0] >> 16, value[1] >> 16, value[2] >> 16, bayerThreshold(x + col, y))
+			: quantize<C>(value[0] >> 16, value[1] >> 16, value[2] >> 16);
+		if (++col < w) {
+			value[0] += step_x[0];
+			value[1] += step_x[1];
+			value[2] += step_x[2];
+		} else {
+			col = 0;
+			y++;
+			value[0] = row[0] += step_y[0];
+			value[1] = row[1] += step_y[1];
+			value[2] = row[2] += step_y[2];
+		}
+		return color;
+	}
+
+private:
+	int32_t value[3];
+	int32_t row[3];
+	int32_t step_x[3];
+	int32_t step_y[3];
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t col;
+	bool dither;
+
+	void setup(uint8_t channel, uint8_t from, uint8_t to, float fx, float fy, float t0) {
+		float delta = (int16_t)to - from;
+		step_x[channel] = delta * fx * 65536;
+		step_y[channel] = delta * fy * 65536;
+		value[channel] = row[channel] = (from + delta * t0) * 65536 + 32768;
+	}
+};
+
+class RadialGradient {
+public:
+	// Produces the pixels of a radial gradient row by row, for use with streamRect.
+	// The distance to the center is tracked in quarter pixels: moving by one pixel changes the squared distance
+	// by a known amount, and the distance itself by at most 4, so it's kept up to date with a couple of
+	// comparisons instead of a square root per pixel.
+	RadialGradient(const RGB &inner, const RGB &outer, int16_t cx, int16_t cy, int16_t radius, int16_t _x, int16_t _y, int16_t _w, bool _dither)
+		: x(_x), y(_y), w(_w), col(0), dither(_dither) {
+		from[0] = inner.r;
+		from[1] = inner.g;
+		from[2] = inner.b;
+		delta[0] = (int16_t)outer.r - inner.r;
+		delta[1] = (int16_t)outer.g - inner.g;
+		delta[2] = (int16_t)outer.b - inner.b;
+		inverse_radius = 65536 / (4 * (radius > 0 ? radius : 1));
+		row_dx = (int32_t)(x - cx) * 4;
+		dy = (int32_t)(y - cy) * 4;
+		startRow();
+	}
+
+	C __attribute__((always_inline)) operator()() {
+		int32_t t = distance * inverse_radius;
+		if (t > 65536) {
+			t = 65536;
+		}
+		int16_t r = from[0] + ((delta[0] * t) >> 16);
+		int16_t g = from[1] + ((delta[1] * t) >> 16);
+		int16_t b = from[2] + ((delta[2] * t) >> 16);
+		C color = dither ? quantize<C>(r, g, b, bayerThreshold(x + col, y)) : quantize<C>(r, g, b);
+
+		if (++col < w) {
+			distance_squared += 8 * dx + 16;
+			dx += 4;
+			while ((distance + 1) * (distance + 1) <= distance_squared) {
+				distance++;
+			}
+			while (distance * distance > distance_squared) {
+				distance--;
+			}
+		} else {
+			col = 0;
+			y++;
+			dy += 4;
+			startRow();
+		}
+		return color;
+	}
+
+private:
+	int16_t from[3];
+	int32_t delta[3];
+	int32_t inverse_radius;
+	int32_t row_dx;
+	int32_t dx;
+	int32_t dy;
+	int32_t distance_squared;
+	int32_t distance;
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t col;
+	bool dither;
+
+	void startRow() {
+		dx = row_dx;
+		distance_squared = dx * dx + dy * dy;
+		distance = isqrt(distance_squared);
+	}
+};
+
+void fillRectGradient(int16_t x, int16_t y, int16_t w, int16_t h, const RGB &from, const RGB &to, int16_t angle = 0, bool dither = false) {
+	// Fills a rect with a linear gradient. The angle is in degrees: 0 goes from left to right,
+	// 90 from top to bottom, anything in between works as well.
+	int16_t origin_x = x;
+	int16_t origin_y = y;
+	float last_x = w - 1;
+	float last_y = h - 1;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+
+	// Project the corner pixels onto the gradient direction to find where it starts and ends.
+	float c = cosf(angle * (float)M_PI / 180);
+	float s = sinf(angle * (float)M_PI / 180);
+	float start = (c < 0 ? last_x * c : 0) + (s < 0 ? last_y * s : 0);
+	float end = (c > 0 ? last_x * c : 0) + (s > 0 ? last_y * s : 0);
+	float length = end - start;
+	if (length < 1) {
+		length = 1;
+	}
+	float t0 = ((x - origin_x) * c + (y - origin_y) * s - start) / length;
+
+	LinearGradient gradient(from, to, c / length, s / length, t0, x, y, w, dither);
+	streamRect(x, y, w, h, gradient);
+}
+
+void fillRectRadialGradient(
+	int16_t x, int16_t y, int16_t w, int16_t h, int16_t cx, int16_t cy, int16_t radius,
+	const RGB &inner, const RGB &outer, bool dither = false
+) {
+	// Fills a rect with a radial gradient around cx/cy, going from inner at the center to outer at radius
+	// and beyond.
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	RadialGradient gradient(inner, outer, cx, cy, radius, x, y, w, dither);
+	streamRect(x, y, w, h, gradient);
+}
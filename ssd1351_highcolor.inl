@@ -4,7 +4,7 @@
 MEMBER_REQUIRES(std::is_same<C, HighColor>::value)
 void setColorDepth() {
 	sendCommandAndContinue(CMD_REMAP);
-	sendDataAndContinue(0xB4);
+	sendDataAndContinue(orientedRemap(0xB4));
 };
 
 MEMBER_REQUIRES(std::is_same<C, HighColor>::value)
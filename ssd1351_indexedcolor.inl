@@ -7,7 +7,7 @@ void setColorDepth() {
 	// This is because indexed colours should ultimately be able to send any colour - just only 256 different ones.
 	// However, to make IndexedColor mode the fastest, I might make this use 2 bytes instead.
 	sendCommandAndContinue(CMD_REMAP);
-	sendDataAndContinue(0xB4);
+	sendDataAndContinue(orientedRemap(0xB4));
 };
 
 MEMBER_REQUIRES(std::is_same<C, IndexedColor>::value)
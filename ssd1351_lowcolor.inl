@@ -4,7 +4,7 @@
 MEMBER_REQUIRES(std::is_same<C, LowColor>::value)
 void setColorDepth() {
 	sendCommandAndContinue(CMD_REMAP);
-	sendDataAndContinue(0x74);
+	sendDataAndContinue(orientedRemap(0x74));
 }
 
 // push color for Low color mode
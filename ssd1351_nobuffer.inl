@@ -22,6 +22,11 @@ void updateScreen() {
 	// supply a common interface for all operational modes.
 }
 
+MEMBER_REQUIRES(std::is_same<B, NoBuffer>::value)
+void updateScreen(int16_t, int16_t, int16_t, int16_t) {
+	// Same as above, there's nothing to update.
+}
+
 MEMBER_REQUIRES(std::is_same<B, NoBuffer>::value)
 void fillScreen(const C &color) {
 	// Instead of drawing each pixel to the screen with the same color, we make
@@ -186,3 +191,24 @@ void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, const C &color) {
 		}
 	}
 }
+
+MEMBER_REQUIRES_WITH(F, std::is_same<B, NoBuffer>::value)
+void streamRect(int16_t x, int16_t y, int16_t w, int16_t h, F &pixels) {
+	// Sends w * h pixels, produced one by one by calling pixels(), row by row into a single video ram window.
+	// The area needs to be clipped already.
+	sendRect(x, y, w, h, pixels);
+}
+
+MEMBER_REQUIRES_WITH(S, std::is_same<B, NoBuffer>::value)
+void writeRun(int16_t x, int16_t y, const S *pixels, int16_t count) {
+	// Sends count pixels of any color type to row y, starting at x, in a window of their own.
+	// The run needs to be clipped already.
+	SPI.beginTransaction(spi_settings);
+	setVideoRamPosition(x, y, x + count - 1, y);
+	sendCommandAndContinue(CMD_WRITE_TO_RAM);
+	while (count-- > 1) {
+		pushColor(convertColor<C>(*pixels++));
+	}
+	pushColor(convertColor<C>(*pixels), true);
+	SPI.endTransaction();
+}
@@ -0,0 +1,46 @@
+// Scanline composition for all buffer modes, see scanline.h.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+class LayerRows {
+public:
+	// Produces the pixels of a screen composed from layers row by row for use with streamRect.
+	// Every row is composed into a line buffer when its first pixel is asked for, so that's all the memory needed.
+	LayerRows(ScanlineLayer<C, W> *const *_layers, uint8_t _count, int16_t _y) : layers(_layers), count(_count), y(_y), col(0) {}
+
+	C __attribute__((always_inline)) operator()() {
+		if (!col) {
+			for (uint8_t i = 0; i < count; i++) {
+				if (layers[i]->visible) {
+					layers[i]->renderLine(line, y);
+				}
+			}
+		}
+		C color = line[col];
+		if (++col == W) {
+			col = 0;
+			y++;
+		}
+		return color;
+	}
+
+private:
+	ScanlineLayer<C, W> *const *layers;
+	uint8_t count;
+	int16_t y;
+	int16_t col;
+	C line[W];
+};
+
+void drawLayers(ScanlineLayer<C, W> *const *layers, uint8_t count, int16_t y = 0, int16_t h = H) {
+	// Composes rows y to y + h - 1 of the screen from count layers, the first one at the bottom. The bottom layer
+	// should cover the whole row (e.g. a SolidLayer, GradientLayer or TileMapLayer).
+	// In NoBuffer mode this is the way to get full screen content without a frame buffer: the rows go out in a
+	// single window as soon as they're composed, and only one row is kept in memory.
+	int16_t x = 0;
+	int16_t w = W;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	LayerRows rows(layers, count, y);
+	streamRect(x, y, w, h, rows);
+}
@@ -34,6 +34,30 @@ void updateScreen() {
 	SPI.endTransaction();
 }
 
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void updateScreen(int16_t x, int16_t y, int16_t w, int16_t h) {
+	// Pushes out only a part of the buffer, for when little has changed since the last update.
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	SPI.beginTransaction(spi_settings);
+	setVideoRamPosition(x, y, x + w - 1, y + h - 1);
+	sendCommandAndContinue(CMD_WRITE_TO_RAM);
+
+	const C *row = &frontBuffer()[x + (W * y)];
+	for (; h > 0; h--, row += W) {
+		for (int16_t i = 0; i < w - 1; i++) {
+			pushColor(row[i]);
+		}
+		pushColor(row[w - 1], true);
+		// At the end of every row, end the transaction to give other SPI devices a chance to communicate.
+		SPI.endTransaction();
+		if (h > 1) {
+			SPI.beginTransaction(spi_settings);
+		}
+	}
+}
+
 MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
 void fillScreen(const C &color) {
 	// just writing to every pixel in the buffer is fast, but std::fill is faster.
@@ -120,3 +144,208 @@ void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, const C &color) {
 		}
 	}
 }
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void blendPixel(int16_t x, int16_t y, const C &color, uint8_t alpha) {
+	// Blends color over whatever is already in the buffer, alpha goes from 0 (invisible) to 255 (opaque).
+	if((x < 0) || (x >= W) || (y < 0) || (y >= H) || !alpha) {
+		return;
+	}
+
+	C &pixel = frontBuffer()[x + (W * y)];
+	pixel = blend(pixel, color, alpha);
+}
+
+// Blending variants of the drawing functions. They combine color with what's already in the buffer
+// using one of the BLEND_* modes from blend.h; alpha is only used by BLEND_ALPHA.
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void drawFastHLine(int16_t x, int16_t y, int16_t w, const C &color, uint8_t blend_mode, uint8_t alpha = 255) {
+	int16_t h = 1;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	blendSpan(&frontBuffer()[x + (W * y)], &color, 0, w, blend_mode, alpha);
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, const C &color, uint8_t blend_mode, uint8_t alpha = 255) {
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	C *row = &frontBuffer()[x + (W * y)];
+	for (; h > 0; h--, row += W) {
+		blendSpan(row, &color, 0, w, blend_mode, alpha);
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, const C &color, uint8_t blend_mode, uint8_t alpha = 255) {
+	// Blends color wherever the 1 bit bitmap is set. Runs of set bits are blended as one span.
+	forEachBitRun(x, y, bitmap, w, h, [this, &color, blend_mode, alpha](int16_t run_x, int16_t run_y, int16_t length) {
+		drawFastHLine(run_x, run_y, length, color, blend_mode, alpha);
+	});
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void blendBitmap(int16_t x, int16_t y, const C *pixels, int16_t w, int16_t h, uint8_t blend_mode, uint8_t alpha = 255) {
+	// Blends a full color bitmap (w * h pixels, row by row) into the buffer.
+	int16_t src_x = x;
+	int16_t src_y = y;
+	int16_t src_w = w;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	pixels += (x - src_x) + src_w * (y - src_y);
+	C *row = &frontBuffer()[x + (W * y)];
+	for (; h > 0; h--, row += W, pixels += src_w) {
+		blendSpan(row, pixels, 1, w, blend_mode, alpha);
+	}
+}
+
+MEMBER_REQUIRES_WITH(F, std::is_same<B, SingleBuffer>::value)
+void streamRect(int16_t x, int16_t y, int16_t w, int16_t h, F &pixels) {
+	// Writes w * h pixels, produced one by one by calling pixels(), row by row into the buffer.
+	// The area needs to be clipped already.
+	C *row = &frontBuffer()[x + (W * y)];
+	for (; h > 0; h--, row += W) {
+		for (int16_t i = 0; i < w; i++) {
+			row[i] = pixels();
+		}
+	}
+}
+
+MEMBER_REQUIRES_WITH(S, std::is_same<B, SingleBuffer>::value)
+void writeRun(int16_t x, int16_t y, const S *pixels, int16_t count) {
+	// Writes count pixels of any color type into row y, starting at x. The run needs to be clipped already.
+	convertRow(&frontBuffer()[x + (W * y)], pixels, count);
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void blit(int16_t x, int16_t y, const C *pixels, int16_t w, int16_t h) {
+	// Copies w * h pixels that are already in the display's color type into the buffer, one memcpy per row.
+	// The bitmap is clipped once up front.
+	int16_t src_x = x;
+	int16_t src_y = y;
+	int16_t src_w = w;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	pixels += (x - src_x) + src_w * (y - src_y);
+	C *row = &frontBuffer()[x + (W * y)];
+	for (; h > 0; h--, row += W, pixels += src_w) {
+		memcpy(row, pixels, w * sizeof(C));
+	}
+}
+
+template <typename S, REQUIRES(!std::is_same<S, C>::value && std::is_same<B, SingleBuffer>::value)>
+void blit(int16_t x, int16_t y, const S *pixels, int16_t w, int16_t h) {
+	// Converts w * h pixels of any other color type (or RGB) into the buffer, a row at a time with convertRow,
+	// which handles the common pairs two pixels at a time (see convert.h).
+	int16_t src_x = x;
+	int16_t src_y = y;
+	int16_t src_w = w;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	pixels += (x - src_x) + src_w * (y - src_y);
+	C *row = &frontBuffer()[x + (W * y)];
+	for (; h > 0; h--, row += W, pixels += src_w) {
+		convertRow(row, pixels, w);
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void copyRect(const Rect &src, int16_t x, int16_t y) {
+	// Copies the pixels in src so its top left corner ends up at x/y. Source and destination may overlap:
+	// rows are copied in the order that doesn't overwrite rows still to be copied, memmove handles the overlap
+	// within a row. Parts that would come from or go to outside of the screen are left out.
+	int16_t src_x = src.x;
+	int16_t src_y = src.y;
+	int16_t w = src.w;
+	int16_t h = src.h;
+	if (!clipRect(src_x, src_y, w, h)) {
+		return;
+	}
+	x += src_x - src.x;
+	y += src_y - src.y;
+	int16_t dst_x = x;
+	int16_t dst_y = y;
+	if (!clipRect(dst_x, dst_y, w, h)) {
+		return;
+	}
+	src_x += dst_x - x;
+	src_y += dst_y - y;
+
+	ArrayType &buffer = frontBuffer();
+	bool downwards = dst_y > src_y;
+	for (int16_t i = 0; i < h; i++) {
+		int16_t row = downwards ? h - 1 - i : i;
+		memmove(&buffer[dst_x + W * (dst_y + row)], &buffer[src_x + W * (src_y + row)], w * sizeof(C));
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void scrollRect(const Rect &rect, int16_t dx, int16_t dy, const C &fill) {
+	// Moves the contents of rect by dx/dy (e.g. dy = -10 scrolls up by ten pixels). What moves out of rect is
+	// dropped, what moves into view is filled with fill. Use updateScreen(x, y, w, h) to only send rect afterwards.
+	int16_t x = rect.x;
+	int16_t y = rect.y;
+	int16_t w = rect.w;
+	int16_t h = rect.h;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	if (abs(dx) >= w || abs(dy) >= h) {
+		fillRect(x, y, w, h, fill);
+		return;
+	}
+	int16_t keep_w = w - abs(dx);
+	int16_t keep_h = h - abs(dy);
+	copyRect({(int16_t)(dx < 0 ? x - dx : x), (int16_t)(dy < 0 ? y - dy : y), keep_w, keep_h}, dx > 0 ? x + dx : x, dy > 0 ? y + dy : y);
+
+	// Fill what came into view: full rows at the top or bottom, and the columns next to the moved part.
+	if (dy) {
+		fillRect(x, dy > 0 ? y : y + keep_h, w, abs(dy), fill);
+	}
+	if (dx) {
+		fillRect(dx > 0 ? x : x + keep_w, dy > 0 ? y + dy : y, abs(dx), keep_h, fill);
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+C readPixel(int16_t x, int16_t y) {
+	// The display can't be read over SPI, but the buffer holds exactly what's on it (after the next update).
+	if((x < 0) || (x >= W) || (y < 0) || (y >= H)) {
+		return C();
+	}
+	return frontBuffer()[x + (W * y)];
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void readRect(int16_t x, int16_t y, int16_t w, int16_t h, C *pixels) {
+	// Copies w * h pixels, row by row, into pixels. Pixels outside of the screen are left as they are.
+	int16_t src_x = x;
+	int16_t src_y = y;
+	int16_t src_w = w;
+	if (!clipRect(x, y, w, h)) {
+		return;
+	}
+	pixels += (x - src_x) + src_w * (y - src_y);
+	const C *row = &frontBuffer()[x + (W * y)];
+	for (; h > 0; h--, row += W, pixels += src_w) {
+		memcpy(pixels, row, w * sizeof(C));
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void saveRegion(const Rect &region, C *memory) {
+	// Saves what's in region to memory (which needs room for region.w * region.h pixels), so it can be put back
+	// with restoreRegion once whatever gets drawn on top (a popup, a cursor, ...) goes away.
+	readRect(region.x, region.y, region.w, region.h, memory);
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void restoreRegion(const Rect &region, const C *memory) {
+	blit(region.x, region.y, memory, region.w, region.h);
+}
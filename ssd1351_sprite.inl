@@ -0,0 +1,90 @@
+// Sprites with transparent pixels for all buffer modes, see sprite.h for the formats.
+// Only the opaque runs of a sprite get drawn, each with a single writeRun. In NoBuffer mode that's one
+// video ram window per run, transparent pixels are never sent.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+template <typename S>
+void drawSprite(int16_t x, int16_t y, const KeyedSprite<S> &sprite) {
+	int16_t first_col, end_col, first_row, end_row;
+	if (!clipSprite(x, y, sprite.w, sprite.h, first_col, end_col, first_row, end_row)) {
+		return;
+	}
+	for (int16_t row = first_row; row < end_row; row++) {
+		const S *pixels = sprite.pixels + row * sprite.w;
+		int16_t col = first_col;
+		while (col < end_col) {
+			while (col < end_col && pixels[col] == sprite.key) {
+				col++;
+			}
+			int16_t start = col;
+			while (col < end_col && pixels[col] != sprite.key) {
+				col++;
+			}
+			if (col > start) {
+				writeRun(x + start, y + row, pixels + start, col - start);
+			}
+		}
+	}
+}
+
+template <typename S>
+void drawSprite(int16_t x, int16_t y, const MaskedSprite<S> &sprite) {
+	int16_t first_col, end_col, first_row, end_row;
+	if (!clipSprite(x, y, sprite.w, sprite.h, first_col, end_col, first_row, end_row)) {
+		return;
+	}
+	int16_t byte_width = (sprite.w + 7) / 8;
+	for (int16_t row = first_row; row < end_row; row++) {
+		const S *pixels = sprite.pixels + row * sprite.w;
+		const uint8_t *mask = sprite.mask + row * byte_width;
+		int16_t col = first_col;
+		while (col < end_col) {
+			// Fully transparent bytes of the mask are skipped as a whole.
+			while (col < end_col) {
+				uint8_t bits = pgm_read_byte(mask + col / 8);
+				if (!bits && !(col & 7)) {
+					col += 8;
+				} else if (bits & (128 >> (col & 7))) {
+					break;
+				} else {
+					col++;
+				}
+			}
+			if (col > end_col) {
+				col = end_col;
+			}
+			int16_t start = col;
+			while (col < end_col && (pgm_read_byte(mask + col / 8) & (128 >> (col & 7)))) {
+				col++;
+			}
+			if (col > start) {
+				writeRun(x + start, y + row, pixels + start, col - start);
+			}
+		}
+	}
+}
+
+template <typename S>
+void drawSprite(int16_t x, int16_t y, const RLESprite<S> &sprite) {
+	int16_t first_col, end_col, first_row, end_row;
+	if (!clipSprite(x, y, sprite.w, sprite.h, first_col, end_col, first_row, end_row)) {
+		return;
+	}
+	const uint8_t *runs = sprite.runs;
+	const S *pixels = sprite.pixels;
+	for (int16_t row = 0; row < end_row; row++) {
+		// Rows above the screen still need to be walked to find where the next row starts.
+		int16_t col = 0;
+		while (col < sprite.w) {
+			col += pgm_read_byte(runs++);
+			uint8_t count = pgm_read_byte(runs++);
+			int16_t start = col > first_col ? col : first_col;
+			int16_t end = col + count < end_col ? col + count : end_col;
+			if (row >= first_row && end > start) {
+				writeRun(x + start, y + row, pixels + (start - col), end - start);
+			}
+			pixels += count;
+			col += count;
+		}
+	}
+}
@@ -0,0 +1,64 @@
+// Character cell terminals for all buffer modes, see terminal.h.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+class TerminalCell {
+public:
+	// Produces the pixels of one character cell row by row for use with sendRect. The font's columns have
+	// the top row in bit 0, so each pixel is a bit of its column, shifted down one row at a time.
+	TerminalCell(uint8_t c, const C &_fg, const C &_bg) : fg(_fg), bg(_bg), col(0) {
+		for (uint8_t i = 0; i < 5; i++) {
+			columns[i] = glcdColumn(c, i);
+		}
+		columns[5] = 0;
+	}
+
+	C __attribute__((always_inline)) operator()() {
+		C color = columns[col] & 1 ? fg : bg;
+		columns[col] >>= 1;
+		if (++col == TERMINAL_CELL_W) {
+			col = 0;
+		}
+		return color;
+	}
+
+private:
+	const C &fg;
+	const C &bg;
+	uint8_t col;
+	uint8_t columns[TERMINAL_CELL_W];
+};
+
+template <uint8_t COLUMNS, uint8_t ROWS>
+void drawTerminal(Terminal<C, COLUMNS, ROWS> &terminal) {
+	// Draws the cells of the terminal that changed since the last call, each as one opaque window, at the top left
+	// of the screen. Cells are sent straight to the display in both buffer modes, the frame buffer isn't touched.
+	// When the terminal scrolled, the display's start line moves along (see setScrollLine), so what's on the
+	// screen already doesn't need to be sent again. For that to work out, the terminal should be exactly as high as
+	// the screen (ROWS * 8 == H, or 12 rows on 128x96 panels with 32 rows of video ram left over). At rotations 1 and 3
+	// the display can't scroll sideways, so the start line goes back to 0 and the whole terminal is drawn instead.
+	if (rotation & 1) {
+		if (terminal.scrolled || scroll_line) {
+			terminal.invalidate();
+			setScrollLine(0);
+		}
+	} else if (terminal.scrolled) {
+		setScrollLine(scroll_line + terminal.scrolled * TERMINAL_CELL_H);
+	}
+	for (uint8_t r = 0; r < ROWS; r++) {
+		int16_t y = (r * TERMINAL_CELL_H + scroll_line) & 127;
+		for (uint8_t c = 0; c < COLUMNS; c++) {
+			if (!terminal.changed(r, c)) {
+				continue;
+			}
+			uint8_t character = terminal.character(r, c);
+			if (!_cp437 && character >= 176) {
+				// Same as Adafruit_GFX: the old version of the font is missing a character at 176
+				character++;
+			}
+			TerminalCell cell(character, terminal.palette[terminal.foregroundAt(r, c)],
+				terminal.palette[terminal.backgroundAt(r, c)]);
+			sendRect(c * TERMINAL_CELL_W, y, TERMINAL_CELL_W, TERMINAL_CELL_H, cell);
+		}
+	}
+	terminal.markDrawn();
+}
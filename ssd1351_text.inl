@@ -0,0 +1,211 @@
+// Glyph rendering for all buffer modes, used by drawChar.
+// Glyph bitmaps are decoded a row at a time: transparent text is drawn as one line (or rect, for bigger text
+// sizes) per run of set pixels, opaque text as a single rect of pixels.
+// Anti-aliased fonts store 2 or 4 bits of coverage per pixel (see GFXfont::bpp). Opaque text maps coverage to
+// a precomputed ramp of colors going from the background to the text color (see textRamp), transparent text
+// draws fully covered pixels as runs like plain fonts do and only blends the pixels at the edges.
+// Compressed fonts (see fontcompression.h) are decoded straight into spans.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+class GlyphRows {
+public:
+	// Produces the pixels of a (clipped) box containing a glyph row by row for use with streamRect: ramp[coverage]
+	// where the glyph is set, ramp[0] (the background) everywhere else. glyph_x/glyph_y is where the glyph's top
+	// left corner is, relative to the box's top left corner, bits are the glyph's bitmap with bpp bits per pixel.
+	// For compressed fonts (bpp is 0), bits are the glyph's run lengths.
+	GlyphRows(
+		const uint8_t *_bits, uint8_t _bpp, uint8_t _glyph_w, uint8_t _glyph_h, int16_t _glyph_x, int16_t _glyph_y,
+		uint8_t _size, int16_t _w, const C *_ramp
+	) : bits(_bits), bpp(_bpp), glyph_w(_glyph_w), glyph_h(_glyph_h), glyph_x(_glyph_x), glyph_y(_glyph_y),
+		size(_size), w(_w), row(0), col(0), ramp(_ramp), spans(_bits, _glyph_w, _glyph_h) {
+		has_span = !bpp && spans.next();
+	}
+
+	C __attribute__((always_inline)) operator()() {
+		if (!col) {
+			composeRow();
+		}
+		C result = line[col];
+		if (++col == w) {
+			col = 0;
+			row++;
+		}
+		return result;
+	}
+
+private:
+	const uint8_t *bits;
+	uint8_t bpp;
+	uint8_t glyph_w;
+	uint8_t glyph_h;
+	int16_t glyph_x;
+	int16_t glyph_y;
+	uint8_t size;
+	int16_t w;
+	int16_t row;
+	int16_t col;
+	const C *ramp;
+	GlyphSpans spans;
+	bool has_span;
+	C line[W];
+
+	void composeRow() {
+		for (int16_t i = 0; i < w; i++) {
+			line[i] = ramp[0];
+		}
+		int16_t glyph_row = row - glyph_y;
+		if (glyph_row < 0 || glyph_row >= glyph_h * size) {
+			return;
+		}
+		if (!bpp) {
+			composeSpans(glyph_row / size);
+			return;
+		}
+		uint32_t bit = (uint32_t)(glyph_row / size) * glyph_w * bpp;
+		for (uint8_t i = 0; i < glyph_w; i++, bit += bpp) {
+			uint8_t coverage = glyphPixel(bits, bit, bpp);
+			if (!coverage) {
+				continue;
+			}
+			int16_t x0 = glyph_x + i * size;
+			int16_t x1 = x0 + size;
+			x0 = x0 < 0 ? 0 : x0;
+			x1 = x1 > w ? w : x1;
+			for (int16_t x = x0; x < x1; x++) {
+				line[x] = ramp[coverage];
+			}
+		}
+	}
+
+	void composeSpans(uint8_t glyph_row) {
+		// Rows are composed in order, so the spans are decoded only once. Bigger text sizes show every glyph row
+		// several times, the decoder goes back to the start of the row until the last time.
+		while (has_span && spans.row < glyph_row) {
+			has_span = spans.next();
+		}
+		GlyphSpans row_start = spans;
+		bool row_has_span = has_span;
+		while (has_span && spans.row == glyph_row) {
+			int16_t x0 = glyph_x + spans.col * size;
+			int16_t x1 = x0 + spans.length * size;
+			x0 = x0 < 0 ? 0 : x0;
+			x1 = x1 > w ? w : x1;
+			for (int16_t x = x0; x < x1; x++) {
+				line[x] = ramp[1];
+			}
+			has_span = spans.next();
+		}
+		if ((row + 1 - glyph_y) / size == glyph_row) {
+			spans = row_start;
+			has_span = row_has_span;
+		}
+	}
+};
+
+static uint8_t __attribute__((always_inline)) glyphPixel(const uint8_t *bitmap, uint32_t bit, uint8_t bpp) {
+	// Reads the pixel starting at bit of a glyph bitmap. bpp divides 8, so pixels never span two bytes.
+	return (pgm_read_byte(bitmap + (bit >> 3)) >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1);
+}
+
+void drawGlyphRuns(const GFXglyph &glyph, int16_t left, int16_t top, const C &color, uint8_t size) {
+	// Draws the set pixels of a glyph with its top left corner at left/top, one run of set pixels at a time.
+	// Glyph bitmaps are packed without padding, rows don't start on a new byte.
+	// Partially covered pixels of anti-aliased fonts end runs and are drawn one by one.
+	const uint8_t *bitmap = font->bitmap + glyph.bitmapOffset;
+	if (font->compression) {
+		GlyphSpans spans(bitmap, glyph.width, glyph.height);
+		while (spans.next()) {
+			fillRectClipped(left + spans.col * size, top + spans.row * size, spans.length * size, size, color);
+		}
+		return;
+	}
+	uint8_t bpp = fontBpp();
+	uint8_t full = (1 << bpp) - 1;
+	uint32_t bit = 0;
+	uint8_t bits = 0;
+	for (uint8_t row = 0; row < glyph.height; row++) {
+		int16_t row_y = top + row * size;
+		int16_t run_start = -1;
+		for (uint8_t col = 0; col < glyph.width; col++, bit += bpp) {
+			if (!(bit & 7)) {
+				bits = pgm_read_byte(bitmap + (bit >> 3));
+			}
+			uint8_t coverage = (bits >> (8 - bpp - (bit & 7))) & full;
+			bool set = coverage == full;
+			if (set && run_start < 0) {
+				run_start = col;
+			} else if (!set && run_start >= 0) {
+				fillRectClipped(left + run_start * size, row_y, (col - run_start) * size, size, color);
+				run_start = -1;
+			}
+			if (coverage && !set) {
+				drawGlyphEdge(left + col * size, row_y, size, color, coverage * 255 / full);
+			}
+		}
+		if (run_start >= 0) {
+			fillRectClipped(left + run_start * size, row_y, (glyph.width - run_start) * size, size, color);
+		}
+	}
+}
+
+void drawGlyphOpaque(
+	const GFXglyph &glyph, int16_t left, int16_t top, int16_t box_x, int16_t box_y, int16_t box_w, int16_t box_h,
+	const C &color, const C &bg, uint8_t size
+) {
+	// Writes the box at box_x/box_y in one go: the glyph (with its top left corner at left/top) in color,
+	// everything else in bg.
+	int16_t x = box_x;
+	int16_t y = box_y;
+	if (!clipRect(x, y, box_w, box_h)) {
+		return;
+	}
+	GlyphRows rows(
+		font->bitmap + glyph.bitmapOffset, font->compression ? 0 : fontBpp(), glyph.width, glyph.height, left - x,
+		top - y, size, box_w, textRamp(color, bg)
+	);
+	streamRect(x, y, box_w, box_h, rows);
+}
+
+MEMBER_REQUIRES(std::is_same<B, SingleBuffer>::value)
+void drawGlyphEdge(int16_t x, int16_t y, uint8_t size, const C &color, uint8_t alpha) {
+	// A partially covered pixel of an anti-aliased glyph, blended with what's in the buffer.
+	for (uint8_t i = 0; i < size; i++) {
+		for (uint8_t j = 0; j < size; j++) {
+			blendPixel(x + j, y + i, color, alpha);
+		}
+	}
+}
+
+MEMBER_REQUIRES(std::is_same<B, NoBuffer>::value)
+void drawGlyphEdge(int16_t x, int16_t y, uint8_t size, const C &color, uint8_t alpha) {
+	// Without a buffer there's nothing to blend with, so pixels that are at least half covered are drawn solid.
+	// Anti-aliased text gets its smooth edges in this mode when it has a background.
+	if (alpha >= 128) {
+		fillRectClipped(x, y, size, size, color);
+	}
+}
+
+void drawGlyphCached(
+	const GFXglyph &glyph, uint32_t code, int16_t left, int16_t top, int16_t cell_x, int16_t cell_y,
+	int16_t cell_w, int16_t cell_h, const C &color, const C &bg, uint8_t size
+) {
+	// Like drawGlyphOpaque, but the cell's pixels come from the glyph cache, where they're rendered on a miss.
+	// Cells that don't fit in the cache at all are drawn directly.
+	const C *pixels = glyph_cache->find(font, code, color, bg, size);
+	if (!pixels) {
+		C *cached = glyph_cache->insert(font, code, color, bg, size, (uint32_t)cell_w * cell_h);
+		if (!cached) {
+			drawGlyphOpaque(glyph, left, top, cell_x, cell_y, cell_w, cell_h, color, bg, size);
+			return;
+		}
+		GlyphRows rows(
+			font->bitmap + glyph.bitmapOffset, font->compression ? 0 : fontBpp(), glyph.width, glyph.height,
+			left - cell_x, top - cell_y, size, cell_w, textRamp(color, bg)
+		);
+		for (int32_t i = 0; i < (int32_t)cell_w * cell_h; i++) {
+			cached[i] = rows();
+		}
+		pixels = cached;
+	}
+	blit(cell_x, cell_y, pixels, cell_w, cell_h);
+}
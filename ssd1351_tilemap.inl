@@ -0,0 +1,80 @@
+// Tile map backgrounds for all buffer modes, see tilemap.h.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+template <typename T>
+class TileMapRows {
+public:
+	// Produces the pixels of the whole screen row by row for use with streamRect, rendering every row of the map
+	// into a line buffer when its first pixel is asked for.
+	TileMapRows(const T &_map, int32_t _x, int32_t _y) : map(_map), x(_x), y(_y), col(0) {}
+
+	C __attribute__((always_inline)) operator()() {
+		if (!col) {
+			map.renderRow(line, x, y, W);
+		}
+		C color = line[col];
+		if (++col == W) {
+			col = 0;
+			y++;
+		}
+		return color;
+	}
+
+private:
+	const T &map;
+	int32_t x;
+	int32_t y;
+	int16_t col;
+	C line[W];
+};
+
+MEMBER_REQUIRES_WITH(T, std::is_same<B, SingleBuffer>::value)
+void drawTileMap(T &map, int32_t scroll_x, int32_t scroll_y) {
+	// Fills the screen with the map, scrolled so that scroll_x/scroll_y is at the top left corner.
+	// If the map was drawn before and only scrolled a bit since, what's still visible gets moved within the buffer
+	// and only the rows and columns that scrolled into view are rendered. Anything else drawn on top of the map
+	// moves along, so call map.invalidate() if that's not wanted.
+	int32_t dx = scroll_x - map.drawn_x;
+	int32_t dy = scroll_y - map.drawn_y;
+	bool reuse = map.drawn && abs(dx) < W && abs(dy) < H;
+	map.drawn = true;
+	map.drawn_x = scroll_x;
+	map.drawn_y = scroll_y;
+	if (!reuse) {
+		renderTileMap(map, scroll_x, scroll_y, 0, 0, W, H);
+		return;
+	}
+	if (!dx && !dy) {
+		return;
+	}
+
+	// Move the part that stays visible.
+	int16_t keep_w = W - abs(dx);
+	int16_t keep_h = H - abs(dy);
+	int16_t to_y = dy < 0 ? -dy : 0;
+	copyRect({(int16_t)(dx > 0 ? dx : 0), (int16_t)(dy > 0 ? dy : 0), keep_w, keep_h}, dx < 0 ? -dx : 0, to_y);
+
+	// Render what scrolled into view: full rows at the top or bottom, and the columns next to the moved part.
+	if (dy) {
+		renderTileMap(map, scroll_x, scroll_y, 0, dy > 0 ? keep_h : 0, W, abs(dy));
+	}
+	if (dx) {
+		renderTileMap(map, scroll_x, scroll_y, dx > 0 ? keep_w : 0, to_y, abs(dx), keep_h);
+	}
+}
+
+MEMBER_REQUIRES_WITH(T, std::is_same<B, NoBuffer>::value)
+void drawTileMap(T &map, int32_t scroll_x, int32_t scroll_y) {
+	// Without a buffer there's nothing to reuse, so the whole screen is sent, in a single window.
+	TileMapRows<T> rows(map, scroll_x, scroll_y);
+	streamRect(0, 0, W, H, rows);
+}
+
+MEMBER_REQUIRES_WITH(T, std::is_same<B, SingleBuffer>::value)
+void renderTileMap(const T &map, int32_t scroll_x, int32_t scroll_y, int16_t x, int16_t y, int16_t w, int16_t h) {
+	// Renders part of the screen for drawTileMap.
+	C *row = &frontBuffer()[x + (W * y)];
+	for (int16_t i = 0; i < h; i++, row += W) {
+		map.renderRow(row, scroll_x + x, scroll_y + y + i, w);
+	}
+}
@@ -0,0 +1,96 @@
+// Rotated and scaled bitmaps for single buffered mode, see transform.h.
+// Every screen pixel is mapped back into the bitmap (inverse mapping), so there are no holes no matter how the
+// bitmap is scaled. The bitmap coordinates are kept in 16.16 fixed point and stepped incrementally along each row.
+// This gets included from inside the template definition in ssd1351.h, which is crazy, but it's the only way I know to make this compile.
+
+MEMBER_REQUIRES_WITH(S, std::is_same<B, SingleBuffer>::value)
+void blitTransformed(const S *pixels, int16_t w, int16_t h, const Transform &transform, uint8_t sampling = SAMPLE_NEAREST) {
+	// Draws a w * h bitmap of any color type (or RGB), with its pixel coordinates mapped to the screen by transform.
+	Transform inverse;
+	if (w <= 0 || h <= 0 || !transform.invert(inverse)) {
+		return;
+	}
+
+	// Only the rows the bitmap's corners span need to be looked at.
+	float corner_x, corner_y;
+	float min_y = 32767;
+	float max_y = -32768;
+	for (uint8_t corner = 0; corner < 4; corner++) {
+		transform.apply(corner & 1 ? w : 0, corner & 2 ? h : 0, corner_x, corner_y);
+		min_y = corner_y < min_y ? corner_y : min_y;
+		max_y = corner_y > max_y ? corner_y : max_y;
+	}
+	if (max_y < 0 || min_y >= H) {
+		return;
+	}
+	int16_t first_row = min_y < 0 ? 0 : (int16_t)min_y;
+	int16_t end_row = max_y >= H ? H : (int16_t)max_y + 1;
+
+	int32_t end_u = (int32_t)w << 16;
+	int32_t end_v = (int32_t)h << 16;
+	int32_t step_u = toFixed(inverse.a);
+	int32_t step_v = toFixed(inverse.d);
+	for (int16_t y = first_row; y < end_row; y++) {
+		// Where the center of the row's first pixel maps to in the bitmap.
+		float row_u = inverse.a * 0.5f + inverse.b * (y + 0.5f) + inverse.c;
+		float row_v = inverse.d * 0.5f + inverse.e * (y + 0.5f) + inverse.f;
+
+		// Find the pixels of the row that map into the bitmap, first roughly in floating point...
+		float start = 0;
+		float end = W;
+		narrowSpan(row_u, inverse.a, w, start, end);
+		narrowSpan(row_v, inverse.d, h, start, end);
+		if (end <= start) {
+			continue;
+		}
+		int16_t x = start;
+		int16_t x_end = end + 1;
+		x_end = x_end > W ? W : x_end;
+
+		// ...then exactly, with the same fixed point values the loop below steps through. Outside of the bitmap
+		// these can get too big for 32 bits, so this part works with 64.
+		int64_t first_u = toFixed(row_u + inverse.a * x);
+		int64_t first_v = toFixed(row_v + inverse.d * x);
+		while (x < x_end && (first_u < 0 || first_u >= end_u || first_v < 0 || first_v >= end_v)) {
+			x++;
+			first_u += step_u;
+			first_v += step_v;
+		}
+		while (x_end > x) {
+			int64_t last_u = first_u + (int64_t)step_u * (x_end - 1 - x);
+			int64_t last_v = first_v + (int64_t)step_v * (x_end - 1 - x);
+			if (last_u >= 0 && last_u < end_u && last_v >= 0 && last_v < end_v) {
+				break;
+			}
+			x_end--;
+		}
+		if (x >= x_end) {
+			continue;
+		}
+
+		// Both ends are inside the bitmap, so everything in between is too. The loops stop before stepping past
+		// the last pixel, which is the only step that could overflow.
+		int32_t u = first_u;
+		int32_t v = first_v;
+		C *row = &frontBuffer()[W * y];
+		if (sampling == SAMPLE_BILINEAR) {
+			for (;;) {
+				row[x] = sampleBilinear<C>(pixels, w, h, u, v);
+				if (++x == x_end) {
+					break;
+				}
+				u += step_u;
+				v += step_v;
+			}
+		} else {
+			for (;;) {
+				row[x] = convertColor<C>(pixels[(v >> 16) * w + (u >> 16)]);
+				if (++x == x_end) {
+					break;
+				}
+				u += step_u;
+				v += step_v;
+			}
+		}
+	}
+}
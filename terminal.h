@@ -0,0 +1,294 @@
+#pragma once
+#include <Arduino.h>
+#include "color.h"
+#include "glcdfont.h"
+
+namespace ssd1351 {
+
+// Size of a terminal's character cells: the classic 5x7 font from glcdfont.h, with a column and a row of spacing.
+static const uint8_t TERMINAL_CELL_W = 6;
+static const uint8_t TERMINAL_CELL_H = 8;
+
+inline uint8_t glcdColumn(uint8_t c, uint8_t column) {
+	// Column of a character of the classic font, bit 0 is the top row.
+	return pgm_read_byte(GLCD_FONT + c * 5 + column);
+}
+
+// A grid of COLUMNS * ROWS character cells with a cursor, for log output and other console style text.
+// Print to it like to Serial, then call display.drawTerminal(terminal) to show what changed: every changed cell is
+// drawn as one opaque window, and scrolling moves the display's start line instead of redrawing anything but the new
+// line. Understands \n, \r, \b and \t, and these ANSI escape sequences:
+// ESC[...m for colors (0 reset, 1 bright, 7 inverse, 30-37/90-97 foreground, 40-47/100-107 background, 39/49 default),
+// ESC[row;columnH to move the cursor (1 based), ESC[J / ESC[2J to clear to the end of / the whole screen and
+// ESC[K / ESC[2K to clear to the end of / the whole line. Other sequences (like ESC[?25l) are skipped.
+// Every cell takes 2 bytes, the colors index the palette.
+template <typename C, uint8_t COLUMNS, uint8_t ROWS>
+class Terminal : public Print {
+public:
+	// The standard ANSI colors, followed by their bright versions.
+	C palette[16] = {
+		RGB(0, 0, 0), RGB(170, 0, 0), RGB(0, 170, 0), RGB(170, 85, 0),
+		RGB(0, 0, 170), RGB(170, 0, 170), RGB(0, 170, 170), RGB(170, 170, 170),
+		RGB(85, 85, 85), RGB(255, 85, 85), RGB(85, 255, 85), RGB(255, 255, 85),
+		RGB(85, 85, 255), RGB(255, 85, 255), RGB(85, 255, 255), RGB(255, 255, 255)
+	};
+
+	Terminal() {
+		clear();
+		invalidate();
+	}
+
+	size_t write(uint8_t c) override {
+		if (state == ESCAPE) {
+			state = c == '[' ? CSI : NORMAL;
+			param_count = 0;
+			params[0] = 0;
+			unsupported = false;
+			return 1;
+		}
+		if (state == CSI) {
+			// Parameter bytes (0x30-0x3F) and intermediate bytes (0x20-0x2F) up to a final byte (0x40-0x7E).
+			// Only plain numbers separated by ';' are understood, anything else (private markers like '?',
+			// intermediate bytes) makes the whole sequence get skipped.
+			if (c >= '0' && c <= '9') {
+				uint16_t param = params[param_count] * 10 + c - '0';
+				params[param_count] = param > 9999 ? 9999 : param;
+				return 1;
+			} else if (c == ';') {
+				if (param_count < MAX_PARAMS - 1) {
+					params[++param_count] = 0;
+				}
+				return 1;
+			} else if (c >= 0x20 && c <= 0x3F) {
+				unsupported = true;
+				return 1;
+			} else if (c >= 0x40 && c <= 0x7E) {
+				param_count++;
+				if (!unsupported) {
+					runSequence(c);
+				}
+				state = NORMAL;
+				return 1;
+			}
+			// Anything else breaks the sequence off and is handled like any other character.
+			state = NORMAL;
+		}
+		switch (c) {
+			case 0x1B:
+				state = ESCAPE;
+				break;
+			case '\n':
+				newLine();
+				break;
+			case '\r':
+				column = 0;
+				break;
+			case '\b':
+				column = column ? (column >= COLUMNS ? COLUMNS - 1 : column) - 1 : 0;
+				break;
+			case '\t':
+				column = (column + 8) & ~7;
+				column = column > COLUMNS ? COLUMNS : column;
+				break;
+			default:
+				if (column >= COLUMNS) {
+					// The last character of a line only wraps once there's another one
+					newLine();
+				}
+				setCell(row, column++, c, attributes());
+		}
+		return 1;
+	}
+
+	void clear() {
+		// Clears the screen with the current background color and moves the cursor to the top left.
+		clearRows(0, ROWS);
+		row = column = 0;
+	}
+
+	void setCursor(uint8_t _column, uint8_t _row) {
+		column = _column < COLUMNS ? _column : COLUMNS - 1;
+		row = _row < ROWS ? _row : ROWS - 1;
+	}
+
+	uint8_t getCursorX() const {
+		return column;
+	}
+
+	uint8_t getCursorY() const {
+		return row;
+	}
+
+	void setColors(uint8_t _foreground, uint8_t _background) {
+		// Palette indices for the following text, like ESC[...m.
+		foreground = _foreground & 15;
+		background = _background & 15;
+		bright = inverse = false;
+	}
+
+	void invalidate() {
+		// Makes the next drawTerminal draw every cell, e.g. after something else got drawn on top.
+		for (uint8_t r = 0; r < ROWS; r++) {
+			memset(dirty[r], 0xFF, sizeof(dirty[r]));
+		}
+	}
+
+	// Cells of the screen, row 0 is the top one.
+	uint8_t character(uint8_t r, uint8_t c) const {
+		return chars[ringRow(r)][c];
+	}
+
+	uint8_t foregroundAt(uint8_t r, uint8_t c) const {
+		return attrs[ringRow(r)][c] & 15;
+	}
+
+	uint8_t backgroundAt(uint8_t r, uint8_t c) const {
+		return attrs[ringRow(r)][c] >> 4;
+	}
+
+	bool changed(uint8_t r, uint8_t c) const {
+		return dirty[ringRow(r)][c >> 3] & (1 << (c & 7));
+	}
+
+	void markDrawn() {
+		for (uint8_t r = 0; r < ROWS; r++) {
+			memset(dirty[r], 0, sizeof(dirty[r]));
+		}
+		scrolled = 0;
+	}
+
+	// Lines scrolled since the last drawTerminal.
+	uint16_t scrolled = 0;
+
+private:
+	static const uint8_t NORMAL = 0;
+	static const uint8_t ESCAPE = 1;
+	static const uint8_t CSI = 2;
+	static const uint8_t MAX_PARAMS = 8;
+
+	// The rows are a ring, so scrolling doesn't move anything: first_row is the one at the top of the screen.
+	uint8_t chars[ROWS][COLUMNS];
+	uint8_t attrs[ROWS][COLUMNS]; // Background in the high nibble, foreground in the low one
+	uint8_t dirty[ROWS][(COLUMNS + 7) / 8];
+	uint8_t first_row = 0;
+	uint8_t row = 0;
+	uint8_t column = 0; // COLUMNS once a line is full, see write()
+	uint8_t foreground = 7;
+	uint8_t background = 0;
+	bool bright = false;
+	bool inverse = false;
+	uint8_t state = NORMAL;
+	uint16_t params[MAX_PARAMS];
+	uint8_t param_count = 0;
+	bool unsupported = false; // Set for sequences with bytes runSequence doesn't know about
+
+	uint8_t ringRow(uint8_t r) const {
+		return first_row + r < ROWS ? first_row + r : first_row + r - ROWS;
+	}
+
+	uint8_t attributes() const {
+		uint8_t fg = bright && foreground < 8 ? foreground + 8 : foreground;
+		return inverse ? (fg << 4) | background : (background << 4) | fg;
+	}
+
+	void setCell(uint8_t r, uint8_t c, uint8_t character, uint8_t attribute) {
+		uint8_t ring_row = ringRow(r);
+		if (chars[ring_row][c] != character || attrs[ring_row][c] != attribute) {
+			chars[ring_row][c] = character;
+			attrs[ring_row][c] = attribute;
+			dirty[ring_row][c >> 3] |= 1 << (c & 7);
+		}
+	}
+
+	void clearCells(uint8_t r, uint8_t from, uint8_t to) {
+		uint8_t attribute = attributes() & 0xF0;
+		for (uint8_t c = from; c < to; c++) {
+			setCell(r, c, ' ', attribute);
+		}
+	}
+
+	void clearRows(uint8_t from, uint8_t to) {
+		for (uint8_t r = from; r < to; r++) {
+			clearCells(r, 0, COLUMNS);
+		}
+	}
+
+	void newLine() {
+		column = 0;
+		if (row < ROWS - 1) {
+			row++;
+			return;
+		}
+		// The new bottom row starts out with all of its cells changed, the others keep their flags
+		// because drawTerminal moves what was drawn along.
+		first_row = ringRow(1);
+		uint8_t ring_row = ringRow(ROWS - 1);
+		memset(chars[ring_row], ' ', COLUMNS);
+		memset(attrs[ring_row], attributes() & 0xF0, COLUMNS);
+		memset(dirty[ring_row], 0xFF, sizeof(dirty[ring_row]));
+		scrolled++;
+	}
+
+	void runSequence(uint8_t command) {
+		uint16_t first = params[0];
+		switch (command) {
+			case 'm':
+				for (uint8_t i = 0; i < param_count; i++) {
+					setAttribute(params[i]);
+				}
+				break;
+			case 'H':
+			case 'f': {
+				uint16_t to_row = first ? first - 1 : 0;
+				uint16_t to_column = param_count > 1 && params[1] ? params[1] - 1 : 0;
+				setCursor(to_column < COLUMNS ? to_column : COLUMNS - 1, to_row < ROWS ? to_row : ROWS - 1);
+				break;
+			}
+			case 'J':
+				if (first == 2) {
+					clearRows(0, ROWS);
+				} else if (first == 0) {
+					clearCells(row, column < COLUMNS ? column : COLUMNS, COLUMNS);
+					clearRows(row + 1, ROWS);
+				}
+				break;
+			case 'K':
+				if (first == 2) {
+					clearCells(row, 0, COLUMNS);
+				} else if (first == 0) {
+					clearCells(row, column < COLUMNS ? column : COLUMNS, COLUMNS);
+				}
+				break;
+		}
+	}
+
+	void setAttribute(uint16_t code) {
+		if (code == 0) {
+			foreground = 7;
+			background = 0;
+			bright = inverse = false;
+		} else if (code == 1) {
+			bright = true;
+		} else if (code == 22) {
+			bright = false;
+		} else if (code == 7) {
+			inverse = true;
+		} else if (code == 27) {
+			inverse = false;
+		} else if (code >= 30 && code <= 37) {
+			foreground = code - 30;
+		} else if (code == 39) {
+			foreground = 7;
+		} else if (code >= 40 && code <= 47) {
+			background = code - 40;
+		} else if (code == 49) {
+			background = 0;
+		} else if (code >= 90 && code <= 97) {
+			foreground = code - 90 + 8;
+		} else if (code >= 100 && code <= 107) {
+			background = code - 100 + 8;
+		}
+	}
+};
+
+}
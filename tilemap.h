@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+
+namespace ssd1351 {
+
+// A background made of square tiles, drawn with drawTileMap.
+// tiles holds the pixels of all tiles in the display's color type, one tile after the other (TILE_SIZE * TILE_SIZE
+// pixels each, row by row), and map holds the tile index for every cell of a map_w * map_h grid, row by row.
+// Both can live in flash. The map repeats in both directions, so it can be scrolled endlessly.
+template <typename C, uint8_t TILE_SIZE = 8>
+class TileMap {
+public:
+	TileMap(const C *_tiles, const uint8_t *_map, uint16_t _map_w, uint16_t _map_h)
+		: tiles(_tiles), map(_map), map_w(_map_w), map_h(_map_h) {}
+
+	void setTile(uint16_t column, uint16_t row, uint8_t tile) {
+		// Only works if map is in RAM. The next drawTileMap draws everything from scratch.
+		const_cast<uint8_t *>(map)[row * map_w + column] = tile;
+		invalidate();
+	}
+
+	void invalidate() {
+		// Makes the next drawTileMap draw everything from scratch, e.g. after something else got drawn on top.
+		drawn = false;
+	}
+
+	void renderRow(C *out, int32_t x, int32_t y, int16_t count) const {
+		// Writes count pixels of the map's row y, starting at x. The pixels of every tile are copied in one go.
+		int32_t map_row = wrap(y, map_h * TILE_SIZE);
+		const uint8_t *cells = map + (map_row / TILE_SIZE) * map_w;
+		int32_t tile_offset = (map_row % TILE_SIZE) * TILE_SIZE;
+		int32_t map_x = wrap(x, map_w * TILE_SIZE);
+		uint16_t column = map_x / TILE_SIZE;
+		uint8_t tile_x = map_x % TILE_SIZE;
+		while (count > 0) {
+			int16_t run = TILE_SIZE - tile_x < count ? TILE_SIZE - tile_x : count;
+			const C *pixels = tiles + (int32_t)pgm_read_byte(cells + column) * TILE_SIZE * TILE_SIZE + tile_offset + tile_x;
+			memcpy(out, pixels, run * sizeof(C));
+			out += run;
+			count -= run;
+			tile_x = 0;
+			if (++column == map_w) {
+				column = 0;
+			}
+		}
+	}
+
+	// Where the map was drawn the last time, so the next drawTileMap can reuse what's still visible.
+	bool drawn = false;
+	int32_t drawn_x = 0;
+	int32_t drawn_y = 0;
+
+private:
+	const C *tiles;
+	const uint8_t *map;
+	uint16_t map_w;
+	uint16_t map_h;
+
+	static int32_t __attribute__((always_inline)) wrap(int32_t value, int32_t size) {
+		value %= size;
+		return value < 0 ? value + size : value;
+	}
+};
+
+}
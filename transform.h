@@ -0,0 +1,121 @@
+#pragma once
+#include <Arduino.h>
+#include "convert.h"
+
+namespace ssd1351 {
+
+// Sampling modes for blitTransformed.
+static const uint8_t SAMPLE_NEAREST = 0; // The source pixel closest to where a screen pixel maps to
+static const uint8_t SAMPLE_BILINEAR = 1; // The four closest source pixels, weighted by distance
+
+struct Transform {
+	// An affine transform, mapping x/y to a * x + b * y + c, d * x + e * y + f.
+	// Transforms are combined by multiplying them: (t1 * t2) applies t2 first, then t1. So rotating a bitmap
+	// around its center and putting that center at x/y is
+	// Transform::translation(x, y) * Transform::rotation(angle) * Transform::translation(-w / 2.0f, -h / 2.0f)
+	float a = 1;
+	float b = 0;
+	float c = 0;
+	float d = 0;
+	float e = 1;
+	float f = 0;
+
+	Transform() {}
+	Transform(float _a, float _b, float _c, float _d, float _e, float _f) : a(_a), b(_b), c(_c), d(_d), e(_e), f(_f) {}
+
+	static Transform translation(float x, float y) {
+		return Transform(1, 0, x, 0, 1, y);
+	}
+
+	static Transform scaling(float x, float y) {
+		return Transform(x, 0, 0, 0, y, 0);
+	}
+
+	static Transform rotation(float degrees) {
+		// Clockwise on screen, as y points down.
+		float s = sinf(degrees * (float)M_PI / 180);
+		float co = cosf(degrees * (float)M_PI / 180);
+		return Transform(co, -s, 0, s, co, 0);
+	}
+
+	Transform operator*(const Transform &other) const {
+		return Transform(
+			a * other.a + b * other.d, a * other.b + b * other.e, a * other.c + b * other.f + c,
+			d * other.a + e * other.d, d * other.b + e * other.e, d * other.c + e * other.f + f
+		);
+	}
+
+	void apply(float x, float y, float &out_x, float &out_y) const {
+		out_x = a * x + b * y + c;
+		out_y = d * x + e * y + f;
+	}
+
+	bool invert(Transform &inverse) const {
+		// Returns false if the transform squashes everything onto a line or point and can't be inverted.
+		float determinant = a * e - b * d;
+		if (fabsf(determinant) < 1e-6f) {
+			return false;
+		}
+		float i = 1 / determinant;
+		inverse = Transform(e * i, -b * i, (b * f - c * e) * i, -d * i, a * i, (c * d - a * f) * i);
+		return true;
+	}
+};
+
+// Helpers for blitTransformed
+
+inline void narrowSpan(float value, float step, int16_t size, float &start, float &end) {
+	// Narrows start/end down to the part of a row where value + step * x lies within 0 and size.
+	if (fabsf(step) < 1e-6f) {
+		if (value < 0 || value >= size) {
+			end = start;
+		}
+		return;
+	}
+	float enter = -value / step;
+	float leave = (size - value) / step;
+	if (step < 0) {
+		float swapped = enter;
+		enter = leave;
+		leave = swapped;
+	}
+	start = enter - 1 > start ? enter - 1 : start;
+	end = leave < end ? leave : end;
+}
+
+inline int32_t toFixed(float value) {
+	// Converts to 16.16 fixed point, clamped to what fits into an int32_t (2^31 - 128 is the largest float below 2^31).
+	value *= 65536;
+	return value >= 2147483520.0f ? 2147483520 : (value <= -2147483520.0f ? -2147483520 : (int32_t)value);
+}
+
+template <typename C, typename S>
+inline C __attribute__((always_inline)) sampleBilinear(const S *pixels, int16_t w, int16_t h, int32_t u, int32_t v) {
+	// Mixes the four pixels around u/v (16.16 fixed point, pixel centers are at .5), the edges are repeated.
+	u -= 32768;
+	v -= 32768;
+	int16_t x0 = u >> 16;
+	int16_t y0 = v >> 16;
+	int32_t fx = (u >> 8) & 0xFF;
+	int32_t fy = (v >> 8) & 0xFF;
+	int16_t x1 = x0 + 1 < w ? x0 + 1 : w - 1;
+	int16_t y1 = y0 + 1 < h ? y0 + 1 : h - 1;
+	x0 = x0 < 0 ? 0 : x0;
+	y0 = y0 < 0 ? 0 : y0;
+
+	int16_t top_left[3], top_right[3], bottom_left[3], bottom_right[3];
+	displayedChannels(pixels[y0 * w + x0], top_left[0], top_left[1], top_left[2]);
+	displayedChannels(pixels[y0 * w + x1], top_right[0], top_right[1], top_right[2]);
+	displayedChannels(pixels[y1 * w + x0], bottom_left[0], bottom_left[1], bottom_left[2]);
+	displayedChannels(pixels[y1 * w + x1], bottom_right[0], bottom_right[1], bottom_right[2]);
+
+	int16_t mixed[3];
+	for (uint8_t channel = 0; channel < 3; channel++) {
+		int32_t top = top_left[channel] * (256 - fx) + top_right[channel] * fx;
+		int32_t bottom = bottom_left[channel] * (256 - fx) + bottom_right[channel] * fx;
+		mixed[channel] = (top * (256 - fy) + bottom * fy + 32768) >> 16;
+	}
+	return quantize<C>(mixed[0], mixed[1], mixed[2]);
+}
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <Arduino.h>
+#include "gfxfont.h"
+
+namespace ssd1351 {
+
+// How text is decoded: UTF8_AUTO decodes UTF-8 for fonts that have extra ranges (made with fontconvert -u)
+// and takes every byte as a character of its own for all other fonts.
+static const uint8_t UTF8_OFF = 0;
+static const uint8_t UTF8_ON = 1;
+static const uint8_t UTF8_AUTO = 2;
+
+// Turns UTF-8 text into Unicode code points, one byte at a time as print() hands them over.
+// Bytes that can't be part of valid UTF-8 (stray continuation bytes, invalid lead bytes) are taken as Latin-1.
+// Sequences that get cut off are dropped though, and that includes most accented Latin-1 letters (0xC2 - 0xF4)
+// followed by anything but a continuation byte. So Latin-1 text has to be drawn with decoding turned off,
+// which is what UTF8_AUTO does for fonts without extra ranges.
+class UTF8Decoder {
+public:
+	bool next(uint8_t byte, uint32_t &code) {
+		// Returns true when byte completes a code point, which is then stored in code.
+		if (remaining && (byte & 0xC0) == 0x80) {
+			value = (value << 6) | (byte & 0x3F);
+			if (--remaining) {
+				return false;
+			}
+			code = value;
+			return true;
+		}
+		remaining = 0;
+		if (byte >= 0xC2 && byte <= 0xF4) {
+			remaining = byte >= 0xF0 ? 3 : (byte >= 0xE0 ? 2 : 1);
+			value = byte & (0x3F >> remaining);
+			return false;
+		}
+		code = byte;
+		return true;
+	}
+
+private:
+	uint32_t value = 0;
+	uint8_t remaining = 0;
+};
+
+inline const GFXglyph *findGlyph(const GFXfont &font, uint32_t code) {
+	// Returns the glyph for a code point, or nullptr if the font doesn't have it.
+	// The first..last range is indexed directly, so ASCII text doesn't get any slower. The extra ranges are
+	// searched with a binary search.
+	if (code >= font.first && code <= font.last) {
+		return &font.glyph[code - font.first];
+	}
+	uint16_t low = 0;
+	uint16_t high = font.rangeCount;
+	while (low < high) {
+		uint16_t middle = (low + high) / 2;
+		const GFXrange &range = font.ranges[middle];
+		if (code < range.first) {
+			high = middle;
+		} else if (code > range.last) {
+			low = middle + 1;
+		} else {
+			return &font.glyph[range.glyph + (code - range.first)];
+		}
+	}
+	return nullptr;
+}
+
+inline bool decodesUTF8(const GFXfont &font, uint8_t mode) {
+	return mode == UTF8_AUTO ? font.rangeCount > 0 : mode == UTF8_ON;
+}
+
+inline uint16_t fontGlyphCount(const GFXfont &font) {
+	// Number of glyphs in the font's glyph array: the first..last range followed by the glyphs of the extra ranges.
+	uint16_t count = font.last - font.first + 1;
+	for (uint16_t i = 0; i < font.rangeCount; i++) {
+		uint16_t end = font.ranges[i].glyph + (font.ranges[i].last - font.ranges[i].first) + 1;
+		count = end > count ? end : count;
+	}
+	return count;
+}
+
+inline int8_t findFontTop(const GFXfont &font) {
+	// The highest any glyph of the font reaches above the baseline (as a negative offset), extra ranges included.
+	int8_t top = 0;
+	for (uint16_t i = 0; i < fontGlyphCount(font); i++) {
+		top = font.glyph[i].yOffset < top ? font.glyph[i].yOffset : top;
+	}
+	return top;
+}
+
+}
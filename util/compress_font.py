@@ -0,0 +1,95 @@
+"""
+Rewrites a GFX font header (as made by fontconvert) with compressed glyph bitmaps, see fontcompression.h.
+Same as converting the font again with fontconvert -c, for fonts whose outline font isn't at hand.
+
+Usage: python compress_font.py Font.h > FontCompressed.h
+
+Fonts keep their names, so the compressed header can replace the original one. Only plain 1 bit fonts can be
+compressed. The bitmap sizes before and after are printed to stderr: small fonts usually get bigger.
+"""
+import re
+import sys
+
+GLYPH = re.compile(r'\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}')
+
+
+def runs(bits):
+    # Lengths of the runs alternating between unset and set pixels, starting with unset ones.
+    result = []
+    current = 0
+    run = 0
+    for bit in bits:
+        if bit != current:
+            result.append(run)
+            run = 0
+            current = bit
+        run += 1
+    if run:
+        result.append(run)
+    return result
+
+
+def encode_glyph(bitmap, offset, width, height):
+    nibbles = []
+    pixels = width * height
+    bits = [(bitmap[offset + i // 8] >> (7 - i % 8)) & 1 for i in range(pixels)]
+    for run in runs(bits) if pixels else []:
+        while run >= 15:
+            nibbles.append(15)
+            run -= 15
+        nibbles.append(run)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append(', '.join('0x{:02X}'.format(byte) for byte in data[i:i + 12]))
+    return '  ' + ',\n  '.join(lines)
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    text = open(sys.argv[1]).read()
+
+    bitmap_match = re.search(r'(Bitmaps\[\] PROGMEM = \{)(.*?)(\s*\};)', text, re.S)
+    bitmap = [int(byte, 16) for byte in re.findall(r'0x([0-9A-Fa-f]{2})', bitmap_match.group(2))]
+    glyphs_match = re.search(r'Glyphs\[\] PROGMEM = \{(.*?)\};', text, re.S)
+    font_match = re.search(r'(\(GFXglyph \*\)\w+,\s*)([^}]*)(\};)', text)
+    fields = [field.strip() for field in font_match.group(2).split(',')]
+    if len(fields) > 3 and fields[3] not in ('0', '1'):
+        sys.exit('Only 1 bit fonts can be compressed')
+    if len(fields) > 6 and fields[6] != '0':
+        sys.exit('Font is compressed already')
+
+    compressed = []
+    offsets = []
+    for glyph in GLYPH.finditer(glyphs_match.group(1)):
+        offsets.append(len(compressed))
+        compressed += encode_glyph(bitmap, int(glyph.group(1)), int(glyph.group(2)), int(glyph.group(3)))
+    if len(compressed) > 0xFFFF:
+        sys.exit('Compressed bitmaps are too big for 16 bit offsets')
+
+    glyph_index = iter(offsets)
+    glyphs = GLYPH.sub(lambda glyph: '{{ {:5d}, {:>3}, {:>3}, {:>3}, {:>4}, {:>4} }}'.format(
+        next(glyph_index), *glyph.groups()[1:]), glyphs_match.group(1))
+    fields += ['1', 'NULL', '0'][len(fields) - 3:]
+    fields = fields[:6] + ['1']
+
+    text = (
+        text[:bitmap_match.start(2)] + '\n' + format_bytes(compressed) + text[bitmap_match.end(2):glyphs_match.start(1)]
+        + glyphs + text[glyphs_match.end(1):font_match.start(2)]
+        + ', '.join(fields[:4]) + ',\n  ' + ', '.join(fields[4:]) + ' ' + text[font_match.end(2):]
+    )
+    text = re.sub(r'// Approx\. \d+ bytes', lambda match: '// Approx. {} bytes'.format(
+        len(compressed) + len(offsets) * 7 + 7), text)
+    sys.stdout.write(text)
+    sys.stderr.write('Compressed bitmaps: {} bytes instead of {}\n'.format(len(compressed), len(bitmap)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,77 @@
+"""
+Run length encodes an image with transparency into an RLESprite (see sprite.h), printed as a C++ header.
+
+Usage: python encode_sprite.py image.png name [low|high|indexed] > name.h
+
+Pixels with an alpha below 128 are transparent. Needs Pillow.
+"""
+import sys
+from PIL import Image
+
+
+def encode_pixel(r, g, b, color_format):
+    if color_format == 'low':
+        return '0x{:04X}'.format(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    if color_format == 'indexed':
+        return '0x{:02X}'.format((r & 0xE0) | ((g & 0xE0) >> 3) | (b >> 6))
+    return 'ssd1351::HighColor({}, {}, {})'.format(r, g, b)
+
+
+def encode_row(row):
+    # Returns the (skip, count) pairs and the opaque pixels of a row of (r, g, b, a) pixels.
+    runs = []
+    pixels = []
+    x = 0
+    while x < len(row):
+        skip = 0
+        while x < len(row) and row[x][3] < 128:
+            skip += 1
+            x += 1
+        while skip > 255:
+            runs += [255, 0]
+            skip -= 255
+        count = 0
+        while x < len(row) and row[x][3] >= 128 and count < 255:
+            pixels.append(row[x])
+            count += 1
+            x += 1
+        runs += [skip, count]
+    return runs, pixels
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+    image = Image.open(sys.argv[1]).convert('RGBA')
+    name = sys.argv[2]
+    color_format = sys.argv[3] if len(sys.argv) > 3 else 'low'
+    type_name = {'low': 'LowColor', 'high': 'HighColor', 'indexed': 'IndexedColor'}[color_format]
+
+    w, h = image.size
+    data = list(image.getdata())
+    runs = []
+    pixels = []
+    for y in range(h):
+        row_runs, row_pixels = encode_row(data[y * w:(y + 1) * w])
+        runs += row_runs
+        pixels += row_pixels
+
+    print('#pragma once')
+    print('#include <ssd1351.h>')
+    print('')
+    print('const uint8_t {}_runs[] PROGMEM = {{'.format(name))
+    for i in range(0, len(runs), 16):
+        print('\t' + ', '.join(str(r) for r in runs[i:i + 16]) + ',')
+    print('};')
+    print('')
+    print('const ssd1351::{} {}_pixels[] = {{'.format(type_name, name))
+    for i in range(0, len(pixels), 8):
+        print('\t' + ', '.join(encode_pixel(p[0], p[1], p[2], color_format) for p in pixels[i:i + 8]) + ',')
+    print('};')
+    print('')
+    print('const ssd1351::RLESprite<ssd1351::{0}> {1} = {{{1}_runs, {1}_pixels, {2}, {3}}};'.format(type_name, name, w, h))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,42 @@
+# Generates gray scale lookup tables for the SSD1351 (command 0xB8, see SSD1351::setGrayscaleTable).
+# The table holds the pulse widths (in display clocks, up to 180) for gray levels 1 to 63,
+# level 0 is always off. Brightness is roughly proportional to the pulse width, so raising the
+# level to the power of gamma gives a gamma corrected response without any work on the CPU.
+#
+# Usage: python generate_gamma_table.py [gamma ...] > ../gamma.h
+import sys
+
+MAX_PULSE_WIDTH = 180
+LEVELS = 63
+
+
+def gamma_table(gamma):
+    table = []
+    previous = 0
+    for level in range(1, LEVELS + 1):
+        width = int(round(MAX_PULSE_WIDTH * (level / float(LEVELS)) ** gamma))
+        # The controller needs strictly increasing pulse widths
+        width = max(width, previous + 1)
+        table.append(width)
+        previous = width
+    return table
+
+
+gammas = [float(g) for g in sys.argv[1:]] or [1.8, 2.2, 2.5]
+
+print('#pragma once')
+print('#include <Arduino.h>')
+print('')
+print('// Gray scale tables generated by util/generate_gamma_table.py, for use with SSD1351::setGrayscaleTable().')
+print('')
+print('namespace ssd1351 {')
+for gamma in gammas:
+    name = 'gamma_{}'.format(str(gamma).replace('.', '_'))
+    values = gamma_table(gamma)
+    print('')
+    print('static const uint8_t {}[63] PROGMEM = {{'.format(name))
+    for i in range(0, len(values), 16):
+        print('\t' + ', '.join('{:3d}'.format(v) for v in values[i:i + 16]) + (',' if i + 16 < len(values) else ''))
+    print('};')
+print('')
+print('}')